@@ -10,6 +10,7 @@
  *
  */
 #include "..\hprdbgctrl\pch.h"
+#include "LogBuffers.h"
 
 using namespace std;
 
@@ -105,6 +106,391 @@ ShowMessages(const char * Fmt, ...)
 
 #if !UseDbgPrintInsteadOfUsermodeMessageTracking
 
+/**
+ * @brief Handle a message from kernel buffers
+ *
+ * @param OperationCode Operation code of the message
+ * @param Message The message (null-terminated)
+ * @param ReturnedLength Length of the message + size of the operation code
+ */
+VOID
+ReadKernelMessageHandle(UINT32 OperationCode, CHAR * Message, UINT32 ReturnedLength)
+{
+    BOOLEAN     OutputSourceFound;
+    PLIST_ENTRY TempList;
+    CHAR        RenderedEventRecord[PacketChunkSize];
+
+    switch (OperationCode)
+    {
+    case OPERATION_LOG_NON_IMMEDIATE_MESSAGE:
+
+        if (g_BreakPrintingOutput)
+        {
+            //
+            // means that the user asserts a CTRL+C or CTRL+BREAK Signal
+            // we shouldn't show or save anything in this case
+            //
+            return;
+        }
+
+        ShowMessages("%s", Message);
+
+        break;
+    case OPERATION_LOG_INFO_MESSAGE:
+
+        if (g_BreakPrintingOutput)
+        {
+            //
+            // means that the user asserts a CTRL+C or CTRL+BREAK Signal
+            // we shouldn't show or save anything in this case
+            //
+            return;
+        }
+
+        ShowMessages("%s", Message);
+
+        break;
+    case OPERATION_LOG_ERROR_MESSAGE:
+        if (g_BreakPrintingOutput)
+        {
+            //
+            // means that the user asserts a CTRL+C or CTRL+BREAK Signal
+            // we shouldn't show or save anything in this case
+            //
+            return;
+        }
+
+        ShowMessages("%s", Message);
+
+        break;
+    case OPERATION_LOG_WARNING_MESSAGE:
+
+        if (g_BreakPrintingOutput)
+        {
+            //
+            // means that the user asserts a CTRL+C or CTRL+BREAK Signal
+            // we shouldn't show or save anything in this case
+            //
+            return;
+        }
+
+        ShowMessages("%s", Message);
+
+        break;
+
+    case OPERATION_LOG_EVENT_RECORD:
+
+        if (g_BreakPrintingOutput)
+        {
+            //
+            // means that the user asserts a CTRL+C or CTRL+BREAK Signal
+            // we shouldn't show or save anything in this case
+            //
+            return;
+        }
+
+        //
+        // Binary records of printf (deferred formatting) are rendered by the
+        // formats of the script of the event, then the text is handled like
+        // other messages of events (it might be forwarded to output sources)
+        //
+        if (!ScriptEngineWrapperRenderEventRecord((PDEBUGGER_EVENT_RECORD)Message,
+                                                  ReturnedLength - sizeof(UINT32),
+                                                  RenderedEventRecord,
+                                                  sizeof(RenderedEventRecord)))
+        {
+            ShowMessages("err, unable to render the record of the event\n");
+            return;
+        }
+
+        ReadKernelMessageHandle(OPERATION_LOG_WITH_TAG,
+                                RenderedEventRecord,
+                                (UINT32)strlen(RenderedEventRecord) + 1 + sizeof(UINT32));
+
+        break;
+
+    case OPERATION_COMMAND_FROM_DEBUGGER_CLOSE_AND_UNLOAD_VMM:
+
+        KdCloseConnection();
+
+        break;
+
+    case OPERATION_DEBUGGEE_USER_INPUT:
+
+        KdHandleUserInputInDebuggee(Message);
+
+        break;
+
+    case OPERATION_DEBUGGEE_REGISTER_EVENT:
+
+        KdRegisterEventInDebuggee(
+            (PDEBUGGER_GENERAL_EVENT_DETAIL)(Message),
+            ReturnedLength);
+
+        break;
+
+    case OPERATION_DEBUGGEE_ADD_ACTION_TO_EVENT:
+
+        KdAddActionToEventInDebuggee(
+            (PDEBUGGER_GENERAL_ACTION)(Message),
+            ReturnedLength);
+
+        break;
+
+    case OPERATION_DEBUGGEE_CLEAR_EVENTS:
+
+        KdSendModifyEventInDebuggee(
+            (PDEBUGGER_MODIFY_EVENTS)(Message));
+
+        break;
+
+    case OPERATION_HYPERVISOR_DRIVER_IS_SUCCESSFULLY_LOADED:
+
+        //
+        // Indicate that driver (Hypervisor) is loaded successfully
+        //
+        SetEvent(g_IsDriverLoadedSuccessfully);
+
+        break;
+
+    case OPERATION_HYPERVISOR_DRIVER_END_OF_IRPS:
+
+        //
+        // End of receiving messages (IRPs), nothing to do
+        //
+        break;
+
+    case OPERATION_COMMAND_FROM_DEBUGGER_RELOAD_SYMBOL:
+
+        //
+        // Pause debugger after getting the results
+        //
+        KdReloadSymbolsInDebuggee(TRUE);
+
+        break;
+
+    default:
+
+        if (g_BreakPrintingOutput)
+        {
+            //
+            // means that the user asserts a CTRL+C or CTRL+BREAK Signal
+            // we shouldn't show or save anything in this case
+            //
+            return;
+        }
+
+        //
+        // Set output source to not found
+        //
+        OutputSourceFound = FALSE;
+
+        //
+        // Check if there are available output sources
+        //
+        if (g_OutputSourcesInitialized)
+        {
+            //
+            // Now, we should check whether the following flag matches
+            // with an output or not, also this is not where we want to
+            // check output resources
+            //
+            TempList = &g_EventTrace;
+            while (&g_EventTrace != TempList->Blink)
+            {
+                TempList = TempList->Blink;
+
+                PDEBUGGER_GENERAL_EVENT_DETAIL EventDetail = CONTAINING_RECORD(
+                    TempList,
+                    DEBUGGER_GENERAL_EVENT_DETAIL,
+                    CommandsEventList);
+
+                if (EventDetail->HasCustomOutput)
+                {
+                    //
+                    // Output source found
+                    //
+                    OutputSourceFound = TRUE;
+
+                    //
+                    // Send the event to output sources
+                    //
+                    if (!ForwardingPerformEventForwarding(
+                            EventDetail,
+                            Message,
+                            ReturnedLength - sizeof(UINT32) + 1))
+                    {
+                        ShowMessages("err, there was an error transferring the "
+                                     "message to the remote sources\n");
+                    }
+
+                    break;
+                }
+            }
+        }
+
+        //
+        // Show the message if the source not found
+        //
+        if (!OutputSourceFound)
+        {
+            ShowMessages("%s", Message);
+        }
+
+        break;
+    }
+}
+
+#if UseSharedMemoryForMessageTracking
+
+/**
+ * @brief Handle a message of the mapped kernel buffers
+ *
+ * @param Context Buffer for the messages that shouldn't be handled in place
+ * @param Record The header of the message
+ * @return VOID
+ */
+VOID
+ReadSharedMemoryBufferHandleMessage(PVOID Context, BUFFER_HEADER * Record)
+{
+    CHAR * CopyBuffer = (CHAR *)Context;
+    CHAR * Message    = (CHAR *)Record + sizeof(BUFFER_HEADER);
+
+    if (Record->OpeationNumber & OPERATION_MANDATORY_DEBUGGEE_BIT)
+    {
+        //
+        // The buffers are read-only, so the messages that are not logs
+        // are copied before handling them
+        //
+        ZeroMemory(CopyBuffer, UsermodeBufferSize);
+        memcpy(CopyBuffer, Message, Record->BufferLength);
+        Message = CopyBuffer;
+    }
+
+    ReadKernelMessageHandle(Record->OpeationNumber, Message, Record->BufferLength + sizeof(UINT32));
+}
+
+/**
+ * @brief Read the new messages of a pool (vmx-root or vmx non-root)
+ * from the mapped kernel buffers
+ *
+ * @param Header The control page of the kernel buffers
+ * @param ReaderPage The page of the read offsets
+ * @param Buffers The start address of the kernel buffers
+ * @param FirstBuffer Index of the first buffer of the pool
+ * @param CopyBuffer Buffer for the messages that shouldn't be handled in place
+ * @return UINT32 Count of the handled messages
+ */
+UINT32
+ReadSharedMemoryBufferDrainPool(PLOG_SHARED_BUFFERS_HEADER Header,
+                                PLOG_SHARED_READER_PAGE    ReaderPage,
+                                CHAR *                     Buffers,
+                                UINT32                     FirstBuffer,
+                                CHAR *                     CopyBuffer)
+{
+    UINT32         CountOfBuffers = Header->CountOfBuffers / 2;
+    vector<UINT64> OffsetsToSend(CountOfBuffers);
+    vector<UINT64> OffsetsToWrite(CountOfBuffers);
+
+    return LogReadSharedBuffers(Header,
+                                ReaderPage,
+                                Buffers,
+                                FirstBuffer,
+                                CountOfBuffers,
+                                OffsetsToSend.data(),
+                                OffsetsToWrite.data(),
+                                ReadSharedMemoryBufferHandleMessage,
+                                CopyBuffer);
+}
+
+/**
+ * @brief Read kernel buffers by mapping them to the current process
+ * @details The thread waits on a doorbell event and reads all of
+ * the new messages after each wakeup without an IOCTL per message
+ *
+ * @param Handle Driver handle
+ * @param CopyBuffer Buffer for the messages that shouldn't be handled in place
+ * @return BOOLEAN FALSE if the buffers could not be mapped
+ */
+BOOLEAN
+ReadSharedMemoryBuffer(HANDLE Handle, CHAR * CopyBuffer)
+{
+    BOOL                       Status;
+    ULONG                      ReturnedLength;
+    DEBUGGER_MAP_LOG_BUFFERS   MapRequest = {0};
+    PLOG_SHARED_BUFFERS_HEADER Header;
+    PLOG_SHARED_READER_PAGE    ReaderPage;
+    CHAR *                     Buffers;
+    UINT32                     CountOfHandledMessages;
+    HANDLE                     DoorbellEvent;
+
+    DoorbellEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+
+    if (DoorbellEvent == NULL)
+    {
+        return FALSE;
+    }
+
+    MapRequest.hDoorbellEvent = DoorbellEvent;
+
+    Status = DeviceIoControl(
+        Handle,                             // Handle to device
+        IOCTL_MAP_LOG_BUFFERS_TO_USER_MODE, // IO Control code
+        &MapRequest,                        // Input Buffer to driver.
+        SIZEOF_DEBUGGER_MAP_LOG_BUFFERS,    // Input buffer length
+        &MapRequest,                        // Output Buffer from driver.
+        SIZEOF_DEBUGGER_MAP_LOG_BUFFERS,    // Length of output buffer in bytes.
+        &ReturnedLength,                    // Bytes placed in buffer.
+        NULL                                // synchronous call
+    );
+
+    if (!Status || MapRequest.KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFULL)
+    {
+        CloseHandle(DoorbellEvent);
+        return FALSE;
+    }
+
+    Header     = (PLOG_SHARED_BUFFERS_HEADER)MapRequest.HeaderAddress;
+    ReaderPage = (PLOG_SHARED_READER_PAGE)MapRequest.ReaderPageAddress;
+    Buffers    = (CHAR *)MapRequest.BuffersAddress;
+
+    while (!g_IsVmxOffProcessStart)
+    {
+        //
+        // Read vmx non-root messages, then vmx-root messages
+        //
+        CountOfHandledMessages = ReadSharedMemoryBufferDrainPool(Header, ReaderPage, Buffers, 0, CopyBuffer);
+        CountOfHandledMessages += ReadSharedMemoryBufferDrainPool(Header, ReaderPage, Buffers, Header->CountOfBuffers / 2, CopyBuffer);
+
+        if (CountOfHandledMessages != 0)
+        {
+            continue;
+        }
+
+        //
+        // Arm the doorbell and check the buffers again, so the messages
+        // that are written before arming the doorbell are not missed
+        //
+        if (LogArmDoorbell(Header, ReaderPage))
+        {
+            //
+            // Wait for new messages, the timeout is for checking whether
+            // the vmx-off process is started or not
+            //
+            WaitForSingleObject(DoorbellEvent, DefaultSpeedOfReadingKernelMessages * 10);
+        }
+    }
+
+    //
+    // The buffers are unmapped when the handle is closed
+    //
+    CloseHandle(DoorbellEvent);
+
+    return TRUE;
+}
+
+#endif
+
 /**
  * @brief Read kernel buffers using IRP Pending
  *
@@ -113,17 +499,16 @@ ShowMessages(const char * Fmt, ...)
 void
 ReadIrpBasedBuffer()
 {
-    BOOL                   Status;
-    ULONG                  ReturnedLength;
-    REGISTER_NOTIFY_BUFFER RegisterEvent;
-    UINT32                 OperationCode;
-    DWORD                  ErrorNum;
-    HANDLE                 Handle;
-    BOOLEAN                OutputSourceFound;
-    PLIST_ENTRY            TempList;
+    BOOL                      Status;
+    ULONG                     ReturnedLength;
+    REGISTER_NOTIFY_BUFFER    RegisterEvent;
+    PLOG_BATCH_MESSAGE_HEADER MessageHeader;
+    UINT32                    Offset;
+    DWORD                     ErrorNum;
+    HANDLE                    Handle;
 
     RegisterEvent.hEvent = NULL;
-    RegisterEvent.Type   = IRP_BASED;
+    RegisterEvent.Type   = IRP_BASED_BATCHED;
 
     //
     // Create another handle to be used in for reading kernel messages,
@@ -168,7 +553,29 @@ ReadIrpBasedBuffer()
     //
     // allocate buffer for transfering messages
     //
-    char * OutputBuffer = (char *)malloc(UsermodeBufferSize);
+    char * OutputBuffer = (char *)malloc(UsermodeBatchBufferSize);
+
+#if UseSharedMemoryForMessageTracking
+
+    //
+    // Read the buffers directly if they could be mapped to this process,
+    // otherwise read the messages by IRPs
+    //
+    if (ReadSharedMemoryBuffer(Handle, OutputBuffer))
+    {
+        free(OutputBuffer);
+
+        //
+        // closeHandle
+        //
+        if (!CloseHandle(Handle))
+        {
+            ShowMessages("err, closing handle 0x%x\n", GetLastError());
+        };
+
+        return;
+    }
+#endif
 
     try
     {
@@ -177,12 +584,9 @@ ReadIrpBasedBuffer()
             if (!g_IsVmxOffProcessStart)
             {
                 //
-                // Clear the buffer
+                // The IRP is pending until there is a new message, so there
+                // is no need to wait before sending it
                 //
-                ZeroMemory(OutputBuffer, UsermodeBufferSize);
-
-                Sleep(DefaultSpeedOfReadingKernelMessages); // we're not trying to eat all of the CPU ;)
-
                 Status = DeviceIoControl(
                     Handle,               // Handle to device
                     IOCTL_REGISTER_EVENT, // IO Control code
@@ -190,10 +594,10 @@ ReadIrpBasedBuffer()
                     SIZEOF_REGISTER_EVENT *
                         2,              // Length of input buffer in bytes. (x 2 is bcuz as the
                                         // driver is x64 and has 64 bit values)
-                    OutputBuffer,       // Output Buffer from driver.
-                    UsermodeBufferSize, // Length of output buffer in bytes.
-                    &ReturnedLength,    // Bytes placed in buffer.
-                    NULL                // synchronous call
+                    OutputBuffer,            // Output Buffer from driver.
+                    UsermodeBatchBufferSize, // Length of output buffer in bytes.
+                    &ReturnedLength,         // Bytes placed in buffer.
+                    NULL                     // synchronous call
                 );
 
                 if (!Status)
@@ -205,209 +609,51 @@ ReadIrpBasedBuffer()
 
                     //
                     // if we reach here, the packet is probably failed, it might
-                    // be because of using flush command
+                    // be because of using flush command, we wait before retrying
                     //
+                    Sleep(DefaultSpeedOfReadingKernelMessages); // we're not trying to eat all of the CPU ;)
                     continue;
                 }
 
-                //
-                // Compute the received buffer's operation code
-                //
-                OperationCode = 0;
-                memcpy(&OperationCode, OutputBuffer, sizeof(UINT32));
-
-                /*
-        ShowMessages("Returned Length : 0x%x \n", ReturnedLength);
-        ShowMessages("Operation Code : 0x%x \n", OperationCode);
-                */
-
-                switch (OperationCode)
+                if (ReturnedLength == 0)
                 {
-                case OPERATION_LOG_NON_IMMEDIATE_MESSAGE:
-
-                    if (g_BreakPrintingOutput)
-                    {
-                        //
-                        // means that the user asserts a CTRL+C or CTRL+BREAK Signal
-                        // we shouldn't show or save anything in this case
-                        //
-                        continue;
-                    }
-
-                    ShowMessages("%s", OutputBuffer + sizeof(UINT32));
-
-                    break;
-                case OPERATION_LOG_INFO_MESSAGE:
-
-                    if (g_BreakPrintingOutput)
-                    {
-                        //
-                        // means that the user asserts a CTRL+C or CTRL+BREAK Signal
-                        // we shouldn't show or save anything in this case
-                        //
-                        continue;
-                    }
-
-                    ShowMessages("%s", OutputBuffer + sizeof(UINT32));
-
-                    break;
-                case OPERATION_LOG_ERROR_MESSAGE:
-                    if (g_BreakPrintingOutput)
-                    {
-                        //
-                        // means that the user asserts a CTRL+C or CTRL+BREAK Signal
-                        // we shouldn't show or save anything in this case
-                        //
-                        continue;
-                    }
-
-                    ShowMessages("%s", OutputBuffer + sizeof(UINT32));
-
-                    break;
-                case OPERATION_LOG_WARNING_MESSAGE:
-
-                    if (g_BreakPrintingOutput)
-                    {
-                        //
-                        // means that the user asserts a CTRL+C or CTRL+BREAK Signal
-                        // we shouldn't show or save anything in this case
-                        //
-                        continue;
-                    }
-
-                    ShowMessages("%s", OutputBuffer + sizeof(UINT32));
-
-                    break;
-
-                case OPERATION_COMMAND_FROM_DEBUGGER_CLOSE_AND_UNLOAD_VMM:
-
-                    KdCloseConnection();
-
-                    break;
-
-                case OPERATION_DEBUGGEE_USER_INPUT:
-
-                    KdHandleUserInputInDebuggee(OutputBuffer + sizeof(UINT32));
-
-                    break;
-
-                case OPERATION_DEBUGGEE_REGISTER_EVENT:
-
-                    KdRegisterEventInDebuggee(
-                        (PDEBUGGER_GENERAL_EVENT_DETAIL)(OutputBuffer + sizeof(UINT32)),
-                        ReturnedLength);
-
-                    break;
-
-                case OPERATION_DEBUGGEE_ADD_ACTION_TO_EVENT:
-
-                    KdAddActionToEventInDebuggee(
-                        (PDEBUGGER_GENERAL_ACTION)(OutputBuffer + sizeof(UINT32)),
-                        ReturnedLength);
-
-                    break;
-
-                case OPERATION_DEBUGGEE_CLEAR_EVENTS:
-
-                    KdSendModifyEventInDebuggee(
-                        (PDEBUGGER_MODIFY_EVENTS)(OutputBuffer + sizeof(UINT32)));
-
-                    break;
-
-                case OPERATION_HYPERVISOR_DRIVER_IS_SUCCESSFULLY_LOADED:
-
-                    //
-                    // Indicate that driver (Hypervisor) is loaded successfully
-                    //
-                    SetEvent(g_IsDriverLoadedSuccessfully);
-
-                    break;
-
-                case OPERATION_HYPERVISOR_DRIVER_END_OF_IRPS:
-
                     //
-                    // End of receiving messages (IRPs), nothing to do
+                    // Another thread has a pending IRP, so the IRP is completed
+                    // without any message
                     //
-                    break;
-
-                case OPERATION_COMMAND_FROM_DEBUGGER_RELOAD_SYMBOL:
-
-                    //
-                    // Pause debugger after getting the results
-                    //
-                    KdReloadSymbolsInDebuggee(TRUE);
-
-                    break;
+                    Sleep(DefaultSpeedOfReadingKernelMessages); // we're not trying to eat all of the CPU ;)
+                    continue;
+                }
 
-                default:
+                //
+                // The buffer contains a batch of messages, each message has a header
+                // and is null-terminated
+                //
+                for (Offset = 0; Offset + sizeof(LOG_BATCH_MESSAGE_HEADER) <= ReturnedLength;)
+                {
+                    MessageHeader = (PLOG_BATCH_MESSAGE_HEADER)(OutputBuffer + Offset);
 
-                    if (g_BreakPrintingOutput)
+                    if (Offset + LOG_BATCH_MESSAGE_SIZE(MessageHeader->BufferLength) > ReturnedLength)
                     {
                         //
-                        // means that the user asserts a CTRL+C or CTRL+BREAK Signal
-                        // we shouldn't show or save anything in this case
+                        // Not a complete message
                         //
-                        continue;
+                        break;
                     }
 
-                    //
-                    // Set output source to not found
-                    //
-                    OutputSourceFound = FALSE;
+                    /*
+        ShowMessages("Returned Length : 0x%x \n", MessageHeader->BufferLength);
+        ShowMessages("Operation Code : 0x%x \n", MessageHeader->OperationCode);
+                    */
 
                     //
-                    // Check if there are available output sources
+                    // Handle the message
                     //
-                    if (g_OutputSourcesInitialized)
-                    {
-                        //
-                        // Now, we should check whether the following flag matches
-                        // with an output or not, also this is not where we want to
-                        // check output resources
-                        //
-                        TempList = &g_EventTrace;
-                        while (&g_EventTrace != TempList->Blink)
-                        {
-                            TempList = TempList->Blink;
-
-                            PDEBUGGER_GENERAL_EVENT_DETAIL EventDetail = CONTAINING_RECORD(
-                                TempList,
-                                DEBUGGER_GENERAL_EVENT_DETAIL,
-                                CommandsEventList);
-
-                            if (EventDetail->HasCustomOutput)
-                            {
-                                //
-                                // Output source found
-                                //
-                                OutputSourceFound = TRUE;
-
-                                //
-                                // Send the event to output sources
-                                //
-                                if (!ForwardingPerformEventForwarding(
-                                        EventDetail,
-                                        OutputBuffer + sizeof(UINT32),
-                                        ReturnedLength - sizeof(UINT32) + 1))
-                                {
-                                    ShowMessages("err, there was an error transferring the "
-                                                 "message to the remote sources\n");
-                                }
-
-                                break;
-                            }
-                        }
-                    }
-
-                    //
-                    // Show the message if the source not found
-                    //
-                    if (!OutputSourceFound)
-                    {
-                        ShowMessages("%s", OutputBuffer + sizeof(UINT32));
-                    }
+                    ReadKernelMessageHandle(MessageHeader->OperationCode,
+                                            OutputBuffer + Offset + sizeof(LOG_BATCH_MESSAGE_HEADER),
+                                            MessageHeader->BufferLength + sizeof(UINT32));
 
-                    break;
+                    Offset += LOG_BATCH_MESSAGE_SIZE(MessageHeader->BufferLength);
                 }
             }
             else
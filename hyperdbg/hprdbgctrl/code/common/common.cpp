@@ -563,3 +563,31 @@ GetConfigFilePath(PWCHAR ConfigPath)
     //
     PathCombineW(ConfigPath, CurrentPath, CONFIG_FILE_NAME);
 }
+
+/**
+ * @brief Compute the FNV-1a (64-bit) hash of a buffer
+ *
+ * @param Buffer
+ * @param Length
+ * @param Hash The hash of the previous buffers (or zero for the first buffer)
+ *
+ * @return UINT64
+ */
+UINT64
+HashBuffer(const VOID * Buffer, UINT32 Length, UINT64 Hash)
+{
+    const BYTE * Bytes = (const BYTE *)Buffer;
+
+    if (Hash == 0)
+    {
+        Hash = 0xcbf29ce484222325;
+    }
+
+    for (UINT32 i = 0; i < Length; i++)
+    {
+        Hash ^= Bytes[i];
+        Hash *= 0x100000001b3;
+    }
+
+    return Hash;
+}
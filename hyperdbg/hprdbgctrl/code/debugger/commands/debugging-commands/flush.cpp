@@ -95,6 +95,12 @@ CommandFlushRequestFlush()
                 "flushing buffers was successful, total %d messages were cleared.\n",
                 FlushRequest.CountOfMessagesThatSetAsReadFromVmxNonRoot +
                     FlushRequest.CountOfMessagesThatSetAsReadFromVmxRoot);
+
+            if (FlushRequest.CountOfDroppedMessages != 0)
+            {
+                ShowMessages("warning, total %llu messages were dropped because the buffers were full\n",
+                             FlushRequest.CountOfDroppedMessages);
+            }
         }
         else
         {
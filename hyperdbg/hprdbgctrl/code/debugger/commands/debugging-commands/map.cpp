@@ -0,0 +1,443 @@
+/**
+ * @file map.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief map command
+ * @details
+ * @version 0.1
+ * @date 2021-11-14
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hprdbgctrl\pch.h"
+
+//
+// Global Variables
+//
+extern BOOLEAN                         g_IsSerialConnectedToRemoteDebuggee;
+extern PSCRIPT_ENGINE_AGGREGATION_MAPS g_ScriptAggregationMaps;
+
+/**
+ * @brief Thread that shows the maps periodically
+ *
+ */
+HANDLE g_MapIntervalThread = NULL;
+
+/**
+ * @brief Event that stops the thread of showing the maps periodically
+ *
+ */
+HANDLE g_MapIntervalStopEvent = NULL;
+
+/**
+ * @brief Time between showing the maps (milliseconds)
+ *
+ */
+UINT32 g_MapIntervalTime = 0;
+
+/**
+ * @brief help of map command
+ *
+ * @return VOID
+ */
+VOID
+CommandMapHelp()
+{
+    ShowMessages("map : shows the aggregation maps of scripts (map_count, map_sum, "
+                 "map_min, map_max and map_hist) merged from all of the cores.\n");
+    ShowMessages("in debugger mode, the maps of the halted debuggee are shown, "
+                 "'map interval' is only available in vmi-mode.\n\n");
+    ShowMessages("syntax : \tmap\n");
+    ShowMessages("syntax : \tmap clear\n");
+    ShowMessages("syntax : \tmap interval [time - milliseconds (hex value)]\n");
+    ShowMessages("syntax : \tmap interval off\n");
+
+    ShowMessages("\t\te.g : map\n");
+    ShowMessages("\t\te.g : map clear\n");
+    ShowMessages("\t\te.g : map interval 3e8\n");
+    ShowMessages("\t\te.g : map interval off\n");
+}
+
+/**
+ * @brief Get the name of the type of an aggregation map
+ *
+ * @param Type
+ * @return const char *
+ */
+const char *
+CommandMapGetTypeName(UINT32 Type)
+{
+    switch (Type)
+    {
+    case SCRIPT_ENGINE_AGGREGATION_TYPE_COUNT:
+        return "count";
+    case SCRIPT_ENGINE_AGGREGATION_TYPE_SUM:
+        return "sum";
+    case SCRIPT_ENGINE_AGGREGATION_TYPE_MIN:
+        return "min";
+    case SCRIPT_ENGINE_AGGREGATION_TYPE_MAX:
+        return "max";
+    case SCRIPT_ENGINE_AGGREGATION_TYPE_HIST:
+        return "hist";
+    default:
+        return "unknown";
+    }
+}
+
+/**
+ * @brief Show a histogram map, each key is the bucket of the power
+ * of two of the values
+ *
+ * @param Entries Used entries of the map
+ * @return VOID
+ */
+VOID
+CommandMapShowHistogram(vector<SCRIPT_ENGINE_AGGREGATION_ENTRY> & Entries)
+{
+    UINT64 MaximumCount = 0;
+    char   Range[64]    = {0};
+    string Bar;
+
+    //
+    // Buckets are shown by their ranges
+    //
+    std::sort(Entries.begin(), Entries.end(), [](const SCRIPT_ENGINE_AGGREGATION_ENTRY & a, const SCRIPT_ENGINE_AGGREGATION_ENTRY & b) {
+        return a.Key < b.Key;
+    });
+
+    for (auto & Entry : Entries)
+    {
+        if (Entry.Value > MaximumCount)
+        {
+            MaximumCount = Entry.Value;
+        }
+    }
+
+    for (auto & Entry : Entries)
+    {
+        if (Entry.Key == 0)
+        {
+            sprintf_s(Range, sizeof(Range), "[0]");
+        }
+        else if (Entry.Key == 64)
+        {
+            sprintf_s(Range, sizeof(Range), "[%llx, ...)", 1ull << 63);
+        }
+        else
+        {
+            sprintf_s(Range, sizeof(Range), "[%llx, %llx)", 1ull << (Entry.Key - 1), 1ull << Entry.Key);
+        }
+
+        //
+        // Bars are scaled to the bucket with the maximum count
+        //
+        Bar.assign((size_t)((Entry.Value * 50) / MaximumCount), '@');
+
+        ShowMessages("%-40s %8lld |%-50s|\n", Range, Entry.Value, Bar.c_str());
+    }
+}
+
+/**
+ * @brief Show the aggregation maps
+ *
+ * @param Maps
+ * @return VOID
+ */
+VOID
+CommandMapShow(PSCRIPT_ENGINE_AGGREGATION_MAPS Maps)
+{
+    BOOLEAN IsAnyMapUsed = FALSE;
+
+    for (UINT32 i = 0; i < SCRIPT_ENGINE_AGGREGATION_MAXIMUM_MAPS; i++)
+    {
+        PSCRIPT_ENGINE_AGGREGATION_MAP          Map = &Maps->Maps[i];
+        vector<SCRIPT_ENGINE_AGGREGATION_ENTRY> Entries;
+
+        if (Map->Type == SCRIPT_ENGINE_AGGREGATION_TYPE_UNUSED)
+        {
+            continue;
+        }
+
+        IsAnyMapUsed = TRUE;
+
+        for (UINT32 j = 0; j < SCRIPT_ENGINE_AGGREGATION_MAP_ENTRIES; j++)
+        {
+            if (Map->Entries[j].IsUsed)
+            {
+                Entries.push_back(Map->Entries[j]);
+            }
+        }
+
+        ShowMessages("map %x (%s), %d keys:\n", i, CommandMapGetTypeName(Map->Type), Map->CountOfEntries);
+
+        if (Map->Type == SCRIPT_ENGINE_AGGREGATION_TYPE_HIST)
+        {
+            CommandMapShowHistogram(Entries);
+        }
+        else
+        {
+            //
+            // Keys with the largest values are shown at the end (near
+            // to the prompt) like bpftrace
+            //
+            std::sort(Entries.begin(), Entries.end(), [](const SCRIPT_ENGINE_AGGREGATION_ENTRY & a, const SCRIPT_ENGINE_AGGREGATION_ENTRY & b) {
+                return (INT64)a.Value < (INT64)b.Value;
+            });
+
+            for (auto & Entry : Entries)
+            {
+                ShowMessages("[%016llx]: %llx\n", Entry.Key, Entry.Value);
+            }
+        }
+
+        if (Map->CountOfDroppedUpdates != 0)
+        {
+            ShowMessages("warning, %d updates of new keys were dropped as map %x was full\n",
+                         Map->CountOfDroppedUpdates,
+                         i);
+        }
+
+        ShowMessages("\n");
+    }
+
+    if (!IsAnyMapUsed)
+    {
+        ShowMessages("no aggregation map is used\n");
+    }
+}
+
+/**
+ * @brief Query (and clear) the aggregation maps and show them
+ *
+ * @param ClearMaps Whether the maps should be cleared after reading them
+ * @return BOOLEAN
+ */
+BOOLEAN
+CommandMapQueryAndShow(BOOLEAN ClearMaps)
+{
+    BOOL                             Status;
+    ULONG                            ReturnedLength;
+    PDEBUGGER_QUERY_AGGREGATION_MAPS QueryRequest;
+    PSCRIPT_ENGINE_AGGREGATION_MAPS  DebuggeeMaps;
+
+    if (g_IsSerialConnectedToRemoteDebuggee)
+    {
+        //
+        // The halted debuggee merges the maps of its cores and sends them
+        // in multiple packets
+        //
+        DebuggeeMaps = (PSCRIPT_ENGINE_AGGREGATION_MAPS)malloc(sizeof(SCRIPT_ENGINE_AGGREGATION_MAPS));
+
+        if (DebuggeeMaps == NULL)
+        {
+            ShowMessages("err, unable to allocate memory for the maps\n");
+            return FALSE;
+        }
+
+        if (KdSendQueryAggregationMapsPacketToDebuggee(ClearMaps, DebuggeeMaps))
+        {
+            CommandMapShow(DebuggeeMaps);
+        }
+
+        free(DebuggeeMaps);
+
+        return TRUE;
+    }
+
+    if (!g_DeviceHandle)
+    {
+        //
+        // The driver is not loaded, maps of the scripts that are evaluated
+        // in user-mode ('?' command) are shown
+        //
+        if (g_ScriptAggregationMaps == NULL)
+        {
+            ShowMessages("no aggregation map is used\n");
+            return TRUE;
+        }
+
+        CommandMapShow(g_ScriptAggregationMaps);
+
+        if (ClearMaps)
+        {
+            RtlZeroMemory(g_ScriptAggregationMaps, sizeof(SCRIPT_ENGINE_AGGREGATION_MAPS));
+        }
+
+        return TRUE;
+    }
+
+    //
+    // The merged maps are large, so it's not allocated on the stack
+    //
+    QueryRequest = (PDEBUGGER_QUERY_AGGREGATION_MAPS)malloc(SIZEOF_DEBUGGER_QUERY_AGGREGATION_MAPS);
+
+    if (QueryRequest == NULL)
+    {
+        ShowMessages("err, unable to allocate memory for the maps\n");
+        return FALSE;
+    }
+
+    RtlZeroMemory(QueryRequest, SIZEOF_DEBUGGER_QUERY_AGGREGATION_MAPS);
+
+    QueryRequest->ClearMaps = ClearMaps;
+
+    Status = DeviceIoControl(
+        g_DeviceHandle,                         // Handle to device
+        IOCTL_QUERY_AGGREGATION_MAPS,           // IO Control code
+        QueryRequest,                           // Input Buffer to driver.
+        SIZEOF_DEBUGGER_QUERY_AGGREGATION_MAPS, // Input buffer length
+        QueryRequest,                           // Output Buffer from driver.
+        SIZEOF_DEBUGGER_QUERY_AGGREGATION_MAPS, // Length of output buffer in
+                                                // bytes.
+        &ReturnedLength,                        // Bytes placed in buffer.
+        NULL                                    // synchronous call
+    );
+
+    if (!Status)
+    {
+        ShowMessages("ioctl failed with code 0x%x\n", GetLastError());
+        free(QueryRequest);
+        return FALSE;
+    }
+
+    if (QueryRequest->KernelStatus == DEBUGGER_OPERATION_WAS_SUCCESSFULL)
+    {
+        CommandMapShow(&QueryRequest->Maps);
+    }
+    else
+    {
+        ShowMessages("querying aggregation maps was not successful :(\n");
+    }
+
+    free(QueryRequest);
+
+    return TRUE;
+}
+
+/**
+ * @brief Thread of showing the maps periodically
+ *
+ * @param Data
+ * @return DWORD
+ */
+DWORD WINAPI
+CommandMapIntervalThread(LPVOID Data)
+{
+    //
+    // Maps are shown until the stop event is signaled
+    //
+    while (WaitForSingleObject(g_MapIntervalStopEvent, g_MapIntervalTime) == WAIT_TIMEOUT)
+    {
+        if (!CommandMapQueryAndShow(FALSE))
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Stop showing the maps periodically
+ *
+ * @return VOID
+ */
+VOID
+CommandMapStopInterval()
+{
+    if (g_MapIntervalThread == NULL)
+    {
+        return;
+    }
+
+    SetEvent(g_MapIntervalStopEvent);
+    WaitForSingleObject(g_MapIntervalThread, INFINITE);
+
+    CloseHandle(g_MapIntervalThread);
+    CloseHandle(g_MapIntervalStopEvent);
+
+    g_MapIntervalThread    = NULL;
+    g_MapIntervalStopEvent = NULL;
+}
+
+/**
+ * @brief map command handler
+ *
+ * @param SplittedCommand
+ * @param Command
+ * @return VOID
+ */
+VOID
+CommandMap(vector<string> SplittedCommand, string Command)
+{
+    UINT32 IntervalTime = 0;
+
+    if (SplittedCommand.size() > 3)
+    {
+        ShowMessages("incorrect use of 'map'\n\n");
+        CommandMapHelp();
+        return;
+    }
+
+    if (SplittedCommand.size() == 1)
+    {
+        CommandMapQueryAndShow(FALSE);
+    }
+    else if (SplittedCommand.size() == 2 && !SplittedCommand.at(1).compare("clear"))
+    {
+        CommandMapQueryAndShow(TRUE);
+    }
+    else if (SplittedCommand.size() == 3 && !SplittedCommand.at(1).compare("interval"))
+    {
+        if (g_IsSerialConnectedToRemoteDebuggee)
+        {
+            //
+            // In debugger mode, the debuggee is halted while the debugger
+            // runs commands, so the maps are not changed between intervals
+            //
+            ShowMessages("err, the 'map interval' command is only available in vmi-mode\n");
+            return;
+        }
+
+        //
+        // Previous interval (if any) is stopped
+        //
+        CommandMapStopInterval();
+
+        if (!SplittedCommand.at(2).compare("off"))
+        {
+            return;
+        }
+
+        if (!ConvertStringToUInt32(SplittedCommand.at(2), &IntervalTime) || IntervalTime == 0)
+        {
+            ShowMessages("please specify a correct hex value for time (milliseconds)\n\n");
+            CommandMapHelp();
+            return;
+        }
+
+        g_MapIntervalTime      = IntervalTime;
+        g_MapIntervalStopEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+
+        if (g_MapIntervalStopEvent == NULL)
+        {
+            ShowMessages("err, unable to create event (%x)\n", GetLastError());
+            return;
+        }
+
+        g_MapIntervalThread = CreateThread(NULL, 0, CommandMapIntervalThread, NULL, 0, NULL);
+
+        if (g_MapIntervalThread == NULL)
+        {
+            ShowMessages("err, unable to create thread (%x)\n", GetLastError());
+            CloseHandle(g_MapIntervalStopEvent);
+            g_MapIntervalStopEvent = NULL;
+            return;
+        }
+    }
+    else
+    {
+        ShowMessages("incorrect use of 'map'\n\n");
+        CommandMapHelp();
+    }
+}
@@ -21,8 +21,67 @@ CommandPreallocHelp()
 {
     ShowMessages("prealloc : Pre-allocates buffer for special purposes.\n\n");
     ShowMessages("syntax : \tprealloc [Type (monitor)] [Count (hex value)]\n");
+    ShowMessages("syntax : \tprealloc stats\n");
 
     ShowMessages("\t\te.g : prealloc monitor 10\n");
+    ShowMessages("\t\te.g : prealloc stats\n");
+}
+
+/**
+ * @brief show the counters of the pool manager
+ *
+ * @return VOID
+ */
+VOID
+CommandPreallocShowStatistics()
+{
+    BOOL                                   Status;
+    ULONG                                  ReturnedLength;
+    DEBUGGER_QUERY_POOL_MANAGER_STATISTICS StatisticsRequest = {0};
+
+    if (!g_DeviceHandle)
+    {
+        ShowMessages("handle of the driver not found, probably the driver is not loaded. Did you "
+                     "use 'load' command?\n");
+        return;
+    }
+
+    //
+    // Send IOCTL
+    //
+    Status = DeviceIoControl(
+        g_DeviceHandle,                                // Handle to device
+        IOCTL_QUERY_POOL_MANAGER_STATISTICS,           // IO Control code
+        &StatisticsRequest,                            // Input Buffer to driver.
+        SIZEOF_DEBUGGER_QUERY_POOL_MANAGER_STATISTICS, // Input buffer length
+        &StatisticsRequest,                            // Output Buffer from driver.
+        SIZEOF_DEBUGGER_QUERY_POOL_MANAGER_STATISTICS, // Length of output
+                                                       // buffer in bytes.
+        &ReturnedLength,                               // Bytes placed in buffer.
+        NULL                                           // synchronous call
+    );
+
+    if (!Status)
+    {
+        ShowMessages("ioctl failed with code 0x%x\n", GetLastError());
+        return;
+    }
+
+    if (StatisticsRequest.KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFULL)
+    {
+        //
+        // An err occurred, no results
+        //
+        ShowErrorMessage(StatisticsRequest.KernelStatus);
+        return;
+    }
+
+    ShowMessages("cache hits     : %llx\n", StatisticsRequest.Statistics.CacheHits);
+    ShowMessages("cache misses   : %llx\n", StatisticsRequest.Statistics.CacheMisses);
+    ShowMessages("refills        : %llx\n", StatisticsRequest.Statistics.Refills);
+    ShowMessages("refill cycles  : %llx\n", StatisticsRequest.Statistics.RefillCycles);
+    ShowMessages("steals         : %llx\n", StatisticsRequest.Statistics.Steals);
+    ShowMessages("failures       : %llx\n", StatisticsRequest.Statistics.Failures);
 }
 
 /**
@@ -40,6 +99,12 @@ CommandPrealloc(vector<string> SplittedCommand, string Command)
     UINT64                    Count;
     DEBUGGER_PREALLOC_COMMAND PreallocRequest = {0};
 
+    if (SplittedCommand.size() == 2 && !SplittedCommand.at(1).compare("stats"))
+    {
+        CommandPreallocShowStatistics();
+        return;
+    }
+
     if (SplittedCommand.size() != 3)
     {
         ShowMessages("incorrect use of 'prealloc'\n\n");
@@ -17,9 +17,13 @@
 extern BOOLEAN g_AutoUnpause;
 extern BOOLEAN g_AutoFlush;
 extern BOOLEAN g_AddressConversion;
+extern BOOLEAN g_SerialCompression;
+extern BOOLEAN g_PageCacheIsEnabled;
 extern BOOLEAN g_IsConnectedToRemoteDebuggee;
 extern UINT32  g_DisassemblerSyntax;
 
+extern KD_PAGE_CACHE g_KdPageCache;
+
 /**
  * @brief help of settings command
  *
@@ -39,6 +43,11 @@ CommandSettingsHelp()
     ShowMessages("\t\te.g : settings addressconversion off\n");
     ShowMessages("\t\te.g : settings autoflush on\n");
     ShowMessages("\t\te.g : settings autoflush off\n");
+    ShowMessages("\t\te.g : settings compression on\n");
+    ShowMessages("\t\te.g : settings compression off\n");
+    ShowMessages("\t\te.g : settings pagecache\n");
+    ShowMessages("\t\te.g : settings pagecache on\n");
+    ShowMessages("\t\te.g : settings pagecache off\n");
     ShowMessages("\t\te.g : settings syntax intel\n");
     ShowMessages("\t\te.g : settings syntax att\n");
     ShowMessages("\t\te.g : settings syntax masm\n");
@@ -296,6 +305,141 @@ CommandSettingsSyntax(vector<string> SplittedCommand)
     }
 }
 
+/**
+ * @brief set the compression of the packets of the debuggee to enabled
+ * and disabled and query the status of this mode
+ *
+ * @param SplittedCommand
+ * @return VOID
+ */
+VOID
+CommandSettingsCompression(vector<string> SplittedCommand)
+{
+    if (SplittedCommand.size() == 2)
+    {
+        //
+        // It's a query
+        //
+        if (g_SerialCompression)
+        {
+            ShowMessages("compression is enabled\n");
+        }
+        else
+        {
+            ShowMessages("compression is disabled\n");
+        }
+    }
+    else if (SplittedCommand.size() == 3)
+    {
+        //
+        // The user tries to set a value as the compression, it's
+        // requested from the debuggee in the next requests
+        //
+        if (!SplittedCommand.at(2).compare("on"))
+        {
+            g_SerialCompression = TRUE;
+            ShowMessages("set compression to enabled\n");
+        }
+        else if (!SplittedCommand.at(2).compare("off"))
+        {
+            g_SerialCompression = FALSE;
+            ShowMessages("set compression to disabled\n");
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("incorrect use of 'settings', please use 'help settings' "
+                         "for more details\n");
+            return;
+        }
+    }
+    else
+    {
+        //
+        // Sth is incorrect
+        //
+        ShowMessages("incorrect use of 'settings', please use 'help settings' "
+                     "for more details\n");
+        return;
+    }
+}
+
+/**
+ * @brief set the page cache (pages that are read from the debuggee)
+ * to enabled and disabled and query the status and the statistics
+ * of this mode
+ *
+ * @param SplittedCommand
+ * @return VOID
+ */
+VOID
+CommandSettingsPageCache(vector<string> SplittedCommand)
+{
+    UINT64 CountOfReads;
+
+    if (SplittedCommand.size() == 2)
+    {
+        //
+        // It's a query
+        //
+        if (g_PageCacheIsEnabled)
+        {
+            ShowMessages("page cache is enabled\n");
+        }
+        else
+        {
+            ShowMessages("page cache is disabled\n");
+        }
+
+        CountOfReads = g_KdPageCache.CountOfHits + g_KdPageCache.CountOfMisses;
+
+        ShowMessages("hits : %lld, misses : %lld (%.2f%% hits), cached pages : %d, invalidations : %lld\n",
+                     g_KdPageCache.CountOfHits,
+                     g_KdPageCache.CountOfMisses,
+                     CountOfReads == 0 ? 0.0 : (g_KdPageCache.CountOfHits * 100.0) / CountOfReads,
+                     KdGetCountOfCachedPages(),
+                     g_KdPageCache.CountOfInvalidations);
+    }
+    else if (SplittedCommand.size() == 3)
+    {
+        //
+        // The user tries to set a value as the page cache, the cached
+        // pages are not used after disabling it
+        //
+        if (!SplittedCommand.at(2).compare("on"))
+        {
+            g_PageCacheIsEnabled = TRUE;
+            ShowMessages("set page cache to enabled\n");
+        }
+        else if (!SplittedCommand.at(2).compare("off"))
+        {
+            g_PageCacheIsEnabled = FALSE;
+            KdInvalidatePageCache();
+            ShowMessages("set page cache to disabled\n");
+        }
+        else
+        {
+            //
+            // Sth is incorrect
+            //
+            ShowMessages("incorrect use of 'settings', please use 'help settings' "
+                         "for more details\n");
+            return;
+        }
+    }
+    else
+    {
+        //
+        // Sth is incorrect
+        //
+        ShowMessages("incorrect use of 'settings', please use 'help settings' "
+                     "for more details\n");
+        return;
+    }
+}
+
 /**
  * @brief settings command handler
  *
@@ -377,6 +521,42 @@ CommandSettings(vector<string> SplittedCommand, string Command)
             CommandSettingsAddressConversion(SplittedCommand);
         }
     }
+    else if (!SplittedCommand.at(1).compare("compression"))
+    {
+        //
+        // If it's a remote debugger then we send it to the remote debugger
+        //
+        if (g_IsConnectedToRemoteDebuggee)
+        {
+            RemoteConnectionSendCommand(Command.c_str(), strlen(Command.c_str()) + 1);
+        }
+        else
+        {
+            //
+            // If it's a connection over serial or a local debugging then
+            // we handle it locally
+            //
+            CommandSettingsCompression(SplittedCommand);
+        }
+    }
+    else if (!SplittedCommand.at(1).compare("pagecache"))
+    {
+        //
+        // If it's a remote debugger then we send it to the remote debugger
+        //
+        if (g_IsConnectedToRemoteDebuggee)
+        {
+            RemoteConnectionSendCommand(Command.c_str(), strlen(Command.c_str()) + 1);
+        }
+        else
+        {
+            //
+            // If it's a connection over serial or a local debugging then
+            // we handle it locally
+            //
+            CommandSettingsPageCache(SplittedCommand);
+        }
+    }
     else
     {
         //
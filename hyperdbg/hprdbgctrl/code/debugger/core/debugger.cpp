@@ -252,6 +252,16 @@ ShowErrorMessage(UINT32 Error)
                      Error);
         break;
 
+    case DEBUGGER_ERROR_COULD_NOT_MAP_LOG_BUFFERS_TO_USER_MODE:
+        ShowMessages("err, could not map the log buffers to user-mode (%x)\n",
+                     Error);
+        break;
+
+    case DEBUGGER_ERROR_SCRIPT_IS_NOT_CACHED:
+        ShowMessages("err, the script is not cached in the debuggee (%x)\n",
+                     Error);
+        break;
+
     default:
         ShowMessages("err, error not found (%x)\n",
                      Error);
@@ -2005,6 +2015,8 @@ InterpretGeneralEventAndActionsFields(
     BOOLEAN                        IsNextCommandBufferSize         = FALSE;
     BOOLEAN                        IsNextCommandImmediateMessaging = FALSE;
     BOOLEAN                        ImmediateMessagePassing         = UseImmediateMessagingByDefaultOnEvents;
+    BOOLEAN                        IsNextCommandDeferredFormatting = FALSE;
+    BOOLEAN                        DeferredFormatting              = FALSE;
     UINT32                         CoreId;
     UINT32                         ProcessId;
     UINT32                         IndexOfValidSourceTags;
@@ -2618,6 +2630,52 @@ InterpretGeneralEventAndActionsFields(
             continue;
         }
 
+        if (IsNextCommandDeferredFormatting)
+        {
+            if (!Section.compare("yes"))
+            {
+                DeferredFormatting = TRUE;
+            }
+            else if (!Section.compare("no"))
+            {
+                DeferredFormatting = FALSE;
+            }
+            else
+            {
+                //
+                // err, not token recognized error
+                //
+                free(BufferOfCommandString);
+                free(TempEvent);
+
+                if (TempActionBreak != NULL)
+                {
+                    free(TempActionBreak);
+                }
+                if (TempActionScript != NULL)
+                {
+                    free(TempActionScript);
+                }
+                if (TempActionCustomCode != NULL)
+                {
+                    free(TempActionCustomCode);
+                }
+
+                ShowMessages("err, deferred formatting token is invalid\n");
+                *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+                return FALSE;
+            }
+
+            IsNextCommandDeferredFormatting = FALSE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
         if (IsNextCommandPid)
         {
             if (!ConvertStringToUInt32(Section, &ProcessId))
@@ -2738,6 +2796,21 @@ InterpretGeneralEventAndActionsFields(
             continue;
         }
 
+        if (!Section.compare("deferred"))
+        {
+            //
+            // the next commnad is deferred formatting indicator
+            //
+            IsNextCommandDeferredFormatting = TRUE;
+
+            //
+            // Add index to remove it from the command
+            //
+            IndexesToRemove.push_back(Index);
+
+            continue;
+        }
+
         if (!Section.compare("buffer"))
         {
             IsNextCommandBufferSize = TRUE;
@@ -2823,6 +2896,29 @@ InterpretGeneralEventAndActionsFields(
         return FALSE;
     }
 
+    if (IsNextCommandDeferredFormatting)
+    {
+        free(BufferOfCommandString);
+        free(TempEvent);
+
+        if (TempActionBreak != NULL)
+        {
+            free(TempActionBreak);
+        }
+        if (TempActionScript != NULL)
+        {
+            free(TempActionScript);
+        }
+        if (TempActionCustomCode != NULL)
+        {
+            free(TempActionCustomCode);
+        }
+
+        ShowMessages("err, please specify a value for 'deferred'\n");
+        *ReasonForErrorInParsing = DEBUGGER_EVENT_PARSING_ERROR_CAUSE_FORMAT_ERROR;
+        return FALSE;
+    }
+
     //
     // It's not possible to break to debugger in vmi-mode
     //
@@ -2897,6 +2993,20 @@ InterpretGeneralEventAndActionsFields(
         TempActionCustomCode->ImmediateMessagePassing = ImmediateMessagePassing;
     }
 
+    //
+    // In deferred formatting, printf sends binary records and the formats
+    // of the script are kept to render the records of this event
+    //
+    if (TempActionScript != NULL && DeferredFormatting)
+    {
+        TempActionScript->DeferredFormatting = TRUE;
+
+        ScriptEngineWrapperRegisterEventRecordFormats(
+            TempEvent->Tag,
+            (PVOID)((UINT64)TempActionScript + sizeof(DEBUGGER_GENERAL_ACTION)),
+            TempActionScript->ScriptBufferPointer);
+    }
+
     //
     // Set the tags into the event list
     //
@@ -480,6 +480,8 @@ InitializeCommandsDictionary()
 
     g_CommandsList["flush"] = {&CommandFlush, &CommandFlushHelp, DEBUGGER_COMMAND_FLUSH_ATTRIBUTES};
 
+    g_CommandsList["map"] = {&CommandMap, &CommandMapHelp, DEBUGGER_COMMAND_MAP_ATTRIBUTES};
+
     g_CommandsList["pause"] = {&CommandPause, &CommandPauseHelp, DEBUGGER_COMMAND_PAUSE_ATTRIBUTES};
 
     g_CommandsList["unload"] = {&CommandUnload, &CommandUnloadHelp, DEBUGGER_COMMAND_UNLOAD_ATTRIBUTES};
@@ -10,6 +10,7 @@
  *
  */
 #include "..\hprdbgctrl\pch.h"
+#include "SerialCompression.h"
 
 //
 // Global Variables
@@ -37,6 +38,21 @@ extern BOOLEAN g_SharedEventStatus;
 extern BOOLEAN g_IsRunningInstruction32Bit;
 extern BYTE    g_EndOfBufferCheckSerial[4];
 extern ULONG   g_CurrentRemoteCore;
+extern UINT32  g_ResultOfRunningScriptInDebuggee;
+extern UINT32  g_SerialFramingVersion;
+extern UINT32  g_Crc32Table[256];
+extern BOOLEAN g_Crc32IsInitialized;
+extern BOOLEAN g_Crc32IsHardwareSupported;
+extern BOOLEAN g_SerialCompression;
+extern BOOLEAN g_PageCacheIsEnabled;
+
+extern std::vector<UINT64>              g_ScriptsCachedInDebuggee;
+extern KD_RECEIVE_BUFFER                g_KdReceiveBuffer;
+extern KD_PENDING_REQUEST               g_KdPendingRequests[SERIAL_MAXIMUM_PIPELINED_REQUESTS];
+extern UINT32                           g_KdSequenceNumber;
+extern KD_PAGE_CACHE                    g_KdPageCache;
+extern PSCRIPT_ENGINE_AGGREGATION_MAPS  g_KdAggregationMapsResult;
+extern DEBUGGEE_AGGREGATION_MAPS_PACKET g_KdAggregationMapsPacket;
 
 /**
  * @brief compares the buffer with a string
@@ -124,6 +140,149 @@ KdComputeDataChecksum(PVOID Buffer, UINT32 Length)
     return CalculatedCheckSum;
 }
 
+/**
+ * @brief Compute the CRC32 (Castagnoli) of a buffer
+ * @details The crc32 instruction (SSE4.2) is used if it's supported,
+ * otherwise a table is used, the CRC32 of the previous buffers is
+ * continued by passing it as Crc32 (zero for the first buffer)
+ *
+ * @param Buffer
+ * @param Length
+ * @param Crc32
+ * @return UINT32
+ */
+UINT32
+KdComputeDataCrc32(PVOID Buffer, UINT32 Length, UINT32 Crc32)
+{
+    BYTE * Data = (BYTE *)Buffer;
+    UINT64 Crc  = (UINT32)~Crc32;
+    int    CpuInfo[4];
+
+    if (!g_Crc32IsInitialized)
+    {
+        for (UINT32 i = 0; i < 256; i++)
+        {
+            UINT32 Entry = i;
+
+            for (UINT32 j = 0; j < 8; j++)
+            {
+                Entry = (Entry >> 1) ^ (Entry & 1 ? 0x82F63B78 : 0);
+            }
+
+            g_Crc32Table[i] = Entry;
+        }
+
+        //
+        // SSE4.2 is bit 20 of ecx
+        //
+        __cpuid(CpuInfo, 1);
+        g_Crc32IsHardwareSupported = (CpuInfo[2] & (1 << 20)) != 0;
+        g_Crc32IsInitialized       = TRUE;
+    }
+
+    if (g_Crc32IsHardwareSupported)
+    {
+        while (Length >= sizeof(UINT64))
+        {
+            Crc = _mm_crc32_u64(Crc, *(UINT64 UNALIGNED *)Data);
+            Data += sizeof(UINT64);
+            Length -= sizeof(UINT64);
+        }
+
+        while (Length--)
+        {
+            Crc = _mm_crc32_u8((UINT32)Crc, *Data++);
+        }
+    }
+    else
+    {
+        while (Length--)
+        {
+            Crc = g_Crc32Table[(Crc ^ *Data++) & 0xff] ^ (Crc >> 8);
+        }
+    }
+
+    return ~(UINT32)Crc;
+}
+
+/**
+ * @brief Check whether the packets are sent to the debuggee in frames
+ * with length and CRC32 or not
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdIsSerialFramed()
+{
+    return g_SerialFramingVersion >= SERIAL_FRAMING_VERSION_LENGTH_AND_CRC32;
+}
+
+/**
+ * @brief Get the sequence number of the next request
+ * @details Previous versions of the debuggee don't compute the checksum
+ * of the bytes before the indicator, so zero is sent to them
+ *
+ * @return UINT32
+ */
+UINT32
+KdGetNextSequenceNumber()
+{
+    UINT32 SequenceNumber;
+
+    if (g_SerialFramingVersion < SERIAL_FRAMING_VERSION_SEQUENCE_NUMBERS)
+    {
+        return 0;
+    }
+
+    //
+    // Zero means that the packet doesn't have a sequence number
+    //
+    do
+    {
+        SequenceNumber = (UINT32)InterlockedIncrement((volatile LONG *)&g_KdSequenceNumber);
+
+    } while (SequenceNumber == 0);
+
+    return SequenceNumber;
+}
+
+/**
+ * @brief Get the flags of the packets that are sent to the debuggee
+ * @details Compressed frames are requested in each request, so the
+ * setting is applied from the next request
+ *
+ * @return BYTE
+ */
+BYTE
+KdGetPacketFlags()
+{
+    if (g_SerialFramingVersion < SERIAL_FRAMING_VERSION_COMPRESSION || !g_SerialCompression)
+    {
+        return 0;
+    }
+
+    return DEBUGGER_REMOTE_PACKET_FLAG_COMPRESSED_FRAMES;
+}
+
+/**
+ * @brief Get the count of requests that are sent to the debuggee
+ * before receiving their responses
+ * @details The responses of previous versions of the debuggee don't
+ * have sequence numbers, so only one request is sent at a time
+ *
+ * @return UINT32
+ */
+UINT32
+KdGetCountOfPipelinedRequests()
+{
+    if (g_SerialFramingVersion < SERIAL_FRAMING_VERSION_SEQUENCE_NUMBERS)
+    {
+        return 1;
+    }
+
+    return SERIAL_MAXIMUM_PIPELINED_REQUESTS;
+}
+
 /**
  * @brief Interpret the packets from debuggee in the case of paused
  *
@@ -159,6 +318,11 @@ KdSendContinuePacketToDebuggee()
     //
     g_CurrentRemoteCore = DEBUGGER_DEBUGGEE_IS_RUNNING_NO_CORE;
 
+    //
+    // The memory is changed while the debuggee is running
+    //
+    KdInvalidatePageCache();
+
     //
     // Send 'g' as continue packet
     //
@@ -196,6 +360,12 @@ KdSendSwitchCorePacketToDebuggee(UINT32 NewCore)
         return FALSE;
     }
 
+    //
+    // Virtual addresses are read from the address space of the process
+    // that runs on the new core
+    //
+    KdInvalidatePageCache();
+
     //
     // Send '~' as switch packet
     //
@@ -241,6 +411,15 @@ KdSendEventQueryAndModifyPacketToDebuggee(
 
     g_SharedEventStatus = FALSE;
 
+    //
+    // Enabling, disabling or clearing events might apply or remove
+    // hooks in the memory
+    //
+    if (TypeOfAction != DEBUGGER_MODIFY_EVENTS_QUERY_STATE)
+    {
+        KdInvalidatePageCache();
+    }
+
     //
     // Fill the structure of packet
     //
@@ -318,6 +497,90 @@ KdSendFlushPacketToDebuggee()
     return TRUE;
 }
 
+/**
+ * @brief Send the query aggregation maps packets to the debuggee
+ * @details The maps don't fit in one packet, so the used entries of
+ * each map are received in multiple parts, the debuggee merges the maps
+ * of its halted cores for each part
+ *
+ * @param ClearMaps Clear the maps of the debuggee after querying them
+ * @param AggregationMaps The merged maps
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendQueryAggregationMapsPacketToDebuggee(BOOLEAN ClearMaps, PSCRIPT_ENGINE_AGGREGATION_MAPS AggregationMaps)
+{
+    DEBUGGEE_AGGREGATION_MAPS_PACKET AggregationMapsPacket = {0};
+
+    RtlZeroMemory(AggregationMaps, sizeof(SCRIPT_ENGINE_AGGREGATION_MAPS));
+
+    //
+    // The received entries are merged to this buffer by the listener
+    //
+    g_KdAggregationMapsResult = AggregationMaps;
+
+    while (TRUE)
+    {
+        //
+        // After the last map, the maps are cleared if it's requested
+        //
+        if (AggregationMapsPacket.MapIndex == SCRIPT_ENGINE_AGGREGATION_MAXIMUM_MAPS)
+        {
+            if (!ClearMaps)
+            {
+                break;
+            }
+
+            AggregationMapsPacket.ClearMaps = TRUE;
+        }
+
+        if (!KdCommandPacketAndBufferToDebuggee(
+                DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
+                DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_QUERY_AGGREGATION_MAPS,
+                (CHAR *)&AggregationMapsPacket,
+                sizeof(DEBUGGEE_AGGREGATION_MAPS_PACKET)))
+        {
+            g_KdAggregationMapsResult = NULL;
+            return FALSE;
+        }
+
+        //
+        // Wait until the result of querying the maps received
+        //
+        g_SyncronizationObjectsHandleTable
+            [DEBUGGER_SYNCRONIZATION_OBJECT_QUERY_AGGREGATION_MAPS]
+                .IsOnWaitingState = TRUE;
+        WaitForSingleObject(g_SyncronizationObjectsHandleTable
+                                [DEBUGGER_SYNCRONIZATION_OBJECT_QUERY_AGGREGATION_MAPS]
+                                    .EventHandle,
+                            INFINITE);
+
+        if (g_KdAggregationMapsPacket.KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFULL ||
+            AggregationMapsPacket.ClearMaps)
+        {
+            break;
+        }
+
+        //
+        // Continue from the next entry of this map or go to the next map
+        //
+        if (g_KdAggregationMapsPacket.NextEntry < SCRIPT_ENGINE_AGGREGATION_MAP_ENTRIES)
+        {
+            AggregationMapsPacket.StartingEntry = g_KdAggregationMapsPacket.NextEntry;
+        }
+        else
+        {
+            AggregationMapsPacket.MapIndex++;
+            AggregationMapsPacket.StartingEntry = 0;
+        }
+    }
+
+    g_KdAggregationMapsResult = NULL;
+
+    return g_KdAggregationMapsPacket.KernelStatus == DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+}
+
 /**
  * @brief Send symbol reload packet to the debuggee
  *
@@ -381,39 +644,375 @@ KdSendReadRegisterPacketToDebuggee(PDEBUGGEE_REGISTER_READ_DESCRIPTION RegDes)
                                 .EventHandle,
                         INFINITE);
 
-    return TRUE;
-}
+    return TRUE;
+}
+
+/**
+ * @brief Invalidate the pages that are read from the debuggee
+ * @details It's called whenever the memory of the debuggee or its
+ * address space might be changed (continue, step, editing memory,
+ * breakpoints, scripts or switching the process or the core)
+ *
+ * @return VOID
+ */
+VOID
+KdInvalidatePageCache()
+{
+    for (UINT32 i = 0; i < KD_PAGE_CACHE_COUNT_OF_PAGES; i++)
+    {
+        g_KdPageCache.Entries[i].IsValid = FALSE;
+    }
+
+    g_KdPageCache.CountOfInvalidations++;
+}
+
+/**
+ * @brief Get the count of the pages that are in the page cache
+ *
+ * @return UINT32
+ */
+UINT32
+KdGetCountOfCachedPages()
+{
+    UINT32 CountOfPages = 0;
+
+    for (UINT32 i = 0; i < KD_PAGE_CACHE_COUNT_OF_PAGES; i++)
+    {
+        if (g_KdPageCache.Entries[i].IsValid)
+        {
+            CountOfPages++;
+        }
+    }
+
+    return CountOfPages;
+}
+
+/**
+ * @brief Get the entry of a page in the page cache
+ * @details The entry is used by the page even if it's not cached
+ *
+ * @param ReadMem The address space of the page
+ * @param Page Address of the start of the page
+ *
+ * @return PKD_PAGE_CACHE_ENTRY
+ */
+PKD_PAGE_CACHE_ENTRY
+KdPageCacheGetEntry(PDEBUGGER_READ_MEMORY ReadMem, UINT64 Page)
+{
+    UINT64 Index;
+
+    Index = (Page / KD_PAGE_CACHE_PAGE_SIZE) ^ ReadMem->Pid ^ ((UINT64)ReadMem->MemoryType << 7);
+
+    return &g_KdPageCache.Entries[Index % KD_PAGE_CACHE_COUNT_OF_PAGES];
+}
+
+/**
+ * @brief Check whether a page is in the page cache or not
+ *
+ * @param ReadMem The address space of the page
+ * @param Page Address of the start of the page
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdPageCacheIsCached(PDEBUGGER_READ_MEMORY ReadMem, UINT64 Page)
+{
+    PKD_PAGE_CACHE_ENTRY Entry = KdPageCacheGetEntry(ReadMem, Page);
+
+    return Entry->IsValid && Entry->Address == Page && Entry->Pid == ReadMem->Pid &&
+           Entry->MemoryType == ReadMem->MemoryType;
+}
+
+/**
+ * @brief Copy the part of the pages that is requested to the
+ * buffer of a read memory request
+ *
+ * @param ReadMem The ReturnLength is increased
+ * @param Buffer Buffer of the request
+ * @param Page Address of the start of the pages
+ * @param PagesBuffer
+ * @param Length Length of the pages
+ *
+ * @return VOID
+ */
+VOID
+KdPageCacheCopyToRequest(PDEBUGGER_READ_MEMORY ReadMem, PVOID Buffer, UINT64 Page, BYTE * PagesBuffer, UINT32 Length)
+{
+    UINT64 Start;
+    UINT64 End;
+
+    if (Length == 0)
+    {
+        return;
+    }
+
+    //
+    // The addresses of the last bytes are compared (instead of the ends)
+    // as the last page might be at the end of the address space
+    //
+    Start = Page > ReadMem->Address ? Page : ReadMem->Address;
+    End   = Page + Length - 1 < ReadMem->Address + ReadMem->Size - 1 ? Page + Length - 1 : ReadMem->Address + ReadMem->Size - 1;
+
+    if (Start > End)
+    {
+        return;
+    }
+
+    memcpy((BYTE *)Buffer + (Start - ReadMem->Address), PagesBuffer + (Start - Page), End - Start + 1);
+
+    ReadMem->ReturnLength += (UINT32)(End - Start + 1);
+}
+
+/**
+ * @brief Send the Read memory packets to the debuggee
+ * @details The pages that are cached are not read again, the rest of
+ * the pages are read in runs of consecutive pages (pipelined requests)
+ * and the pages that are read completely are cached, the pages after the first page that is not read completely
+ * are not read (the same as the chunks)
+ *
+ * @param ReadMem The ReturnLength and KernelStatus are set
+ * @param Buffer Buffer to save the memory (Size of ReadMem)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendReadMemoryPacketToDebuggee(PDEBUGGER_READ_MEMORY ReadMem, PVOID Buffer)
+{
+    DEBUGGER_READ_MEMORY ReadPages;
+    PKD_PAGE_CACHE_ENTRY Entry;
+    BYTE *               PagesBuffer;
+    UINT64               FirstPage;
+    UINT64               Page;
+    UINT64               CountOfPages;
+    UINT64               CountOfMissedPages;
+
+    //
+    // Reads that pass the end of the address space are not cached
+    //
+    if (!g_PageCacheIsEnabled || ReadMem->Size == 0 || ReadMem->Address + ReadMem->Size - 1 < ReadMem->Address)
+    {
+        return KdSendReadMemoryChunksToDebuggee(ReadMem, Buffer);
+    }
+
+    ReadMem->ReturnLength = 0;
+    ReadMem->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+
+    FirstPage    = ReadMem->Address & ~((UINT64)KD_PAGE_CACHE_PAGE_SIZE - 1);
+    CountOfPages = (((ReadMem->Address + ReadMem->Size - 1) & ~((UINT64)KD_PAGE_CACHE_PAGE_SIZE - 1)) - FirstPage) /
+                       KD_PAGE_CACHE_PAGE_SIZE +
+                   1;
+
+    for (UINT64 i = 0; i < CountOfPages;)
+    {
+        Page = FirstPage + i * KD_PAGE_CACHE_PAGE_SIZE;
+
+        if (KdPageCacheIsCached(ReadMem, Page))
+        {
+            g_KdPageCache.CountOfHits++;
+
+            KdPageCacheCopyToRequest(ReadMem, Buffer, Page, KdPageCacheGetEntry(ReadMem, Page)->Buffer, KD_PAGE_CACHE_PAGE_SIZE);
+
+            i++;
+            continue;
+        }
+
+        //
+        // The next pages that are not cached are read at once
+        //
+        CountOfMissedPages = 1;
+
+        while (i + CountOfMissedPages < CountOfPages &&
+               !KdPageCacheIsCached(ReadMem, Page + CountOfMissedPages * KD_PAGE_CACHE_PAGE_SIZE))
+        {
+            CountOfMissedPages++;
+        }
+
+        g_KdPageCache.CountOfMisses += CountOfMissedPages;
+
+        PagesBuffer = (BYTE *)malloc(CountOfMissedPages * KD_PAGE_CACHE_PAGE_SIZE);
+
+        if (PagesBuffer == NULL)
+        {
+            ShowMessages("err, unable to allocate memory for reading the pages\n");
+            return FALSE;
+        }
+
+        ReadPages         = *ReadMem;
+        ReadPages.Address = Page;
+        ReadPages.Size    = (UINT32)(CountOfMissedPages * KD_PAGE_CACHE_PAGE_SIZE);
+
+        if (!KdSendReadMemoryChunksToDebuggee(&ReadPages, PagesBuffer))
+        {
+            free(PagesBuffer);
+            return FALSE;
+        }
+
+        for (UINT32 j = 0; j < ReadPages.ReturnLength / KD_PAGE_CACHE_PAGE_SIZE; j++)
+        {
+            Entry = KdPageCacheGetEntry(ReadMem, Page + j * KD_PAGE_CACHE_PAGE_SIZE);
+
+            Entry->IsValid    = TRUE;
+            Entry->Pid        = ReadMem->Pid;
+            Entry->MemoryType = ReadMem->MemoryType;
+            Entry->Address    = Page + j * KD_PAGE_CACHE_PAGE_SIZE;
+
+            memcpy(Entry->Buffer, PagesBuffer + j * KD_PAGE_CACHE_PAGE_SIZE, KD_PAGE_CACHE_PAGE_SIZE);
+        }
+
+        KdPageCacheCopyToRequest(ReadMem, Buffer, Page, PagesBuffer, ReadPages.ReturnLength);
+
+        free(PagesBuffer);
+
+        if (ReadPages.ReturnLength != ReadPages.Size)
+        {
+            //
+            // The status is only an error if nothing is read
+            //
+            if (ReadMem->ReturnLength == 0)
+            {
+                ReadMem->KernelStatus = ReadPages.KernelStatus;
+            }
+
+            break;
+        }
+
+        i += CountOfMissedPages;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Send the Read memory packets to the debuggee without using
+ * the page cache
+ * @details The memory is read in chunks of SERIAL_READ_MEMORY_CHUNK_SIZE
+ * and the requests of the next chunks are sent before receiving the
+ * responses of the previous chunks, the chunks after the first chunk
+ * that is not read completely are not read
+ *
+ * @param ReadMem The ReturnLength and KernelStatus are set
+ * @param Buffer Buffer to save the memory (Size of ReadMem)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendReadMemoryChunksToDebuggee(PDEBUGGER_READ_MEMORY ReadMem, PVOID Buffer)
+{
+    DEBUGGER_READ_MEMORY  ReadChunk;
+    PDEBUGGER_READ_MEMORY ResultOfChunk;
+    PKD_PENDING_REQUEST   Request;
+    UINT32                CountOfChunks;
+    UINT32                Offset;
+    UINT32                SentChunks      = 0;
+    UINT32                ReceivedChunks  = 0;
+    UINT32                CountOfRequests = KdGetCountOfPipelinedRequests();
+    BOOLEAN               IsTruncated     = FALSE;
+
+    CountOfChunks = (ReadMem->Size + SERIAL_READ_MEMORY_CHUNK_SIZE - 1) / SERIAL_READ_MEMORY_CHUNK_SIZE;
+
+    ReadMem->ReturnLength = 0;
+    ReadMem->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+
+    while (TRUE)
+    {
+        //
+        // Send the requests of the next chunks until the window is full
+        //
+        while (!IsTruncated && SentChunks < CountOfChunks && SentChunks - ReceivedChunks < CountOfRequests)
+        {
+            Offset = SentChunks * SERIAL_READ_MEMORY_CHUNK_SIZE;
+
+            ReadChunk         = *ReadMem;
+            ReadChunk.Address = ReadMem->Address + Offset;
+            ReadChunk.Size    = ReadMem->Size - Offset;
+
+            if (ReadChunk.Size > SERIAL_READ_MEMORY_CHUNK_SIZE)
+            {
+                ReadChunk.Size = SERIAL_READ_MEMORY_CHUNK_SIZE;
+            }
+
+            if (!KdSendPipelinedRequestToDebuggee(&g_KdPendingRequests[SentChunks % SERIAL_MAXIMUM_PIPELINED_REQUESTS],
+                                                  DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_READ_MEMORY,
+                                                  DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_READING_MEMORY,
+                                                  (CHAR *)&ReadChunk,
+                                                  sizeof(DEBUGGER_READ_MEMORY)))
+            {
+                IsTruncated = TRUE;
+                break;
+            }
+
+            SentChunks++;
+        }
+
+        if (ReceivedChunks == SentChunks)
+        {
+            break;
+        }
+
+        //
+        // Wait until the result of the oldest chunk received
+        //
+        Request = &g_KdPendingRequests[ReceivedChunks % SERIAL_MAXIMUM_PIPELINED_REQUESTS];
+        Offset  = ReceivedChunks * SERIAL_READ_MEMORY_CHUNK_SIZE;
+
+        if (!KdWaitForPipelinedRequest(Request))
+        {
+            //
+            // The connection is closed, the remaining requests are not
+            // answered anymore
+            //
+            for (UINT32 i = 0; i < SERIAL_MAXIMUM_PIPELINED_REQUESTS; i++)
+            {
+                g_KdPendingRequests[i].IsPending = FALSE;
+            }
+
+            return FALSE;
+        }
+
+        ReceivedChunks++;
+
+        //
+        // The results of the chunks after a failed chunk are ignored
+        //
+        if (IsTruncated)
+        {
+            continue;
+        }
+
+        ResultOfChunk = (PDEBUGGER_READ_MEMORY)(Request->Buffer + sizeof(DEBUGGER_REMOTE_PACKET));
+
+        if (Request->Length < sizeof(DEBUGGER_REMOTE_PACKET) + sizeof(DEBUGGER_READ_MEMORY) ||
+            ResultOfChunk->ReturnLength > ResultOfChunk->Size ||
+            ResultOfChunk->ReturnLength > Request->Length - sizeof(DEBUGGER_REMOTE_PACKET) - sizeof(DEBUGGER_READ_MEMORY))
+        {
+            ResultOfChunk->KernelStatus = DEBUGGER_ERROR_INVALID_ADDRESS;
+        }
+
+        if (ResultOfChunk->KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFULL)
+        {
+            //
+            // The status is only an error if nothing is read
+            //
+            if (ReceivedChunks == 1)
+            {
+                ReadMem->KernelStatus = ResultOfChunk->KernelStatus;
+            }
+
+            IsTruncated = TRUE;
+            continue;
+        }
 
-/**
- * @brief Send a Read memory packet to the debuggee
- * @param ReadMem
- * 
- * @return BOOLEAN
- */
-BOOLEAN
-KdSendReadMemoryPacketToDebuggee(PDEBUGGER_READ_MEMORY ReadMem)
-{
-    //
-    // Send d command as read memory packet
-    //
-    if (!KdCommandPacketAndBufferToDebuggee(
-            DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
-            DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_READ_MEMORY,
-            (CHAR *)ReadMem,
-            sizeof(DEBUGGER_READ_MEMORY)))
-    {
-        return FALSE;
-    }
+        memcpy((BYTE *)Buffer + Offset,
+               (BYTE *)ResultOfChunk + sizeof(DEBUGGER_READ_MEMORY),
+               ResultOfChunk->ReturnLength);
 
-    //
-    // Wait until the result of read registers received
-    //
-    g_SyncronizationObjectsHandleTable[DEBUGGER_SYNCRONIZATION_OBJECT_READ_MEMORY]
-        .IsOnWaitingState = TRUE;
-    WaitForSingleObject(g_SyncronizationObjectsHandleTable
-                            [DEBUGGER_SYNCRONIZATION_OBJECT_READ_MEMORY]
-                                .EventHandle,
-                        INFINITE);
+        ReadMem->ReturnLength += ResultOfChunk->ReturnLength;
+
+        if (ResultOfChunk->ReturnLength != ResultOfChunk->Size)
+        {
+            IsTruncated = TRUE;
+        }
+    }
 
     return TRUE;
 }
@@ -428,6 +1027,12 @@ KdSendReadMemoryPacketToDebuggee(PDEBUGGER_READ_MEMORY ReadMem)
 BOOLEAN
 KdSendEditMemoryPacketToDebuggee(PDEBUGGER_EDIT_MEMORY EditMem, UINT32 Size)
 {
+    //
+    // The edited pages (even physical pages that are mapped to other
+    // addresses) are not valid anymore
+    //
+    KdInvalidatePageCache();
+
     //
     // Send d command as read memory packet
     //
@@ -469,6 +1074,11 @@ KdSendRegisterEventPacketToDebuggee(PDEBUGGER_GENERAL_EVENT_DETAIL Event,
     PDEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET Header;
     UINT32                                              Len;
 
+    //
+    // Registering the event might modify the memory (e.g., hooks)
+    //
+    KdInvalidatePageCache();
+
     Len = EventBufferLength +
           sizeof(DEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET);
 
@@ -526,10 +1136,87 @@ KdSendRegisterEventPacketToDebuggee(PDEBUGGER_GENERAL_EVENT_DETAIL Event,
     return &g_DebuggeeResultOfRegisteringEvent;
 }
 
+/**
+ * @brief Get the hash of a script that identifies it in the script
+ * cache of the debuggee
+ * @details the same buffer with another pointer is another script
+ *
+ * @param BufferAddress
+ * @param BufferLength
+ * @param Pointer
+ *
+ * @return UINT64
+ */
+UINT64
+KdGetScriptHash(UINT64 BufferAddress, UINT32 BufferLength, UINT32 Pointer)
+{
+    UINT64 ScriptHash;
+
+    ScriptHash = HashBuffer((PVOID)BufferAddress, BufferLength, 0);
+    ScriptHash = HashBuffer(&Pointer, sizeof(UINT32), ScriptHash);
+
+    return ScriptHash;
+}
+
+/**
+ * @brief Check whether the debuggee has a script in its script cache
+ *
+ * @param ScriptHash
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdIsScriptCachedInDebuggee(UINT64 ScriptHash)
+{
+    return std::find(g_ScriptsCachedInDebuggee.begin(),
+                     g_ScriptsCachedInDebuggee.end(),
+                     ScriptHash) != g_ScriptsCachedInDebuggee.end();
+}
+
+/**
+ * @brief Update the script cache of the debuggee after it used a script
+ * @details The hashes are kept in the order of their uses, the same as
+ * the debuggee which replaces the least recently used script
+ *
+ * @param ScriptHash
+ * @param BufferLength
+ * @param IsCached FALSE if the debuggee doesn't have the script anymore
+ *
+ * @return VOID
+ */
+VOID
+KdUpdateScriptsCachedInDebuggee(UINT64 ScriptHash, UINT32 BufferLength, BOOLEAN IsCached)
+{
+    auto Found = std::find(g_ScriptsCachedInDebuggee.begin(),
+                           g_ScriptsCachedInDebuggee.end(),
+                           ScriptHash);
+
+    if (Found != g_ScriptsCachedInDebuggee.end())
+    {
+        g_ScriptsCachedInDebuggee.erase(Found);
+    }
+
+    //
+    // The debuggee doesn't keep large scripts
+    //
+    if (!IsCached || BufferLength > DEBUGGEE_SCRIPT_CACHE_MAXIMUM_SCRIPT_SIZE)
+    {
+        return;
+    }
+
+    g_ScriptsCachedInDebuggee.push_back(ScriptHash);
+
+    if (g_ScriptsCachedInDebuggee.size() > DEBUGGEE_SCRIPT_CACHE_MAXIMUM_ENTRIES)
+    {
+        g_ScriptsCachedInDebuggee.erase(g_ScriptsCachedInDebuggee.begin());
+    }
+}
+
 /**
  * @brief Send an add action to event request to the debuggee
  * @details as this command uses one global variable to transfer the buffers
- * so should not be called simultaneously
+ * so should not be called simultaneously, if the script of the action is
+ * sent before, then only its hash is sent (the same as running scripts)
  * @param GeneralAction
  * @param GeneralActionLength
  *
@@ -541,8 +1228,25 @@ KdSendAddActionToEventPacketToDebuggee(PDEBUGGER_GENERAL_ACTION GeneralAction,
 {
     PDEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET Header;
     UINT32                                              Len;
+    UINT64                                              ScriptHash     = 0;
+    BOOLEAN                                             IsScript       = FALSE;
+    BOOLEAN                                             IsCachedScript = FALSE;
+
+    if (GeneralAction->ActionType == RUN_SCRIPT && GeneralAction->ScriptBufferSize != 0 &&
+        GeneralActionLength == sizeof(DEBUGGER_GENERAL_ACTION) + GeneralAction->ScriptBufferSize)
+    {
+        IsScript   = TRUE;
+        ScriptHash = KdGetScriptHash((UINT64)GeneralAction + sizeof(DEBUGGER_GENERAL_ACTION),
+                                     GeneralAction->ScriptBufferSize,
+                                     GeneralAction->ScriptBufferPointer);
+
+        IsCachedScript = KdIsScriptCachedInDebuggee(ScriptHash);
+    }
 
-    Len = GeneralActionLength +
+    //
+    // The script is not sent if it's cached
+    //
+    Len = (IsCachedScript ? sizeof(DEBUGGER_GENERAL_ACTION) : GeneralActionLength) +
           sizeof(DEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET);
 
     Header = (PDEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET)malloc(Len);
@@ -557,7 +1261,9 @@ KdSendAddActionToEventPacketToDebuggee(PDEBUGGER_GENERAL_ACTION GeneralAction,
     //
     // Set length in header
     //
-    Header->Length = GeneralActionLength;
+    Header->Length         = GeneralActionLength;
+    Header->ScriptHash     = ScriptHash;
+    Header->IsCachedScript = IsCachedScript;
 
     //
     // Move buffer
@@ -565,7 +1271,7 @@ KdSendAddActionToEventPacketToDebuggee(PDEBUGGER_GENERAL_ACTION GeneralAction,
     memcpy((PVOID)((UINT64)Header +
                    sizeof(DEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET)),
            (PVOID)GeneralAction,
-           GeneralActionLength);
+           Len - sizeof(DEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET));
 
     RtlZeroMemory(&g_DebuggeeResultOfAddingActionsToEvent,
                   sizeof(DEBUGGER_EVENT_AND_ACTION_REG_BUFFER));
@@ -596,6 +1302,24 @@ KdSendAddActionToEventPacketToDebuggee(PDEBUGGER_GENERAL_ACTION GeneralAction,
 
     free(Header);
 
+    if (IsScript)
+    {
+        if (IsCachedScript &&
+            !g_DebuggeeResultOfAddingActionsToEvent.IsSuccessful &&
+            g_DebuggeeResultOfAddingActionsToEvent.Error == DEBUGGER_ERROR_SCRIPT_IS_NOT_CACHED)
+        {
+            //
+            // The debuggee doesn't have the script anymore, send the
+            // buffer of the script
+            //
+            KdUpdateScriptsCachedInDebuggee(ScriptHash, GeneralAction->ScriptBufferSize, FALSE);
+
+            return KdSendAddActionToEventPacketToDebuggee(GeneralAction, GeneralActionLength);
+        }
+
+        KdUpdateScriptsCachedInDebuggee(ScriptHash, GeneralAction->ScriptBufferSize, TRUE);
+    }
+
     return &g_DebuggeeResultOfAddingActionsToEvent;
 }
 
@@ -620,6 +1344,14 @@ KdSendSwitchProcessPacketToDebuggee(DEBUGGEE_DETAILS_AND_SWITCH_PROCESS_TYPE Act
     ProcessChangePacket.ProcessId  = NewPid;
     ProcessChangePacket.Process    = NewProcess;
 
+    //
+    // Virtual addresses are read from the address space of the new process
+    //
+    if (ActionType == DEBUGGEE_DETAILS_AND_SWITCH_PROCESS_SWITCH_PROCESS)
+    {
+        KdInvalidatePageCache();
+    }
+
     //
     // Check if the command really needs these information or not
     // it's because some of the command don't need symbol offset informations
@@ -665,6 +1397,11 @@ KdSendSwitchProcessPacketToDebuggee(DEBUGGEE_DETAILS_AND_SWITCH_PROCESS_TYPE Act
 BOOLEAN
 KdSendBpPacketToDebuggee(PDEBUGGEE_BP_PACKET BpPacket)
 {
+    //
+    // The breakpoint (0xcc) is written to the memory
+    //
+    KdInvalidatePageCache();
+
     //
     // Send 'bp' as a breakpoint packet
     //
@@ -700,6 +1437,11 @@ BOOLEAN
 KdSendListOrModifyPacketToDebuggee(
     PDEBUGGEE_BP_LIST_OR_MODIFY_PACKET ListOrModifyPacket)
 {
+    //
+    // Breakpoints might be removed from the memory
+    //
+    KdInvalidatePageCache();
+
     //
     // Send list or modify breakpoint packet
     //
@@ -729,6 +1471,10 @@ KdSendListOrModifyPacketToDebuggee(
 
 /**
  * @brief Sends a script packet to the debuggee
+ * @details if the script is sent before, then only its hash is sent
+ * and if the debuggee doesn't have the script anymore, the script
+ * buffer is sent again
+ *
  * @param BufferAddress
  * @param BufferLength
  * @param Pointer
@@ -740,9 +1486,19 @@ BOOLEAN
 KdSendScriptPacketToDebuggee(UINT64 BufferAddress, UINT32 BufferLength, UINT32 Pointer, BOOLEAN IsFormat)
 {
     PDEBUGGEE_SCRIPT_PACKET ScriptPacket;
-    UINT32                  SizeOfStruct = 0;
+    UINT32                  SizeOfStruct   = 0;
+    UINT64                  ScriptHash     = 0;
+    BOOLEAN                 IsCachedScript = FALSE;
+
+    //
+    // Scripts might modify the memory (e.g., eb, ed and eq)
+    //
+    KdInvalidatePageCache();
+
+    ScriptHash     = KdGetScriptHash(BufferAddress, BufferLength, Pointer);
+    IsCachedScript = KdIsScriptCachedInDebuggee(ScriptHash);
 
-    SizeOfStruct = sizeof(DEBUGGEE_SCRIPT_PACKET) + BufferLength;
+    SizeOfStruct = sizeof(DEBUGGEE_SCRIPT_PACKET) + (IsCachedScript ? 0 : BufferLength);
 
     ScriptPacket = (DEBUGGEE_SCRIPT_PACKET *)malloc(SizeOfStruct);
 
@@ -754,13 +1510,18 @@ KdSendScriptPacketToDebuggee(UINT64 BufferAddress, UINT32 BufferLength, UINT32 P
     ScriptPacket->ScriptBufferSize    = BufferLength;
     ScriptPacket->ScriptBufferPointer = Pointer;
     ScriptPacket->IsFormat            = IsFormat;
+    ScriptPacket->ScriptHash          = ScriptHash;
+    ScriptPacket->IsCachedScript      = IsCachedScript;
 
     //
     // Move the buffer at the bottom of the script packet
     //
-    memcpy((PVOID)((UINT64)ScriptPacket + sizeof(DEBUGGEE_SCRIPT_PACKET)),
-           (PVOID)BufferAddress,
-           BufferLength);
+    if (!IsCachedScript)
+    {
+        memcpy((PVOID)((UINT64)ScriptPacket + sizeof(DEBUGGEE_SCRIPT_PACKET)),
+               (PVOID)BufferAddress,
+               BufferLength);
+    }
 
     //
     // Send script packet
@@ -802,6 +1563,20 @@ KdSendScriptPacketToDebuggee(UINT64 BufferAddress, UINT32 BufferLength, UINT32 P
                         INFINITE);
 
     free(ScriptPacket);
+
+    if (IsCachedScript && g_ResultOfRunningScriptInDebuggee == DEBUGGER_ERROR_SCRIPT_IS_NOT_CACHED)
+    {
+        //
+        // The debuggee doesn't have the script anymore, send the
+        // buffer of the script
+        //
+        KdUpdateScriptsCachedInDebuggee(ScriptHash, BufferLength, FALSE);
+
+        return KdSendScriptPacketToDebuggee(BufferAddress, BufferLength, Pointer, IsFormat);
+    }
+
+    KdUpdateScriptsCachedInDebuggee(ScriptHash, BufferLength, TRUE);
+
     return TRUE;
 }
 
@@ -882,6 +1657,11 @@ KdSendStepPacketToDebuggee(DEBUGGER_REMOTE_STEPPING_REQUEST StepRequestType)
     //
     StepPacket.StepType = StepRequestType;
 
+    //
+    // The memory is changed while the debuggee is running
+    //
+    KdInvalidatePageCache();
+
     //
     // Check if it's a step-over
     //
@@ -990,109 +1770,395 @@ KdGetWindowVersion(CHAR * BufferToSave)
         // return FALSE;
     }
 
-    if (valueType != REG_SZ)
-    {
-        //  return FALSE;
-    }
+    if (valueType != REG_SZ)
+    {
+        //  return FALSE;
+    }
+
+    bufferSize = MAXIMUM_CHARACTER_FOR_OS_NAME;
+
+    if (RegQueryValueExA(currentVersion, "DisplayVersion", nullptr, &valueType, bufferDisplayVersion, &bufferSize) != ERROR_SUCCESS)
+    {
+        // return FALSE;
+    }
+
+    if (valueType != REG_SZ)
+    {
+        //  return FALSE;
+    }
+    bufferSize = MAXIMUM_CHARACTER_FOR_OS_NAME;
+
+    if (RegQueryValueExA(currentVersion, "CurrentBuild", nullptr, &valueType, bufferCurrentBuild, &bufferSize) != ERROR_SUCCESS)
+    {
+        //  return FALSE;
+    }
+
+    if (valueType != REG_SZ)
+    {
+        // return FALSE;
+    }
+
+    sprintf_s(bufferResult, "%s %s %s (OS Build %s)", bufferProductName, IsWindowsServer() ? "- Server" : "- Client", bufferDisplayVersion, bufferCurrentBuild);
+
+    memcpy(BufferToSave, bufferResult, MAXIMUM_CHARACTER_FOR_OS_NAME);
+
+    return TRUE;
+}
+
+/**
+ * @brief Read whatever is available (up to the maximum length) into the
+ * receive buffer
+ * @details The previous bytes of the buffer should be already parsed
+ *
+ * @param Handle Handle of the serial port or the named pipe
+ * @param Overlapped Overlapped structure of reads or NULL for synchronous reads
+ * @param ReceiveBuffer
+ * @param MaximumReadLength
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdReceiveBufferFill(HANDLE             Handle,
+                    LPOVERLAPPED       Overlapped,
+                    PKD_RECEIVE_BUFFER ReceiveBuffer,
+                    UINT32             MaximumReadLength)
+{
+    BOOL  Status;
+    DWORD NoBytesRead = 0;
+
+    ReceiveBuffer->Head = 0;
+    ReceiveBuffer->Tail = 0;
+
+    if (MaximumReadLength > KD_RECEIVE_BUFFER_SIZE)
+    {
+        MaximumReadLength = KD_RECEIVE_BUFFER_SIZE;
+    }
+
+    if (Overlapped == NULL)
+    {
+        Status = ReadFile(Handle, ReceiveBuffer->Buffer, MaximumReadLength, &NoBytesRead, NULL);
+    }
+    else
+    {
+        //
+        // Read in overlapped I/O (in debugger), the serial port returns as
+        // soon as any byte is received (based on its timeouts) and named
+        // pipes return the bytes that are available
+        //
+        if (!ReadFile(Handle, ReceiveBuffer->Buffer, MaximumReadLength, NULL, Overlapped))
+        {
+            DWORD e = GetLastError();
+
+            if (e != ERROR_IO_PENDING)
+            {
+                return FALSE;
+            }
+        }
+
+        //
+        // Wait till the bytes become available
+        //
+        WaitForSingleObject(Overlapped->hEvent, INFINITE);
+
+        //
+        // Get the result
+        //
+        Status = GetOverlappedResult(Handle, Overlapped, &NoBytesRead, FALSE);
+
+        //
+        // Reset event for next try
+        //
+        ResetEvent(Overlapped->hEvent);
+    }
+
+    if (!Status)
+    {
+        return FALSE;
+    }
+
+    ReceiveBuffer->Tail = NoBytesRead;
+
+    return TRUE;
+}
+
+/**
+ * @brief Receive a specific count of bytes through the receive buffer
+ *
+ * @param Handle Handle of the serial port or the named pipe
+ * @param Overlapped Overlapped structure of reads or NULL for synchronous reads
+ * @param ReceiveBuffer
+ * @param MaximumReadLength Maximum count of bytes that is read at once
+ * @param BufferToSave
+ * @param Length
+ * @param CountOfReads Incremented by the count of reads (optional)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdReceiveBytesThroughBuffer(HANDLE             Handle,
+                            LPOVERLAPPED       Overlapped,
+                            PKD_RECEIVE_BUFFER ReceiveBuffer,
+                            UINT32             MaximumReadLength,
+                            CHAR *             BufferToSave,
+                            UINT32             Length,
+                            UINT32 *           CountOfReads)
+{
+    UINT32 AvailableBytes;
+
+    while (Length != 0)
+    {
+        if (ReceiveBuffer->Head == ReceiveBuffer->Tail)
+        {
+            if (!KdReceiveBufferFill(Handle, Overlapped, ReceiveBuffer, MaximumReadLength))
+            {
+                return FALSE;
+            }
+
+            if (CountOfReads != NULL)
+            {
+                (*CountOfReads)++;
+            }
+
+            continue;
+        }
+
+        AvailableBytes = ReceiveBuffer->Tail - ReceiveBuffer->Head;
+
+        if (AvailableBytes > Length)
+        {
+            AvailableBytes = Length;
+        }
+
+        memcpy(BufferToSave, &ReceiveBuffer->Buffer[ReceiveBuffer->Head], AvailableBytes);
+
+        ReceiveBuffer->Head += AvailableBytes;
+        BufferToSave += AvailableBytes;
+        Length -= AvailableBytes;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Discard the received bytes until the signature of the next frame
+ * @details The length of a corrupted frame can't be trusted, so the stream
+ * is searched for the signature of a frame (compressed or not)
+ *
+ * @param Handle Handle of the serial port or the named pipe
+ * @param Overlapped Overlapped structure of reads or NULL for synchronous reads
+ * @param ReceiveBuffer
+ * @param MaximumReadLength Maximum count of bytes that is read at once
+ * @param Signature The signature of the next frame
+ * @param CountOfReads Incremented by the count of reads (optional)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSkipToNextFrameThroughBuffer(HANDLE             Handle,
+                               LPOVERLAPPED       Overlapped,
+                               PKD_RECEIVE_BUFFER ReceiveBuffer,
+                               UINT32             MaximumReadLength,
+                               UINT32 *           Signature,
+                               UINT32 *           CountOfReads)
+{
+    UINT32 Window   = 0;
+    BYTE   ReadData = 0;
+
+    while (Window != SERIAL_FRAME_SIGNATURE && Window != SERIAL_FRAME_SIGNATURE_COMPRESSED)
+    {
+        if (!KdReceiveBytesThroughBuffer(Handle,
+                                         Overlapped,
+                                         ReceiveBuffer,
+                                         MaximumReadLength,
+                                         (CHAR *)&ReadData,
+                                         sizeof(BYTE),
+                                         CountOfReads))
+        {
+            return FALSE;
+        }
+
+        Window = (Window >> 8) | ((UINT32)ReadData << 24);
+    }
+
+    *Signature = Window;
+
+    return TRUE;
+}
+
+/**
+ * @brief Receive the rest of a framed packet through the receive buffer
+ * @details The signature of the header is already received, the length
+ * is known so the packet is copied without searching for the end of buffer,
+ * compressed packets are decompressed to the buffer, if the length or the
+ * CRC32 of the frame is invalid then the next frame is received
+ *
+ * @param Handle Handle of the serial port or the named pipe
+ * @param Overlapped Overlapped structure of reads or NULL for synchronous reads
+ * @param ReceiveBuffer
+ * @param MaximumReadLength Maximum count of bytes that is read at once
+ * @param BufferToSave
+ * @param LengthReceived
+ * @param CountOfReads Incremented by the count of reads (optional)
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdReceiveFrameThroughBuffer(HANDLE             Handle,
+                            LPOVERLAPPED       Overlapped,
+                            PKD_RECEIVE_BUFFER ReceiveBuffer,
+                            UINT32             MaximumReadLength,
+                            CHAR *             BufferToSave,
+                            UINT32 *           LengthReceived,
+                            UINT32 *           CountOfReads)
+{
+    SERIAL_FRAME_HEADER Header                                = {0};
+    CHAR                CompressedBuffer[MaxSerialPacketSize] = {0};
+    UINT32              DecompressedLength                    = 0;
+    CHAR *              Payload;
+
+    Header.Signature = *(UINT32 *)BufferToSave;
+
+    while (TRUE)
+    {
+        if (!KdReceiveBytesThroughBuffer(Handle,
+                                         Overlapped,
+                                         ReceiveBuffer,
+                                         MaximumReadLength,
+                                         (CHAR *)&Header + sizeof(UINT32),
+                                         sizeof(SERIAL_FRAME_HEADER) - sizeof(UINT32),
+                                         CountOfReads))
+        {
+            return FALSE;
+        }
+
+        //
+        // The same limitation as the packets with the end of buffer (it's
+        // not added to the length as the length might overflow)
+        //
+        if (Header.Length > MaxSerialPacketSize - SERIAL_END_OF_BUFFER_CHARS_COUNT)
+        {
+            ShowMessages("err, a buffer received in which exceeds the "
+                         "buffer limitation\n");
+        }
+        else
+        {
+            //
+            // Compressed packets are received in another buffer, then they're
+            // decompressed to the buffer
+            //
+            Payload = Header.Signature == SERIAL_FRAME_SIGNATURE_COMPRESSED ? CompressedBuffer : BufferToSave;
+
+            if (!KdReceiveBytesThroughBuffer(Handle,
+                                             Overlapped,
+                                             ReceiveBuffer,
+                                             MaximumReadLength,
+                                             Payload,
+                                             Header.Length,
+                                             CountOfReads))
+            {
+                return FALSE;
+            }
 
-    bufferSize = MAXIMUM_CHARACTER_FOR_OS_NAME;
+            if (KdComputeDataCrc32(Payload, Header.Length, 0) == Header.Crc32)
+            {
+                break;
+            }
 
-    if (RegQueryValueExA(currentVersion, "DisplayVersion", nullptr, &valueType, bufferDisplayVersion, &bufferSize) != ERROR_SUCCESS)
-    {
-        // return FALSE;
-    }
+            ShowMessages("err, crc32 of the received buffer is invalid\n");
+        }
 
-    if (valueType != REG_SZ)
-    {
-        //  return FALSE;
+        //
+        // The frame is corrupted, so the stream is synchronized again
+        // with the next frame
+        //
+        if (!KdSkipToNextFrameThroughBuffer(Handle,
+                                            Overlapped,
+                                            ReceiveBuffer,
+                                            MaximumReadLength,
+                                            &Header.Signature,
+                                            CountOfReads))
+        {
+            return FALSE;
+        }
     }
-    bufferSize = MAXIMUM_CHARACTER_FOR_OS_NAME;
 
-    if (RegQueryValueExA(currentVersion, "CurrentBuild", nullptr, &valueType, bufferCurrentBuild, &bufferSize) != ERROR_SUCCESS)
+    if (Header.Signature == SERIAL_FRAME_SIGNATURE_COMPRESSED)
     {
-        //  return FALSE;
-    }
+        //
+        // The compressed block starts after the length of the packet
+        //
+        if (Header.Length < sizeof(UINT32) ||
+            !SerialCompressionDecompress((BYTE *)&CompressedBuffer[sizeof(UINT32)],
+                                         Header.Length - sizeof(UINT32),
+                                         (BYTE *)BufferToSave,
+                                         MaxSerialPacketSize - SERIAL_END_OF_BUFFER_CHARS_COUNT,
+                                         &DecompressedLength) ||
+            DecompressedLength != *(UINT32 *)CompressedBuffer)
+        {
+            ShowMessages("err, unable to decompress the received buffer\n");
+            return FALSE;
+        }
 
-    if (valueType != REG_SZ)
-    {
-        // return FALSE;
+        Header.Length = DecompressedLength;
     }
 
-    sprintf_s(bufferResult, "%s %s %s (OS Build %s)", bufferProductName, IsWindowsServer() ? "- Server" : "- Client", bufferDisplayVersion, bufferCurrentBuild);
-
-    memcpy(BufferToSave, bufferResult, MAXIMUM_CHARACTER_FOR_OS_NAME);
+    *LengthReceived = Header.Length;
 
     return TRUE;
 }
 
 /**
- * @brief Receive packet from the debugger
+ * @brief Receive a packet through the receive buffer
+ * @details The end of buffer is matched incrementally, so each byte is
+ * checked once, and the bytes after the end of the packet remain in the
+ * buffer for the next packet, framed packets are also received
  *
+ * @param Handle Handle of the serial port or the named pipe
+ * @param Overlapped Overlapped structure of reads or NULL for synchronous reads
+ * @param ReceiveBuffer
+ * @param MaximumReadLength Maximum count of bytes that is read at once
  * @param BufferToSave
  * @param LengthReceived
+ * @param CountOfReads Incremented by the count of reads (optional)
  *
  * @return BOOLEAN
  */
 BOOLEAN
-KdReceivePacketFromDebuggee(CHAR *   BufferToSave,
-                            UINT32 * LengthReceived)
+KdReceivePacketThroughBuffer(HANDLE             Handle,
+                             LPOVERLAPPED       Overlapped,
+                             PKD_RECEIVE_BUFFER ReceiveBuffer,
+                             UINT32             MaximumReadLength,
+                             CHAR *             BufferToSave,
+                             UINT32 *           LengthReceived,
+                             UINT32 *           CountOfReads)
 {
-    BOOL   Status;             /* Status */
-    char   ReadData    = NULL; /* temperory Character */
-    DWORD  NoBytesRead = 0;    /* Bytes read by ReadFile() */
-    UINT32 Loop        = 0;
+    BYTE   ReadData;
+    UINT32 Loop               = 0;
+    UINT32 MatchedEndOfBuffer = 0;
 
-    //
-    // Read data and store in a buffer
-    //
-    do
+    while (TRUE)
     {
-        if (g_IsSerialConnectedToRemoteDebugger)
-        {
-            //
-            // It's a debuggee
-            //
-            Status = ReadFile(g_SerialRemoteComPortHandle, &ReadData, sizeof(ReadData), &NoBytesRead, NULL);
-        }
-        else
+        if (ReceiveBuffer->Head == ReceiveBuffer->Tail)
         {
             //
-            // It's a debugger
+            // All of the received bytes are parsed, read again (an empty
+            // read means that the timeout of serial port is reached)
             //
-
-            //
-            // Try to read one byte in overlapped I/O (in debugger)
-            //
-            if (!ReadFile(g_SerialRemoteComPortHandle, &ReadData, sizeof(ReadData), NULL, &g_OverlappedIoStructureForReadDebugger))
+            if (!KdReceiveBufferFill(Handle, Overlapped, ReceiveBuffer, MaximumReadLength))
             {
-                DWORD e = GetLastError();
-
-                if (e != ERROR_IO_PENDING)
-                {
-                    return FALSE;
-                }
+                return FALSE;
             }
 
-            //
-            // Wait till one packet becomes available
-            //
-            WaitForSingleObject(g_OverlappedIoStructureForReadDebugger.hEvent,
-                                INFINITE);
-
-            //
-            // Get the result
-            //
-            GetOverlappedResult(g_SerialRemoteComPortHandle,
-                                &g_OverlappedIoStructureForReadDebugger,
-                                &NoBytesRead,
-                                FALSE);
+            if (CountOfReads != NULL)
+            {
+                (*CountOfReads)++;
+            }
 
-            //
-            // Reset event for next try
-            //
-            ResetEvent(g_OverlappedIoStructureForReadDebugger.hEvent);
+            continue;
         }
 
+        ReadData = ReceiveBuffer->Buffer[ReceiveBuffer->Head++];
+
         //
         // We already now that the maximum packet size is MaxSerialPacketSize
         // Check to make sure that we don't pass the boundaries
@@ -1107,16 +2173,55 @@ KdReceivePacketFromDebuggee(CHAR *   BufferToSave,
             return FALSE;
         }
 
-        BufferToSave[Loop] = ReadData;
+        BufferToSave[Loop++] = ReadData;
+
+        //
+        // Check whether it's the header of a framed packet
+        //
+        if (Loop == sizeof(UINT32) && (*(UINT32 *)BufferToSave == SERIAL_FRAME_SIGNATURE ||
+                                       *(UINT32 *)BufferToSave == SERIAL_FRAME_SIGNATURE_COMPRESSED))
+        {
+            return KdReceiveFrameThroughBuffer(Handle,
+                                               Overlapped,
+                                               ReceiveBuffer,
+                                               MaximumReadLength,
+                                               BufferToSave,
+                                               LengthReceived,
+                                               CountOfReads);
+        }
 
-        if (KdCheckForTheEndOfTheBuffer(&Loop, (BYTE *)BufferToSave))
+        //
+        // The characters of the end of buffer are different from each
+        // other, so a mismatch only might start a new match
+        //
+        if (ReadData == g_EndOfBufferCheckSerial[MatchedEndOfBuffer])
         {
-            break;
+            MatchedEndOfBuffer++;
+        }
+        else
+        {
+            MatchedEndOfBuffer = ReadData == g_EndOfBufferCheckSerial[0] ? 1 : 0;
         }
 
-        Loop++;
+        if (MatchedEndOfBuffer == SERIAL_END_OF_BUFFER_CHARS_COUNT)
+        {
+            //
+            // The end of buffer itself (without any data) is not a packet,
+            // the same as KdCheckForTheEndOfTheBuffer
+            //
+            if (Loop > SERIAL_END_OF_BUFFER_CHARS_COUNT)
+            {
+                //
+                // Clear the end characters and set the new length
+                //
+                Loop -= SERIAL_END_OF_BUFFER_CHARS_COUNT;
+                RtlZeroMemory(&BufferToSave[Loop], SERIAL_END_OF_BUFFER_CHARS_COUNT);
+                break;
+            }
 
-    } while (NoBytesRead > 0);
+            MatchedEndOfBuffer = 0;
+        }
+    }
 
     //
     // Set the length
@@ -1126,6 +2231,48 @@ KdReceivePacketFromDebuggee(CHAR *   BufferToSave,
     return TRUE;
 }
 
+/**
+ * @brief Receive packet from the debugger
+ *
+ * @param BufferToSave
+ * @param LengthReceived
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdReceivePacketFromDebuggee(CHAR *   BufferToSave,
+                            UINT32 * LengthReceived)
+{
+    if (g_IsSerialConnectedToRemoteDebugger)
+    {
+        //
+        // It's a debuggee, the port has no timeouts so a read doesn't return
+        // until all of the requested bytes are received, thus it's read
+        // byte by byte
+        //
+        return KdReceivePacketThroughBuffer(g_SerialRemoteComPortHandle,
+                                            NULL,
+                                            &g_KdReceiveBuffer,
+                                            sizeof(BYTE),
+                                            BufferToSave,
+                                            LengthReceived,
+                                            NULL);
+    }
+    else
+    {
+        //
+        // It's a debugger, read whatever is available in overlapped I/O
+        //
+        return KdReceivePacketThroughBuffer(g_SerialRemoteComPortHandle,
+                                            &g_OverlappedIoStructureForReadDebugger,
+                                            &g_KdReceiveBuffer,
+                                            KD_RECEIVE_BUFFER_SIZE,
+                                            BufferToSave,
+                                            LengthReceived,
+                                            NULL);
+    }
+}
+
 /**
  * @brief Sends a special packet to the debuggee
  *
@@ -1251,6 +2398,36 @@ Out:
     return TRUE;
 }
 
+/**
+ * @brief Sends the header of a framed packet to the debuggee
+ *
+ * @param Length Length of the packet
+ * @param Crc32 CRC32 of the packet
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendFrameHeaderToDebuggee(UINT32 Length, UINT32 Crc32)
+{
+    SERIAL_FRAME_HEADER Header = {0};
+
+    //
+    // The same limitation as the packets with the end of buffer
+    //
+    if (Length + SERIAL_END_OF_BUFFER_CHARS_COUNT > MaxSerialPacketSize)
+    {
+        ShowMessages(
+            "err, buffer is above the maximum buffer size that can be sent to "
+            "debuggee\n");
+        return FALSE;
+    }
+
+    Header.Signature = SERIAL_FRAME_SIGNATURE;
+    Header.Length    = Length;
+    Header.Crc32     = Crc32;
+
+    return KdSendPacketToDebuggee((const CHAR *)&Header, sizeof(SERIAL_FRAME_HEADER), FALSE);
+}
+
 /**
  * @brief Sends a HyperDbg packet to the debuggee
  *
@@ -1269,6 +2446,8 @@ KdCommandPacketToDebuggee(
     //
     Packet.Indicator       = INDICATOR_OF_HYPERDBG_PACKER;
     Packet.TypeOfThePacket = PacketType;
+    Packet.SequenceNumber  = KdGetNextSequenceNumber();
+    Packet.Flags           = KdGetPacketFlags();
 
     //
     // Set the requested action
@@ -1282,9 +2461,19 @@ KdCommandPacketToDebuggee(
         KdComputeDataChecksum((PVOID)((UINT64)&Packet + 1),
                               sizeof(DEBUGGER_REMOTE_PACKET) - sizeof(BYTE));
 
+    //
+    // Framed packets start with a header instead of the end of buffer
+    //
+    if (KdIsSerialFramed() &&
+        !KdSendFrameHeaderToDebuggee(sizeof(DEBUGGER_REMOTE_PACKET),
+                                     KdComputeDataCrc32(&Packet, sizeof(DEBUGGER_REMOTE_PACKET), 0)))
+    {
+        return FALSE;
+    }
+
     if (!KdSendPacketToDebuggee((const CHAR *)&Packet,
                                 sizeof(DEBUGGER_REMOTE_PACKET),
-                                TRUE))
+                                !KdIsSerialFramed()))
     {
         return FALSE;
     }
@@ -1305,14 +2494,43 @@ KdCommandPacketAndBufferToDebuggee(
     DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedAction,
     CHAR *                                  Buffer,
     UINT32                                  BufferLength)
+{
+    return KdCommandPacketAndBufferWithSequenceNumberToDebuggee(PacketType,
+                                                                RequestedAction,
+                                                                KdGetNextSequenceNumber(),
+                                                                Buffer,
+                                                                BufferLength);
+}
+
+/**
+ * @brief Sends a HyperDbg packet + a buffer with a known sequence
+ * number to the debuggee
+ *
+ * @param PacketType
+ * @param RequestedAction
+ * @param SequenceNumber
+ * @param Buffer
+ * @param BufferLength
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdCommandPacketAndBufferWithSequenceNumberToDebuggee(
+    DEBUGGER_REMOTE_PACKET_TYPE             PacketType,
+    DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedAction,
+    UINT32                                  SequenceNumber,
+    CHAR *                                  Buffer,
+    UINT32                                  BufferLength)
 {
     DEBUGGER_REMOTE_PACKET Packet = {0};
+    UINT32                 Crc32;
 
     //
     // Make the packet's structure
     //
     Packet.Indicator       = INDICATOR_OF_HYPERDBG_PACKER;
     Packet.TypeOfThePacket = PacketType;
+    Packet.SequenceNumber  = SequenceNumber;
+    Packet.Flags           = KdGetPacketFlags();
 
     //
     // Set the requested action
@@ -1328,6 +2546,20 @@ KdCommandPacketAndBufferToDebuggee(
 
     Packet.Checksum += KdComputeDataChecksum((PVOID)Buffer, BufferLength);
 
+    //
+    // Framed packets start with a header instead of the end of buffer
+    //
+    if (KdIsSerialFramed())
+    {
+        Crc32 = KdComputeDataCrc32(&Packet, sizeof(DEBUGGER_REMOTE_PACKET), 0);
+        Crc32 = KdComputeDataCrc32(Buffer, BufferLength, Crc32);
+
+        if (!KdSendFrameHeaderToDebuggee(sizeof(DEBUGGER_REMOTE_PACKET) + BufferLength, Crc32))
+        {
+            return FALSE;
+        }
+    }
+
     //
     // Send the first buffer (without ending buffer indication)
     //
@@ -1339,16 +2571,131 @@ KdCommandPacketAndBufferToDebuggee(
     }
 
     //
-    // Send the second buffer (with ending buffer indication)
+    // Send the second buffer (with ending buffer indication if it's not framed)
+    //
+    if (!KdSendPacketToDebuggee((const CHAR *)Buffer, BufferLength, !KdIsSerialFramed()))
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Send a request to the debuggee without waiting for its response
+ * @details The response is kept in the pending request by the listening
+ * thread, up to KdGetCountOfPipelinedRequests requests are sent before
+ * waiting for their responses (the debuggee answers them in order)
+ *
+ * @param Request The pending request that keeps the response
+ * @param RequestedAction
+ * @param ResponseAction The requested action of the response
+ * @param Buffer
+ * @param BufferLength
+ * @return BOOLEAN
+ */
+BOOLEAN
+KdSendPipelinedRequestToDebuggee(PKD_PENDING_REQUEST                     Request,
+                                 DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedAction,
+                                 DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION ResponseAction,
+                                 CHAR *                                  Buffer,
+                                 UINT32                                  BufferLength)
+{
+    //
+    // The request is pending before sending it as the response might be
+    // received before returning from sending
     //
-    if (!KdSendPacketToDebuggee((const CHAR *)Buffer, BufferLength, TRUE))
+    Request->SequenceNumber = KdGetNextSequenceNumber();
+    Request->ResponseAction = ResponseAction;
+    Request->Length         = 0;
+    Request->IsPending      = TRUE;
+
+    if (!KdCommandPacketAndBufferWithSequenceNumberToDebuggee(
+            DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGER_TO_DEBUGGEE_EXECUTE_ON_VMX_ROOT,
+            RequestedAction,
+            Request->SequenceNumber,
+            Buffer,
+            BufferLength))
     {
+        Request->IsPending = FALSE;
         return FALSE;
     }
 
     return TRUE;
 }
 
+/**
+ * @brief Wait until the response of a pipelined request is received
+ *
+ * @param Request
+ * @return BOOLEAN FALSE if the connection is closed
+ */
+BOOLEAN
+KdWaitForPipelinedRequest(PKD_PENDING_REQUEST Request)
+{
+    while (Request->IsPending)
+    {
+        if (!g_IsSerialConnectedToRemoteDebuggee)
+        {
+            Request->IsPending = FALSE;
+            return FALSE;
+        }
+
+        g_SyncronizationObjectsHandleTable[DEBUGGER_SYNCRONIZATION_OBJECT_PIPELINED_REQUESTS]
+            .IsOnWaitingState = TRUE;
+        WaitForSingleObject(g_SyncronizationObjectsHandleTable
+                                [DEBUGGER_SYNCRONIZATION_OBJECT_PIPELINED_REQUESTS]
+                                    .EventHandle,
+                            INFINITE);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Keep a received packet if it's the response of a pipelined request
+ * @details This function is called by the listening thread, the responses
+ * are matched by their sequence numbers (and their requested actions as
+ * previous versions of the debuggee send zero)
+ *
+ * @param Packet
+ * @param Length
+ * @return BOOLEAN TRUE if the packet is a response of a pipelined request
+ */
+BOOLEAN
+KdCompletePipelinedRequest(PDEBUGGER_REMOTE_PACKET Packet, UINT32 Length)
+{
+    for (UINT32 i = 0; i < SERIAL_MAXIMUM_PIPELINED_REQUESTS; i++)
+    {
+        PKD_PENDING_REQUEST Request = &g_KdPendingRequests[i];
+
+        if (!Request->IsPending ||
+            Request->SequenceNumber != Packet->SequenceNumber ||
+            Request->ResponseAction != Packet->RequestedActionOfThePacket)
+        {
+            continue;
+        }
+
+        memcpy(Request->Buffer, Packet, Length);
+        Request->Length    = Length;
+        Request->IsPending = FALSE;
+
+        //
+        // Signal the event relating to receiving the responses of pipelined requests
+        //
+        g_SyncronizationObjectsHandleTable
+            [DEBUGGER_SYNCRONIZATION_OBJECT_PIPELINED_REQUESTS]
+                .IsOnWaitingState = FALSE;
+        SetEvent(g_SyncronizationObjectsHandleTable
+                     [DEBUGGER_SYNCRONIZATION_OBJECT_PIPELINED_REQUESTS]
+                         .EventHandle);
+
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
 /**
  * @brief check if the debuggee needs to be paused
  *
@@ -1719,23 +3066,26 @@ KdPrepareAndConnectDebugPort(const char * PortName, DWORD Baudrate, UINT32 Port,
         }
 
         //
-        // Setting Timeouts (not use it anymore as we use special signature for
-        // ending buffer)
-        // (no need anymore as we use end buffer detection mechanism)
+        // Setting Timeouts, the debugger reads whatever is available in the
+        // port (the packets are separated by the end of buffer), so a read
+        // returns as soon as any byte is received, the debuggee reads without
+        // timeouts
         //
+        if (!IsPreparing)
+        {
+            Timeouts.ReadIntervalTimeout         = MAXDWORD;
+            Timeouts.ReadTotalTimeoutMultiplier  = MAXDWORD;
+            Timeouts.ReadTotalTimeoutConstant    = KD_RECEIVE_BUFFER_READ_TIMEOUT;
+            Timeouts.WriteTotalTimeoutConstant   = 0;
+            Timeouts.WriteTotalTimeoutMultiplier = 0;
 
-        /*
-    Timeouts.ReadIntervalTimeout = 50;
-    Timeouts.ReadTotalTimeoutConstant = 50;
-    Timeouts.ReadTotalTimeoutMultiplier = 10;
-    Timeouts.WriteTotalTimeoutConstant = 50;
-    Timeouts.WriteTotalTimeoutMultiplier = 10;
-
-    if (SetCommTimeouts(Comm, &Timeouts) == FALSE) {
-      ShowMessages("err, to Setting Time outs (%x).\n", GetLastError());
-      return FALSE;
-    }
-    */
+            if (SetCommTimeouts(Comm, &Timeouts) == FALSE)
+            {
+                CloseHandle(Comm);
+                ShowMessages("err, to Setting Time outs (%x)\n", GetLastError());
+                return FALSE;
+            }
+        }
     }
     else
     {
@@ -1958,6 +3308,18 @@ KdPrepareAndConnectDebugPort(const char * PortName, DWORD Baudrate, UINT32 Port,
         //
         g_SerialRemoteComPortHandle = Comm;
 
+        //
+        // Nothing is received from the new connection
+        //
+        g_KdReceiveBuffer.Head = 0;
+        g_KdReceiveBuffer.Tail = 0;
+
+        //
+        // Packets are sent with the end of buffer until the debuggee
+        // shows that it supports framed packets
+        //
+        g_SerialFramingVersion = SERIAL_FRAMING_VERSION_END_OF_BUFFER;
+
         //
         // If we are here, then it's a debugger (not debuggee)
         // let's prepare the debuggee
@@ -2603,6 +3965,11 @@ KdUninitializeConnection()
     //
     g_IsSerialConnectedToRemoteDebuggee = FALSE;
 
+    //
+    // Scripts that are kept by the debuggee are not valid anymore
+    //
+    g_ScriptsCachedInDebuggee.clear();
+
     //
     // And debuggee is not running
     //
@@ -2617,6 +3984,21 @@ KdUninitializeConnection()
         g_SerialRemoteComPortHandle = NULL;
     }
 
+    //
+    // Remaining bytes, the framing, the pipelined requests and the cached
+    // pages of the previous connection are not valid anymore
+    //
+    g_KdReceiveBuffer.Head = 0;
+    g_KdReceiveBuffer.Tail = 0;
+    g_SerialFramingVersion = SERIAL_FRAMING_VERSION_END_OF_BUFFER;
+
+    for (UINT32 i = 0; i < SERIAL_MAXIMUM_PIPELINED_REQUESTS; i++)
+    {
+        g_KdPendingRequests[i].IsPending = FALSE;
+    }
+
+    KdInvalidatePageCache();
+
     //
     // Start getting debuggee messages on next try
     //
@@ -32,6 +32,12 @@ extern DEBUGGER_EVENT_AND_ACTION_REG_BUFFER
               g_DebuggeeResultOfAddingActionsToEvent;
 extern UINT64 g_ResultOfEvaluatedExpression;
 extern UINT32 g_ErrorStateOfResultOfEvaluatedExpression;
+extern UINT32 g_ResultOfRunningScriptInDebuggee;
+extern UINT32 g_SerialFramingVersion;
+
+extern KD_RECEIVE_BUFFER                g_KdReceiveBuffer;
+extern PSCRIPT_ENGINE_AGGREGATION_MAPS  g_KdAggregationMapsResult;
+extern DEBUGGEE_AGGREGATION_MAPS_PACKET g_KdAggregationMapsPacket;
 
 /**
  * @brief Check if the remote debuggee needs to pause the system
@@ -56,13 +62,16 @@ ListeningSerialPortInDebugger()
     PDEBUGGEE_DETAILS_AND_SWITCH_PROCESS_PACKET ChangeProcessPacket;
     PDEBUGGER_FLUSH_LOGGING_BUFFERS             FlushPacket;
     PDEBUGGEE_REGISTER_READ_DESCRIPTION         ReadRegisterPacket;
-    PDEBUGGER_READ_MEMORY                       ReadMemoryPacket;
     PDEBUGGER_EDIT_MEMORY                       EditMemoryPacket;
     PDEBUGGEE_BP_PACKET                         BpPacket;
     PDEBUGGEE_BP_LIST_OR_MODIFY_PACKET          ListOrModifyBreakpointPacket;
+    PDEBUGGEE_AGGREGATION_MAPS_PACKET           AggregationMapsPacket;
+    PSCRIPT_ENGINE_AGGREGATION_MAP              AggregationMap;
+    PSCRIPT_ENGINE_AGGREGATION_ENTRY            AggregationEntries;
+    UINT32                                      AggregationEntryIndex;
     PGUEST_REGS                                 Regs;
     PGUEST_EXTRA_REGISTERS                      ExtraRegs;
-    unsigned char *                             MemoryBuffer;
+    CHAR                                        RenderedEventRecord[PacketChunkSize];
     BOOLEAN                                     ShowSignatureWhenDisconnected = FALSE;
 
 StartAgain:
@@ -127,7 +136,7 @@ StartAgain:
         //
         // Check checksum
         //
-        if (KdComputeDataChecksum((PVOID)&TheActualPacket->Indicator,
+        if (KdComputeDataChecksum((PVOID)((UINT64)TheActualPacket + 1),
                                   LengthReceived - sizeof(BYTE)) !=
             TheActualPacket->Checksum)
         {
@@ -149,6 +158,15 @@ StartAgain:
             goto StartAgain;
         }
 
+        //
+        // Responses of the pipelined requests are kept for the thread that
+        // sent the requests
+        //
+        if (KdCompletePipelinedRequest(TheActualPacket, LengthReceived))
+        {
+            goto StartAgain;
+        }
+
         //
         // It's a HyperDbg packet
         //
@@ -162,6 +180,20 @@ StartAgain:
 
             ShowMessages("connected to debuggee %s\n", InitPacket->OsName);
 
+            //
+            // Packets are sent in frames (length and CRC32), the requests are
+            // pipelined and the responses are compressed if the debuggee supports
+            // them, previous versions of the debuggee send zero
+            //
+            if (InitPacket->FramingVersion >= SERIAL_FRAMING_VERSION_LATEST)
+            {
+                g_SerialFramingVersion = SERIAL_FRAMING_VERSION_LATEST;
+            }
+            else if (InitPacket->FramingVersion >= SERIAL_FRAMING_VERSION_LENGTH_AND_CRC32)
+            {
+                g_SerialFramingVersion = InitPacket->FramingVersion;
+            }
+
             //
             // Signal the event that the debugger started
             //
@@ -186,7 +218,28 @@ StartAgain:
             //
             if (!g_IgnoreNewLoggingMessages)
             {
-                ShowMessages("%s", MessagePacket->Message);
+                if (MessagePacket->OperationCode == OPERATION_LOG_EVENT_RECORD)
+                {
+                    //
+                    // Binary records of printf (deferred formatting) are
+                    // rendered by the formats of the script of the event
+                    //
+                    if (ScriptEngineWrapperRenderEventRecord((PDEBUGGER_EVENT_RECORD)MessagePacket->Message,
+                                                             LengthReceived - sizeof(DEBUGGER_REMOTE_PACKET) - sizeof(UINT32),
+                                                             RenderedEventRecord,
+                                                             sizeof(RenderedEventRecord)))
+                    {
+                        ShowMessages("%s", RenderedEventRecord);
+                    }
+                    else
+                    {
+                        ShowMessages("err, unable to render the record of the event\n");
+                    }
+                }
+                else
+                {
+                    ShowMessages("%s", MessagePacket->Message);
+                }
             }
 
             break;
@@ -447,6 +500,12 @@ StartAgain:
                              "cleared.\n",
                              FlushPacket->CountOfMessagesThatSetAsReadFromVmxNonRoot +
                                  FlushPacket->CountOfMessagesThatSetAsReadFromVmxRoot);
+
+                if (FlushPacket->CountOfDroppedMessages != 0)
+                {
+                    ShowMessages("warning, total %llu messages were dropped because the buffers were full\n",
+                                 FlushPacket->CountOfDroppedMessages);
+                }
             }
             else
             {
@@ -470,7 +529,14 @@ StartAgain:
             ScriptPacket = (DEBUGGEE_SCRIPT_PACKET *)(((CHAR *)TheActualPacket) +
                                                       sizeof(DEBUGGER_REMOTE_PACKET));
 
-            if (ScriptPacket->Result == DEBUGGER_OPERATION_WAS_SUCCESSFULL)
+            //
+            // Save the result, if the script is not cached in the debuggee then
+            // it's sent again without showing an error
+            //
+            g_ResultOfRunningScriptInDebuggee = ScriptPacket->Result;
+
+            if (ScriptPacket->Result == DEBUGGER_OPERATION_WAS_SUCCESSFULL ||
+                ScriptPacket->Result == DEBUGGER_ERROR_SCRIPT_IS_NOT_CACHED)
             {
                 //
                 // Nothing to do
@@ -744,87 +810,10 @@ StartAgain:
             break;
         case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_READING_MEMORY:
 
-            ReadMemoryPacket =
-                (DEBUGGER_READ_MEMORY *)(((CHAR *)TheActualPacket) +
-                                         sizeof(DEBUGGER_REMOTE_PACKET));
-
-            if (ReadMemoryPacket->KernelStatus ==
-                DEBUGGER_OPERATION_WAS_SUCCESSFULL)
-            {
-                //
-                // Show the result of reading memory like mem=0000000000018b01
-                //
-                MemoryBuffer = (unsigned char *)(((CHAR *)TheActualPacket) +
-                                                 sizeof(DEBUGGER_REMOTE_PACKET) +
-                                                 sizeof(DEBUGGER_READ_MEMORY));
-
-                if (ReadMemoryPacket->Style == DEBUGGER_SHOW_COMMAND_DISASSEMBLE64)
-                {
-                    //
-                    // Show diassembles
-                    //
-                    HyperDbgDisassembler64(MemoryBuffer, ReadMemoryPacket->Address, ReadMemoryPacket->ReturnLength, 0, FALSE, NULL);
-                }
-                else if (ReadMemoryPacket->Style ==
-                         DEBUGGER_SHOW_COMMAND_DISASSEMBLE32)
-                {
-                    //
-                    // Show diassembles
-                    //
-                    HyperDbgDisassembler32(MemoryBuffer, ReadMemoryPacket->Address, ReadMemoryPacket->ReturnLength, 0, FALSE, NULL);
-                }
-                else if (ReadMemoryPacket->Style == DEBUGGER_SHOW_COMMAND_DB)
-                {
-                    ShowMemoryCommandDB(
-                        MemoryBuffer,
-                        ReadMemoryPacket->Size,
-                        ReadMemoryPacket->Address,
-                        ReadMemoryPacket->MemoryType,
-                        ReadMemoryPacket->ReturnLength);
-                }
-                else if (ReadMemoryPacket->Style == DEBUGGER_SHOW_COMMAND_DC)
-                {
-                    ShowMemoryCommandDC(
-                        MemoryBuffer,
-                        ReadMemoryPacket->Size,
-                        ReadMemoryPacket->Address,
-                        ReadMemoryPacket->MemoryType,
-                        ReadMemoryPacket->ReturnLength);
-                }
-                else if (ReadMemoryPacket->Style == DEBUGGER_SHOW_COMMAND_DD)
-                {
-                    ShowMemoryCommandDD(
-                        MemoryBuffer,
-                        ReadMemoryPacket->Size,
-                        ReadMemoryPacket->Address,
-                        ReadMemoryPacket->MemoryType,
-                        ReadMemoryPacket->ReturnLength);
-                }
-                else if (ReadMemoryPacket->Style == DEBUGGER_SHOW_COMMAND_DQ)
-                {
-                    ShowMemoryCommandDQ(
-                        MemoryBuffer,
-                        ReadMemoryPacket->Size,
-                        ReadMemoryPacket->Address,
-                        ReadMemoryPacket->MemoryType,
-                        ReadMemoryPacket->ReturnLength);
-                }
-            }
-            else
-            {
-                ShowErrorMessage(ReadMemoryPacket->KernelStatus);
-            }
-
             //
-            // Signal the event relating to receiving result of reading registers
+            // Results of reading memory are matched with their pipelined
+            // requests, this result is not waited for anymore
             //
-            g_SyncronizationObjectsHandleTable
-                [DEBUGGER_SYNCRONIZATION_OBJECT_READ_MEMORY]
-                    .IsOnWaitingState = FALSE;
-            SetEvent(g_SyncronizationObjectsHandleTable
-                         [DEBUGGER_SYNCRONIZATION_OBJECT_READ_MEMORY]
-                             .EventHandle);
-
             break;
 
         case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_EDITING_MEMORY:
@@ -928,6 +917,68 @@ StartAgain:
 
             break;
 
+        case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_QUERYING_AGGREGATION_MAPS:
+
+            AggregationMapsPacket =
+                (DEBUGGEE_AGGREGATION_MAPS_PACKET *)(((CHAR *)TheActualPacket) +
+                                                     sizeof(DEBUGGER_REMOTE_PACKET));
+
+            g_KdAggregationMapsPacket = *AggregationMapsPacket;
+
+            if (AggregationMapsPacket->KernelStatus == DEBUGGER_OPERATION_WAS_SUCCESSFULL)
+            {
+                if (g_KdAggregationMapsResult != NULL &&
+                    AggregationMapsPacket->MapIndex < SCRIPT_ENGINE_AGGREGATION_MAXIMUM_MAPS &&
+                    AggregationMapsPacket->CountOfSentEntries <= DEBUGGEE_AGGREGATION_MAPS_ENTRIES_PER_PACKET)
+                {
+                    AggregationMap     = &g_KdAggregationMapsResult->Maps[AggregationMapsPacket->MapIndex];
+                    AggregationEntries = (SCRIPT_ENGINE_AGGREGATION_ENTRY *)(((CHAR *)AggregationMapsPacket) +
+                                                                             sizeof(DEBUGGEE_AGGREGATION_MAPS_PACKET));
+
+                    AggregationMap->Type                  = AggregationMapsPacket->Type;
+                    AggregationMap->CountOfEntries        = AggregationMapsPacket->CountOfEntries;
+                    AggregationMap->CountOfDroppedUpdates = AggregationMapsPacket->CountOfDroppedUpdates;
+
+                    //
+                    // The entries of the parts are put after each other, the
+                    // slots of the entries don't matter for showing them
+                    //
+                    AggregationEntryIndex = 0;
+
+                    for (UINT32 i = 0; i < AggregationMapsPacket->CountOfSentEntries; i++)
+                    {
+                        while (AggregationEntryIndex < SCRIPT_ENGINE_AGGREGATION_MAP_ENTRIES &&
+                               AggregationMap->Entries[AggregationEntryIndex].IsUsed)
+                        {
+                            AggregationEntryIndex++;
+                        }
+
+                        if (AggregationEntryIndex == SCRIPT_ENGINE_AGGREGATION_MAP_ENTRIES)
+                        {
+                            break;
+                        }
+
+                        AggregationMap->Entries[AggregationEntryIndex] = AggregationEntries[i];
+                    }
+                }
+            }
+            else
+            {
+                ShowErrorMessage(AggregationMapsPacket->KernelStatus);
+            }
+
+            //
+            // Signal the event relating to receiving result of querying the maps
+            //
+            g_SyncronizationObjectsHandleTable
+                [DEBUGGER_SYNCRONIZATION_OBJECT_QUERY_AGGREGATION_MAPS]
+                    .IsOnWaitingState = FALSE;
+            SetEvent(g_SyncronizationObjectsHandleTable
+                         [DEBUGGER_SYNCRONIZATION_OBJECT_QUERY_AGGREGATION_MAPS]
+                             .EventHandle);
+
+            break;
+
         default:
             ShowMessages("err, unknown packet action received from the debugger\n");
             break;
@@ -1021,6 +1072,25 @@ StartAgain:
 
         SerialBuffer[Loop] = ReadData;
 
+        //
+        // Check whether it's the header of a framed packet
+        //
+        if (Loop == sizeof(UINT32) - 1 && *(UINT32 *)SerialBuffer == SERIAL_FRAME_SIGNATURE)
+        {
+            if (!KdReceiveFrameThroughBuffer(g_SerialRemoteComPortHandle,
+                                             NULL,
+                                             &g_KdReceiveBuffer,
+                                             sizeof(BYTE),
+                                             SerialBuffer,
+                                             &Loop,
+                                             NULL))
+            {
+                goto StartAgain;
+            }
+
+            break;
+        }
+
         if (KdCheckForTheEndOfTheBuffer(&Loop, (BYTE *)SerialBuffer))
         {
             break;
@@ -1057,7 +1127,7 @@ StartAgain:
         //
         // Check checksum
         //
-        if (KdComputeDataChecksum((PVOID)&TheActualPacket->Indicator,
+        if (KdComputeDataChecksum((PVOID)((UINT64)TheActualPacket + 1),
                                   Loop - sizeof(BYTE)) !=
             TheActualPacket->Checksum)
         {
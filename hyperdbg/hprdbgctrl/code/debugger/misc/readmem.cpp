@@ -45,15 +45,7 @@ HyperDbgReadMemoryAndDisassemble(DEBUGGER_SHOW_MEMORY_STYLE Style,
     ReadMem.ReadingType = ReadingType;
     ReadMem.Style       = Style;
 
-    //
-    // send the request
-    //
-    if (g_IsSerialConnectedToRemoteDebuggee)
-    {
-        KdSendReadMemoryPacketToDebuggee(&ReadMem);
-        return;
-    }
-    else if (!g_DeviceHandle)
+    if (!g_IsSerialConnectedToRemoteDebuggee && !g_DeviceHandle)
     {
         ShowMessages("handle of the driver not found, probably the driver is not loaded. Did you "
                      "use 'load' command?\n");
@@ -67,21 +59,47 @@ HyperDbgReadMemoryAndDisassemble(DEBUGGER_SHOW_MEMORY_STYLE Style,
 
     ZeroMemory(OutputBuffer, Size);
 
-    Status = DeviceIoControl(g_DeviceHandle,              // Handle to device
-                             IOCTL_DEBUGGER_READ_MEMORY,  // IO Control code
-                             &ReadMem,                    // Input Buffer to driver.
-                             SIZEOF_DEBUGGER_READ_MEMORY, // Input buffer length
-                             OutputBuffer,                // Output Buffer from driver.
-                             Size,                        // Length of output buffer in bytes.
-                             &ReturnedLength,             // Bytes placed in buffer.
-                             NULL                         // synchronous call
-    );
-
-    if (!Status)
+    //
+    // send the request
+    //
+    if (g_IsSerialConnectedToRemoteDebuggee)
     {
-        ShowMessages("ioctl failed with code 0x%x\n", GetLastError());
-        free(OutputBuffer);
-        return;
+        //
+        // Large reads are sent to the debuggee as pipelined requests
+        //
+        if (!KdSendReadMemoryPacketToDebuggee(&ReadMem, OutputBuffer))
+        {
+            free(OutputBuffer);
+            return;
+        }
+
+        if (ReadMem.KernelStatus != DEBUGGER_OPERATION_WAS_SUCCESSFULL)
+        {
+            ShowErrorMessage(ReadMem.KernelStatus);
+            free(OutputBuffer);
+            return;
+        }
+
+        ReturnedLength = ReadMem.ReturnLength;
+    }
+    else
+    {
+        Status = DeviceIoControl(g_DeviceHandle,              // Handle to device
+                                 IOCTL_DEBUGGER_READ_MEMORY,  // IO Control code
+                                 &ReadMem,                    // Input Buffer to driver.
+                                 SIZEOF_DEBUGGER_READ_MEMORY, // Input buffer length
+                                 OutputBuffer,                // Output Buffer from driver.
+                                 Size,                        // Length of output buffer in bytes.
+                                 &ReturnedLength,             // Bytes placed in buffer.
+                                 NULL                         // synchronous call
+        );
+
+        if (!Status)
+        {
+            ShowMessages("ioctl failed with code 0x%x\n", GetLastError());
+            free(OutputBuffer);
+            return;
+        }
     }
 
     if (Style == DEBUGGER_SHOW_COMMAND_DB)
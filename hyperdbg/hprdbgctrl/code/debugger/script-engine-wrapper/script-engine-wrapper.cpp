@@ -21,8 +21,14 @@
 //
 // Global Variables
 //
-extern UINT64 * g_ScriptGlobalVariables;
-extern UINT64 * g_ScriptLocalVariables;
+extern UINT64 *                        g_ScriptGlobalVariables;
+extern UINT64 *                        g_ScriptLocalVariables;
+extern PSCRIPT_ENGINE_AGGREGATION_MAPS g_ScriptAggregationMaps;
+extern std::map<UINT64, vector<SYMBOL>> g_EventRecordFormats;
+
+extern std::map<UINT64, SCRIPT_ENGINE_COMPILE_CACHE_ENTRY> g_ScriptCompileCache;
+extern std::vector<SCRIPT_ENGINE_COMPILE_CACHE_ENTRY>      g_ScriptCompileCacheStaleEntries;
+extern UINT64                                              g_ScriptCompileCacheUseCounter;
 
 //
 // *********************** Pdb parse wrapper ***********************
@@ -54,6 +60,11 @@ ScriptEngineConvertNameToAddressWrapper(const char * FunctionOrVariableName, PBO
 UINT32
 ScriptEngineLoadFileSymbolWrapper(UINT64 BaseAddress, const char * PdbFileName)
 {
+    //
+    // Compiled scripts might contain the addresses of the previous symbols
+    //
+    ScriptEngineWrapperInvalidateCompileCache();
+
     return ScriptEngineLoadFileSymbol(BaseAddress, PdbFileName);
 }
 
@@ -78,6 +89,8 @@ ScriptEngineSetTextMessageCallbackWrapper(PVOID Handler)
 UINT32
 ScriptEngineUnloadAllSymbolsWrapper()
 {
+    ScriptEngineWrapperInvalidateCompileCache();
+
     return ScriptEngineUnloadAllSymbols();
 }
 
@@ -90,6 +103,8 @@ ScriptEngineUnloadAllSymbolsWrapper()
 UINT32
 ScriptEngineUnloadModuleSymbolWrapper(char * ModuleName)
 {
+    ScriptEngineWrapperInvalidateCompileCache();
+
     return ScriptEngineUnloadModuleSymbol(ModuleName);
 }
 
@@ -168,6 +183,8 @@ ScriptEngineSymbolInitLoadWrapper(PMODULE_SYMBOL_DETAIL BufferToStoreDetails,
                                   const char *          SymbolPath,
                                   BOOLEAN               IsSilentLoad)
 {
+    ScriptEngineWrapperInvalidateCompileCache();
+
     return ScriptEngineSymbolInitLoad(BufferToStoreDetails, StoredLength, DownloadIfAvailable, SymbolPath, IsSilentLoad);
 }
 
@@ -207,6 +224,9 @@ ScriptEngineConvertFileToPdbFileAndGuidAndAgeDetailsWrapper(const char * LocalFi
 
 /**
  * @brief ScriptEngineParse wrapper
+ * @details if the same script is compiled before, the compiled buffer
+ * is returned from the compile cache, the buffer should be removed by
+ * ScriptEngineWrapperRemoveSymbolBuffer in both cases
  *
  * @param Expr
  * @param ShowErrorMessageIfAny
@@ -217,6 +237,22 @@ PVOID
 ScriptEngineParseWrapper(char * Expr, BOOLEAN ShowErrorMessageIfAny)
 {
     PSYMBOL_BUFFER SymbolBuffer;
+    UINT64         Hash = HashBuffer(Expr, (UINT32)strlen(Expr), 0);
+
+    //
+    // Check whether the script is compiled before or not, the text is also
+    // compared as two scripts might have the same hash
+    //
+    auto Entry = g_ScriptCompileCache.find(Hash);
+
+    if (Entry != g_ScriptCompileCache.end() && !Entry->second.Script.compare(Expr))
+    {
+        Entry->second.CountOfReferences++;
+        Entry->second.LastUse = ++g_ScriptCompileCacheUseCounter;
+
+        return Entry->second.CodeBuffer;
+    }
+
     SymbolBuffer = ScriptEngineParse(Expr);
 
     //
@@ -224,6 +260,11 @@ ScriptEngineParseWrapper(char * Expr, BOOLEAN ShowErrorMessageIfAny)
     //
     if (SymbolBuffer->Message == NULL)
     {
+        //
+        // Only the scripts without error are kept
+        //
+        ScriptEngineWrapperAddToCompileCache(Hash, Expr, SymbolBuffer);
+
         return SymbolBuffer;
     }
     else
@@ -240,6 +281,86 @@ ScriptEngineParseWrapper(char * Expr, BOOLEAN ShowErrorMessageIfAny)
     }
 }
 
+/**
+ * @brief Add a compiled script to the compile cache
+ * @details if the cache is full, the least recently used script that
+ * is not used anymore is removed, if all of the scripts are used, then
+ * the new script is not kept
+ *
+ * @param Hash Hash of the text of the script
+ * @param Expr
+ * @param CodeBuffer
+ * 
+ * @return VOID
+ */
+VOID
+ScriptEngineWrapperAddToCompileCache(UINT64 Hash, char * Expr, PSYMBOL_BUFFER CodeBuffer)
+{
+    SCRIPT_ENGINE_COMPILE_CACHE_ENTRY Entry = {};
+
+    //
+    // Another script with the same hash is in the cache
+    //
+    if (g_ScriptCompileCache.find(Hash) != g_ScriptCompileCache.end())
+    {
+        return;
+    }
+
+    if (g_ScriptCompileCache.size() >= SCRIPT_ENGINE_COMPILE_CACHE_MAXIMUM_ENTRIES)
+    {
+        auto LeastRecentlyUsed = g_ScriptCompileCache.end();
+
+        for (auto It = g_ScriptCompileCache.begin(); It != g_ScriptCompileCache.end(); ++It)
+        {
+            if (It->second.CountOfReferences == 0 &&
+                (LeastRecentlyUsed == g_ScriptCompileCache.end() || It->second.LastUse < LeastRecentlyUsed->second.LastUse))
+            {
+                LeastRecentlyUsed = It;
+            }
+        }
+
+        if (LeastRecentlyUsed == g_ScriptCompileCache.end())
+        {
+            return;
+        }
+
+        RemoveSymbolBuffer(LeastRecentlyUsed->second.CodeBuffer);
+        g_ScriptCompileCache.erase(LeastRecentlyUsed);
+    }
+
+    Entry.Script            = Expr;
+    Entry.CodeBuffer        = CodeBuffer;
+    Entry.CountOfReferences = 1;
+    Entry.LastUse           = ++g_ScriptCompileCacheUseCounter;
+
+    g_ScriptCompileCache[Hash] = Entry;
+}
+
+/**
+ * @brief Remove all of the compiled scripts from the compile cache
+ * @details the scripts that are still used are freed when they're
+ * removed by their users
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineWrapperInvalidateCompileCache()
+{
+    for (auto & Entry : g_ScriptCompileCache)
+    {
+        if (Entry.second.CountOfReferences == 0)
+        {
+            RemoveSymbolBuffer(Entry.second.CodeBuffer);
+        }
+        else
+        {
+            g_ScriptCompileCacheStaleEntries.push_back(Entry.second);
+        }
+    }
+
+    g_ScriptCompileCache.clear();
+}
+
 /**
  * @brief PrintSymbolBuffer wrapper
  * @details Print symbol buffer wrapper
@@ -287,9 +408,19 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
     }
 
     //
-    // Run Parser
+    // Allocate aggregation maps holder, the same as local variables, one
+    // set of maps is enough as user-mode scripts run on one thread
     //
-    PSYMBOL_BUFFER CodeBuffer = ScriptEngineParse((char *)Expr.c_str());
+    if (!g_ScriptAggregationMaps)
+    {
+        g_ScriptAggregationMaps = (PSCRIPT_ENGINE_AGGREGATION_MAPS)malloc(sizeof(SCRIPT_ENGINE_AGGREGATION_MAPS));
+        RtlZeroMemory(g_ScriptAggregationMaps, sizeof(SCRIPT_ENGINE_AGGREGATION_MAPS));
+    }
+
+    //
+    // Run Parser (the error message is shown by the wrapper)
+    //
+    PSYMBOL_BUFFER CodeBuffer = (PSYMBOL_BUFFER)ScriptEngineParseWrapper((char *)Expr.c_str(), TRUE);
 
     //
     // Print symbol buffer
@@ -299,49 +430,67 @@ ScriptEngineEvalWrapper(PGUEST_REGS GuestRegs,
     UINT64        g_TempList[MAX_TEMP_COUNT] = {0};
     ACTION_BUFFER ActionBuffer               = {0};
     SYMBOL        ErrorSymbol                = {0};
+    BOOL          HasError                   = FALSE;
 
-    if (CodeBuffer->Message == NULL)
+    if (CodeBuffer != NULL)
     {
-        for (int i = 0; i < CodeBuffer->Pointer;)
-        {
-            //
-            // Fill the action buffer but as we're in user-mode here
-            // then there is nothing to fill
-            //
-            ActionBuffer.Context                   = NULL;
-            ActionBuffer.CurrentAction             = NULL;
-            ActionBuffer.ImmediatelySendTheResults = FALSE;
-            ActionBuffer.Tag                       = NULL;
+        //
+        // Fill the action buffer but as we're in user-mode here
+        // then there is nothing to fill
+        //
+        ActionBuffer.Context                   = NULL;
+        ActionBuffer.CurrentAction             = NULL;
+        ActionBuffer.ImmediatelySendTheResults = FALSE;
+        ActionBuffer.Tag                       = NULL;
 
-            //
-            // Fill the variables list for this run
-            //
-            VariablesList.TempList            = g_TempList;
-            VariablesList.GlobalVariablesList = g_ScriptGlobalVariables;
-            VariablesList.LocalVariablesList  = g_ScriptLocalVariables;
+        //
+        // Fill the variables list for this run
+        //
+        VariablesList.TempList            = g_TempList;
+        VariablesList.GlobalVariablesList = g_ScriptGlobalVariables;
+        VariablesList.LocalVariablesList  = g_ScriptLocalVariables;
+        VariablesList.AggregationMaps     = g_ScriptAggregationMaps;
 
-            //
-            // If has error, show error message and abort.
-            //
-            if (ScriptEngineExecute(GuestRegs, ActionBuffer, &VariablesList, CodeBuffer, &i, &ErrorSymbol) == TRUE)
+        //
+        // Run the script the same way as the debuggee, if it can be lowered
+        // to the bytecode, then the bytecode is used
+        //
+        PSCRIPT_ENGINE_BYTECODE Bytecode = (PSCRIPT_ENGINE_BYTECODE)malloc(SCRIPT_ENGINE_BYTECODE_SIZE(CodeBuffer->Pointer));
+
+        if (Bytecode != NULL && ScriptEngineLowerToBytecode(CodeBuffer, Bytecode))
+        {
+            HasError = ScriptEngineExecuteBytecode(GuestRegs, ActionBuffer, &VariablesList, CodeBuffer, Bytecode, &ErrorSymbol);
+        }
+        else
+        {
+            for (int i = 0; i < CodeBuffer->Pointer;)
             {
-                CHAR NameOfOperator[MAX_FUNCTION_NAME_LENGTH] = {0};
-
-                ScriptEngineGetOperatorName(&ErrorSymbol, NameOfOperator);
-                ShowMessages("invalid returning address for operator: %s",
-                             NameOfOperator);
-                g_CurrentExprEvalResultHasError = TRUE;
-                g_CurrentExprEvalResult         = NULL;
-                break;
+                if (ScriptEngineExecute(GuestRegs, ActionBuffer, &VariablesList, CodeBuffer, &i, &ErrorSymbol) == TRUE)
+                {
+                    HasError = TRUE;
+                    break;
+                }
             }
         }
-    }
-    else
-    {
-        ShowMessages("%s\n", CodeBuffer->Message);
-    }
 
-    // RemoveSymbolBuffer(CodeBuffer);
+        free(Bytecode);
+
+        //
+        // If has error, show error message
+        //
+        if (HasError)
+        {
+            CHAR NameOfOperator[MAX_FUNCTION_NAME_LENGTH] = {0};
+
+            ScriptEngineGetOperatorName(&ErrorSymbol, NameOfOperator);
+            ShowMessages("invalid returning address for operator: %s",
+                         NameOfOperator);
+            g_CurrentExprEvalResultHasError = TRUE;
+            g_CurrentExprEvalResult         = NULL;
+        }
+
+        ScriptEngineWrapperRemoveSymbolBuffer(CodeBuffer);
+    }
 
     return;
 }
@@ -378,6 +527,221 @@ ScriptAutomaticStatementsTestWrapper(string Expr, UINT64 ExpectationValue, BOOLE
     return FALSE;
 }
 
+/**
+ * @brief Keep the formats (symbols of the script) of an event that its
+ * printf sends binary records (deferred formatting)
+ *
+ * @param Tag Tag of the event
+ * @param ScriptBuffer Symbols of the script
+ * @param CountOfSymbols
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineWrapperRegisterEventRecordFormats(UINT64 Tag, PVOID ScriptBuffer, UINT32 CountOfSymbols)
+{
+    PSYMBOL Symbols = (PSYMBOL)ScriptBuffer;
+
+    g_EventRecordFormats[Tag].assign(Symbols, Symbols + CountOfSymbols);
+}
+
+/**
+ * @brief Render a binary record of printf (deferred formatting) by
+ * the format string in the script of its event
+ *
+ * @param Record
+ * @param RecordLength
+ * @param FinalBuffer
+ * @param SizeOfFinalBuffer
+ *
+ * @return BOOLEAN Whether the record is rendered or not
+ */
+BOOLEAN
+ScriptEngineWrapperRenderEventRecord(PDEBUGGER_EVENT_RECORD Record,
+                                     UINT32                 RecordLength,
+                                     CHAR *                 FinalBuffer,
+                                     UINT32                 SizeOfFinalBuffer)
+{
+    UINT32   CurrentPositionInFinalBuffer = 0;
+    UINT32   CurrentPositionInFormat      = 0;
+    UINT32   LenOfFormat;
+    UINT32   IndexOfArgCount;
+    UINT32   Position;
+    UINT32   FormatSpecifier;
+    UINT32   FormatSpecifierLength;
+    UINT32   Offset;
+    UINT32   Length;
+    UINT64 * Arguments;
+    CHAR *   Strings;
+    CHAR *   Format;
+    WCHAR    WideChar;
+    CHAR     NumberBuffer[24];
+
+    if (RecordLength < sizeof(DEBUGGER_EVENT_RECORD) ||
+        RecordLength < sizeof(DEBUGGER_EVENT_RECORD) + Record->CountOfArguments * sizeof(UINT64) + Record->SizeOfStrings)
+    {
+        return FALSE;
+    }
+
+    Arguments = (UINT64 *)((CHAR *)Record + sizeof(DEBUGGER_EVENT_RECORD));
+    Strings   = (CHAR *)&Arguments[Record->CountOfArguments];
+
+    //
+    // Find the formats of the event
+    //
+    auto Formats = g_EventRecordFormats.find(Record->Tag);
+
+    if (Formats == g_EventRecordFormats.end())
+    {
+        return FALSE;
+    }
+
+    vector<SYMBOL> & Symbols = Formats->second;
+
+    //
+    // The id of the format is the index of the format string, which is
+    // after printf and before the count of the arguments
+    //
+    if (Record->FormatId == 0 ||
+        Record->FormatId >= Symbols.size() ||
+        Symbols[Record->FormatId - 1].Type != SYMBOL_SEMANTIC_RULE_TYPE ||
+        Symbols[Record->FormatId - 1].Value != FUNC_PRINTF)
+    {
+        return FALSE;
+    }
+
+    Format          = (CHAR *)&Symbols[Record->FormatId].Value;
+    LenOfFormat     = (UINT32)strnlen(Format, (Symbols.size() - Record->FormatId) * sizeof(SYMBOL) - sizeof(UINT64));
+    IndexOfArgCount = Record->FormatId + 1 + (UINT32)((sizeof(UINT64) + LenOfFormat) / sizeof(SYMBOL));
+
+    if (IndexOfArgCount + Record->CountOfArguments >= Symbols.size() ||
+        Symbols[IndexOfArgCount].Type != SYMBOL_VARIABLE_COUNT_TYPE ||
+        Symbols[IndexOfArgCount].Value != Record->CountOfArguments)
+    {
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < Record->CountOfArguments; i++)
+    {
+        //
+        // The kind, the position and the length of the format specifiers
+        // are the same as the ones that are used for rendering the texts
+        //
+        PSYMBOL Symbol = &Symbols[IndexOfArgCount + 1 + i];
+
+        Position              = (UINT32)(Symbol->Type >> SYMBOL_PRINTF_POSITION_SHIFT) & SYMBOL_PRINTF_POSITION_MASK;
+        FormatSpecifier       = (UINT32)(Symbol->Type >> SYMBOL_PRINTF_FORMAT_SHIFT) & SYMBOL_PRINTF_FORMAT_MASK;
+        FormatSpecifierLength = (UINT32)(Symbol->Type >> SYMBOL_PRINTF_LENGTH_SHIFT) & SYMBOL_PRINTF_LENGTH_MASK;
+
+        if (FormatSpecifier == PRINTF_FORMAT_INVALID)
+        {
+            continue;
+        }
+
+        if (FormatSpecifier > PRINTF_FORMAT_WSTRING ||
+            Position < CurrentPositionInFormat ||
+            Position + FormatSpecifierLength > LenOfFormat)
+        {
+            return FALSE;
+        }
+
+        //
+        // Move the string before this format specifier to the buffer
+        //
+        Length = Position - CurrentPositionInFormat;
+
+        if (CurrentPositionInFinalBuffer + Length < SizeOfFinalBuffer)
+        {
+            memcpy(&FinalBuffer[CurrentPositionInFinalBuffer], &Format[CurrentPositionInFormat], Length);
+            CurrentPositionInFinalBuffer += Length;
+        }
+
+        CurrentPositionInFormat = Position + FormatSpecifierLength;
+
+        if (FormatSpecifier == PRINTF_FORMAT_STRING || FormatSpecifier == PRINTF_FORMAT_WSTRING)
+        {
+            //
+            // The bytes of the strings are copied to the record
+            //
+            Offset = DEBUGGER_EVENT_RECORD_STRING_OFFSET(Arguments[i]);
+            Length = DEBUGGER_EVENT_RECORD_STRING_LENGTH(Arguments[i]);
+
+            if ((UINT64)Offset + Length > Record->SizeOfStrings)
+            {
+                return FALSE;
+            }
+
+            if (FormatSpecifier == PRINTF_FORMAT_WSTRING)
+            {
+                Length = Length / sizeof(WCHAR);
+            }
+
+            if (CurrentPositionInFinalBuffer + Length >= SizeOfFinalBuffer)
+            {
+                //
+                // Over passed buffer
+                //
+                continue;
+            }
+
+            if (FormatSpecifier == PRINTF_FORMAT_STRING)
+            {
+                memcpy(&FinalBuffer[CurrentPositionInFinalBuffer], &Strings[Offset], Length);
+                CurrentPositionInFinalBuffer += Length;
+                continue;
+            }
+
+            //
+            // Wide-chars are converted like WcharToChar
+            //
+            for (UINT32 j = 0; j < Length; j++)
+            {
+                memcpy(&WideChar, &Strings[Offset + j * sizeof(WCHAR)], sizeof(WCHAR));
+
+                if (WideChar == L'\0')
+                {
+                    break;
+                }
+
+                FinalBuffer[CurrentPositionInFinalBuffer++] = WideChar < 128 ? (CHAR)WideChar : '?';
+
+                if (WideChar >= 0xD800 && WideChar <= 0xD8FF)
+                {
+                    //
+                    // Lead surrogate, skip the next code unit, which is the trail
+                    //
+                    j++;
+                }
+            }
+        }
+        else
+        {
+            Length = ScriptEngineFormatNumber(FormatSpecifier, Arguments[i], NumberBuffer);
+
+            if (CurrentPositionInFinalBuffer + Length < SizeOfFinalBuffer)
+            {
+                memcpy(&FinalBuffer[CurrentPositionInFinalBuffer], NumberBuffer, Length);
+                CurrentPositionInFinalBuffer += Length;
+            }
+        }
+    }
+
+    //
+    // Move the string after the last format specifier to the buffer
+    //
+    Length = LenOfFormat - CurrentPositionInFormat;
+
+    if (CurrentPositionInFinalBuffer + Length < SizeOfFinalBuffer)
+    {
+        memcpy(&FinalBuffer[CurrentPositionInFinalBuffer], &Format[CurrentPositionInFormat], Length);
+        CurrentPositionInFinalBuffer += Length;
+    }
+
+    FinalBuffer[CurrentPositionInFinalBuffer] = '\0';
+
+    return TRUE;
+}
+
 /**
  * @brief test parser
  * @param Expr
@@ -494,6 +858,9 @@ ScriptEngineWrapperGetPointer(PVOID SymbolBuffer)
 
 /**
  * @brief wrapper for removing symbol buffer 
+ * @details the buffers of the compile cache are kept for the next
+ * parses of the same script
+ *
  * @param SymbolBuffer
  * 
  * @return UINT32
@@ -501,5 +868,27 @@ ScriptEngineWrapperGetPointer(PVOID SymbolBuffer)
 VOID
 ScriptEngineWrapperRemoveSymbolBuffer(PVOID SymbolBuffer)
 {
+    for (auto & Entry : g_ScriptCompileCache)
+    {
+        if (Entry.second.CodeBuffer == SymbolBuffer)
+        {
+            Entry.second.CountOfReferences--;
+            return;
+        }
+    }
+
+    for (auto It = g_ScriptCompileCacheStaleEntries.begin(); It != g_ScriptCompileCacheStaleEntries.end(); ++It)
+    {
+        if (It->CodeBuffer == SymbolBuffer)
+        {
+            if (--It->CountOfReferences == 0)
+            {
+                RemoveSymbolBuffer(It->CodeBuffer);
+                g_ScriptCompileCacheStaleEntries.erase(It);
+            }
+            return;
+        }
+    }
+
     RemoveSymbolBuffer((PSYMBOL_BUFFER)SymbolBuffer);
 }
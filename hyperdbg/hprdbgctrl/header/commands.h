@@ -211,6 +211,9 @@ typedef std::map<std::string, COMMAND_DETAIL> CommandType;
 #define DEBUGGER_COMMAND_FLUSH_ATTRIBUTES \
     DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
 
+#define DEBUGGER_COMMAND_MAP_ATTRIBUTES \
+    DEBUGGER_COMMAND_ATTRIBUTE_LOCAL_COMMAND_IN_DEBUGGER_MODE
+
 #define DEBUGGER_COMMAND_PAUSE_ATTRIBUTES \
     DEBUGGER_COMMAND_ATTRIBUTE_ABSOLUTE_LOCAL
 
@@ -480,6 +483,9 @@ CommandSettings(vector<string> SplittedCommand, string Command);
 VOID
 CommandFlush(vector<string> SplittedCommand, string Command);
 
+VOID
+CommandMap(vector<string> SplittedCommand, string Command);
+
 VOID
 CommandPause(vector<string> SplittedCommand, string Command);
 
@@ -79,6 +79,9 @@ GetConfigFilePath(PWCHAR ConfigPath);
 BOOLEAN
 IsEmptyString(char * Text);
 
+UINT64
+HashBuffer(const VOID * Buffer, UINT32 Length, UINT64 Hash);
+
 //////////////////////////////////////////////////
 //            	    Structures                  //
 //////////////////////////////////////////////////
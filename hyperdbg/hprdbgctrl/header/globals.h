@@ -128,6 +128,61 @@ BYTE g_EndOfBufferCheckSerial[SERIAL_END_OF_BUFFER_CHARS_COUNT] = {
     SERIAL_END_OF_BUFFER_CHAR_3,
     SERIAL_END_OF_BUFFER_CHAR_4};
 
+/**
+ * @brief The bytes that are received from the remote system
+ * but not parsed yet
+ *
+ */
+KD_RECEIVE_BUFFER g_KdReceiveBuffer = {0};
+
+/**
+ * @brief Framing of the packets that are sent to the debuggee, the
+ * framed packets are sent if the debuggee supports them
+ *
+ */
+UINT32 g_SerialFramingVersion = SERIAL_FRAMING_VERSION_END_OF_BUFFER;
+
+/**
+ * @brief Sequence number of the last request that is sent to
+ * the debuggee
+ *
+ */
+UINT32 g_KdSequenceNumber = 0;
+
+/**
+ * @brief The pages that are read from the debuggee while it's
+ * paused
+ *
+ */
+KD_PAGE_CACHE g_KdPageCache = {0};
+
+/**
+ * @brief Requests that are sent to the debuggee and their responses
+ * are kept by the listening thread (pipelined requests)
+ *
+ */
+KD_PENDING_REQUEST g_KdPendingRequests[SERIAL_MAXIMUM_PIPELINED_REQUESTS] = {0};
+
+/**
+ * @brief Table of CRC32 (Castagnoli) for the processors that
+ * don't support SSE4.2
+ *
+ */
+UINT32 g_Crc32Table[256] = {0};
+
+/**
+ * @brief Shows whether the table of CRC32 is initialized and the
+ * crc32 instruction is checked or not
+ *
+ */
+BOOLEAN g_Crc32IsInitialized = FALSE;
+
+/**
+ * @brief Shows whether the crc32 instruction (SSE4.2) is supported
+ *
+ */
+BOOLEAN g_Crc32IsHardwareSupported = FALSE;
+
 /**
  * @brief In debugger (not debuggee), we save the handle
  * of the user-mode listening thread for pauses here
@@ -267,6 +322,41 @@ UINT64 * g_ScriptGlobalVariables;
  */
 UINT64 * g_ScriptLocalVariables;
 
+/**
+ * @brief Holder of aggregation maps for script engine
+ *
+ */
+PSCRIPT_ENGINE_AGGREGATION_MAPS g_ScriptAggregationMaps;
+
+/**
+ * @brief Symbols of the scripts of the events that send binary records
+ * of printf (deferred formatting), the formats of the records are in the
+ * symbols
+ *
+ */
+std::map<UINT64, std::vector<SYMBOL>> g_EventRecordFormats;
+
+/**
+ * @brief Compiled scripts (symbol buffers) that are kept to avoid parsing
+ * the same script again, the key is the hash of the text of the script
+ *
+ */
+std::map<UINT64, SCRIPT_ENGINE_COMPILE_CACHE_ENTRY> g_ScriptCompileCache;
+
+/**
+ * @brief Compiled scripts that are removed from the compile cache (e.g.,
+ * symbols are changed) while they're still used
+ *
+ */
+std::vector<SCRIPT_ENGINE_COMPILE_CACHE_ENTRY> g_ScriptCompileCacheStaleEntries;
+
+/**
+ * @brief Counter of the uses of the compile cache, used for finding
+ * the least recently used entry
+ *
+ */
+UINT64 g_ScriptCompileCacheUseCounter = 0;
+
 /**
  * @brief Is list of command initialized
  *
@@ -486,6 +576,22 @@ BOOLEAN g_AddressConversion = TRUE;
  */
 BOOLEAN g_AutoFlush = FALSE;
 
+/**
+ * @brief Whether the debuggee is requested to send its packets in
+ * compressed frames or not
+ * @details it is enabled by default
+ *
+ */
+BOOLEAN g_SerialCompression = TRUE;
+
+/**
+ * @brief Whether the pages that are read from the debuggee are
+ * cached (while the debuggee is paused) or not
+ * @details it is enabled by default
+ *
+ */
+BOOLEAN g_PageCacheIsEnabled = TRUE;
+
 /**
  * @brief Shows the syntax used in !u !u2 u u2 commands
  * @details INTEL = 1, ATT = 2, MASM = 3
@@ -531,3 +637,29 @@ UINT64 g_ResultOfEvaluatedExpression = NULL;
  *
  */
 UINT32 g_ErrorStateOfResultOfEvaluatedExpression = NULL;
+
+/**
+ * @brief Result of the last script that is sent to the debuggee
+ *
+ */
+UINT32 g_ResultOfRunningScriptInDebuggee = NULL;
+
+/**
+ * @brief Hashes of the scripts that are sent to the debuggee, the
+ * debuggee keeps these scripts so only their hashes are sent again
+ *
+ */
+std::vector<UINT64> g_ScriptsCachedInDebuggee;
+
+/**
+ * @brief The aggregation maps that are received from the debuggee
+ *
+ */
+PSCRIPT_ENGINE_AGGREGATION_MAPS g_KdAggregationMapsResult = NULL;
+
+/**
+ * @brief The last part of the aggregation maps that is received
+ * from the debuggee (without its entries)
+ *
+ */
+DEBUGGEE_AGGREGATION_MAPS_PACKET g_KdAggregationMapsPacket = {0};
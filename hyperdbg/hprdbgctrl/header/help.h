@@ -156,6 +156,9 @@ CommandSettingsHelp();
 VOID
 CommandFlushHelp();
 
+VOID
+CommandMapHelp();
+
 VOID
 CommandPauseHelp();
 
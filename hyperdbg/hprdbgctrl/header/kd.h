@@ -38,6 +38,77 @@ public:
     HKEY * operator&() { return &m_Key; }
 };
 
+//////////////////////////////////////////////////
+//			    	 Definitions                //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum time (milliseconds) that a read from the serial port
+ * of the debugger waits for the first byte before it returns
+ *
+ */
+#define KD_RECEIVE_BUFFER_READ_TIMEOUT 1000
+
+/**
+ * @brief Size of the pages that are kept in the page cache
+ *
+ */
+#define KD_PAGE_CACHE_PAGE_SIZE 0x1000
+
+/**
+ * @brief Count of the pages that are kept in the page cache
+ *
+ */
+#define KD_PAGE_CACHE_COUNT_OF_PAGES 0x100
+
+//////////////////////////////////////////////////
+//			    	 Structures                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A request that is sent to the debuggee without waiting for
+ * its response, the listening thread keeps the response here
+ *
+ */
+typedef struct _KD_PENDING_REQUEST
+{
+    volatile BOOLEAN                        IsPending; // the response is not received yet
+    UINT32                                  SequenceNumber;
+    DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION ResponseAction;
+    UINT32                                  Length; // length of the received response
+    BYTE                                    Buffer[MaxSerialPacketSize];
+
+} KD_PENDING_REQUEST, *PKD_PENDING_REQUEST;
+
+/**
+ * @brief A page of the memory of the debuggee that is read while
+ * the debuggee is paused
+ *
+ */
+typedef struct _KD_PAGE_CACHE_ENTRY
+{
+    BOOLEAN                   IsValid;
+    UINT32                    Pid;        // the address space of the page (virtual addresses)
+    DEBUGGER_READ_MEMORY_TYPE MemoryType; // physical or virtual
+    UINT64                    Address;    // address of the start of the page
+    BYTE                      Buffer[KD_PAGE_CACHE_PAGE_SIZE];
+
+} KD_PAGE_CACHE_ENTRY, *PKD_PAGE_CACHE_ENTRY;
+
+/**
+ * @brief The pages that are read from the debuggee, each page has
+ * one place in the cache (direct-mapped)
+ *
+ */
+typedef struct _KD_PAGE_CACHE
+{
+    KD_PAGE_CACHE_ENTRY Entries[KD_PAGE_CACHE_COUNT_OF_PAGES];
+    UINT64              CountOfHits;
+    UINT64              CountOfMisses;
+    UINT64              CountOfInvalidations;
+
+} KD_PAGE_CACHE, *PKD_PAGE_CACHE;
+
 //////////////////////////////////////////////////
 //			    	 Functions                  //
 //////////////////////////////////////////////////
@@ -57,6 +128,42 @@ KdCommandPacketAndBufferToDebuggee(
     CHAR *                                  Buffer,
     UINT32                                  BufferLength);
 
+BOOLEAN
+KdCommandPacketAndBufferWithSequenceNumberToDebuggee(
+    DEBUGGER_REMOTE_PACKET_TYPE             PacketType,
+    DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedAction,
+    UINT32                                  SequenceNumber,
+    CHAR *                                  Buffer,
+    UINT32                                  BufferLength);
+
+BOOLEAN
+KdSendPipelinedRequestToDebuggee(PKD_PENDING_REQUEST                     Request,
+                                 DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedAction,
+                                 DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION ResponseAction,
+                                 CHAR *                                  Buffer,
+                                 UINT32                                  BufferLength);
+
+BOOLEAN
+KdWaitForPipelinedRequest(PKD_PENDING_REQUEST Request);
+
+BOOLEAN
+KdCompletePipelinedRequest(PDEBUGGER_REMOTE_PACKET Packet, UINT32 Length);
+
+UINT32
+KdGetNextSequenceNumber();
+
+UINT32
+KdGetCountOfPipelinedRequests();
+
+BYTE
+KdGetPacketFlags();
+
+VOID
+KdInvalidatePageCache();
+
+UINT32
+KdGetCountOfCachedPages();
+
 VOID
 KdTheRemoteSystemIsRunning();
 
@@ -94,10 +201,16 @@ KdSendFlushPacketToDebuggee();
 BOOLEAN
 KdSendSymbolReloadPacketToDebuggee();
 
+BOOLEAN
+KdSendQueryAggregationMapsPacketToDebuggee(BOOLEAN ClearMaps, PSCRIPT_ENGINE_AGGREGATION_MAPS AggregationMaps);
+
 BOOLEAN KdSendReadRegisterPacketToDebuggee(PDEBUGGEE_REGISTER_READ_DESCRIPTION);
 
 BOOLEAN
-KdSendReadMemoryPacketToDebuggee(PDEBUGGER_READ_MEMORY);
+KdSendReadMemoryPacketToDebuggee(PDEBUGGER_READ_MEMORY ReadMem, PVOID Buffer);
+
+BOOLEAN
+KdSendReadMemoryChunksToDebuggee(PDEBUGGER_READ_MEMORY ReadMem, PVOID Buffer);
 
 BOOLEAN
 KdSendEditMemoryPacketToDebuggee(PDEBUGGER_EDIT_MEMORY EditMem, UINT32 Size);
@@ -123,6 +236,15 @@ BOOLEAN
 KdSendListOrModifyPacketToDebuggee(
     PDEBUGGEE_BP_LIST_OR_MODIFY_PACKET ListOrModifyPacket);
 
+UINT64
+KdGetScriptHash(UINT64 BufferAddress, UINT32 BufferLength, UINT32 Pointer);
+
+BOOLEAN
+KdIsScriptCachedInDebuggee(UINT64 ScriptHash);
+
+VOID
+KdUpdateScriptsCachedInDebuggee(UINT64 ScriptHash, UINT32 BufferLength, BOOLEAN IsCached);
+
 BOOLEAN
 KdSendScriptPacketToDebuggee(UINT64 BufferAddress, UINT32 BufferLength, UINT32 Pointer, BOOLEAN IsFormat);
 
@@ -11,6 +11,34 @@
  */
 #pragma once
 
+//////////////////////////////////////////////////
+//            	    Definitions                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum number of compiled scripts that are kept in the
+ * compile cache
+ *
+ */
+#define SCRIPT_ENGINE_COMPILE_CACHE_MAXIMUM_ENTRIES 64
+
+//////////////////////////////////////////////////
+//            	    Structures                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief A compiled script in the compile cache
+ *
+ */
+typedef struct _SCRIPT_ENGINE_COMPILE_CACHE_ENTRY
+{
+    std::string    Script;
+    PSYMBOL_BUFFER CodeBuffer;
+    UINT32         CountOfReferences; // users that didn't remove the buffer yet
+    UINT64         LastUse;
+
+} SCRIPT_ENGINE_COMPILE_CACHE_ENTRY, *PSCRIPT_ENGINE_COMPILE_CACHE_ENTRY;
+
 //////////////////////////////////////////////////
 //    Pdb Parser Wrapper (from script-engine)   //
 //////////////////////////////////////////////////
@@ -66,9 +94,24 @@ ScriptEngineWrapperTestParser(string Expr);
 BOOLEAN
 ScriptAutomaticStatementsTestWrapper(string Expr, UINT64 ExpectationValue, BOOLEAN ExceptError);
 
+VOID
+ScriptEngineWrapperRegisterEventRecordFormats(UINT64 Tag, PVOID ScriptBuffer, UINT32 CountOfSymbols);
+
+BOOLEAN
+ScriptEngineWrapperRenderEventRecord(PDEBUGGER_EVENT_RECORD Record,
+                                     UINT32                 RecordLength,
+                                     CHAR *                 FinalBuffer,
+                                     UINT32                 SizeOfFinalBuffer);
+
 PVOID
 ScriptEngineParseWrapper(char * Expr, BOOLEAN ShowErrorMessageIfAny);
 
+VOID
+ScriptEngineWrapperAddToCompileCache(UINT64 Hash, char * Expr, PSYMBOL_BUFFER CodeBuffer);
+
+VOID
+ScriptEngineWrapperInvalidateCompileCache();
+
 VOID
 PrintSymbolBufferWrapper(PVOID SymbolBuffer);
 
@@ -72,6 +72,7 @@
 #    include "ScriptEngineCommonDefinitions.h"
 #    include "Configuration.h"
 #    include "Definition.h"
+#    include "KdReceive.h"
 #    include "header/inipp.h"
 #    include "header/commands.h"
 #    include "header/common.h"
@@ -10,6 +10,7 @@
  * 
  */
 #include "..\hprdbghv\pch.h"
+#include "LogBuffers.h"
 #include "Logging.tmh"
 
 /**
@@ -20,11 +21,15 @@
 BOOLEAN
 LogInitialize()
 {
+    UINT32 BufferSize;
+
+    LogProcessorCount = KeQueryActiveProcessorCount(0);
+
     //
     // Initialize buffers for trace message and data messages
-    //(we have two buffers one for vmx root and one for vmx non-root)
+    // (each core has two buffers one for vmx root and one for vmx non-root)
     //
-    MessageBufferInformation = ExAllocatePoolWithTag(NonPagedPool, sizeof(LOG_BUFFER_INFORMATION) * 2, POOLTAG);
+    MessageBufferInformation = ExAllocatePoolWithTag(NonPagedPool, sizeof(LOG_BUFFER_INFORMATION) * 2 * LogProcessorCount, POOLTAG);
 
     if (!MessageBufferInformation)
     {
@@ -34,34 +39,79 @@ LogInitialize()
     //
     // Zeroing the memory
     //
-    RtlZeroMemory(MessageBufferInformation, sizeof(LOG_BUFFER_INFORMATION) * 2);
+    RtlZeroMemory(MessageBufferInformation, sizeof(LOG_BUFFER_INFORMATION) * 2 * LogProcessorCount);
+
+    //
+    // Initialize the lock of readers
+    //
+    KeInitializeSpinLock(&LogReaderLock);
+
+    LogVmxNonRootTimeStamp = 0;
 
     //
-    // Initialize the lock for Vmx-root mode (HIGH_IRQL Spinlock)
+    // The storage of each pool is shared between cores, the size is
+    // aligned so records never cross the end of the buffer
     //
-    VmxRootLoggingLock = 0;
+    BufferSize = LogBufferSize / LogProcessorCount;
+
+    if (BufferSize < MinimumLogBufferSizePerCore)
+    {
+        BufferSize = MinimumLogBufferSizePerCore;
+    }
+
+    //
+    // Buffers, the control page and the reader page might be mapped to
+    // user-mode, so they are page-aligned and don't share their pages with
+    // other allocations
+    //
+    BufferSize &= ~(PAGE_SIZE - 1);
+
+    LogBuffersSize             = BufferSize * 2 * LogProcessorCount;
+    LogSharedBuffersHeaderSize = ROUND_TO_PAGES(FIELD_OFFSET(LOG_SHARED_BUFFERS_HEADER, CurrentOffsetToWrite) +
+                                                sizeof(UINT64) * 2 * LogProcessorCount);
+    LogSharedReaderPageSize    = ROUND_TO_PAGES(FIELD_OFFSET(LOG_SHARED_READER_PAGE, CurrentOffsetToRead) +
+                                                sizeof(UINT64) * 2 * LogProcessorCount);
+
+    LogBuffersStartAddress = ExAllocatePoolWithTag(NonPagedPool, LogBuffersSize, POOLTAG);
+    LogSharedBuffersHeader = ExAllocatePoolWithTag(NonPagedPool, LogSharedBuffersHeaderSize, POOLTAG);
+    LogSharedReaderPage    = ExAllocatePoolWithTag(NonPagedPool, LogSharedReaderPageSize, POOLTAG);
+
+    if (!LogBuffersStartAddress || !LogSharedBuffersHeader || !LogSharedReaderPage)
+    {
+        return FALSE; // STATUS_INSUFFICIENT_RESOURCES
+    }
+
+    //
+    // Zeroing the buffers
+    //
+    RtlZeroMemory(LogBuffersStartAddress, LogBuffersSize);
+    RtlZeroMemory(LogSharedBuffersHeader, LogSharedBuffersHeaderSize);
+    RtlZeroMemory(LogSharedReaderPage, LogSharedReaderPageSize);
+
+    LogSharedBuffersHeader->CountOfBuffers = 2 * LogProcessorCount;
+    LogSharedBuffersHeader->BufferSize     = BufferSize;
+
+    //
+    // Initialize the DPC of user-mode doorbell
+    //
+    KeInitializeDpc(&LogDoorbellDpc, LogRingDoorbellDpc, NULL);
 
     //
     // Allocate buffer for messages and initialize the core buffer information
     //
-    for (int i = 0; i < 2; i++)
+    for (UINT32 i = 0; i < 2 * LogProcessorCount; i++)
     {
-        //
-        // initialize the lock
-        // Actually, only the 0th buffer use this spinlock but let initialize it
-        // for both but the second buffer spinlock is useless
-        // as we use our custom spinlock
-        //
-        KeInitializeSpinLock(&MessageBufferInformation[i].BufferLock);
-        KeInitializeSpinLock(&MessageBufferInformation[i].BufferLockForNonImmMessage);
+        MessageBufferInformation[i].BufferSize          = BufferSize;
+        MessageBufferInformation[i].SharedOffsetToWrite = &LogSharedBuffersHeader->CurrentOffsetToWrite[i];
+        MessageBufferInformation[i].UserOffsetToRead    = &LogSharedReaderPage->CurrentOffsetToRead[i];
 
         //
-        // allocate the buffer
+        // Set the buffer
         //
-        MessageBufferInformation[i].BufferStartAddress                   = ExAllocatePoolWithTag(NonPagedPool, LogBufferSize, POOLTAG);
+        MessageBufferInformation[i].BufferStartAddress                   = LogBuffersStartAddress + (UINT64)i * BufferSize;
         MessageBufferInformation[i].BufferForMultipleNonImmediateMessage = ExAllocatePoolWithTag(NonPagedPool, PacketChunkSize, POOLTAG);
 
-        if (!MessageBufferInformation[i].BufferStartAddress)
+        if (!MessageBufferInformation[i].BufferForMultipleNonImmediateMessage)
         {
             return FALSE; // STATUS_INSUFFICIENT_RESOURCES
         }
@@ -69,13 +119,15 @@ LogInitialize()
         //
         // Zeroing the buffer
         //
-        RtlZeroMemory(MessageBufferInformation[i].BufferStartAddress, LogBufferSize);
+        RtlZeroMemory(MessageBufferInformation[i].BufferForMultipleNonImmediateMessage, PacketChunkSize);
 
         //
         // Set the end address
         //
-        MessageBufferInformation[i].BufferEndAddress = (UINT64)MessageBufferInformation[i].BufferStartAddress + LogBufferSize;
+        MessageBufferInformation[i].BufferEndAddress = (UINT64)MessageBufferInformation[i].BufferStartAddress + BufferSize;
     }
+
+    return TRUE;
 }
 
 /**
@@ -87,15 +139,35 @@ VOID
 LogUnInitialize()
 {
     //
-    // de-allocate buffer for messages and initialize the core buffer information (for vmx-root core)
+    // de-allocate buffer for messages and initialize the core buffer information
     //
-    for (int i = 0; i < 2; i++)
+    for (UINT32 i = 0; i < 2 * LogProcessorCount; i++)
     {
         //
         // Free each buffers
         //
-        ExFreePoolWithTag(MessageBufferInformation[i].BufferStartAddress, POOLTAG);
-        ExFreePoolWithTag(MessageBufferInformation[i].BufferForMultipleNonImmediateMessage, POOLTAG);
+        if (MessageBufferInformation[i].BufferForMultipleNonImmediateMessage)
+        {
+            ExFreePoolWithTag(MessageBufferInformation[i].BufferForMultipleNonImmediateMessage, POOLTAG);
+        }
+    }
+
+    //
+    // Free the buffers of all cores and their control and reader pages
+    //
+    if (LogBuffersStartAddress)
+    {
+        ExFreePoolWithTag(LogBuffersStartAddress, POOLTAG);
+    }
+
+    if (LogSharedBuffersHeader)
+    {
+        ExFreePoolWithTag(LogSharedBuffersHeader, POOLTAG);
+    }
+
+    if (LogSharedReaderPage)
+    {
+        ExFreePoolWithTag(LogSharedReaderPage, POOLTAG);
     }
 
     //
@@ -104,6 +176,74 @@ LogUnInitialize()
     ExFreePoolWithTag(MessageBufferInformation, POOLTAG);
 }
 
+/**
+ * @brief Get the buffer of a core
+ * 
+ * @param IsVmxRoot Determine whether you want the vmx root buffer or vmx non root buffer
+ * @param CoreIndex Index of the core
+ * @return PLOG_BUFFER_INFORMATION 
+ */
+PLOG_BUFFER_INFORMATION
+LogGetBufferInformation(BOOLEAN IsVmxRoot, UINT32 CoreIndex)
+{
+    return &MessageBufferInformation[(IsVmxRoot ? LogProcessorCount : 0) + CoreIndex];
+}
+
+/**
+ * @brief Get the time stamp of a new message
+ * @details rdtsc might cause vm-exits in vmx non-root (!tsc or the
+ * transparent mode), thus vmx non-root messages use a counter
+ * 
+ * @param IsVmxRoot Whether the message is written to a vmx-root buffer
+ * @return UINT64 
+ */
+UINT64
+LogGetTimeStamp(BOOLEAN IsVmxRoot)
+{
+    return IsVmxRoot ? __rdtsc() : InterlockedIncrement64(&LogVmxNonRootTimeStamp);
+}
+
+/**
+ * @brief Find the buffer that contains the oldest unread message
+ * @details Should be called while LogReaderLock is acquired
+ * 
+ * @param IsVmxRoot Determine whether you want to read vmx root buffers or vmx non root buffers
+ * @param OldestHeader The header of the oldest message
+ * @return PLOG_BUFFER_INFORMATION The buffer or NULL if there is no unread message
+ */
+PLOG_BUFFER_INFORMATION
+LogFindOldestMessage(BOOLEAN IsVmxRoot, BUFFER_HEADER ** OldestHeader)
+{
+    if (LogBuffersMappedToUserMode)
+    {
+        //
+        // User-mode is the reader of the buffers
+        //
+        return NULL;
+    }
+
+    return LogFindOldestRecord(LogGetBufferInformation(IsVmxRoot, 0), LogProcessorCount, OldestHeader);
+}
+
+/**
+ * @brief Get the count of messages that are dropped because the buffers were full
+ * 
+ * @param IsVmxRoot Determine whether you want the vmx root buffers or vmx non root buffers
+ * @return UINT64 
+ */
+UINT64
+LogGetCountOfDroppedMessages(BOOLEAN IsVmxRoot)
+{
+    UINT64 CountOfDroppedMessages = 0;
+
+    for (UINT32 i = 0; i < LogProcessorCount; i++)
+    {
+        CountOfDroppedMessages += LogGetBufferInformation(IsVmxRoot, i)->CountOfDroppedMessages;
+    }
+
+    return CountOfDroppedMessages;
+}
+
 /**
  * @brief Save buffer to the pool
  * 
@@ -116,9 +256,12 @@ LogUnInitialize()
 BOOLEAN
 LogSendBuffer(UINT32 OperationCode, PVOID Buffer, UINT32 BufferLength)
 {
-    KIRQL   OldIRQL;
-    UINT32  Index;
-    BOOLEAN IsVmxRoot;
+    KIRQL                   OldIRQL;
+    BOOLEAN                 IsVmxRoot;
+    PLOG_BUFFER_INFORMATION BufferInformation;
+    PNOTIFY_RECORD          NotifyRecord;
+    CHAR                    Notice[LOG_DROPPED_MESSAGES_NOTICE_SIZE];
+    int                     NoticeLength;
 
     if (BufferLength > PacketChunkSize - 1 || BufferLength == 0)
     {
@@ -177,76 +320,78 @@ LogSendBuffer(UINT32 OperationCode, PVOID Buffer, UINT32 BufferLength)
     }
 
     //
-    // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
-    // if not we use the windows spinlock
+    // Each core only writes to its own buffer, in vmx-root RFLAGS.IF is cleared
+    // so nothing interrupts us, in vmx non-root we raise the IRQL to DISPATCH_LEVEL
+    // to avoid being scheduled to another core (or another writer on this core)
     //
-    if (IsVmxRoot)
+    if (!IsVmxRoot)
     {
-        //
-        // Set the index
-        //
-        Index = 1;
-        SpinlockLock(&VmxRootLoggingLock);
+        OldIRQL = KeRaiseIrqlToDpcLevel();
     }
-    else
-    {
-        //
-        // Set the index
-        //
-        Index = 0;
 
-        //
-        // Acquire the lock
-        //
-        KeAcquireSpinLock(&MessageBufferInformation[Index].BufferLock, &OldIRQL);
-    }
+    BufferInformation = LogGetBufferInformation(IsVmxRoot, KeGetCurrentProcessorNumber());
 
     //
-    // check if the buffer is filled to it's maximum index or not
+    // If user-mode reads the buffers, the space of the messages that are
+    // read by user-mode is freed
     //
-    if (MessageBufferInformation[Index].CurrentIndexToWrite > MaximumPacketsCapacity - 1)
+    if (LogBuffersMappedToUserMode)
     {
-        //
-        // start from the beginning
-        //
-        MessageBufferInformation[Index].CurrentIndexToWrite = 0;
+        LogAcceptOffsetToReadOfUserMode(BufferInformation);
     }
 
     //
-    // Compute the start of the buffer header
+    // If messages are dropped since the last report, the user is notified
+    // before the new message, as soon as there is enough space for both of
+    // them (even if the end of the buffer is not used)
     //
-    BUFFER_HEADER * Header = (BUFFER_HEADER *)((UINT64)MessageBufferInformation[Index].BufferStartAddress + (MessageBufferInformation[Index].CurrentIndexToWrite * (PacketChunkSize + sizeof(BUFFER_HEADER))));
+    if (BufferInformation->CountOfDroppedMessages != BufferInformation->CountOfReportedDroppedMessages)
+    {
+        NoticeLength = sprintf_s(Notice,
+                                 sizeof(Notice),
+                                 "warning, %llu message(s) of core %x are dropped because the log buffer was full\n",
+                                 BufferInformation->CountOfDroppedMessages - BufferInformation->CountOfReportedDroppedMessages,
+                                 KeGetCurrentProcessorNumber());
+
+        if (NoticeLength > 0 &&
+            LogGetFreeSpace(BufferInformation) >= 2 * (LOG_RECORD_SIZE(NoticeLength) + LOG_RECORD_SIZE(BufferLength)) &&
+            LogWriteRecord(BufferInformation, LogGetTimeStamp(IsVmxRoot), OPERATION_LOG_WARNING_MESSAGE, Notice, NoticeLength))
+        {
+            BufferInformation->CountOfReportedDroppedMessages = BufferInformation->CountOfDroppedMessages;
+        }
+    }
 
     //
-    // Set the header
+    // check if the buffer is full or not, we don't overwrite the unread messages
     //
-    Header->OpeationNumber = OperationCode;
-    Header->BufferLength   = BufferLength;
-    Header->Valid          = TRUE;
+    if (!LogWriteRecord(BufferInformation, LogGetTimeStamp(IsVmxRoot), OperationCode, Buffer, BufferLength))
+    {
+        BufferInformation->CountOfDroppedMessages++;
 
-    //
-    // ******** Now it's time to fill the buffer ********
-    //
+        if (!IsVmxRoot)
+        {
+            KeLowerIrql(OldIRQL);
+        }
 
-    //
-    // compute the saving index
-    //
-    PVOID SavingBuffer = ((UINT64)MessageBufferInformation[Index].BufferStartAddress + (MessageBufferInformation[Index].CurrentIndexToWrite * (PacketChunkSize + sizeof(BUFFER_HEADER))) + sizeof(BUFFER_HEADER));
+        return FALSE;
+    }
 
     //
-    // Copy the buffer
+    // If user-mode reads the buffers directly and waits for a new message, ring
+    // its doorbell (the event is set in the DPC as we might be in vmx-root)
     //
-    RtlCopyBytes(SavingBuffer, Buffer, BufferLength);
+    if (LogBuffersMappedToUserMode && InterlockedExchange(&LogSharedReaderPage->DoorbellArmed, FALSE))
+    {
+        KeInsertQueueDpc(&LogDoorbellDpc, NULL, NULL);
+    }
 
     //
-    // Increment the next index to write
+    // check if there is any thread in IRP Pending state, so we can complete their request,
+    // only one of the cores takes the notify record
     //
-    MessageBufferInformation[Index].CurrentIndexToWrite = MessageBufferInformation[Index].CurrentIndexToWrite + 1;
+    NotifyRecord = InterlockedExchangePointer((PVOID volatile *)&g_GlobalNotifyRecord, NULL);
 
-    //
-    // check if there is any thread in IRP Pending state, so we can complete their request
-    //
-    if (g_GlobalNotifyRecord != NULL)
+    if (NotifyRecord != NULL)
     {
         //
         // there is some threads that needs to be completed
@@ -255,34 +400,20 @@ LogSendBuffer(UINT32 OperationCode, PVOID Buffer, UINT32 BufferLength)
         //
         // set the target pool
         //
-        g_GlobalNotifyRecord->CheckVmxRootMessagePool = IsVmxRoot;
+        NotifyRecord->CheckVmxRootMessagePool = IsVmxRoot;
 
         //
         // Insert dpc to queue
         //
-        KeInsertQueueDpc(&g_GlobalNotifyRecord->Dpc, g_GlobalNotifyRecord, NULL);
-
-        //
-        // set notify routine to null
-        //
-        g_GlobalNotifyRecord = NULL;
+        KeInsertQueueDpc(&NotifyRecord->Dpc, NotifyRecord, NULL);
     }
 
-    //
-    // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
-    // if not we use the windows spinlock
-    //
-    if (IsVmxRoot)
+    if (!IsVmxRoot)
     {
-        SpinlockUnlock(&VmxRootLoggingLock);
-    }
-    else
-    {
-        //
-        // Release the lock
-        //
-        KeReleaseSpinLock(&MessageBufferInformation[Index].BufferLock, OldIRQL);
+        KeLowerIrql(OldIRQL);
     }
+
+    return TRUE;
 }
 
 /**
@@ -294,135 +425,88 @@ LogSendBuffer(UINT32 OperationCode, PVOID Buffer, UINT32 BufferLength)
 UINT32
 LogMarkAllAsRead(BOOLEAN IsVmxRoot)
 {
-    KIRQL  OldIRQL;
-    UINT32 Index;
-    UINT32 ResultsOfBuffersSetToRead = 0;
+    KIRQL                   OldIRQL;
+    UINT32                  ResultsOfBuffersSetToRead = 0;
+    PLOG_BUFFER_INFORMATION BufferInformation;
+    BUFFER_HEADER *         Header;
 
     //
-    // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
-    // if not we use the windows spinlock
+    // Acquire the lock
     //
-    if (IsVmxRoot)
-    {
-        //
-        // Set the index
-        //
-        Index = 1;
-
-        //
-        // Acquire the lock
-        //
-        SpinlockLock(&VmxRootLoggingLock);
-    }
-    else
-    {
-        //
-        // Set the index
-        //
-        Index = 0;
-
-        //
-        // Acquire the lock
-        //
-        KeAcquireSpinLock(&MessageBufferInformation[Index].BufferLock, &OldIRQL);
-    }
+    KeAcquireSpinLock(&LogReaderLock, &OldIRQL);
 
     //
-    // We have iterate through the all indexes
+    // We have iterate through the buffers of all cores, if the buffers are
+    // mapped to user-mode then user-mode is the reader of the buffers
     //
-    for (size_t i = 0; i < MaximumPacketsCapacity; i++)
+    for (UINT32 i = 0; i < LogProcessorCount && !LogBuffersMappedToUserMode; i++)
     {
+        BufferInformation = LogGetBufferInformation(IsVmxRoot, i);
+
         //
-        // Compute the current buffer to read
+        // Records have different sizes, so we have to count them one by one
         //
-        BUFFER_HEADER * Header = (BUFFER_HEADER *)((UINT64)MessageBufferInformation[Index].BufferStartAddress +
-                                                   (MessageBufferInformation[Index].CurrentIndexToSend *
-                                                    (PacketChunkSize + sizeof(BUFFER_HEADER))));
-
-        if (!Header->Valid)
+        while ((Header = LogGetNextRecord(BufferInformation)) != NULL)
         {
-            //
-            // there is nothing to send
-            //
+            ResultsOfBuffersSetToRead++;
 
             //
-            // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
-            // if not we use the windows spinlock
+            // The record is read, its space is free for the writer
             //
-            if (IsVmxRoot)
-            {
-                SpinlockUnlock(&VmxRootLoggingLock);
-            }
-            else
-            {
-                //
-                // Release the lock
-                //
-                KeReleaseSpinLock(&MessageBufferInformation[Index].BufferLock, OldIRQL);
-            }
-
-            return ResultsOfBuffersSetToRead;
+            LogSetRecordAsRead(BufferInformation, Header);
         }
+    }
 
-        //
-        // If we reached here, means that there is sth to send
-        //
-        ResultsOfBuffersSetToRead++;
-
-        //
-        // Second, save the buffer contents
-        //
-        PVOID SendingBuffer = ((UINT64)MessageBufferInformation[Index].BufferStartAddress + (MessageBufferInformation[Index].CurrentIndexToSend * (PacketChunkSize + sizeof(BUFFER_HEADER))) + sizeof(BUFFER_HEADER));
-
-        //
-        // Finally, set the current index to invalid as we sent it
-        //
-        Header->Valid = FALSE;
+    //
+    // Release the lock
+    //
+    KeReleaseSpinLock(&LogReaderLock, OldIRQL);
 
-        //
-        // Last step is to clear the current buffer (we can't do it once when CurrentIndexToSend is zero because
-        // there might be multiple messages on the start of the queue that didn't read yet)
-        // we don't free the header
-        //
-        RtlZeroMemory(SendingBuffer, Header->BufferLength);
+    return ResultsOfBuffersSetToRead;
+}
 
+/**
+ * @brief Show a message on the debugger (DbgPrint)
+ * 
+ * @param Header The header of the message
+ * @return VOID 
+ */
+VOID
+LogPrintMessageOnDebugger(BUFFER_HEADER * Header)
+{
+    //
+    // Means that show just messages
+    //
+    if (Header->OpeationNumber <= OPERATION_LOG_NON_IMMEDIATE_MESSAGE)
+    {
         //
-        // Check to see whether we passed the index or not
+        // We're in Dpc level here so it's safe to use DbgPrint
+        // DbgPrint limitation is 512 Byte
         //
-        if (MessageBufferInformation[Index].CurrentIndexToSend > MaximumPacketsCapacity - 2)
+        if (Header->BufferLength > DbgPrintLimitation)
         {
-            MessageBufferInformation[Index].CurrentIndexToSend = 0;
+            for (size_t i = 0; i <= Header->BufferLength / DbgPrintLimitation; i++)
+            {
+                if (i != 0)
+                {
+                    DbgPrint("%s", (char *)((UINT64)Header + sizeof(BUFFER_HEADER) + (DbgPrintLimitation * i) - 2));
+                }
+                else
+                {
+                    DbgPrint("%s", (char *)((UINT64)Header + sizeof(BUFFER_HEADER) + (DbgPrintLimitation * i)));
+                }
+            }
         }
         else
         {
-            //
-            // Increment the next index to read
-            //
-            MessageBufferInformation[Index].CurrentIndexToSend = MessageBufferInformation[Index].CurrentIndexToSend + 1;
+            DbgPrint("%s", (char *)((UINT64)Header + sizeof(BUFFER_HEADER)));
         }
     }
-
-    //
-    // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
-    // if not we use the windows spinlock
-    //
-    if (IsVmxRoot)
-    {
-        SpinlockUnlock(&VmxRootLoggingLock);
-    }
-    else
-    {
-        //
-        // Release the lock
-        //
-        KeReleaseSpinLock(&MessageBufferInformation[Index].BufferLock, OldIRQL);
-    }
-
-    return ResultsOfBuffersSetToRead;
 }
 
 /**
  * @brief Attempt to read the buffer 
+ * @details The oldest message of all cores is read
  * 
  * @param IsVmxRoot Determine whether you want to read vmx root buffer or vmx non root buffer
  * @param BufferToSaveMessage Target buffer to save the message
@@ -433,72 +517,34 @@ LogMarkAllAsRead(BOOLEAN IsVmxRoot)
 BOOLEAN
 LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLength)
 {
-    KIRQL  OldIRQL;
-    UINT32 Index;
+    KIRQL                   OldIRQL;
+    PLOG_BUFFER_INFORMATION BufferInformation;
+    BUFFER_HEADER *         Header;
 
     //
-    // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
-    // if not we use the windows spinlock
+    // Acquire the lock
     //
-    if (IsVmxRoot)
-    {
-        //
-        // Set the index
-        //
-        Index = 1;
-
-        //
-        // Acquire the lock
-        //
-        SpinlockLock(&VmxRootLoggingLock);
-    }
-    else
-    {
-        //
-        // Set the index
-        //
-        Index = 0;
-
-        //
-        // Acquire the lock
-        //
-        KeAcquireSpinLock(&MessageBufferInformation[Index].BufferLock, &OldIRQL);
-    }
+    KeAcquireSpinLock(&LogReaderLock, &OldIRQL);
 
     //
     // Compute the current buffer to read
     //
-    BUFFER_HEADER * Header = (BUFFER_HEADER *)((UINT64)MessageBufferInformation[Index].BufferStartAddress + (MessageBufferInformation[Index].CurrentIndexToSend * (PacketChunkSize + sizeof(BUFFER_HEADER))));
+    BufferInformation = LogFindOldestMessage(IsVmxRoot, &Header);
 
-    if (!Header->Valid)
+    if (BufferInformation == NULL)
     {
         //
         // there is nothing to send
         //
 
         //
-        // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
-        // if not we use the windows spinlock
+        // Release the lock
         //
-        if (IsVmxRoot)
-        {
-            SpinlockUnlock(&VmxRootLoggingLock);
-        }
-        else
-        {
-            //
-            // Release the lock
-            //
-            KeReleaseSpinLock(&MessageBufferInformation[Index].BufferLock, OldIRQL);
-        }
+        KeReleaseSpinLock(&LogReaderLock, OldIRQL);
 
         return FALSE;
     }
 
-    //
-    // If we reached here, means that there is sth to send
-    //
-
     //
     // First copy the header
     //
@@ -507,91 +553,94 @@ LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLen
     //
     // Second, save the buffer contents
     //
-    PVOID SendingBuffer = ((UINT64)MessageBufferInformation[Index].BufferStartAddress + (MessageBufferInformation[Index].CurrentIndexToSend * (PacketChunkSize + sizeof(BUFFER_HEADER))) + sizeof(BUFFER_HEADER));
+    PVOID SendingBuffer = (PVOID)((UINT64)Header + sizeof(BUFFER_HEADER));
     PVOID SavingAddress = ((UINT64)BufferToSaveMessage + sizeof(UINT32)); /* Because we want to pass the header of usermode header */
     RtlCopyBytes(SavingAddress, SendingBuffer, Header->BufferLength);
 
 #if ShowMessagesOnDebugger
-
-    //
-    // Means that show just messages
-    //
-    if (Header->OpeationNumber <= OPERATION_LOG_NON_IMMEDIATE_MESSAGE)
-    {
-        //
-        // We're in Dpc level here so it's safe to use DbgPrint
-        // DbgPrint limitation is 512 Byte
-        //
-        if (Header->BufferLength > DbgPrintLimitation)
-        {
-            for (size_t i = 0; i <= Header->BufferLength / DbgPrintLimitation; i++)
-            {
-                if (i != 0)
-                {
-                    DbgPrint("%s", (char *)((UINT64)SendingBuffer + (DbgPrintLimitation * i) - 2));
-                }
-                else
-                {
-                    DbgPrint("%s", (char *)((UINT64)SendingBuffer + (DbgPrintLimitation * i)));
-                }
-            }
-        }
-        else
-        {
-            DbgPrint("%s", (char *)SendingBuffer);
-        }
-    }
+    LogPrintMessageOnDebugger(Header);
 #endif
 
     //
-    // Finally, set the current index to invalid as we sent it
+    // Set the length to show as the ReturnedByted in usermode ioctl funtion + size of header
     //
-    Header->Valid = FALSE;
+    *ReturnedLength = Header->BufferLength + sizeof(UINT32);
 
     //
-    // Set the length to show as the ReturnedByted in usermode ioctl funtion + size of header
+    // Finally, free the record for the writer as we sent it
     //
-    *ReturnedLength = Header->BufferLength + sizeof(UINT32);
+    LogSetRecordAsRead(BufferInformation, Header);
 
     //
-    // Last step is to clear the current buffer (we can't do it once when CurrentIndexToSend is zero because
-    // there might be multiple messages on the start of the queue that didn't read yet)
-    // we don't free the header
+    // Release the lock
     //
-    RtlZeroMemory(SendingBuffer, Header->BufferLength);
+    KeReleaseSpinLock(&LogReaderLock, OldIRQL);
+
+    return TRUE;
+}
+
+/**
+ * @brief Attempt to read a batch of messages
+ * @details The oldest messages of all cores are read until the next
+ * message doesn't fit in the target buffer, each message is saved as a
+ * LOG_BATCH_MESSAGE_HEADER followed by the message and a null-terminator
+ * 
+ * @param IsVmxRoot Determine whether you want to read vmx root buffer or vmx non root buffer
+ * @param BufferToSaveMessages Target buffer to save the messages
+ * @param BufferSize Size of the target buffer
+ * @param ReturnedLength The actual length of the buffer that this function used it
+ * @return BOOLEAN return of this function shows whether the read was successfull 
+ * or not (e.g FALSE shows there's no new buffer available.)
+ */
+BOOLEAN
+LogReadBufferBatch(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessages, UINT32 BufferSize, UINT32 * ReturnedLength)
+{
+    KIRQL                   OldIRQL;
+    PLOG_BUFFER_INFORMATION BufferInformation;
+    BUFFER_HEADER *         Header;
+    UINT32                  MessageLength;
+    UINT32                  UsedLength = 0;
 
     //
-    // Check to see whether we passed the index or not
+    // Acquire the lock
     //
-    if (MessageBufferInformation[Index].CurrentIndexToSend > MaximumPacketsCapacity - 2)
-    {
-        MessageBufferInformation[Index].CurrentIndexToSend = 0;
-    }
-    else
+    KeAcquireSpinLock(&LogReaderLock, &OldIRQL);
+
+    while ((BufferInformation = LogFindOldestMessage(IsVmxRoot, &Header)) != NULL)
     {
         //
-        // Increment the next index to read
+        // Save the header and the message
         //
-        MessageBufferInformation[Index].CurrentIndexToSend = MessageBufferInformation[Index].CurrentIndexToSend + 1;
-    }
+        MessageLength = LogCopyRecordToBatch(Header, BufferToSaveMessages, UsedLength, BufferSize);
+
+        if (MessageLength == 0)
+        {
+            //
+            // The message doesn't fit, it's sent in the next batch
+            //
+            break;
+        }
+
+#if ShowMessagesOnDebugger
+        LogPrintMessageOnDebugger(Header);
+#endif
+
+        UsedLength += MessageLength;
 
-    //
-    // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
-    // if not we use the windows spinlock
-    //
-    if (IsVmxRoot)
-    {
-        SpinlockUnlock(&VmxRootLoggingLock);
-    }
-    else
-    {
         //
-        // Release the lock
+        // Free the record for the writer as we sent it
         //
-        KeReleaseSpinLock(&MessageBufferInformation[Index].BufferLock, OldIRQL);
+        LogSetRecordAsRead(BufferInformation, Header);
     }
 
-    return TRUE;
+    //
+    // Release the lock
+    //
+    KeReleaseSpinLock(&LogReaderLock, OldIRQL);
+
+    *ReturnedLength = UsedLength;
+
+    return UsedLength != 0;
 }
 
 /**
@@ -604,35 +653,33 @@ LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLen
 BOOLEAN
 LogCheckForNewMessage(BOOLEAN IsVmxRoot)
 {
-    KIRQL  OldIRQL;
-    UINT32 Index;
+    PLOG_BUFFER_INFORMATION BufferInformation;
 
-    if (IsVmxRoot)
-    {
-        Index = 1;
-    }
-    else
-    {
-        Index = 0;
-    }
-
-    //
-    // Compute the current buffer to read
-    //
-    BUFFER_HEADER * Header = (BUFFER_HEADER *)((UINT64)MessageBufferInformation[Index].BufferStartAddress + (MessageBufferInformation[Index].CurrentIndexToSend * (PacketChunkSize + sizeof(BUFFER_HEADER))));
-
-    if (!Header->Valid)
+    if (LogBuffersMappedToUserMode)
     {
         //
-        // there is nothing to send
+        // User-mode is the reader of the buffers
         //
         return FALSE;
     }
 
+    for (UINT32 i = 0; i < LogProcessorCount; i++)
+    {
+        BufferInformation = LogGetBufferInformation(IsVmxRoot, i);
+
+        if (BufferInformation->CurrentOffsetToSend != BufferInformation->CurrentOffsetToWrite)
+        {
+            //
+            // If we reached here, means that there is sth to send
+            //
+            return TRUE;
+        }
+    }
+
     //
-    // If we reached here, means that there is sth to send
+    // there is nothing to send
     //
-    return TRUE;
+    return FALSE;
 }
 
 /**
@@ -788,10 +835,10 @@ LogPrepareAndSendMessageToQueue(UINT32 OperationCode, BOOLEAN IsImmediateMessage
 BOOLEAN
 LogSendMessageToQueue(UINT32 OperationCode, BOOLEAN IsImmediateMessage, CHAR * LogMessage, UINT32 BufferLen)
 {
-    BOOLEAN Result;
-    UINT32  Index;
-    KIRQL   OldIRQL;
-    BOOLEAN IsVmxRootMode;
+    BOOLEAN                 Result;
+    KIRQL                   OldIRQL;
+    BOOLEAN                 IsVmxRootMode;
+    PLOG_BUFFER_INFORMATION BufferInformation;
 
     //
     // Set Vmx State
@@ -841,29 +888,17 @@ LogSendMessageToQueue(UINT32 OperationCode, BOOLEAN IsImmediateMessage, CHAR * L
     else
     {
         //
-        // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
-        // if not we use the windows spinlock
+        // The buffer for accumulating non-immediate messages belongs to the current
+        // core, in vmx non-root we raise the IRQL to DISPATCH_LEVEL to avoid being
+        // scheduled to another core (or another writer on this core)
         //
-        if (IsVmxRootMode)
+        if (!IsVmxRootMode)
         {
-            //
-            // Set the index
-            //
-            Index = 1;
-            SpinlockLock(&VmxRootLoggingLockForNonImmBuffers);
+            OldIRQL = KeRaiseIrqlToDpcLevel();
         }
-        else
-        {
-            //
-            // Set the index
-            //
-            Index = 0;
 
-            //
-            // Acquire the lock
-            //
-            KeAcquireSpinLock(&MessageBufferInformation[Index].BufferLockForNonImmMessage, &OldIRQL);
-        }
+        BufferInformation = LogGetBufferInformation(IsVmxRootMode, KeGetCurrentProcessorNumber());
+
         //
         //Set the result to True
         //
@@ -872,48 +907,38 @@ LogSendMessageToQueue(UINT32 OperationCode, BOOLEAN IsImmediateMessage, CHAR * L
         //
         // If log message WrittenSize is above the buffer then we have to send the previous buffer
         //
-        if ((MessageBufferInformation[Index].CurrentLengthOfNonImmBuffer + BufferLen) > PacketChunkSize - 1 && MessageBufferInformation[Index].CurrentLengthOfNonImmBuffer != 0)
+        if ((BufferInformation->CurrentLengthOfNonImmBuffer + BufferLen) > PacketChunkSize - 1 && BufferInformation->CurrentLengthOfNonImmBuffer != 0)
         {
             //
             // Send the previous buffer (non-immediate message)
             //
             Result = LogSendBuffer(OPERATION_LOG_NON_IMMEDIATE_MESSAGE,
-                                   MessageBufferInformation[Index].BufferForMultipleNonImmediateMessage,
-                                   MessageBufferInformation[Index].CurrentLengthOfNonImmBuffer);
+                                   BufferInformation->BufferForMultipleNonImmediateMessage,
+                                   BufferInformation->CurrentLengthOfNonImmBuffer);
 
             //
             // Free the immediate buffer
             //
-            MessageBufferInformation[Index].CurrentLengthOfNonImmBuffer = 0;
-            RtlZeroMemory(MessageBufferInformation[Index].BufferForMultipleNonImmediateMessage, PacketChunkSize);
+            BufferInformation->CurrentLengthOfNonImmBuffer = 0;
+            RtlZeroMemory(BufferInformation->BufferForMultipleNonImmediateMessage, PacketChunkSize);
         }
 
         //
         // We have to save the message
         //
-        RtlCopyBytes(MessageBufferInformation[Index].BufferForMultipleNonImmediateMessage +
-                         MessageBufferInformation[Index].CurrentLengthOfNonImmBuffer,
+        RtlCopyBytes(BufferInformation->BufferForMultipleNonImmediateMessage +
+                         BufferInformation->CurrentLengthOfNonImmBuffer,
                      LogMessage,
                      BufferLen);
 
         //
         // add the length
         //
-        MessageBufferInformation[Index].CurrentLengthOfNonImmBuffer += BufferLen;
+        BufferInformation->CurrentLengthOfNonImmBuffer += BufferLen;
 
-        // Check if we're in Vmx-root, if it is then we use our customized HIGH_IRQL Spinlock,
-        // if not we use the windows spinlock
-        //
-        if (IsVmxRootMode)
-        {
-            SpinlockUnlock(&VmxRootLoggingLockForNonImmBuffers);
-        }
-        else
+        if (!IsVmxRootMode)
         {
-            //
-            // Release the lock
-            //
-            KeReleaseSpinLock(&MessageBufferInformation[Index].BufferLockForNonImmMessage, OldIRQL);
+            KeLowerIrql(OldIRQL);
         }
 
         return Result;
@@ -949,6 +974,7 @@ LogNotifyUsermodeCallback(PKDPC Dpc, PVOID DeferredContext, PVOID SystemArgument
     switch (NotifyRecord->Type)
     {
     case IRP_BASED:
+    case IRP_BASED_BATCHED:
         Irp = NotifyRecord->Message.PendingIrp;
 
         if (Irp != NULL)
@@ -957,6 +983,7 @@ LogNotifyUsermodeCallback(PKDPC Dpc, PVOID DeferredContext, PVOID SystemArgument
             ULONG              InBuffLength;  // Input buffer length
             ULONG              OutBuffLength; // Output buffer length
             PIO_STACK_LOCATION IrpSp;
+            BOOLEAN            IsRead;
 
             //
             // Make suree that concurrent calls to notify function never occurs
@@ -995,7 +1022,16 @@ LogNotifyUsermodeCallback(PKDPC Dpc, PVOID DeferredContext, PVOID SystemArgument
             //
             // Read Buffer might be empty (nothing to send)
             //
-            if (!LogReadBuffer(NotifyRecord->CheckVmxRootMessagePool, OutBuff, &Length))
+            if (NotifyRecord->Type == IRP_BASED_BATCHED)
+            {
+                IsRead = LogReadBufferBatch(NotifyRecord->CheckVmxRootMessagePool, OutBuff, OutBuffLength, &Length);
+            }
+            else
+            {
+                IsRead = LogReadBuffer(NotifyRecord->CheckVmxRootMessagePool, OutBuff, &Length);
+            }
+
+            if (!IsRead)
             {
                 //
                 // we have to return here as there is nothing to send here
@@ -1051,6 +1087,20 @@ LogRegisterIrpBasedNotification(PDEVICE_OBJECT DeviceObject, PIRP Irp)
     KIRQL                   OOldIrql;
     PREGISTER_NOTIFY_BUFFER RegisterEvent;
 
+    IrpStack      = IoGetCurrentIrpStackLocation(Irp);
+    RegisterEvent = (PREGISTER_NOTIFY_BUFFER)Irp->AssociatedIrp.SystemBuffer;
+
+    //
+    // A batch is filled until the next message doesn't fit, so the buffer
+    // of batched messages should fit the largest message, otherwise such a
+    // message is never read and blocks the buffer of its core
+    //
+    if (RegisterEvent->Type == IRP_BASED_BATCHED &&
+        IrpStack->Parameters.DeviceIoControl.OutputBufferLength < LOG_BATCH_MESSAGE_SIZE(PacketChunkSize))
+    {
+        return STATUS_INVALID_PARAMETER;
+    }
+
     //
     // check if current core has another thread with pending IRP,
     // if no then put the current thread to pending
@@ -1060,9 +1110,6 @@ LogRegisterIrpBasedNotification(PDEVICE_OBJECT DeviceObject, PIRP Irp)
 
     if (g_GlobalNotifyRecord == NULL)
     {
-        IrpStack      = IoGetCurrentIrpStackLocation(Irp);
-        RegisterEvent = (PREGISTER_NOTIFY_BUFFER)Irp->AssociatedIrp.SystemBuffer;
-
         //
         // Allocate a record and save all the event context
         //
@@ -1073,7 +1120,7 @@ LogRegisterIrpBasedNotification(PDEVICE_OBJECT DeviceObject, PIRP Irp)
             return STATUS_INSUFFICIENT_RESOURCES;
         }
 
-        NotifyRecord->Type               = IRP_BASED;
+        NotifyRecord->Type               = RegisterEvent->Type; // IRP_BASED or IRP_BASED_BATCHED
         NotifyRecord->Message.PendingIrp = Irp;
 
         KeInitializeDpc(&NotifyRecord->Dpc,        // Dpc
@@ -1188,3 +1235,280 @@ LogRegisterEventBasedNotification(PDEVICE_OBJECT DeviceObject, PIRP Irp)
 
     return STATUS_SUCCESS;
 }
+
+/**
+ * @brief Signal the doorbell event of user-mode
+ * 
+ * @param Dpc 
+ * @param DeferredContext 
+ * @param SystemArgument1 
+ * @param SystemArgument2 
+ * @return VOID 
+ */
+VOID
+LogRingDoorbellDpc(PKDPC Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2)
+{
+    PKEVENT DoorbellEvent;
+
+    UNREFERENCED_PARAMETER(Dpc);
+    UNREFERENCED_PARAMETER(DeferredContext);
+    UNREFERENCED_PARAMETER(SystemArgument1);
+    UNREFERENCED_PARAMETER(SystemArgument2);
+
+    //
+    // The event might be removed while the buffers are unmapped
+    //
+    DoorbellEvent = LogDoorbellEvent;
+
+    if (DoorbellEvent != NULL)
+    {
+        KeSetEvent(DoorbellEvent, 0, FALSE);
+    }
+}
+
+/**
+ * @brief Map the buffers of all cores to the current process
+ * @details Buffers and the control page are mapped read-only, only the
+ * reader page is writable so user-mode is able to set its read offsets,
+ * should be called in the context of the requesting process in PASSIVE_LEVEL
+ * 
+ * @param MapRequest The request from user-mode
+ * @param Irp The IRP of the request
+ * @return NTSTATUS 
+ */
+NTSTATUS
+LogMapBuffersToUserMode(PDEBUGGER_MAP_LOG_BUFFERS MapRequest, PIRP Irp)
+{
+    NTSTATUS Status;
+    KIRQL    OldIRQL;
+    PKEVENT  DoorbellEvent;
+    PMDL     HeaderMdl                = NULL;
+    PMDL     ReaderPageMdl            = NULL;
+    PMDL     BuffersMdl               = NULL;
+    PVOID    HeaderUserAddress        = NULL;
+    PVOID    ReaderPageUserAddress    = NULL;
+    PVOID    BuffersUserAddress       = NULL;
+    BOOLEAN  IsAlreadyMappedToAnother = FALSE;
+
+    MapRequest->KernelStatus = DEBUGGER_ERROR_COULD_NOT_MAP_LOG_BUFFERS_TO_USER_MODE;
+
+    //
+    // Get the object pointer from the handle
+    // Note we must be in the context of the process that created the handle
+    //
+    Status = ObReferenceObjectByHandle(MapRequest->hDoorbellEvent,
+                                       SYNCHRONIZE | EVENT_MODIFY_STATE,
+                                       *ExEventObjectType,
+                                       Irp->RequestorMode,
+                                       &DoorbellEvent,
+                                       NULL);
+
+    if (!NT_SUCCESS(Status))
+    {
+        LogError("Err, unable to reference user mode event object, status = 0x%x", Status);
+        return Status;
+    }
+
+    HeaderMdl     = IoAllocateMdl(LogSharedBuffersHeader, LogSharedBuffersHeaderSize, FALSE, FALSE, NULL);
+    ReaderPageMdl = IoAllocateMdl(LogSharedReaderPage, LogSharedReaderPageSize, FALSE, FALSE, NULL);
+    BuffersMdl    = IoAllocateMdl(LogBuffersStartAddress, LogBuffersSize, FALSE, FALSE, NULL);
+
+    if (!HeaderMdl || !ReaderPageMdl || !BuffersMdl)
+    {
+        Status = STATUS_INSUFFICIENT_RESOURCES;
+        goto Failed;
+    }
+
+    MmBuildMdlForNonPagedPool(HeaderMdl);
+    MmBuildMdlForNonPagedPool(ReaderPageMdl);
+    MmBuildMdlForNonPagedPool(BuffersMdl);
+
+    //
+    // Mapping to user-mode raises an exception if it fails
+    //
+    __try
+    {
+        HeaderUserAddress = MmMapLockedPagesSpecifyCache(HeaderMdl,
+                                                         UserMode,
+                                                         MmCached,
+                                                         NULL,
+                                                         FALSE,
+                                                         NormalPagePriority | MdlMappingNoExecute | MdlMappingNoWrite);
+
+        ReaderPageUserAddress = MmMapLockedPagesSpecifyCache(ReaderPageMdl,
+                                                             UserMode,
+                                                             MmCached,
+                                                             NULL,
+                                                             FALSE,
+                                                             NormalPagePriority | MdlMappingNoExecute);
+
+        BuffersUserAddress = MmMapLockedPagesSpecifyCache(BuffersMdl,
+                                                          UserMode,
+                                                          MmCached,
+                                                          NULL,
+                                                          FALSE,
+                                                          NormalPagePriority | MdlMappingNoExecute | MdlMappingNoWrite);
+    }
+    __except (EXCEPTION_EXECUTE_HANDLER)
+    {
+        Status = GetExceptionCode();
+        goto Failed;
+    }
+
+    if (!HeaderUserAddress || !ReaderPageUserAddress || !BuffersUserAddress)
+    {
+        Status = STATUS_INSUFFICIENT_RESOURCES;
+        goto Failed;
+    }
+
+    //
+    // From now on, the kernel doesn't read the buffers, the lock makes
+    // sure that there is no kernel reader in the middle of reading and
+    // that the buffers are not mapped by two requests at the same time
+    //
+    KeAcquireSpinLock(&LogReaderLock, &OldIRQL);
+
+    if (LogBuffersMappedToUserMode)
+    {
+        //
+        // Buffers are already mapped to another process (or another handle)
+        //
+        IsAlreadyMappedToAnother = TRUE;
+    }
+    else
+    {
+        //
+        // User-mode starts reading from the current offsets to send (the
+        // offsets to write are always copied to the control page)
+        //
+        for (UINT32 i = 0; i < 2 * LogProcessorCount; i++)
+        {
+            *MessageBufferInformation[i].UserOffsetToRead = MessageBufferInformation[i].CurrentOffsetToSend;
+        }
+
+        LogSharedBuffersHeaderMdl          = HeaderMdl;
+        LogSharedReaderPageMdl             = ReaderPageMdl;
+        LogBuffersMdl                      = BuffersMdl;
+        LogSharedBuffersHeaderUserAddress  = HeaderUserAddress;
+        LogSharedReaderPageUserAddress     = ReaderPageUserAddress;
+        LogBuffersUserAddress              = BuffersUserAddress;
+        LogDoorbellEvent                   = DoorbellEvent;
+        LogBuffersOwnerFileObject          = IoGetCurrentIrpStackLocation(Irp)->FileObject;
+        LogSharedReaderPage->DoorbellArmed = FALSE;
+        LogBuffersMappedToUserMode         = TRUE;
+    }
+
+    KeReleaseSpinLock(&LogReaderLock, OldIRQL);
+
+    if (IsAlreadyMappedToAnother)
+    {
+        Status = STATUS_UNSUCCESSFUL;
+        goto Failed;
+    }
+
+    MapRequest->HeaderAddress     = (UINT64)HeaderUserAddress;
+    MapRequest->ReaderPageAddress = (UINT64)ReaderPageUserAddress;
+    MapRequest->BuffersAddress    = (UINT64)BuffersUserAddress;
+    MapRequest->KernelStatus      = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+
+    return STATUS_SUCCESS;
+
+Failed:
+
+    if (HeaderUserAddress)
+    {
+        MmUnmapLockedPages(HeaderUserAddress, HeaderMdl);
+    }
+
+    if (ReaderPageUserAddress)
+    {
+        MmUnmapLockedPages(ReaderPageUserAddress, ReaderPageMdl);
+    }
+
+    if (BuffersUserAddress)
+    {
+        MmUnmapLockedPages(BuffersUserAddress, BuffersMdl);
+    }
+
+    if (HeaderMdl)
+    {
+        IoFreeMdl(HeaderMdl);
+    }
+
+    if (ReaderPageMdl)
+    {
+        IoFreeMdl(ReaderPageMdl);
+    }
+
+    if (BuffersMdl)
+    {
+        IoFreeMdl(BuffersMdl);
+    }
+
+    ObDereferenceObject(DoorbellEvent);
+
+    return Status;
+}
+
+/**
+ * @brief Unmap the buffers from user-mode if they are mapped by
+ * this file object
+ * @details Should be called in the context of the process that
+ * mapped the buffers (IRP_MJ_CLEANUP) in PASSIVE_LEVEL
+ * 
+ * @param FileObject The file object that is cleaned up
+ * @return VOID 
+ */
+VOID
+LogUnmapBuffersFromUserMode(PFILE_OBJECT FileObject)
+{
+    KIRQL   OldIRQL;
+    PKEVENT DoorbellEvent;
+
+    //
+    // The kernel is the reader of the buffers again, the messages that are
+    // not read by user-mode are discarded
+    //
+    KeAcquireSpinLock(&LogReaderLock, &OldIRQL);
+
+    if (!LogBuffersMappedToUserMode || LogBuffersOwnerFileObject != FileObject)
+    {
+        KeReleaseSpinLock(&LogReaderLock, OldIRQL);
+        return;
+    }
+
+    LogBuffersMappedToUserMode = FALSE;
+    LogBuffersOwnerFileObject  = NULL;
+
+    for (UINT32 i = 0; i < 2 * LogProcessorCount; i++)
+    {
+        InterlockedExchange64((volatile LONG64 *)&MessageBufferInformation[i].CurrentOffsetToSend,
+                              MessageBufferInformation[i].CurrentOffsetToWrite);
+    }
+
+    KeReleaseSpinLock(&LogReaderLock, OldIRQL);
+
+    //
+    // Make sure that no one uses the doorbell event anymore
+    //
+    DoorbellEvent = InterlockedExchangePointer((PVOID volatile *)&LogDoorbellEvent, NULL);
+    KeRemoveQueueDpc(&LogDoorbellDpc);
+    KeFlushQueuedDpcs();
+
+    ObDereferenceObject(DoorbellEvent);
+
+    MmUnmapLockedPages(LogSharedBuffersHeaderUserAddress, LogSharedBuffersHeaderMdl);
+    MmUnmapLockedPages(LogSharedReaderPageUserAddress, LogSharedReaderPageMdl);
+    MmUnmapLockedPages(LogBuffersUserAddress, LogBuffersMdl);
+
+    IoFreeMdl(LogSharedBuffersHeaderMdl);
+    IoFreeMdl(LogSharedReaderPageMdl);
+    IoFreeMdl(LogBuffersMdl);
+
+    LogSharedBuffersHeaderUserAddress = NULL;
+    LogSharedReaderPageUserAddress    = NULL;
+    LogBuffersUserAddress             = NULL;
+    LogSharedBuffersHeaderMdl         = NULL;
+    LogSharedReaderPageMdl            = NULL;
+    LogBuffersMdl                     = NULL;
+}
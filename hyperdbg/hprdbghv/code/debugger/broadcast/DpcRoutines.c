@@ -1435,3 +1435,32 @@ DpcRoutineTerminateGuest(KDPC * Dpc, PVOID DeferredContext, PVOID SystemArgument
     //
     KeSignalCallDpcDone(SystemArgument1);
 }
+
+/**
+ * @brief Broadcast for merging the script engine's aggregation maps
+ * 
+ * @param Dpc 
+ * @param DeferredContext The query request (PDEBUGGER_QUERY_AGGREGATION_MAPS)
+ * @param SystemArgument1 
+ * @param SystemArgument2 
+ * @return VOID 
+ */
+VOID
+DpcRoutineQueryAggregationMapsOnAllCores(KDPC * Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2)
+{
+    //
+    // Merge the maps of this core in vmx-root, so the scripts of this
+    // core (that run in vmx-root) can't update the maps in the meantime
+    //
+    AsmVmxVmcall(VMCALL_MERGE_AGGREGATION_MAPS, DeferredContext, 0, 0);
+
+    //
+    // Wait for all DPCs to synchronize at this point
+    //
+    KeSignalCallDpcSynchronize(SystemArgument2);
+
+    //
+    // Mark the DPC as being complete
+    //
+    KeSignalCallDpcDone(SystemArgument1);
+}
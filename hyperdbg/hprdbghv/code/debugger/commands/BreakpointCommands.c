@@ -11,6 +11,77 @@
  */
 #include "..\hprdbghv\pch.h"
 
+/**
+ * @brief Handle a breakpoint vm-exit of a hidden breakpoint (!epthook)
+ * 
+ * @param CurrentProcessorIndex  
+ * @param HookedEntry The hooked page that contains the breakpoint
+ * @param GuestRip  
+ * @param GuestRegs  
+ * 
+ * @return VOID
+ */
+VOID
+BreakpointHandleEptHookBreakpoint(UINT32 CurrentProcessorIndex, PEPT_HOOKED_PAGE_DETAIL HookedEntry, ULONG64 GuestRip, PGUEST_REGS GuestRegs)
+{
+    //
+    // We found an address that matches the details, let's trigger the event
+    //
+
+    //
+    // As the context to event trigger, we send the rip
+    // of where triggered this event
+    //
+    DebuggerTriggerEvents(HIDDEN_HOOK_EXEC_CC, GuestRegs, GuestRip);
+
+    //
+    // Restore to its orginal entry for one instruction
+    //
+    EptSetPML1AndInvalidateTLB(HookedEntry->EntryAddress, HookedEntry->OriginalEntry, INVEPT_SINGLE_CONTEXT);
+
+    //
+    // Next we have to save the current hooked entry to restore on the next instruction's vm-exit
+    //
+    g_GuestState[CurrentProcessorIndex].MtfEptHookRestorePoint = HookedEntry;
+
+    //
+    // We have to set Monitor trap flag and give it the HookedEntry to work with
+    //
+    HvSetMonitorTrapFlag(TRUE);
+
+    //
+    // The following codes are added because we realized if the execution takes long then
+    // the execution might be switched to another routines, thus, MTF might conclude on
+    // another routine and we might (and will) trigger the same instruction soon
+    //
+    // The following code is not necessary on local debugging (VMI Mode), however, I don't
+    // know why? just things are not reasonable here for me
+    // another weird thing that I observed is the fact if you don't touch the routine related
+    // to the I/O in and out instructions in VMWare then it works perfectly, just touching I/O
+    // for serial is problematic, it might be a VMWare nested-virtualization bug, however, the
+    // below approached proved to be work on both Debug Mode and WMI Mode
+    // If you remove the below codes then when epthook is triggered then the execution stucks
+    // on the same instruction on where the hooks is triggered, so 'p' and 't' commands for
+    // steppings won't work
+    //
+
+    //
+    // Change guest interrupt-state
+    //
+    HvSetExternalInterruptExiting(TRUE);
+
+    //
+    // Do not vm-exit on interrupt windows
+    //
+    HvSetInterruptWindowExiting(FALSE);
+
+    //
+    // Indicate that we should enable external interruts and configure external interrupt
+    // window exiting somewhere at MTF
+    //
+    g_GuestState[CurrentProcessorIndex].DebuggingState.EnableExternalInterruptsOnContinueMtf = TRUE;
+}
+
 /**
  * @brief Check if the breakpoint vm-exit relates to !epthook command or not
  * 
@@ -23,8 +94,11 @@
 BOOLEAN
 BreakpointCheckAndHandleEptHookBreakpoints(UINT32 CurrentProcessorIndex, ULONG64 GuestRip, PGUEST_REGS GuestRegs)
 {
-    PLIST_ENTRY TempList           = 0;
-    BOOLEAN     IsHandledByEptHook = FALSE;
+    PLIST_ENTRY                   TempList           = 0;
+    PEPT_HOOKED_PAGE_DETAIL       HookedEntry        = NULL;
+    EPT_HOOKED_PAGES_TABLE_CURSOR Cursor             = {0};
+    BOOLEAN                       IsHandledByEptHook = FALSE;
+    BOOLEAN                       IsEntered;
 
     //
     // ***** Check breakpoint for !epthook *****
@@ -33,85 +107,62 @@ BreakpointCheckAndHandleEptHookBreakpoints(UINT32 CurrentProcessorIndex, ULONG64
     //
     // Check whether the breakpoint was due to a !epthook command or not
     //
-    TempList = &g_EptState->HookedPagesList;
-
-    while (&g_EptState->HookedPagesList != TempList->Flink)
+    if (!g_EptState->HiddenBreakpointsTable.Overflowed)
     {
-        TempList                            = TempList->Flink;
-        PEPT_HOOKED_PAGE_DETAIL HookedEntry = CONTAINING_RECORD(TempList, EPT_HOOKED_PAGE_DETAIL, PageHookList);
+        IsEntered = EptHookedPagesTablesEnter(CurrentProcessorIndex);
 
-        if (HookedEntry->IsExecutionHook)
+        //
+        // The same address might be hooked in more than one page (e.g., in
+        // different processes), so all the hooked pages of the address are checked
+        //
+        while ((HookedEntry = EptHookedPagesTableLookup(&g_EptState->HiddenBreakpointsTable, GuestRip, &Cursor)) != NULL)
         {
-            for (size_t i = 0; i < HookedEntry->CountOfBreakpoints; i++)
+            if (HookedEntry->IsExecutionHook)
             {
-                if (HookedEntry->BreakpointAddresses[i] == GuestRip)
-                {
-                    //
-                    // We found an address that matches the details, let's trigger the event
-                    //
-
-                    //
-                    // As the context to event trigger, we send the rip
-                    // of where triggered this event
-                    //
-                    DebuggerTriggerEvents(HIDDEN_HOOK_EXEC_CC, GuestRegs, GuestRip);
-
-                    //
-                    // Restore to its orginal entry for one instruction
-                    //
-                    EptSetPML1AndInvalidateTLB(HookedEntry->EntryAddress, HookedEntry->OriginalEntry, INVEPT_SINGLE_CONTEXT);
-
-                    //
-                    // Next we have to save the current hooked entry to restore on the next instruction's vm-exit
-                    //
-                    g_GuestState[CurrentProcessorIndex].MtfEptHookRestorePoint = HookedEntry;
-
-                    //
-                    // We have to set Monitor trap flag and give it the HookedEntry to work with
-                    //
-                    HvSetMonitorTrapFlag(TRUE);
-
-                    //
-                    // The following codes are added because we realized if the execution takes long then
-                    // the execution might be switched to another routines, thus, MTF might conclude on
-                    // another routine and we might (and will) trigger the same instruction soon
-                    //
-                    // The following code is not necessary on local debugging (VMI Mode), however, I don't
-                    // know why? just things are not reasonable here for me
-                    // another weird thing that I observed is the fact if you don't touch the routine related
-                    // to the I/O in and out instructions in VMWare then it works perfectly, just touching I/O
-                    // for serial is problematic, it might be a VMWare nested-virtualization bug, however, the
-                    // below approached proved to be work on both Debug Mode and WMI Mode
-                    // If you remove the below codes then when epthook is triggered then the execution stucks
-                    // on the same instruction on where the hooks is triggered, so 'p' and 't' commands for
-                    // steppings won't work
-                    //
-
-                    //
-                    // Change guest interrupt-state
-                    //
-                    HvSetExternalInterruptExiting(TRUE);
+                BreakpointHandleEptHookBreakpoint(CurrentProcessorIndex, HookedEntry, GuestRip, GuestRegs);
 
-                    //
-                    // Do not vm-exit on interrupt windows
-                    //
-                    HvSetInterruptWindowExiting(FALSE);
+                //
+                // Indicate that we handled the ept violation
+                //
+                IsHandledByEptHook = TRUE;
+            }
+        }
 
-                    //
-                    // Indicate that we should enable external interruts and configure external interrupt
-                    // window exiting somewhere at MTF
-                    //
-                    g_GuestState[CurrentProcessorIndex].DebuggingState.EnableExternalInterruptsOnContinueMtf = TRUE;
+        if (IsEntered)
+        {
+            EptHookedPagesTablesLeave(CurrentProcessorIndex);
+        }
+    }
+    else
+    {
+        //
+        // The table couldn't hold all the breakpoints, walk the list
+        //
+        TempList = &g_EptState->HookedPagesList;
 
-                    //
-                    // Indicate that we handled the ept violation
-                    //
-                    IsHandledByEptHook = TRUE;
+        while (&g_EptState->HookedPagesList != TempList->Flink)
+        {
+            TempList    = TempList->Flink;
+            HookedEntry = CONTAINING_RECORD(TempList, EPT_HOOKED_PAGE_DETAIL, PageHookList);
 
-                    //
-                    // Get out of the loop
-                    //
-                    break;
+            if (HookedEntry->IsExecutionHook)
+            {
+                for (size_t i = 0; i < HookedEntry->CountOfBreakpoints; i++)
+                {
+                    if (HookedEntry->BreakpointAddresses[i] == GuestRip)
+                    {
+                        BreakpointHandleEptHookBreakpoint(CurrentProcessorIndex, HookedEntry, GuestRip, GuestRegs);
+
+                        //
+                        // Indicate that we handled the ept violation
+                        //
+                        IsHandledByEptHook = TRUE;
+
+                        //
+                        // Get out of the loop
+                        //
+                        break;
+                    }
                 }
             }
         }
@@ -965,6 +965,7 @@ DebuggerCommandFlush(PDEBUGGER_FLUSH_LOGGING_BUFFERS DebuggerFlushBuffersRequest
     //
     DebuggerFlushBuffersRequest->CountOfMessagesThatSetAsReadFromVmxRoot    = LogMarkAllAsRead(TRUE);
     DebuggerFlushBuffersRequest->CountOfMessagesThatSetAsReadFromVmxNonRoot = LogMarkAllAsRead(FALSE);
+    DebuggerFlushBuffersRequest->CountOfDroppedMessages                     = LogGetCountOfDroppedMessages(TRUE) + LogGetCountOfDroppedMessages(FALSE);
     DebuggerFlushBuffersRequest->KernelStatus                               = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
 
     return STATUS_SUCCESS;
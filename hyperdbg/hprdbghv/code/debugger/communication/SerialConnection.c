@@ -10,6 +10,7 @@
  *
  */
 #include "..\hprdbghv\pch.h"
+#include "SerialCompression.h"
 
 /**
  * @brief A simple connection test
@@ -26,20 +27,212 @@ SerialConnectionTest()
 }
 
 /**
- * @brief Send end of buffer packet
+ * @brief Check whether the packets are sent in frames with
+ * length and CRC32 or not
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SerialConnectionIsFramed()
+{
+    return g_SerialConnectionFramingVersion == SERIAL_FRAMING_VERSION_LENGTH_AND_CRC32;
+}
+
+/**
+ * @brief Initialize the computation of CRC32
+ * @details The crc32 instruction (SSE4.2) is used if the processor
+ * supports it, otherwise a table is used
+ *
+ * @return VOID
+ */
+VOID
+SerialConnectionInitializeCrc32()
+{
+    CPUID CpuInfo = {0};
+
+    for (UINT32 i = 0; i < 256; i++)
+    {
+        UINT32 Entry = i;
+
+        for (UINT32 j = 0; j < 8; j++)
+        {
+            Entry = (Entry >> 1) ^ (Entry & 1 ? 0x82F63B78 : 0);
+        }
+
+        g_SerialConnectionCrc32Table[i] = Entry;
+    }
+
+    //
+    // Check for SSE4.2 bit CPUID.ECX[20]
+    //
+    __cpuid((int *)&CpuInfo, 1);
+    g_SerialConnectionCrc32IsHardwareSupported = _bittest((const LONG *)&CpuInfo.ecx, 20);
+}
+
+/**
+ * @brief Compute the CRC32 (Castagnoli) of a buffer
+ * @details The crc32 instruction only uses general purpose registers
+ * so it's used in vmx-root too, the CRC32 of the previous buffers is
+ * continued by passing it as Crc32 (zero for the first buffer)
+ *
+ * @param Buffer
+ * @param Length
+ * @param Crc32
+ *
+ * @return UINT32
+ */
+UINT32
+SerialConnectionComputeCrc32(PVOID Buffer, UINT32 Length, UINT32 Crc32)
+{
+    BYTE * Data = (BYTE *)Buffer;
+    UINT64 Crc  = (UINT32)~Crc32;
+
+    if (g_SerialConnectionCrc32IsHardwareSupported)
+    {
+        while (Length >= sizeof(UINT64))
+        {
+            Crc = _mm_crc32_u64(Crc, *(UINT64 UNALIGNED *)Data);
+            Data += sizeof(UINT64);
+            Length -= sizeof(UINT64);
+        }
+
+        while (Length--)
+        {
+            Crc = _mm_crc32_u8((UINT32)Crc, *Data++);
+        }
+    }
+    else
+    {
+        while (Length--)
+        {
+            Crc = g_SerialConnectionCrc32Table[(Crc ^ *Data++) & 0xff] ^ (Crc >> 8);
+        }
+    }
+
+    return ~(UINT32)Crc;
+}
+
+/**
+ * @brief Move the bytes that are received from the debugger to
+ * the receive buffer
+ * @details The debugger sends its pipelined requests while the
+ * debuggee is sending the responses of the previous requests,
+ * if the buffer is full then the bytes are dropped and the
+ * request is rejected by its CRC32 or checksum
+ *
+ * @return VOID
+ */
+VOID
+SerialConnectionKeepReceivedBytes()
+{
+    UCHAR  RecvChar = NULL;
+    UINT32 NextTail;
+
+    while (KdHyperDbgRecvByte(&RecvChar))
+    {
+        NextTail = (g_SerialConnectionReceiveBuffer.Tail + 1) % SERIAL_CONNECTION_RECEIVE_BUFFER_SIZE;
+
+        if (NextTail == g_SerialConnectionReceiveBuffer.Head)
+        {
+            continue;
+        }
+
+        g_SerialConnectionReceiveBuffer.Buffer[g_SerialConnectionReceiveBuffer.Tail] = RecvChar;
+        g_SerialConnectionReceiveBuffer.Tail                                         = NextTail;
+    }
+}
+
+/**
+ * @brief Send a byte to the debugger
+ * @details The bytes that are received in the meantime are kept (if
+ * the debuggee is halted) as the FIFO of the serial port is small
+ *
+ * @param Byte
+ *
+ * @return VOID
+ */
+VOID
+SerialConnectionSendByte(UCHAR Byte)
+{
+    if (g_SerialConnectionKeepReceivedBytes)
+    {
+        SerialConnectionKeepReceivedBytes();
+    }
+
+    KdHyperDbgSendByte(Byte, TRUE);
+}
+
+/**
+ * @brief Receive a byte from the debugger without waiting, the
+ * bytes that are kept while sending are received first
+ *
+ * @param RecvByte
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SerialConnectionTryRecvByte(PUCHAR RecvByte)
+{
+    if (g_SerialConnectionReceiveBuffer.Head != g_SerialConnectionReceiveBuffer.Tail)
+    {
+        *RecvByte                            = g_SerialConnectionReceiveBuffer.Buffer[g_SerialConnectionReceiveBuffer.Head];
+        g_SerialConnectionReceiveBuffer.Head = (g_SerialConnectionReceiveBuffer.Head + 1) % SERIAL_CONNECTION_RECEIVE_BUFFER_SIZE;
+
+        return TRUE;
+    }
+
+    return KdHyperDbgRecvByte(RecvByte);
+}
+
+/**
+ * @brief Send the header of a framed packet (if the packets are framed)
+ *
+ * @param Signature Signature of the frame (compressed or not)
+ * @param Length Length of the packet
+ * @param Crc32 CRC32 of the packet
+ *
+ * @return VOID
+ */
+VOID
+SerialConnectionSendFrameHeader(UINT32 Signature, UINT32 Length, UINT32 Crc32)
+{
+    SERIAL_FRAME_HEADER Header = {0};
+
+    if (!SerialConnectionIsFramed())
+    {
+        return;
+    }
+
+    Header.Signature = Signature;
+    Header.Length    = Length;
+    Header.Crc32     = Crc32;
+
+    for (size_t i = 0; i < sizeof(SERIAL_FRAME_HEADER); i++)
+    {
+        SerialConnectionSendByte(((CHAR *)&Header)[i]);
+    }
+}
+
+/**
+ * @brief Send end of buffer packet (if the packets are not framed)
  *
  * @return VOID 
  */
 VOID
 SerialConnectionSendEndOfBuffer()
 {
+    if (SerialConnectionIsFramed())
+    {
+        return;
+    }
+
     //
     // Send the end buffer
     //
-    KdHyperDbgSendByte(SERIAL_END_OF_BUFFER_CHAR_1, TRUE);
-    KdHyperDbgSendByte(SERIAL_END_OF_BUFFER_CHAR_2, TRUE);
-    KdHyperDbgSendByte(SERIAL_END_OF_BUFFER_CHAR_3, TRUE);
-    KdHyperDbgSendByte(SERIAL_END_OF_BUFFER_CHAR_4, TRUE);
+    SerialConnectionSendByte(SERIAL_END_OF_BUFFER_CHAR_1);
+    SerialConnectionSendByte(SERIAL_END_OF_BUFFER_CHAR_2);
+    SerialConnectionSendByte(SERIAL_END_OF_BUFFER_CHAR_3);
+    SerialConnectionSendByte(SERIAL_END_OF_BUFFER_CHAR_4);
 }
 
 /**
@@ -87,8 +280,102 @@ SerialConnectionCheckForTheEndOfTheBuffer(PUINT32 CurrentLoopIndex, BYTE * Buffe
     return FALSE;
 }
 
+/**
+ * @brief Receive a byte from the debugger in polling mode
+ *
+ * @return UCHAR
+ */
+UCHAR
+SerialConnectionRecvByte()
+{
+    UCHAR RecvChar = NULL;
+
+    while (!SerialConnectionTryRecvByte(&RecvChar))
+    {
+    }
+
+    return RecvChar;
+}
+
+/**
+ * @brief Receive the rest of a framed packet from the debugger
+ * @details The signature of the header is already received, the
+ * length is known so the packet is received without searching
+ * for the end of buffer
+ *
+ * @param BufferToSave
+ * @param LengthReceived
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SerialConnectionRecvFrame(CHAR *   BufferToSave,
+                          UINT32 * LengthReceived)
+{
+    SERIAL_FRAME_HEADER Header = {0};
+
+    Header.Signature = SERIAL_FRAME_SIGNATURE;
+
+    for (size_t i = sizeof(UINT32); i < sizeof(SERIAL_FRAME_HEADER); i++)
+    {
+        ((UCHAR *)&Header)[i] = SerialConnectionRecvByte();
+    }
+
+    //
+    // The same limitation as the packets with the end of buffer (it's
+    // not added to the length as the length might overflow)
+    //
+    if (Header.Length > MaxSerialPacketSize - SERIAL_END_OF_BUFFER_CHARS_COUNT)
+    {
+        LogError("Err, a buffer received in debuggee which exceeds the buffer limitation");
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i < Header.Length; i++)
+    {
+        BufferToSave[i] = SerialConnectionRecvByte();
+    }
+
+    if (SerialConnectionComputeCrc32(BufferToSave, Header.Length, 0) != Header.Crc32)
+    {
+        LogError("Err, crc32 of the received buffer is invalid");
+        return FALSE;
+    }
+
+    //
+    // The debugger supports framed packets, so the next packets are also
+    // sent in frames
+    //
+    g_SerialConnectionFramingVersion = SERIAL_FRAMING_VERSION_LENGTH_AND_CRC32;
+
+    *LengthReceived = Header.Length;
+
+    return TRUE;
+}
+
+/**
+ * @brief Discard the received bytes until the signature of the
+ * next frame is received
+ * @details The length of a corrupted frame can't be trusted, so the
+ * stream is searched for the signature
+ *
+ * @return VOID
+ */
+VOID
+SerialConnectionSkipToNextFrame()
+{
+    UINT32 Signature = 0;
+
+    while (Signature != SERIAL_FRAME_SIGNATURE)
+    {
+        Signature = (Signature >> 8) | ((UINT32)SerialConnectionRecvByte() << 24);
+    }
+}
+
 /**
  * @brief Receive packet from the debugger
+ * @details Both of the packets with the end of buffer and the framed
+ * packets are received
  *
  * @param BufferToSave
  * @param LengthReceived
@@ -108,7 +395,7 @@ SerialConnectionRecvBuffer(CHAR *   BufferToSave,
     {
         UCHAR RecvChar = NULL;
 
-        if (!KdHyperDbgRecvByte(&RecvChar))
+        if (!SerialConnectionTryRecvByte(&RecvChar))
         {
             continue;
         }
@@ -128,6 +415,23 @@ SerialConnectionRecvBuffer(CHAR *   BufferToSave,
 
         BufferToSave[Loop] = RecvChar;
 
+        //
+        // Check whether it's the header of a framed packet
+        //
+        if (Loop == sizeof(UINT32) - 1 && *(UINT32 *)BufferToSave == SERIAL_FRAME_SIGNATURE)
+        {
+            //
+            // If the frame is corrupted, the next frame is received
+            // as the debugger keeps sending frames
+            //
+            while (!SerialConnectionRecvFrame(BufferToSave, LengthReceived))
+            {
+                SerialConnectionSkipToNextFrame();
+            }
+
+            return TRUE;
+        }
+
         if (SerialConnectionCheckForTheEndOfTheBuffer(&Loop, (BYTE *)BufferToSave))
         {
             break;
@@ -144,6 +448,79 @@ SerialConnectionRecvBuffer(CHAR *   BufferToSave,
     return TRUE;
 }
 
+/**
+ * @brief Send a packet in a compressed frame (if the debugger requested it)
+ * @details The buffers are copied to a global buffer and compressed
+ * at once, the packet is only sent compressed if it's smaller
+ *
+ * @param Buffer1 buffer to send
+ * @param Length1 length of buffer to send
+ * @param Buffer2 buffer to send (optional)
+ * @param Length2 length of buffer to send
+ * @param Buffer3 buffer to send (optional)
+ * @param Length3 length of buffer to send
+ * @return BOOLEAN TRUE if the packet is sent, FALSE if it should be
+ * sent without compression
+ */
+BOOLEAN
+SerialConnectionSendCompressedFrame(CHAR * Buffer1,
+                                    UINT32 Length1,
+                                    CHAR * Buffer2,
+                                    UINT32 Length2,
+                                    CHAR * Buffer3,
+                                    UINT32 Length3)
+{
+    UINT32 Length = Length1 + Length2 + Length3;
+    UINT32 CompressedLength;
+
+    if (!g_SerialConnectionCompressFrames || !SerialConnectionIsFramed() ||
+        Length < SERIAL_COMPRESSION_MINIMUM_SIZE)
+    {
+        return FALSE;
+    }
+
+    RtlCopyMemory(g_SerialConnectionCompression.Buffer, Buffer1, Length1);
+
+    if (Length2 != 0)
+    {
+        RtlCopyMemory(&g_SerialConnectionCompression.Buffer[Length1], Buffer2, Length2);
+    }
+
+    if (Length3 != 0)
+    {
+        RtlCopyMemory(&g_SerialConnectionCompression.Buffer[Length1 + Length2], Buffer3, Length3);
+    }
+
+    //
+    // The compressed block (after the length of the packet) should be
+    // smaller than the packet
+    //
+    CompressedLength = SerialCompressionCompress(g_SerialConnectionCompression.HashTable,
+                                                 g_SerialConnectionCompression.Buffer,
+                                                 Length,
+                                                 &g_SerialConnectionCompression.CompressedBuffer[sizeof(UINT32)],
+                                                 Length - sizeof(UINT32) - 1);
+
+    if (CompressedLength == 0)
+    {
+        return FALSE;
+    }
+
+    *(UINT32 *)g_SerialConnectionCompression.CompressedBuffer = Length;
+    CompressedLength += sizeof(UINT32);
+
+    SerialConnectionSendFrameHeader(SERIAL_FRAME_SIGNATURE_COMPRESSED,
+                                    CompressedLength,
+                                    SerialConnectionComputeCrc32(g_SerialConnectionCompression.CompressedBuffer, CompressedLength, 0));
+
+    for (UINT32 i = 0; i < CompressedLength; i++)
+    {
+        SerialConnectionSendByte(g_SerialConnectionCompression.CompressedBuffer[i]);
+    }
+
+    return TRUE;
+}
+
 /**
  * @brief Perform sending buffer over serial
  * 
@@ -163,9 +540,19 @@ SerialConnectionSend(CHAR * Buffer, UINT32 Length)
         return FALSE;
     }
 
+    if (SerialConnectionSendCompressedFrame(Buffer, Length, NULL, 0, NULL, 0))
+    {
+        return TRUE;
+    }
+
+    if (SerialConnectionIsFramed())
+    {
+        SerialConnectionSendFrameHeader(SERIAL_FRAME_SIGNATURE, Length, SerialConnectionComputeCrc32(Buffer, Length, 0));
+    }
+
     for (size_t i = 0; i < Length; i++)
     {
-        KdHyperDbgSendByte(Buffer[i], TRUE);
+        SerialConnectionSendByte(Buffer[i]);
     }
 
     //
@@ -188,6 +575,8 @@ SerialConnectionSend(CHAR * Buffer, UINT32 Length)
 BOOLEAN
 SerialConnectionSendTwoBuffers(CHAR * Buffer1, UINT32 Length1, CHAR * Buffer2, UINT32 Length2)
 {
+    UINT32 Crc32;
+
     //
     // Check if buffer not pass the boundary
     //
@@ -197,12 +586,25 @@ SerialConnectionSendTwoBuffers(CHAR * Buffer1, UINT32 Length1, CHAR * Buffer2, U
         return FALSE;
     }
 
+    if (SerialConnectionSendCompressedFrame(Buffer1, Length1, Buffer2, Length2, NULL, 0))
+    {
+        return TRUE;
+    }
+
+    if (SerialConnectionIsFramed())
+    {
+        Crc32 = SerialConnectionComputeCrc32(Buffer1, Length1, 0);
+        Crc32 = SerialConnectionComputeCrc32(Buffer2, Length2, Crc32);
+
+        SerialConnectionSendFrameHeader(SERIAL_FRAME_SIGNATURE, Length1 + Length2, Crc32);
+    }
+
     //
     // Send first buffer
     //
     for (size_t i = 0; i < Length1; i++)
     {
-        KdHyperDbgSendByte(Buffer1[i], TRUE);
+        SerialConnectionSendByte(Buffer1[i]);
     }
 
     //
@@ -210,7 +612,7 @@ SerialConnectionSendTwoBuffers(CHAR * Buffer1, UINT32 Length1, CHAR * Buffer2, U
     //
     for (size_t i = 0; i < Length2; i++)
     {
-        KdHyperDbgSendByte(Buffer2[i], TRUE);
+        SerialConnectionSendByte(Buffer2[i]);
     }
 
     //
@@ -240,6 +642,8 @@ SerialConnectionSendThreeBuffers(CHAR * Buffer1,
                                  CHAR * Buffer3,
                                  UINT32 Length3)
 {
+    UINT32 Crc32;
+
     //
     // Check if buffer not pass the boundary
     //
@@ -249,12 +653,26 @@ SerialConnectionSendThreeBuffers(CHAR * Buffer1,
         return FALSE;
     }
 
+    if (SerialConnectionSendCompressedFrame(Buffer1, Length1, Buffer2, Length2, Buffer3, Length3))
+    {
+        return TRUE;
+    }
+
+    if (SerialConnectionIsFramed())
+    {
+        Crc32 = SerialConnectionComputeCrc32(Buffer1, Length1, 0);
+        Crc32 = SerialConnectionComputeCrc32(Buffer2, Length2, Crc32);
+        Crc32 = SerialConnectionComputeCrc32(Buffer3, Length3, Crc32);
+
+        SerialConnectionSendFrameHeader(SERIAL_FRAME_SIGNATURE, Length1 + Length2 + Length3, Crc32);
+    }
+
     //
     // Send first buffer
     //
     for (size_t i = 0; i < Length1; i++)
     {
-        KdHyperDbgSendByte(Buffer1[i], TRUE);
+        SerialConnectionSendByte(Buffer1[i]);
     }
 
     //
@@ -262,7 +680,7 @@ SerialConnectionSendThreeBuffers(CHAR * Buffer1,
     //
     for (size_t i = 0; i < Length2; i++)
     {
-        KdHyperDbgSendByte(Buffer2[i], TRUE);
+        SerialConnectionSendByte(Buffer2[i]);
     }
 
     //
@@ -270,7 +688,7 @@ SerialConnectionSendThreeBuffers(CHAR * Buffer1,
     //
     for (size_t i = 0; i < Length3; i++)
     {
-        KdHyperDbgSendByte(Buffer3[i], TRUE);
+        SerialConnectionSendByte(Buffer3[i]);
     }
 
     //
@@ -360,6 +778,18 @@ SerialConnectionPrepare(PDEBUGGER_PREPARE_DEBUGGEE DebuggeeRequest)
     //
     KdHyperDbgPrepareDebuggeeConnectionPort(DebuggeeRequest->PortAddress, DebuggeeRequest->Baudrate);
 
+    //
+    // Packets are sent with the end of buffer until the debugger
+    // sends a framed packet
+    //
+    SerialConnectionInitializeCrc32();
+
+    g_SerialConnectionFramingVersion     = SERIAL_FRAMING_VERSION_END_OF_BUFFER;
+    g_SerialConnectionCompressFrames     = FALSE;
+    g_SerialConnectionReceiveBuffer.Head = 0;
+    g_SerialConnectionReceiveBuffer.Tail = 0;
+    DebuggeeRequest->FramingVersion      = SERIAL_FRAMING_VERSION_LATEST;
+
     //
     // Initialize kernel debugger
     //
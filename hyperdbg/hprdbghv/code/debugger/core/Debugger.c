@@ -105,6 +105,11 @@ DebuggerInitialize()
     InitializeListHead(&g_Events->ExternalInterruptOccurredEventsHead);
     InitializeListHead(&g_Events->VmcallInstructionExecutionEventsHead);
 
+    //
+    // Initialize the dispatch index of events
+    //
+    EventDispatchInitialize();
+
     //
     // Initialize the list of hidden hooks headers
     //
@@ -174,6 +179,26 @@ DebuggerInitialize()
         // Zero the local variables memory
         //
         RtlZeroMemory(g_GuestState[i].DebuggingState.ScriptEngineCoreSpecificLocalVariable, MAX_VAR_COUNT * sizeof(UINT64));
+
+        //
+        // Initialize the aggregation maps of this core, each core only
+        // updates its own maps so there is no need to synchronize them
+        //
+        if (!g_GuestState[i].DebuggingState.ScriptEngineCoreSpecificAggregationMaps)
+        {
+            g_GuestState[i].DebuggingState.ScriptEngineCoreSpecificAggregationMaps =
+                ExAllocatePoolWithTag(NonPagedPool, sizeof(SCRIPT_ENGINE_AGGREGATION_MAPS), POOLTAG);
+        }
+
+        if (!g_GuestState[i].DebuggingState.ScriptEngineCoreSpecificAggregationMaps)
+        {
+            //
+            // Out of resource, initialization of script engine's aggregation maps failed
+            //
+            return FALSE;
+        }
+
+        RtlZeroMemory(g_GuestState[i].DebuggingState.ScriptEngineCoreSpecificAggregationMaps, sizeof(SCRIPT_ENGINE_AGGREGATION_MAPS));
     }
 
     //
@@ -225,6 +250,11 @@ DebuggerUninitialize()
     //
     DebuggerRemoveAllEvents();
 
+    //
+    // Free the dispatch index of events
+    //
+    EventDispatchUninitialize();
+
     //
     // Uninitialize kernel debugger
     //
@@ -331,6 +361,97 @@ DebuggerCreateEvent(BOOLEAN                  Enabled,
     return Event;
 }
 
+/**
+ * @brief Translate the bytecode of the script of an action to the native code
+ * @details The native code is emitted to pages that are mapped writable and
+ * not executable, then the mapping is changed to read-only and executable,
+ * so the native code is never writable and executable at the same time, if
+ * the translation fails then the bytecode is used
+ * 
+ * @param Action The action that its bytecode is translated
+ * @return VOID 
+ */
+VOID
+DebuggerJitCompileScriptOfAction(PDEBUGGER_EVENT_ACTION Action)
+{
+    PSCRIPT_ENGINE_BYTECODE Bytecode    = Action->ScriptBytecode;
+    UINT64                  CodeSize    = SCRIPT_ENGINE_JIT_SIZE(Bytecode->CountOfInstructions);
+    PHYSICAL_ADDRESS        LowAddress  = {0};
+    PHYSICAL_ADDRESS        HighAddress = {0};
+    PHYSICAL_ADDRESS        SkipBytes   = {0};
+    BOOLEAN                 IsCompiled  = FALSE;
+    PMDL                    Mdl;
+    PVOID                   Code;
+    UINT32 *                Labels;
+
+    //
+    // Pages are allocated for the MDL in IRQL <= APC_LEVEL
+    //
+    if (CodeSize > MAXULONG || KeGetCurrentIrql() > APC_LEVEL)
+    {
+        return;
+    }
+
+    HighAddress.QuadPart = MAXULONG64;
+
+    Mdl = MmAllocatePagesForMdlEx(LowAddress, HighAddress, SkipBytes, CodeSize, MmCached, MM_ALLOCATE_FULL_REQUIRED);
+
+    if (Mdl == NULL)
+    {
+        return;
+    }
+
+    Code = MmMapLockedPagesSpecifyCache(Mdl, KernelMode, MmCached, NULL, FALSE, NormalPagePriority | MdlMappingNoExecute);
+
+    if (Code == NULL)
+    {
+        MmFreePagesFromMdl(Mdl);
+        ExFreePool(Mdl);
+        return;
+    }
+
+    Labels = ExAllocatePoolWithTag(NonPagedPool, SCRIPT_ENGINE_JIT_LABELS_SIZE(Bytecode->CountOfInstructions), POOLTAG);
+
+    if (Labels != NULL)
+    {
+        //
+        // The code is emitted, then it's made read-only and executable
+        //
+        IsCompiled = ScriptEngineJitCompile(Bytecode, Code, (UINT32)CodeSize, Labels) &&
+                     NT_SUCCESS(MmProtectMdlSystemAddress(Mdl, PAGE_EXECUTE_READ));
+
+        ExFreePoolWithTag(Labels, POOLTAG);
+    }
+
+    if (!IsCompiled)
+    {
+        MmUnmapLockedPages(Code, Mdl);
+        MmFreePagesFromMdl(Mdl);
+        ExFreePool(Mdl);
+        return;
+    }
+
+    Action->ScriptJitCodeMdl = Mdl;
+    Action->ScriptJitCode    = Code;
+}
+
+/**
+ * @brief Free the native code of the script of an action
+ * 
+ * @param Action The action that its native code is freed
+ * @return VOID 
+ */
+VOID
+DebuggerFreeScriptJitCodeOfAction(PDEBUGGER_EVENT_ACTION Action)
+{
+    MmUnmapLockedPages(Action->ScriptJitCode, Action->ScriptJitCodeMdl);
+    MmFreePagesFromMdl(Action->ScriptJitCodeMdl);
+    ExFreePool(Action->ScriptJitCodeMdl);
+
+    Action->ScriptJitCode    = NULL;
+    Action->ScriptJitCodeMdl = NULL;
+}
+
 /**
  * @brief Create an action and add the action to an event
  * 
@@ -543,6 +664,47 @@ DebuggerAddActionToEvent(PDEBUGGER_EVENT Event, DEBUGGER_EVENT_ACTION_TYPE_ENUM
         Action->ScriptConfiguration.ScriptLength                = InTheCaseOfRunScript->ScriptLength;
         Action->ScriptConfiguration.ScriptPointer               = InTheCaseOfRunScript->ScriptPointer;
         Action->ScriptConfiguration.OptionalRequestedBufferSize = InTheCaseOfRunScript->OptionalRequestedBufferSize;
+        Action->ScriptConfiguration.DeferredFormatting          = InTheCaseOfRunScript->DeferredFormatting;
+
+        //
+        // Lower the script to the bytecode, so it's not needed to decode
+        // the symbols each time that the event is triggered, if the script
+        // can't be lowered, then it runs from its symbol buffer
+        //
+        if ((UINT64)Action->ScriptConfiguration.ScriptPointer * sizeof(SYMBOL) <= Action->ScriptConfiguration.ScriptLength)
+        {
+            SYMBOL_BUFFER           CodeBuffer = {0};
+            PSCRIPT_ENGINE_BYTECODE Bytecode   = ExAllocatePoolWithTag(NonPagedPool,
+                                                                     SCRIPT_ENGINE_BYTECODE_SIZE(Action->ScriptConfiguration.ScriptPointer),
+                                                                     POOLTAG);
+
+            if (Bytecode != NULL)
+            {
+                CodeBuffer.Head    = Action->ScriptConfiguration.ScriptBuffer;
+                CodeBuffer.Size    = Action->ScriptConfiguration.ScriptLength;
+                CodeBuffer.Pointer = Action->ScriptConfiguration.ScriptPointer;
+
+                if (ScriptEngineLowerToBytecode(&CodeBuffer, Bytecode))
+                {
+                    Action->ScriptBytecode = Bytecode;
+                }
+                else
+                {
+                    ExFreePoolWithTag(Bytecode, POOLTAG);
+                }
+            }
+        }
+
+#if UseJitForScripts
+
+        //
+        // Translate the bytecode to the native code
+        //
+        if (Action->ScriptBytecode != NULL)
+        {
+            DebuggerJitCompileScriptOfAction(Action);
+        }
+#endif
     }
 
     //
@@ -568,82 +730,137 @@ DebuggerAddActionToEvent(PDEBUGGER_EVENT Event, DEBUGGER_EVENT_ACTION_TYPE_ENUM
 }
 
 /**
- * @brief Register an event to a list of active events
- * 
- * @param Event Event structure
- * @return BOOLEAN TRUE if it successfully registered and FALSE if not registered
+ * @brief Get the list of events based on the type of the event
+ *
+ * @param EventType Type of events
+ * @return PLIST_ENTRY The head of the list of events of this type or
+ * null if the event type is not valid
  */
-BOOLEAN
-DebuggerRegisterEvent(PDEBUGGER_EVENT Event)
+PLIST_ENTRY
+DebuggerGetEventListByEventType(DEBUGGER_EVENT_TYPE_ENUM EventType)
 {
-    //
-    // Register the event
-    //
-    switch (Event->EventType)
+    switch (EventType)
     {
     case HIDDEN_HOOK_READ_AND_WRITE:
-        InsertHeadList(&g_Events->HiddenHookReadAndWriteEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->HiddenHookReadAndWriteEventsHead;
     case HIDDEN_HOOK_READ:
-        InsertHeadList(&g_Events->HiddenHookReadEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->HiddenHookReadEventsHead;
     case HIDDEN_HOOK_WRITE:
-        InsertHeadList(&g_Events->HiddenHookWriteEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->HiddenHookWriteEventsHead;
     case HIDDEN_HOOK_EXEC_DETOURS:
-        InsertHeadList(&g_Events->EptHook2sExecDetourEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->EptHook2sExecDetourEventsHead;
     case HIDDEN_HOOK_EXEC_CC:
-        InsertHeadList(&g_Events->EptHookExecCcEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->EptHookExecCcEventsHead;
     case SYSCALL_HOOK_EFER_SYSCALL:
-        InsertHeadList(&g_Events->SyscallHooksEferSyscallEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->SyscallHooksEferSyscallEventsHead;
     case SYSCALL_HOOK_EFER_SYSRET:
-        InsertHeadList(&g_Events->SyscallHooksEferSysretEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->SyscallHooksEferSysretEventsHead;
     case CPUID_INSTRUCTION_EXECUTION:
-        InsertHeadList(&g_Events->CpuidInstructionExecutionEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->CpuidInstructionExecutionEventsHead;
     case RDMSR_INSTRUCTION_EXECUTION:
-        InsertHeadList(&g_Events->RdmsrInstructionExecutionEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->RdmsrInstructionExecutionEventsHead;
     case WRMSR_INSTRUCTION_EXECUTION:
-        InsertHeadList(&g_Events->WrmsrInstructionExecutionEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->WrmsrInstructionExecutionEventsHead;
     case EXCEPTION_OCCURRED:
-        InsertHeadList(&g_Events->ExceptionOccurredEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->ExceptionOccurredEventsHead;
     case TSC_INSTRUCTION_EXECUTION:
-        InsertHeadList(&g_Events->TscInstructionExecutionEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->TscInstructionExecutionEventsHead;
     case PMC_INSTRUCTION_EXECUTION:
-        InsertHeadList(&g_Events->PmcInstructionExecutionEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->PmcInstructionExecutionEventsHead;
     case IN_INSTRUCTION_EXECUTION:
-        InsertHeadList(&g_Events->InInstructionExecutionEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->InInstructionExecutionEventsHead;
     case OUT_INSTRUCTION_EXECUTION:
-        InsertHeadList(&g_Events->OutInstructionExecutionEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->OutInstructionExecutionEventsHead;
     case DEBUG_REGISTERS_ACCESSED:
-        InsertHeadList(&g_Events->DebugRegistersAccessedEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->DebugRegistersAccessedEventsHead;
     case EXTERNAL_INTERRUPT_OCCURRED:
-        InsertHeadList(&g_Events->ExternalInterruptOccurredEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->ExternalInterruptOccurredEventsHead;
     case VMCALL_INSTRUCTION_EXECUTION:
-        InsertHeadList(&g_Events->VmcallInstructionExecutionEventsHead, &(Event->EventsOfSameTypeList));
-        break;
+        return &g_Events->VmcallInstructionExecutionEventsHead;
     default:
+        //
+        // Event type is not found
+        //
+        return NULL;
+    }
+}
 
+/**
+ * @brief Register an event to a list of active events
+ * 
+ * @param Event Event structure
+ * @return BOOLEAN TRUE if it successfully registered and FALSE if not registered
+ */
+BOOLEAN
+DebuggerRegisterEvent(PDEBUGGER_EVENT Event)
+{
+    PLIST_ENTRY TargetEventList;
+
+    //
+    // Find the list of this type of event
+    //
+    TargetEventList = DebuggerGetEventListByEventType(Event->EventType);
+
+    if (TargetEventList == NULL)
+    {
         //
         // Wrong event type
         //
         return FALSE;
-        break;
     }
 
+    //
+    // Register the event
+    //
+    InsertHeadList(TargetEventList, &(Event->EventsOfSameTypeList));
+
+    //
+    // Update the dispatch index of this type of event
+    //
+    EventDispatchRebuild(Event->EventType);
+
+    return TRUE;
+}
+
+/**
+ * @brief Trigger the events of a special type from the dispatch index
+ *
+ * @details should be called in vmx-root after entering the index
+ *
+ * @param EventType Type of events
+ * @param CoreIndex Index of the current core
+ * @param Regs Guest registers
+ * @param Context An optional parameter (different in each event)
+ * @return BOOLEAN TRUE if the events are triggered (even if there was
+ * nothing to trigger) and FALSE if the list of events should be walked
+ */
+BOOLEAN
+DebuggerTriggerEventsFromDispatchIndex(DEBUGGER_EVENT_TYPE_ENUM EventType, UINT32 CoreIndex, PGUEST_REGS Regs, PVOID Context)
+{
+    PEVENT_DISPATCH_BUCKET Bucket;
+    BOOLEAN                UseListWalk;
+
+    //
+    // Find the enabled events of this type that are allowed to be
+    // triggered on this core from the dispatch index
+    //
+    Bucket = EventDispatchGetBucket(EventType, CoreIndex, &UseListWalk);
+
+    if (UseListWalk)
+    {
+        return FALSE;
+    }
+
+    if (Bucket == NULL)
+    {
+        //
+        // There is nothing to trigger
+        //
+        return TRUE;
+    }
+
+    EventDispatchTriggerBucket(Bucket, Regs, Context);
+
     return TRUE;
 }
 
@@ -659,10 +876,12 @@ DebuggerRegisterEvent(PDEBUGGER_EVENT Event)
 BOOLEAN
 DebuggerTriggerEvents(DEBUGGER_EVENT_TYPE_ENUM EventType, PGUEST_REGS Regs, PVOID Context)
 {
-    ULONG                       CurrentProcessorIndex;
-    PLIST_ENTRY                 TempList  = 0;
-    PLIST_ENTRY                 TempList2 = 0;
-    DebuggerCheckForCondition * ConditionFunc;
+    ULONG           CurrentProcessorIndex;
+    PLIST_ENTRY     TempList  = 0;
+    PLIST_ENTRY     TempList2 = 0;
+    PDEBUGGER_EVENT CurrentEvent;
+    BOOLEAN         IsEnteredIndex;
+    BOOLEAN         IsTriggered;
 
     //
     // Check if triggering debugging actions are allowed or not
@@ -681,329 +900,264 @@ DebuggerTriggerEvents(DEBUGGER_EVENT_TYPE_ENUM EventType, PGUEST_REGS Regs, PVOI
     CurrentProcessorIndex = KeGetCurrentProcessorNumber();
 
     //
-    // Find the debugger events list base on the type of the event
+    // The dispatch index is only used in vmx-root, triggers in vmx
+    // non-root (e.g., detours) might be moved to another core
     //
-    switch (EventType)
-    {
-    case HIDDEN_HOOK_READ_AND_WRITE:
-    {
-        TempList  = &g_Events->HiddenHookReadAndWriteEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case HIDDEN_HOOK_READ:
-    {
-        TempList  = &g_Events->HiddenHookReadEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case HIDDEN_HOOK_WRITE:
-    {
-        TempList  = &g_Events->HiddenHookWriteEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case HIDDEN_HOOK_EXEC_DETOURS:
-    {
-        TempList  = &g_Events->EptHook2sExecDetourEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case HIDDEN_HOOK_EXEC_CC:
-    {
-        TempList  = &g_Events->EptHookExecCcEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case SYSCALL_HOOK_EFER_SYSCALL:
-    {
-        TempList  = &g_Events->SyscallHooksEferSyscallEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case SYSCALL_HOOK_EFER_SYSRET:
-    {
-        TempList  = &g_Events->SyscallHooksEferSysretEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case CPUID_INSTRUCTION_EXECUTION:
-    {
-        TempList  = &g_Events->CpuidInstructionExecutionEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case RDMSR_INSTRUCTION_EXECUTION:
-    {
-        TempList  = &g_Events->RdmsrInstructionExecutionEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case WRMSR_INSTRUCTION_EXECUTION:
-    {
-        TempList  = &g_Events->WrmsrInstructionExecutionEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case EXCEPTION_OCCURRED:
-    {
-        TempList  = &g_Events->ExceptionOccurredEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case TSC_INSTRUCTION_EXECUTION:
-    {
-        TempList  = &g_Events->TscInstructionExecutionEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case PMC_INSTRUCTION_EXECUTION:
-    {
-        TempList  = &g_Events->PmcInstructionExecutionEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case IN_INSTRUCTION_EXECUTION:
-    {
-        TempList  = &g_Events->InInstructionExecutionEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    case OUT_INSTRUCTION_EXECUTION:
+    if (g_GuestState[CurrentProcessorIndex].IsOnVmxRootMode)
     {
-        TempList  = &g_Events->OutInstructionExecutionEventsHead;
-        TempList2 = TempList;
-        break;
+        IsEnteredIndex = EventDispatchEnterIndex(CurrentProcessorIndex);
+
+        IsTriggered = DebuggerTriggerEventsFromDispatchIndex(EventType, CurrentProcessorIndex, Regs, Context);
+
+        if (IsEnteredIndex)
+        {
+            EventDispatchLeaveIndex(CurrentProcessorIndex);
+        }
+
+        if (IsTriggered)
+        {
+            return TRUE;
+        }
     }
-    case DEBUG_REGISTERS_ACCESSED:
+
+    //
+    // The index is not usable, find the debugger events list base on
+    // the type of the event
+    //
+    TempList = DebuggerGetEventListByEventType(EventType);
+
+    if (TempList == NULL)
     {
-        TempList  = &g_Events->DebugRegistersAccessedEventsHead;
-        TempList2 = TempList;
-        break;
+        //
+        // Event type is not found
+        //
+        return FALSE;
     }
-    case EXTERNAL_INTERRUPT_OCCURRED:
+
+    TempList2 = TempList;
+
+    while (TempList2 != TempList->Flink)
     {
-        TempList  = &g_Events->ExternalInterruptOccurredEventsHead;
-        TempList2 = TempList;
-        break;
+        TempList     = TempList->Flink;
+        CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+
+        //
+        // check if the event is enabled or not
+        //
+        if (!CurrentEvent->Enabled)
+        {
+            continue;
+        }
+
+        //
+        // Check if this event is for this core or not
+        //
+        if (CurrentEvent->CoreId != DEBUGGER_EVENT_APPLY_TO_ALL_CORES && CurrentEvent->CoreId != CurrentProcessorIndex)
+        {
+            //
+            // This event is not related to either or core or all cores
+            //
+            continue;
+        }
+
+        DebuggerCheckAndPerformEvent(CurrentEvent, Regs, Context);
     }
-    case VMCALL_INSTRUCTION_EXECUTION:
+
+    return TRUE;
+}
+
+/**
+ * @brief Check the process, event specific parameters and conditions
+ * of an event and perform its actions if all of them are met
+ *
+ * @param CurrentEvent Event Object
+ * @param Regs Guest registers
+ * @param Context An optional parameter (different in each event)
+ * @return BOOLEAN TRUE if the actions of the event are performed
+ */
+BOOLEAN
+DebuggerCheckAndPerformEvent(PDEBUGGER_EVENT CurrentEvent, PGUEST_REGS Regs, PVOID Context)
+{
+    DebuggerCheckForCondition * ConditionFunc;
+
+    //
+    // Check if this event is for this process or not
+    //
+    if (CurrentEvent->ProcessId != DEBUGGER_EVENT_APPLY_TO_ALL_PROCESSES && CurrentEvent->ProcessId != PsGetCurrentProcessId())
     {
-        TempList  = &g_Events->VmcallInstructionExecutionEventsHead;
-        TempList2 = TempList;
-        break;
-    }
-    default:
         //
-        // Event type is not found
+        // This event is not related to either our process or all processes
         //
         return FALSE;
-        break;
     }
 
-    while (TempList2 != TempList->Flink)
+    //
+    // Check event type specific conditions
+    //
+    switch (CurrentEvent->EventType)
     {
-        TempList                     = TempList->Flink;
-        PDEBUGGER_EVENT CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
-
-        //
-        // check if the event is enabled or not
+    case EXTERNAL_INTERRUPT_OCCURRED:
         //
-        if (!CurrentEvent->Enabled)
-        {
-            continue;
-        }
-
+        // For external interrupt exiting events we check whether the
+        // vector match the event's vector or not
         //
-        // Check if this event is for this core or not
+        // Context is the physical address
         //
-        if (CurrentEvent->CoreId != DEBUGGER_EVENT_APPLY_TO_ALL_CORES && CurrentEvent->CoreId != CurrentProcessorIndex)
+        if (Context != CurrentEvent->OptionalParam1)
         {
             //
-            // This event is not related to either or core or all cores
+            // The interrupt is not for this event
             //
-            continue;
+            return FALSE;
         }
+        break;
+
+    case HIDDEN_HOOK_READ_AND_WRITE:
+    case HIDDEN_HOOK_READ:
+    case HIDDEN_HOOK_WRITE:
+        //
+        // For hidden hook read/writes we check whether the address
+        // is in the range of what user specified or not, this is because
+        // we get the events for all hidden hooks in a page granularity
+        //
 
         //
-        // Check if this event is for this process or not
+        // Context is the physical address
         //
-        if (CurrentEvent->ProcessId != DEBUGGER_EVENT_APPLY_TO_ALL_PROCESSES && CurrentEvent->ProcessId != PsGetCurrentProcessId())
+        if (!(Context >= CurrentEvent->OptionalParam1 && Context < CurrentEvent->OptionalParam2))
         {
             //
-            // This event is not related to either our process or all processes
+            // The value is not withing our expected range
             //
-            continue;
+            return FALSE;
         }
+        break;
 
+    case HIDDEN_HOOK_EXEC_CC:
+    case HIDDEN_HOOK_EXEC_DETOURS:
         //
-        // Check event type specific conditions
+        // Here we check if it's HIDDEN_HOOK_EXEC_DETOURS or its
+        // HIDDEN_HOOK_EXEC_CC then it means that it's detours hidden
+        // hook exec so we have to make sure to perform its actions
+        // , only if the hook is triggered for the address described in
+        // event, note that address in event is a physical address and
+        // the address that the function that triggers these events and
+        // sent here as the context is also converted to its physical form
         //
-        switch (CurrentEvent->EventType)
+        // This way we are sure that no one can bypass our hook by remapping
+        // address to another virtual address as everything is physical
+        //
+        if (Context != CurrentEvent->OptionalParam1)
         {
-        case EXTERNAL_INTERRUPT_OCCURRED:
-            //
-            // For external interrupt exiting events we check whether the
-            // vector match the event's vector or not
             //
             // Context is the physical address
             //
-            if (Context != CurrentEvent->OptionalParam1)
-            {
-                //
-                // The interrupt is not for this event
-                //
-                continue;
-            }
-            break;
-
-        case HIDDEN_HOOK_READ_AND_WRITE:
-        case HIDDEN_HOOK_READ:
-        case HIDDEN_HOOK_WRITE:
-            //
-            // For hidden hook read/writes we check whether the address
-            // is in the range of what user specified or not, this is because
-            // we get the events for all hidden hooks in a page granularity
-            //
 
             //
-            // Context is the physical address
+            // The hook is not for this (physical) address
             //
-            if (!(Context >= CurrentEvent->OptionalParam1 && Context < CurrentEvent->OptionalParam2))
-            {
-                //
-                // The value is not withing our expected range
-                //
-                continue;
-            }
-            break;
+            return FALSE;
+        }
+        break;
 
-        case HIDDEN_HOOK_EXEC_CC:
-        case HIDDEN_HOOK_EXEC_DETOURS:
-            //
-            // Here we check if it's HIDDEN_HOOK_EXEC_DETOURS or its
-            // HIDDEN_HOOK_EXEC_CC then it means that it's detours hidden
-            // hook exec so we have to make sure to perform its actions
-            // , only if the hook is triggered for the address described in
-            // event, note that address in event is a physical address and
-            // the address that the function that triggers these events and
-            // sent here as the context is also converted to its physical form
+    case RDMSR_INSTRUCTION_EXECUTION:
+    case WRMSR_INSTRUCTION_EXECUTION:
+        //
+        // check if MSR exit is what we want or not
+        //
+        if (CurrentEvent->OptionalParam1 != DEBUGGER_EVENT_MSR_READ_OR_WRITE_ALL_MSRS && CurrentEvent->OptionalParam1 != Context)
+        {
             //
-            // This way we are sure that no one can bypass our hook by remapping
-            // address to another virtual address as everything is physical
+            // The msr is not what we want
             //
-            if (Context != CurrentEvent->OptionalParam1)
-            {
-                //
-                // Context is the physical address
-                //
-
-                //
-                // The hook is not for this (physical) address
-                //
-                continue;
-            }
-            break;
+            return FALSE;
+        }
+        break;
 
-        case RDMSR_INSTRUCTION_EXECUTION:
-        case WRMSR_INSTRUCTION_EXECUTION:
+    case EXCEPTION_OCCURRED:
+        //
+        // check if exception is what we need or not
+        //
+        if (CurrentEvent->OptionalParam1 != DEBUGGER_EVENT_EXCEPTIONS_ALL_FIRST_32_ENTRIES && CurrentEvent->OptionalParam1 != Context)
+        {
             //
-            // check if MSR exit is what we want or not
+            // The exception is not what we want
             //
-            if (CurrentEvent->OptionalParam1 != DEBUGGER_EVENT_MSR_READ_OR_WRITE_ALL_MSRS && CurrentEvent->OptionalParam1 != Context)
-            {
-                //
-                // The msr is not what we want
-                //
-                continue;
-            }
-            break;
+            return FALSE;
+        }
+        break;
 
-        case EXCEPTION_OCCURRED:
+    case IN_INSTRUCTION_EXECUTION:
+    case OUT_INSTRUCTION_EXECUTION:
+        //
+        // check if I/O port is what we want or not
+        //
+        if (CurrentEvent->OptionalParam1 != DEBUGGER_EVENT_ALL_IO_PORTS && CurrentEvent->OptionalParam1 != Context)
+        {
             //
-            // check if exception is what we need or not
+            // The port is not what we want
             //
-            if (CurrentEvent->OptionalParam1 != DEBUGGER_EVENT_EXCEPTIONS_ALL_FIRST_32_ENTRIES && CurrentEvent->OptionalParam1 != Context)
-            {
-                //
-                // The exception is not what we want
-                //
-                continue;
-            }
-            break;
+            return FALSE;
+        }
+        break;
 
-        case IN_INSTRUCTION_EXECUTION:
-        case OUT_INSTRUCTION_EXECUTION:
-            //
-            // check if I/O port is what we want or not
-            //
-            if (CurrentEvent->OptionalParam1 != DEBUGGER_EVENT_ALL_IO_PORTS && CurrentEvent->OptionalParam1 != Context)
-            {
-                //
-                // The port is not what we want
-                //
-                continue;
-            }
-            break;
+    case SYSCALL_HOOK_EFER_SYSCALL:
 
-        case SYSCALL_HOOK_EFER_SYSCALL:
+        //
+        // case SYSCALL_HOOK_EFER_SYSRET:
+        //
+        // I don't know how to find syscall number when sysret is executed so
+        // that's why we don't support extra argument for sysret
 
+        //
+        // check syscall number
+        //
+        if (CurrentEvent->OptionalParam1 != DEBUGGER_EVENT_SYSCALL_ALL_SYSRET_OR_SYSCALLS && CurrentEvent->OptionalParam1 != Context)
+        {
             //
-            // case SYSCALL_HOOK_EFER_SYSRET:
+            // The syscall number is not what we want
             //
-            // I don't know how to find syscall number when sysret is executed so
-            // that's why we don't support extra argument for sysret
+            return FALSE;
+        }
 
-            //
-            // check syscall number
-            //
-            if (CurrentEvent->OptionalParam1 != DEBUGGER_EVENT_SYSCALL_ALL_SYSRET_OR_SYSCALLS && CurrentEvent->OptionalParam1 != Context)
-            {
-                //
-                // The syscall number is not what we want
-                //
-                continue;
-            }
+        break;
 
-            break;
+    default:
+        break;
+    }
 
-        default:
-            break;
-        }
+    //
+    // Check if condtion is met or not , if the condition
+    // is not met then we have to avoid performing the actions
+    //
 
+    if (CurrentEvent->ConditionsBufferSize != 0)
+    {
         //
-        // Check if condtion is met or not , if the condition
-        // is not met then we have to avoid performing the actions
+        // Means that there is some conditions
         //
+        ConditionFunc = CurrentEvent->ConditionBufferAddress;
 
-        if (CurrentEvent->ConditionsBufferSize != 0)
+        //
+        // Run and check for results
+        //
+        // Because the user might change the nonvolatile registers, we save fastcall nonvolatile registers
+        //
+        if (AsmDebuggerConditionCodeHandler(Regs, Context, ConditionFunc) == 0)
         {
             //
-            // Means that there is some conditions
-            //
-            ConditionFunc = CurrentEvent->ConditionBufferAddress;
-
-            //
-            // Run and check for results
+            // The condition function returns null, mean that the
+            // condition didn't met, we can ignore this event
             //
-            // Because the user might change the nonvolatile registers, we save fastcall nonvolatile registers
-            //
-            if (AsmDebuggerConditionCodeHandler(Regs, Context, ConditionFunc) == 0)
-            {
-                //
-                // The condition function returns null, mean that the
-                // condition didn't met, we can ignore this event
-                //
-                continue;
-            }
+            return FALSE;
         }
-
-        //
-        // perform the actions
-        //
-        DebuggerPerformActions(CurrentEvent, Regs, Context);
     }
 
+    //
+    // perform the actions
+    //
+    DebuggerPerformActions(CurrentEvent, Regs, Context);
+
     return TRUE;
 }
 
@@ -1072,6 +1226,7 @@ DebuggerPerformRunScript(UINT64                  Tag,
     ACTION_BUFFER                ActionBuffer  = {0};
     SYMBOL                       ErrorSymbol   = {0};
     SCRIPT_ENGINE_VARIABLES_LIST VariablesList = {0};
+    BOOL                         HasError      = FALSE;
 
     if (Action != NULL)
     {
@@ -1080,6 +1235,7 @@ DebuggerPerformRunScript(UINT64                  Tag,
         //
         ActionBuffer.Context                   = Context;
         ActionBuffer.ImmediatelySendTheResults = Action->ImmediatelySendTheResults;
+        ActionBuffer.DeferredFormatting        = Action->ScriptConfiguration.DeferredFormatting;
         ActionBuffer.CurrentAction             = Action;
         ActionBuffer.Tag                       = Tag;
 
@@ -1123,29 +1279,206 @@ DebuggerPerformRunScript(UINT64                  Tag,
     VariablesList.TempList            = g_TempList;
     VariablesList.GlobalVariablesList = g_ScriptGlobalVariables;
     VariablesList.LocalVariablesList  = g_GuestState[KeGetCurrentProcessorNumber()].DebuggingState.ScriptEngineCoreSpecificLocalVariable;
+    VariablesList.AggregationMaps     = g_GuestState[KeGetCurrentProcessorNumber()].DebuggingState.ScriptEngineCoreSpecificAggregationMaps;
 
-    for (int i = 0; i < CodeBuffer.Pointer;)
+    if (Action != NULL && Action->ScriptJitCode != NULL)
     {
         //
-        // If has error, show error message and abort.
+        // Run the native code of the script
         //
-        if (ScriptEngineExecute(Regs,
-                                ActionBuffer,
-                                &VariablesList,
-                                &CodeBuffer,
-                                &i,
-                                &ErrorSymbol) == TRUE)
+        HasError = ScriptEngineExecuteJit(Regs,
+                                          ActionBuffer,
+                                          &VariablesList,
+                                          &CodeBuffer,
+                                          Action->ScriptJitCode,
+                                          &ErrorSymbol);
+    }
+    else if (Action != NULL && Action->ScriptBytecode != NULL)
+    {
+        //
+        // Run the lowered script
+        //
+        HasError = ScriptEngineExecuteBytecode(Regs,
+                                               ActionBuffer,
+                                               &VariablesList,
+                                               &CodeBuffer,
+                                               Action->ScriptBytecode,
+                                               &ErrorSymbol);
+    }
+    else
+    {
+        for (int i = 0; i < CodeBuffer.Pointer;)
         {
-            CHAR NameOfOperator[MAX_FUNCTION_NAME_LENGTH] = {0};
-            ScriptEngineGetOperatorName(&ErrorSymbol, NameOfOperator);
-            LogInfo("Invalid returning address for operator: %s", NameOfOperator);
-            break;
+            if (ScriptEngineExecute(Regs,
+                                    ActionBuffer,
+                                    &VariablesList,
+                                    &CodeBuffer,
+                                    &i,
+                                    &ErrorSymbol) == TRUE)
+            {
+                HasError = TRUE;
+                break;
+            }
         }
     }
 
+    //
+    // If has error, show error message
+    //
+    if (HasError)
+    {
+        CHAR NameOfOperator[MAX_FUNCTION_NAME_LENGTH] = {0};
+        ScriptEngineGetOperatorName(&ErrorSymbol, NameOfOperator);
+        LogInfo("Invalid returning address for operator: %s", NameOfOperator);
+    }
+
     return TRUE;
 }
 
+/**
+ * @brief Merge the aggregation maps of the current core to the result
+ * of the query
+ * @details should be called in vmx-root (VMCALL_MERGE_AGGREGATION_MAPS),
+ * the scripts of this core are also executed in vmx-root, so they can't
+ * update the maps between merging and clearing them
+ *
+ * @param AggregationMapsRequest The query request
+ * @return VOID
+ */
+VOID
+DebuggerMergeAggregationMapsOfCurrentCore(PDEBUGGER_QUERY_AGGREGATION_MAPS AggregationMapsRequest)
+{
+    PSCRIPT_ENGINE_AGGREGATION_MAPS CoreMaps = NULL;
+
+    CoreMaps = g_GuestState[KeGetCurrentProcessorNumber()].DebuggingState.ScriptEngineCoreSpecificAggregationMaps;
+
+    if (CoreMaps == NULL)
+    {
+        return;
+    }
+
+    //
+    // Other cores are merging to the same result buffer
+    //
+    SpinlockLock(&DebuggerAggregationMapsLock);
+
+    ScriptEngineAggregationMerge(&AggregationMapsRequest->Maps, CoreMaps);
+
+    //
+    // Clear the maps of this core before leaving vmx-root, so nothing
+    // is recorded between merging and clearing
+    //
+    if (AggregationMapsRequest->ClearMaps)
+    {
+        RtlZeroMemory(CoreMaps, sizeof(SCRIPT_ENGINE_AGGREGATION_MAPS));
+    }
+
+    SpinlockUnlock(&DebuggerAggregationMapsLock);
+}
+
+/**
+ * @brief Query (and optionally clear) the aggregation maps of all cores
+ *
+ * @param AggregationMapsRequest The query request, the merged maps are
+ * filled in this structure
+ * @return VOID
+ */
+VOID
+DebuggerQueryAggregationMaps(PDEBUGGER_QUERY_AGGREGATION_MAPS AggregationMapsRequest)
+{
+    //
+    // The result is the merge of the maps of all cores
+    //
+    RtlZeroMemory(&AggregationMapsRequest->Maps, sizeof(SCRIPT_ENGINE_AGGREGATION_MAPS));
+
+    KeGenericCallDpc(DpcRoutineQueryAggregationMapsOnAllCores, AggregationMapsRequest);
+
+    AggregationMapsRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+}
+
+/**
+ * @brief Query a part of an aggregation map (and optionally clear the
+ * maps) of all cores while the debuggee is halted
+ * @details should be called in vmx-root by the core that is connected
+ * to the debugger, other cores are halted so they can't run the scripts,
+ * they might be halted while holding DebuggerAggregationMapsLock, so the
+ * lock is not used here, the used entries are copied after the packet
+ *
+ * @param AggregationMapsPacket The request and the result of the query
+ * @return VOID
+ */
+VOID
+DebuggerQueryAggregationMapsOfHaltedCores(PDEBUGGEE_AGGREGATION_MAPS_PACKET AggregationMapsPacket)
+{
+    PSCRIPT_ENGINE_AGGREGATION_MAPS  CoreMaps       = NULL;
+    PSCRIPT_ENGINE_AGGREGATION_ENTRY Entries        = NULL;
+    ULONG                            ProcessorCount = KeQueryActiveProcessorCount(0);
+    UINT32                           i;
+
+    Entries = (PSCRIPT_ENGINE_AGGREGATION_ENTRY)(((CHAR *)AggregationMapsPacket) +
+                                                 sizeof(DEBUGGEE_AGGREGATION_MAPS_PACKET));
+
+    AggregationMapsPacket->CountOfSentEntries = 0;
+    AggregationMapsPacket->NextEntry          = SCRIPT_ENGINE_AGGREGATION_MAP_ENTRIES;
+
+    if (AggregationMapsPacket->MapIndex < SCRIPT_ENGINE_AGGREGATION_MAXIMUM_MAPS)
+    {
+        //
+        // Merge the map of all cores, each packet merges it again as the
+        // halted debuggee can't keep the maps of all cores
+        //
+        RtlZeroMemory(&g_KdAggregationMap, sizeof(SCRIPT_ENGINE_AGGREGATION_MAP));
+
+        for (i = 0; i < ProcessorCount; i++)
+        {
+            CoreMaps = g_GuestState[i].DebuggingState.ScriptEngineCoreSpecificAggregationMaps;
+
+            if (CoreMaps != NULL)
+            {
+                ScriptEngineAggregationMergeMap(&g_KdAggregationMap, &CoreMaps->Maps[AggregationMapsPacket->MapIndex]);
+            }
+        }
+
+        AggregationMapsPacket->Type                  = g_KdAggregationMap.Type;
+        AggregationMapsPacket->CountOfEntries        = g_KdAggregationMap.CountOfEntries;
+        AggregationMapsPacket->CountOfDroppedUpdates = g_KdAggregationMap.CountOfDroppedUpdates;
+
+        //
+        // Copy the used entries until the packet is full
+        //
+        for (i = AggregationMapsPacket->StartingEntry;
+             i < SCRIPT_ENGINE_AGGREGATION_MAP_ENTRIES &&
+             AggregationMapsPacket->CountOfSentEntries < DEBUGGEE_AGGREGATION_MAPS_ENTRIES_PER_PACKET;
+             i++)
+        {
+            if (g_KdAggregationMap.Entries[i].IsUsed)
+            {
+                Entries[AggregationMapsPacket->CountOfSentEntries++] = g_KdAggregationMap.Entries[i];
+            }
+        }
+
+        if (i < SCRIPT_ENGINE_AGGREGATION_MAP_ENTRIES)
+        {
+            AggregationMapsPacket->NextEntry = i;
+        }
+    }
+
+    if (AggregationMapsPacket->ClearMaps)
+    {
+        for (i = 0; i < ProcessorCount; i++)
+        {
+            CoreMaps = g_GuestState[i].DebuggingState.ScriptEngineCoreSpecificAggregationMaps;
+
+            if (CoreMaps != NULL)
+            {
+                RtlZeroMemory(CoreMaps, sizeof(SCRIPT_ENGINE_AGGREGATION_MAPS));
+            }
+        }
+    }
+
+    AggregationMapsPacket->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+}
+
 /**
  * @brief Manage running the custom code action
  * 
@@ -1321,6 +1654,11 @@ DebuggerEnableOrDisableAllEvents(BOOLEAN IsEnable)
         }
     }
 
+    //
+    // Update the dispatch index of all types of events
+    //
+    EventDispatchRebuildAll();
+
     return FindAtLeastOneEvent;
 }
 
@@ -1550,6 +1888,11 @@ DebuggerEnableEvent(UINT64 Tag)
     //
     Event->Enabled = TRUE;
 
+    //
+    // Update the dispatch index of this type of event
+    //
+    EventDispatchRebuild(Event->EventType);
+
     return TRUE;
 }
 
@@ -1612,6 +1955,11 @@ DebuggerDisableEvent(UINT64 Tag)
     //
     Event->Enabled = FALSE;
 
+    //
+    // Update the dispatch index of this type of event
+    //
+    EventDispatchRebuild(Event->EventType);
+
     return TRUE;
 }
 
@@ -1681,6 +2029,12 @@ DebuggerRemoveEventFromEventList(UINT64 Tag)
                 // We have to remove the event from the list
                 //
                 RemoveEntryList(&CurrentEvent->EventsOfSameTypeList);
+
+                //
+                // Update the dispatch index of this type of event
+                //
+                EventDispatchRebuild(CurrentEvent->EventType);
+
                 return TRUE;
             }
         }
@@ -1731,6 +2085,22 @@ DebuggerRemoveAllActionsFromEvent(PDEBUGGER_EVENT Event)
             ExFreePoolWithTag(CurrentAction->RequestedBuffer.RequstBufferAddress, POOLTAG);
         }
 
+        //
+        // Check if the script of the action is translated to the native code
+        //
+        if (CurrentAction->ScriptJitCode != NULL)
+        {
+            DebuggerFreeScriptJitCodeOfAction(CurrentAction);
+        }
+
+        //
+        // Check if the script of the action is lowered to the bytecode
+        //
+        if (CurrentAction->ScriptBytecode != NULL)
+        {
+            ExFreePoolWithTag(CurrentAction->ScriptBytecode, POOLTAG);
+        }
+
         //
         // Remove the action and free the pool,
         // if it's a custom buffer then the buffer
@@ -2673,6 +3043,7 @@ DebuggerParseActionFromUsermode(PDEBUGGER_GENERAL_ACTION Action, UINT32 BufferLe
         UserScriptConfig.ScriptLength                                   = Action->ScriptBufferSize;
         UserScriptConfig.ScriptPointer                                  = Action->ScriptBufferPointer;
         UserScriptConfig.OptionalRequestedBufferSize                    = Action->PreAllocatedBuffer;
+        UserScriptConfig.DeferredFormatting                             = Action->DeferredFormatting;
 
         DebuggerAddActionToEvent(Event, RUN_SCRIPT, Action->ImmediateMessagePassing, NULL, &UserScriptConfig);
 
@@ -0,0 +1,854 @@
+/**
+ * @file EventDispatch.c
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief Dispatch index of debugger events
+ * @details The index is built when events are registered, enabled,
+ * disabled or removed, so DebuggerTriggerEvents doesn't need to walk
+ * the whole list of events (of a special type) on each vm-exit
+ *
+ * Published snapshots are never modified, a new snapshot is published
+ * instead and the previous one is freed (or reused) only after all the
+ * cores that might still use it have left the index, each core has an
+ * epoch which is odd while the core uses the index
+ *
+ * Building and searching the buckets is in EventDispatchBuckets.h
+ *
+ * @version 0.1
+ * @date 2021-10-11
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hprdbghv\pch.h"
+#include "EventDispatchBuckets.h"
+
+/**
+ * @brief Initialize the dispatch index of events
+ *
+ * @details should NOT be called in vmx-root
+ *
+ * @return VOID
+ */
+VOID
+EventDispatchInitialize()
+{
+    //
+    // Free the previous snapshots (if any)
+    //
+    EventDispatchUninitialize();
+
+    RtlZeroMemory(g_EventDispatchIndex, sizeof(g_EventDispatchIndex));
+
+    g_EventDispatchIndexInitialized = TRUE;
+}
+
+/**
+ * @brief Uninitialize the dispatch index of events and free
+ * the snapshots
+ *
+ * @details should NOT be called in vmx-root
+ *
+ * @return VOID
+ */
+VOID
+EventDispatchUninitialize()
+{
+    if (!g_EventDispatchIndexInitialized)
+    {
+        return;
+    }
+
+    //
+    // From now, all the triggers walk the list of events
+    //
+    g_EventDispatchIndexInitialized = FALSE;
+
+    //
+    // Wait for the cores that still use the snapshots
+    //
+    EventDispatchWaitForQuiescence();
+
+    for (size_t i = 0; i < EVENT_DISPATCH_MAXIMUM_EVENT_TYPES; i++)
+    {
+        if (g_EventDispatchIndex[i].Snapshot != NULL)
+        {
+            ExFreePoolWithTag(g_EventDispatchIndex[i].Snapshot, POOLTAG);
+            g_EventDispatchIndex[i].Snapshot = NULL;
+        }
+
+        for (size_t j = 0; j < EVENT_DISPATCH_STANDBY_SNAPSHOTS; j++)
+        {
+            if (g_EventDispatchIndex[i].StandbySnapshots[j] != NULL)
+            {
+                ExFreePoolWithTag(g_EventDispatchIndex[i].StandbySnapshots[j], POOLTAG);
+                g_EventDispatchIndex[i].StandbySnapshots[j] = NULL;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Start using the dispatch index on the current core
+ *
+ * @details should be called in vmx-root, the snapshots that are read
+ * after this point are not freed or reused until the core leaves
+ * the index
+ *
+ * @param CoreIndex Index of the current core
+ * @return BOOLEAN TRUE if the core entered the index, FALSE if it's
+ * already in the index (nested triggers)
+ */
+BOOLEAN
+EventDispatchEnterIndex(UINT32 CoreIndex)
+{
+    volatile LONG64 * Epoch = &g_GuestState[CoreIndex].DebuggingState.EventDispatchEpoch;
+
+    if (*Epoch & 1)
+    {
+        return FALSE;
+    }
+
+    InterlockedIncrement64(Epoch);
+
+    return TRUE;
+}
+
+/**
+ * @brief Stop using the dispatch index on the current core
+ *
+ * @details should be called in vmx-root
+ *
+ * @param CoreIndex Index of the current core
+ * @return VOID
+ */
+VOID
+EventDispatchLeaveIndex(UINT32 CoreIndex)
+{
+    InterlockedIncrement64(&g_GuestState[CoreIndex].DebuggingState.EventDispatchEpoch);
+}
+
+/**
+ * @brief Save the epoch of cores for a snapshot that is unpublished
+ *
+ * @details should be called after the snapshot is unpublished, the cores
+ * that are in the index at this point might still use the snapshot
+ *
+ * @param Snapshot The unpublished snapshot
+ * @return VOID
+ */
+VOID
+EventDispatchRetireSnapshot(PEVENT_DISPATCH_SNAPSHOT Snapshot)
+{
+    for (size_t i = 0; i < Snapshot->ProcessorCount; i++)
+    {
+        Snapshot->RetireEpochs[i] = g_GuestState[i].DebuggingState.EventDispatchEpoch;
+    }
+}
+
+/**
+ * @brief Check whether an unpublished snapshot is still used
+ * by any core or not
+ *
+ * @param Snapshot The unpublished snapshot
+ * @return BOOLEAN TRUE if all the cores that were in the index when the
+ * snapshot is unpublished have left the index
+ */
+BOOLEAN
+EventDispatchIsSnapshotQuiescent(PEVENT_DISPATCH_SNAPSHOT Snapshot)
+{
+    for (size_t i = 0; i < Snapshot->ProcessorCount; i++)
+    {
+        if ((Snapshot->RetireEpochs[i] & 1) &&
+            Snapshot->RetireEpochs[i] == g_GuestState[i].DebuggingState.EventDispatchEpoch)
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Wait until all the cores that are in the dispatch index
+ * at this point leave the index
+ *
+ * @details should NOT be called in vmx-root, after that none of the
+ * snapshots that are unpublished before calling it are used
+ *
+ * @return VOID
+ */
+VOID
+EventDispatchWaitForQuiescence()
+{
+    ULONG  ProcessorCount = KeQueryActiveProcessorCount(0);
+    LONG64 Epoch;
+
+    if (g_GuestState == NULL)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < ProcessorCount; i++)
+    {
+        Epoch = g_GuestState[i].DebuggingState.EventDispatchEpoch;
+
+        if (!(Epoch & 1))
+        {
+            continue;
+        }
+
+        while (g_GuestState[i].DebuggingState.EventDispatchEpoch == Epoch)
+        {
+            YieldProcessor();
+        }
+    }
+}
+
+/**
+ * @brief Check whether the events of a special type are triggered
+ * for a special key (e.g., MSR, I/O port, vector) or not
+ *
+ * @param EventType Type of events
+ * @param IdentityHash Set to TRUE if keys are small integers
+ * that can be used directly as the index of the hash table
+ * @return BOOLEAN TRUE if the events are keyed by OptionalParam1
+ */
+BOOLEAN
+EventDispatchIsKeyedEventType(DEBUGGER_EVENT_TYPE_ENUM EventType, BOOLEAN * IdentityHash)
+{
+    *IdentityHash = FALSE;
+
+    switch (EventType)
+    {
+    case EXTERNAL_INTERRUPT_OCCURRED:
+    case EXCEPTION_OCCURRED:
+        *IdentityHash = TRUE;
+        return TRUE;
+    case RDMSR_INSTRUCTION_EXECUTION:
+    case WRMSR_INSTRUCTION_EXECUTION:
+    case IN_INSTRUCTION_EXECUTION:
+    case OUT_INSTRUCTION_EXECUTION:
+    case SYSCALL_HOOK_EFER_SYSCALL:
+    case HIDDEN_HOOK_EXEC_CC:
+    case HIDDEN_HOOK_EXEC_DETOURS:
+        return TRUE;
+    default:
+        //
+        // CPUID events don't have a leaf parameter (they're unconditional)
+        //
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Check whether a keyed event is applied to all of the keys
+ * (e.g., all MSRs) or not
+ *
+ * @param Event Event Object
+ * @return BOOLEAN TRUE if the event should be triggered for all keys
+ */
+BOOLEAN
+EventDispatchIsEventForAllKeys(PDEBUGGER_EVENT Event)
+{
+    switch (Event->EventType)
+    {
+    case RDMSR_INSTRUCTION_EXECUTION:
+    case WRMSR_INSTRUCTION_EXECUTION:
+        return Event->OptionalParam1 == DEBUGGER_EVENT_MSR_READ_OR_WRITE_ALL_MSRS;
+    case EXCEPTION_OCCURRED:
+        return Event->OptionalParam1 == DEBUGGER_EVENT_EXCEPTIONS_ALL_FIRST_32_ENTRIES;
+    case IN_INSTRUCTION_EXECUTION:
+    case OUT_INSTRUCTION_EXECUTION:
+        return Event->OptionalParam1 == DEBUGGER_EVENT_ALL_IO_PORTS;
+    case SYSCALL_HOOK_EFER_SYSCALL:
+        return Event->OptionalParam1 == DEBUGGER_EVENT_SYSCALL_ALL_SYSRET_OR_SYSCALLS;
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Check whether the events of a special type are triggered
+ * for a range of physical addresses or not
+ *
+ * @param EventType Type of events
+ * @return BOOLEAN TRUE if the events are ranges (OptionalParam1 to OptionalParam2)
+ */
+BOOLEAN
+EventDispatchIsRangeEventType(DEBUGGER_EVENT_TYPE_ENUM EventType)
+{
+    switch (EventType)
+    {
+    case HIDDEN_HOOK_READ_AND_WRITE:
+    case HIDDEN_HOOK_READ:
+    case HIDDEN_HOOK_WRITE:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+/**
+ * @brief Get the count of slots of the hash table of keys
+ *
+ * @param EventType Type of events
+ * @param Capacity Maximum count of events in each bucket
+ * @return UINT32 Count of slots (power of two) or zero if the
+ * events of this type are not keyed
+ */
+UINT32
+EventDispatchGetKeySlotsCount(DEBUGGER_EVENT_TYPE_ENUM EventType, UINT32 Capacity)
+{
+    BOOLEAN IdentityHash;
+    UINT32  SlotsCount = 8;
+
+    if (!EventDispatchIsKeyedEventType(EventType, &IdentityHash))
+    {
+        return 0;
+    }
+
+    if (IdentityHash)
+    {
+        SlotsCount = EVENT_DISPATCH_VECTOR_KEY_SLOTS;
+    }
+
+    //
+    // Keep the load factor of the table less than or equal to 0.5
+    //
+    while (SlotsCount < Capacity * 2)
+    {
+        SlotsCount = SlotsCount * 2;
+    }
+
+    return SlotsCount;
+}
+
+/**
+ * @brief Count the events of all segments of a list of range events
+ *
+ * @details should NOT be called in vmx-root, all (not only the enabled)
+ * events are counted, removing ranges or splitting them between the
+ * buckets only merges the segments, so the result is also the maximum
+ * count for the buckets of the snapshots that are filled in vmx-root
+ *
+ * @param TargetEventList The list of events of a special type
+ * @param TotalCount Count of events in the list
+ * @param RangeEventsCount Count of events of all segments
+ * @return BOOLEAN TRUE if the events are counted and the segments are
+ * not too large to be kept in the snapshots
+ */
+BOOLEAN
+EventDispatchCountRangeEvents(PLIST_ENTRY TargetEventList, UINT32 TotalCount, UINT32 * RangeEventsCount)
+{
+    PLIST_ENTRY TempList    = 0;
+    UINT64 *    Bounds      = NULL;
+    UINT32      BoundsCount = 0;
+    UINT64      Count       = 0;
+
+    *RangeEventsCount = 0;
+
+    Bounds = ExAllocatePoolWithTag(NonPagedPool, 2 * TotalCount * sizeof(UINT64), POOLTAG);
+
+    if (!Bounds)
+    {
+        return FALSE;
+    }
+
+    TempList = TargetEventList;
+
+    while (TargetEventList != TempList->Flink && BoundsCount + 2 <= 2 * TotalCount)
+    {
+        TempList                     = TempList->Flink;
+        PDEBUGGER_EVENT CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+
+        if (CurrentEvent->OptionalParam1 < CurrentEvent->OptionalParam2)
+        {
+            Bounds[BoundsCount]     = CurrentEvent->OptionalParam1;
+            Bounds[BoundsCount + 1] = CurrentEvent->OptionalParam2;
+            BoundsCount += 2;
+        }
+    }
+
+    BoundsCount = EventDispatchSortBounds(Bounds, BoundsCount);
+
+    //
+    // Each range is added to all of the segments between its bounds
+    //
+    TempList = TargetEventList;
+
+    while (TargetEventList != TempList->Flink)
+    {
+        TempList                     = TempList->Flink;
+        PDEBUGGER_EVENT CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+
+        if (CurrentEvent->OptionalParam1 < CurrentEvent->OptionalParam2)
+        {
+            Count += EventDispatchFindSegment(Bounds, BoundsCount, CurrentEvent->OptionalParam2) -
+                     EventDispatchFindSegment(Bounds, BoundsCount, CurrentEvent->OptionalParam1);
+        }
+    }
+
+    ExFreePoolWithTag(Bounds, POOLTAG);
+
+    //
+    // Each snapshot (one for each core and the standby snapshots) keeps
+    // all of the segments, so nested ranges are not indexed
+    //
+    if (Count > (UINT64)TotalCount * EVENT_DISPATCH_MAXIMUM_SEGMENTS_PER_RANGE_EVENT ||
+        Count > (MAXULONG / sizeof(EVENT_DISPATCH_ENTRY)))
+    {
+        return FALSE;
+    }
+
+    *RangeEventsCount = (UINT32)Count;
+
+    return TRUE;
+}
+
+/**
+ * @brief Allocate a snapshot for the dispatch index
+ *
+ * @details should NOT be called in vmx-root
+ *
+ * @param EventType Type of events
+ * @param Capacity Maximum count of events in each bucket
+ * @param RangeEventsCapacity Maximum count of events of all segments in
+ * each bucket (only for the events that are ranges of addresses)
+ * @param ProcessorCount Count of logical cores
+ * @return PEVENT_DISPATCH_SNAPSHOT Returns null in the case of error
+ */
+PEVENT_DISPATCH_SNAPSHOT
+EventDispatchAllocateSnapshot(DEBUGGER_EVENT_TYPE_ENUM EventType, UINT32 Capacity, UINT32 RangeEventsCapacity, UINT32 ProcessorCount)
+{
+    PEVENT_DISPATCH_SNAPSHOT Snapshot;
+    UINT64                   Storage;
+    SIZE_T                   HeaderSize;
+    SIZE_T                   BucketStorageSize;
+    SIZE_T                   Size;
+    UINT32                   KeySlotsCount;
+    BOOLEAN                  IdentityHash;
+    BOOLEAN                  IsKeyed;
+    BOOLEAN                  IsRange;
+
+    IsKeyed       = EventDispatchIsKeyedEventType(EventType, &IdentityHash);
+    IsRange       = EventDispatchIsRangeEventType(EventType);
+    KeySlotsCount = EventDispatchGetKeySlotsCount(EventType, Capacity);
+
+    //
+    // Each bucket needs storage for events and if the events are
+    // keyed, then for keyed events and the hash table of keys
+    //
+    BucketStorageSize = Capacity * sizeof(EVENT_DISPATCH_ENTRY);
+
+    if (IsKeyed)
+    {
+        BucketStorageSize += (Capacity * sizeof(EVENT_DISPATCH_ENTRY)) + (KeySlotsCount * sizeof(EVENT_DISPATCH_KEY_SLOT));
+    }
+
+    if (IsRange)
+    {
+        //
+        // Each range adds two bounds, so there are at most 2 * Capacity
+        // bounds and 2 * Capacity - 1 segments (plus the end of the last one)
+        //
+        BucketStorageSize += (Capacity * sizeof(EVENT_DISPATCH_RANGE)) + (2 * Capacity * sizeof(UINT64)) +
+                             (RangeEventsCapacity * sizeof(EVENT_DISPATCH_ENTRY)) + (2 * Capacity * sizeof(UINT32));
+    }
+
+    HeaderSize = FIELD_OFFSET(EVENT_DISPATCH_SNAPSHOT, Buckets) + (ProcessorCount * sizeof(EVENT_DISPATCH_BUCKET)) +
+                 (ProcessorCount * sizeof(LONG64));
+    Size = HeaderSize + (ProcessorCount * BucketStorageSize);
+
+    Snapshot = ExAllocatePoolWithTag(NonPagedPool, Size, POOLTAG);
+
+    if (!Snapshot)
+    {
+        return NULL;
+    }
+
+    RtlZeroMemory(Snapshot, Size);
+
+    Snapshot->Capacity            = Capacity;
+    Snapshot->RangeEventsCapacity = RangeEventsCapacity;
+    Snapshot->ProcessorCount      = ProcessorCount;
+
+    //
+    // Epochs are located after the buckets (zero means that the
+    // snapshot is not used by any core)
+    //
+    Snapshot->RetireEpochs = (LONG64 *)((UINT64)Snapshot + FIELD_OFFSET(EVENT_DISPATCH_SNAPSHOT, Buckets) +
+                                        (ProcessorCount * sizeof(EVENT_DISPATCH_BUCKET)));
+
+    //
+    // Storage of buckets is located after the epochs
+    //
+    Storage = (UINT64)Snapshot + HeaderSize;
+
+    for (size_t i = 0; i < ProcessorCount; i++)
+    {
+        Snapshot->Buckets[i].Events = (PEVENT_DISPATCH_ENTRY)Storage;
+        Storage += Capacity * sizeof(EVENT_DISPATCH_ENTRY);
+
+        if (IsKeyed)
+        {
+            Snapshot->Buckets[i].KeyedEvents = (PEVENT_DISPATCH_ENTRY)Storage;
+            Storage += Capacity * sizeof(EVENT_DISPATCH_ENTRY);
+
+            Snapshot->Buckets[i].KeySlots = (PEVENT_DISPATCH_KEY_SLOT)Storage;
+            Storage += KeySlotsCount * sizeof(EVENT_DISPATCH_KEY_SLOT);
+
+            Snapshot->Buckets[i].KeySlotsMask = KeySlotsCount - 1;
+            Snapshot->Buckets[i].IdentityHash = IdentityHash;
+        }
+
+        if (IsRange)
+        {
+            Snapshot->Buckets[i].Ranges = (PEVENT_DISPATCH_RANGE)Storage;
+            Storage += Capacity * sizeof(EVENT_DISPATCH_RANGE);
+
+            Snapshot->Buckets[i].Bounds = (UINT64 *)Storage;
+            Storage += 2 * Capacity * sizeof(UINT64);
+
+            Snapshot->Buckets[i].RangeEvents = (PEVENT_DISPATCH_ENTRY)Storage;
+            Storage += RangeEventsCapacity * sizeof(EVENT_DISPATCH_ENTRY);
+
+            Snapshot->Buckets[i].Segments = (UINT32 *)Storage;
+            Storage += 2 * Capacity * sizeof(UINT32);
+        }
+    }
+
+    return Snapshot;
+}
+
+/**
+ * @brief Fill the buckets of a snapshot based on the list of events
+ *
+ * @param Snapshot Target snapshot
+ * @param TargetEventList The list of events of a special type
+ * @return BOOLEAN TRUE if all of the enabled events fit into the snapshot
+ */
+BOOLEAN
+EventDispatchFillSnapshot(PEVENT_DISPATCH_SNAPSHOT Snapshot, PLIST_ENTRY TargetEventList)
+{
+    PLIST_ENTRY            TempList = 0;
+    PEVENT_DISPATCH_BUCKET Bucket;
+    PEVENT_DISPATCH_ENTRY  Entry;
+    PEVENT_DISPATCH_RANGE  Range;
+    UINT32                 Order = 0;
+
+    for (size_t i = 0; i < Snapshot->ProcessorCount; i++)
+    {
+        Snapshot->Buckets[i].Count       = 0;
+        Snapshot->Buckets[i].KeyedCount  = 0;
+        Snapshot->Buckets[i].RangesCount = 0;
+    }
+
+    //
+    // Events are added based on their order in the list, so actions
+    // are performed in the same order as walking the list
+    //
+    TempList = TargetEventList;
+
+    while (TargetEventList != TempList->Flink)
+    {
+        TempList                     = TempList->Flink;
+        PDEBUGGER_EVENT CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+
+        if (!CurrentEvent->Enabled)
+        {
+            continue;
+        }
+
+        for (size_t i = 0; i < Snapshot->ProcessorCount; i++)
+        {
+            if (CurrentEvent->CoreId != DEBUGGER_EVENT_APPLY_TO_ALL_CORES && CurrentEvent->CoreId != i)
+            {
+                continue;
+            }
+
+            Bucket = &Snapshot->Buckets[i];
+
+            if (Bucket->Ranges != NULL)
+            {
+                if (Bucket->RangesCount >= Snapshot->Capacity)
+                {
+                    return FALSE;
+                }
+
+                Range = &Bucket->Ranges[Bucket->RangesCount];
+                Bucket->RangesCount++;
+
+                Range->Start = CurrentEvent->OptionalParam1;
+                Range->End   = CurrentEvent->OptionalParam2;
+                Range->Event = CurrentEvent;
+                Range->Order = Order;
+
+                continue;
+            }
+
+            if (Bucket->KeySlotsMask != 0 && !EventDispatchIsEventForAllKeys(CurrentEvent))
+            {
+                if (Bucket->KeyedCount >= Snapshot->Capacity)
+                {
+                    return FALSE;
+                }
+
+                Entry = &Bucket->KeyedEvents[Bucket->KeyedCount];
+                Bucket->KeyedCount++;
+            }
+            else
+            {
+                if (Bucket->Count >= Snapshot->Capacity)
+                {
+                    return FALSE;
+                }
+
+                Entry = &Bucket->Events[Bucket->Count];
+                Bucket->Count++;
+            }
+
+            Entry->Event = CurrentEvent;
+            Entry->Order = Order;
+        }
+
+        Order++;
+    }
+
+    for (size_t i = 0; i < Snapshot->ProcessorCount; i++)
+    {
+        if (Snapshot->Buckets[i].KeySlotsMask != 0)
+        {
+            EventDispatchBuildKeySlots(&Snapshot->Buckets[i]);
+        }
+
+        if (Snapshot->Buckets[i].Ranges != NULL && !EventDispatchBuildRanges(&Snapshot->Buckets[i], Snapshot->RangeEventsCapacity))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Rebuild the dispatch index of a special event type
+ *
+ * @details In vmx-root, we're not allowed to allocate pools and other
+ * cores might be halted in the middle of triggering events, thus, one of
+ * the standby snapshots that is not used anymore is filled and published,
+ * the standby snapshots are allocated based on the count of all (not only
+ * the enabled) events of the type, if there is no such standby snapshot,
+ * the triggers walk the list of events until the next rebuild
+ *
+ * @param EventType Type of events
+ * @return BOOLEAN TRUE if the index is usable, FALSE if the triggers
+ * should walk the list of events
+ */
+BOOLEAN
+EventDispatchRebuild(DEBUGGER_EVENT_TYPE_ENUM EventType)
+{
+    PEVENT_DISPATCH_TYPE_INDEX TypeIndex;
+    PEVENT_DISPATCH_SNAPSHOT   NewSnapshot = NULL;
+    PEVENT_DISPATCH_SNAPSHOT   OldSnapshot;
+    PEVENT_DISPATCH_SNAPSHOT   StandbySnapshots[EVENT_DISPATCH_STANDBY_SNAPSHOTS] = {0};
+    PLIST_ENTRY                TargetEventList;
+    UINT32                     TotalCount;
+    UINT32                     RangeEventsCount = 0;
+    UINT32                     ProcessorCount;
+    BOOLEAN                    UseListWalk = FALSE;
+
+    if (!g_EventDispatchIndexInitialized || EventType >= EVENT_DISPATCH_MAXIMUM_EVENT_TYPES)
+    {
+        return FALSE;
+    }
+
+    TargetEventList = DebuggerGetEventListByEventType(EventType);
+
+    if (TargetEventList == NULL)
+    {
+        return FALSE;
+    }
+
+    TypeIndex = &g_EventDispatchIndex[EventType];
+
+    if (g_GuestState[KeGetCurrentProcessorNumber()].IsOnVmxRootMode)
+    {
+        for (size_t i = 0; i < EVENT_DISPATCH_STANDBY_SNAPSHOTS; i++)
+        {
+            NewSnapshot = TypeIndex->StandbySnapshots[i];
+
+            if (NewSnapshot == NULL || !EventDispatchIsSnapshotQuiescent(NewSnapshot))
+            {
+                continue;
+            }
+
+            if (!EventDispatchFillSnapshot(NewSnapshot, TargetEventList))
+            {
+                //
+                // All the standby snapshots have the same capacity
+                //
+                break;
+            }
+
+            OldSnapshot = InterlockedExchangePointer((PVOID volatile *)&TypeIndex->Snapshot, NewSnapshot);
+
+            if (OldSnapshot != NULL)
+            {
+                EventDispatchRetireSnapshot(OldSnapshot);
+            }
+
+            TypeIndex->StandbySnapshots[i] = OldSnapshot;
+            TypeIndex->ListWalkFallback    = FALSE;
+
+            return TRUE;
+        }
+
+        //
+        // The published snapshot is not modified as other cores might use it
+        //
+        TypeIndex->ListWalkFallback = TRUE;
+
+        return FALSE;
+    }
+
+    ProcessorCount = KeQueryActiveProcessorCount(0);
+    TotalCount     = DebuggerEventListCount(TargetEventList);
+
+    if (TotalCount != 0)
+    {
+        if (!EventDispatchIsRangeEventType(EventType) || EventDispatchCountRangeEvents(TargetEventList, TotalCount, &RangeEventsCount))
+        {
+            NewSnapshot = EventDispatchAllocateSnapshot(EventType, TotalCount, RangeEventsCount, ProcessorCount);
+        }
+
+        if (NewSnapshot == NULL || !EventDispatchFillSnapshot(NewSnapshot, TargetEventList))
+        {
+            //
+            // Not enough resources (or too many segments of nested
+            // ranges), we use the list of events
+            //
+            if (NewSnapshot != NULL)
+            {
+                ExFreePoolWithTag(NewSnapshot, POOLTAG);
+                NewSnapshot = NULL;
+            }
+
+            UseListWalk = TRUE;
+        }
+        else
+        {
+            //
+            // Standby snapshots are optional, without them the rebuilds
+            // in vmx-root walk the list of events
+            //
+            for (size_t i = 0; i < EVENT_DISPATCH_STANDBY_SNAPSHOTS; i++)
+            {
+                StandbySnapshots[i] = EventDispatchAllocateSnapshot(EventType, TotalCount, RangeEventsCount, ProcessorCount);
+            }
+        }
+    }
+
+    if (UseListWalk)
+    {
+        TypeIndex->ListWalkFallback = TRUE;
+    }
+
+    OldSnapshot = InterlockedExchangePointer((PVOID volatile *)&TypeIndex->Snapshot, NewSnapshot);
+
+    if (!UseListWalk)
+    {
+        TypeIndex->ListWalkFallback = FALSE;
+    }
+
+    //
+    // The previous snapshot and the standby snapshots might still be used
+    // by other cores (they might also point to an event that is going to
+    // be freed after the rebuild), so we wait for them before freeing
+    //
+    EventDispatchWaitForQuiescence();
+
+    if (OldSnapshot != NULL)
+    {
+        ExFreePoolWithTag(OldSnapshot, POOLTAG);
+    }
+
+    for (size_t i = 0; i < EVENT_DISPATCH_STANDBY_SNAPSHOTS; i++)
+    {
+        if (TypeIndex->StandbySnapshots[i] != NULL)
+        {
+            ExFreePoolWithTag(TypeIndex->StandbySnapshots[i], POOLTAG);
+        }
+
+        TypeIndex->StandbySnapshots[i] = StandbySnapshots[i];
+    }
+
+    return !UseListWalk;
+}
+
+/**
+ * @brief Rebuild the dispatch index of all event types
+ *
+ * @return VOID
+ */
+VOID
+EventDispatchRebuildAll()
+{
+    for (UINT32 i = 0; i < EVENT_DISPATCH_MAXIMUM_EVENT_TYPES; i++)
+    {
+        EventDispatchRebuild(i);
+    }
+}
+
+/**
+ * @brief Get the bucket of events that are allowed to be triggered
+ * on the target core
+ *
+ * @details should be called in vmx-root after entering the index
+ *
+ * @param EventType Type of events
+ * @param CoreIndex Index of the current core
+ * @param UseListWalk Set to TRUE if the index is not usable and the
+ * caller should walk the list of events
+ * @return PEVENT_DISPATCH_BUCKET The bucket, or null if there is nothing
+ * to trigger
+ */
+PEVENT_DISPATCH_BUCKET
+EventDispatchGetBucket(DEBUGGER_EVENT_TYPE_ENUM EventType, UINT32 CoreIndex, BOOLEAN * UseListWalk)
+{
+    PEVENT_DISPATCH_TYPE_INDEX TypeIndex;
+    PEVENT_DISPATCH_SNAPSHOT   Snapshot;
+
+    *UseListWalk = FALSE;
+
+    if (!g_EventDispatchIndexInitialized || EventType >= EVENT_DISPATCH_MAXIMUM_EVENT_TYPES)
+    {
+        *UseListWalk = TRUE;
+        return NULL;
+    }
+
+    TypeIndex = &g_EventDispatchIndex[EventType];
+
+    if (TypeIndex->ListWalkFallback)
+    {
+        *UseListWalk = TRUE;
+        return NULL;
+    }
+
+    Snapshot = TypeIndex->Snapshot;
+
+    if (Snapshot == NULL)
+    {
+        //
+        // There is no event of this type
+        //
+        return NULL;
+    }
+
+    if (CoreIndex >= Snapshot->ProcessorCount)
+    {
+        *UseListWalk = TRUE;
+        return NULL;
+    }
+
+    return &Snapshot->Buckets[CoreIndex];
+}
@@ -64,6 +64,11 @@ KdInitializeKernelDebugger()
     InitializeListHead(&g_BreakpointsListHead);
     g_MaximumBreakpointId = 0;
 
+    //
+    // Scripts of the previous debugger are not valid anymore
+    //
+    RtlZeroMemory(&g_KdScriptCache, sizeof(KD_SCRIPT_CACHE));
+
     //
     // Indicate that kernel debugger is active
     //
@@ -226,6 +231,7 @@ KdResponsePacketToDebugger(
     //
     Packet.Indicator       = INDICATOR_OF_HYPERDBG_PACKER;
     Packet.TypeOfThePacket = PacketType;
+    Packet.SequenceNumber  = g_KdSequenceNumberOfRequest;
 
     //
     // Set the requested action
@@ -1161,6 +1167,146 @@ KdSendFormatsFunctionResult(UINT64 Value)
         sizeof(DEBUGGEE_FORMATS_PACKET));
 }
 
+/**
+ * @brief Get the script that should be run from the script cache
+ * @details if the buffer of the script is sent, then it's kept for the
+ * next runs (if there is enough space), otherwise the script is found
+ * based on its hash
+ * 
+ * @param ScriptPacket The received script packet
+ * @param ScriptBuffer The received buffer of the script (if it's sent)
+ * 
+ * @return PDEBUGGEE_SCRIPT_PACKET the script packet that its buffer is
+ * right after it (the received packet if the buffer is sent) or NULL if
+ * the script is not cached
+ */
+PDEBUGGEE_SCRIPT_PACKET
+KdGetScriptFromCache(PDEBUGGEE_SCRIPT_PACKET ScriptPacket, CHAR * ScriptBuffer)
+{
+    PKD_SCRIPT_CACHE_ENTRY Entry = NULL;
+
+    for (UINT32 i = 0; i < DEBUGGEE_SCRIPT_CACHE_MAXIMUM_ENTRIES; i++)
+    {
+        if (g_KdScriptCache.Entries[i].LastUse != 0 &&
+            g_KdScriptCache.Entries[i].Hash == ScriptPacket->ScriptHash)
+        {
+            Entry = &g_KdScriptCache.Entries[i];
+            break;
+        }
+    }
+
+    if (ScriptPacket->IsCachedScript)
+    {
+        if (Entry == NULL)
+        {
+            return NULL;
+        }
+
+        Entry->LastUse               = ++g_KdScriptCache.UseCounter;
+        Entry->ScriptPacket.IsFormat = ScriptPacket->IsFormat;
+
+        return &Entry->ScriptPacket;
+    }
+
+    //
+    // The buffer of the script is sent, if it's already in the cache then
+    // it's the most recently used script (the same as the debugger)
+    //
+    if (Entry != NULL)
+    {
+        Entry->LastUse = ++g_KdScriptCache.UseCounter;
+
+        return ScriptPacket;
+    }
+
+    //
+    // Otherwise, it's kept if it's small enough
+    //
+    if (ScriptPacket->ScriptBufferSize > DEBUGGEE_SCRIPT_CACHE_MAXIMUM_SCRIPT_SIZE)
+    {
+        return ScriptPacket;
+    }
+
+    //
+    // Replace an unused entry or the least recently used one
+    //
+    Entry = &g_KdScriptCache.Entries[0];
+
+    for (UINT32 i = 1; i < DEBUGGEE_SCRIPT_CACHE_MAXIMUM_ENTRIES && Entry->LastUse != 0; i++)
+    {
+        if (g_KdScriptCache.Entries[i].LastUse < Entry->LastUse)
+        {
+            Entry = &g_KdScriptCache.Entries[i];
+        }
+    }
+
+    Entry->Hash         = ScriptPacket->ScriptHash;
+    Entry->LastUse      = ++g_KdScriptCache.UseCounter;
+    Entry->ScriptPacket = *ScriptPacket;
+
+    memcpy(Entry->ScriptBuffer,
+           ScriptBuffer,
+           ScriptPacket->ScriptBufferSize);
+
+    return ScriptPacket;
+}
+
+/**
+ * @brief Get the script of an action from the script cache
+ * @details the same as the scripts that are run, if the buffer of the
+ * script is sent, then it's kept for the next runs and actions, otherwise
+ * the script is found based on its hash and it's copied after the action
+ * 
+ * @param ActionHeader The received action packet
+ * @param MaximumLength Maximum length of the action and its script
+ * 
+ * @return BOOLEAN FALSE if the script is not cached
+ */
+BOOLEAN
+KdGetActionScriptFromCache(PDEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET ActionHeader, UINT32 MaximumLength)
+{
+    PDEBUGGER_GENERAL_ACTION Action = (PDEBUGGER_GENERAL_ACTION)((CHAR *)ActionHeader +
+                                                                 sizeof(DEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET));
+    DEBUGGEE_SCRIPT_PACKET   ScriptPacket = {0};
+    PDEBUGGEE_SCRIPT_PACKET  CachedScriptPacket;
+
+    //
+    // Only the scripts of the actions are cached (the same as the debugger)
+    //
+    if (ActionHeader->Length < sizeof(DEBUGGER_GENERAL_ACTION) ||
+        Action->ActionType != RUN_SCRIPT ||
+        Action->ScriptBufferSize == 0 ||
+        ActionHeader->Length != sizeof(DEBUGGER_GENERAL_ACTION) + Action->ScriptBufferSize)
+    {
+        return !ActionHeader->IsCachedScript;
+    }
+
+    ScriptPacket.ScriptBufferSize    = Action->ScriptBufferSize;
+    ScriptPacket.ScriptBufferPointer = Action->ScriptBufferPointer;
+    ScriptPacket.ScriptHash          = ActionHeader->ScriptHash;
+    ScriptPacket.IsCachedScript      = ActionHeader->IsCachedScript;
+
+    CachedScriptPacket = KdGetScriptFromCache(&ScriptPacket, (CHAR *)Action + sizeof(DEBUGGER_GENERAL_ACTION));
+
+    if (!ActionHeader->IsCachedScript)
+    {
+        return TRUE;
+    }
+
+    if (CachedScriptPacket == NULL ||
+        CachedScriptPacket->ScriptBufferSize != Action->ScriptBufferSize ||
+        ActionHeader->Length > MaximumLength)
+    {
+        return FALSE;
+    }
+
+    memcpy((CHAR *)Action + sizeof(DEBUGGER_GENERAL_ACTION),
+           (CHAR *)CachedScriptPacket + sizeof(DEBUGGEE_SCRIPT_PACKET),
+           Action->ScriptBufferSize);
+
+    return TRUE;
+}
+
 /**
  * @brief Notify debugger that the execution of command finished
  * 
@@ -1737,16 +1883,25 @@ KdDispatchAndPerformCommandsFromDebugger(ULONG CurrentCore, PGUEST_REGS GuestReg
     PDEBUGGER_EDIT_MEMORY                               EditMemoryPacket;
     PDEBUGGEE_DETAILS_AND_SWITCH_PROCESS_PACKET         ChangeProcessPacket;
     PDEBUGGEE_SCRIPT_PACKET                             ScriptPacket;
+    PDEBUGGEE_SCRIPT_PACKET                             CachedScriptPacket;
     PDEBUGGEE_USER_INPUT_PACKET                         UserInputPacket;
     PDEBUGGEE_BP_PACKET                                 BpPacket;
     PDEBUGGEE_BP_LIST_OR_MODIFY_PACKET                  BpListOrModifyPacket;
     PDEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET EventRegPacket;
     PDEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET AddActionPacket;
+    DEBUGGER_EVENT_AND_ACTION_REG_BUFFER                AddActionResult = {0};
     PDEBUGGER_MODIFY_EVENTS                             QueryAndModifyEventPacket;
+    PDEBUGGEE_AGGREGATION_MAPS_PACKET                   AggregationMapsPacket;
     UINT32                                              SizeToSend       = 0;
     BOOLEAN                                             UnlockTheNewCore = FALSE;
     size_t                                              ReturnSize       = 0;
 
+    //
+    // The debugger might send the next requests while the debuggee is
+    // sending a response, these bytes are kept until they're parsed
+    //
+    g_SerialConnectionKeepReceivedBytes = TRUE;
+
     while (TRUE)
     {
         BOOLEAN                 EscapeFromTheLoop               = FALSE;
@@ -1771,7 +1926,7 @@ KdDispatchAndPerformCommandsFromDebugger(ULONG CurrentCore, PGUEST_REGS GuestReg
             //
             // Check checksum
             //
-            if (KdComputeDataChecksum((PVOID)&TheActualPacket->Indicator,
+            if (KdComputeDataChecksum((PVOID)((UINT64)TheActualPacket + 1),
                                       RecvBufferLength - sizeof(BYTE)) !=
                 TheActualPacket->Checksum)
             {
@@ -1779,6 +1934,18 @@ KdDispatchAndPerformCommandsFromDebugger(ULONG CurrentCore, PGUEST_REGS GuestReg
                 continue;
             }
 
+            //
+            // The requests are answered in order, the response of this request
+            // carries its sequence number
+            //
+            g_KdSequenceNumberOfRequest = TheActualPacket->SequenceNumber;
+
+            //
+            // The debugger requests compressed frames in each of its requests,
+            // so it's possible to disable it while the debuggee is connected
+            //
+            g_SerialConnectionCompressFrames = (TheActualPacket->Flags & DEBUGGER_REMOTE_PACKET_FLAG_COMPRESSED_FRAMES) != 0;
+
             //
             // Check if the packet type is correct
             //
@@ -2087,14 +2254,28 @@ KdDispatchAndPerformCommandsFromDebugger(ULONG CurrentCore, PGUEST_REGS GuestReg
                 ScriptPacket = (DEBUGGEE_SCRIPT_PACKET *)(((CHAR *)TheActualPacket) +
                                                           sizeof(DEBUGGER_REMOTE_PACKET));
 
+                //
+                // Find the script if only its hash is sent (or keep the
+                // script for the next runs)
+                //
+                CachedScriptPacket = KdGetScriptFromCache(ScriptPacket, (CHAR *)ScriptPacket + sizeof(DEBUGGEE_SCRIPT_PACKET));
+
+                if (CachedScriptPacket == NULL)
+                {
+                    //
+                    // The debugger should send the buffer of the script
+                    //
+                    ScriptPacket->Result = DEBUGGER_ERROR_SCRIPT_IS_NOT_CACHED;
+                }
+
                 //
                 // Run the script in debuggee
                 //
-                if (DebuggerPerformRunScript(OPERATION_LOG_INFO_MESSAGE /* simple print */,
-                                             NULL,
-                                             ScriptPacket,
-                                             GuestRegs,
-                                             g_DebuggeeHaltContext))
+                else if (DebuggerPerformRunScript(OPERATION_LOG_INFO_MESSAGE /* simple print */,
+                                                  NULL,
+                                                  CachedScriptPacket,
+                                                  GuestRegs,
+                                                  g_DebuggeeHaltContext))
                 {
                     //
                     // Set status
@@ -2161,6 +2342,29 @@ KdDispatchAndPerformCommandsFromDebugger(ULONG CurrentCore, PGUEST_REGS GuestReg
                 AddActionPacket = (DEBUGGER_GENERAL_ACTION *)(((CHAR *)TheActualPacket) +
                                                               sizeof(DEBUGGER_REMOTE_PACKET));
 
+                //
+                // Copy the script of the action if only its hash is sent (or
+                // keep the script for the next actions)
+                //
+                if (!KdGetActionScriptFromCache(AddActionPacket,
+                                                MaxSerialPacketSize - sizeof(DEBUGGER_REMOTE_PACKET) -
+                                                    sizeof(DEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET)))
+                {
+                    //
+                    // The debugger should send the buffer of the script, the
+                    // debuggee is not continued
+                    //
+                    AddActionResult.IsSuccessful = FALSE;
+                    AddActionResult.Error        = DEBUGGER_ERROR_SCRIPT_IS_NOT_CACHED;
+
+                    KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                               DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_ADDING_ACTION_TO_EVENT,
+                                               &AddActionResult,
+                                               sizeof(DEBUGGER_EVENT_AND_ACTION_REG_BUFFER));
+
+                    break;
+                }
+
                 //
                 // Send the action buffer to user-mode debuggee
                 //
@@ -2267,6 +2471,28 @@ KdDispatchAndPerformCommandsFromDebugger(ULONG CurrentCore, PGUEST_REGS GuestReg
 
                 break;
 
+            case DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_QUERY_AGGREGATION_MAPS:
+
+                AggregationMapsPacket = (DEBUGGEE_AGGREGATION_MAPS_PACKET *)(((CHAR *)TheActualPacket) +
+                                                                             sizeof(DEBUGGER_REMOTE_PACKET));
+
+                //
+                // Merge the requested part of the maps of the halted cores,
+                // the entries are copied after the packet in the receive buffer
+                //
+                DebuggerQueryAggregationMapsOfHaltedCores(AggregationMapsPacket);
+
+                //
+                // Send the result of querying the maps back to the debugger
+                //
+                KdResponsePacketToDebugger(DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER,
+                                           DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_QUERYING_AGGREGATION_MAPS,
+                                           AggregationMapsPacket,
+                                           sizeof(DEBUGGEE_AGGREGATION_MAPS_PACKET) +
+                                               AggregationMapsPacket->CountOfSentEntries * sizeof(SCRIPT_ENGINE_AGGREGATION_ENTRY));
+
+                break;
+
             default:
                 LogError("Err, unknown packet action received from the debugger\n");
                 break;
@@ -2286,6 +2512,15 @@ KdDispatchAndPerformCommandsFromDebugger(ULONG CurrentCore, PGUEST_REGS GuestReg
         //
         if (EscapeFromTheLoop)
         {
+            //
+            // Packets that are sent after continuing are not responses and
+            // the serial port belongs to the operating system again
+            //
+            g_KdSequenceNumberOfRequest          = 0;
+            g_SerialConnectionKeepReceivedBytes  = FALSE;
+            g_SerialConnectionReceiveBuffer.Head = 0;
+            g_SerialConnectionReceiveBuffer.Tail = 0;
+
             break;
         }
     }
@@ -57,7 +57,6 @@ EptHookPerformPageHook(PVOID TargetAddress, CR3_TYPE ProcessCr3)
     BYTE                    OriginalByte;
     PEPT_HOOKED_PAGE_DETAIL HookedEntry      = NULL;
     BOOLEAN                 HookedEntryFound = FALSE;
-    PLIST_ENTRY             TempList         = 0;
 
     //
     // Check whether we are in VMX Root Mode or Not
@@ -96,21 +95,14 @@ EptHookPerformPageHook(PVOID TargetAddress, CR3_TYPE ProcessCr3)
     //
     // try to see if we can find the address
     //
-    TempList = &g_EptState->HookedPagesList;
+    HookedEntry = EptFindHookedPageByPhysicalAddress(PhysicalBaseAddress);
 
-    while (&g_EptState->HookedPagesList != TempList->Flink)
+    if (HookedEntry != NULL)
     {
-        TempList    = TempList->Flink;
-        HookedEntry = CONTAINING_RECORD(TempList, EPT_HOOKED_PAGE_DETAIL, PageHookList);
-
-        if (HookedEntry->PhysicalBaseAddress == PhysicalBaseAddress)
-        {
-            //
-            // Means that we find the address
-            //
-            HookedEntryFound = TRUE;
-            break;
-        }
+        //
+        // Means that we find the address
+        //
+        HookedEntryFound = TRUE;
     }
 
     //
@@ -168,6 +160,11 @@ EptHookPerformPageHook(PVOID TargetAddress, CR3_TYPE ProcessCr3)
         // Add to the breakpoint counts
         //
         HookedEntry->CountOfBreakpoints = HookedEntry->CountOfBreakpoints + 1;
+
+        //
+        // Make the breakpoint visible to the #BP handler
+        //
+        EptHookedPagesTableInsert(&g_EptState->HiddenBreakpointsTable, (UINT64)TargetAddress, HookedEntry);
     }
     else
     {
@@ -326,6 +323,12 @@ EptHookPerformPageHook(PVOID TargetAddress, CR3_TYPE ProcessCr3)
         //
         InsertHeadList(&g_EptState->HookedPagesList, &(HookedPage->PageHookList));
 
+        //
+        // Make it visible to the EPT violation and #BP handlers
+        //
+        EptHookedPagesTableInsert(&g_EptState->HookedPagesTable, PhysicalBaseAddress >> PAGE_SHIFT, HookedPage);
+        EptHookedPagesTableInsert(&g_EptState->HiddenBreakpointsTable, (UINT64)TargetAddress, HookedPage);
+
         //
         // if not launched, there is no need to modify it on a safe environment
         //
@@ -374,6 +377,14 @@ EptHook(PVOID TargetAddress, UINT32 ProcessId)
     //
     LogicalCoreIndex = KeGetCurrentProcessorIndex();
 
+    if (!g_GuestState[LogicalCoreIndex].IsOnVmxRootMode)
+    {
+        //
+        // Make sure that the hash tables of hooked pages have their pools
+        //
+        EptHookedPagesTablesReserve();
+    }
+
     if (g_GuestState[LogicalCoreIndex].HasLaunched)
     {
         //
@@ -428,7 +439,7 @@ EptHook(PVOID TargetAddress, UINT32 ProcessId)
 BOOLEAN
 EptHookRestoreSingleHookToOrginalEntry(SIZE_T PhysicalAddress)
 {
-    PLIST_ENTRY TempList = 0;
+    PEPT_HOOKED_PAGE_DETAIL HookedEntry = NULL;
 
     //
     // Should be called from vmx-root, for calling from vmx non-root use the corresponding VMCALL
@@ -438,20 +449,16 @@ EptHookRestoreSingleHookToOrginalEntry(SIZE_T PhysicalAddress)
         return FALSE;
     }
 
-    TempList = &g_EptState->HookedPagesList;
-    while (&g_EptState->HookedPagesList != TempList->Flink)
+    HookedEntry = EptFindHookedPageByPhysicalAddress(PhysicalAddress);
+
+    if (HookedEntry != NULL)
     {
-        TempList                            = TempList->Flink;
-        PEPT_HOOKED_PAGE_DETAIL HookedEntry = CONTAINING_RECORD(TempList, EPT_HOOKED_PAGE_DETAIL, PageHookList);
-        if (HookedEntry->PhysicalBaseAddress == PAGE_ALIGN(PhysicalAddress))
-        {
-            //
-            // Undo the hook on the EPT table
-            //
-            EptSetPML1AndInvalidateTLB(HookedEntry->EntryAddress, HookedEntry->OriginalEntry, INVEPT_SINGLE_CONTEXT);
+        //
+        // Undo the hook on the EPT table
+        //
+        EptSetPML1AndInvalidateTLB(HookedEntry->EntryAddress, HookedEntry->OriginalEntry, INVEPT_SINGLE_CONTEXT);
 
-            return TRUE;
-        }
+        return TRUE;
     }
     //
     // Nothing found, probably the list is not found
@@ -734,7 +741,6 @@ EptHookPerformPageHook2(PVOID TargetAddress, PVOID HookFunction, CR3_TYPE Proces
     PEPT_HOOKED_PAGE_DETAIL HookedPage;
     ULONG                   LogicalCoreIndex;
     CR3_TYPE                Cr3OfCurrentProcess;
-    PLIST_ENTRY             TempList    = 0;
     PEPT_HOOKED_PAGE_DETAIL HookedEntry = NULL;
 
     //
@@ -774,22 +780,16 @@ EptHookPerformPageHook2(PVOID TargetAddress, PVOID HookFunction, CR3_TYPE Proces
     //
     // try to see if we can find the address
     //
-    TempList = &g_EptState->HookedPagesList;
+    HookedEntry = EptFindHookedPageByPhysicalAddress(PhysicalBaseAddress);
 
-    while (&g_EptState->HookedPagesList != TempList->Flink)
+    if (HookedEntry != NULL)
     {
-        TempList    = TempList->Flink;
-        HookedEntry = CONTAINING_RECORD(TempList, EPT_HOOKED_PAGE_DETAIL, PageHookList);
-
-        if (HookedEntry->PhysicalBaseAddress == PhysicalBaseAddress)
-        {
-            //
-            // Means that we find the address and !epthook2 doesn't support
-            // multiple breakpoints in on page
-            //
-            DebuggerSetLastError(DEBUGGER_ERROR_EPT_MULTIPLE_HOOKS_IN_A_SINGLE_PAGE);
-            return FALSE;
-        }
+        //
+        // Means that we find the address and !epthook2 doesn't support
+        // multiple breakpoints in on page
+        //
+        DebuggerSetLastError(DEBUGGER_ERROR_EPT_MULTIPLE_HOOKS_IN_A_SINGLE_PAGE);
+        return FALSE;
     }
 
     //
@@ -958,6 +958,11 @@ EptHookPerformPageHook2(PVOID TargetAddress, PVOID HookFunction, CR3_TYPE Proces
     //
     InsertHeadList(&g_EptState->HookedPagesList, &(HookedPage->PageHookList));
 
+    //
+    // Make it visible to the EPT violation handler
+    //
+    EptHookedPagesTableInsert(&g_EptState->HookedPagesTable, PhysicalBaseAddress >> PAGE_SHIFT, HookedPage);
+
     //
     // if not launched, there is no need to modify it on a safe environment
     //
@@ -1045,6 +1050,14 @@ EptHook2(PVOID TargetAddress, PVOID HookFunction, UINT32 ProcessId, BOOLEAN SetH
         return FALSE;
     }
 
+    if (!g_GuestState[LogicalCoreIndex].IsOnVmxRootMode)
+    {
+        //
+        // Make sure that the hash tables of hooked pages have their pools
+        //
+        EptHookedPagesTablesReserve();
+    }
+
     if (g_GuestState[LogicalCoreIndex].HasLaunched)
     {
         //
@@ -1236,10 +1249,8 @@ EptHookRemoveEntryAndFreePoolFromEptHook2sDetourList(UINT64 Address)
             //
             // Free the pool in next ioctl
             //
-            if (!PoolManagerFreePool(CurrentHookedDetails))
-            {
-                LogError("Err, something goes wrong, the pool not found in the list of previously allocated pools by pool manager");
-            }
+            PoolManagerFreePool(CurrentHookedDetails);
+
             return TRUE;
         }
     }
@@ -1312,6 +1323,7 @@ EptHookUnHookSingleAddressDetours(PEPT_HOOKED_PAGE_DETAIL HookedEntry)
     // remove the entry from the list
     //
     RemoveEntryList(&HookedEntry->PageHookList);
+    EptHookRemoveFromHookedPagesTables(HookedEntry);
 
     //
     // we add the hooked entry to the list
@@ -1319,7 +1331,6 @@ EptHookUnHookSingleAddressDetours(PEPT_HOOKED_PAGE_DETAIL HookedEntry)
     //
     if (!PoolManagerFreePool(HookedEntry))
     {
-        LogError("Err, something goes wrong, the pool not found in the list of previously allocated pools by pool manager");
         return FALSE;
     }
 
@@ -1367,15 +1378,13 @@ EptHookUnHookSingleAddressHiddenBreakpoint(PEPT_HOOKED_PAGE_DETAIL HookedEntry,
                 // remove the entry from the list
                 //
                 RemoveEntryList(&HookedEntry->PageHookList);
+                EptHookRemoveFromHookedPagesTables(HookedEntry);
 
                 //
                 // we add the hooked entry to the list
                 // of pools that will be deallocated on next IOCTL
                 //
-                if (!PoolManagerFreePool(HookedEntry))
-                {
-                    LogError("Err, something goes wrong, the pool not found in the list of previously allocated pools by pool manager");
-                }
+                PoolManagerFreePool(HookedEntry);
 
                 //
                 // Check if there is any other breakpoints, if no then we have to disalbe
@@ -1446,6 +1455,11 @@ EptHookUnHookSingleAddressHiddenBreakpoint(PEPT_HOOKED_PAGE_DETAIL HookedEntry,
                 //
                 HookedEntry->CountOfBreakpoints = HookedEntry->CountOfBreakpoints - 1;
 
+                //
+                // The #BP handler shouldn't find this breakpoint anymore
+                //
+                EptHookedPagesTableRemove(&g_EptState->HiddenBreakpointsTable, VirtualAddress, HookedEntry);
+
                 return TRUE;
             }
         }
@@ -1583,9 +1597,41 @@ EptHookUnHookAll()
         // As we are in vmx-root here, we add the hooked entry to the list
         // of pools that will be deallocated on next IOCTL
         //
-        if (!PoolManagerFreePool(HookedEntry))
-        {
-            LogError("Err, something goes wrong, the pool not found in the list of previously allocated pools by pool manager");
-        }
+        PoolManagerFreePool(HookedEntry);
+    }
+
+    //
+    // No hooked page remained, the entries are going to be deallocated
+    //
+    InitializeListHead(&g_EptState->HookedPagesList);
+    EptHookedPagesTableReset(&g_EptState->HookedPagesTable);
+    EptHookedPagesTableReset(&g_EptState->HiddenBreakpointsTable);
+}
+
+/**
+ * @brief Remove a hooked page and its hidden breakpoints from the hash
+ * tables of hooked pages
+ * @details Should be called after removing the hooked page from the list
+ *
+ * @param HookedEntry entry detail of hooked address
+ * @return VOID
+ */
+VOID
+EptHookRemoveFromHookedPagesTables(PEPT_HOOKED_PAGE_DETAIL HookedEntry)
+{
+    EptHookedPagesTableRemove(&g_EptState->HookedPagesTable, HookedEntry->PhysicalBaseAddress >> PAGE_SHIFT, HookedEntry);
+
+    for (size_t i = 0; i < HookedEntry->CountOfBreakpoints; i++)
+    {
+        EptHookedPagesTableRemove(&g_EptState->HiddenBreakpointsTable, HookedEntry->BreakpointAddresses[i], HookedEntry);
+    }
+
+    if (IsListEmpty(&g_EptState->HookedPagesList))
+    {
+        //
+        // Nothing remained, the tables can be used again if they were overflowed
+        //
+        EptHookedPagesTableReset(&g_EptState->HookedPagesTable);
+        EptHookedPagesTableReset(&g_EptState->HiddenBreakpointsTable);
     }
 }
@@ -102,6 +102,7 @@ DriverEntry(
 
         LogDebugInfo("Setting device major functions");
         DriverObject->MajorFunction[IRP_MJ_CLOSE]          = DrvClose;
+        DriverObject->MajorFunction[IRP_MJ_CLEANUP]        = DrvCleanup;
         DriverObject->MajorFunction[IRP_MJ_CREATE]         = DrvCreate;
         DriverObject->MajorFunction[IRP_MJ_READ]           = DrvRead;
         DriverObject->MajorFunction[IRP_MJ_WRITE]          = DrvWrite;
@@ -171,6 +172,11 @@ DrvUnload(PDRIVER_OBJECT DriverObject)
         {
             ExFreePoolWithTag(g_GuestState[i].DebuggingState.ScriptEngineCoreSpecificLocalVariable, POOLTAG);
         }
+
+        if (g_GuestState[i].DebuggingState.ScriptEngineCoreSpecificAggregationMaps != NULL)
+        {
+            ExFreePoolWithTag(g_GuestState[i].DebuggingState.ScriptEngineCoreSpecificAggregationMaps, POOLTAG);
+        }
     }
 
     //
@@ -372,6 +378,33 @@ DrvClose(PDEVICE_OBJECT DeviceObject, PIRP Irp)
     return STATUS_SUCCESS;
 }
 
+/**
+ * @brief IRP_MJ_CLEANUP Function handler
+ * @details Cleanup is called in the context of the process that
+ * closes the handle, so the user-mode mappings are removed here
+ * 
+ * @param DeviceObject 
+ * @param Irp 
+ * @return NTSTATUS 
+ */
+NTSTATUS
+DrvCleanup(PDEVICE_OBJECT DeviceObject, PIRP Irp)
+{
+#if !UseDbgPrintInsteadOfUsermodeMessageTracking
+
+    //
+    // Unmap the log buffers if this handle mapped them
+    //
+    LogUnmapBuffersFromUserMode(IoGetCurrentIrpStackLocation(Irp)->FileObject);
+#endif
+
+    Irp->IoStatus.Status      = STATUS_SUCCESS;
+    Irp->IoStatus.Information = 0;
+    IoCompleteRequest(Irp, IO_NO_INCREMENT);
+
+    return STATUS_SUCCESS;
+}
+
 /**
  * @brief Unsupported message for all other IRP_MJ_* handlers
  * 
@@ -46,6 +46,9 @@ DrvDispatchIoControl(PDEVICE_OBJECT DeviceObject, PIRP Irp)
     PDEBUGGER_PREPARE_DEBUGGEE                              DebuggeeRequest;
     PDEBUGGER_PAUSE_PACKET_RECEIVED                         DebuggerPauseKernelRequest;
     PDEBUGGER_GENERAL_ACTION                                DebuggerNewActionRequest;
+    PDEBUGGER_MAP_LOG_BUFFERS                               DebuggerMapLogBuffersRequest;
+    PDEBUGGER_QUERY_AGGREGATION_MAPS                        DebuggerQueryAggregationMapsRequest;
+    PDEBUGGER_QUERY_POOL_MANAGER_STATISTICS                 DebuggerQueryPoolManagerStatisticsRequest;
     NTSTATUS                                                Status;
     ULONG                                                   InBuffLength;  // Input buffer length
     ULONG                                                   OutBuffLength; // Output buffer length
@@ -89,6 +92,7 @@ DrvDispatchIoControl(PDEVICE_OBJECT DeviceObject, PIRP Irp)
             switch (RegisterEventRequest->Type)
             {
             case IRP_BASED:
+            case IRP_BASED_BATCHED:
                 Status = LogRegisterIrpBasedNotification(DeviceObject, Irp);
                 break;
             case EVENT_BASED:
@@ -1151,6 +1155,121 @@ DrvDispatchIoControl(PDEVICE_OBJECT DeviceObject, PIRP Irp)
 
             break;
 
+        case IOCTL_MAP_LOG_BUFFERS_TO_USER_MODE:
+
+            //
+            // First validate the parameters.
+            //
+            if (IrpStack->Parameters.DeviceIoControl.InputBufferLength < SIZEOF_DEBUGGER_MAP_LOG_BUFFERS ||
+                Irp->AssociatedIrp.SystemBuffer == NULL)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                LogError("Err, invalid parameter to IOCTL dispatcher");
+                break;
+            }
+
+            InBuffLength  = IrpStack->Parameters.DeviceIoControl.InputBufferLength;
+            OutBuffLength = IrpStack->Parameters.DeviceIoControl.OutputBufferLength;
+
+            if (!InBuffLength || OutBuffLength < SIZEOF_DEBUGGER_MAP_LOG_BUFFERS)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                break;
+            }
+
+            //
+            // Both usermode and to send to usermode and the comming buffer are
+            // at the same place
+            //
+            DebuggerMapLogBuffersRequest = (PDEBUGGER_MAP_LOG_BUFFERS)Irp->AssociatedIrp.SystemBuffer;
+
+            //
+            // Map the buffers to the current process (we're in the context of
+            // the requesting process as we're the top-level driver)
+            //
+            Status = LogMapBuffersToUserMode(DebuggerMapLogBuffersRequest, Irp);
+
+            Irp->IoStatus.Information = NT_SUCCESS(Status) ? SIZEOF_DEBUGGER_MAP_LOG_BUFFERS : 0;
+
+            //
+            // Avoid zeroing it
+            //
+            DoNotChangeInformation = TRUE;
+
+            break;
+
+        case IOCTL_QUERY_AGGREGATION_MAPS:
+
+            //
+            // First validate the parameters.
+            //
+            if (IrpStack->Parameters.DeviceIoControl.InputBufferLength < SIZEOF_DEBUGGER_QUERY_AGGREGATION_MAPS ||
+                IrpStack->Parameters.DeviceIoControl.OutputBufferLength < SIZEOF_DEBUGGER_QUERY_AGGREGATION_MAPS ||
+                Irp->AssociatedIrp.SystemBuffer == NULL)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                LogError("Err, invalid parameter to IOCTL dispatcher");
+                break;
+            }
+
+            //
+            // Both usermode and to send to usermode and the comming buffer are
+            // at the same place
+            //
+            DebuggerQueryAggregationMapsRequest = (PDEBUGGER_QUERY_AGGREGATION_MAPS)Irp->AssociatedIrp.SystemBuffer;
+
+            //
+            // Merge the aggregation maps of all cores
+            //
+            DebuggerQueryAggregationMaps(DebuggerQueryAggregationMapsRequest);
+
+            Irp->IoStatus.Information = SIZEOF_DEBUGGER_QUERY_AGGREGATION_MAPS;
+            Status                    = STATUS_SUCCESS;
+
+            //
+            // Avoid zeroing it
+            //
+            DoNotChangeInformation = TRUE;
+
+            break;
+
+        case IOCTL_QUERY_POOL_MANAGER_STATISTICS:
+
+            //
+            // First validate the parameters.
+            //
+            if (IrpStack->Parameters.DeviceIoControl.InputBufferLength < SIZEOF_DEBUGGER_QUERY_POOL_MANAGER_STATISTICS ||
+                IrpStack->Parameters.DeviceIoControl.OutputBufferLength < SIZEOF_DEBUGGER_QUERY_POOL_MANAGER_STATISTICS ||
+                Irp->AssociatedIrp.SystemBuffer == NULL)
+            {
+                Status = STATUS_INVALID_PARAMETER;
+                LogError("Err, invalid parameter to IOCTL dispatcher");
+                break;
+            }
+
+            //
+            // Both usermode and to send to usermode and the comming buffer are
+            // at the same place
+            //
+            DebuggerQueryPoolManagerStatisticsRequest = (PDEBUGGER_QUERY_POOL_MANAGER_STATISTICS)Irp->AssociatedIrp.SystemBuffer;
+
+            //
+            // Get the sum of the counters of all cores
+            //
+            PoolManagerQueryStatistics(&DebuggerQueryPoolManagerStatisticsRequest->Statistics);
+
+            DebuggerQueryPoolManagerStatisticsRequest->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+
+            Irp->IoStatus.Information = SIZEOF_DEBUGGER_QUERY_POOL_MANAGER_STATISTICS;
+            Status                    = STATUS_SUCCESS;
+
+            //
+            // Avoid zeroing it
+            //
+            DoNotChangeInformation = TRUE;
+
+            break;
+
         default:
             LogError("Err, unknown IOCTL");
             Status = STATUS_NOT_IMPLEMENTED;
@@ -3,7 +3,8 @@
  * @author Sina Karvandi (sina@rayanfam.com)
  * @brief The pool manager used in vmx root
  * @details As we cannot allocate pools in vmx root, we need a pool
- * manager to manage the pools
+ * manager to manage the pools, the free lists and the caches of cores
+ * are in PoolManagerCaches.h
  * 
  * @version 0.1
  * @date 2020-04-11
@@ -12,6 +13,7 @@
  * 
  */
 #include "..\hprdbghv\pch.h"
+#include "PoolManagerCaches.h"
 
 /**
  * @brief Initializes the pool manager
@@ -21,6 +23,8 @@
 BOOLEAN
 PoolManagerInitialize()
 {
+    ULONG ProcessorCount;
+
     //
     // Allocate global requesting variable
     //
@@ -33,10 +37,36 @@ PoolManagerInitialize()
     }
     RtlZeroMemory(g_RequestNewAllocation, MaximumRequestsQueueDepth * sizeof(REQUEST_NEW_ALLOCATION));
 
+    //
+    // Allocate the caches of cores
+    //
+    ProcessorCount = KeQueryActiveProcessorCount(0);
+
+    g_PoolManagerCoreCaches = ExAllocatePoolWithTag(NonPagedPool, ProcessorCount * sizeof(POOL_MANAGER_CORE_CACHE), POOLTAG);
+
+    if (!g_PoolManagerCoreCaches)
+    {
+        ExFreePoolWithTag(g_RequestNewAllocation, POOLTAG);
+        LogError("Err, insufficient memory");
+        return FALSE;
+    }
+    RtlZeroMemory(g_PoolManagerCoreCaches, ProcessorCount * sizeof(POOL_MANAGER_CORE_CACHE));
+
     //
     // Initialize list head
     //
     InitializeListHead(&g_ListOfAllocatedPoolsHead);
+    InitializeListHead(&g_ListOfPoolsToBeFreedHead);
+
+    for (size_t i = 0; i < POOL_MANAGER_MAXIMUM_INTENTIONS; i++)
+    {
+        InitializeListHead(&g_PoolManagerFreeListsHead[i]);
+    }
+
+    for (size_t i = 0; i < PoolManagerAddressHashBuckets; i++)
+    {
+        InitializeListHead(&g_PoolManagerAddressHashHeads[i]);
+    }
 
     //
     // Request pages to be allocated for converting 2MB to 4KB pages
@@ -116,56 +146,63 @@ PoolManagerUninitialize()
         RemoveEntryList(&PoolTable->PoolsList);
 
         //
-        // Free the record itself
+        // Free the record itself, the walk continues from the list head
         //
         ExFreePoolWithTag(PoolTable, POOLTAG);
+
+        ListTemp = &g_ListOfAllocatedPoolsHead;
     }
 
+    ExFreePoolWithTag(g_PoolManagerCoreCaches, POOLTAG);
     ExFreePoolWithTag(g_RequestNewAllocation, POOLTAG);
+
+    g_PoolManagerCoreCaches = NULL;
+}
+
+/**
+ * @brief Get the count of cores that have a cache
+ * 
+ * @return UINT32 
+ */
+UINT32
+PoolManagerGetCountOfCores()
+{
+    return KeQueryActiveProcessorCount(0);
+}
+
+/**
+ * @brief Get the index of the current core
+ * 
+ * @return UINT32 
+ */
+UINT32
+PoolManagerGetCurrentCore()
+{
+    return KeGetCurrentProcessorNumber();
 }
 
 /**
  * @brief This function set a pool flag to be freed, and it will be freed
  * on the next IOCTL when it's safe to remove
+ * @details The error is logged here, so the callers don't log it again
  * 
  * @param AddressToFree The pool address that was previously obtained from the pool manager
  * @return BOOLEAN If the address was already in the list of allocated pools by pool 
- * manager then it returns TRUE; otherwise, FALSE
+ * manager and it's given to a caller (busy) then it returns TRUE; otherwise, FALSE
  */
 BOOLEAN
 PoolManagerFreePool(UINT64 AddressToFree)
 {
-    PLIST_ENTRY ListTemp = 0;
-    BOOLEAN     Result   = FALSE;
-    ListTemp             = &g_ListOfAllocatedPoolsHead;
-
-    SpinlockLock(&LockForReadingPool);
-
-    while (&g_ListOfAllocatedPoolsHead != ListTemp->Flink)
+    if (!PoolManagerMarkPoolToBeFreed(AddressToFree))
     {
-        ListTemp = ListTemp->Flink;
-
         //
-        // Get the head of the record
+        // The pool is not given by the pool manager, or it's already freed
         //
-        PPOOL_TABLE PoolTable = (PPOOL_TABLE)CONTAINING_RECORD(ListTemp, POOL_TABLE, PoolsList);
-
-        if (PoolTable->Address == AddressToFree)
-        {
-            //
-            // We found an entry that matched the detailed from
-            // previously allocated pools
-            //
-            PoolTable->ShouldBeFreed = TRUE;
-            Result                   = TRUE;
-
-            g_IsNewRequestForDeAllocation = TRUE;
-            break;
-        }
+        LogError("Err, the pool (%llx) is not allocated by the pool manager or it's already freed", AddressToFree);
+        return FALSE;
     }
 
-    SpinlockUnlock(&LockForReadingPool);
-    return Result;
+    return TRUE;
 }
 
 /**
@@ -173,6 +210,9 @@ PoolManagerFreePool(UINT64 AddressToFree)
  * @details If RequestNewPool is TRUE then Size is used, otherwise Size is useless
  * Note : Most of the times this function called from vmx root but not all the time
  * 
+ * The pool is taken from the cache of the current core without any lock, if the
+ * cache is empty then the cache is refilled from the free list of the intention
+ * 
  * @param Intention The intention why we need this pool for (buffer tag)
  * @param RequestNewPool Create a request to allocate a new pool with the same size, next time
  * that it's safe to allocate (this way we never ran out of pools for this "Intention")
@@ -182,31 +222,16 @@ PoolManagerFreePool(UINT64 AddressToFree)
 UINT64
 PoolManagerRequestPool(POOL_ALLOCATION_INTENTION Intention, BOOLEAN RequestNewPool, UINT32 Size)
 {
-    PLIST_ENTRY ListTemp = 0;
-    UINT64      Address  = 0;
-    ListTemp             = &g_ListOfAllocatedPoolsHead;
+    PPOOL_TABLE PoolTable;
+    UINT64      Address = 0;
 
-    SpinlockLock(&LockForReadingPool);
+    PoolTable = PoolManagerTakePool(Intention);
 
-    while (&g_ListOfAllocatedPoolsHead != ListTemp->Flink)
+    if (PoolTable != NULL)
     {
-        ListTemp = ListTemp->Flink;
-
-        //
-        // Get the head of the record
-        //
-        PPOOL_TABLE PoolTable = (PPOOL_TABLE)CONTAINING_RECORD(ListTemp, POOL_TABLE, PoolsList);
-
-        if (PoolTable->Intention == Intention && PoolTable->IsBusy == FALSE)
-        {
-            PoolTable->IsBusy = TRUE;
-            Address           = PoolTable->Address;
-            break;
-        }
+        Address = PoolTable->Address;
     }
 
-    SpinlockUnlock(&LockForReadingPool);
-
     //
     // Check if we need additional pools e.g another pool or the pool
     // will be available for the next use blah blah
@@ -267,10 +292,12 @@ PoolManagerAllocateAndAddToPoolTable(SIZE_T Size, UINT32 Count, POOL_ALLOCATION_
         SinglePool->Size          = Size;
 
         //
-        // Add it to the list
+        // Add it to the lists
         //
-        InsertHeadList(&g_ListOfAllocatedPoolsHead, &(SinglePool->PoolsList));
+        PoolManagerAddPool(SinglePool);
     }
+
+    return TRUE;
 }
 
 /**
@@ -325,45 +352,38 @@ PoolManagerCheckAndPerformAllocationAndDeallocation()
     //
     if (g_IsNewRequestForDeAllocation)
     {
-        ListTemp = &g_ListOfAllocatedPoolsHead;
-
         SpinlockLock(&LockForReadingPool);
 
-        while (&g_ListOfAllocatedPoolsHead != ListTemp->Flink)
+        while (!IsListEmpty(&g_ListOfPoolsToBeFreedHead))
         {
-            ListTemp = ListTemp->Flink;
+            ListTemp = RemoveHeadList(&g_ListOfPoolsToBeFreedHead);
 
             //
             // Get the head of the record
             //
-            PPOOL_TABLE PoolTable = (PPOOL_TABLE)CONTAINING_RECORD(ListTemp, POOL_TABLE, PoolsList);
+            PPOOL_TABLE PoolTable = (PPOOL_TABLE)CONTAINING_RECORD(ListTemp, POOL_TABLE, StateList);
 
             //
-            // Check whther this pool should be freed or not and
-            // also check whether it's already freed or not
+            // Set the flag to indicate that we freed
             //
-            if (PoolTable->ShouldBeFreed && !PoolTable->AlreadyFreed)
-            {
-                //
-                // Set the flag to indicate that we freed
-                //
-                PoolTable->AlreadyFreed = TRUE;
+            PoolTable->AlreadyFreed = TRUE;
 
-                //
-                // This item should be freed
-                //
-                ExFreePoolWithTag(PoolTable->Address, POOLTAG);
+            //
+            // This item should be freed
+            //
+            ExFreePoolWithTag(PoolTable->Address, POOLTAG);
 
-                //
-                // Now we should remove the entry from the g_ListOfAllocatedPoolsHead
-                //
-                RemoveEntryList(&PoolTable->PoolsList);
+            //
+            // Now we should remove the entry from the g_ListOfAllocatedPoolsHead
+            // and from the hash table of addresses
+            //
+            RemoveEntryList(&PoolTable->PoolsList);
+            RemoveEntryList(&PoolTable->AddressHashList);
 
-                //
-                // Free the structure pool
-                //
-                ExFreePoolWithTag(PoolTable, POOLTAG);
-            }
+            //
+            // Free the structure pool
+            //
+            ExFreePoolWithTag(PoolTable, POOLTAG);
         }
 
         SpinlockUnlock(&LockForReadingPool);
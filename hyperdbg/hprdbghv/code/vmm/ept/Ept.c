@@ -11,6 +11,7 @@
  * 
  */
 #include "..\hprdbghv\pch.h"
+#include "HookedPagesTable.h"
 
 /**
  * @brief Check whether EPT features are present or not
@@ -676,70 +677,65 @@ EptInitializeSeconadaryEpt()
 BOOLEAN
 EptHandlePageHookExit(PGUEST_REGS Regs, VMX_EXIT_QUALIFICATION_EPT_VIOLATION ViolationQualification, UINT64 GuestPhysicalAddr)
 {
-    BOOLEAN     IsHandled = FALSE;
-    PLIST_ENTRY TempList  = 0;
+    BOOLEAN                 IsHandled   = FALSE;
+    PEPT_HOOKED_PAGE_DETAIL HookedEntry = NULL;
 
-    TempList = &g_EptState->HookedPagesList;
-    while (&g_EptState->HookedPagesList != TempList->Flink)
+    //
+    // Find the hooked page of this physical address
+    //
+    HookedEntry = EptFindHookedPageByPhysicalAddress(GuestPhysicalAddr);
+
+    if (HookedEntry != NULL)
     {
-        TempList                            = TempList->Flink;
-        PEPT_HOOKED_PAGE_DETAIL HookedEntry = CONTAINING_RECORD(TempList, EPT_HOOKED_PAGE_DETAIL, PageHookList);
-        if (HookedEntry->PhysicalBaseAddress == PAGE_ALIGN(GuestPhysicalAddr))
+        //
+        // We found an address that matches the details
+        //
+        // Returning true means that the caller should return to the ept state to
+        // the previous state when this instruction is executed
+        // by setting the Monitor Trap Flag. Return false means that nothing special
+        // for the caller to do
+        //
+        if (EptHookHandleHookedPage(Regs, HookedEntry, ViolationQualification, GuestPhysicalAddr))
         {
             //
-            // We found an address that matches the details
+            // Next we have to save the current hooked entry to restore on the next instruction's vm-exit
             //
-            // Returning true means that the caller should return to the ept state to
-            // the previous state when this instruction is executed
-            // by setting the Monitor Trap Flag. Return false means that nothing special
-            // for the caller to do
-            //
-            if (EptHookHandleHookedPage(Regs, HookedEntry, ViolationQualification, GuestPhysicalAddr))
-            {
-                //
-                // Next we have to save the current hooked entry to restore on the next instruction's vm-exit
-                //
-                g_GuestState[KeGetCurrentProcessorNumber()].MtfEptHookRestorePoint = HookedEntry;
-
-                //
-                // We have to set Monitor trap flag and give it the HookedEntry to work with
-                //
-                HvSetMonitorTrapFlag(TRUE);
+            g_GuestState[KeGetCurrentProcessorNumber()].MtfEptHookRestorePoint = HookedEntry;
 
-                //
-                // The following codes are added because we realized if the execution takes long then
-                // the execution might be switched to another routines, thus, MTF might conclude on
-                // another routine and we might (and will) trigger the same instruction soon
-                //
-
-                //
-                // Change guest interrupt-state
-                //
-                HvSetExternalInterruptExiting(TRUE);
+            //
+            // We have to set Monitor trap flag and give it the HookedEntry to work with
+            //
+            HvSetMonitorTrapFlag(TRUE);
 
-                //
-                // Do not vm-exit on interrupt windows
-                //
-                HvSetInterruptWindowExiting(FALSE);
+            //
+            // The following codes are added because we realized if the execution takes long then
+            // the execution might be switched to another routines, thus, MTF might conclude on
+            // another routine and we might (and will) trigger the same instruction soon
+            //
 
-                //
-                // Indicate that we should enable external interruts and configure external interrupt
-                // window exiting somewhere at MTF
-                //
-                g_GuestState[KeGetCurrentProcessorNumber()].DebuggingState.EnableExternalInterruptsOnContinueMtf = TRUE;
-            }
+            //
+            // Change guest interrupt-state
+            //
+            HvSetExternalInterruptExiting(TRUE);
 
             //
-            // Indicate that we handled the ept violation
+            // Do not vm-exit on interrupt windows
             //
-            IsHandled = TRUE;
+            HvSetInterruptWindowExiting(FALSE);
 
             //
-            // Get out of the loop
+            // Indicate that we should enable external interruts and configure external interrupt
+            // window exiting somewhere at MTF
             //
-            break;
+            g_GuestState[KeGetCurrentProcessorNumber()].DebuggingState.EnableExternalInterruptsOnContinueMtf = TRUE;
         }
+
+        //
+        // Indicate that we handled the ept violation
+        //
+        IsHandled = TRUE;
     }
+
     //
     // Redo the instruction
     //
@@ -857,3 +853,237 @@ EptSetPML1AndInvalidateTLB(PEPT_PML1_ENTRY EntryAddress, EPT_PML1_ENTRY EntryVal
     //
     SpinlockUnlock(&Pml1ModificationAndInvalidationLock);
 }
+
+/**
+ * @brief Initialize the hash tables of hooked pages
+ * @details Should be called after allocating g_EptState, the slots are
+ * not available until the first entry is added to the tables
+ *
+ * @return VOID
+ */
+VOID
+EptHookedPagesTablesInitialize()
+{
+    g_EptState->HookedPagesTable.SlotsMask        = MaximumHookedPagesTableSlots - 1;
+    g_EptState->HookedPagesTable.StorageIntention = HOOKED_PAGES_TABLE_SLOTS;
+
+    g_EptState->HiddenBreakpointsTable.SlotsMask        = MaximumHiddenBreakpointsTableSlots - 1;
+    g_EptState->HiddenBreakpointsTable.StorageIntention = HIDDEN_BREAKPOINTS_TABLE_SLOTS;
+}
+
+/**
+ * @brief Request the pools of the hash tables of hooked pages
+ * @details Should be called from vmx non-root at PASSIVE_LEVEL before
+ * applying a hook, the pools are requested only once and they are taken
+ * from the pool manager when the first entry is added to each table
+ *
+ * @return VOID
+ */
+VOID
+EptHookedPagesTablesReserve()
+{
+    PEPT_HOOKED_PAGES_TABLE Tables[]  = {&g_EptState->HookedPagesTable, &g_EptState->HiddenBreakpointsTable};
+    BOOLEAN                 Requested = FALSE;
+
+    for (size_t i = 0; i < RTL_NUMBER_OF(Tables); i++)
+    {
+        if (Tables[i]->Slots == NULL && InterlockedExchange(&Tables[i]->StorageRequested, TRUE) == FALSE)
+        {
+            PoolManagerRequestAllocation(EptHookedPagesTableGetStorageSize(Tables[i]), 1, Tables[i]->StorageIntention);
+            Requested = TRUE;
+        }
+    }
+
+    if (Requested)
+    {
+        //
+        // Perform the allocations as we're in PASSIVE_LEVEL
+        //
+        PoolManagerCheckAndPerformAllocationAndDeallocation();
+    }
+}
+
+/**
+ * @brief Get the size of the pool that holds the slots of a hash
+ * table of hooked pages
+ * @details The pool contains the slots, the spare slots and the
+ * retire epochs of the spare slots
+ *
+ * @param Table The target hash table
+ * @return UINT32 Size of the pool
+ */
+UINT32
+EptHookedPagesTableGetStorageSize(PEPT_HOOKED_PAGES_TABLE Table)
+{
+    return (Table->SlotsMask + 1) * 2 * sizeof(EPT_HOOKED_PAGES_TABLE_SLOT) +
+           EptHookedPagesTablesGetCountOfCores() * sizeof(LONG64);
+}
+
+/**
+ * @brief Take the pool of a hash table of hooked pages from the
+ * pool manager
+ * @details The pool is never given back to the pool manager, it's
+ * freed once the pool manager is uninitialized
+ *
+ * @param Table The target hash table
+ * @return BOOLEAN Returns false if the pool is not requested or not
+ * allocated yet
+ */
+BOOLEAN
+EptHookedPagesTableTakeStorage(PEPT_HOOKED_PAGES_TABLE Table)
+{
+    PEPT_HOOKED_PAGES_TABLE_SLOT Storage;
+
+    Storage = (PEPT_HOOKED_PAGES_TABLE_SLOT)PoolManagerRequestPool(Table->StorageIntention, FALSE, 0);
+
+    if (Storage == NULL)
+    {
+        return FALSE;
+    }
+
+    EptHookedPagesTableClearSlots(Storage, Table->SlotsMask);
+
+    Table->SpareSlots        = Storage + Table->SlotsMask + 1;
+    Table->SpareRetireEpochs = (LONG64 *)(Table->SpareSlots + Table->SlotsMask + 1);
+
+    //
+    // Zero epochs mean that the spare slots are never published
+    //
+    RtlZeroMemory(Table->SpareRetireEpochs, EptHookedPagesTablesGetCountOfCores() * sizeof(LONG64));
+
+    //
+    // Publish the slots
+    //
+    InterlockedExchangePointer((PVOID volatile *)&Table->Slots, Storage);
+
+    return TRUE;
+}
+
+/**
+ * @brief Get the count of cores that probe the hash tables of hooked pages
+ *
+ * @return UINT32
+ */
+UINT32
+EptHookedPagesTablesGetCountOfCores()
+{
+    return KeQueryActiveProcessorCount(0);
+}
+
+/**
+ * @brief Get the epoch of a core in the hash tables of hooked pages
+ *
+ * @param CoreIndex Index of the core
+ * @return LONG64 The epoch, it's odd while the core probes the tables
+ */
+LONG64
+EptHookedPagesTablesGetEpoch(UINT32 CoreIndex)
+{
+    return g_GuestState[CoreIndex].HookedPagesTablesEpoch;
+}
+
+/**
+ * @brief Start probing the hash tables of hooked pages on the current core
+ *
+ * @details should be called in vmx-root or at DISPATCH_LEVEL, the slots that
+ * are read after this point are not reused until the core leaves the tables
+ *
+ * @param CoreIndex Index of the current core
+ * @return BOOLEAN TRUE if the core entered the tables, FALSE if it's
+ * already probing the tables (nested lookups)
+ */
+BOOLEAN
+EptHookedPagesTablesEnter(UINT32 CoreIndex)
+{
+    volatile LONG64 * Epoch = &g_GuestState[CoreIndex].HookedPagesTablesEpoch;
+
+    if (*Epoch & 1)
+    {
+        return FALSE;
+    }
+
+    InterlockedIncrement64(Epoch);
+
+    return TRUE;
+}
+
+/**
+ * @brief Stop probing the hash tables of hooked pages on the current core
+ *
+ * @param CoreIndex Index of the current core
+ * @return VOID
+ */
+VOID
+EptHookedPagesTablesLeave(UINT32 CoreIndex)
+{
+    InterlockedIncrement64(&g_GuestState[CoreIndex].HookedPagesTablesEpoch);
+}
+
+/**
+ * @brief Find the hooked page of a physical address
+ * @details Can be called from vmx-root
+ *
+ * @param PhysicalAddress The target physical address
+ * @return PEPT_HOOKED_PAGE_DETAIL The hooked page or NULL if the page
+ * is not hooked
+ */
+PEPT_HOOKED_PAGE_DETAIL
+EptFindHookedPageByPhysicalAddress(SIZE_T PhysicalAddress)
+{
+    PLIST_ENTRY                   TempList     = 0;
+    PEPT_HOOKED_PAGE_DETAIL       HookedEntry  = NULL;
+    EPT_HOOKED_PAGES_TABLE_CURSOR Cursor       = {0};
+    KIRQL                         OldIrql      = 0;
+    BOOLEAN                       IrqlIsRaised = FALSE;
+    BOOLEAN                       IsEntered;
+    ULONG                         CoreIndex;
+
+    if (!g_EptState->HookedPagesTable.Overflowed)
+    {
+        if (!g_GuestState[KeGetCurrentProcessorNumber()].IsOnVmxRootMode && KeGetCurrentIrql() < DISPATCH_LEVEL)
+        {
+            //
+            // The thread shouldn't be moved to another core while it's in the tables
+            //
+            OldIrql      = KeRaiseIrqlToDpcLevel();
+            IrqlIsRaised = TRUE;
+        }
+
+        CoreIndex = KeGetCurrentProcessorNumber();
+        IsEntered = EptHookedPagesTablesEnter(CoreIndex);
+
+        //
+        // Each physical page is hooked at most once
+        //
+        HookedEntry = EptHookedPagesTableLookup(&g_EptState->HookedPagesTable, PhysicalAddress >> PAGE_SHIFT, &Cursor);
+
+        if (IsEntered)
+        {
+            EptHookedPagesTablesLeave(CoreIndex);
+        }
+
+        if (IrqlIsRaised)
+        {
+            KeLowerIrql(OldIrql);
+        }
+
+        return HookedEntry;
+    }
+
+    //
+    // The table couldn't hold all the hooked pages, walk the list
+    //
+    TempList = &g_EptState->HookedPagesList;
+    while (&g_EptState->HookedPagesList != TempList->Flink)
+    {
+        TempList    = TempList->Flink;
+        HookedEntry = CONTAINING_RECORD(TempList, EPT_HOOKED_PAGE_DETAIL, PageHookList);
+
+        if (HookedEntry->PhysicalBaseAddress == PAGE_ALIGN(PhysicalAddress))
+        {
+            return HookedEntry;
+        }
+    }
+
+    return NULL;
+}
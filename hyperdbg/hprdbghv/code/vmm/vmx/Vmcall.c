@@ -419,6 +419,12 @@ VmxVmcallHandler(UINT64      VmcallNumber,
         VmcallStatus = STATUS_SUCCESS;
         break;
     }
+    case VMCALL_MERGE_AGGREGATION_MAPS:
+    {
+        DebuggerMergeAggregationMapsOfCurrentCore(OptionalParam1);
+        VmcallStatus = STATUS_SUCCESS;
+        break;
+    }
     default:
     {
         LogError("Err, unsupported VMCALL");
@@ -194,6 +194,11 @@ VmxPerformVirtualizationOnAllCores()
     //
     InitializeListHead(&g_EptState->HookedPagesList);
 
+    //
+    // Initialize the hash tables of hooked pages
+    //
+    EptHookedPagesTablesInitialize();
+
     //
     // Check whether EPT is supported or not
     //
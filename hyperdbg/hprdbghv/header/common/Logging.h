@@ -12,6 +12,26 @@
 
 #pragma once
 
+//////////////////////////////////////////////////
+//					Constants					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Minimum size of the buffer of each core
+ * @details The buffers of each pool (vmx-root and vmx non-root) share
+ * LogBufferSize bytes between cores, but each core has at least this
+ * size
+ *
+ */
+#define MinimumLogBufferSizePerCore (16 * (PacketChunkSize + sizeof(BUFFER_HEADER)))
+
+/**
+ * @brief Size of the buffer of the message that notifies the user about
+ * the dropped messages
+ *
+ */
+#define LOG_DROPPED_MESSAGES_NOTICE_SIZE 128
+
 //////////////////////////////////////////////////
 //					Structures					//
 //////////////////////////////////////////////////
@@ -32,58 +52,98 @@ typedef struct _NOTIFY_RECORD
     BOOLEAN CheckVmxRootMessagePool; // Set so that notify callback can understand where to check (Vmx root or Vmx non-root)
 } NOTIFY_RECORD, *PNOTIFY_RECORD;
 
+//////////////////////////////////////////////////
+//				Global Variables				//
+//////////////////////////////////////////////////
+
 /**
- * @brief Message buffer structure
+ * @brief Global Variable for buffer on all cores
+ * @details The first LogProcessorCount buffers are for vmx non-root
+ * and the rest are for vmx-root
  * 
  */
-typedef struct _BUFFER_HEADER
-{
-    UINT32  OpeationNumber; // Operation ID to user-mode
-    UINT32  BufferLength;   // The actual length
-    BOOLEAN Valid;          // Determine whether the buffer was valid to send or not
-} BUFFER_HEADER, *PBUFFER_HEADER;
+LOG_BUFFER_INFORMATION * MessageBufferInformation;
 
 /**
- * @brief Core-specific buffers
+ * @brief Count of cores that have buffers
  * 
  */
-typedef struct _LOG_BUFFER_INFORMATION
-{
-    UINT64 BufferStartAddress; // Start address of the buffer
-    UINT64 BufferEndAddress;   // End address of the buffer
+UINT32 LogProcessorCount;
 
-    UINT64 BufferForMultipleNonImmediateMessage; // Start address of the buffer for accumulating non-immadiate messages
-    UINT32 CurrentLengthOfNonImmBuffer;          // the current size of the buffer for accumulating non-immadiate messages
+/**
+ * @brief Lock for reading the buffers
+ * 
+ */
+KSPIN_LOCK LogReaderLock;
 
-    KSPIN_LOCK BufferLock;                 // SpinLock to protect access to the queue
-    KSPIN_LOCK BufferLockForNonImmMessage; // SpinLock to protect access to the queue of non-imm messages
+/**
+ * @brief The control page of buffers (mapped read-only to user-mode)
+ * 
+ */
+PLOG_SHARED_BUFFERS_HEADER LogSharedBuffersHeader;
 
-    UINT32 CurrentIndexToSend;  // Current buffer index to send to user-mode
-    UINT32 CurrentIndexToWrite; // Current buffer index to write new messages
+/**
+ * @brief Size of the control page of buffers
+ * 
+ */
+UINT32 LogSharedBuffersHeaderSize;
 
-} LOG_BUFFER_INFORMATION, *PLOG_BUFFER_INFORMATION;
+/**
+ * @brief The page that user-mode writes its read offsets to
+ * 
+ */
+PLOG_SHARED_READER_PAGE LogSharedReaderPage;
 
-//////////////////////////////////////////////////
-//				Global Variables				//
-//////////////////////////////////////////////////
+/**
+ * @brief Size of the reader page
+ * 
+ */
+UINT32 LogSharedReaderPageSize;
 
 /**
- * @brief Global Variable for buffer on all cores
+ * @brief Start address of the buffers of all cores (consecutive)
  * 
  */
-LOG_BUFFER_INFORMATION * MessageBufferInformation;
+UINT64 LogBuffersStartAddress;
+
+/**
+ * @brief Size of the buffers of all cores
+ * 
+ */
+UINT32 LogBuffersSize;
+
+/**
+ * @brief Shows whether the buffers are mapped to user-mode or not
+ * 
+ */
+volatile BOOLEAN LogBuffersMappedToUserMode;
+
+/**
+ * @brief Details of the mapping of the buffers to user-mode
+ * 
+ */
+PMDL         LogSharedBuffersHeaderMdl;
+PMDL         LogSharedReaderPageMdl;
+PMDL         LogBuffersMdl;
+PVOID        LogSharedBuffersHeaderUserAddress;
+PVOID        LogSharedReaderPageUserAddress;
+PVOID        LogBuffersUserAddress;
+PFILE_OBJECT LogBuffersOwnerFileObject;
 
 /**
- * @brief Vmx-root lock for logging
+ * @brief The doorbell event of user-mode and its DPC
  * 
  */
-volatile LONG VmxRootLoggingLock;
+PKEVENT LogDoorbellEvent;
+KDPC    LogDoorbellDpc;
 
 /**
- * @brief Vmx-root lock for logging
+ * @brief Time stamp of vmx non-root messages
+ * @details rdtsc might cause vm-exits in vmx non-root, thus a counter is
+ * used instead (vmx non-root messages are not in hot paths)
  * 
  */
-volatile LONG VmxRootLoggingLockForNonImmBuffers;
+volatile LONG64 LogVmxNonRootTimeStamp;
 
 //////////////////////////////////////////////////
 //					Illustration				//
@@ -91,45 +151,38 @@ volatile LONG VmxRootLoggingLockForNonImmBuffers;
 
 /*
 
-A core buffer is like this , it's divided into MaximumPacketsCapacity chucks,
-each chunk has PacketChunkSize + sizeof(BUFFER_HEADER) size
+A core buffer is a ring of variable-length records, each record has a
+BUFFER_HEADER and a body, and takes LOG_RECORD_SIZE(BufferLength) bytes.
+If a record doesn't fit at the end of the buffer, a header with zero
+length is written and the record is written at the start of the buffer
 
 			 _________________________
 			|      BUFFER_HEADER      |
 			|_________________________|
-			|						  |
 			|           BODY		  |
-			|         (Buffer)		  |
-			| size = PacketChunkSize  |
-			|						  |
+			|  size = BufferLength    |
 			|_________________________|
 			|      BUFFER_HEADER      |
 			|_________________________|
 			|						  |
 			|           BODY		  |
-			|         (Buffer)		  |
-			| size = PacketChunkSize  |
+			|  size = BufferLength    |
 			|						  |
 			|_________________________|
-			|						  |
-			|						  |
-			|						  |
+			|      BUFFER_HEADER      |
+			|_________________________|
+			|           BODY		  |
+			|_________________________|
 			|						  |
 			|			.			  |
 			|			.			  |
 			|			.			  |
 			|						  |
-			|						  |
-			|						  |
-			|						  |
 			|_________________________|
 			|      BUFFER_HEADER      |
+			|   (BufferLength = 0)	  |
 			|_________________________|
-			|						  |
-			|           BODY		  |
-			|         (Buffer)		  |
-			| size = PacketChunkSize  |
-			|						  |
+			|		 (unused)		  |
 			|_________________________|
 
 */
@@ -153,9 +206,27 @@ LogMarkAllAsRead(BOOLEAN IsVmxRoot);
 BOOLEAN
 LogReadBuffer(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessage, UINT32 * ReturnedLength);
 
+BOOLEAN
+LogReadBufferBatch(BOOLEAN IsVmxRoot, PVOID BufferToSaveMessages, UINT32 BufferSize, UINT32 * ReturnedLength);
+
+VOID
+LogPrintMessageOnDebugger(BUFFER_HEADER * Header);
+
 BOOLEAN
 LogCheckForNewMessage(BOOLEAN IsVmxRoot);
 
+PLOG_BUFFER_INFORMATION
+LogGetBufferInformation(BOOLEAN IsVmxRoot, UINT32 CoreIndex);
+
+UINT64
+LogGetTimeStamp(BOOLEAN IsVmxRoot);
+
+PLOG_BUFFER_INFORMATION
+LogFindOldestMessage(BOOLEAN IsVmxRoot, BUFFER_HEADER ** OldestHeader);
+
+UINT64
+LogGetCountOfDroppedMessages(BOOLEAN IsVmxRoot);
+
 BOOLEAN
 LogPrepareAndSendMessageToQueue(UINT32 OperationCode, BOOLEAN IsImmediateMessage, BOOLEAN ShowCurrentSystemTime, const char * Fmt, ...);
 
@@ -170,3 +241,12 @@ LogRegisterEventBasedNotification(PDEVICE_OBJECT DeviceObject, PIRP Irp);
 
 NTSTATUS
 LogRegisterIrpBasedNotification(PDEVICE_OBJECT DeviceObject, PIRP Irp);
+
+VOID
+LogRingDoorbellDpc(PKDPC Dpc, PVOID DeferredContext, PVOID SystemArgument1, PVOID SystemArgument2);
+
+NTSTATUS
+LogMapBuffersToUserMode(PDEBUGGER_MAP_LOG_BUFFERS MapRequest, PIRP Irp);
+
+VOID
+LogUnmapBuffersFromUserMode(PFILE_OBJECT FileObject);
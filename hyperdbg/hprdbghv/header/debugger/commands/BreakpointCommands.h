@@ -20,6 +20,9 @@ BreakpointListOrModify(PDEBUGGEE_BP_LIST_OR_MODIFY_PACKET ListOrModifyBreakpoint
 VOID
 BreakpointRemoveAllBreakpoints();
 
+VOID
+BreakpointHandleEptHookBreakpoint(UINT32 CurrentProcessorIndex, PEPT_HOOKED_PAGE_DETAIL HookedEntry, ULONG64 GuestRip, PGUEST_REGS GuestRegs);
+
 VOID
 BreakpointHandleBpTraps(UINT32 CurrentProcessorIndex, PGUEST_REGS GuestRegs);
 
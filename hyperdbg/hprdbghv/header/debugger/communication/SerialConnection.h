@@ -27,6 +27,45 @@ KdHyperDbgSendByte(UCHAR Byte, BOOLEAN BusyWait);
 BOOLEAN
 KdHyperDbgRecvByte(PUCHAR RecvByte);
 
+//////////////////////////////////////////////////
+//					 Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Size of the buffer that keeps the bytes which are received
+ * while sending, it's enough for the pipelined requests
+ *
+ */
+#define SERIAL_CONNECTION_RECEIVE_BUFFER_SIZE 0x1000
+
+/**
+ * @brief The bytes that are received from the debugger while the
+ * debuggee is sending a packet, the FIFO of the serial port only
+ * keeps a few bytes so they're moved here until they're parsed
+ *
+ */
+typedef struct _SERIAL_CONNECTION_RECEIVE_BUFFER
+{
+    UCHAR  Buffer[SERIAL_CONNECTION_RECEIVE_BUFFER_SIZE];
+    UINT32 Head; // index of the next byte that is parsed
+    UINT32 Tail; // index of the next byte that is received
+
+} SERIAL_CONNECTION_RECEIVE_BUFFER, *PSERIAL_CONNECTION_RECEIVE_BUFFER;
+
+/**
+ * @brief The buffers of compressing the packets, the packets are
+ * sent while holding DebuggerResponseLock so they're used by one
+ * core at a time
+ *
+ */
+typedef struct _SERIAL_CONNECTION_COMPRESSION
+{
+    UINT16 HashTable[SERIAL_COMPRESSION_HASH_TABLE_SIZE];
+    BYTE   Buffer[MaxSerialPacketSize];           // the packet before compression
+    BYTE   CompressedBuffer[MaxSerialPacketSize]; // length of the packet and the compressed block
+
+} SERIAL_CONNECTION_COMPRESSION, *PSERIAL_CONNECTION_COMPRESSION;
+
 //////////////////////////////////////////////////
 //					 Functions					//
 //////////////////////////////////////////////////
@@ -53,6 +92,12 @@ SerialConnectionRecvBuffer(CHAR *   BufferToSave,
 BOOLEAN
 SerialConnectionSendTwoBuffers(CHAR * Buffer1, UINT32 Length1, CHAR * Buffer2, UINT32 Length2);
 
+UINT32
+SerialConnectionComputeCrc32(PVOID Buffer, UINT32 Length, UINT32 Crc32);
+
+VOID
+SerialConnectionInitializeCrc32();
+
 BOOLEAN
 SerialConnectionSendThreeBuffers(CHAR * Buffer1,
                                  UINT32 Length1,
@@ -30,6 +30,12 @@ BOOLEAN g_TriggerEventForVmcalls;
  */
 BOOLEAN g_TriggerEventForCpuids;
 
+/**
+ * @brief Lock for merging the aggregation maps of cores
+ * 
+ */
+volatile LONG DebuggerAggregationMapsLock;
+
 //////////////////////////////////////////////////
 //				Memory Manager		    		//
 //////////////////////////////////////////////////
@@ -125,6 +131,8 @@ typedef struct _PROCESSOR_DEBUGGING_STATE
     PGUEST_REGS                            GuestRegs;
     UINT64                                 HardwareDebugRegisterForStepping;
     UINT64 *                               ScriptEngineCoreSpecificLocalVariable;
+    PSCRIPT_ENGINE_AGGREGATION_MAPS        ScriptEngineCoreSpecificAggregationMaps;
+    volatile LONG64                        EventDispatchEpoch; // odd while the core uses the dispatch index
 
 } PROCESSOR_DEBUGGING_STATE, PPROCESSOR_DEBUGGING_STATE;
 
@@ -185,15 +193,30 @@ DebuggerUninitialize();
 PDEBUGGER_EVENT
 DebuggerCreateEvent(BOOLEAN Enabled, UINT32 CoreId, UINT32 ProcessId, DEBUGGER_EVENT_TYPE_ENUM EventType, UINT64 Tag, UINT64 OptionalParam1, UINT64 OptionalParam2, UINT64 OptionalParam3, UINT64 OptionalParam4, UINT32 ConditionsBufferSize, PVOID ConditionBuffer);
 
+VOID
+DebuggerJitCompileScriptOfAction(PDEBUGGER_EVENT_ACTION Action);
+
+VOID
+DebuggerFreeScriptJitCodeOfAction(PDEBUGGER_EVENT_ACTION Action);
+
 PDEBUGGER_EVENT_ACTION
 DebuggerAddActionToEvent(PDEBUGGER_EVENT Event, DEBUGGER_EVENT_ACTION_TYPE_ENUM ActionType, BOOLEAN SendTheResultsImmediately, PDEBUGGER_EVENT_REQUEST_CUSTOM_CODE InTheCaseOfCustomCode, PDEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION InTheCaseOfRunScript);
 
+PLIST_ENTRY
+DebuggerGetEventListByEventType(DEBUGGER_EVENT_TYPE_ENUM EventType);
+
 BOOLEAN
 DebuggerRegisterEvent(PDEBUGGER_EVENT Event);
 
+BOOLEAN
+DebuggerTriggerEventsFromDispatchIndex(DEBUGGER_EVENT_TYPE_ENUM EventType, UINT32 CoreIndex, PGUEST_REGS Regs, PVOID Context);
+
 BOOLEAN
 DebuggerTriggerEvents(DEBUGGER_EVENT_TYPE_ENUM EventType, PGUEST_REGS Regs, PVOID Context);
 
+BOOLEAN
+DebuggerCheckAndPerformEvent(PDEBUGGER_EVENT CurrentEvent, PGUEST_REGS Regs, PVOID Context);
+
 PDEBUGGER_EVENT
 DebuggerGetEventByTag(UINT64 Tag);
 
@@ -253,3 +276,12 @@ DebuggerPerformRunScript(UINT64 Tag, PDEBUGGER_EVENT_ACTION Action, PDEBUGGEE_SC
 
 VOID
 DebuggerPerformRunTheCustomCode(UINT64 Tag, PDEBUGGER_EVENT_ACTION Action, PGUEST_REGS Regs, PVOID Context);
+
+VOID
+DebuggerMergeAggregationMapsOfCurrentCore(PDEBUGGER_QUERY_AGGREGATION_MAPS AggregationMapsRequest);
+
+VOID
+DebuggerQueryAggregationMaps(PDEBUGGER_QUERY_AGGREGATION_MAPS AggregationMapsRequest);
+
+VOID
+DebuggerQueryAggregationMapsOfHaltedCores(PDEBUGGEE_AGGREGATION_MAPS_PACKET AggregationMapsPacket);
@@ -0,0 +1,161 @@
+/**
+ * @file EventDispatch.h
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief Headers of the dispatch index of debugger events
+ * @details
+ * @version 0.1
+ * @date 2021-10-11
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+
+#pragma once
+
+//////////////////////////////////////////////////
+//					Constants					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Count of different event types (DEBUGGER_EVENT_TYPE_ENUM)
+ *
+ */
+#define EVENT_DISPATCH_MAXIMUM_EVENT_TYPES (VMCALL_INSTRUCTION_EXECUTION + 1)
+
+/**
+ * @brief Minimum count of slots of the hash table of keys for the
+ * events that their keys are vectors (interrupts and exceptions)
+ *
+ */
+#define EVENT_DISPATCH_VECTOR_KEY_SLOTS 256
+
+/**
+ * @brief Count of unpublished snapshots of each event type that are
+ * preallocated for rebuilding the index in vmx-root
+ *
+ */
+#define EVENT_DISPATCH_STANDBY_SNAPSHOTS 2
+
+/**
+ * @brief Maximum average count of segments that each range event is
+ * added to, nested or overlapping ranges need more segments (up to the
+ * square of the count of ranges) and they're found by walking the list
+ * of events
+ *
+ */
+#define EVENT_DISPATCH_MAXIMUM_SEGMENTS_PER_RANGE_EVENT 16
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief A snapshot of the enabled events of a special type, it's
+ * never modified after it's published
+ *
+ * @details Buckets contain the events that are applied to all cores
+ * and also the events that are applied to that special core, in the
+ * same order as the list of events, so each vm-exit only touches
+ * the events that can actually be triggered on its core
+ *
+ */
+typedef struct _EVENT_DISPATCH_SNAPSHOT
+{
+    UINT32                Capacity;            // maximum count of events in each bucket
+    UINT32                RangeEventsCapacity; // maximum count of events of all segments in each bucket
+    UINT32                ProcessorCount;
+    LONG64 *              RetireEpochs; // dispatch epoch of each core when the snapshot is unpublished
+    EVENT_DISPATCH_BUCKET Buckets[1];   // one bucket for each core
+
+} EVENT_DISPATCH_SNAPSHOT, *PEVENT_DISPATCH_SNAPSHOT;
+
+/**
+ * @brief Dispatch index of a special event type
+ *
+ */
+typedef struct _EVENT_DISPATCH_TYPE_INDEX
+{
+    volatile PEVENT_DISPATCH_SNAPSHOT Snapshot;                                           // null means that there is no event of this type
+    PEVENT_DISPATCH_SNAPSHOT          StandbySnapshots[EVENT_DISPATCH_STANDBY_SNAPSHOTS]; // unpublished snapshots, reused in vmx-root
+    volatile BOOLEAN                  ListWalkFallback;                                   // the index is not usable, walk the list
+
+} EVENT_DISPATCH_TYPE_INDEX, *PEVENT_DISPATCH_TYPE_INDEX;
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+VOID
+EventDispatchInitialize();
+
+VOID
+EventDispatchUninitialize();
+
+BOOLEAN
+EventDispatchEnterIndex(UINT32 CoreIndex);
+
+VOID
+EventDispatchLeaveIndex(UINT32 CoreIndex);
+
+VOID
+EventDispatchRetireSnapshot(PEVENT_DISPATCH_SNAPSHOT Snapshot);
+
+BOOLEAN
+EventDispatchIsSnapshotQuiescent(PEVENT_DISPATCH_SNAPSHOT Snapshot);
+
+VOID
+EventDispatchWaitForQuiescence();
+
+BOOLEAN
+EventDispatchIsKeyedEventType(DEBUGGER_EVENT_TYPE_ENUM EventType, BOOLEAN * IdentityHash);
+
+BOOLEAN
+EventDispatchIsEventForAllKeys(PDEBUGGER_EVENT Event);
+
+BOOLEAN
+EventDispatchIsRangeEventType(DEBUGGER_EVENT_TYPE_ENUM EventType);
+
+UINT32
+EventDispatchGetKeySlotsCount(DEBUGGER_EVENT_TYPE_ENUM EventType, UINT32 Capacity);
+
+UINT32
+EventDispatchHashKey(PEVENT_DISPATCH_BUCKET Bucket, UINT64 Key);
+
+UINT32
+EventDispatchSortBounds(UINT64 * Bounds, UINT32 Count);
+
+UINT32
+EventDispatchFindSegment(UINT64 * Bounds, UINT32 BoundsCount, UINT64 Address);
+
+BOOLEAN
+EventDispatchCountRangeEvents(PLIST_ENTRY TargetEventList, UINT32 TotalCount, UINT32 * RangeEventsCount);
+
+PEVENT_DISPATCH_SNAPSHOT
+EventDispatchAllocateSnapshot(DEBUGGER_EVENT_TYPE_ENUM EventType, UINT32 Capacity, UINT32 RangeEventsCapacity, UINT32 ProcessorCount);
+
+VOID
+EventDispatchBuildKeySlots(PEVENT_DISPATCH_BUCKET Bucket);
+
+BOOLEAN
+EventDispatchBuildRanges(PEVENT_DISPATCH_BUCKET Bucket, UINT32 RangeEventsCapacity);
+
+BOOLEAN
+EventDispatchFillSnapshot(PEVENT_DISPATCH_SNAPSHOT Snapshot, PLIST_ENTRY TargetEventList);
+
+BOOLEAN
+EventDispatchRebuild(DEBUGGER_EVENT_TYPE_ENUM EventType);
+
+VOID
+EventDispatchRebuildAll();
+
+PEVENT_DISPATCH_BUCKET
+EventDispatchGetBucket(DEBUGGER_EVENT_TYPE_ENUM EventType, UINT32 CoreIndex, BOOLEAN * UseListWalk);
+
+PEVENT_DISPATCH_ENTRY
+EventDispatchFindKeyedEvents(PEVENT_DISPATCH_BUCKET Bucket, UINT64 Key, UINT32 * Count);
+
+PEVENT_DISPATCH_ENTRY
+EventDispatchFindRangeEvents(PEVENT_DISPATCH_BUCKET Bucket, UINT64 Address, UINT32 * Count);
+
+VOID
+EventDispatchTriggerBucket(PEVENT_DISPATCH_BUCKET Bucket, PGUEST_REGS Regs, PVOID Context);
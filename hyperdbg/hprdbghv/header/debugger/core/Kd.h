@@ -66,6 +66,31 @@ typedef struct _HARDWARE_DEBUG_REGISTER_DETAILS
 
 } HARDWARE_DEBUG_REGISTER_DETAILS, *PHARDWARE_DEBUG_REGISTER_DETAILS;
 
+/**
+ * @brief a script that is kept by the debuggee, the buffer of
+ * the script is right after the script packet
+ *
+ */
+typedef struct _KD_SCRIPT_CACHE_ENTRY
+{
+    UINT64                 Hash;
+    UINT64                 LastUse; // zero if the entry is not used
+    DEBUGGEE_SCRIPT_PACKET ScriptPacket;
+    BYTE                   ScriptBuffer[DEBUGGEE_SCRIPT_CACHE_MAXIMUM_SCRIPT_SIZE];
+
+} KD_SCRIPT_CACHE_ENTRY, *PKD_SCRIPT_CACHE_ENTRY;
+
+/**
+ * @brief the scripts that are kept by the debuggee
+ *
+ */
+typedef struct _KD_SCRIPT_CACHE
+{
+    UINT64                UseCounter;
+    KD_SCRIPT_CACHE_ENTRY Entries[DEBUGGEE_SCRIPT_CACHE_MAXIMUM_ENTRIES];
+
+} KD_SCRIPT_CACHE, *PKD_SCRIPT_CACHE;
+
 //////////////////////////////////////////////////
 //				   Functions 	    			//
 //////////////////////////////////////////////////
@@ -93,6 +118,12 @@ KdUninitializeKernelDebugger();
 VOID
 KdSendFormatsFunctionResult(UINT64 Value);
 
+PDEBUGGEE_SCRIPT_PACKET
+KdGetScriptFromCache(PDEBUGGEE_SCRIPT_PACKET ScriptPacket, CHAR * ScriptBuffer);
+
+BOOLEAN
+KdGetActionScriptFromCache(PDEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET ActionHeader, UINT32 MaximumLength);
+
 VOID
 KdSendCommandFinishedSignal(UINT32      CurrentProcessorIndex,
                             PGUEST_REGS GuestRegs);
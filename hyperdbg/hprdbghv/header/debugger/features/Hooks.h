@@ -215,6 +215,15 @@ EptHookRestoreAllHooksToOrginalEntry();
 VOID
 EptHookUnHookAll();
 
+/**
+ * @brief Remove a hooked page and its hidden breakpoints from the hash tables of hooked pages
+ * 
+ * @param HookedEntry 
+ * @return VOID 
+ */
+VOID
+EptHookRemoveFromHookedPagesTables(PEPT_HOOKED_PAGE_DETAIL HookedEntry);
+
 /**
  * @brief Remove single hook from the hooked pages list and invalidate TLB
  * 
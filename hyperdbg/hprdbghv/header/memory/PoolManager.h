@@ -22,45 +22,10 @@
 #define MaximumRequestsQueueDepth   100
 #define NumberOfPreAllocatedBuffers 10
 
-//////////////////////////////////////////////////
-//                    Enums		    			//
-//////////////////////////////////////////////////
-
-/**
- * @brief Inum of intentions for buffers (buffer tag)
- * 
- */
-typedef enum
-{
-    TRACKING_HOOKED_PAGES,
-    EXEC_TRAMPOLINE,
-    SPLIT_2MB_PAGING_TO_4KB_PAGE,
-    DETOUR_HOOK_DETAILS,
-    THREAD_STEPPINGS_DETAIIL,
-    BREAKPOINT_DEFINITION_STRUCTURE,
-
-} POOL_ALLOCATION_INTENTION;
-
 //////////////////////////////////////////////////
 //                   Structures		   			//
 //////////////////////////////////////////////////
 
-/**
- * @brief Table of holding pools detail structure
- * 
- */
-typedef struct _POOL_TABLE
-{
-    UINT64                    Address; // Should be the start of the list as we compute it as the start address
-    SIZE_T                    Size;
-    POOL_ALLOCATION_INTENTION Intention;
-    LIST_ENTRY                PoolsList;
-    BOOLEAN                   IsBusy;
-    BOOLEAN                   ShouldBeFreed;
-    BOOLEAN                   AlreadyFreed;
-
-} POOL_TABLE, *PPOOL_TABLE;
-
 /**
  * @brief Manage the requests for new allocations
  * 
@@ -113,6 +78,30 @@ BOOLEAN g_IsNewRequestForDeAllocation;
  */
 LIST_ENTRY g_ListOfAllocatedPoolsHead;
 
+/**
+ * @brief Free (not busy) pools of each intention
+ *
+ */
+LIST_ENTRY g_PoolManagerFreeListsHead[POOL_MANAGER_MAXIMUM_INTENTIONS];
+
+/**
+ * @brief Pools that should be freed on the next IOCTL
+ *
+ */
+LIST_ENTRY g_ListOfPoolsToBeFreedHead;
+
+/**
+ * @brief Hash table of the addresses of pools
+ *
+ */
+LIST_ENTRY g_PoolManagerAddressHashHeads[PoolManagerAddressHashBuckets];
+
+/**
+ * @brief Cached pools of each core
+ *
+ */
+PPOOL_MANAGER_CORE_CACHE g_PoolManagerCoreCaches;
+
 //////////////////////////////////////////////////
 //                   Functions		  			//
 //////////////////////////////////////////////////
@@ -176,3 +165,85 @@ PoolManagerUninitialize();
  */
 BOOLEAN
 PoolManagerFreePool(UINT64 AddressToFree);
+
+/**
+ * @brief Compute the bucket of a pool address
+ * 
+ * @param Address 
+ * @return UINT32 
+ */
+UINT32
+PoolManagerHashAddress(UINT64 Address);
+
+/**
+ * @brief Fill the cache of the current core from the free list of an intention
+ * and get a pool for the caller
+ * 
+ * @param CoreCache 
+ * @param Intention 
+ * @return PPOOL_TABLE 
+ */
+PPOOL_TABLE
+PoolManagerRefillCoreCache(PPOOL_MANAGER_CORE_CACHE CoreCache, POOL_ALLOCATION_INTENTION Intention);
+
+/**
+ * @brief Take a pool of an intention from the cache of other cores
+ * 
+ * @param Intention 
+ * @return PPOOL_TABLE 
+ */
+PPOOL_TABLE
+PoolManagerStealFromCoreCaches(POOL_ALLOCATION_INTENTION Intention);
+
+/**
+ * @brief Take a pool of an intention and give it to the caller (busy)
+ * 
+ * @param Intention 
+ * @return PPOOL_TABLE 
+ */
+PPOOL_TABLE
+PoolManagerTakePool(POOL_ALLOCATION_INTENTION Intention);
+
+/**
+ * @brief Add a new pool to the lists of the pool manager
+ * 
+ * @param SinglePool 
+ * @return VOID 
+ */
+VOID
+PoolManagerAddPool(PPOOL_TABLE SinglePool);
+
+/**
+ * @brief Add a pool that is given to a caller to the list of pools
+ * to be freed
+ * 
+ * @param AddressToFree 
+ * @return BOOLEAN 
+ */
+BOOLEAN
+PoolManagerMarkPoolToBeFreed(UINT64 AddressToFree);
+
+/**
+ * @brief Get the count of cores that have a cache
+ * 
+ * @return UINT32 
+ */
+UINT32
+PoolManagerGetCountOfCores();
+
+/**
+ * @brief Get the index of the current core
+ * 
+ * @return UINT32 
+ */
+UINT32
+PoolManagerGetCurrentCore();
+
+/**
+ * @brief Get the sum of the counters of the pool manager on all cores
+ * 
+ * @param Statistics 
+ * @return VOID 
+ */
+VOID
+PoolManagerQueryStatistics(PPOOL_MANAGER_STATISTICS Statistics);
@@ -241,3 +241,85 @@ BOOLEAN g_IsUnsafeSyscallOrSysretHandling;
  * 
  */
 DEBUGGEE_REQUEST_TO_CHANGE_PROCESS g_ProcessSwitch;
+
+/**
+ * @brief Scripts that are kept by the debuggee to run them
+ * again without receiving their buffers
+ * 
+ */
+KD_SCRIPT_CACHE g_KdScriptCache;
+
+/**
+ * @brief The merged aggregation map of all cores that is sent
+ * to the debugger while the debuggee is halted
+ * 
+ */
+SCRIPT_ENGINE_AGGREGATION_MAP g_KdAggregationMap;
+
+/**
+ * @brief Framing of the packets that are sent to the debugger, the
+ * framed packets are sent after receiving a framed packet
+ * 
+ */
+UINT32 g_SerialConnectionFramingVersion;
+
+/**
+ * @brief Table of computing CRC32 if the crc32 instruction
+ * is not supported
+ * 
+ */
+UINT32 g_SerialConnectionCrc32Table[256];
+
+/**
+ * @brief Shows whether the crc32 instruction (SSE4.2) is
+ * supported or not
+ * 
+ */
+BOOLEAN g_SerialConnectionCrc32IsHardwareSupported;
+
+/**
+ * @brief Sequence number of the request that the debuggee is
+ * answering, it's zero if the debugger doesn't send them
+ * 
+ */
+UINT32 g_KdSequenceNumberOfRequest;
+
+/**
+ * @brief Shows whether the bytes that are received while sending
+ * are kept or not, it's only set while the debuggee is halted as
+ * otherwise the serial port is used by the operating system
+ * 
+ */
+BOOLEAN g_SerialConnectionKeepReceivedBytes;
+
+/**
+ * @brief The bytes that the debugger sends while the debuggee
+ * is sending a packet
+ * 
+ */
+SERIAL_CONNECTION_RECEIVE_BUFFER g_SerialConnectionReceiveBuffer;
+
+/**
+ * @brief Shows whether the packets are sent in compressed frames
+ * or not, the debugger requests it in each of its requests
+ * 
+ */
+BOOLEAN g_SerialConnectionCompressFrames;
+
+/**
+ * @brief The buffers of compressing the packets
+ * 
+ */
+SERIAL_CONNECTION_COMPRESSION g_SerialConnectionCompression;
+
+/**
+ * @brief Dispatch index of each event type
+ *
+ */
+EVENT_DISPATCH_TYPE_INDEX g_EventDispatchIndex[EVENT_DISPATCH_MAXIMUM_EVENT_TYPES];
+
+/**
+ * @brief Shows whether the dispatch index is initialized or not
+ *
+ */
+BOOLEAN g_EventDispatchIndexInitialized;
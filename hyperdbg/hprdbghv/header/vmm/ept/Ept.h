@@ -17,6 +17,20 @@
 
 #define MaximumHiddenBreakpointsOnPage 40
 
+/**
+ * @brief Count of slots in the hash table of hooked pages (keyed by
+ * page frame number), should be a power of two
+ *
+ */
+#define MaximumHookedPagesTableSlots 1024
+
+/**
+ * @brief Count of slots in the hash table of hidden breakpoints (keyed
+ * by the address of the breakpoint), should be a power of two
+ *
+ */
+#define MaximumHiddenBreakpointsTableSlots 4096
+
 //////////////////////////////////////////////////
 //					Constants					//
 //////////////////////////////////////////////////
@@ -999,6 +1013,9 @@ typedef struct _EPT_STATE
     BOOLEAN             SecondaryInitialized;  // Is Secondary Page table entries initialized or not (Used in debugger mechanisms)
     EPTP                SecondaryEptPointer;   // Secondary Extended-Page-Table Pointer
 
+    EPT_HOOKED_PAGES_TABLE HookedPagesTable;       // Hooked pages by their page frame number
+    EPT_HOOKED_PAGES_TABLE HiddenBreakpointsTable; // Hooked pages by the address of their hidden breakpoints
+
 } EPT_STATE, *PEPT_STATE;
 
 /**
@@ -1338,3 +1355,164 @@ EptHandleMisconfiguration(UINT64 GuestAddress);
  */
 VOID
 EptSetPML1AndInvalidateTLB(PEPT_PML1_ENTRY EntryAddress, EPT_PML1_ENTRY EntryValue, INVEPT_TYPE InvalidationType);
+
+/**
+ * @brief Initialize the hash tables of hooked pages
+ *
+ * @return VOID
+ */
+VOID
+EptHookedPagesTablesInitialize();
+
+/**
+ * @brief Request the pools of the hash tables of hooked pages
+ *
+ * @return VOID
+ */
+VOID
+EptHookedPagesTablesReserve();
+
+/**
+ * @brief Get the size of the pool that holds the slots of a hash
+ * table of hooked pages
+ *
+ * @param Table
+ * @return UINT32
+ */
+UINT32
+EptHookedPagesTableGetStorageSize(PEPT_HOOKED_PAGES_TABLE Table);
+
+/**
+ * @brief Take the pool of a hash table of hooked pages from the
+ * pool manager
+ *
+ * @param Table
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookedPagesTableTakeStorage(PEPT_HOOKED_PAGES_TABLE Table);
+
+/**
+ * @brief Remove all the entries of a hash table of hooked pages
+ *
+ * @param Table
+ * @return VOID
+ */
+VOID
+EptHookedPagesTableReset(PEPT_HOOKED_PAGES_TABLE Table);
+
+/**
+ * @brief Empty the slots of a hash table of hooked pages
+ *
+ * @param Slots
+ * @param SlotsMask
+ * @return VOID
+ */
+VOID
+EptHookedPagesTableClearSlots(PEPT_HOOKED_PAGES_TABLE_SLOT Slots, UINT32 SlotsMask);
+
+/**
+ * @brief Get the count of cores that probe the hash tables of hooked pages
+ *
+ * @return UINT32
+ */
+UINT32
+EptHookedPagesTablesGetCountOfCores();
+
+/**
+ * @brief Get the epoch of a core in the hash tables of hooked pages
+ *
+ * @param CoreIndex
+ * @return LONG64
+ */
+LONG64
+EptHookedPagesTablesGetEpoch(UINT32 CoreIndex);
+
+/**
+ * @brief Start probing the hash tables of hooked pages on the current core
+ *
+ * @param CoreIndex
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookedPagesTablesEnter(UINT32 CoreIndex);
+
+/**
+ * @brief Stop probing the hash tables of hooked pages on the current core
+ *
+ * @param CoreIndex
+ * @return VOID
+ */
+VOID
+EptHookedPagesTablesLeave(UINT32 CoreIndex);
+
+/**
+ * @brief Check whether the spare slots of a hash table of hooked pages
+ * are still probed by any core or not
+ *
+ * @param Table
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookedPagesTableIsSpareQuiescent(PEPT_HOOKED_PAGES_TABLE Table);
+
+/**
+ * @brief Remove the deleted slots of a hash table of hooked pages
+ *
+ * @param Table
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookedPagesTableCompact(PEPT_HOOKED_PAGES_TABLE Table);
+
+/**
+ * @brief Compute the first slot of a key in a hash table of hooked pages
+ *
+ * @param Table
+ * @param Key
+ * @return UINT32
+ */
+UINT32
+EptHookedPagesTableHash(PEPT_HOOKED_PAGES_TABLE Table, UINT64 Key);
+
+/**
+ * @brief Add a key of a hooked page to a hash table of hooked pages
+ *
+ * @param Table
+ * @param Key
+ * @param HookedEntry
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookedPagesTableInsert(PEPT_HOOKED_PAGES_TABLE Table, UINT64 Key, PEPT_HOOKED_PAGE_DETAIL HookedEntry);
+
+/**
+ * @brief Remove a key of a hooked page from a hash table of hooked pages
+ *
+ * @param Table
+ * @param Key
+ * @param HookedEntry
+ * @return VOID
+ */
+VOID
+EptHookedPagesTableRemove(PEPT_HOOKED_PAGES_TABLE Table, UINT64 Key, PEPT_HOOKED_PAGE_DETAIL HookedEntry);
+
+/**
+ * @brief Find the hooked pages of a key in a hash table of hooked pages
+ *
+ * @param Table
+ * @param Key
+ * @param Cursor
+ * @return PEPT_HOOKED_PAGE_DETAIL
+ */
+PEPT_HOOKED_PAGE_DETAIL
+EptHookedPagesTableLookup(PEPT_HOOKED_PAGES_TABLE Table, UINT64 Key, PEPT_HOOKED_PAGES_TABLE_CURSOR Cursor);
+
+/**
+ * @brief Find the hooked page of a physical address
+ *
+ * @param PhysicalAddress
+ * @return PEPT_HOOKED_PAGE_DETAIL
+ */
+PEPT_HOOKED_PAGE_DETAIL
+EptFindHookedPageByPhysicalAddress(SIZE_T PhysicalAddress);
@@ -275,6 +275,13 @@
  */
 #define VMCALL_DISABLE_RDTSC_EXITING_ONLY_FOR_TSC_EVENTS 0x29
 
+/**
+ * @brief VMCALL to merge (and optionally clear) the aggregation
+ * maps of the current core
+ * 
+ */
+#define VMCALL_MERGE_AGGREGATION_MAPS 0x2a
+
 //////////////////////////////////////////////////
 //				    Functions					//
 //////////////////////////////////////////////////
@@ -600,6 +600,7 @@ typedef struct _VIRTUAL_MACHINE_STATE
     BOOLEAN                                 MtfTest;                         // It shows the detail of the hooked paged that should be restore in MTF vm-exit
     DEBUGGER_STEPPING_CORE_SPECIFIC_DETAILS DebuggerUserModeSteppingDetails; // It shows the detail of stepping for debugger in user-mode
     MEMORY_MAPPER_ADDRESSES                 MemoryMapper;                    // Memory mapper details for each core, contains PTE Virtual Address, Actual Kernel Virtual Address
+    volatile LONG64                         HookedPagesTablesEpoch;          // It's odd while the core probes the hash tables of hooked pages
 } VIRTUAL_MACHINE_STATE, *PVIRTUAL_MACHINE_STATE;
 
 /**
@@ -45,6 +45,7 @@
 #include "..\hprdbghv\header\vmm\vmx\Events.h"
 #include "..\hprdbghv\header\common\Common.h"
 #include "..\hprdbghv\header\debugger\core\Debugger.h"
+#include "..\hprdbghv\header\debugger\core\EventDispatch.h"
 #include "..\hprdbghv\header\devices\Apic.h"
 #include "..\hprdbghv\header\debugger\core\Kd.h"
 #include "..\hprdbghv\header\vmm\vmx\Mtf.h"
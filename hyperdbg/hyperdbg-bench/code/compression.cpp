@@ -0,0 +1,225 @@
+/**
+ * @file compression.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief benchmark of compressing the packets of the debug link
+ * @details The compression runs in this process by the same routines as
+ * the debuggee and the debugger, so this benchmark doesn't need a
+ * debuggee
+ * @version 0.1
+ * @date 2021-11-20
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+
+//
+// Include the compression of packets
+//
+#include "SerialCompression.h"
+
+/**
+ * @brief Compress the responses of reading memory
+ * @details The memory is split the same as KdSendReadMemoryPacketToDebuggee
+ * and each response is compressed the same as the debuggee, then it's
+ * decompressed the same as the debugger
+ *
+ * @param Buffer The memory that is read
+ * @param Size
+ * @param Result
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkCompressMemory(BYTE * Buffer, UINT32 Size, PBENCHMARK_COMPRESSION_RESULT Result)
+{
+    UINT16 * HashTable          = NULL;
+    BYTE *   Packet             = NULL;
+    BYTE *   CompressedPacket   = NULL;
+    BYTE *   DecompressedPacket = NULL;
+    UINT32   HeadersSize        = sizeof(DEBUGGER_REMOTE_PACKET) + sizeof(DEBUGGER_READ_MEMORY);
+    UINT32   PacketSize;
+    UINT32   CompressedSize;
+    UINT32   DecompressedSize;
+    BOOLEAN  IsSuccessful = FALSE;
+    UINT64   Start;
+
+    RtlZeroMemory(Result, sizeof(BENCHMARK_COMPRESSION_RESULT));
+
+    HashTable          = (UINT16 *)malloc(SERIAL_COMPRESSION_HASH_TABLE_SIZE * sizeof(UINT16));
+    Packet             = (BYTE *)malloc(MaxSerialPacketSize);
+    CompressedPacket   = (BYTE *)malloc(MaxSerialPacketSize);
+    DecompressedPacket = (BYTE *)malloc(MaxSerialPacketSize);
+
+    if (HashTable == NULL || Packet == NULL || CompressedPacket == NULL || DecompressedPacket == NULL)
+    {
+        goto Cleanup;
+    }
+
+    RtlZeroMemory(HashTable, SERIAL_COMPRESSION_HASH_TABLE_SIZE * sizeof(UINT16));
+    RtlZeroMemory(Packet, HeadersSize);
+
+    for (UINT32 Offset = 0; Offset < Size; Offset += SERIAL_READ_MEMORY_CHUNK_SIZE)
+    {
+        PacketSize = HeadersSize + (Size - Offset > SERIAL_READ_MEMORY_CHUNK_SIZE ? SERIAL_READ_MEMORY_CHUNK_SIZE : Size - Offset);
+
+        memcpy(&Packet[HeadersSize], &Buffer[Offset], PacketSize - HeadersSize);
+
+        Result->Size += sizeof(SERIAL_FRAME_HEADER) + PacketSize;
+
+        Start = BenchmarkGetTime();
+
+        CompressedSize = SerialCompressionCompress(HashTable,
+                                                   Packet,
+                                                   PacketSize,
+                                                   CompressedPacket,
+                                                   PacketSize - sizeof(UINT32) - 1);
+
+        Result->CompressionTime += BenchmarkGetTime() - Start;
+
+        //
+        // Packets that are not smaller after compression are sent as
+        // they are
+        //
+        if (CompressedSize == 0)
+        {
+            Result->CompressedSize += sizeof(SERIAL_FRAME_HEADER) + PacketSize;
+            continue;
+        }
+
+        Result->CompressedSize += sizeof(SERIAL_FRAME_HEADER) + sizeof(UINT32) + CompressedSize;
+
+        Start = BenchmarkGetTime();
+
+        if (!SerialCompressionDecompress(CompressedPacket,
+                                         CompressedSize,
+                                         DecompressedPacket,
+                                         MaxSerialPacketSize,
+                                         &DecompressedSize) ||
+            DecompressedSize != PacketSize ||
+            memcmp(DecompressedPacket, Packet, PacketSize) != 0)
+        {
+            Result->CountOfErrors++;
+        }
+
+        Result->DecompressionTime += BenchmarkGetTime() - Start;
+    }
+
+    IsSuccessful = TRUE;
+
+Cleanup:
+
+    free(HashTable);
+    free(Packet);
+    free(CompressedPacket);
+    free(DecompressedPacket);
+
+    return IsSuccessful;
+}
+
+ * @brief Benchmark of compressing the pages of a module
+ *
+ * @param Name
+ * @param Module
+ * @param Baudrate
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkCompressModule(const char * Name, HMODULE Module, UINT32 Baudrate)
+{
+    BENCHMARK_COMPRESSION_RESULT Result = {0};
+    BYTE *                       Base;
+    PIMAGE_NT_HEADERS            NtHeaders;
+    double                       LinkTime;
+    double                       CompressedLinkTime;
+
+    if (Module == NULL)
+    {
+        printf("err, unable to load %s (%x)\n", Name, GetLastError());
+        return FALSE;
+    }
+
+    //
+    // Modules that are loaded as resources have flags in the lower bits
+    //
+    Base      = (BYTE *)((UINT64)Module & ~(UINT64)3);
+    NtHeaders = (PIMAGE_NT_HEADERS)(Base + ((PIMAGE_DOS_HEADER)Base)->e_lfanew);
+
+    if (!BenchmarkCompressMemory(Base, NtHeaders->OptionalHeader.SizeOfImage, &Result))
+    {
+        printf("err, unable to compress %s\n", Name);
+        return FALSE;
+    }
+
+    //
+    // Seconds for sending the responses (each byte is 10 bits), the time of
+    // compressing and decompressing them is added to the compressed packets
+    //
+    LinkTime           = (Result.Size * 10.0) / Baudrate;
+    CompressedLinkTime = (Result.CompressedSize * 10.0) / Baudrate +
+                         (Result.CompressionTime + Result.DecompressionTime) / 1000000000.0;
+
+    printf("%-14s %10x %8.2f %14.2f %16.2f %16.2f %8.2f %8u\n",
+           Name,
+           NtHeaders->OptionalHeader.SizeOfImage,
+           (double)Result.Size / (double)Result.CompressedSize,
+           (NtHeaders->OptionalHeader.SizeOfImage * 1000.0) / (Result.CompressionTime + 1),
+           NtHeaders->OptionalHeader.SizeOfImage / (LinkTime * 1024.0),
+           NtHeaders->OptionalHeader.SizeOfImage / (CompressedLinkTime * 1024.0),
+           LinkTime / CompressedLinkTime,
+           Result.CountOfErrors);
+
+    return Result.CountOfErrors == 0;
+}
+
+ * @brief Benchmark of compressing the responses of reading memory
+ * @details The pages of the kernel (loaded as a resource) and ntdll
+ * stand for the kernel memory that is read by the debugger
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkCompression(int argc, char * argv[])
+{
+    HMODULE Kernel;
+    UINT32  Baudrate = CBR_115200;
+    BOOLEAN Result;
+
+    if (argc >= 1)
+    {
+        Baudrate = strtoul(argv[0], NULL, 10);
+    }
+
+    if (Baudrate == 0)
+    {
+        printf("err, invalid baud rate\n");
+        return FALSE;
+    }
+
+    printf("\nreading memory in chunks of %x bytes, baud rate : %u\n\n", SERIAL_READ_MEMORY_CHUNK_SIZE, Baudrate);
+
+    printf("%-14s %10s %8s %14s %16s %16s %8s %8s\n",
+           "module",
+           "size",
+           "ratio",
+           "compress MB/s",
+           "plain KB/s",
+           "compressed KB/s",
+           "speedup",
+           "errors");
+
+    Kernel = LoadLibraryExA("ntoskrnl.exe", NULL, LOAD_LIBRARY_AS_IMAGE_RESOURCE);
+
+    Result = BenchmarkCompressModule("ntoskrnl.exe", Kernel, Baudrate);
+    Result = BenchmarkCompressModule("ntdll.dll", GetModuleHandleA("ntdll.dll"), Baudrate) && Result;
+
+    if (Kernel != NULL)
+    {
+        FreeLibrary(Kernel);
+    }
+
+    return Result;
+}
@@ -0,0 +1,440 @@
+/**
+ * @file eventindex.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief benchmark of the dispatch index of events in user-mode
+ * @details The buckets use the same code as the hypervisor
+ * (EventDispatchBuckets.h), the events are triggered by the bucket of the
+ * first core and by walking the list of events, the same as
+ * DebuggerTriggerEvents, both of them should trigger the same events in
+ * the same order
+ * @version 0.1
+ * @date 2021-11-24
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+#include "EventDispatchBuckets.h"
+
+/**
+ * @brief Count of the events that are performed
+ *
+ */
+UINT64 g_BenchmarkDispatchIndexCountOfPerformed = 0;
+
+/**
+ * @brief Tags of the performed events (in the order of performing them)
+ *
+ */
+UINT64 g_BenchmarkDispatchIndexTrace = 0;
+
+/**
+ * @brief Check the event specific parameters of an event and perform it
+ * @details The same checks as the hypervisor for the event types of the
+ * benchmark, performing an event only keeps its tag
+ *
+ * @param CurrentEvent Event Object
+ * @param Regs Guest registers
+ * @param Context The MSR or the physical address
+ * @return BOOLEAN TRUE if the event is performed
+ */
+BOOLEAN
+DebuggerCheckAndPerformEvent(PDEBUGGER_EVENT CurrentEvent, PGUEST_REGS Regs, PVOID Context)
+{
+    switch (CurrentEvent->EventType)
+    {
+    case HIDDEN_HOOK_READ_AND_WRITE:
+        if (!((UINT64)Context >= CurrentEvent->OptionalParam1 && (UINT64)Context < CurrentEvent->OptionalParam2))
+        {
+            return FALSE;
+        }
+        break;
+
+    case RDMSR_INSTRUCTION_EXECUTION:
+        if (CurrentEvent->OptionalParam1 != DEBUGGER_EVENT_MSR_READ_OR_WRITE_ALL_MSRS && CurrentEvent->OptionalParam1 != (UINT64)Context)
+        {
+            return FALSE;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    g_BenchmarkDispatchIndexTrace = (g_BenchmarkDispatchIndexTrace * 31) + CurrentEvent->Tag;
+    g_BenchmarkDispatchIndexCountOfPerformed++;
+
+    return TRUE;
+}
+
+/**
+ * @brief Trigger the events by walking the list of events, the same
+ * as DebuggerTriggerEvents
+ *
+ * @param ListHead The list of events
+ * @param CoreIndex Index of the current core
+ * @param Context The MSR or the physical address
+ * @return VOID
+ */
+VOID
+BenchmarkDispatchIndexWalk(PLIST_ENTRY ListHead, UINT32 CoreIndex, PVOID Context)
+{
+    PLIST_ENTRY     TempList = ListHead;
+    PDEBUGGER_EVENT CurrentEvent;
+
+    while (ListHead != TempList->Flink)
+    {
+        TempList     = TempList->Flink;
+        CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+
+        if (!CurrentEvent->Enabled)
+        {
+            continue;
+        }
+
+        if (CurrentEvent->CoreId != DEBUGGER_EVENT_APPLY_TO_ALL_CORES && CurrentEvent->CoreId != CoreIndex)
+        {
+            continue;
+        }
+
+        DebuggerCheckAndPerformEvent(CurrentEvent, NULL, Context);
+    }
+}
+
+/**
+ * @brief Create the events of the benchmark
+ * @details The first and the last events are triggered, the other
+ * events are for another core (cpuid), for other MSRs (rdmsr) or for
+ * other pages (monitor), the first event is for all MSRs or contains
+ * all the pages
+ *
+ * @param EventType Type of events
+ * @param CountOfEvents Count of the events that are not triggered
+ * @param Events Storage of the events (CountOfEvents + 2)
+ * @param ListHead The list of events
+ * @return PVOID The context of the triggers (MSR or physical address)
+ */
+PVOID
+BenchmarkDispatchIndexCreateEvents(DEBUGGER_EVENT_TYPE_ENUM EventType, UINT32 CountOfEvents, PDEBUGGER_EVENT Events, PLIST_ENTRY ListHead)
+{
+    PDEBUGGER_EVENT Event;
+    UINT32          Last = CountOfEvents + 1;
+
+    RtlZeroMemory(Events, (CountOfEvents + 2) * sizeof(DEBUGGER_EVENT));
+
+    ListHead->Flink = ListHead;
+    ListHead->Blink = ListHead;
+
+    for (UINT32 i = 0; i <= Last; i++)
+    {
+        Event = &Events[i];
+
+        Event->Tag       = i + 1;
+        Event->EventType = EventType;
+        Event->Enabled   = TRUE;
+        Event->CoreId    = DEBUGGER_EVENT_APPLY_TO_ALL_CORES;
+        Event->ProcessId = DEBUGGER_EVENT_APPLY_TO_ALL_PROCESSES;
+
+        switch (EventType)
+        {
+        case CPUID_INSTRUCTION_EXECUTION:
+            if (i != 0 && i != Last)
+            {
+                Event->CoreId = 1;
+            }
+            break;
+
+        case RDMSR_INSTRUCTION_EXECUTION:
+            Event->OptionalParam1 = i == 0 ? DEBUGGER_EVENT_MSR_READ_OR_WRITE_ALL_MSRS : BENCHMARK_DISPATCH_INDEX_MSR + Last - i;
+            break;
+
+        case HIDDEN_HOOK_READ_AND_WRITE:
+            Event->OptionalParam1 = BENCHMARK_DISPATCH_INDEX_ADDRESS + (i == 0 ? 0 : (Last - i) * BENCHMARK_PAGE_SIZE);
+            Event->OptionalParam2 = i == 0 ? BENCHMARK_DISPATCH_INDEX_ADDRESS + (Last + 1) * BENCHMARK_PAGE_SIZE : Event->OptionalParam1 + 0x100;
+            break;
+
+        default:
+            break;
+        }
+
+        Event->EventsOfSameTypeList.Flink = ListHead;
+        Event->EventsOfSameTypeList.Blink = ListHead->Blink;
+        ListHead->Blink->Flink            = &Event->EventsOfSameTypeList;
+        ListHead->Blink                   = &Event->EventsOfSameTypeList;
+    }
+
+    switch (EventType)
+    {
+    case RDMSR_INSTRUCTION_EXECUTION:
+        return (PVOID)BENCHMARK_DISPATCH_INDEX_MSR;
+
+    case HIDDEN_HOOK_READ_AND_WRITE:
+        return (PVOID)(BENCHMARK_DISPATCH_INDEX_ADDRESS + 0x10);
+
+    default:
+        return NULL;
+    }
+}
+
+/**
+ * @brief Free the storage of a bucket
+ *
+ * @param Bucket The target bucket
+ * @return VOID
+ */
+VOID
+BenchmarkDispatchIndexFree(PEVENT_DISPATCH_BUCKET Bucket)
+{
+    free(Bucket->Events);
+    free(Bucket->KeyedEvents);
+    free(Bucket->KeySlots);
+    free(Bucket->Ranges);
+    free(Bucket->Bounds);
+    free(Bucket->Segments);
+    free(Bucket->RangeEvents);
+
+    RtlZeroMemory(Bucket, sizeof(EVENT_DISPATCH_BUCKET));
+}
+
+/**
+ * @brief Fill the bucket of a core, the same as EventDispatchFillSnapshot
+ *
+ * @param EventType Type of events
+ * @param ListHead The list of events
+ * @param CountOfEvents Count of events in the list
+ * @param CoreIndex Index of the core
+ * @param Bucket The target bucket (zeroed)
+ * @return BOOLEAN TRUE if the bucket is filled
+ */
+BOOLEAN
+BenchmarkDispatchIndexBuild(DEBUGGER_EVENT_TYPE_ENUM EventType, PLIST_ENTRY ListHead, UINT32 CountOfEvents, UINT32 CoreIndex, PEVENT_DISPATCH_BUCKET Bucket)
+{
+    PLIST_ENTRY           TempList = ListHead;
+    PDEBUGGER_EVENT       CurrentEvent;
+    PEVENT_DISPATCH_ENTRY Entry;
+    PEVENT_DISPATCH_RANGE Range;
+    UINT32                SlotsCount          = 8;
+    UINT32                RangeEventsCapacity = 4 * CountOfEvents;
+    UINT32                Order               = 0;
+
+    while (SlotsCount < CountOfEvents * 2)
+    {
+        SlotsCount = SlotsCount * 2;
+    }
+
+    Bucket->Events = (PEVENT_DISPATCH_ENTRY)calloc(CountOfEvents, sizeof(EVENT_DISPATCH_ENTRY));
+
+    if (EventType == RDMSR_INSTRUCTION_EXECUTION)
+    {
+        Bucket->KeyedEvents  = (PEVENT_DISPATCH_ENTRY)calloc(CountOfEvents, sizeof(EVENT_DISPATCH_ENTRY));
+        Bucket->KeySlots     = (PEVENT_DISPATCH_KEY_SLOT)calloc(SlotsCount, sizeof(EVENT_DISPATCH_KEY_SLOT));
+        Bucket->KeySlotsMask = SlotsCount - 1;
+
+        if (Bucket->KeyedEvents == NULL || Bucket->KeySlots == NULL)
+        {
+            return FALSE;
+        }
+    }
+
+    if (EventType == HIDDEN_HOOK_READ_AND_WRITE)
+    {
+        Bucket->Ranges      = (PEVENT_DISPATCH_RANGE)calloc(CountOfEvents, sizeof(EVENT_DISPATCH_RANGE));
+        Bucket->Bounds      = (UINT64 *)calloc(2 * CountOfEvents, sizeof(UINT64));
+        Bucket->Segments    = (UINT32 *)calloc(2 * CountOfEvents, sizeof(UINT32));
+        Bucket->RangeEvents = (PEVENT_DISPATCH_ENTRY)calloc(RangeEventsCapacity, sizeof(EVENT_DISPATCH_ENTRY));
+
+        if (Bucket->Ranges == NULL || Bucket->Bounds == NULL || Bucket->Segments == NULL || Bucket->RangeEvents == NULL)
+        {
+            return FALSE;
+        }
+    }
+
+    if (Bucket->Events == NULL)
+    {
+        return FALSE;
+    }
+
+    while (ListHead != TempList->Flink)
+    {
+        TempList     = TempList->Flink;
+        CurrentEvent = CONTAINING_RECORD(TempList, DEBUGGER_EVENT, EventsOfSameTypeList);
+
+        if (!CurrentEvent->Enabled)
+        {
+            continue;
+        }
+
+        if (CurrentEvent->CoreId != DEBUGGER_EVENT_APPLY_TO_ALL_CORES && CurrentEvent->CoreId != CoreIndex)
+        {
+            Order++;
+            continue;
+        }
+
+        if (Bucket->Ranges != NULL)
+        {
+            Range = &Bucket->Ranges[Bucket->RangesCount];
+            Bucket->RangesCount++;
+
+            Range->Start = CurrentEvent->OptionalParam1;
+            Range->End   = CurrentEvent->OptionalParam2;
+            Range->Event = CurrentEvent;
+            Range->Order = Order;
+        }
+        else
+        {
+            if (Bucket->KeySlotsMask != 0 && CurrentEvent->OptionalParam1 != DEBUGGER_EVENT_MSR_READ_OR_WRITE_ALL_MSRS)
+            {
+                Entry = &Bucket->KeyedEvents[Bucket->KeyedCount];
+                Bucket->KeyedCount++;
+            }
+            else
+            {
+                Entry = &Bucket->Events[Bucket->Count];
+                Bucket->Count++;
+            }
+
+            Entry->Event = CurrentEvent;
+            Entry->Order = Order;
+        }
+
+        Order++;
+    }
+
+    if (Bucket->KeySlotsMask != 0)
+    {
+        EventDispatchBuildKeySlots(Bucket);
+    }
+
+    if (Bucket->Ranges != NULL)
+    {
+        return EventDispatchBuildRanges(Bucket, RangeEventsCapacity);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Benchmark of triggering events by the dispatch index and by
+ * walking the list of events in user-mode
+ *
+ * @details Each trigger performs two events, the time of walking the list
+ * grows with the count of events while the index should not depend on it
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkDispatchIndex(int argc, char * argv[])
+{
+    DEBUGGER_EVENT_TYPE_ENUM EventTypes[]    = {CPUID_INSTRUCTION_EXECUTION, RDMSR_INSTRUCTION_EXECUTION, HIDDEN_HOOK_READ_AND_WRITE};
+    const char *             TypeNames[]     = {"cpuid", "rdmsr", "monitor"};
+    UINT32                   CountOfEvents[] = {0, 1, 16, 64, BENCHMARK_DISPATCH_INDEX_MAXIMUM_EVENTS};
+    EVENT_DISPATCH_BUCKET    Bucket;
+    LIST_ENTRY               ListHead;
+    PDEBUGGER_EVENT          Events;
+    PVOID                    Context;
+    UINT64                   WalkTrace;
+    UINT64                   Start;
+    UINT64                   End;
+    double                   WalkTime;
+    double                   IndexTime;
+    BOOLEAN                  IsMatched;
+    BOOLEAN                  Result = TRUE;
+
+    Events = (PDEBUGGER_EVENT)calloc(BENCHMARK_DISPATCH_INDEX_MAXIMUM_EVENTS + 2, sizeof(DEBUGGER_EVENT));
+
+    if (Events == NULL)
+    {
+        printf("err, unable to allocate the events\n");
+        return FALSE;
+    }
+
+    BenchmarkPinToCore(0);
+
+    printf("\n%-10s %-10s %16s %16s %10s %10s\n", "type", "events", "walk ns", "index ns", "ratio", "order");
+
+    for (size_t i = 0; i < sizeof(EventTypes) / sizeof(EventTypes[0]); i++)
+    {
+        for (size_t j = 0; j < sizeof(CountOfEvents) / sizeof(CountOfEvents[0]); j++)
+        {
+            Context = BenchmarkDispatchIndexCreateEvents(EventTypes[i], CountOfEvents[j], Events, &ListHead);
+
+            RtlZeroMemory(&Bucket, sizeof(EVENT_DISPATCH_BUCKET));
+
+            if (!BenchmarkDispatchIndexBuild(EventTypes[i], &ListHead, CountOfEvents[j] + 2, 0, &Bucket))
+            {
+                printf("err, unable to build the bucket of %s events\n", TypeNames[i]);
+                BenchmarkDispatchIndexFree(&Bucket);
+                Result = FALSE;
+                continue;
+            }
+
+            //
+            // Both of them should perform the first and the last events
+            //
+            g_BenchmarkDispatchIndexCountOfPerformed = 0;
+            g_BenchmarkDispatchIndexTrace            = 0;
+
+            BenchmarkDispatchIndexWalk(&ListHead, 0, Context);
+
+            WalkTrace = g_BenchmarkDispatchIndexTrace;
+            IsMatched = g_BenchmarkDispatchIndexCountOfPerformed == 2 && WalkTrace == (31 + CountOfEvents[j] + 2);
+
+            g_BenchmarkDispatchIndexCountOfPerformed = 0;
+            g_BenchmarkDispatchIndexTrace            = 0;
+
+            EventDispatchTriggerBucket(&Bucket, NULL, Context);
+
+            IsMatched &= g_BenchmarkDispatchIndexCountOfPerformed == 2 && g_BenchmarkDispatchIndexTrace == WalkTrace;
+            Result &= IsMatched;
+
+            //
+            // Warm up, then measure
+            //
+            for (UINT32 k = 0; k < BENCHMARK_DISPATCH_INDEX_TRIGGERS / 10; k++)
+            {
+                BenchmarkDispatchIndexWalk(&ListHead, 0, Context);
+            }
+
+            Start = BenchmarkGetTime();
+
+            for (UINT32 k = 0; k < BENCHMARK_DISPATCH_INDEX_TRIGGERS; k++)
+            {
+                BenchmarkDispatchIndexWalk(&ListHead, 0, Context);
+            }
+
+            End      = BenchmarkGetTime();
+            WalkTime = (double)(End - Start) / BENCHMARK_DISPATCH_INDEX_TRIGGERS;
+
+            for (UINT32 k = 0; k < BENCHMARK_DISPATCH_INDEX_TRIGGERS / 10; k++)
+            {
+                EventDispatchTriggerBucket(&Bucket, NULL, Context);
+            }
+
+            Start = BenchmarkGetTime();
+
+            for (UINT32 k = 0; k < BENCHMARK_DISPATCH_INDEX_TRIGGERS; k++)
+            {
+                EventDispatchTriggerBucket(&Bucket, NULL, Context);
+            }
+
+            End       = BenchmarkGetTime();
+            IndexTime = (double)(End - Start) / BENCHMARK_DISPATCH_INDEX_TRIGGERS;
+
+            printf("%-10s %-10u %16.1f %16.1f %10.2f %10s\n",
+                   TypeNames[i],
+                   CountOfEvents[j],
+                   WalkTime,
+                   IndexTime,
+                   WalkTime / IndexTime,
+                   IsMatched ? "ok" : "err");
+
+            BenchmarkDispatchIndexFree(&Bucket);
+        }
+    }
+
+    free(Events);
+
+    return Result;
+}
@@ -0,0 +1,237 @@
+/**
+ * @file events.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief benchmarks of triggering events
+ * @details
+ * @version 0.1
+ * @date 2021-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+
+/**
+ * @brief Measure the average time of a cpuid (vm-exit) on the
+ * current core
+ *
+ * @param Iterations Count of cpuid instructions
+ * @return double Average time in nanoseconds
+ */
+double
+BenchmarkMeasureCpuid(UINT32 Iterations)
+{
+    int    CpuInfo[4];
+    UINT64 Start;
+    UINT64 End;
+
+    Start = BenchmarkGetTime();
+
+    for (UINT32 i = 0; i < Iterations; i++)
+    {
+        __cpuidex(CpuInfo, 0, 0);
+    }
+
+    End = BenchmarkGetTime();
+
+    return (double)(End - Start) / Iterations;
+}
+
+/**
+ * @brief Benchmark of triggering events while events of the same
+ * type are registered for other cores
+ *
+ * @details The benchmark runs on the first core and the events are
+ * registered for the second core, so none of them is triggered, with
+ * the dispatch index, the time of each vm-exit should not depend on
+ * the count of events
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkEventDispatch(int argc, char * argv[])
+{
+    SYSTEM_INFO SystemInfo;
+    UINT32      CountOfEvents[] = {0, 1, 16, 64, 256};
+    UINT32      Registered      = 0;
+    double      BaseTime        = 0;
+    double      Time;
+    BOOLEAN     Result          = TRUE;
+
+    GetSystemInfo(&SystemInfo);
+
+    if (SystemInfo.dwNumberOfProcessors < 2)
+    {
+        printf("err, the benchmark needs at least two cores\n");
+        return FALSE;
+    }
+
+    if (!BenchmarkPinToCore(0))
+    {
+        return FALSE;
+    }
+
+    printf("\n%-10s %16s %10s\n", "events", "ns per cpuid", "ratio");
+
+    for (size_t i = 0; i < sizeof(CountOfEvents) / sizeof(CountOfEvents[0]) && Result; i++)
+    {
+        while (Registered < CountOfEvents[i])
+        {
+            if (!BenchmarkRunCommand("!cpuid core 1 script { bench = 0; }"))
+            {
+                Result = FALSE;
+                break;
+            }
+
+            Registered++;
+        }
+
+        if (!Result)
+        {
+            break;
+        }
+
+        //
+        // Warm up, then measure
+        //
+        BenchmarkMeasureCpuid(BENCHMARK_DISPATCH_CPUID_ITERATIONS / 10);
+        Time = BenchmarkMeasureCpuid(BENCHMARK_DISPATCH_CPUID_ITERATIONS);
+
+        if (i == 0)
+        {
+            BaseTime = Time;
+        }
+
+        printf("%-10u %16.1f %10.2f\n", CountOfEvents[i], Time, Time / BaseTime);
+    }
+
+    //
+    // The events are still applied after the benchmark otherwise
+    //
+    if (Registered != 0)
+    {
+        BenchmarkRunCommand("events c all");
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Measure the average time of reading from a monitored page
+ *
+ * @param Address Address in the monitored page
+ * @param Iterations Count of reads
+ * @return double Average time in nanoseconds
+ */
+double
+BenchmarkMeasureRead(volatile UINT64 * Address, UINT32 Iterations)
+{
+    UINT64 Value = 0;
+    UINT64 Start;
+    UINT64 End;
+
+    Start = BenchmarkGetTime();
+
+    for (UINT32 i = 0; i < Iterations; i++)
+    {
+        Value += *Address;
+    }
+
+    End = BenchmarkGetTime();
+
+    return (double)(End - Start) / Iterations;
+}
+
+/**
+ * @brief Benchmark of triggering a hidden hook read/write event while
+ * other pages of the process are also monitored
+ *
+ * @details Each event monitors a different page (as there is only one
+ * hidden hook in each page) and the benchmark reads from the first page,
+ * with the dispatch index, finding the events of an address is a binary
+ * search on the bounds of the ranges
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkRangeEvents(int argc, char * argv[])
+{
+    UINT32  CountOfEvents[] = {1, 16, 64, 256, 1024, BENCHMARK_RANGES_MAXIMUM_PAGES};
+    UINT32  Registered      = 0;
+    double  BaseTime        = 0;
+    double  Time;
+    char    Command[MAX_PATH];
+    PBYTE   Buffer;
+    SIZE_T  BufferSize = BENCHMARK_RANGES_MAXIMUM_PAGES * BENCHMARK_PAGE_SIZE;
+    BOOLEAN Result     = TRUE;
+
+    if (!BenchmarkPinToCore(0))
+    {
+        return FALSE;
+    }
+
+    //
+    // The pages should stay in the physical memory as the events are
+    // based on the physical addresses
+    //
+    Buffer = BenchmarkAllocateLockedBuffer(BufferSize);
+
+    if (Buffer == NULL)
+    {
+        return FALSE;
+    }
+
+    printf("\n%-10s %16s %10s\n", "events", "ns per read", "ratio");
+
+    for (size_t i = 0; i < sizeof(CountOfEvents) / sizeof(CountOfEvents[0]) && Result; i++)
+    {
+        while (Registered < CountOfEvents[i])
+        {
+            sprintf_s(Command,
+                      sizeof(Command),
+                      "!monitor r %llx %llx pid %x script { bench = 0; }",
+                      (UINT64)(Buffer + (Registered * BENCHMARK_PAGE_SIZE)),
+                      (UINT64)(Buffer + (Registered * BENCHMARK_PAGE_SIZE) + 0xff),
+                      GetCurrentProcessId());
+
+            if (!BenchmarkRunCommand(Command))
+            {
+                Result = FALSE;
+                break;
+            }
+
+            Registered++;
+        }
+
+        if (!Result)
+        {
+            break;
+        }
+
+        //
+        // Warm up, then measure
+        //
+        BenchmarkMeasureRead((volatile UINT64 *)Buffer, BENCHMARK_RANGES_READ_ITERATIONS / 10);
+        Time = BenchmarkMeasureRead((volatile UINT64 *)Buffer, BENCHMARK_RANGES_READ_ITERATIONS);
+
+        if (i == 0)
+        {
+            BaseTime = Time;
+        }
+
+        printf("%-10u %16.1f %10.2f\n", CountOfEvents[i], Time, Time / BaseTime);
+    }
+
+    //
+    // Events are removed before unlocking the buffer
+    //
+    BenchmarkRunCommand("events c all");
+
+    BenchmarkFreeLockedBuffer(Buffer, BufferSize);
+
+    return Result;
+}
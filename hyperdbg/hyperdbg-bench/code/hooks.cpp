@@ -0,0 +1,146 @@
+/**
+ * @file hooks.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief benchmarks of EPT hooks
+ * @details
+ * @version 0.1
+ * @date 2021-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+
+/**
+ * @brief Measure the average time of calling a function that is
+ * hooked by a hidden breakpoint
+ *
+ * @param Function The hooked function
+ * @param Iterations Count of calls
+ * @return double Average time in nanoseconds
+ */
+double
+BenchmarkMeasureCall(VOID (*Function)(), UINT32 Iterations)
+{
+    UINT64 Start;
+    UINT64 End;
+
+    Start = BenchmarkGetTime();
+
+    for (UINT32 i = 0; i < Iterations; i++)
+    {
+        Function();
+    }
+
+    End = BenchmarkGetTime();
+
+    return (double)(End - Start) / Iterations;
+}
+
+/**
+ * @brief Benchmark of triggering a hidden breakpoint (!epthook) while
+ * other pages of the process are also hooked
+ *
+ * @details Each hook is on a different page, so each hook adds a hooked
+ * page, the benchmark calls the function of the first page, with the hash
+ * tables of hooked pages, finding the hooked page of the breakpoint should
+ * not depend on the count of hooks
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkEptHooks(int argc, char * argv[])
+{
+    UINT32  CountOfHooks[] = {1, 16, 64, BENCHMARK_EPTHOOKS_MAXIMUM_PAGES};
+    UINT32  Registered     = 0;
+    double  BaseTime       = 0;
+    double  Time;
+    char    Command[MAX_PATH];
+    PBYTE   Buffer;
+    DWORD   OldProtect;
+    SIZE_T  BufferSize = BENCHMARK_EPTHOOKS_MAXIMUM_PAGES * BENCHMARK_PAGE_SIZE;
+    BOOLEAN Result     = TRUE;
+
+    if (!BenchmarkPinToCore(0))
+    {
+        return FALSE;
+    }
+
+    //
+    // The pages should stay in the physical memory as the hooks are
+    // based on the physical addresses
+    //
+    Buffer = BenchmarkAllocateLockedBuffer(BufferSize);
+
+    if (Buffer == NULL)
+    {
+        return FALSE;
+    }
+
+    //
+    // Each page starts with a function that only returns, the content
+    // of the page is copied to the fake page when it's hooked
+    //
+    for (UINT32 i = 0; i < BENCHMARK_EPTHOOKS_MAXIMUM_PAGES; i++)
+    {
+        Buffer[i * BENCHMARK_PAGE_SIZE] = 0xc3;
+    }
+
+    if (!VirtualProtect(Buffer, BufferSize, PAGE_EXECUTE_READ, &OldProtect))
+    {
+        printf("err, unable to make the buffer executable (%x)\n", GetLastError());
+        BenchmarkFreeLockedBuffer(Buffer, BufferSize);
+        return FALSE;
+    }
+
+    printf("\n%-10s %16s %10s\n", "hooks", "ns per call", "ratio");
+
+    for (size_t i = 0; i < sizeof(CountOfHooks) / sizeof(CountOfHooks[0]) && Result; i++)
+    {
+        while (Registered < CountOfHooks[i])
+        {
+            sprintf_s(Command,
+                      sizeof(Command),
+                      "!epthook %llx pid %x script { bench = 0; }",
+                      (UINT64)(Buffer + (Registered * BENCHMARK_PAGE_SIZE)),
+                      GetCurrentProcessId());
+
+            if (!BenchmarkRunCommand(Command))
+            {
+                Result = FALSE;
+                break;
+            }
+
+            Registered++;
+        }
+
+        if (!Result)
+        {
+            break;
+        }
+
+        //
+        // Warm up, then measure
+        //
+        BenchmarkMeasureCall((VOID(*)())Buffer, BENCHMARK_EPTHOOKS_CALL_ITERATIONS / 10);
+        Time = BenchmarkMeasureCall((VOID(*)())Buffer, BENCHMARK_EPTHOOKS_CALL_ITERATIONS);
+
+        if (i == 0)
+        {
+            BaseTime = Time;
+        }
+
+        printf("%-10u %16.1f %10.2f\n", CountOfHooks[i], Time, Time / BaseTime);
+    }
+
+    //
+    // Hooks are removed before unlocking the buffer
+    //
+    BenchmarkRunCommand("events c all");
+
+    BenchmarkFreeLockedBuffer(Buffer, BufferSize);
+
+    return Result;
+}
@@ -0,0 +1,606 @@
+/**
+ * @file hookstable.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief test of the hash tables of hooked pages in user-mode
+ * @details The tables use the same code as the hypervisor
+ * (HookedPagesTable.h), each reader thread is a core that finds the
+ * hooked pages without any lock while the main thread adds and removes
+ * them
+ * @version 0.1
+ * @date 2021-11-23
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+#include "HookedPagesTable.h"
+
+/**
+ * @brief Count of cores (readers and the writer) in the test
+ *
+ */
+UINT32 g_BenchmarkHooksTableCountOfCores = 1;
+
+/**
+ * @brief Epochs of the cores in the test
+ *
+ */
+volatile LONG64 g_BenchmarkHooksTableEpochs[MAXIMUM_WAIT_OBJECTS];
+
+/**
+ * @brief Get the count of cores that probe the hash tables
+ *
+ * @return UINT32
+ */
+UINT32
+EptHookedPagesTablesGetCountOfCores()
+{
+    return g_BenchmarkHooksTableCountOfCores;
+}
+
+/**
+ * @brief Get the epoch of a core
+ *
+ * @param CoreIndex Index of the core
+ * @return LONG64
+ */
+LONG64
+EptHookedPagesTablesGetEpoch(UINT32 CoreIndex)
+{
+    return g_BenchmarkHooksTableEpochs[CoreIndex];
+}
+
+/**
+ * @brief Allocate the slots of a hash table, the same as the pool of
+ * the pool manager in the hypervisor
+ * @details The storage is freed by BenchmarkHooksTableFree
+ *
+ * @param Table The target hash table
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookedPagesTableTakeStorage(PEPT_HOOKED_PAGES_TABLE Table)
+{
+    PEPT_HOOKED_PAGES_TABLE_SLOT Storage;
+
+    Storage = (PEPT_HOOKED_PAGES_TABLE_SLOT)calloc(1,
+                                                   (Table->SlotsMask + 1) * 2 * sizeof(EPT_HOOKED_PAGES_TABLE_SLOT) +
+                                                       g_BenchmarkHooksTableCountOfCores * sizeof(LONG64));
+
+    if (Storage == NULL)
+    {
+        return FALSE;
+    }
+
+    EptHookedPagesTableClearSlots(Storage, Table->SlotsMask);
+
+    Table->SpareSlots        = Storage + Table->SlotsMask + 1;
+    Table->SpareRetireEpochs = (LONG64 *)(Table->SpareSlots + Table->SlotsMask + 1);
+
+    InterlockedExchangePointer((PVOID volatile *)&Table->Slots, Storage);
+
+    return TRUE;
+}
+
+/**
+ * @brief Free the slots of a hash table
+ *
+ * @param Table The target hash table
+ * @return VOID
+ */
+VOID
+BenchmarkHooksTableFree(PEPT_HOOKED_PAGES_TABLE Table)
+{
+    //
+    // The slots and the spare slots are swapped by compacting the table
+    //
+    free(Table->Slots < Table->SpareSlots ? Table->Slots : Table->SpareSlots);
+
+    RtlZeroMemory(Table, sizeof(EPT_HOOKED_PAGES_TABLE));
+    Table->SlotsMask = BENCHMARK_HOOKS_TABLE_SLOTS - 1;
+}
+
+/**
+ * @brief Find a key that starts probing at a slot
+ *
+ * @param Table The target hash table
+ * @param Index Index of the slot
+ * @param Key The first key to check
+ * @return UINT64 The first key after (or equal to) Key that starts at the slot
+ */
+UINT64
+BenchmarkHooksTableFindKey(PEPT_HOOKED_PAGES_TABLE Table, UINT32 Index, UINT64 Key)
+{
+    while (EptHookedPagesTableHash(Table, Key) != Index)
+    {
+        Key++;
+    }
+
+    return Key;
+}
+
+/**
+ * @brief Count the hooked pages that are found for a key
+ *
+ * @param Table The target hash table
+ * @param Key The key
+ * @param HookedEntry A hooked page that should be found
+ * @return UINT32 Count of found hooked pages, or zero if HookedEntry
+ * is not found
+ */
+UINT32
+BenchmarkHooksTableLookup(PEPT_HOOKED_PAGES_TABLE Table, UINT64 Key, PBENCHMARK_HOOKS_TABLE_ENTRY HookedEntry)
+{
+    EPT_HOOKED_PAGES_TABLE_CURSOR Cursor = {0};
+    PBENCHMARK_HOOKS_TABLE_ENTRY  Found;
+    UINT32                        CountOfFound = 0;
+    BOOLEAN                       IsFound      = FALSE;
+
+    while ((Found = (PBENCHMARK_HOOKS_TABLE_ENTRY)EptHookedPagesTableLookup(Table, Key, &Cursor)) != NULL)
+    {
+        if (Found == HookedEntry)
+        {
+            IsFound = TRUE;
+        }
+
+        CountOfFound++;
+    }
+
+    return IsFound ? CountOfFound : 0;
+}
+
+/**
+ * @brief Show the result of a check of the test
+ *
+ * @param Condition The result of the check
+ * @param Description The description of the check
+ * @return BOOLEAN Condition
+ */
+BOOLEAN
+BenchmarkHooksTableCheck(BOOLEAN Condition, const char * Description)
+{
+    printf("%-72s %s\n", Description, Condition ? "ok" : "err");
+
+    return Condition;
+}
+
+/**
+ * @brief Check adding, removing, compacting and overflowing a hash
+ * table by a single thread
+ *
+ * @param Table The target hash table (empty)
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkHooksTableCheckChanges(PEPT_HOOKED_PAGES_TABLE Table)
+{
+    BENCHMARK_HOOKS_TABLE_ENTRY  Entries[BENCHMARK_HOOKS_TABLE_SLOTS + 1];
+    BENCHMARK_HOOKS_TABLE_ENTRY  OtherEntry;
+    PEPT_HOOKED_PAGES_TABLE_SLOT Slots;
+    UINT32                       Index;
+    UINT32                       Capacity = (BENCHMARK_HOOKS_TABLE_SLOTS * 3) / 4;
+    BOOLEAN                      Result   = TRUE;
+
+    //
+    // Three keys that start at the same slot
+    //
+    Entries[0].Key = BenchmarkHooksTableFindKey(Table, 5, 1);
+    Entries[1].Key = BenchmarkHooksTableFindKey(Table, 5, Entries[0].Key + 1);
+    Entries[2].Key = BenchmarkHooksTableFindKey(Table, 5, Entries[1].Key + 1);
+    Entries[3].Key = BenchmarkHooksTableFindKey(Table, 5, Entries[2].Key + 1);
+
+    for (UINT32 i = 0; i < 3; i++)
+    {
+        EptHookedPagesTableInsert(Table, Entries[i].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[i]);
+    }
+
+    Result &= BenchmarkHooksTableCheck(Table->LiveCount == 3 && Table->UsedCount == 3 &&
+                                           BenchmarkHooksTableLookup(Table, Entries[0].Key, &Entries[0]) == 1 &&
+                                           BenchmarkHooksTableLookup(Table, Entries[1].Key, &Entries[1]) == 1 &&
+                                           BenchmarkHooksTableLookup(Table, Entries[2].Key, &Entries[2]) == 1,
+                                       "keys of the same slot are added to the next slots");
+
+    //
+    // The same key of the same hooked page is counted
+    //
+    EptHookedPagesTableInsert(Table, Entries[1].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[1]);
+    EptHookedPagesTableRemove(Table, Entries[1].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[1]);
+
+    Result &= BenchmarkHooksTableCheck(Table->LiveCount == 3 &&
+                                           BenchmarkHooksTableLookup(Table, Entries[1].Key, &Entries[1]) == 1,
+                                       "a key that is added twice is found after removing it once");
+
+    EptHookedPagesTableRemove(Table, Entries[1].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[1]);
+
+    Result &= BenchmarkHooksTableCheck(Table->LiveCount == 2 && Table->UsedCount == 3 &&
+                                           Table->Slots[6].Key == EPT_HOOKED_PAGES_TABLE_DELETED_KEY &&
+                                           BenchmarkHooksTableLookup(Table, Entries[1].Key, &Entries[1]) == 0,
+                                       "a removed key leaves a deleted slot");
+
+    Result &= BenchmarkHooksTableCheck(BenchmarkHooksTableLookup(Table, Entries[2].Key, &Entries[2]) == 1,
+                                       "a key after a deleted slot is found");
+
+    EptHookedPagesTableInsert(Table, Entries[3].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[3]);
+
+    Result &= BenchmarkHooksTableCheck(Table->LiveCount == 3 && Table->UsedCount == 3 &&
+                                           Table->Slots[6].Key == Entries[3].Key &&
+                                           BenchmarkHooksTableLookup(Table, Entries[3].Key, &Entries[3]) == 1,
+                                       "a new key reuses the deleted slot");
+
+    //
+    // The same key in another hooked page (e.g., the same address in another process)
+    //
+    OtherEntry.Key = Entries[0].Key;
+    EptHookedPagesTableInsert(Table, OtherEntry.Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&OtherEntry);
+
+    Result &= BenchmarkHooksTableCheck(BenchmarkHooksTableLookup(Table, Entries[0].Key, &Entries[0]) == 2 &&
+                                           BenchmarkHooksTableLookup(Table, Entries[0].Key, &OtherEntry) == 2,
+                                       "both hooked pages of the same key are found");
+
+    EptHookedPagesTableRemove(Table, OtherEntry.Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&OtherEntry);
+
+    for (UINT32 i = 0; i < 4; i++)
+    {
+        EptHookedPagesTableRemove(Table, Entries[i].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[i]);
+    }
+
+    EptHookedPagesTableReset(Table);
+
+    //
+    // Fill the table, then remove all the keys except a few of them
+    //
+    for (UINT32 i = 0; i < Capacity; i++)
+    {
+        Entries[i].Key = 0x1000 + i;
+        EptHookedPagesTableInsert(Table, Entries[i].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[i]);
+    }
+
+    for (UINT32 i = 4; i < Capacity; i++)
+    {
+        EptHookedPagesTableRemove(Table, Entries[i].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[i]);
+    }
+
+    Result &= BenchmarkHooksTableCheck(Table->LiveCount == 4 && Table->UsedCount == Capacity && !Table->Overflowed,
+                                       "removed keys of a full table are deleted slots");
+
+    //
+    // A key that starts at an empty slot can't reuse the deleted slots
+    //
+    Slots = Table->Slots;
+
+    for (Index = 0; Slots[Index].Key != EPT_HOOKED_PAGES_TABLE_EMPTY_KEY; Index++)
+    {
+    }
+
+    Entries[Capacity].Key = BenchmarkHooksTableFindKey(Table, Index, 0x2000);
+
+    Result &= BenchmarkHooksTableCheck(EptHookedPagesTableInsert(Table, Entries[Capacity].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[Capacity]) &&
+                                           Table->Slots != Slots && Table->SpareSlots == Slots &&
+                                           Table->LiveCount == 5 && Table->UsedCount == 5,
+                                       "a crowded table is compacted to the spare slots");
+
+    for (UINT32 i = 0; i <= Capacity; i++)
+    {
+        if (BenchmarkHooksTableLookup(Table, Entries[i].Key, &Entries[i]) != (i < 4 || i == Capacity))
+        {
+            Result &= BenchmarkHooksTableCheck(FALSE, "keys are found after compacting the table");
+            break;
+        }
+    }
+
+    //
+    // A core that probes the table while it's compacted keeps the previous
+    // slots, they can't be the next spare slots until the core leaves
+    //
+    EptHookedPagesTableRemove(Table, Entries[Capacity].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[Capacity]);
+
+    g_BenchmarkHooksTableEpochs[1] = 1;
+    Slots                          = Table->Slots;
+
+    Result &= BenchmarkHooksTableCheck(EptHookedPagesTableCompact(Table) && Table->Slots != Slots && Table->UsedCount == 4,
+                                       "a table is compacted while a core probes it");
+
+    Slots = Table->Slots;
+
+    Result &= BenchmarkHooksTableCheck(!EptHookedPagesTableCompact(Table) && Table->Slots == Slots,
+                                       "the slots that the core probes are not reused");
+
+    for (UINT32 i = 4; i < Capacity; i++)
+    {
+        EptHookedPagesTableInsert(Table, Entries[i].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[i]);
+    }
+
+    for (UINT32 i = 4; i < Capacity; i++)
+    {
+        EptHookedPagesTableRemove(Table, Entries[i].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[i]);
+    }
+
+    for (Index = 0; Slots[Index].Key != EPT_HOOKED_PAGES_TABLE_EMPTY_KEY; Index++)
+    {
+    }
+
+    Entries[Capacity].Key = BenchmarkHooksTableFindKey(Table, Index, 0x4000);
+
+    Result &= BenchmarkHooksTableCheck(!EptHookedPagesTableInsert(Table, Entries[Capacity].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[Capacity]) &&
+                                           Table->Slots == Slots && Table->Overflowed,
+                                       "a table overflows if the spare slots are still probed");
+
+    g_BenchmarkHooksTableEpochs[1] = 2;
+
+    for (UINT32 i = 0; i < 4; i++)
+    {
+        EptHookedPagesTableRemove(Table, Entries[i].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[i]);
+    }
+
+    EptHookedPagesTableReset(Table);
+
+    Result &= BenchmarkHooksTableCheck(!Table->Overflowed && Table->LiveCount == 0 && Table->UsedCount == 0 &&
+                                           BenchmarkHooksTableLookup(Table, Entries[0].Key, &Entries[0]) == 0,
+                                       "an empty table is reset");
+
+    //
+    // Keep at most 3/4 of the slots used
+    //
+    for (UINT32 i = 0; i < Capacity; i++)
+    {
+        Entries[i].Key = 0x5000 + i;
+
+        if (!EptHookedPagesTableInsert(Table, Entries[i].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[i]))
+        {
+            break;
+        }
+    }
+
+    Entries[Capacity].Key = 0x5000 + Capacity;
+
+    Result &= BenchmarkHooksTableCheck(Table->LiveCount == Capacity && !Table->Overflowed &&
+                                           !EptHookedPagesTableInsert(Table, Entries[Capacity].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[Capacity]) &&
+                                           Table->Overflowed &&
+                                           !EptHookedPagesTableInsert(Table, Entries[Capacity].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[Capacity]),
+                                       "a full table overflows and stays overflowed");
+
+    for (UINT32 i = 0; i < Capacity; i++)
+    {
+        EptHookedPagesTableRemove(Table, Entries[i].Key, (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[i]);
+    }
+
+    EptHookedPagesTableReset(Table);
+
+    return Result;
+}
+
+/**
+ * @brief Find the hooked pages of random keys, the same as the handlers
+ * of EPT violations and breakpoints
+ * @details Each found hooked page should be a hooked page of the key
+ *
+ * @param Parameter The details of the reader (BENCHMARK_HOOKS_TABLE_READER)
+ * @return DWORD
+ */
+DWORD WINAPI
+BenchmarkHooksTableReader(LPVOID Parameter)
+{
+    PBENCHMARK_HOOKS_TABLE_READER Reader = (PBENCHMARK_HOOKS_TABLE_READER)Parameter;
+    EPT_HOOKED_PAGES_TABLE_CURSOR Cursor;
+    PBENCHMARK_HOOKS_TABLE_ENTRY  HookedEntry;
+    UINT64                        Key;
+    UINT32                        Random = 0x87654321 + Reader->CoreIndex;
+
+    BenchmarkPinToCore(Reader->CoreIndex);
+
+    while (!*Reader->IsStopped)
+    {
+        Random ^= Random << 13;
+        Random ^= Random >> 17;
+        Random ^= Random << 5;
+
+        Key = Reader->Keys[Random % BENCHMARK_HOOKS_TABLE_KEYS];
+
+        //
+        // The same as EptHookedPagesTablesEnter and EptHookedPagesTablesLeave
+        //
+        InterlockedIncrement64(&g_BenchmarkHooksTableEpochs[Reader->CoreIndex]);
+
+        RtlZeroMemory(&Cursor, sizeof(Cursor));
+
+        while ((HookedEntry = (PBENCHMARK_HOOKS_TABLE_ENTRY)EptHookedPagesTableLookup(Reader->Table, Key, &Cursor)) != NULL)
+        {
+            if (HookedEntry->Key != Key)
+            {
+                Reader->CountOfMismatches++;
+            }
+        }
+
+        InterlockedIncrement64(&g_BenchmarkHooksTableEpochs[Reader->CoreIndex]);
+
+        Reader->CountOfLookups++;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Test of the hash tables of hooked pages without the hypervisor
+ *
+ * @details First, adding the same key more than once, deleted slots,
+ * compacting the table and overflowing the table are checked by a single
+ * thread, then the main thread (the first core) adds and removes keys that
+ * start in a few slots, so slots are deleted and reused by other keys all
+ * the time, while the other threads find the hooked pages of the keys
+ * without any lock, each found hooked page should belong to its key
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkHooksTable(int argc, char * argv[])
+{
+    SYSTEM_INFO                  SystemInfo;
+    EPT_HOOKED_PAGES_TABLE       Table = {0};
+    BENCHMARK_HOOKS_TABLE_ENTRY  Entries[BENCHMARK_HOOKS_TABLE_KEYS];
+    BOOLEAN                      IsAdded[BENCHMARK_HOOKS_TABLE_KEYS] = {0};
+    UINT64                       Keys[BENCHMARK_HOOKS_TABLE_KEYS];
+    BENCHMARK_HOOKS_TABLE_READER Readers[MAXIMUM_WAIT_OBJECTS];
+    HANDLE                       ThreadHandles[MAXIMUM_WAIT_OBJECTS];
+    volatile LONG                IsStopped = FALSE;
+    UINT32                       CountOfReaders;
+    UINT32                       CountOfAddedKeys = 0;
+    UINT32                       Random = 0x12345678;
+    UINT32                       Index;
+    UINT64                       Start;
+    UINT64                       End;
+    UINT64                       CountOfLookups     = 0;
+    UINT64                       CountOfMismatches  = 0;
+    UINT64                       CountOfCompactions = 0;
+    UINT64                       CountOfOverflows   = 0;
+    PEPT_HOOKED_PAGES_TABLE_SLOT Slots;
+    BOOLEAN                      Result;
+
+    GetSystemInfo(&SystemInfo);
+
+    //
+    // One of the cores is for the writer, at least one reader
+    //
+    CountOfReaders = min(max(SystemInfo.dwNumberOfProcessors, 2) - 1, MAXIMUM_WAIT_OBJECTS - 1);
+
+    g_BenchmarkHooksTableCountOfCores = CountOfReaders + 1;
+    RtlZeroMemory((PVOID)g_BenchmarkHooksTableEpochs, sizeof(g_BenchmarkHooksTableEpochs));
+
+    Table.SlotsMask = BENCHMARK_HOOKS_TABLE_SLOTS - 1;
+
+    printf("\n");
+
+    Result = BenchmarkHooksTableCheckChanges(&Table);
+
+    BenchmarkHooksTableFree(&Table);
+
+    //
+    // Half of the keys start in a few slots, so their slots are reused by
+    // each other, the other half start in all the slots, so the deleted
+    // slots are not always reused and the table is compacted
+    //
+    for (UINT32 i = 0; i < BENCHMARK_HOOKS_TABLE_KEYS; i++)
+    {
+        Index          = (i % 2) ? i % BENCHMARK_HOOKS_TABLE_SLOTS : i % BENCHMARK_HOOKS_TABLE_CROWDED_SLOTS;
+        Keys[i]        = BenchmarkHooksTableFindKey(&Table, Index, i == 0 ? 1 : Keys[i - 1] + 1);
+        Entries[i].Key = Keys[i];
+    }
+
+    BenchmarkPinToCore(0);
+
+    for (CountOfReaders = 0; CountOfReaders < g_BenchmarkHooksTableCountOfCores - 1; CountOfReaders++)
+    {
+        Readers[CountOfReaders].Table             = &Table;
+        Readers[CountOfReaders].Keys              = Keys;
+        Readers[CountOfReaders].CoreIndex         = CountOfReaders + 1;
+        Readers[CountOfReaders].IsStopped         = &IsStopped;
+        Readers[CountOfReaders].CountOfLookups    = 0;
+        Readers[CountOfReaders].CountOfMismatches = 0;
+
+        ThreadHandles[CountOfReaders] = CreateThread(NULL, 0, BenchmarkHooksTableReader, &Readers[CountOfReaders], 0, NULL);
+
+        if (ThreadHandles[CountOfReaders] == NULL)
+        {
+            printf("err, unable to create the thread (%x)\n", GetLastError());
+            Result = FALSE;
+            break;
+        }
+    }
+
+    Start = BenchmarkGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_HOOKS_TABLE_CHANGES && CountOfReaders != 0; i++)
+    {
+        Random ^= Random << 13;
+        Random ^= Random >> 17;
+        Random ^= Random << 5;
+
+        Index = Random % BENCHMARK_HOOKS_TABLE_KEYS;
+        Slots = Table.Slots;
+
+        if (!IsAdded[Index] && CountOfAddedKeys == BENCHMARK_HOOKS_TABLE_MAXIMUM_ADDED_KEYS)
+        {
+            //
+            // Remove the next added key instead
+            //
+            while (!IsAdded[Index])
+            {
+                Index = (Index + 1) % BENCHMARK_HOOKS_TABLE_KEYS;
+            }
+        }
+
+        if (IsAdded[Index])
+        {
+            EptHookedPagesTableRemove(&Table, Keys[Index], (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[Index]);
+            IsAdded[Index] = FALSE;
+            CountOfAddedKeys--;
+            continue;
+        }
+
+        if (EptHookedPagesTableInsert(&Table, Keys[Index], (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[Index]))
+        {
+            IsAdded[Index] = TRUE;
+            CountOfAddedKeys++;
+
+            if (Slots != NULL && Table.Slots != Slots)
+            {
+                CountOfCompactions++;
+            }
+
+            continue;
+        }
+
+        //
+        // The spare slots are still probed, the same as the hypervisor, the
+        // table is reset once all the keys are removed
+        //
+        CountOfOverflows++;
+
+        for (UINT32 j = 0; j < BENCHMARK_HOOKS_TABLE_KEYS; j++)
+        {
+            if (IsAdded[j])
+            {
+                EptHookedPagesTableRemove(&Table, Keys[j], (struct _EPT_HOOKED_PAGE_DETAIL *)&Entries[j]);
+                IsAdded[j] = FALSE;
+            }
+        }
+
+        CountOfAddedKeys = 0;
+
+        EptHookedPagesTableReset(&Table);
+    }
+
+    End = BenchmarkGetTime();
+
+    InterlockedExchange(&IsStopped, TRUE);
+
+    WaitForMultipleObjects(CountOfReaders, ThreadHandles, TRUE, INFINITE);
+
+    for (UINT32 i = 0; i < CountOfReaders; i++)
+    {
+        CloseHandle(ThreadHandles[i]);
+
+        CountOfLookups += Readers[i].CountOfLookups;
+        CountOfMismatches += Readers[i].CountOfMismatches;
+    }
+
+    BenchmarkHooksTableFree(&Table);
+
+    printf("\n%-10s %16s %16s %12s %12s %12s\n", "readers", "changes per s", "lookups per s", "compactions", "overflows", "mismatches");
+    printf("%-10u %16.0f %16.0f %12llu %12llu %12llu\n",
+           CountOfReaders,
+           BENCHMARK_HOOKS_TABLE_CHANGES / ((double)(End - Start) / 1000000000),
+           CountOfLookups / ((double)(End - Start) / 1000000000),
+           CountOfCompactions,
+           CountOfOverflows,
+           CountOfMismatches);
+
+    if (CountOfMismatches != 0)
+    {
+        printf("\nerr, hooked pages are found for other keys\n");
+        Result = FALSE;
+    }
+
+    return Result;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file hyperdbg-bench.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief benchmarks of HyperDbg
+ * @details The benchmarks are not a part of the debugger, each of them
+ * is selected by its name from the command line, those that need the
+ * hypervisor load the vmm module (as administrator) and unload it after
+ * the benchmark
+ *
+ * @version 0.1
+ * @date 2021-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+
+/**
+ * @brief List of benchmarks
+ *
+ */
+BENCHMARK_ENTRY g_Benchmarks[] = {
+    {"dispatch", "triggering events while events of the same type are registered for other cores", TRUE, BenchmarkEventDispatch},
+    {"eventindex", "triggering events by the dispatch index and by walking the list of events in user-mode while other cores, keys and ranges have events", FALSE, BenchmarkDispatchIndex},
+    {"ranges", "triggering a monitor (hidden hook read/write) event while other pages are monitored", TRUE, BenchmarkRangeEvents},
+    {"epthooks", "triggering a hidden breakpoint (!epthook) while other pages are hooked", TRUE, BenchmarkEptHooks},
+    {"hookstable", "adding, removing and finding keys in the hash tables of hooked pages while other threads read them", FALSE, BenchmarkHooksTable},
+    {"pools", "requesting and freeing the pools of the pool manager by applying and clearing events [rounds (hex value)]", TRUE, BenchmarkPoolManager},
+    {"poolcaches", "requesting and freeing pools by the free lists and the caches of the pool manager in user-mode by multiple threads", FALSE, BenchmarkPoolCaches},
+    {"logging", "sending messages from vmx-root to user-mode on multiple cores at the same time [length of messages (hex value)]", TRUE, BenchmarkLogging},
+    {"logrings", "writing messages to the per-core log buffers by multiple threads while one thread merges and reads them [length of messages (hex value)]", FALSE, BenchmarkLogRings},
+    {"doorbell", "reading the log buffers that are mapped to user-mode while messages are written in bursts, checks that no doorbell is missed", FALSE, BenchmarkLogDoorbell},
+    {"logbatch", "reading the log buffers one message at a time and in batches, with and without sleeping before each read [length of messages (hex value)] [round trip of a read - microseconds (decimal value)]", FALSE, BenchmarkLogBatch},
+    {"receive", "receiving packets of the debuggee through a local named pipe by byte-wise and buffered reads", FALSE, BenchmarkReceive},
+    {"link", "reading memory of a simulated debuggee over a named pipe with latency and a limited baud rate, one chunk at a time and pipelined [latency - microseconds (decimal value)] [baud rate (decimal value)]", FALSE, BenchmarkLink},
+    {"compression", "compressing the responses of reading memory over the debug link [baud rate (decimal value)]", FALSE, BenchmarkCompression},
+    {"scripts", "running the test-cases of the script engine by the interpreter, the bytecode and the jit", FALSE, BenchmarkScripts},
+    {"parser", "parsing a large script by the script engine", FALSE, BenchmarkScriptParser},
+    {"printf", "rendering the printf statements of scripts by parsing the format each time and by the precompiled format specifiers", FALSE, BenchmarkScriptPrintf},
+    {"registers", "reading and writing the registers by the script engine", FALSE, BenchmarkScriptRegisters},
+};
+
+/**
+ * @brief Show the usage of the benchmarks
+ *
+ * @return VOID
+ */
+VOID
+BenchmarkShowUsage()
+{
+    printf("usage : hyperdbg-bench [benchmark] [parameters]\n\n");
+    printf("benchmarks :\n");
+
+    for (size_t i = 0; i < sizeof(g_Benchmarks) / sizeof(g_Benchmarks[0]); i++)
+    {
+        printf("\t%-12s %s%s\n",
+               g_Benchmarks[i].Name,
+               g_Benchmarks[i].Description,
+               g_Benchmarks[i].NeedsVmm ? " (needs the vmm module)" : "");
+    }
+}
+
+/**
+ * @brief Main function of benchmarks
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int
+main(int argc, char * argv[])
+{
+    PBENCHMARK_ENTRY Benchmark = NULL;
+    BOOLEAN          Result;
+
+    if (argc < 2)
+    {
+        BenchmarkShowUsage();
+        return 1;
+    }
+
+    for (size_t i = 0; i < sizeof(g_Benchmarks) / sizeof(g_Benchmarks[0]); i++)
+    {
+        if (!strcmp(argv[1], g_Benchmarks[i].Name))
+        {
+            Benchmark = &g_Benchmarks[i];
+            break;
+        }
+    }
+
+    if (Benchmark == NULL)
+    {
+        printf("err, benchmark '%s' not found\n\n", argv[1]);
+        BenchmarkShowUsage();
+        return 1;
+    }
+
+    if (Benchmark->NeedsVmm && !BenchmarkLoadVmm())
+    {
+        return 1;
+    }
+
+    Result = Benchmark->Routine(argc - 2, &argv[2]);
+
+    if (Benchmark->NeedsVmm)
+    {
+        BenchmarkUnloadVmm();
+    }
+
+    return Result ? 0 : 1;
+}
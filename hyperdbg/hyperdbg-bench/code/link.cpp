@@ -0,0 +1,646 @@
+/**
+ * @file link.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief benchmark of the link to the debuggee
+ * @details A simulated debuggee answers the requests of the debugger over
+ * a local named pipe with the latency and the baud rate of a serial link,
+ * and the debugger (hprdbgctrl) reads its memory by the same commands as
+ * the user, so this benchmark doesn't need the vmm module
+ * @version 0.1
+ * @date 2021-11-20
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+
+//
+// Global Variables
+//
+BENCHMARK_LINK g_BenchmarkLink = {0};
+
+/**
+ * @brief Handle the messages of HPRDBGCTRL while it's connected to the
+ * simulated debuggee
+ * @details The memory that is read is not shown, the debugger waits for
+ * the debuggee to pause after showing that the debuggee is running
+ *
+ * @param Text The message
+ * @return int
+ */
+int
+BenchmarkLinkMessageHandler(const char * Text)
+{
+    if (!strncmp(Text, "debuggee is running", 19))
+    {
+        SetEvent(g_BenchmarkLink.RunningEvent);
+    }
+    else if (!strncmp(Text, "err", 3))
+    {
+        printf("%s", Text);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Get the time of sending bytes over the link
+ *
+ * @param Link
+ * @param Length Count of bytes (each byte is sent in 10 bits)
+ *
+ * @return UINT64 Time in nanoseconds
+ */
+UINT64
+BenchmarkLinkGetTransferTime(PBENCHMARK_LINK Link, UINT32 Length)
+{
+    return (Length * 10 * 1000000000ull) / Link->Baudrate;
+}
+
+/**
+ * @brief Wait until a specific time
+ * @details Sleep is not precise enough for the latency of the link, so
+ * the last milliseconds are spent by yielding the processor
+ *
+ * @param Time Time in nanoseconds (the same as BenchmarkGetTime)
+ *
+ * @return VOID
+ */
+VOID
+BenchmarkLinkWaitUntil(UINT64 Time)
+{
+    UINT64 Now;
+
+    while ((Now = BenchmarkGetTime()) < Time)
+    {
+        if (Time - Now > 2000000)
+        {
+            Sleep(1);
+        }
+        else
+        {
+            SwitchToThread();
+        }
+    }
+}
+
+/**
+ * @brief Send a framed packet from the simulated debuggee to the debugger
+ *
+ * @param Link
+ * @param Overlapped Overlapped structure of writes
+ * @param RequestedAction
+ * @param SequenceNumber Sequence number of the request (zero if it's not a response)
+ * @param Buffer
+ * @param Length
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkLinkSendPacket(PBENCHMARK_LINK                         Link,
+                        LPOVERLAPPED                            Overlapped,
+                        DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedAction,
+                        UINT32                                  SequenceNumber,
+                        PVOID                                   Buffer,
+                        UINT32                                  Length)
+{
+    UINT32                  PacketLength = sizeof(DEBUGGER_REMOTE_PACKET) + Length;
+    BYTE *                  Frame        = (BYTE *)malloc(sizeof(SERIAL_FRAME_HEADER) + PacketLength);
+    PSERIAL_FRAME_HEADER    Header       = (PSERIAL_FRAME_HEADER)Frame;
+    PDEBUGGER_REMOTE_PACKET Packet       = (PDEBUGGER_REMOTE_PACKET)(Frame + sizeof(SERIAL_FRAME_HEADER));
+    DWORD                   BytesWritten = 0;
+    BOOLEAN                 Result       = FALSE;
+
+    if (Frame == NULL)
+    {
+        return FALSE;
+    }
+
+    RtlZeroMemory(Packet, sizeof(DEBUGGER_REMOTE_PACKET));
+
+    Packet->Indicator                  = INDICATOR_OF_HYPERDBG_PACKER;
+    Packet->TypeOfThePacket            = DEBUGGER_REMOTE_PACKET_TYPE_DEBUGGEE_TO_DEBUGGER;
+    Packet->RequestedActionOfThePacket = RequestedAction;
+    Packet->SequenceNumber             = SequenceNumber;
+
+    memcpy((BYTE *)Packet + sizeof(DEBUGGER_REMOTE_PACKET), Buffer, Length);
+
+    //
+    // The checksum is the sum of the bytes after itself
+    //
+    for (UINT32 i = sizeof(BYTE); i < PacketLength; i++)
+    {
+        Packet->Checksum += ((BYTE *)Packet)[i];
+    }
+
+    Header->Signature = SERIAL_FRAME_SIGNATURE;
+    Header->Length    = PacketLength;
+    Header->Crc32     = KdComputeDataCrc32(Packet, PacketLength, 0);
+
+    if (WriteFile(Link->PipeHandle, Frame, sizeof(SERIAL_FRAME_HEADER) + PacketLength, NULL, Overlapped) ||
+        GetLastError() == ERROR_IO_PENDING)
+    {
+        Result = GetOverlappedResult(Link->PipeHandle, Overlapped, &BytesWritten, TRUE) &&
+                 BytesWritten == sizeof(SERIAL_FRAME_HEADER) + PacketLength;
+    }
+
+    free(Frame);
+
+    return Result;
+}
+
+/**
+ * @brief Thread that receives the requests of the debugger in the
+ * simulated debuggee
+ * @details The read memory requests are kept until they're answered by
+ * the thread of the simulated debuggee, the thread stops when the debugger
+ * closes the connection
+ *
+ * @param Data
+ * @return DWORD
+ */
+DWORD WINAPI
+BenchmarkLinkReceiverThread(LPVOID Data)
+{
+    PBENCHMARK_LINK         Link          = (PBENCHMARK_LINK)Data;
+    OVERLAPPED              Overlapped    = {0};
+    PKD_RECEIVE_BUFFER      ReceiveBuffer = (PKD_RECEIVE_BUFFER)malloc(sizeof(KD_RECEIVE_BUFFER));
+    CHAR *                  Buffer        = (CHAR *)malloc(MaxSerialPacketSize);
+    PDEBUGGER_REMOTE_PACKET Packet        = (PDEBUGGER_REMOTE_PACKET)Buffer;
+    PBENCHMARK_LINK_REQUEST Request;
+    UINT32                  Length = 0;
+    UINT32                  CountOfRequestsInFlight;
+
+    Overlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+
+    if (ReceiveBuffer != NULL && Buffer != NULL && Overlapped.hEvent != NULL)
+    {
+        ReceiveBuffer->Head = 0;
+        ReceiveBuffer->Tail = 0;
+
+        while (KdReceivePacketThroughBuffer(Link->PipeHandle,
+                                            &Overlapped,
+                                            ReceiveBuffer,
+                                            KD_RECEIVE_BUFFER_SIZE,
+                                            Buffer,
+                                            &Length,
+                                            NULL))
+        {
+            if (Length < sizeof(DEBUGGER_REMOTE_PACKET) || Packet->Indicator != INDICATOR_OF_HYPERDBG_PACKER)
+            {
+                continue;
+            }
+
+            if (Packet->RequestedActionOfThePacket ==
+                DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_MODE_CLOSE_AND_UNLOAD_DEBUGGEE)
+            {
+                break;
+            }
+
+            //
+            // The simulated debuggee only reads memory, the debugger waits
+            // forever for the responses of other requests
+            //
+            if (Packet->RequestedActionOfThePacket != DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_READ_MEMORY ||
+                Length < sizeof(DEBUGGER_REMOTE_PACKET) + sizeof(DEBUGGER_READ_MEMORY) ||
+                Link->Tail - Link->Head == BENCHMARK_LINK_MAXIMUM_QUEUED_REQUESTS)
+            {
+                printf("err, unexpected request (%x) is received by the simulated debuggee\n",
+                       Packet->RequestedActionOfThePacket);
+                continue;
+            }
+
+            Request = &Link->Requests[Link->Tail % BENCHMARK_LINK_MAXIMUM_QUEUED_REQUESTS];
+
+            //
+            // The request is received after it's sent and after the latency,
+            // the latency of sending the response is also added here as the
+            // responses are sent in order, so it's the same as receiving each
+            // response after the latency
+            //
+            Request->ReadyTime = BenchmarkGetTime() +
+                                 BenchmarkLinkGetTransferTime(Link, sizeof(SERIAL_FRAME_HEADER) + Length) +
+                                 2 * Link->Latency;
+
+            Request->SequenceNumber = Packet->SequenceNumber;
+
+            memcpy(&Request->ReadMem, Buffer + sizeof(DEBUGGER_REMOTE_PACKET), sizeof(DEBUGGER_READ_MEMORY));
+
+            CountOfRequestsInFlight = InterlockedIncrement(&Link->Tail) - Link->Head;
+
+            if (CountOfRequestsInFlight > Link->MaximumRequestsInFlight)
+            {
+                Link->MaximumRequestsInFlight = CountOfRequestsInFlight;
+            }
+
+            Link->CountOfRequests++;
+
+            ReleaseSemaphore(Link->QueueSemaphore, 1, NULL);
+        }
+    }
+
+    //
+    // Wake up the thread of the simulated debuggee
+    //
+    Link->IsClosed = TRUE;
+    ReleaseSemaphore(Link->QueueSemaphore, 1, NULL);
+
+    if (Overlapped.hEvent != NULL)
+    {
+        CloseHandle(Overlapped.hEvent);
+    }
+
+    free(ReceiveBuffer);
+    free(Buffer);
+
+    return 0;
+}
+
+/**
+ * @brief Thread of the simulated debuggee
+ * @details The debuggee sends the same packets as a debuggee that is
+ * started and then paused, and answers the read memory requests in order,
+ * the link sends one response at a time at its baud rate
+ *
+ * @param Data
+ * @return DWORD
+ */
+DWORD WINAPI
+BenchmarkLinkDebuggeeThread(LPVOID Data)
+{
+    PBENCHMARK_LINK               Link           = (PBENCHMARK_LINK)Data;
+    OVERLAPPED                    Overlapped     = {0};
+    HANDLE                        ReceiverThread = NULL;
+    DEBUGGER_PREPARE_DEBUGGEE     StartedPacket  = {0};
+    DEBUGGEE_SYMBOL_UPDATE_RESULT SymbolPacket   = {0};
+    DEBUGGEE_PAUSED_PACKET        PausedPacket   = {0};
+    PDEBUGGER_READ_MEMORY         Response       = NULL;
+    PBENCHMARK_LINK_REQUEST       Request;
+    UINT64                        LinkIsFreeTime = 0;
+    UINT32                        Length;
+    DWORD                         BytesTransferred;
+
+    Overlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+    Response          = (PDEBUGGER_READ_MEMORY)malloc(sizeof(DEBUGGER_READ_MEMORY) + SERIAL_READ_MEMORY_CHUNK_SIZE);
+
+    if (Overlapped.hEvent == NULL || Response == NULL)
+    {
+        goto Cleanup;
+    }
+
+    //
+    // Wait for the debugger to connect
+    //
+    if (!ConnectNamedPipe(Link->PipeHandle, &Overlapped))
+    {
+        if (GetLastError() == ERROR_IO_PENDING)
+        {
+            if (!GetOverlappedResult(Link->PipeHandle, &Overlapped, &BytesTransferred, TRUE))
+            {
+                goto Cleanup;
+            }
+        }
+        else if (GetLastError() != ERROR_PIPE_CONNECTED)
+        {
+            goto Cleanup;
+        }
+    }
+
+    ReceiverThread = CreateThread(NULL, 0, BenchmarkLinkReceiverThread, Link, 0, NULL);
+
+    if (ReceiverThread == NULL)
+    {
+        goto Cleanup;
+    }
+
+    StartedPacket.FramingVersion = SERIAL_FRAMING_VERSION_LATEST;
+    strcpy_s(StartedPacket.OsName, sizeof(StartedPacket.OsName), "simulated debuggee");
+
+    SymbolPacket.KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+
+    if (!BenchmarkLinkSendPacket(Link,
+                                 &Overlapped,
+                                 DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_STARTED,
+                                 0,
+                                 &StartedPacket,
+                                 sizeof(DEBUGGER_PREPARE_DEBUGGEE)) ||
+        !BenchmarkLinkSendPacket(Link,
+                                 &Overlapped,
+                                 DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RELOAD_SYMBOL_FINISHED,
+                                 0,
+                                 &SymbolPacket,
+                                 sizeof(DEBUGGEE_SYMBOL_UPDATE_RESULT)))
+    {
+        goto Cleanup;
+    }
+
+    //
+    // The debuggee is paused (the same as stepping) after the debugger
+    // waits for it
+    //
+    while (WaitForSingleObject(Link->RunningEvent, 100) == WAIT_TIMEOUT)
+    {
+        if (Link->IsClosed)
+        {
+            goto Cleanup;
+        }
+    }
+
+    PausedPacket.Rip                = BENCHMARK_LINK_ADDRESS;
+    PausedPacket.PausingReason      = DEBUGGEE_PAUSING_REASON_DEBUGGEE_STEPPED;
+    PausedPacket.ReadInstructionLen = MAXIMUM_INSTR_SIZE;
+
+    memset(PausedPacket.InstructionBytesOnRip, 0x90, MAXIMUM_INSTR_SIZE);
+
+    Link->IsPaused = TRUE;
+
+    if (!BenchmarkLinkSendPacket(Link,
+                                 &Overlapped,
+                                 DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_PAUSED_AND_CURRENT_INSTRUCTION,
+                                 0,
+                                 &PausedPacket,
+                                 sizeof(DEBUGGEE_PAUSED_PACKET)))
+    {
+        Link->IsPaused = FALSE;
+        goto Cleanup;
+    }
+
+    while (TRUE)
+    {
+        WaitForSingleObject(Link->QueueSemaphore, INFINITE);
+
+        //
+        // The connection is closed and all of the requests are answered
+        //
+        if (Link->Head == Link->Tail)
+        {
+            break;
+        }
+
+        Request = &Link->Requests[Link->Head % BENCHMARK_LINK_MAXIMUM_QUEUED_REQUESTS];
+
+        *Response = Request->ReadMem;
+
+        Response->ReturnLength = Response->Size < SERIAL_READ_MEMORY_CHUNK_SIZE ? Response->Size : SERIAL_READ_MEMORY_CHUNK_SIZE;
+        Response->KernelStatus = DEBUGGER_OPERATION_WAS_SUCCESSFULL;
+
+        for (UINT32 i = 0; i < Response->ReturnLength; i++)
+        {
+            ((BYTE *)Response + sizeof(DEBUGGER_READ_MEMORY))[i] = (BYTE)(Response->Address + i);
+        }
+
+        Length = sizeof(DEBUGGER_READ_MEMORY) + Response->ReturnLength;
+
+        //
+        // The response is sent after the previous response is sent completely
+        //
+        LinkIsFreeTime = Request->ReadyTime > LinkIsFreeTime ? Request->ReadyTime : LinkIsFreeTime;
+        LinkIsFreeTime += BenchmarkLinkGetTransferTime(Link,
+                                                       sizeof(SERIAL_FRAME_HEADER) + sizeof(DEBUGGER_REMOTE_PACKET) + Length);
+
+        BenchmarkLinkWaitUntil(LinkIsFreeTime);
+
+        InterlockedIncrement(&Link->Head);
+
+        if (!BenchmarkLinkSendPacket(Link,
+                                     &Overlapped,
+                                     DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_READING_MEMORY,
+                                     Request->SequenceNumber,
+                                     Response,
+                                     Length))
+        {
+            break;
+        }
+    }
+
+Cleanup:
+
+    if (ReceiverThread != NULL)
+    {
+        WaitForSingleObject(ReceiverThread, INFINITE);
+        CloseHandle(ReceiverThread);
+    }
+
+    if (Overlapped.hEvent != NULL)
+    {
+        CloseHandle(Overlapped.hEvent);
+    }
+
+    free(Response);
+
+    return 0;
+}
+
+/**
+ * @brief Read the memory of the simulated debuggee by a command
+ *
+ * @param Address
+ * @param Size
+ * @param CountOfCommands The memory is split between the commands
+ * @param Result
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkLinkReadMemory(UINT64 Address, UINT32 Size, UINT32 CountOfCommands, PBENCHMARK_LINK_RESULT Result)
+{
+    char   Command[MAX_PATH];
+    UINT32 SizeOfEachCommand = Size / CountOfCommands;
+    UINT64 Start;
+
+    g_BenchmarkLink.CountOfRequests         = 0;
+    g_BenchmarkLink.MaximumRequestsInFlight = 0;
+
+    Start = BenchmarkGetTime();
+
+    for (UINT32 i = 0; i < CountOfCommands; i++)
+    {
+        sprintf_s(Command, sizeof(Command), "db %llx l %x", Address + i * SizeOfEachCommand, SizeOfEachCommand);
+        HyperdbgInterpreter(Command);
+    }
+
+    Result->Time                    = BenchmarkGetTime() - Start;
+    Result->CountOfRequests         = g_BenchmarkLink.CountOfRequests;
+    Result->MaximumRequestsInFlight = g_BenchmarkLink.MaximumRequestsInFlight;
+
+    //
+    // Each chunk is read by one request
+    //
+    return Result->CountOfRequests == Size / SERIAL_READ_MEMORY_CHUNK_SIZE;
+}
+
+/**
+ * @brief Show the result of reading the memory of the simulated debuggee
+ *
+ * @param Name
+ * @param Result
+ * @param BaseTime Time of reading one chunk at a time
+ *
+ * @return VOID
+ */
+VOID
+BenchmarkLinkShowResult(const char * Name, PBENCHMARK_LINK_RESULT Result, UINT64 BaseTime)
+{
+    printf("%-20s : %10.2f ms, %8.2f KB/s, %d requests, at most %d in flight (%.2fx)\n",
+           Name,
+           Result->Time / 1000000.0,
+           (BENCHMARK_LINK_READ_SIZE * 1000000000.0) / (Result->Time * 1024.0),
+           Result->CountOfRequests,
+           Result->MaximumRequestsInFlight,
+           (double)BaseTime / (double)Result->Time);
+}
+
+/**
+ * @brief Benchmark of reading memory over the link to the debuggee
+ *
+ * @details The debugger connects to the simulated debuggee and reads its
+ * memory one chunk at a time (one command for each chunk) and then by
+ * one command that sends the requests of the chunks before receiving
+ * the responses of the previous chunks, the page cache is disabled so
+ * each read is sent to the debuggee
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkLink(int argc, char * argv[])
+{
+    char                  PipeName[MAX_PATH] = {0};
+    char                  Command[MAX_PATH]  = {0};
+    HANDLE                DebuggeeThread     = NULL;
+    UINT32                Latency            = BENCHMARK_LINK_DEFAULT_LATENCY;
+    UINT32                Baudrate           = BENCHMARK_LINK_DEFAULT_BAUDRATE;
+    BENCHMARK_LINK_RESULT StopAndWaitResult  = {0};
+    BENCHMARK_LINK_RESULT PipelinedResult    = {0};
+    BOOLEAN               Result             = FALSE;
+
+    if (argc >= 1)
+    {
+        Latency = strtoul(argv[0], NULL, 10);
+    }
+
+    if (argc >= 2)
+    {
+        Baudrate = strtoul(argv[1], NULL, 10);
+    }
+
+    if (Baudrate == 0)
+    {
+        printf("err, invalid baud rate\n");
+        return FALSE;
+    }
+
+    g_BenchmarkLink.Latency        = Latency * 1000ull;
+    g_BenchmarkLink.Baudrate       = Baudrate;
+    g_BenchmarkLink.RunningEvent   = CreateEvent(NULL, FALSE, FALSE, NULL);
+    g_BenchmarkLink.QueueSemaphore = CreateSemaphore(NULL, 0, MAXLONG, NULL);
+
+    sprintf_s(PipeName, sizeof(PipeName), "\\\\.\\pipe\\HyperDbgLinkBenchmark%x", GetCurrentProcessId());
+
+    g_BenchmarkLink.PipeHandle = CreateNamedPipeA(PipeName,
+                                                  PIPE_ACCESS_DUPLEX | FILE_FLAG_OVERLAPPED,
+                                                  PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT,
+                                                  1,
+                                                  MaxSerialPacketSize,
+                                                  MaxSerialPacketSize,
+                                                  0,
+                                                  NULL);
+
+    if (g_BenchmarkLink.PipeHandle == INVALID_HANDLE_VALUE ||
+        g_BenchmarkLink.RunningEvent == NULL ||
+        g_BenchmarkLink.QueueSemaphore == NULL)
+    {
+        printf("err, unable to create the simulated debuggee (%x)\n", GetLastError());
+        goto Cleanup;
+    }
+
+    DebuggeeThread = CreateThread(NULL, 0, BenchmarkLinkDebuggeeThread, &g_BenchmarkLink, 0, NULL);
+
+    if (DebuggeeThread == NULL)
+    {
+        printf("err, unable to create the simulated debuggee (%x)\n", GetLastError());
+        goto Cleanup;
+    }
+
+    HyperdbgSetTextMessageCallback(BenchmarkLinkMessageHandler);
+
+    //
+    // The command returns after the debuggee is paused
+    //
+    sprintf_s(Command, sizeof(Command), ".debug remote namedpipe %s", PipeName);
+    HyperdbgInterpreter(Command);
+
+    if (!g_BenchmarkLink.IsPaused)
+    {
+        printf("err, unable to connect to the simulated debuggee\n");
+        goto Cleanup;
+    }
+
+    strcpy_s(Command, sizeof(Command), "settings pagecache off");
+    HyperdbgInterpreter(Command);
+
+    printf("reading %x bytes in chunks of %x bytes, latency : %d us, baud rate : %d\n",
+           BENCHMARK_LINK_READ_SIZE,
+           SERIAL_READ_MEMORY_CHUNK_SIZE,
+           Latency,
+           Baudrate);
+
+    if (!BenchmarkLinkReadMemory(BENCHMARK_LINK_ADDRESS,
+                                 BENCHMARK_LINK_READ_SIZE,
+                                 BENCHMARK_LINK_READ_SIZE / SERIAL_READ_MEMORY_CHUNK_SIZE,
+                                 &StopAndWaitResult) ||
+        !BenchmarkLinkReadMemory(BENCHMARK_LINK_ADDRESS,
+                                 BENCHMARK_LINK_READ_SIZE,
+                                 1,
+                                 &PipelinedResult))
+    {
+        printf("err, the memory is not read by the expected requests\n");
+    }
+    else
+    {
+        BenchmarkLinkShowResult("one chunk at a time", &StopAndWaitResult, StopAndWaitResult.Time);
+        BenchmarkLinkShowResult("pipelined", &PipelinedResult, StopAndWaitResult.Time);
+
+        Result = TRUE;
+    }
+
+    strcpy_s(Command, sizeof(Command), ".debug close");
+    HyperdbgInterpreter(Command);
+
+Cleanup:
+
+    HyperdbgSetTextMessageCallback(NULL);
+
+    //
+    // Stop the simulated debuggee if it still waits for the debugger
+    //
+    if (g_BenchmarkLink.PipeHandle != INVALID_HANDLE_VALUE)
+    {
+        CancelIoEx(g_BenchmarkLink.PipeHandle, NULL);
+        DisconnectNamedPipe(g_BenchmarkLink.PipeHandle);
+    }
+
+    if (DebuggeeThread != NULL)
+    {
+        WaitForSingleObject(DebuggeeThread, INFINITE);
+        CloseHandle(DebuggeeThread);
+    }
+
+    if (g_BenchmarkLink.PipeHandle != INVALID_HANDLE_VALUE && g_BenchmarkLink.PipeHandle != NULL)
+    {
+        CloseHandle(g_BenchmarkLink.PipeHandle);
+    }
+
+    if (g_BenchmarkLink.RunningEvent != NULL)
+    {
+        CloseHandle(g_BenchmarkLink.RunningEvent);
+    }
+
+    if (g_BenchmarkLink.QueueSemaphore != NULL)
+    {
+        CloseHandle(g_BenchmarkLink.QueueSemaphore);
+    }
+
+    return Result;
+}
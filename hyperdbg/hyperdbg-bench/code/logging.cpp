@@ -0,0 +1,184 @@
+/**
+ * @file logging.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief benchmarks of sending messages from the kernel to user-mode
+ * @details
+ * @version 0.1
+ * @date 2021-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+
+/**
+ * @brief Details of a thread of the logging benchmark
+ *
+ */
+typedef struct _BENCHMARK_LOGGING_THREAD
+{
+    UINT32 CoreIndex;
+    UINT32 Iterations;
+
+} BENCHMARK_LOGGING_THREAD, *PBENCHMARK_LOGGING_THREAD;
+
+/**
+ * @brief Run cpuid instructions on a special core
+ *
+ * @param Parameter The details of the thread (BENCHMARK_LOGGING_THREAD)
+ * @return DWORD
+ */
+DWORD WINAPI
+BenchmarkLoggingThread(LPVOID Parameter)
+{
+    PBENCHMARK_LOGGING_THREAD Thread = (PBENCHMARK_LOGGING_THREAD)Parameter;
+    int                       CpuInfo[4];
+
+    if (!BenchmarkPinToCore(Thread->CoreIndex))
+    {
+        return 1;
+    }
+
+    for (UINT32 i = 0; i < Thread->Iterations; i++)
+    {
+        __cpuidex(CpuInfo, 0, 0);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Benchmark of sending messages from vmx-root to user-mode
+ * on multiple cores at the same time
+ *
+ * @details A cpuid event prints a short message on each vm-exit and
+ * each core runs cpuid instructions in its own thread, the benchmark
+ * shows the time of each cpuid and the count of messages that are
+ * received by user-mode or dropped (because the buffers were full),
+ * cpuid instructions of other processes are also counted
+ *
+ * The length of messages can be changed, as messages are saved as
+ * variable-length records, shorter messages use less space of the buffers
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkLogging(int argc, char * argv[])
+{
+    SYSTEM_INFO              SystemInfo;
+    BENCHMARK_LOGGING_THREAD Threads[MAXIMUM_WAIT_OBJECTS];
+    HANDLE                   ThreadHandles[MAXIMUM_WAIT_OBJECTS];
+    UINT32                   CountOfThreads;
+    UINT32                   MaximumCountOfThreads;
+    UINT64                   Start;
+    UINT64                   End;
+    LONG64                   Received;
+    LONG64                   Previous;
+    double                   Time;
+    UINT32                   MessageLength = BENCHMARK_LOGGING_DEFAULT_MESSAGE_LENGTH;
+    string                   Command;
+
+    if (argc >= 1)
+    {
+        MessageLength = strtoul(argv[0], NULL, 16);
+    }
+
+    if (MessageLength < BENCHMARK_LOGGING_MINIMUM_MESSAGE_LENGTH || MessageLength > BENCHMARK_LOGGING_MAXIMUM_MESSAGE_LENGTH)
+    {
+        printf("err, the length of messages should be between %x and %x\n",
+               BENCHMARK_LOGGING_MINIMUM_MESSAGE_LENGTH,
+               BENCHMARK_LOGGING_MAXIMUM_MESSAGE_LENGTH);
+        return FALSE;
+    }
+
+    GetSystemInfo(&SystemInfo);
+
+    MaximumCountOfThreads = min(SystemInfo.dwNumberOfProcessors, MAXIMUM_WAIT_OBJECTS);
+
+    //
+    // The message is "bench" padded to the requested length (with the new line)
+    //
+    Command = "!cpuid script { printf(\"bench";
+    Command += string(MessageLength - BENCHMARK_LOGGING_MINIMUM_MESSAGE_LENGTH + 1, 'x');
+    Command += "\\n\"); }";
+
+    if (!BenchmarkRunCommand(Command.c_str()))
+    {
+        return FALSE;
+    }
+
+    printf("\nlength of messages : %x\n", MessageLength);
+    printf("\n%-10s %16s %12s %12s %16s\n", "threads", "ns per cpuid", "received", "dropped", "messages per s");
+
+    for (CountOfThreads = 1; CountOfThreads <= MaximumCountOfThreads; CountOfThreads *= 2)
+    {
+        g_BenchmarkReceivedMessages = 0;
+        g_BenchmarkDroppedMessages  = 0;
+        g_BenchmarkCountMessages    = TRUE;
+
+        Start = BenchmarkGetTime();
+
+        for (UINT32 i = 0; i < CountOfThreads; i++)
+        {
+            Threads[i].CoreIndex  = i;
+            Threads[i].Iterations = BENCHMARK_LOGGING_CPUID_ITERATIONS;
+
+            ThreadHandles[i] = CreateThread(NULL, 0, BenchmarkLoggingThread, &Threads[i], 0, NULL);
+
+            if (ThreadHandles[i] == NULL)
+            {
+                printf("err, unable to create the thread (%x)\n", GetLastError());
+                WaitForMultipleObjects(i, ThreadHandles, TRUE, INFINITE);
+
+                for (UINT32 j = 0; j < i; j++)
+                {
+                    CloseHandle(ThreadHandles[j]);
+                }
+
+                g_BenchmarkCountMessages = FALSE;
+                return FALSE;
+            }
+        }
+
+        WaitForMultipleObjects(CountOfThreads, ThreadHandles, TRUE, INFINITE);
+
+        End = BenchmarkGetTime();
+
+        for (UINT32 i = 0; i < CountOfThreads; i++)
+        {
+            CloseHandle(ThreadHandles[i]);
+        }
+
+        //
+        // Wait until user-mode receives all of the messages
+        //
+        do
+        {
+            Previous = g_BenchmarkReceivedMessages;
+            Sleep(BENCHMARK_LOGGING_DRAIN_INTERVAL);
+            Received = g_BenchmarkReceivedMessages;
+
+        } while (Received != Previous);
+
+        Time = (double)(End - Start) / BENCHMARK_LOGGING_CPUID_ITERATIONS;
+
+        printf("%-10u %16.1f %12lld %12lld %16.0f\n",
+               CountOfThreads,
+               Time,
+               Received,
+               g_BenchmarkDroppedMessages,
+               Received / ((double)(End - Start) / 1000000000));
+
+        g_BenchmarkCountMessages = FALSE;
+    }
+
+    //
+    // The messages that are dropped at the end are shown by flushing the buffers
+    //
+    BenchmarkRunCommand("events c all");
+    BenchmarkRunCommand("flush");
+
+    return TRUE;
+}
@@ -0,0 +1,922 @@
+/**
+ * @file logrings.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief benchmarks of the per-core log buffers in user-mode
+ * @details The buffers use the same code as the kernel and the debugger
+ * (LogBuffers.h), each writer thread is the owner of a buffer (like a
+ * core) and one thread reads and merges the messages of all buffers
+ * @version 0.1
+ * @date 2021-11-22
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+#include "LogBuffers.h"
+
+/**
+ * @brief Write the messages of a writer to its buffer
+ * @details Messages are dropped (and counted) if the buffer is full,
+ * the same as LogSendBuffer
+ *
+ * @param Parameter The details of the writer (BENCHMARK_RINGS_WRITER)
+ * @return DWORD
+ */
+DWORD WINAPI
+BenchmarkLogRingsWriter(LPVOID Parameter)
+{
+    PBENCHMARK_RINGS_WRITER  Writer = (PBENCHMARK_RINGS_WRITER)Parameter;
+    CHAR                     Buffer[BENCHMARK_LOGGING_MAXIMUM_MESSAGE_LENGTH];
+    PBENCHMARK_RINGS_MESSAGE Message = (PBENCHMARK_RINGS_MESSAGE)Buffer;
+
+    //
+    // The reader is on the first core
+    //
+    BenchmarkPinToCore(Writer->WriterIndex + 1);
+
+    memset(Buffer, 'x', Writer->MessageLength);
+    Message->WriterIndex = Writer->WriterIndex;
+
+    for (UINT64 i = 0; i < BENCHMARK_RINGS_MESSAGES_PER_WRITER; i++)
+    {
+        Message->SequenceNumber = i;
+
+        if (!LogWriteRecord(Writer->BufferInformation, __rdtsc(), OPERATION_LOG_INFO_MESSAGE, Buffer, Writer->MessageLength))
+        {
+            Writer->BufferInformation->CountOfDroppedMessages++;
+        }
+    }
+
+    InterlockedDecrement(Writer->CountOfRunningWriters);
+
+    return 0;
+}
+
+/**
+ * @brief Read the messages of all writers until they finish
+ * @details Each message should be newer than the previous messages of
+ * its writer, the missed sequence numbers should be the dropped
+ * messages, a message that is older than the previous message of
+ * another writer is counted in CountOfUnorderedMessages (it's written
+ * after the reader passed its time stamp)
+ *
+ * @param Buffers The buffers of writers
+ * @param CountOfWriters
+ * @param MessageLength
+ * @param CountOfRunningWriters
+ * @param Received The received messages of each writer
+ * @return UINT64 Count of messages that are older than a message
+ * that is read before them
+ */
+UINT64
+BenchmarkLogRingsReader(PLOG_BUFFER_INFORMATION   Buffers,
+                        UINT32                    CountOfWriters,
+                        UINT32                    MessageLength,
+                        volatile LONG *           CountOfRunningWriters,
+                        PBENCHMARK_RINGS_RECEIVED Received)
+{
+    PLOG_BUFFER_INFORMATION   BufferInformation;
+    BUFFER_HEADER *           Header;
+    PBENCHMARK_RINGS_MESSAGE  Message;
+    PBENCHMARK_RINGS_RECEIVED Writer;
+    BOOLEAN                   IsFinished;
+    UINT64                    LastTimeStamp            = 0;
+    UINT64                    CountOfUnorderedMessages = 0;
+
+    while (TRUE)
+    {
+        //
+        // The messages that are written before the last writer finishes
+        // are visible to the next search
+        //
+        IsFinished = *CountOfRunningWriters == 0;
+
+        BufferInformation = LogFindOldestRecord(Buffers, CountOfWriters, &Header);
+
+        if (BufferInformation == NULL)
+        {
+            if (IsFinished)
+            {
+                break;
+            }
+
+            YieldProcessor();
+            continue;
+        }
+
+        Message = (PBENCHMARK_RINGS_MESSAGE)((UINT64)Header + sizeof(BUFFER_HEADER));
+        Writer  = &Received[BufferInformation - Buffers];
+
+        if (Header->BufferLength != MessageLength ||
+            Message->WriterIndex != BufferInformation - Buffers ||
+            Message->SequenceNumber < Writer->NextSequenceNumber ||
+            *((CHAR *)Message + MessageLength) != '\0')
+        {
+            Writer->CountOfErrors++;
+        }
+        else
+        {
+            Writer->CountOfMissedMessages += Message->SequenceNumber - Writer->NextSequenceNumber;
+            Writer->NextSequenceNumber = Message->SequenceNumber + 1;
+        }
+
+        if (Header->TimeStamp < LastTimeStamp)
+        {
+            CountOfUnorderedMessages++;
+        }
+
+        LastTimeStamp = Header->TimeStamp;
+        Writer->CountOfMessages++;
+
+        LogSetRecordAsRead(BufferInformation, Header);
+    }
+
+    return CountOfUnorderedMessages;
+}
+
+/**
+ * @brief Benchmark of the per-core log buffers without the hypervisor
+ *
+ * @details Multiple writers write to their buffers at the same time
+ * while one reader merges the buffers by the time stamps, the same as
+ * LogReadBuffer, the benchmark shows the count of messages that are
+ * read per second and checks the order of the messages of each writer
+ * and that each missed message is counted as a dropped message
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkLogRings(int argc, char * argv[])
+{
+    SYSTEM_INFO              SystemInfo;
+    BENCHMARK_RINGS_WRITER   Writers[MAXIMUM_WAIT_OBJECTS];
+    BENCHMARK_RINGS_RECEIVED Received[MAXIMUM_WAIT_OBJECTS];
+    LOG_BUFFER_INFORMATION   Buffers[MAXIMUM_WAIT_OBJECTS];
+    UINT64                   SharedOffsetsToWrite[MAXIMUM_WAIT_OBJECTS];
+    HANDLE                   ThreadHandles[MAXIMUM_WAIT_OBJECTS];
+    volatile LONG            CountOfRunningWriters;
+    UINT32                   CountOfWriters;
+    UINT32                   MaximumCountOfWriters;
+    UINT64                   Start;
+    UINT64                   End;
+    UINT64                   CountOfMessages;
+    UINT64                   CountOfDroppedMessages;
+    UINT64                   CountOfUnorderedMessages;
+    UINT64                   CountOfErrors;
+    BYTE *                   Storage;
+    BOOLEAN                  Result        = TRUE;
+    UINT32                   MessageLength = BENCHMARK_RINGS_DEFAULT_MESSAGE_LENGTH;
+
+    if (argc >= 1)
+    {
+        MessageLength = strtoul(argv[0], NULL, 16);
+    }
+
+    if (MessageLength < sizeof(BENCHMARK_RINGS_MESSAGE) || MessageLength > BENCHMARK_LOGGING_MAXIMUM_MESSAGE_LENGTH)
+    {
+        printf("err, the length of messages should be between %x and %x\n",
+               (UINT32)sizeof(BENCHMARK_RINGS_MESSAGE),
+               BENCHMARK_LOGGING_MAXIMUM_MESSAGE_LENGTH);
+        return FALSE;
+    }
+
+    GetSystemInfo(&SystemInfo);
+
+    //
+    // One of the cores is for the reader
+    //
+    MaximumCountOfWriters = min(max(SystemInfo.dwNumberOfProcessors, 2) - 1, MAXIMUM_WAIT_OBJECTS);
+
+    Storage = (BYTE *)malloc((SIZE_T)MaximumCountOfWriters * BENCHMARK_RINGS_BUFFER_SIZE);
+
+    if (Storage == NULL)
+    {
+        printf("err, unable to allocate the buffers\n");
+        return FALSE;
+    }
+
+    printf("\nlength of messages : %x, size of buffers : %x, messages per writer : %u\n",
+           MessageLength,
+           BENCHMARK_RINGS_BUFFER_SIZE,
+           BENCHMARK_RINGS_MESSAGES_PER_WRITER);
+
+    printf("\n%-10s %16s %12s %12s %12s %10s\n", "writers", "messages per s", "received", "dropped", "unordered", "errors");
+
+    for (CountOfWriters = 1; CountOfWriters <= MaximumCountOfWriters; CountOfWriters *= 2)
+    {
+        RtlZeroMemory(Buffers, sizeof(Buffers));
+        RtlZeroMemory(Received, sizeof(Received));
+
+        CountOfRunningWriters = CountOfWriters;
+
+        for (UINT32 i = 0; i < CountOfWriters; i++)
+        {
+            Buffers[i].BufferStartAddress  = (UINT64)Storage + (UINT64)i * BENCHMARK_RINGS_BUFFER_SIZE;
+            Buffers[i].BufferEndAddress    = Buffers[i].BufferStartAddress + BENCHMARK_RINGS_BUFFER_SIZE;
+            Buffers[i].BufferSize          = BENCHMARK_RINGS_BUFFER_SIZE;
+            Buffers[i].SharedOffsetToWrite = &SharedOffsetsToWrite[i];
+            Buffers[i].UserOffsetToRead    = &SharedOffsetsToWrite[i];
+
+            Writers[i].BufferInformation     = &Buffers[i];
+            Writers[i].WriterIndex           = i;
+            Writers[i].MessageLength         = MessageLength;
+            Writers[i].CountOfRunningWriters = &CountOfRunningWriters;
+        }
+
+        BenchmarkPinToCore(0);
+
+        Start = BenchmarkGetTime();
+
+        for (UINT32 i = 0; i < CountOfWriters; i++)
+        {
+            ThreadHandles[i] = CreateThread(NULL, 0, BenchmarkLogRingsWriter, &Writers[i], 0, NULL);
+
+            if (ThreadHandles[i] == NULL)
+            {
+                printf("err, unable to create the thread (%x)\n", GetLastError());
+
+                //
+                // The writers that are not created are finished
+                //
+                InterlockedExchangeAdd(&CountOfRunningWriters, -(LONG)(CountOfWriters - i));
+                BenchmarkLogRingsReader(Buffers, i, MessageLength, &CountOfRunningWriters, Received);
+                WaitForMultipleObjects(i, ThreadHandles, TRUE, INFINITE);
+
+                for (UINT32 j = 0; j < i; j++)
+                {
+                    CloseHandle(ThreadHandles[j]);
+                }
+
+                free(Storage);
+                return FALSE;
+            }
+        }
+
+        CountOfUnorderedMessages = BenchmarkLogRingsReader(Buffers, CountOfWriters, MessageLength, &CountOfRunningWriters, Received);
+
+        End = BenchmarkGetTime();
+
+        WaitForMultipleObjects(CountOfWriters, ThreadHandles, TRUE, INFINITE);
+
+        CountOfMessages        = 0;
+        CountOfDroppedMessages = 0;
+        CountOfErrors          = 0;
+
+        for (UINT32 i = 0; i < CountOfWriters; i++)
+        {
+            CloseHandle(ThreadHandles[i]);
+
+            //
+            // The messages that are not received at the end are dropped
+            //
+            if (Received[i].CountOfMissedMessages + BENCHMARK_RINGS_MESSAGES_PER_WRITER - Received[i].NextSequenceNumber !=
+                    Buffers[i].CountOfDroppedMessages ||
+                Received[i].CountOfMessages + Buffers[i].CountOfDroppedMessages != BENCHMARK_RINGS_MESSAGES_PER_WRITER)
+            {
+                Received[i].CountOfErrors++;
+            }
+
+            CountOfMessages += Received[i].CountOfMessages;
+            CountOfDroppedMessages += Buffers[i].CountOfDroppedMessages;
+            CountOfErrors += Received[i].CountOfErrors;
+        }
+
+        printf("%-10u %16.0f %12llu %12llu %12llu %10llu\n",
+               CountOfWriters,
+               CountOfMessages / ((double)(End - Start) / 1000000000),
+               CountOfMessages,
+               CountOfDroppedMessages,
+               CountOfUnorderedMessages,
+               CountOfErrors);
+
+        if (CountOfErrors != 0)
+        {
+            Result = FALSE;
+        }
+    }
+
+    free(Storage);
+
+    if (!Result)
+    {
+        printf("\nerr, messages are out of order, corrupted or not counted as dropped\n");
+    }
+
+    return Result;
+}
+
+/**
+ * @brief Check a message of the benchmark of the doorbell
+ *
+ * @param Context The state of the benchmark (BENCHMARK_DOORBELL)
+ * @param Header The header of the message
+ * @return VOID
+ */
+VOID
+BenchmarkLogDoorbellHandleMessage(PVOID Context, BUFFER_HEADER * Header)
+{
+    PBENCHMARK_DOORBELL       Doorbell = (PBENCHMARK_DOORBELL)Context;
+    PBENCHMARK_RINGS_MESSAGE  Message  = (PBENCHMARK_RINGS_MESSAGE)((UINT64)Header + sizeof(BUFFER_HEADER));
+    PBENCHMARK_RINGS_RECEIVED Received = &Doorbell->Received[Message->WriterIndex & 1];
+
+    if (Message->WriterIndex > 1 || Message->SequenceNumber < Received->NextSequenceNumber)
+    {
+        Received->CountOfErrors++;
+    }
+    else
+    {
+        Received->CountOfMissedMessages += Message->SequenceNumber - Received->NextSequenceNumber;
+        Received->NextSequenceNumber = Message->SequenceNumber + 1;
+    }
+
+    Received->CountOfMessages++;
+}
+
+/**
+ * @brief Write the messages of the benchmark of the doorbell in bursts
+ * @details The same as LogSendBuffer while the buffers are mapped to
+ * user-mode, messages are written to the vmx non-root and the vmx-root
+ * buffers one by one
+ *
+ * @param Parameter The state of the benchmark (BENCHMARK_DOORBELL)
+ * @return DWORD
+ */
+DWORD WINAPI
+BenchmarkLogDoorbellWriter(LPVOID Parameter)
+{
+    PBENCHMARK_DOORBELL     Doorbell = (PBENCHMARK_DOORBELL)Parameter;
+    PLOG_BUFFER_INFORMATION BufferInformation;
+    BENCHMARK_RINGS_MESSAGE Message            = {0};
+    UINT64                  SequenceNumbers[2] = {0};
+    UINT32                  Random             = 0x12345678;
+    UINT32                  CountOfMessages;
+    UINT32                  CountOfPauses;
+
+    for (UINT32 i = 0; i < BENCHMARK_DOORBELL_MESSAGES && !Doorbell->IsStopped; i += CountOfMessages)
+    {
+        //
+        // xorshift, so each run has the same bursts and pauses
+        //
+        Random ^= Random << 13;
+        Random ^= Random >> 17;
+        Random ^= Random << 5;
+
+        CountOfMessages = min(Random % BENCHMARK_DOORBELL_MAXIMUM_BURST + 1, BENCHMARK_DOORBELL_MESSAGES - i);
+        CountOfPauses   = (Random >> 8) % BENCHMARK_DOORBELL_MAXIMUM_PAUSE;
+
+        for (UINT32 j = 0; j < CountOfMessages; j++)
+        {
+            Message.WriterIndex    = (i + j) & 1;
+            Message.SequenceNumber = SequenceNumbers[Message.WriterIndex]++;
+            BufferInformation      = &Doorbell->BufferInformation[Message.WriterIndex];
+
+            LogAcceptOffsetToReadOfUserMode(BufferInformation);
+
+            if (!LogWriteRecord(BufferInformation, __rdtsc(), OPERATION_LOG_INFO_MESSAGE, &Message, sizeof(Message)))
+            {
+                BufferInformation->CountOfDroppedMessages++;
+                continue;
+            }
+
+            if (InterlockedExchange(&Doorbell->ReaderPage->DoorbellArmed, FALSE))
+            {
+                Doorbell->CountOfRings++;
+                SetEvent(Doorbell->DoorbellEvent);
+            }
+        }
+
+        //
+        // Wait for the reader to read the burst, then the reader arms the
+        // doorbell while the writer is paused or writing the next burst
+        //
+        while (!Doorbell->IsStopped &&
+               (Doorbell->Header->CurrentOffsetToWrite[0] != Doorbell->ReaderPage->CurrentOffsetToRead[0] ||
+                Doorbell->Header->CurrentOffsetToWrite[1] != Doorbell->ReaderPage->CurrentOffsetToRead[1]))
+        {
+            SwitchToThread();
+        }
+
+        for (UINT32 j = 0; j < CountOfPauses; j++)
+        {
+            YieldProcessor();
+        }
+    }
+
+    //
+    // Wake up the reader, it stops after reading the rest of messages
+    //
+    InterlockedExchange(&Doorbell->IsWriterRunning, FALSE);
+    SetEvent(Doorbell->DoorbellEvent);
+
+    return 0;
+}
+
+/**
+ * @brief Benchmark of the doorbell of the log buffers that are mapped
+ * to user-mode
+ *
+ * @details A thread writes messages in bursts with random pauses (like
+ * the kernel) and the reader does the same as ReadSharedMemoryBuffer, it
+ * reads the buffers and arms the doorbell when they are empty, a wait
+ * that times out while there are unread messages means the doorbell is
+ * missed (e.g., a message is written between reading the buffers and
+ * arming the doorbell, the reader gives up its time slice there in half
+ * of the waits to make it happen), the order of messages and the count
+ * of dropped messages are also checked
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkLogDoorbell(int argc, char * argv[])
+{
+    BENCHMARK_DOORBELL Doorbell = {0};
+    HANDLE             ThreadHandle;
+    UINT64             OffsetsToSend[1];
+    UINT64             OffsetsToWrite[1];
+    UINT32             CountOfHandledMessages;
+    BOOLEAN            IsFinished;
+    UINT64             Start;
+    UINT64             End;
+    UINT64             CountOfWaits           = 0;
+    UINT64             CountOfMissedDoorbells = 0;
+    UINT64             CountOfMessages        = 0;
+    UINT64             CountOfDroppedMessages = 0;
+    UINT64             CountOfErrors          = 0;
+
+    Doorbell.Header        = (PLOG_SHARED_BUFFERS_HEADER)calloc(1, FIELD_OFFSET(LOG_SHARED_BUFFERS_HEADER, CurrentOffsetToWrite) + 2 * sizeof(UINT64));
+    Doorbell.ReaderPage    = (PLOG_SHARED_READER_PAGE)calloc(1, FIELD_OFFSET(LOG_SHARED_READER_PAGE, CurrentOffsetToRead) + 2 * sizeof(UINT64));
+    Doorbell.Buffers       = (CHAR *)malloc(2 * BENCHMARK_RINGS_BUFFER_SIZE);
+    Doorbell.DoorbellEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
+
+    if (Doorbell.Header == NULL || Doorbell.ReaderPage == NULL || Doorbell.Buffers == NULL || Doorbell.DoorbellEvent == NULL)
+    {
+        printf("err, unable to allocate the buffers\n");
+        free(Doorbell.Header);
+        free(Doorbell.ReaderPage);
+        free(Doorbell.Buffers);
+
+        if (Doorbell.DoorbellEvent != NULL)
+        {
+            CloseHandle(Doorbell.DoorbellEvent);
+        }
+
+        return FALSE;
+    }
+
+    //
+    // The same as LogInitialize, with one core
+    //
+    Doorbell.Header->CountOfBuffers = 2;
+    Doorbell.Header->BufferSize     = BENCHMARK_RINGS_BUFFER_SIZE;
+
+    for (UINT32 i = 0; i < 2; i++)
+    {
+        Doorbell.BufferInformation[i].BufferStartAddress  = (UINT64)Doorbell.Buffers + (UINT64)i * BENCHMARK_RINGS_BUFFER_SIZE;
+        Doorbell.BufferInformation[i].BufferEndAddress    = Doorbell.BufferInformation[i].BufferStartAddress + BENCHMARK_RINGS_BUFFER_SIZE;
+        Doorbell.BufferInformation[i].BufferSize          = BENCHMARK_RINGS_BUFFER_SIZE;
+        Doorbell.BufferInformation[i].SharedOffsetToWrite = &Doorbell.Header->CurrentOffsetToWrite[i];
+        Doorbell.BufferInformation[i].UserOffsetToRead    = &Doorbell.ReaderPage->CurrentOffsetToRead[i];
+    }
+
+    Doorbell.IsWriterRunning = TRUE;
+
+    Start = BenchmarkGetTime();
+
+    ThreadHandle = CreateThread(NULL, 0, BenchmarkLogDoorbellWriter, &Doorbell, 0, NULL);
+
+    if (ThreadHandle == NULL)
+    {
+        printf("err, unable to create the thread (%x)\n", GetLastError());
+        Doorbell.IsWriterRunning = FALSE;
+    }
+
+    while (TRUE)
+    {
+        IsFinished = !Doorbell.IsWriterRunning;
+
+        //
+        // Read vmx non-root messages, then vmx-root messages
+        //
+        CountOfHandledMessages = LogReadSharedBuffers(Doorbell.Header, Doorbell.ReaderPage, Doorbell.Buffers, 0, 1, OffsetsToSend, OffsetsToWrite, BenchmarkLogDoorbellHandleMessage, &Doorbell);
+        CountOfHandledMessages += LogReadSharedBuffers(Doorbell.Header, Doorbell.ReaderPage, Doorbell.Buffers, 1, 1, OffsetsToSend, OffsetsToWrite, BenchmarkLogDoorbellHandleMessage, &Doorbell);
+
+        if (CountOfHandledMessages != 0)
+        {
+            continue;
+        }
+
+        if (IsFinished)
+        {
+            break;
+        }
+
+        //
+        // Let the writer run between reading the buffers and arming the
+        // doorbell (even on a single core), its messages should be found
+        // by checking the buffers again after arming the doorbell
+        //
+        if (CountOfWaits % 2)
+        {
+            SwitchToThread();
+        }
+
+        if (LogArmDoorbell(Doorbell.Header, Doorbell.ReaderPage))
+        {
+            CountOfWaits++;
+
+            if (WaitForSingleObject(Doorbell.DoorbellEvent, BENCHMARK_DOORBELL_TIMEOUT) == WAIT_TIMEOUT &&
+                (Doorbell.Header->CurrentOffsetToWrite[0] != Doorbell.ReaderPage->CurrentOffsetToRead[0] ||
+                 Doorbell.Header->CurrentOffsetToWrite[1] != Doorbell.ReaderPage->CurrentOffsetToRead[1]))
+            {
+                //
+                // Each missed doorbell takes the timeout, so the writer is
+                // stopped after a few of them
+                //
+                if (++CountOfMissedDoorbells == BENCHMARK_DOORBELL_MAXIMUM_MISSED)
+                {
+                    Doorbell.IsStopped = TRUE;
+                }
+            }
+        }
+    }
+
+    End = BenchmarkGetTime();
+
+    if (ThreadHandle != NULL)
+    {
+        WaitForSingleObject(ThreadHandle, INFINITE);
+        CloseHandle(ThreadHandle);
+    }
+
+    for (UINT32 i = 0; i < 2; i++)
+    {
+        //
+        // The messages that are not received at the end are dropped
+        //
+        if (!Doorbell.IsStopped &&
+            (Doorbell.Received[i].CountOfMissedMessages + (BENCHMARK_DOORBELL_MESSAGES / 2) - Doorbell.Received[i].NextSequenceNumber !=
+                 Doorbell.BufferInformation[i].CountOfDroppedMessages ||
+             Doorbell.Received[i].CountOfMessages + Doorbell.BufferInformation[i].CountOfDroppedMessages != BENCHMARK_DOORBELL_MESSAGES / 2))
+        {
+            Doorbell.Received[i].CountOfErrors++;
+        }
+
+        CountOfMessages += Doorbell.Received[i].CountOfMessages;
+        CountOfDroppedMessages += Doorbell.BufferInformation[i].CountOfDroppedMessages;
+        CountOfErrors += Doorbell.Received[i].CountOfErrors;
+    }
+
+    printf("\n%-16s %12s %12s %12s %12s %16s %10s\n", "messages per s", "received", "dropped", "waits", "rings", "missed doorbells", "errors");
+    printf("%-16.0f %12llu %12llu %12llu %12llu %16llu %10llu\n",
+           CountOfMessages / ((double)(End - Start) / 1000000000),
+           CountOfMessages,
+           CountOfDroppedMessages,
+           CountOfWaits,
+           Doorbell.CountOfRings,
+           CountOfMissedDoorbells,
+           CountOfErrors);
+
+    CloseHandle(Doorbell.DoorbellEvent);
+    free(Doorbell.Header);
+    free(Doorbell.ReaderPage);
+    free(Doorbell.Buffers);
+
+    if (ThreadHandle == NULL || CountOfMissedDoorbells != 0 || CountOfErrors != 0)
+    {
+        printf("\nerr, doorbells are missed or messages are out of order, corrupted or not counted as dropped\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Write the messages of the benchmark of reading batches until
+ * the benchmark stops the writer
+ *
+ * @param Parameter The details of the writer (BENCHMARK_BATCH_WRITER)
+ * @return DWORD
+ */
+DWORD WINAPI
+BenchmarkLogBatchWriter(LPVOID Parameter)
+{
+    PBENCHMARK_BATCH_WRITER  Writer = (PBENCHMARK_BATCH_WRITER)Parameter;
+    CHAR                     Buffer[BENCHMARK_LOGGING_MAXIMUM_MESSAGE_LENGTH];
+    PBENCHMARK_RINGS_MESSAGE Message = (PBENCHMARK_RINGS_MESSAGE)Buffer;
+
+    BenchmarkPinToCore(1);
+
+    memset(Buffer, 'x', Writer->MessageLength);
+    Message->WriterIndex = 0;
+
+    while (!Writer->IsStopped)
+    {
+        Message->SequenceNumber = Writer->CountOfMessages++;
+
+        if (!LogWriteRecord(Writer->BufferInformation, __rdtsc(), OPERATION_LOG_INFO_MESSAGE, Buffer, Writer->MessageLength))
+        {
+            Writer->BufferInformation->CountOfDroppedMessages++;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Check a message of the benchmark of reading batches
+ *
+ * @param Received The received messages
+ * @param Message The message
+ * @param Length Length of the message
+ * @param MessageLength The length of the messages that are written
+ * @return VOID
+ */
+VOID
+BenchmarkLogBatchHandleMessage(PBENCHMARK_RINGS_RECEIVED Received, PBENCHMARK_RINGS_MESSAGE Message, UINT32 Length, UINT32 MessageLength)
+{
+    if (Length != MessageLength || Message->WriterIndex != 0 || Message->SequenceNumber < Received->NextSequenceNumber)
+    {
+        Received->CountOfErrors++;
+    }
+    else
+    {
+        Received->CountOfMissedMessages += Message->SequenceNumber - Received->NextSequenceNumber;
+        Received->NextSequenceNumber = Message->SequenceNumber + 1;
+    }
+
+    Received->CountOfMessages++;
+}
+
+/**
+ * @brief Read the messages of the benchmark of reading batches once
+ * @details The same as one IOCTL of the debugger, LogReadBuffer copies
+ * one message and LogReadBufferBatch copies messages until the next
+ * message doesn't fit in the buffer, then the messages are handled the
+ * same as ReadIrpBasedBuffer
+ *
+ * @param BufferInformation The buffer of the writer
+ * @param IsBatched Whether the messages are read in batches
+ * @param Buffer The buffer of the reader (UsermodeBatchBufferSize)
+ * @param MessageLength The length of the messages that are written
+ * @param Received The received messages
+ * @return UINT32 Count of messages that are read
+ */
+UINT32
+BenchmarkLogBatchRead(PLOG_BUFFER_INFORMATION   BufferInformation,
+                      BOOLEAN                   IsBatched,
+                      CHAR *                    Buffer,
+                      UINT32                    MessageLength,
+                      PBENCHMARK_RINGS_RECEIVED Received)
+{
+    BUFFER_HEADER *           Header;
+    PLOG_BATCH_MESSAGE_HEADER MessageHeader;
+    UINT32                    Length;
+    UINT32                    UsedLength      = 0;
+    UINT32                    CountOfMessages = 0;
+
+    if (!IsBatched)
+    {
+        if (LogFindOldestRecord(BufferInformation, 1, &Header) == NULL)
+        {
+            return 0;
+        }
+
+        //
+        // The operation code and the message, the same as LogReadBuffer
+        //
+        RtlCopyMemory(Buffer, &Header->OpeationNumber, sizeof(UINT32));
+        RtlCopyMemory(Buffer + sizeof(UINT32), (PVOID)((UINT64)Header + sizeof(BUFFER_HEADER)), Header->BufferLength);
+        Length = Header->BufferLength;
+
+        LogSetRecordAsRead(BufferInformation, Header);
+
+        BenchmarkLogBatchHandleMessage(Received, (PBENCHMARK_RINGS_MESSAGE)(Buffer + sizeof(UINT32)), Length, MessageLength);
+
+        return 1;
+    }
+
+    while (LogFindOldestRecord(BufferInformation, 1, &Header) != NULL)
+    {
+        Length = LogCopyRecordToBatch(Header, Buffer, UsedLength, UsermodeBatchBufferSize);
+
+        if (Length == 0)
+        {
+            break;
+        }
+
+        UsedLength += Length;
+
+        LogSetRecordAsRead(BufferInformation, Header);
+    }
+
+    for (UINT32 Offset = 0; Offset < UsedLength; Offset += LOG_BATCH_MESSAGE_SIZE(MessageHeader->BufferLength))
+    {
+        MessageHeader = (PLOG_BATCH_MESSAGE_HEADER)(Buffer + Offset);
+
+        if (*(Buffer + Offset + sizeof(LOG_BATCH_MESSAGE_HEADER) + MessageHeader->BufferLength) != '\0')
+        {
+            Received->CountOfErrors++;
+        }
+
+        BenchmarkLogBatchHandleMessage(Received,
+                                       (PBENCHMARK_RINGS_MESSAGE)(Buffer + Offset + sizeof(LOG_BATCH_MESSAGE_HEADER)),
+                                       MessageHeader->BufferLength,
+                                       MessageLength);
+        CountOfMessages++;
+    }
+
+    return CountOfMessages;
+}
+
+/**
+ * @brief Benchmark of reading the log buffers one message at a time
+ * and in batches
+ *
+ * @details A thread writes messages to a buffer as fast as it can (like
+ * a core that logs a lot) while the reader reads them in the ways that
+ * the debugger reads the messages through IRPs, one message per read
+ * (LogReadBuffer) or a batch per read (LogReadBufferBatch), with or
+ * without sleeping before each read, the benchmark shows the count of
+ * messages that are read per second, there is no IRP here, so the round
+ * trip of an IOCTL is simulated by spinning before each read, the order
+ * of messages and the count of dropped messages are also checked
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkLogBatch(int argc, char * argv[])
+{
+    BENCHMARK_BATCH_READER Readers[] = {
+        {"one message per read, sleep before each read", FALSE, TRUE},
+        {"batch per read, sleep before each read", TRUE, TRUE},
+        {"one message per read", FALSE, FALSE},
+        {"batch per read", TRUE, FALSE},
+    };
+    LOG_BUFFER_INFORMATION   BufferInformation;
+    BENCHMARK_BATCH_WRITER   Writer;
+    BENCHMARK_RINGS_RECEIVED Received;
+    UINT64                   SharedOffsetToWrite;
+    HANDLE                   ThreadHandle;
+    UINT64                   Start;
+    UINT64                   End;
+    UINT64                   CountOfReads;
+    UINT64                   CountOfMessages;
+    UINT32                   CountOfReadMessages;
+    UINT64                   RoundTrip     = 0;
+    CHAR *                   Storage;
+    CHAR *                   Buffer;
+    BOOLEAN                  Result        = TRUE;
+    UINT32                   MessageLength = BENCHMARK_RINGS_DEFAULT_MESSAGE_LENGTH;
+
+    if (argc >= 1)
+    {
+        MessageLength = strtoul(argv[0], NULL, 16);
+    }
+
+    if (argc >= 2)
+    {
+        RoundTrip = strtoull(argv[1], NULL, 10);
+    }
+
+    if (MessageLength < sizeof(BENCHMARK_RINGS_MESSAGE) || MessageLength > BENCHMARK_LOGGING_MAXIMUM_MESSAGE_LENGTH)
+    {
+        printf("err, the length of messages should be between %x and %x\n",
+               (UINT32)sizeof(BENCHMARK_RINGS_MESSAGE),
+               BENCHMARK_LOGGING_MAXIMUM_MESSAGE_LENGTH);
+        return FALSE;
+    }
+
+    //
+    // The writer has the whole pool, like a system with one core
+    //
+    Storage = (CHAR *)malloc(LogBufferSize);
+    Buffer  = (CHAR *)malloc(UsermodeBatchBufferSize);
+
+    if (Storage == NULL || Buffer == NULL)
+    {
+        printf("err, unable to allocate the buffers\n");
+        free(Storage);
+        free(Buffer);
+        return FALSE;
+    }
+
+    printf("\nlength of messages : %x, size of the buffer : %x, size of batches : %x, sleep : %u ms, round trip : %llu us\n",
+           MessageLength,
+           (UINT32)LogBufferSize,
+           (UINT32)UsermodeBatchBufferSize,
+           DefaultSpeedOfReadingKernelMessages,
+           RoundTrip);
+
+    printf("\n%-48s %16s %18s %12s %10s\n", "reader", "messages per s", "messages per read", "dropped", "errors");
+
+    BenchmarkPinToCore(0);
+
+    for (UINT32 i = 0; i < sizeof(Readers) / sizeof(Readers[0]); i++)
+    {
+        RtlZeroMemory(&BufferInformation, sizeof(BufferInformation));
+        RtlZeroMemory(&Writer, sizeof(Writer));
+        RtlZeroMemory(&Received, sizeof(Received));
+
+        BufferInformation.BufferStartAddress  = (UINT64)Storage;
+        BufferInformation.BufferEndAddress    = (UINT64)Storage + LogBufferSize;
+        BufferInformation.BufferSize          = LogBufferSize;
+        BufferInformation.SharedOffsetToWrite = &SharedOffsetToWrite;
+        BufferInformation.UserOffsetToRead    = &SharedOffsetToWrite;
+
+        Writer.BufferInformation = &BufferInformation;
+        Writer.MessageLength     = MessageLength;
+
+        ThreadHandle = CreateThread(NULL, 0, BenchmarkLogBatchWriter, &Writer, 0, NULL);
+
+        if (ThreadHandle == NULL)
+        {
+            printf("err, unable to create the thread (%x)\n", GetLastError());
+            Result = FALSE;
+            break;
+        }
+
+        CountOfReads = 0;
+        Start        = BenchmarkGetTime();
+
+        do
+        {
+            if (Readers[i].IsSleeping)
+            {
+                Sleep(DefaultSpeedOfReadingKernelMessages);
+            }
+
+            //
+            // The round trip of the IOCTL
+            //
+            for (UINT64 RoundTripEnd = BenchmarkGetTime() + RoundTrip * 1000; BenchmarkGetTime() < RoundTripEnd;)
+            {
+                YieldProcessor();
+            }
+
+            CountOfReadMessages = BenchmarkLogBatchRead(&BufferInformation, Readers[i].IsBatched, Buffer, MessageLength, &Received);
+
+            if (CountOfReadMessages != 0)
+            {
+                CountOfReads++;
+            }
+            else if (!Readers[i].IsSleeping)
+            {
+                //
+                // The IRP would be pending until there is a new message
+                //
+                SwitchToThread();
+            }
+
+            End = BenchmarkGetTime();
+
+        } while (End - Start < BENCHMARK_BATCH_DURATION * 1000000ull);
+
+        CountOfMessages = Received.CountOfMessages;
+
+        InterlockedExchange(&Writer.IsStopped, TRUE);
+        WaitForSingleObject(ThreadHandle, INFINITE);
+        CloseHandle(ThreadHandle);
+
+        //
+        // Read the rest of messages, so each message is either received or
+        // dropped
+        //
+        while (BenchmarkLogBatchRead(&BufferInformation, TRUE, Buffer, MessageLength, &Received) != 0)
+        {
+        }
+
+        if (Received.CountOfMissedMessages + Writer.CountOfMessages - Received.NextSequenceNumber != BufferInformation.CountOfDroppedMessages ||
+            Received.CountOfMessages + BufferInformation.CountOfDroppedMessages != Writer.CountOfMessages)
+        {
+            Received.CountOfErrors++;
+        }
+
+        printf("%-48s %16.0f %18.1f %12llu %10llu\n",
+               Readers[i].Description,
+               CountOfMessages / ((double)(End - Start) / 1000000000),
+               CountOfReads == 0 ? 0 : (double)CountOfMessages / CountOfReads,
+               BufferInformation.CountOfDroppedMessages,
+               Received.CountOfErrors);
+
+        if (Received.CountOfErrors != 0)
+        {
+            Result = FALSE;
+        }
+    }
+
+    free(Storage);
+    free(Buffer);
+
+    if (!Result)
+    {
+        printf("\nerr, messages are out of order, corrupted or not counted as dropped\n");
+    }
+
+    return Result;
+}
@@ -0,0 +1,619 @@
+/**
+ * @file poolcaches.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief test of the free lists and the caches of the pool manager in user-mode
+ * @details The pools are given and marked to be freed by the same code as
+ * the hypervisor (PoolManagerCaches.h), each thread requests and frees the
+ * pools on a simulated core while the main thread frees the marked pools
+ * and allocates new pools, the same as the IOCTLs of the hypervisor
+ * @version 0.1
+ * @date 2021-11-25
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+
+//
+// The variables that are used by PoolManagerCaches.h
+//
+volatile LONG            LockForReadingPool;
+BOOLEAN                  g_IsNewRequestForDeAllocation;
+LIST_ENTRY               g_ListOfAllocatedPoolsHead;
+LIST_ENTRY               g_PoolManagerFreeListsHead[POOL_MANAGER_MAXIMUM_INTENTIONS];
+LIST_ENTRY               g_ListOfPoolsToBeFreedHead;
+LIST_ENTRY               g_PoolManagerAddressHashHeads[PoolManagerAddressHashBuckets];
+PPOOL_MANAGER_CORE_CACHE g_PoolManagerCoreCaches;
+
+/**
+ * @brief The simulated core of the current thread
+ *
+ */
+thread_local UINT32 g_BenchmarkPoolCachesCurrentCore = 0;
+
+/**
+ * @brief Initialize a list, the same as the kernel
+ *
+ * @param ListHead
+ * @return VOID
+ */
+VOID
+InitializeListHead(PLIST_ENTRY ListHead)
+{
+    ListHead->Flink = ListHead->Blink = ListHead;
+}
+
+/**
+ * @brief Check whether a list is empty, the same as the kernel
+ *
+ * @param ListHead
+ * @return BOOLEAN
+ */
+BOOLEAN
+IsListEmpty(PLIST_ENTRY ListHead)
+{
+    return ListHead->Flink == ListHead;
+}
+
+/**
+ * @brief Insert an entry at the head of a list, the same as the kernel
+ *
+ * @param ListHead
+ * @param Entry
+ * @return VOID
+ */
+VOID
+InsertHeadList(PLIST_ENTRY ListHead, PLIST_ENTRY Entry)
+{
+    Entry->Flink           = ListHead->Flink;
+    Entry->Blink           = ListHead;
+    ListHead->Flink->Blink = Entry;
+    ListHead->Flink        = Entry;
+}
+
+/**
+ * @brief Insert an entry at the tail of a list, the same as the kernel
+ *
+ * @param ListHead
+ * @param Entry
+ * @return VOID
+ */
+VOID
+InsertTailList(PLIST_ENTRY ListHead, PLIST_ENTRY Entry)
+{
+    Entry->Flink           = ListHead;
+    Entry->Blink           = ListHead->Blink;
+    ListHead->Blink->Flink = Entry;
+    ListHead->Blink        = Entry;
+}
+
+/**
+ * @brief Remove an entry from its list, the same as the kernel
+ *
+ * @param Entry
+ * @return BOOLEAN TRUE if the list is empty after removing the entry
+ */
+BOOLEAN
+RemoveEntryList(PLIST_ENTRY Entry)
+{
+    PLIST_ENTRY Blink = Entry->Blink;
+    PLIST_ENTRY Flink = Entry->Flink;
+
+    Blink->Flink = Flink;
+    Flink->Blink = Blink;
+
+    return Flink == Blink;
+}
+
+/**
+ * @brief Remove the first entry of a list, the same as the kernel
+ *
+ * @param ListHead
+ * @return PLIST_ENTRY
+ */
+PLIST_ENTRY
+RemoveHeadList(PLIST_ENTRY ListHead)
+{
+    PLIST_ENTRY Entry = ListHead->Flink;
+
+    RemoveEntryList(Entry);
+
+    return Entry;
+}
+
+/**
+ * @brief Acquire a spinlock, the same as the hypervisor
+ *
+ * @param Lock
+ * @return VOID
+ */
+void
+SpinlockLock(volatile LONG * Lock)
+{
+    while (InterlockedCompareExchange(Lock, 1, 0) != 0)
+    {
+        //
+        // The owner might be preempted in user-mode
+        //
+        SwitchToThread();
+    }
+}
+
+/**
+ * @brief Release a spinlock
+ *
+ * @param Lock
+ * @return VOID
+ */
+void
+SpinlockUnlock(volatile LONG * Lock)
+{
+    InterlockedExchange(Lock, 0);
+}
+
+#include "PoolManagerCaches.h"
+
+/**
+ * @brief Get the count of simulated cores
+ *
+ * @return UINT32
+ */
+UINT32
+PoolManagerGetCountOfCores()
+{
+    return BENCHMARK_POOL_CACHES_CORES;
+}
+
+/**
+ * @brief Get the simulated core of the current thread
+ *
+ * @return UINT32
+ */
+UINT32
+PoolManagerGetCurrentCore()
+{
+    return g_BenchmarkPoolCachesCurrentCore;
+}
+
+/**
+ * @brief Allocate new pools and add them to the free list of their
+ * intention, the same as PoolManagerAllocateAndAddToPoolTable
+ *
+ * @param Intention The intention of the pools
+ * @param Count Count of pools
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkPoolCachesAllocate(POOL_ALLOCATION_INTENTION Intention, UINT32 Count)
+{
+    PPOOL_TABLE SinglePool;
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        SinglePool = (PPOOL_TABLE)calloc(1, sizeof(POOL_TABLE));
+
+        if (SinglePool == NULL)
+        {
+            return FALSE;
+        }
+
+        SinglePool->Address = (UINT64)calloc(1, sizeof(BENCHMARK_POOL_CACHES_BUFFER));
+
+        if (SinglePool->Address == NULL)
+        {
+            free(SinglePool);
+            return FALSE;
+        }
+
+        SinglePool->Size      = sizeof(BENCHMARK_POOL_CACHES_BUFFER);
+        SinglePool->Intention = Intention;
+
+        PoolManagerAddPool(SinglePool);
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Free the pools that are marked to be freed and allocate the
+ * same count of pools of each intention, the same as the IOCTLs of the
+ * hypervisor (PoolManagerCheckAndPerformAllocationAndDeallocation)
+ *
+ * @return UINT32 Count of freed pools
+ */
+UINT32
+BenchmarkPoolCachesDeallocate()
+{
+    UINT32      CountOfFreedPools[POOL_MANAGER_MAXIMUM_INTENTIONS] = {0};
+    UINT32      Count                                              = 0;
+    PPOOL_TABLE PoolTable;
+
+    SpinlockLock(&LockForReadingPool);
+
+    while (!IsListEmpty(&g_ListOfPoolsToBeFreedHead))
+    {
+        PoolTable = CONTAINING_RECORD(RemoveHeadList(&g_ListOfPoolsToBeFreedHead), POOL_TABLE, StateList);
+
+        PoolTable->AlreadyFreed = TRUE;
+
+        RemoveEntryList(&PoolTable->PoolsList);
+        RemoveEntryList(&PoolTable->AddressHashList);
+
+        CountOfFreedPools[PoolTable->Intention]++;
+        Count++;
+
+        free((PVOID)PoolTable->Address);
+        free(PoolTable);
+    }
+
+    g_IsNewRequestForDeAllocation = FALSE;
+
+    SpinlockUnlock(&LockForReadingPool);
+
+    for (UINT32 i = 0; i < POOL_MANAGER_MAXIMUM_INTENTIONS; i++)
+    {
+        BenchmarkPoolCachesAllocate((POOL_ALLOCATION_INTENTION)i, CountOfFreedPools[i]);
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Give back a pool that is taken by a thread
+ *
+ * @param Worker The thread
+ * @param PoolTable The pool
+ * @return VOID
+ */
+VOID
+BenchmarkPoolCachesRelease(PBENCHMARK_POOL_CACHES_WORKER Worker, PPOOL_TABLE PoolTable)
+{
+    PBENCHMARK_POOL_CACHES_BUFFER Buffer  = (PBENCHMARK_POOL_CACHES_BUFFER)PoolTable->Address;
+    UINT64                        Address = PoolTable->Address;
+
+    if (InterlockedExchange(&Buffer->Owner, 0) != Worker->ThreadIndex + 1)
+    {
+        Worker->CountOfErrors++;
+    }
+
+    //
+    // The pool might be freed by the main thread as soon as it's marked
+    // and its address might be given to a new pool
+    //
+    if (!PoolManagerMarkPoolToBeFreed(Address))
+    {
+        Worker->CountOfErrors++;
+    }
+}
+
+/**
+ * @brief A thread that requests pools of random intentions and frees them
+ *
+ * @param Parameter The worker
+ * @return DWORD
+ */
+DWORD WINAPI
+BenchmarkPoolCachesWorker(LPVOID Parameter)
+{
+    PBENCHMARK_POOL_CACHES_WORKER Worker = (PBENCHMARK_POOL_CACHES_WORKER)Parameter;
+    PPOOL_TABLE                   HeldPools[BENCHMARK_POOL_CACHES_HELD_POOLS] = {0};
+    PPOOL_TABLE                   PoolTable;
+    PBENCHMARK_POOL_CACHES_BUFFER Buffer;
+    POOL_ALLOCATION_INTENTION     Intention;
+    UINT32                        Random = 0x9E3779B9 * (Worker->ThreadIndex + 1);
+    UINT32                        Index;
+
+    g_BenchmarkPoolCachesCurrentCore = Worker->CoreIndex;
+
+    for (UINT32 i = 0; i < BENCHMARK_POOL_CACHES_REQUESTS; i++)
+    {
+        Random ^= Random << 13;
+        Random ^= Random >> 17;
+        Random ^= Random << 5;
+
+        Intention = (POOL_ALLOCATION_INTENTION)(Random % POOL_MANAGER_MAXIMUM_INTENTIONS);
+        Index     = (Random >> 8) % BENCHMARK_POOL_CACHES_HELD_POOLS;
+
+        if (HeldPools[Index] != NULL)
+        {
+            BenchmarkPoolCachesRelease(Worker, HeldPools[Index]);
+            HeldPools[Index] = NULL;
+        }
+
+        PoolTable = PoolManagerTakePool(Intention);
+
+        if (PoolTable == NULL)
+        {
+            //
+            // All the pools of this intention are given or marked to be freed,
+            // let the main thread free and replace them
+            //
+            Worker->CountOfFailures++;
+            SwitchToThread();
+            continue;
+        }
+
+        //
+        // No other thread should have this pool
+        //
+        Buffer = (PBENCHMARK_POOL_CACHES_BUFFER)PoolTable->Address;
+
+        if (PoolTable->Intention != Intention || !PoolTable->IsBusy || PoolTable->ShouldBeFreed ||
+            InterlockedCompareExchange(&Buffer->Owner, Worker->ThreadIndex + 1, 0) != 0)
+        {
+            Worker->CountOfErrors++;
+            continue;
+        }
+
+        HeldPools[Index] = PoolTable;
+    }
+
+    for (UINT32 i = 0; i < BENCHMARK_POOL_CACHES_HELD_POOLS; i++)
+    {
+        if (HeldPools[i] != NULL)
+        {
+            BenchmarkPoolCachesRelease(Worker, HeldPools[i]);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Show the result of a check of the test
+ *
+ * @param Condition The result of the check
+ * @param Description The description of the check
+ * @return BOOLEAN Condition
+ */
+BOOLEAN
+BenchmarkPoolCachesCheck(BOOLEAN Condition, const char * Description)
+{
+    printf("%-72s %s\n", Description, Condition ? "ok" : "err");
+
+    return Condition;
+}
+
+/**
+ * @brief Check taking and freeing a pool by a single thread
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkPoolCachesCheckFree()
+{
+    PPOOL_TABLE PoolTable;
+    PPOOL_TABLE CachedPool;
+    UINT64      Address;
+    BOOLEAN     Result = TRUE;
+
+    PoolTable = PoolManagerTakePool(TRACKING_HOOKED_PAGES);
+
+    Result &= BenchmarkPoolCachesCheck(PoolTable != NULL && PoolTable->IsBusy && PoolTable->Intention == TRACKING_HOOKED_PAGES,
+                                       "a pool of the intention is given");
+
+    if (PoolTable == NULL)
+    {
+        return FALSE;
+    }
+
+    Address    = PoolTable->Address;
+    CachedPool = g_PoolManagerCoreCaches[0].Pools[TRACKING_HOOKED_PAGES][0];
+
+    Result &= BenchmarkPoolCachesCheck(CachedPool != NULL && CachedPool != PoolTable && !CachedPool->IsBusy,
+                                       "the cache of the core is refilled from the free list");
+
+    Result &= BenchmarkPoolCachesCheck(CachedPool == NULL || !PoolManagerMarkPoolToBeFreed(CachedPool->Address),
+                                       "a pool that is not given can't be freed");
+
+    Result &= BenchmarkPoolCachesCheck(!PoolManagerMarkPoolToBeFreed(Address + 0x10),
+                                       "an address that is not a pool can't be freed");
+
+    Result &= BenchmarkPoolCachesCheck(PoolManagerMarkPoolToBeFreed(Address) && PoolTable->ShouldBeFreed && g_IsNewRequestForDeAllocation,
+                                       "a given pool is marked to be freed");
+
+    Result &= BenchmarkPoolCachesCheck(!PoolManagerMarkPoolToBeFreed(Address),
+                                       "a pool can't be freed twice");
+
+    Result &= BenchmarkPoolCachesCheck(BenchmarkPoolCachesDeallocate() == 1 && !PoolManagerMarkPoolToBeFreed(Address),
+                                       "the marked pool is freed and replaced by a new pool");
+
+    return Result;
+}
+
+/**
+ * @brief Test of the free lists and the caches of the pool manager
+ * without the hypervisor
+ *
+ * @details Threads request pools of random intentions, keep a few of them
+ * and then mark them to be freed, two threads share each simulated core,
+ * so the slots of the caches are taken and filled by more than one thread
+ * at the same time, the free lists are small, so the caches are refilled
+ * and stolen all the time, each pool should be given to only one thread
+ * and at the end, all the pools should be either in the free lists or in
+ * the caches
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkPoolCaches(int argc, char * argv[])
+{
+    BENCHMARK_POOL_CACHES_WORKER Workers[BENCHMARK_POOL_CACHES_THREADS];
+    HANDLE                       ThreadHandles[BENCHMARK_POOL_CACHES_THREADS];
+    POOL_MANAGER_STATISTICS      Statistics = {0};
+    PPOOL_TABLE                  PoolTable;
+    PLIST_ENTRY                  ListTemp;
+    UINT32                       CountOfThreads;
+    UINT64                       CountOfFailures = 0;
+    UINT64                       CountOfErrors   = 0;
+    UINT64                       CountOfFreed    = 0;
+    UINT64                       CountOfPools    = 0;
+    UINT64                       CountOfIdle     = 0;
+    UINT64                       Start;
+    UINT64                       End;
+    BOOLEAN                      Result = TRUE;
+
+    //
+    // The same as PoolManagerInitialize
+    //
+    g_PoolManagerCoreCaches = (PPOOL_MANAGER_CORE_CACHE)calloc(BENCHMARK_POOL_CACHES_CORES, sizeof(POOL_MANAGER_CORE_CACHE));
+
+    if (g_PoolManagerCoreCaches == NULL)
+    {
+        printf("err, unable to allocate the caches\n");
+        return FALSE;
+    }
+
+    InitializeListHead(&g_ListOfAllocatedPoolsHead);
+    InitializeListHead(&g_ListOfPoolsToBeFreedHead);
+
+    for (UINT32 i = 0; i < PoolManagerAddressHashBuckets; i++)
+    {
+        InitializeListHead(&g_PoolManagerAddressHashHeads[i]);
+    }
+
+    for (UINT32 i = 0; i < POOL_MANAGER_MAXIMUM_INTENTIONS; i++)
+    {
+        InitializeListHead(&g_PoolManagerFreeListsHead[i]);
+
+        if (!BenchmarkPoolCachesAllocate((POOL_ALLOCATION_INTENTION)i, BENCHMARK_POOL_CACHES_POOLS))
+        {
+            printf("err, unable to allocate the pools\n");
+            Result = FALSE;
+        }
+    }
+
+    printf("\n");
+
+    if (Result)
+    {
+        Result = BenchmarkPoolCachesCheckFree();
+    }
+
+    //
+    // The counters only show the requests of the threads
+    //
+    for (UINT32 i = 0; i < BENCHMARK_POOL_CACHES_CORES; i++)
+    {
+        RtlZeroMemory(&g_PoolManagerCoreCaches[i].Statistics, sizeof(POOL_MANAGER_STATISTICS));
+    }
+
+    Start = BenchmarkGetTime();
+
+    for (CountOfThreads = 0; CountOfThreads < BENCHMARK_POOL_CACHES_THREADS && Result; CountOfThreads++)
+    {
+        Workers[CountOfThreads].ThreadIndex     = CountOfThreads;
+        Workers[CountOfThreads].CoreIndex       = CountOfThreads % BENCHMARK_POOL_CACHES_CORES;
+        Workers[CountOfThreads].CountOfFailures = 0;
+        Workers[CountOfThreads].CountOfErrors   = 0;
+
+        ThreadHandles[CountOfThreads] = CreateThread(NULL, 0, BenchmarkPoolCachesWorker, &Workers[CountOfThreads], 0, NULL);
+
+        if (ThreadHandles[CountOfThreads] == NULL)
+        {
+            printf("err, unable to create the thread (%x)\n", GetLastError());
+            Result = FALSE;
+            break;
+        }
+    }
+
+    //
+    // The main thread frees the marked pools until all the threads finish
+    //
+    while (CountOfThreads != 0 && WaitForMultipleObjects(CountOfThreads, ThreadHandles, TRUE, 0) == WAIT_TIMEOUT)
+    {
+        CountOfFreed += BenchmarkPoolCachesDeallocate();
+
+        SwitchToThread();
+    }
+
+    End = BenchmarkGetTime();
+
+    CountOfFreed += BenchmarkPoolCachesDeallocate();
+
+    for (UINT32 i = 0; i < CountOfThreads; i++)
+    {
+        CloseHandle(ThreadHandles[i]);
+
+        CountOfFailures += Workers[i].CountOfFailures;
+        CountOfErrors += Workers[i].CountOfErrors;
+    }
+
+    PoolManagerQueryStatistics(&Statistics);
+
+    //
+    // Each pool is either in the free list of its intention or in a cache
+    //
+    ListTemp = &g_ListOfAllocatedPoolsHead;
+
+    while (&g_ListOfAllocatedPoolsHead != ListTemp->Flink)
+    {
+        ListTemp  = ListTemp->Flink;
+        PoolTable = CONTAINING_RECORD(ListTemp, POOL_TABLE, PoolsList);
+
+        CountOfPools++;
+
+        if (!PoolTable->IsBusy && ((PBENCHMARK_POOL_CACHES_BUFFER)PoolTable->Address)->Owner == 0)
+        {
+            CountOfIdle++;
+        }
+    }
+
+    for (UINT32 i = 0; i < POOL_MANAGER_MAXIMUM_INTENTIONS; i++)
+    {
+        ListTemp = &g_PoolManagerFreeListsHead[i];
+
+        while (&g_PoolManagerFreeListsHead[i] != ListTemp->Flink)
+        {
+            ListTemp = ListTemp->Flink;
+            CountOfIdle--;
+        }
+
+        for (UINT32 j = 0; j < BENCHMARK_POOL_CACHES_CORES; j++)
+        {
+            for (UINT32 k = 0; k < PoolManagerPerCoreCacheSize; k++)
+            {
+                if (g_PoolManagerCoreCaches[j].Pools[i][k] != NULL)
+                {
+                    CountOfIdle--;
+                }
+            }
+        }
+    }
+
+    printf("%-10s %16s %12s %12s %12s %12s %12s\n", "threads", "requests per s", "hits", "misses", "refills", "steals", "failures");
+    printf("%-10u %16.0f %12llu %12llu %12llu %12llu %12llu\n\n",
+           CountOfThreads,
+           (double)CountOfThreads * BENCHMARK_POOL_CACHES_REQUESTS / ((double)(End - Start) / 1000000000),
+           Statistics.CacheHits,
+           Statistics.CacheMisses,
+           Statistics.Refills,
+           Statistics.Steals,
+           Statistics.Failures);
+
+    Result &= BenchmarkPoolCachesCheck(CountOfErrors == 0,
+                                       "each pool is given to one thread and freed once");
+    Result &= BenchmarkPoolCachesCheck(Statistics.CacheHits + Statistics.CacheMisses == (UINT64)CountOfThreads * BENCHMARK_POOL_CACHES_REQUESTS &&
+                                           Statistics.Failures == CountOfFailures,
+                                       "the counters match the requests");
+    Result &= BenchmarkPoolCachesCheck(CountOfPools == POOL_MANAGER_MAXIMUM_INTENTIONS * BENCHMARK_POOL_CACHES_POOLS && CountOfIdle == 0,
+                                       "all the pools are in the free lists or in the caches after the test");
+
+    //
+    // The same as PoolManagerUninitialize
+    //
+    while (!IsListEmpty(&g_ListOfAllocatedPoolsHead))
+    {
+        PoolTable = CONTAINING_RECORD(RemoveHeadList(&g_ListOfAllocatedPoolsHead), POOL_TABLE, PoolsList);
+
+        free((PVOID)PoolTable->Address);
+        free(PoolTable);
+    }
+
+    free(g_PoolManagerCoreCaches);
+    g_PoolManagerCoreCaches = NULL;
+
+    return Result;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file pools.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief benchmarks of the pool manager
+ * @details
+ * @version 0.1
+ * @date 2021-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+
+/**
+ * @brief Benchmark of requesting and freeing the pools of the pool manager
+ *
+ * @details Each round applies a monitor (hidden hook read/write) event
+ * to a page, which takes pools of the pool manager for splitting the
+ * large page and for the details of the hook, and then clears it which
+ * frees the pools, the counters of the pool manager are shown before and
+ * after the rounds
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkPoolManager(int argc, char * argv[])
+{
+    char    Command[MAX_PATH];
+    PBYTE   Buffer;
+    UINT64  Start;
+    UINT64  End;
+    UINT32  Rounds = BENCHMARK_POOLS_ROUNDS;
+    BOOLEAN Result = TRUE;
+
+    if (argc >= 1)
+    {
+        Rounds = strtoul(argv[0], NULL, 16);
+    }
+
+    if (Rounds == 0)
+    {
+        printf("err, invalid count of rounds\n");
+        return FALSE;
+    }
+
+    Buffer = BenchmarkAllocateLockedBuffer(BENCHMARK_PAGE_SIZE);
+
+    if (Buffer == NULL)
+    {
+        return FALSE;
+    }
+
+    //
+    // Make sure that the first round doesn't wait for allocations
+    //
+    if (!BenchmarkRunCommand("prealloc monitor 4"))
+    {
+        BenchmarkFreeLockedBuffer(Buffer, BENCHMARK_PAGE_SIZE);
+        return FALSE;
+    }
+
+    printf("\npool manager counters before the benchmark :\n");
+    BenchmarkRunCommand("prealloc stats");
+
+    sprintf_s(Command,
+              sizeof(Command),
+              "!monitor rw %llx %llx pid %x script { bench = 0; }",
+              (UINT64)Buffer,
+              (UINT64)(Buffer + 0xff),
+              GetCurrentProcessId());
+
+    Start = BenchmarkGetTime();
+
+    for (UINT32 i = 0; i < Rounds; i++)
+    {
+        if (!BenchmarkRunCommand(Command) || !BenchmarkRunCommand("events c all"))
+        {
+            Result = FALSE;
+            break;
+        }
+    }
+
+    End = BenchmarkGetTime();
+
+    if (Result)
+    {
+        printf("\n%-10s %20s\n", "rounds", "us per apply/clear");
+        printf("%-10x %20.1f\n", Rounds, (double)(End - Start) / Rounds / 1000);
+    }
+
+    printf("\npool manager counters after the benchmark :\n");
+    BenchmarkRunCommand("prealloc stats");
+
+    BenchmarkFreeLockedBuffer(Buffer, BENCHMARK_PAGE_SIZE);
+
+    return Result;
+}
@@ -0,0 +1,328 @@
+/**
+ * @file receive.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief benchmark of receiving the packets of the debuggee
+ * @details The packets are sent through a local named pipe that stands
+ * for the serial port and they're received by the same routines as the
+ * debugger (exported by hprdbgctrl), so this benchmark doesn't need the
+ * vmm module
+ * @version 0.1
+ * @date 2021-11-20
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+
+/**
+ * @brief The end of the packets that are not framed
+ *
+ */
+BYTE g_BenchmarkEndOfBuffer[SERIAL_END_OF_BUFFER_CHARS_COUNT] = {
+    SERIAL_END_OF_BUFFER_CHAR_1,
+    SERIAL_END_OF_BUFFER_CHAR_2,
+    SERIAL_END_OF_BUFFER_CHAR_3,
+    SERIAL_END_OF_BUFFER_CHAR_4};
+
+/**
+ * @brief Get the byte of a packet of the benchmark of receiving packets
+ *
+ * @param PacketIndex
+ * @param ByteIndex
+ *
+ * @return CHAR
+ */
+CHAR
+BenchmarkReceiveGetByte(UINT32 PacketIndex, UINT32 ByteIndex)
+{
+    return (CHAR)('a' + (PacketIndex + ByteIndex) % 26);
+}
+
+/**
+ * @brief Thread that sends the packets of the benchmark of receiving
+ * packets (it stands for the debuggee)
+ *
+ * @param Data
+ * @return DWORD
+ */
+DWORD WINAPI
+BenchmarkReceiveSenderThread(LPVOID Data)
+{
+    PBENCHMARK_RECEIVE_SENDER Sender       = (PBENCHMARK_RECEIVE_SENDER)Data;
+    CHAR *                    Packet       = NULL;
+    PSERIAL_FRAME_HEADER      Header       = NULL;
+    CHAR *                    Payload      = NULL;
+    UINT32                    TotalSize    = 0;
+    DWORD                     BytesWritten = 0;
+
+    //
+    // Framed packets start with a header, other packets end with the
+    // end of buffer
+    //
+    TotalSize = Sender->PacketSize + (Sender->IsFramed ? sizeof(SERIAL_FRAME_HEADER) : SERIAL_END_OF_BUFFER_CHARS_COUNT);
+    Packet    = (CHAR *)malloc(TotalSize);
+
+    if (Packet != NULL)
+    {
+        Header  = (PSERIAL_FRAME_HEADER)Packet;
+        Payload = Sender->IsFramed ? Packet + sizeof(SERIAL_FRAME_HEADER) : Packet;
+
+        for (UINT32 i = 0; i < Sender->CountOfPackets; i++)
+        {
+            for (UINT32 j = 0; j < Sender->PacketSize; j++)
+            {
+                Payload[j] = BenchmarkReceiveGetByte(i, j);
+            }
+
+            if (Sender->IsFramed)
+            {
+                Header->Signature = SERIAL_FRAME_SIGNATURE;
+                Header->Length    = Sender->PacketSize;
+                Header->Crc32     = KdComputeDataCrc32(Payload, Sender->PacketSize, 0);
+            }
+            else
+            {
+                memcpy(&Payload[Sender->PacketSize], g_BenchmarkEndOfBuffer, SERIAL_END_OF_BUFFER_CHARS_COUNT);
+            }
+
+            if (!WriteFile(Sender->PipeHandle, Packet, TotalSize, &BytesWritten, NULL))
+            {
+                break;
+            }
+        }
+
+        free(Packet);
+    }
+
+    //
+    // Wait until the packets are read, then close the pipe, if the sender
+    // stopped sooner, the receiver gets an error
+    //
+    FlushFileBuffers(Sender->PipeHandle);
+    CloseHandle(Sender->PipeHandle);
+
+    return 0;
+}
+
+/**
+ * @brief Receive the packets of the benchmark through a local named pipe
+ * @details The receiver side of the pipe is opened the same as the serial
+ * port of the debugger (overlapped I/O), reading one byte at once is the
+ * same as the previous way of receiving packets
+ *
+ * @param MaximumReadLength Maximum count of bytes that is read at once
+ * @param IsFramed Whether the packets are sent in frames (length and CRC32)
+ * @param Result
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkReceivePackets(UINT32 MaximumReadLength, BOOLEAN IsFramed, PBENCHMARK_RECEIVE_RESULT Result)
+{
+    CHAR                     PipeName[MAX_PATH] = {0};
+    HANDLE                   ServerHandle       = INVALID_HANDLE_VALUE;
+    HANDLE                   ClientHandle       = INVALID_HANDLE_VALUE;
+    HANDLE                   SenderThread       = NULL;
+    OVERLAPPED               Overlapped         = {0};
+    PKD_RECEIVE_BUFFER       ReceiveBuffer      = NULL;
+    CHAR *                   BufferToSave       = NULL;
+    UINT32                   LengthReceived     = 0;
+    BOOLEAN                  IsSuccessful       = FALSE;
+    BENCHMARK_RECEIVE_SENDER Sender             = {0};
+    UINT64                   Start;
+
+    RtlZeroMemory(Result, sizeof(BENCHMARK_RECEIVE_RESULT));
+
+    sprintf_s(PipeName, sizeof(PipeName), "\\\\.\\pipe\\HyperDbgReceiveBenchmark%x", GetCurrentProcessId());
+
+    ServerHandle = CreateNamedPipeA(PipeName,
+                                    PIPE_ACCESS_OUTBOUND,
+                                    PIPE_TYPE_BYTE | PIPE_WAIT,
+                                    1,
+                                    KD_RECEIVE_BUFFER_SIZE,
+                                    KD_RECEIVE_BUFFER_SIZE,
+                                    0,
+                                    NULL);
+
+    if (ServerHandle == INVALID_HANDLE_VALUE)
+    {
+        goto Cleanup;
+    }
+
+    ClientHandle = CreateFileA(PipeName, GENERIC_READ, 0, NULL, OPEN_EXISTING, FILE_FLAG_OVERLAPPED, NULL);
+
+    if (ClientHandle == INVALID_HANDLE_VALUE)
+    {
+        goto Cleanup;
+    }
+
+    if (!ConnectNamedPipe(ServerHandle, NULL) && GetLastError() != ERROR_PIPE_CONNECTED)
+    {
+        goto Cleanup;
+    }
+
+    Overlapped.hEvent = CreateEvent(NULL, TRUE, FALSE, NULL);
+    ReceiveBuffer     = (PKD_RECEIVE_BUFFER)malloc(sizeof(KD_RECEIVE_BUFFER));
+    BufferToSave      = (CHAR *)malloc(MaxSerialPacketSize);
+
+    if (Overlapped.hEvent == NULL || ReceiveBuffer == NULL || BufferToSave == NULL)
+    {
+        goto Cleanup;
+    }
+
+    ReceiveBuffer->Head = 0;
+    ReceiveBuffer->Tail = 0;
+
+    //
+    // The sender thread closes the server side of the pipe
+    //
+    Sender.PipeHandle     = ServerHandle;
+    Sender.CountOfPackets = BENCHMARK_RECEIVE_COUNT_OF_PACKETS;
+    Sender.PacketSize     = BENCHMARK_RECEIVE_PACKET_SIZE;
+    Sender.IsFramed       = IsFramed;
+
+    SenderThread = CreateThread(NULL, 0, BenchmarkReceiveSenderThread, &Sender, 0, NULL);
+
+    if (SenderThread == NULL)
+    {
+        goto Cleanup;
+    }
+
+    ServerHandle = INVALID_HANDLE_VALUE;
+
+    Start = BenchmarkGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_RECEIVE_COUNT_OF_PACKETS; i++)
+    {
+        if (!KdReceivePacketThroughBuffer(ClientHandle,
+                                          &Overlapped,
+                                          ReceiveBuffer,
+                                          MaximumReadLength,
+                                          BufferToSave,
+                                          &LengthReceived,
+                                          &Result->CountOfReads))
+        {
+            goto Cleanup;
+        }
+
+        if (LengthReceived != BENCHMARK_RECEIVE_PACKET_SIZE ||
+            BufferToSave[0] != BenchmarkReceiveGetByte(i, 0) ||
+            BufferToSave[BENCHMARK_RECEIVE_PACKET_SIZE - 1] != BenchmarkReceiveGetByte(i, BENCHMARK_RECEIVE_PACKET_SIZE - 1))
+        {
+            Result->CountOfErrors++;
+        }
+    }
+
+    Result->Time = BenchmarkGetTime() - Start;
+    IsSuccessful = TRUE;
+
+Cleanup:
+
+    //
+    // Closing the receiver side stops the sender (if it's not finished)
+    //
+    if (ClientHandle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(ClientHandle);
+    }
+
+    if (SenderThread != NULL)
+    {
+        WaitForSingleObject(SenderThread, INFINITE);
+        CloseHandle(SenderThread);
+    }
+
+    if (ServerHandle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(ServerHandle);
+    }
+
+    if (Overlapped.hEvent != NULL)
+    {
+        CloseHandle(Overlapped.hEvent);
+    }
+
+    free(ReceiveBuffer);
+    free(BufferToSave);
+
+    return IsSuccessful;
+}
+
+/**
+ * @brief Show the result of receiving the packets by one way of reading
+ *
+ * @param Name
+ * @param Result
+ * @param PacketSize Size of each packet (including the end of buffer or
+ * the header of frames)
+ * @param BaseTime Time of the byte-wise reads
+ *
+ * @return VOID
+ */
+VOID
+BenchmarkReceiveShowResult(const char * Name, PBENCHMARK_RECEIVE_RESULT Result, UINT32 PacketSize, UINT64 BaseTime)
+{
+    printf("%-26s : %12.0f bytes/s, %8.2f reads/packet, %d errors (%.2fx)\n",
+           Name,
+           ((double)PacketSize * BENCHMARK_RECEIVE_COUNT_OF_PACKETS * 1000000000.0) / Result->Time,
+           (double)Result->CountOfReads / BENCHMARK_RECEIVE_COUNT_OF_PACKETS,
+           Result->CountOfErrors,
+           (double)BaseTime / (double)Result->Time);
+}
+
+/**
+ * @brief Benchmark of receiving the packets of the debuggee
+ *
+ * @details The same packets are received by reading one byte at once
+ * (the previous way of receiving packets), by buffered reads, and by
+ * buffered reads of framed packets (length and CRC32 instead of the end
+ * of buffer)
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkReceive(int argc, char * argv[])
+{
+    BENCHMARK_RECEIVE_RESULT ByteWiseResult = {0};
+    BENCHMARK_RECEIVE_RESULT BufferedResult = {0};
+    BENCHMARK_RECEIVE_RESULT FramedResult   = {0};
+
+    if (!BenchmarkReceivePackets(sizeof(BYTE), FALSE, &ByteWiseResult) ||
+        !BenchmarkReceivePackets(KD_RECEIVE_BUFFER_SIZE, FALSE, &BufferedResult) ||
+        !BenchmarkReceivePackets(KD_RECEIVE_BUFFER_SIZE, TRUE, &FramedResult))
+    {
+        printf("err, unable to receive the packets (%x)\n", GetLastError());
+        return FALSE;
+    }
+
+    if (ByteWiseResult.Time == 0 || BufferedResult.Time == 0 || FramedResult.Time == 0)
+    {
+        printf("err, the benchmark is too short to be measured\n");
+        return FALSE;
+    }
+
+    printf("packets : %d, size of each packet : %d bytes\n",
+           BENCHMARK_RECEIVE_COUNT_OF_PACKETS,
+           BENCHMARK_RECEIVE_PACKET_SIZE);
+
+    BenchmarkReceiveShowResult("byte-wise reads",
+                               &ByteWiseResult,
+                               BENCHMARK_RECEIVE_PACKET_SIZE + SERIAL_END_OF_BUFFER_CHARS_COUNT,
+                               ByteWiseResult.Time);
+
+    BenchmarkReceiveShowResult("buffered reads",
+                               &BufferedResult,
+                               BENCHMARK_RECEIVE_PACKET_SIZE + SERIAL_END_OF_BUFFER_CHARS_COUNT,
+                               ByteWiseResult.Time);
+
+    BenchmarkReceiveShowResult("buffered reads (framed)",
+                               &FramedResult,
+                               BENCHMARK_RECEIVE_PACKET_SIZE + sizeof(SERIAL_FRAME_HEADER),
+                               ByteWiseResult.Time);
+
+    return ByteWiseResult.CountOfErrors == 0 &&
+           BufferedResult.CountOfErrors == 0 &&
+           FramedResult.CountOfErrors == 0;
+}
@@ -0,0 +1,816 @@
+/**
+ * @file scripts.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief benchmarks of the script engine
+ * @details The scripts are parsed by script-engine and run in this
+ * process by the same evaluator as the debugger (in user-mode), so these
+ * benchmarks don't need the vmm module
+ * @version 0.1
+ * @date 2021-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+
+VOID
+ShowMessages(const char * Fmt, ...);
+
+//
+// Include the evaluator of scripts
+//
+#define SCRIPT_ENGINE_USER_MODE
+#include "ScriptEngineEval.h"
+
+/**
+ * @brief Engines that run a script in the benchmark
+ *
+ */
+typedef enum _BENCHMARK_SCRIPT_ENGINE
+{
+    BENCHMARK_SCRIPT_ENGINE_INTERPRETER,
+    BENCHMARK_SCRIPT_ENGINE_BYTECODE,
+    BENCHMARK_SCRIPT_ENGINE_JIT,
+    BENCHMARK_SCRIPT_ENGINE_COUNT_OF_ENGINES
+
+} BENCHMARK_SCRIPT_ENGINE;
+
+/**
+ * @brief State of running a script in the benchmark
+ *
+ */
+typedef struct _BENCHMARK_SCRIPT_STATE
+{
+    GUEST_REGS GuestRegs;
+    UINT64     TempList[MAX_TEMP_COUNT];
+    UINT64     GlobalVariables[MAX_VAR_COUNT];
+    UINT64     LocalVariables[MAX_VAR_COUNT];
+    UINT64     Result;
+    BOOLEAN    HasError;
+
+} BENCHMARK_SCRIPT_STATE, *PBENCHMARK_SCRIPT_STATE;
+
+/**
+ * @brief Show messages of the script engine
+ *
+ * @param Fmt format string message
+ */
+VOID
+ShowMessages(const char * Fmt, ...)
+{
+    va_list Args;
+
+    va_start(Args, Fmt);
+    vprintf(Fmt, Args);
+    va_end(Args);
+}
+
+/**
+ * @brief Run the native code of a script, exceptions of the native
+ * code are caught so a wrong translation doesn't crash the benchmark
+ * @param GuestRegs
+ * @param VariablesList
+ * @param CodeBuffer
+ * @param Code The native code
+ * @param ErrorSymbol
+ * @param Faulted Set to TRUE if the native code caused an exception
+ *
+ * @return BOOLEAN TRUE if there was an error
+ */
+BOOLEAN
+BenchmarkExecuteJit(PGUEST_REGS                    GuestRegs,
+                    SCRIPT_ENGINE_VARIABLES_LIST * VariablesList,
+                    PSYMBOL_BUFFER                 CodeBuffer,
+                    PVOID                          Code,
+                    PSYMBOL                        ErrorSymbol,
+                    PBOOLEAN                       Faulted)
+{
+    ACTION_BUFFER ActionBuffer = {0};
+
+    __try
+    {
+        return ScriptEngineExecuteJit(GuestRegs, ActionBuffer, VariablesList, CodeBuffer, Code, ErrorSymbol);
+    }
+    __except (EXCEPTION_EXECUTE_HANDLER)
+    {
+        *Faulted = TRUE;
+        return TRUE;
+    }
+}
+
+/**
+ * @brief Compare the results and the speed of running a script by the
+ * interpreter of the symbol buffer, by the bytecode and by the native code
+ * @details All of them run the script from the same state, so their
+ * results and the registers and variables after running the script
+ * should be the same
+ * @param Expr The script
+ * @param Times Total time of each engine (in nanoseconds)
+ * @param ResultsMatch Whether all of them have the same results
+ * @param CountOfInstructions Count of instructions before optimization
+ * @param CountOfOptimizedInstructions Count of instructions after optimization
+ *
+ * @return BOOLEAN FALSE if the script has error or can't be lowered
+ */
+BOOLEAN
+BenchmarkRunScript(string   Expr,
+                   UINT64   Times[BENCHMARK_SCRIPT_ENGINE_COUNT_OF_ENGINES],
+                   PBOOLEAN ResultsMatch,
+                   PUINT32  CountOfInstructions,
+                   PUINT32  CountOfOptimizedInstructions)
+{
+    SCRIPT_ENGINE_VARIABLES_LIST VariablesList = {0};
+    ACTION_BUFFER                ActionBuffer  = {0};
+    SYMBOL                       ErrorSymbol   = {0};
+    PBENCHMARK_SCRIPT_STATE      States        = NULL;
+    PBENCHMARK_SCRIPT_STATE      State         = NULL;
+    UINT32 *                     Labels        = NULL;
+    PVOID                        JitCode       = NULL;
+    UINT32                       JitSize       = 0;
+    BOOLEAN                      IsCompiled    = FALSE;
+    BOOLEAN                      JitFaulted    = FALSE;
+    DWORD                        OldProtect    = 0;
+    UINT64                       Start;
+
+    PSYMBOL_BUFFER CodeBuffer = ScriptEngineParse((char *)Expr.c_str());
+
+    if (CodeBuffer->Message != NULL)
+    {
+        RemoveSymbolBuffer(CodeBuffer);
+        return FALSE;
+    }
+
+    ScriptEngineGetOptimizerStatistics(CountOfInstructions, CountOfOptimizedInstructions);
+
+    PSCRIPT_ENGINE_BYTECODE Bytecode = (PSCRIPT_ENGINE_BYTECODE)malloc(SCRIPT_ENGINE_BYTECODE_SIZE(CodeBuffer->Pointer));
+
+    if (Bytecode == NULL || !ScriptEngineLowerToBytecode(CodeBuffer, Bytecode))
+    {
+        free(Bytecode);
+        RemoveSymbolBuffer(CodeBuffer);
+        return FALSE;
+    }
+
+    //
+    // Translate the bytecode to the native code, the native code is
+    // written in a read-write memory and then it's changed to read-execute
+    //
+    JitSize = (UINT32)SCRIPT_ENGINE_JIT_SIZE(Bytecode->CountOfInstructions);
+    JitCode = VirtualAlloc(NULL, JitSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    Labels  = (UINT32 *)malloc(SCRIPT_ENGINE_JIT_LABELS_SIZE(Bytecode->CountOfInstructions));
+
+    IsCompiled = JitCode != NULL && Labels != NULL &&
+                 ScriptEngineJitCompile(Bytecode, JitCode, JitSize, Labels) &&
+                 VirtualProtect(JitCode, JitSize, PAGE_EXECUTE_READ, &OldProtect);
+
+    free(Labels);
+
+    //
+    // The working state and the final state of each engine
+    //
+    States = (PBENCHMARK_SCRIPT_STATE)calloc(BENCHMARK_SCRIPT_ENGINE_COUNT_OF_ENGINES + 1, sizeof(BENCHMARK_SCRIPT_STATE));
+
+    if (!IsCompiled || States == NULL)
+    {
+        if (JitCode != NULL)
+        {
+            VirtualFree(JitCode, 0, MEM_RELEASE);
+        }
+
+        free(States);
+        free(Bytecode);
+        RemoveSymbolBuffer(CodeBuffer);
+        return FALSE;
+    }
+
+    FlushInstructionCache(GetCurrentProcess(), JitCode, JitSize);
+
+    State                             = &States[BENCHMARK_SCRIPT_ENGINE_COUNT_OF_ENGINES];
+    VariablesList.TempList            = State->TempList;
+    VariablesList.GlobalVariablesList = State->GlobalVariables;
+    VariablesList.LocalVariablesList  = State->LocalVariables;
+
+    for (UINT32 Engine = 0; Engine < BENCHMARK_SCRIPT_ENGINE_COUNT_OF_ENGINES && !JitFaulted; Engine++)
+    {
+        //
+        // Each engine runs from the same state (and the same addresses
+        // of the variables)
+        //
+        RtlZeroMemory(State, sizeof(BENCHMARK_SCRIPT_STATE));
+
+        Start = BenchmarkGetTime();
+
+        for (UINT32 j = 0; j < BENCHMARK_SCRIPTS_ITERATIONS && !JitFaulted; j++)
+        {
+            g_CurrentExprEvalResult         = NULL;
+            g_CurrentExprEvalResultHasError = FALSE;
+
+            switch (Engine)
+            {
+            case BENCHMARK_SCRIPT_ENGINE_INTERPRETER:
+
+                State->HasError = FALSE;
+
+                for (int i = 0; i < CodeBuffer->Pointer;)
+                {
+                    if (ScriptEngineExecute(&State->GuestRegs, ActionBuffer, &VariablesList, CodeBuffer, &i, &ErrorSymbol) == TRUE)
+                    {
+                        State->HasError = TRUE;
+                        break;
+                    }
+                }
+                break;
+
+            case BENCHMARK_SCRIPT_ENGINE_BYTECODE:
+
+                State->HasError = ScriptEngineExecuteBytecode(&State->GuestRegs,
+                                                              ActionBuffer,
+                                                              &VariablesList,
+                                                              CodeBuffer,
+                                                              Bytecode,
+                                                              &ErrorSymbol);
+                break;
+
+            case BENCHMARK_SCRIPT_ENGINE_JIT:
+
+                State->HasError = BenchmarkExecuteJit(&State->GuestRegs,
+                                                      &VariablesList,
+                                                      CodeBuffer,
+                                                      JitCode,
+                                                      &ErrorSymbol,
+                                                      &JitFaulted);
+                break;
+            }
+        }
+
+        Times[Engine] = BenchmarkGetTime() - Start;
+        State->Result = State->HasError ? NULL : g_CurrentExprEvalResult;
+
+        RtlCopyMemory(&States[Engine], State, sizeof(BENCHMARK_SCRIPT_STATE));
+    }
+
+    //
+    // Compare the final state of the engines with the interpreter (temps
+    // are not compared as they are not visible after running the script)
+    //
+    *ResultsMatch = !JitFaulted;
+
+    for (UINT32 Engine = 1; Engine < BENCHMARK_SCRIPT_ENGINE_COUNT_OF_ENGINES; Engine++)
+    {
+        if (States[Engine].HasError != States[0].HasError ||
+            States[Engine].Result != States[0].Result ||
+            memcmp(&States[Engine].GuestRegs, &States[0].GuestRegs, sizeof(GUEST_REGS)) != 0 ||
+            memcmp(States[Engine].GlobalVariables, States[0].GlobalVariables, sizeof(States[0].GlobalVariables)) != 0 ||
+            memcmp(States[Engine].LocalVariables, States[0].LocalVariables, sizeof(States[0].LocalVariables)) != 0)
+        {
+            *ResultsMatch = FALSE;
+        }
+    }
+
+    VirtualFree(JitCode, 0, MEM_RELEASE);
+    free(States);
+    free(Bytecode);
+    RemoveSymbolBuffer(CodeBuffer);
+
+    return TRUE;
+}
+
+/**
+ * @brief Benchmark of the interpreter, the bytecode and the native code
+ * of the script engine over the test-cases of the script engine
+ *
+ * @details The test-cases are read from the same file as '? test'
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkScripts(int argc, char * argv[])
+{
+    string  Line;
+    string  Expr;
+    UINT64  Times[BENCHMARK_SCRIPT_ENGINE_COUNT_OF_ENGINES]      = {0};
+    UINT64  TotalTimes[BENCHMARK_SCRIPT_ENGINE_COUNT_OF_ENGINES] = {0};
+    UINT32  CountOfScripts                                       = 0;
+    UINT32  CountOfMismatches                                    = 0;
+    BOOLEAN ResultsMatch                                         = FALSE;
+    UINT32  Instructions                                         = 0;
+    UINT32  OptimizedInstructions                                = 0;
+    UINT64  TotalInstructions                                    = 0;
+    UINT64  TotalOptimizedInstructions                           = 0;
+    UINT64  CountOfRuns;
+
+    ifstream File(SCRIPT_TEST_CASE_FILE_NAME);
+
+    if (!File.is_open())
+    {
+        printf("err, could not find '%s' file for test-cases\n", SCRIPT_TEST_CASE_FILE_NAME);
+        return FALSE;
+    }
+
+    //
+    // Each test-case is the number, the statement, the expected
+    // result and $end$
+    //
+    while (getline(File, Line))
+    {
+        if (!getline(File, Expr) || !getline(File, Line) || !getline(File, Line))
+        {
+            break;
+        }
+
+        Expr.append(" ");
+
+        if (!BenchmarkRunScript(Expr, Times, &ResultsMatch, &Instructions, &OptimizedInstructions))
+        {
+            //
+            // The statement has a syntax error or can't be lowered
+            //
+            continue;
+        }
+
+        CountOfScripts++;
+        TotalInstructions += Instructions;
+        TotalOptimizedInstructions += OptimizedInstructions;
+
+        for (UINT32 Engine = 0; Engine < BENCHMARK_SCRIPT_ENGINE_COUNT_OF_ENGINES; Engine++)
+        {
+            TotalTimes[Engine] += Times[Engine];
+        }
+
+        if (!ResultsMatch)
+        {
+            CountOfMismatches++;
+            printf("err, results of the interpreter, the bytecode and the jit are different for : %s\n", Expr.c_str());
+        }
+    }
+
+    File.close();
+
+    if (CountOfScripts == 0 ||
+        TotalTimes[BENCHMARK_SCRIPT_ENGINE_BYTECODE] == 0 ||
+        TotalTimes[BENCHMARK_SCRIPT_ENGINE_JIT] == 0)
+    {
+        printf("err, there is no test-case to benchmark\n");
+        return FALSE;
+    }
+
+    CountOfRuns = (UINT64)CountOfScripts * BENCHMARK_SCRIPTS_ITERATIONS;
+
+    printf("\nscripts : %u, runs of each script : %u, mismatches : %u\n\n",
+           CountOfScripts,
+           BENCHMARK_SCRIPTS_ITERATIONS,
+           CountOfMismatches);
+
+    printf("%-12s %16s %10s\n", "engine", "ns per run", "speedup");
+
+    printf("%-12s %16llu %10.2f\n",
+           "interpreter",
+           TotalTimes[BENCHMARK_SCRIPT_ENGINE_INTERPRETER] / CountOfRuns,
+           1.0);
+
+    printf("%-12s %16llu %10.2f\n",
+           "bytecode",
+           TotalTimes[BENCHMARK_SCRIPT_ENGINE_BYTECODE] / CountOfRuns,
+           (double)TotalTimes[BENCHMARK_SCRIPT_ENGINE_INTERPRETER] / (double)TotalTimes[BENCHMARK_SCRIPT_ENGINE_BYTECODE]);
+
+    printf("%-12s %16llu %10.2f\n",
+           "jit",
+           TotalTimes[BENCHMARK_SCRIPT_ENGINE_JIT] / CountOfRuns,
+           (double)TotalTimes[BENCHMARK_SCRIPT_ENGINE_INTERPRETER] / (double)TotalTimes[BENCHMARK_SCRIPT_ENGINE_JIT]);
+
+    printf("\noptimizer : %llu instructions before and %llu after\n",
+           TotalInstructions,
+           TotalOptimizedInstructions);
+
+    return CountOfMismatches == 0;
+}
+
+/**
+ * @brief Benchmark of the parser of the script engine over a large
+ * generated script
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkScriptParser(int argc, char * argv[])
+{
+    UINT32         CountOfAllocations = 0;
+    UINT32         CountOfArenaChunks = 0;
+    UINT64         AllocatedBytes     = 0;
+    UINT32         Index              = 0;
+    string         Expr               = "x = 0; y = 0; i = 0; .counter = 0; ";
+    PSYMBOL_BUFFER CodeBuffer;
+    UINT64         Start;
+    UINT64         Time;
+
+    //
+    // Statements that cover the keywords, registers, pseudo-registers,
+    // functions and numbers of the scanner
+    //
+    const char * Statements[] = {
+        "x = @rax + 0x10 * (y - 3); ",
+        "if (x > 10 && y != 2) { @rbx = poi(@rcx + x); } elsif (x == 4) { y = db(@rsp + 8); } else { y = dq(@rsp) ^ $pid; } ",
+        "do { x = x + i * 0y101; i = i + 1; } while (i < 0n16); ",
+        "while (x < 5) { x = x + 1; } ",
+        "printf(\"%llx %x\\n\", x, $tid); ",
+        ".counter = .counter + low(@r8) - hi(@r9); ",
+        "y = ~x | (0o17 << 2) & strlen(@rdx); ",
+    };
+
+    while (Expr.size() < BENCHMARK_SCRIPTS_PARSE_SCRIPT_SIZE)
+    {
+        Expr.append(Statements[Index++ % (sizeof(Statements) / sizeof(Statements[0]))]);
+    }
+
+    Start = BenchmarkGetTime();
+
+    for (UINT32 i = 0; i < BENCHMARK_SCRIPTS_PARSE_ITERATIONS; i++)
+    {
+        CodeBuffer = ScriptEngineParse((char *)Expr.c_str());
+
+        if (CodeBuffer->Message != NULL)
+        {
+            printf("err, unable to parse the generated script (%s)\n", CodeBuffer->Message);
+            RemoveSymbolBuffer(CodeBuffer);
+            return FALSE;
+        }
+
+        RemoveSymbolBuffer(CodeBuffer);
+    }
+
+    Time = BenchmarkGetTime() - Start;
+
+    ScriptEngineGetParserStatistics(&CountOfAllocations, &CountOfArenaChunks, &AllocatedBytes);
+
+    printf("\nscript : %llu bytes, %u statements, parses : %u\n"
+           "parser : %llu us per parse (%.2f MB/s)\n"
+           "memory : %u allocations from %u arena chunks (%llu bytes) per parse\n",
+           (UINT64)Expr.size(),
+           Index,
+           BENCHMARK_SCRIPTS_PARSE_ITERATIONS,
+           Time / (BENCHMARK_SCRIPTS_PARSE_ITERATIONS * 1000),
+           ((double)Expr.size() * BENCHMARK_SCRIPTS_PARSE_ITERATIONS * 1000) / (double)(Time + 1),
+           CountOfAllocations,
+           CountOfArenaChunks,
+           AllocatedBytes);
+
+    return TRUE;
+}
+
+/**
+ * @brief Render the result of printf by parsing the format specifiers
+ * each time that it runs (the way printf worked before the parser
+ * precompiled the format specifiers)
+ * @details It's the baseline of the benchmark of printf
+ *
+ * @param GuestRegs
+ * @param VariablesList
+ * @param Format
+ * @param ArgCount
+ * @param FirstArg
+ * @param FinalBuffer
+ * @param SizeOfFinalBuffer
+ *
+ * @return UINT32 Length of the result
+ */
+UINT32
+BenchmarkFormatPrintfByParsing(PGUEST_REGS                    GuestRegs,
+                               SCRIPT_ENGINE_VARIABLES_LIST * VariablesList,
+                               char *                         Format,
+                               UINT64                         ArgCount,
+                               PSYMBOL                        FirstArg,
+                               char *                         FinalBuffer,
+                               UINT32                         SizeOfFinalBuffer)
+{
+    ACTION_BUFFER ActionBuffer                 = {0};
+    UINT32        CurrentPositionInFinalBuffer = 0;
+    UINT32        CurrentPositionInFormat      = 0;
+    UINT32        LenOfFormat                  = (UINT32)strlen(Format);
+    UINT32        Position;
+    UINT32        Length;
+    UINT64        Val;
+    SYMBOL        TempSymbol;
+    CHAR          TempBuffer[50 + 1];
+
+    for (UINT64 i = 0; i < ArgCount; i++)
+    {
+        Position = (UINT32)(FirstArg[i].Type >> SYMBOL_PRINTF_POSITION_SHIFT) & SYMBOL_PRINTF_POSITION_MASK;
+
+        if (Format[Position] != '%' || Position < CurrentPositionInFormat)
+        {
+            continue;
+        }
+
+        memcpy(&TempSymbol, &FirstArg[i], sizeof(SYMBOL));
+        TempSymbol.Type &= 0x7fffffff;
+
+        Val = GetValue(GuestRegs, ActionBuffer, VariablesList, &TempSymbol, FALSE);
+
+        Length = Position - CurrentPositionInFormat;
+
+        if (CurrentPositionInFinalBuffer + Length < SizeOfFinalBuffer)
+        {
+            memcpy(&FinalBuffer[CurrentPositionInFinalBuffer], &Format[CurrentPositionInFormat], Length);
+            CurrentPositionInFinalBuffer += Length;
+        }
+
+        //
+        // Find the specifier
+        //
+        CHAR FormatSpecifier[5] = {0};
+        FormatSpecifier[0]      = '%';
+        FormatSpecifier[1]      = Format[Position + 1];
+
+        if (FormatSpecifier[1] == 'l' || FormatSpecifier[1] == 'w' || FormatSpecifier[1] == 'h')
+        {
+            FormatSpecifier[2] = Format[Position + 2];
+
+            if (FormatSpecifier[1] == 'l' && FormatSpecifier[2] == 'l')
+            {
+                FormatSpecifier[3] = Format[Position + 3];
+            }
+        }
+
+        CurrentPositionInFormat = Position + (UINT32)strlen(FormatSpecifier);
+
+        //
+        // Apply the specifier
+        //
+        if (!strncmp(FormatSpecifier, "%s", 2) || !strncmp(FormatSpecifier, "%ls", 3) || !strncmp(FormatSpecifier, "%ws", 3))
+        {
+            if (!ApplyStringFormatSpecifier(FinalBuffer,
+                                            &CurrentPositionInFinalBuffer,
+                                            Val,
+                                            FormatSpecifier[1] != 's',
+                                            SizeOfFinalBuffer))
+            {
+                return 0;
+            }
+        }
+        else
+        {
+            Length = sprintf(TempBuffer, FormatSpecifier, Val);
+
+            if (CurrentPositionInFinalBuffer + Length < SizeOfFinalBuffer)
+            {
+                memcpy(&FinalBuffer[CurrentPositionInFinalBuffer], TempBuffer, Length);
+                CurrentPositionInFinalBuffer += Length;
+            }
+        }
+    }
+
+    Length = LenOfFormat - CurrentPositionInFormat;
+
+    if (CurrentPositionInFinalBuffer + Length < SizeOfFinalBuffer)
+    {
+        memcpy(&FinalBuffer[CurrentPositionInFinalBuffer], &Format[CurrentPositionInFormat], Length);
+        CurrentPositionInFinalBuffer += Length;
+    }
+
+    FinalBuffer[CurrentPositionInFinalBuffer] = '\0';
+
+    return CurrentPositionInFinalBuffer;
+}
+
+/**
+ * @brief Benchmark of rendering the printf statements of scripts by
+ * parsing their format each time (the baseline) and by the format
+ * specifiers that are precompiled by the parser
+ *
+ * @details The scripts are usually used for tracing the events, @rsi is
+ * a string and @rdi is a wide string. Both of them should render the
+ * same results
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkScriptPrintf(int argc, char * argv[])
+{
+    SCRIPT_ENGINE_VARIABLES_LIST VariablesList                      = {0};
+    ACTION_BUFFER                ActionBuffer                       = {0};
+    GUEST_REGS                   GuestRegs                          = {0};
+    UINT64                       TempList[MAX_TEMP_COUNT]           = {0};
+    UINT64                       GlobalVariables[MAX_VAR_COUNT]     = {0};
+    UINT64                       LocalVariables[MAX_VAR_COUNT]      = {0};
+    char                         ParsingBuffer[PacketChunkSize]     = {0};
+    char                         PrecompiledBuffer[PacketChunkSize] = {0};
+    BOOLEAN                      HasError                           = FALSE;
+    UINT32                       CountOfMismatches                  = 0;
+    BOOLEAN                      Result                             = TRUE;
+    char                         Name[]                             = "hyperdbg-cli.exe";
+    wchar_t                      Path[]                             = L"\\Device\\HarddiskVolume2\\hyperdbg\\hyperdbg-cli.exe";
+    PSYMBOL_BUFFER               CodeBuffer;
+    PSYMBOL                      Format;
+    PSYMBOL                      ArgCount;
+    UINT32                       Length;
+    UINT64                       Start;
+    UINT64                       ParsingTime;
+    UINT64                       PrecompiledTime;
+
+    const char * Scripts[] = {
+        "printf(\"hit\\n\"); ",
+        "printf(\"%llx\\n\", @rax); ",
+        "printf(\"rax: %llx, rbx: %llx, rcx: %llx, rdx: %llx\\n\", @rax, @rbx, @rcx, @rdx); ",
+        "printf(\"pid: %x, tid: %x, core: %x, rsp: %llx\\n\", $pid, $tid, $core, @rsp); ",
+        "printf(\"%d %u %i %o %hx %hd %c%c\\n\", @r8, @r9, @r10, @r11, @r12, @r13, 0x4f, 0x4b); ",
+        "printf(\"process: %s, path: %ws\\n\", @rsi, @rdi); ",
+        "printf(\"syscall %x (%llx, %llx, %llx, %llx) from %s\\n\", @rax, @r10, @rdx, @r8, @r9, @rsi); ",
+    };
+
+    for (UINT32 i = 0; i < 16; i++)
+    {
+        ((PUINT64)&GuestRegs)[i] = 0x1111111111111111ull * i + i;
+    }
+
+    GuestRegs.rsi = (UINT64)Name;
+    GuestRegs.rdi = (UINT64)Path;
+
+    VariablesList.TempList            = TempList;
+    VariablesList.GlobalVariablesList = GlobalVariables;
+    VariablesList.LocalVariablesList  = LocalVariables;
+
+    printf("\n%-8s %10s %16s %16s %10s\n", "script", "length", "parsing (ns)", "precompiled (ns)", "speedup");
+
+    for (UINT32 i = 0; i < sizeof(Scripts) / sizeof(Scripts[0]); i++)
+    {
+        CodeBuffer = ScriptEngineParse((char *)Scripts[i]);
+
+        if (CodeBuffer->Message != NULL || CodeBuffer->Pointer == 0 ||
+            CodeBuffer->Head[0].Type != SYMBOL_SEMANTIC_RULE_TYPE || CodeBuffer->Head[0].Value != FUNC_PRINTF)
+        {
+            printf("err, unable to parse : %s\n", Scripts[i]);
+            RemoveSymbolBuffer(CodeBuffer);
+            Result = FALSE;
+            continue;
+        }
+
+        //
+        // The operator is followed by the format, the count of arguments
+        // and the arguments
+        //
+        Format   = &CodeBuffer->Head[1];
+        ArgCount = &CodeBuffer->Head[2 + (sizeof(unsigned long long) + strlen((char *)&Format->Value)) / sizeof(SYMBOL)];
+
+        //
+        // Both of them should render the same result (it also warms up)
+        //
+        BenchmarkFormatPrintfByParsing(&GuestRegs,
+                                       &VariablesList,
+                                       (char *)&Format->Value,
+                                       ArgCount->Value,
+                                       ArgCount + 1,
+                                       ParsingBuffer,
+                                       sizeof(ParsingBuffer));
+
+        Length = ScriptEngineFormatPrintf(&GuestRegs,
+                                          ActionBuffer,
+                                          &VariablesList,
+                                          (char *)&Format->Value,
+                                          ArgCount->Value,
+                                          ArgCount + 1,
+                                          PrecompiledBuffer,
+                                          sizeof(PrecompiledBuffer),
+                                          &HasError);
+
+        if (HasError)
+        {
+            printf("err, unable to render : %s\n", Scripts[i]);
+            RemoveSymbolBuffer(CodeBuffer);
+            HasError = FALSE;
+            Result   = FALSE;
+            continue;
+        }
+
+        if (strcmp(ParsingBuffer, PrecompiledBuffer) != 0)
+        {
+            printf("err, results of parsing the format and the precompiled format are different for : %s\n", Scripts[i]);
+            CountOfMismatches++;
+        }
+
+        Start = BenchmarkGetTime();
+
+        for (UINT32 j = 0; j < BENCHMARK_SCRIPTS_ITERATIONS; j++)
+        {
+            BenchmarkFormatPrintfByParsing(&GuestRegs,
+                                           &VariablesList,
+                                           (char *)&Format->Value,
+                                           ArgCount->Value,
+                                           ArgCount + 1,
+                                           ParsingBuffer,
+                                           sizeof(ParsingBuffer));
+        }
+
+        ParsingTime = BenchmarkGetTime() - Start;
+
+        Start = BenchmarkGetTime();
+
+        for (UINT32 j = 0; j < BENCHMARK_SCRIPTS_ITERATIONS; j++)
+        {
+            ScriptEngineFormatPrintf(&GuestRegs,
+                                     ActionBuffer,
+                                     &VariablesList,
+                                     (char *)&Format->Value,
+                                     ArgCount->Value,
+                                     ArgCount + 1,
+                                     PrecompiledBuffer,
+                                     sizeof(PrecompiledBuffer),
+                                     &HasError);
+        }
+
+        PrecompiledTime = BenchmarkGetTime() - Start;
+
+        RemoveSymbolBuffer(CodeBuffer);
+
+        printf("%-8u %10u %16.1f %16.1f %10.2f\n",
+               i,
+               Length,
+               (double)ParsingTime / BENCHMARK_SCRIPTS_ITERATIONS,
+               (double)PrecompiledTime / BENCHMARK_SCRIPTS_ITERATIONS,
+               (double)ParsingTime / (double)(PrecompiledTime + 1));
+    }
+
+    printf("\nmismatches : %u\n", CountOfMismatches);
+
+    return Result && CountOfMismatches == 0;
+}
+
+/**
+ * @brief Benchmark of reading and writing the general-purpose registers
+ * (and their parts) by the script engine
+ *
+ * @param argc
+ * @param argv
+ * @return BOOLEAN
+ */
+BOOLEAN
+BenchmarkScriptRegisters(int argc, char * argv[])
+{
+    GUEST_REGS      GuestRegs = {0};
+    SYMBOL          Register  = {0};
+    volatile UINT64 Sum       = 0;
+    UINT64          ReadCycles;
+    UINT64          WriteCycles;
+    UINT64          Start;
+
+    //
+    // All of the aliases of the gp registers (rax, eax, ax, ah, al, ...)
+    //
+    UINT32 CountOfRegisters = REGISTER_R15L + 1;
+
+    for (UINT32 i = 0; i < 16; i++)
+    {
+        ((PUINT64)&GuestRegs)[i] = 0x1111111111111111ull * i + i;
+    }
+
+    Start = __rdtsc();
+
+    for (UINT32 i = 0; i < BENCHMARK_SCRIPTS_REGISTERS_ITERATIONS; i++)
+    {
+        for (UINT32 RegId = 0; RegId <= REGISTER_R15L; RegId++)
+        {
+            Sum += GetRegValue(&GuestRegs, (REGS_ENUM)RegId);
+        }
+    }
+
+    ReadCycles = __rdtsc() - Start;
+
+    Register.Type = SYMBOL_REGISTER_TYPE;
+
+    Start = __rdtsc();
+
+    for (UINT32 i = 0; i < BENCHMARK_SCRIPTS_REGISTERS_ITERATIONS; i++)
+    {
+        for (UINT32 RegId = 0; RegId <= REGISTER_R15L; RegId++)
+        {
+            Register.Value = RegId;
+            SetRegValue(&GuestRegs, &Register, i + RegId);
+        }
+    }
+
+    WriteCycles = __rdtsc() - Start;
+
+    //
+    // The written values should be used, otherwise the compiler
+    // might remove the writes
+    //
+    for (UINT32 i = 0; i < 16; i++)
+    {
+        Sum += ((PUINT64)&GuestRegs)[i];
+    }
+
+    printf("\nregisters : %u, accesses of each register : %u\n"
+           "read  : %.2f cycles per access\n"
+           "write : %.2f cycles per access\n",
+           CountOfRegisters,
+           BENCHMARK_SCRIPTS_REGISTERS_ITERATIONS,
+           (double)ReadCycles / ((double)CountOfRegisters * BENCHMARK_SCRIPTS_REGISTERS_ITERATIONS),
+           (double)WriteCycles / ((double)CountOfRegisters * BENCHMARK_SCRIPTS_REGISTERS_ITERATIONS));
+
+    return TRUE;
+}
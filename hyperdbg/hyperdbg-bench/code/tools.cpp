@@ -0,0 +1,200 @@
+/**
+ * @file tools.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief routines that are shared between benchmarks
+ * @details
+ * @version 0.1
+ * @date 2021-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "..\hyperdbg-bench\pch.h"
+
+//
+// Global Variables
+//
+BOOLEAN          g_BenchmarkCommandFailed    = FALSE;
+volatile BOOLEAN g_BenchmarkCountMessages    = FALSE;
+volatile LONG64  g_BenchmarkReceivedMessages = 0;
+volatile LONG64  g_BenchmarkDroppedMessages  = 0;
+
+/**
+ * @brief Show the messages of HPRDBGCTRL and check for errors
+ *
+ * @details While the messages of a benchmark are counted, the messages
+ * that start with "bench" and the warnings about the dropped messages
+ * are counted instead of being shown
+ *
+ * @param Text The message
+ * @return int
+ */
+int
+BenchmarkMessageHandler(const char * Text)
+{
+    UINT64 CountOfDroppedMessages;
+
+    if (!strncmp(Text, "err", 3))
+    {
+        g_BenchmarkCommandFailed = TRUE;
+    }
+
+    if (g_BenchmarkCountMessages)
+    {
+        if (!strncmp(Text, "bench", 5))
+        {
+            InterlockedIncrement64(&g_BenchmarkReceivedMessages);
+            return 0;
+        }
+
+        if (sscanf_s(Text, "warning, %llu message(s)", &CountOfDroppedMessages) == 1)
+        {
+            InterlockedAdd64(&g_BenchmarkDroppedMessages, CountOfDroppedMessages);
+            return 0;
+        }
+    }
+
+    printf("%s", Text);
+
+    return 0;
+}
+
+/**
+ * @brief Get the current time
+ *
+ * @return UINT64 Time in nanoseconds
+ */
+UINT64
+BenchmarkGetTime()
+{
+    LARGE_INTEGER Frequency;
+    LARGE_INTEGER Counter;
+
+    QueryPerformanceFrequency(&Frequency);
+    QueryPerformanceCounter(&Counter);
+
+    return (UINT64)((Counter.QuadPart * 1000000000.0) / Frequency.QuadPart);
+}
+
+/**
+ * @brief Run a command of HyperDbg
+ *
+ * @param Command The command
+ * @return BOOLEAN TRUE if the command didn't show any error
+ */
+BOOLEAN
+BenchmarkRunCommand(const char * Command)
+{
+    string CommandString(Command);
+
+    g_BenchmarkCommandFailed = FALSE;
+
+    HyperdbgInterpreter((char *)CommandString.c_str());
+
+    return !g_BenchmarkCommandFailed;
+}
+
+/**
+ * @brief Connect to the local system and load the vmm module
+ *
+ * @return BOOLEAN TRUE if the vmm module is loaded
+ */
+BOOLEAN
+BenchmarkLoadVmm()
+{
+    HyperdbgSetTextMessageCallback(BenchmarkMessageHandler);
+
+    if (!BenchmarkRunCommand(".connect local") || !BenchmarkRunCommand("load vmm"))
+    {
+        printf("err, unable to load the vmm module\n");
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Clear the events and unload the vmm module
+ *
+ * @return VOID
+ */
+VOID
+BenchmarkUnloadVmm()
+{
+    BenchmarkRunCommand("events c all");
+    BenchmarkRunCommand("unload vmm");
+}
+
+/**
+ * @brief Run the current thread only on a special core
+ *
+ * @param CoreIndex Index of the core
+ * @return BOOLEAN TRUE if the affinity is changed
+ */
+BOOLEAN
+BenchmarkPinToCore(UINT32 CoreIndex)
+{
+    if (SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << CoreIndex) == 0)
+    {
+        printf("err, unable to run the benchmark on core %x (%x)\n", CoreIndex, GetLastError());
+        return FALSE;
+    }
+
+    //
+    // Make sure that the thread is moved to the target core
+    //
+    Sleep(0);
+
+    return TRUE;
+}
+
+/**
+ * @brief Allocate a buffer that stays in the physical memory
+ *
+ * @param Size Size of the buffer
+ * @return PBYTE The buffer (filled with zeros) or NULL if it's not allocated
+ */
+PBYTE
+BenchmarkAllocateLockedBuffer(SIZE_T Size)
+{
+    PBYTE Buffer;
+
+    Buffer = (PBYTE)VirtualAlloc(NULL, Size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+
+    if (Buffer == NULL)
+    {
+        printf("err, unable to allocate the buffer (%x)\n", GetLastError());
+        return NULL;
+    }
+
+    //
+    // The working set should be large enough to lock the buffer
+    //
+    SetProcessWorkingSetSize(GetCurrentProcess(), Size * 2, Size * 4);
+
+    if (!VirtualLock(Buffer, Size))
+    {
+        printf("err, unable to lock the buffer (%x)\n", GetLastError());
+        VirtualFree(Buffer, 0, MEM_RELEASE);
+        return NULL;
+    }
+
+    RtlZeroMemory(Buffer, Size);
+
+    return Buffer;
+}
+
+/**
+ * @brief Unlock and free a buffer that is allocated by
+ * BenchmarkAllocateLockedBuffer
+ *
+ * @param Buffer The buffer
+ * @param Size Size of the buffer
+ * @return VOID
+ */
+VOID
+BenchmarkFreeLockedBuffer(PBYTE Buffer, SIZE_T Size)
+{
+    VirtualUnlock(Buffer, Size);
+    VirtualFree(Buffer, 0, MEM_RELEASE);
+}
@@ -0,0 +1,681 @@
+/**
+ * @file benchmarks.h
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief headers of the benchmarks of HyperDbg
+ * @details
+ * @version 0.1
+ * @date 2021-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//					Constants					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Size of a page
+ *
+ */
+#define BENCHMARK_PAGE_SIZE 0x1000
+
+/**
+ * @brief Count of cpuid instructions that are executed in each
+ * measurement of the benchmark of the dispatch index
+ *
+ */
+#define BENCHMARK_DISPATCH_CPUID_ITERATIONS 200000
+
+/**
+ * @brief Count of triggers that are measured for each count of events
+ * in the user-mode benchmark of the dispatch index
+ *
+ */
+#define BENCHMARK_DISPATCH_INDEX_TRIGGERS 1000000
+
+/**
+ * @brief Maximum count of events of the same type in the user-mode
+ * benchmark of the dispatch index
+ *
+ */
+#define BENCHMARK_DISPATCH_INDEX_MAXIMUM_EVENTS 256
+
+/**
+ * @brief The MSR that is read in the user-mode benchmark of the
+ * dispatch index (IA32_EFER)
+ *
+ */
+#define BENCHMARK_DISPATCH_INDEX_MSR 0xc0000080
+
+/**
+ * @brief The first physical address of the monitored ranges in the
+ * user-mode benchmark of the dispatch index
+ *
+ */
+#define BENCHMARK_DISPATCH_INDEX_ADDRESS 0x100000
+
+/**
+ * @brief Count of reads from a monitored page that are executed in each
+ * measurement of the benchmark of range events
+ *
+ */
+#define BENCHMARK_RANGES_READ_ITERATIONS 20000
+
+/**
+ * @brief Maximum count of monitored pages in the benchmark of range events
+ *
+ */
+#define BENCHMARK_RANGES_MAXIMUM_PAGES 4096
+
+/**
+ * @brief Count of calls to a hooked function that are executed in each
+ * measurement of the benchmark of EPT hooks
+ *
+ */
+#define BENCHMARK_EPTHOOKS_CALL_ITERATIONS 20000
+
+/**
+ * @brief Maximum count of hooked pages in the benchmark of EPT hooks
+ *
+ */
+#define BENCHMARK_EPTHOOKS_MAXIMUM_PAGES 128
+
+/**
+ * @brief Count of slots of the hash table in the test of the hash
+ * tables of hooked pages
+ *
+ */
+#define BENCHMARK_HOOKS_TABLE_SLOTS 64
+
+/**
+ * @brief Count of keys that are added and removed while the table is
+ * read in the test of the hash tables of hooked pages, half of the keys
+ * start in the first BENCHMARK_HOOKS_TABLE_CROWDED_SLOTS slots
+ *
+ */
+#define BENCHMARK_HOOKS_TABLE_KEYS 128
+
+/**
+ * @brief Maximum count of keys that are in the table at the same time
+ * in the test of the hash tables of hooked pages
+ *
+ */
+#define BENCHMARK_HOOKS_TABLE_MAXIMUM_ADDED_KEYS 24
+
+/**
+ * @brief Count of slots that half of the keys start in the test of the
+ * hash tables of hooked pages
+ *
+ */
+#define BENCHMARK_HOOKS_TABLE_CROWDED_SLOTS 8
+
+/**
+ * @brief Count of adding and removing keys while the table is read in
+ * the test of the hash tables of hooked pages
+ *
+ */
+#define BENCHMARK_HOOKS_TABLE_CHANGES 20000000
+
+/**
+ * @brief Default count of rounds of applying and clearing an event in
+ * the benchmark of the pool manager
+ *
+ */
+#define BENCHMARK_POOLS_ROUNDS 0x100
+
+/**
+ * @brief Count of simulated cores (caches) in the test of the free lists
+ * and the caches of the pool manager
+ *
+ */
+#define BENCHMARK_POOL_CACHES_CORES 4
+
+/**
+ * @brief Count of threads in the test of the free lists and the caches of
+ * the pool manager, two threads share the cache of each core, the same as
+ * a thread that is moved to another core in vmx non-root
+ *
+ */
+#define BENCHMARK_POOL_CACHES_THREADS 8
+
+/**
+ * @brief Count of pools of each intention in the test of the free lists
+ * and the caches of the pool manager
+ *
+ */
+#define BENCHMARK_POOL_CACHES_POOLS 8
+
+/**
+ * @brief Maximum count of pools that each thread keeps before freeing
+ * them in the test of the free lists and the caches of the pool manager
+ *
+ */
+#define BENCHMARK_POOL_CACHES_HELD_POOLS 4
+
+/**
+ * @brief Count of pools that each thread requests in the test of the
+ * free lists and the caches of the pool manager
+ *
+ */
+#define BENCHMARK_POOL_CACHES_REQUESTS 200000
+
+/**
+ * @brief Count of cpuid instructions that each thread executes in the
+ * benchmark of logging
+ *
+ */
+#define BENCHMARK_LOGGING_CPUID_ITERATIONS 100000
+
+/**
+ * @brief Interval of checking whether user-mode still receives the
+ * messages of the benchmark of logging (in milliseconds)
+ *
+ */
+#define BENCHMARK_LOGGING_DRAIN_INTERVAL 500
+
+/**
+ * @brief Default length of messages (with the new line) in the benchmark
+ * of logging
+ *
+ */
+#define BENCHMARK_LOGGING_DEFAULT_MESSAGE_LENGTH 0x10
+
+/**
+ * @brief Minimum length of messages in the benchmark of logging
+ * ("bench", at least one padding character and a new line)
+ *
+ */
+#define BENCHMARK_LOGGING_MINIMUM_MESSAGE_LENGTH 0x7
+
+/**
+ * @brief Maximum length of messages in the benchmark of logging
+ *
+ */
+#define BENCHMARK_LOGGING_MAXIMUM_MESSAGE_LENGTH 0x400
+
+/**
+ * @brief Count of messages that each writer writes in the benchmark of
+ * the log buffers
+ *
+ */
+#define BENCHMARK_RINGS_MESSAGES_PER_WRITER 1000000
+
+/**
+ * @brief Size of the buffer of each writer in the benchmark of the log
+ * buffers
+ *
+ */
+#define BENCHMARK_RINGS_BUFFER_SIZE 0x10000
+
+/**
+ * @brief Default length of messages in the benchmark of the log buffers
+ *
+ */
+#define BENCHMARK_RINGS_DEFAULT_MESSAGE_LENGTH 0x40
+
+/**
+ * @brief Count of messages that are written in the benchmark of the
+ * doorbell of the log buffers
+ *
+ */
+#define BENCHMARK_DOORBELL_MESSAGES 200000
+
+/**
+ * @brief Maximum count of messages that are written at once in the
+ * benchmark of the doorbell of the log buffers
+ *
+ */
+#define BENCHMARK_DOORBELL_MAXIMUM_BURST 16
+
+/**
+ * @brief Maximum count of pause instructions between the bursts of
+ * messages in the benchmark of the doorbell of the log buffers
+ *
+ */
+#define BENCHMARK_DOORBELL_MAXIMUM_PAUSE 0x1000
+
+/**
+ * @brief Time that the reader waits for the doorbell in the benchmark
+ * of the doorbell of the log buffers (in milliseconds), the writer
+ * never stops for this long, so a timeout while there are unread
+ * messages is a missed doorbell
+ *
+ */
+#define BENCHMARK_DOORBELL_TIMEOUT 50
+
+/**
+ * @brief Count of missed doorbells that stops the benchmark of the
+ * doorbell of the log buffers
+ *
+ */
+#define BENCHMARK_DOORBELL_MAXIMUM_MISSED 0x10
+
+/**
+ * @brief Time of reading messages by each reader in the benchmark of
+ * reading batches of log messages (in milliseconds)
+ *
+ */
+#define BENCHMARK_BATCH_DURATION 1000
+
+/**
+ * @brief Count of running each of the script engine test cases by each
+ * engine in the benchmark of scripts (and each of the printf statements
+ * in the benchmark of printf)
+ *
+ */
+#define BENCHMARK_SCRIPTS_ITERATIONS 1000
+
+/**
+ * @brief Size of the generated script in the benchmark of the parser
+ * of the script engine
+ *
+ */
+#define BENCHMARK_SCRIPTS_PARSE_SCRIPT_SIZE 0x10000
+
+/**
+ * @brief Count of parsing the generated script in the benchmark of the
+ * parser of the script engine
+ *
+ */
+#define BENCHMARK_SCRIPTS_PARSE_ITERATIONS 10
+
+/**
+ * @brief Count of reading and writing each of the registers in the
+ * benchmark of the registers of the script engine
+ *
+ */
+#define BENCHMARK_SCRIPTS_REGISTERS_ITERATIONS 100000
+
+/**
+ * @brief Count of packets that are sent in the benchmark of receiving
+ * packets
+ *
+ */
+#define BENCHMARK_RECEIVE_COUNT_OF_PACKETS 2000
+
+/**
+ * @brief Size of the packets (without the end of buffer or the header
+ * of frames) that are sent in the benchmark of receiving packets
+ *
+ */
+#define BENCHMARK_RECEIVE_PACKET_SIZE 0x200
+
+/**
+ * @brief Size of the memory that is read in the benchmark of the link
+ * to the debuggee
+ *
+ */
+#define BENCHMARK_LINK_READ_SIZE 0x10000
+
+/**
+ * @brief Address of the memory that is read in the benchmark of the
+ * link to the debuggee (the simulated debuggee accepts any address)
+ *
+ */
+#define BENCHMARK_LINK_ADDRESS 0xfffff80000000000
+
+/**
+ * @brief Default one-way latency (microseconds) of the link to the
+ * simulated debuggee
+ *
+ */
+#define BENCHMARK_LINK_DEFAULT_LATENCY 1000
+
+/**
+ * @brief Default baud rate of the link to the simulated debuggee
+ *
+ */
+#define BENCHMARK_LINK_DEFAULT_BAUDRATE CBR_115200
+
+/**
+ * @brief Maximum count of requests that the simulated debuggee keeps
+ * before answering them
+ *
+ */
+#define BENCHMARK_LINK_MAXIMUM_QUEUED_REQUESTS 0x20
+
+//////////////////////////////////////////////////
+//					Structures					//
+//////////////////////////////////////////////////
+
+/**
+ * @brief Routine of a benchmark
+ *
+ */
+typedef BOOLEAN (*BenchmarkRoutine)(int argc, char * argv[]);
+
+/**
+ * @brief A benchmark that can be selected from the command line
+ *
+ */
+typedef struct _BENCHMARK_ENTRY
+{
+    const char *     Name;
+    const char *     Description;
+    BOOLEAN          NeedsVmm; // the vmm module is loaded before running the benchmark
+    BenchmarkRoutine Routine;
+
+} BENCHMARK_ENTRY, *PBENCHMARK_ENTRY;
+
+/**
+ * @brief Result of receiving the packets by one way of reading in the
+ * benchmark of receiving packets
+ *
+ */
+typedef struct _BENCHMARK_RECEIVE_RESULT
+{
+    UINT64 Time;          // nanoseconds
+    UINT32 CountOfReads;  // count of calls to ReadFile
+    UINT32 CountOfErrors; // packets that are not received correctly
+
+} BENCHMARK_RECEIVE_RESULT, *PBENCHMARK_RECEIVE_RESULT;
+
+/**
+ * @brief Details of the thread that sends the packets in the benchmark
+ * of receiving packets
+ *
+ */
+typedef struct _BENCHMARK_RECEIVE_SENDER
+{
+    HANDLE  PipeHandle;
+    UINT32  CountOfPackets;
+    UINT32  PacketSize;
+    BOOLEAN IsFramed;
+
+} BENCHMARK_RECEIVE_SENDER, *PBENCHMARK_RECEIVE_SENDER;
+
+/**
+ * @brief A read memory request that is received by the simulated
+ * debuggee in the benchmark of the link
+ *
+ */
+typedef struct _BENCHMARK_LINK_REQUEST
+{
+    UINT64               ReadyTime; // nanoseconds, the response is not sent before it
+    UINT32               SequenceNumber;
+    DEBUGGER_READ_MEMORY ReadMem;
+
+} BENCHMARK_LINK_REQUEST, *PBENCHMARK_LINK_REQUEST;
+
+/**
+ * @brief State of the simulated debuggee in the benchmark of the link
+ *
+ */
+typedef struct _BENCHMARK_LINK
+{
+    HANDLE                 PipeHandle;
+    UINT64                 Latency;  // one-way latency (nanoseconds)
+    UINT32                 Baudrate; // each byte is sent in 10 bits
+    HANDLE                 RunningEvent;
+    HANDLE                 QueueSemaphore;
+    volatile LONG          Head; // index of the next request that is answered
+    volatile LONG          Tail; // index of the next request that is received
+    volatile BOOLEAN       IsClosed;
+    volatile BOOLEAN       IsPaused;
+    UINT32                 CountOfRequests;
+    UINT32                 MaximumRequestsInFlight;
+    BENCHMARK_LINK_REQUEST Requests[BENCHMARK_LINK_MAXIMUM_QUEUED_REQUESTS];
+
+} BENCHMARK_LINK, *PBENCHMARK_LINK;
+
+/**
+ * @brief Result of reading the memory of the simulated debuggee in the
+ * benchmark of the link
+ *
+ */
+typedef struct _BENCHMARK_LINK_RESULT
+{
+    UINT64 Time; // nanoseconds
+    UINT32 CountOfRequests;
+    UINT32 MaximumRequestsInFlight;
+
+} BENCHMARK_LINK_RESULT, *PBENCHMARK_LINK_RESULT;
+
+/**
+ * @brief Result of compressing the responses of reading memory in the
+ * benchmark of compression
+ *
+ */
+typedef struct _BENCHMARK_COMPRESSION_RESULT
+{
+    UINT64 Size;              // bytes that are sent without compression (including the headers)
+    UINT64 CompressedSize;    // bytes that are sent with compression (including the headers)
+    UINT64 CompressionTime;   // nanoseconds
+    UINT64 DecompressionTime; // nanoseconds
+    UINT32 CountOfErrors;     // packets that are not decompressed correctly
+
+} BENCHMARK_COMPRESSION_RESULT, *PBENCHMARK_COMPRESSION_RESULT;
+
+/**
+ * @brief A hooked page in the test of the hash tables of hooked pages
+ *
+ */
+typedef struct _BENCHMARK_HOOKS_TABLE_ENTRY
+{
+    UINT64 Key;
+
+} BENCHMARK_HOOKS_TABLE_ENTRY, *PBENCHMARK_HOOKS_TABLE_ENTRY;
+
+/**
+ * @brief A reader in the test of the hash tables of hooked pages
+ *
+ */
+typedef struct _BENCHMARK_HOOKS_TABLE_READER
+{
+    PEPT_HOOKED_PAGES_TABLE Table;
+    UINT64 *                Keys;
+    UINT32                  CoreIndex;
+    volatile LONG *         IsStopped;
+    UINT64                  CountOfLookups;
+    UINT64                  CountOfMismatches; // hooked pages that are found for another key
+
+} BENCHMARK_HOOKS_TABLE_READER, *PBENCHMARK_HOOKS_TABLE_READER;
+
+/**
+ * @brief The buffer of a pool in the test of the free lists and the
+ * caches of the pool manager
+ *
+ */
+typedef struct _BENCHMARK_POOL_CACHES_BUFFER
+{
+    volatile LONG Owner; // index of the thread that has the pool + 1, zero if the pool is not given
+    UINT32        Reserved;
+
+} BENCHMARK_POOL_CACHES_BUFFER, *PBENCHMARK_POOL_CACHES_BUFFER;
+
+/**
+ * @brief A thread in the test of the free lists and the caches of the
+ * pool manager
+ *
+ */
+typedef struct _BENCHMARK_POOL_CACHES_WORKER
+{
+    UINT32 ThreadIndex;
+    UINT32 CoreIndex;
+    UINT64 CountOfFailures; // requests that no pool was given
+    UINT64 CountOfErrors;   // pools that are given twice, of another intention or not freed correctly
+
+} BENCHMARK_POOL_CACHES_WORKER, *PBENCHMARK_POOL_CACHES_WORKER;
+
+/**
+ * @brief The start of each message in the benchmark of the log buffers
+ *
+ */
+typedef struct _BENCHMARK_RINGS_MESSAGE
+{
+    UINT32 WriterIndex;
+    UINT32 Reserved;
+    UINT64 SequenceNumber;
+
+} BENCHMARK_RINGS_MESSAGE, *PBENCHMARK_RINGS_MESSAGE;
+
+/**
+ * @brief Details of a writer in the benchmark of the log buffers
+ *
+ */
+typedef struct _BENCHMARK_RINGS_WRITER
+{
+    PLOG_BUFFER_INFORMATION BufferInformation; // the buffer of the writer (like the buffer of a core)
+    UINT32                  WriterIndex;
+    UINT32                  MessageLength;
+    volatile LONG *         CountOfRunningWriters;
+
+} BENCHMARK_RINGS_WRITER, *PBENCHMARK_RINGS_WRITER;
+
+/**
+ * @brief Messages of a writer that are received by the reader in the
+ * benchmark of the log buffers
+ *
+ */
+typedef struct _BENCHMARK_RINGS_RECEIVED
+{
+    UINT64 CountOfMessages;
+    UINT64 CountOfMissedMessages; // gaps in the sequence numbers
+    UINT64 NextSequenceNumber;
+    UINT64 CountOfErrors;         // messages that are out of order or corrupted
+
+} BENCHMARK_RINGS_RECEIVED, *PBENCHMARK_RINGS_RECEIVED;
+
+/**
+ * @brief State of the benchmark of the doorbell of the log buffers
+ * @details The writer is the kernel and the reader is the thread of
+ * the debugger that reads the buffers that are mapped to user-mode
+ *
+ */
+typedef struct _BENCHMARK_DOORBELL
+{
+    PLOG_SHARED_BUFFERS_HEADER Header;
+    PLOG_SHARED_READER_PAGE    ReaderPage;
+    CHAR *                     Buffers;
+    LOG_BUFFER_INFORMATION     BufferInformation[2]; // a vmx non-root and a vmx-root buffer
+    BENCHMARK_RINGS_RECEIVED   Received[2];
+    HANDLE                     DoorbellEvent;
+    volatile LONG              IsWriterRunning;
+    volatile BOOLEAN           IsStopped; // the reader missed too many doorbells
+    UINT64                     CountOfRings;
+
+} BENCHMARK_DOORBELL, *PBENCHMARK_DOORBELL;
+
+/**
+ * @brief The writer of the benchmark of reading batches of log messages
+ *
+ */
+typedef struct _BENCHMARK_BATCH_WRITER
+{
+    PLOG_BUFFER_INFORMATION BufferInformation;
+    UINT32                  MessageLength;
+    volatile LONG           IsStopped;
+    UINT64                  CountOfMessages; // written and dropped messages
+
+} BENCHMARK_BATCH_WRITER, *PBENCHMARK_BATCH_WRITER;
+
+/**
+ * @brief A way of reading messages in the benchmark of reading batches
+ * of log messages
+ *
+ */
+typedef struct _BENCHMARK_BATCH_READER
+{
+    const char * Description;
+    BOOLEAN      IsBatched;  // LogReadBufferBatch instead of LogReadBuffer
+    BOOLEAN      IsSleeping; // sleep before each read (DefaultSpeedOfReadingKernelMessages)
+
+} BENCHMARK_BATCH_READER, *PBENCHMARK_BATCH_READER;
+
+//////////////////////////////////////////////////
+//				Global Variables				//
+//////////////////////////////////////////////////
+
+extern volatile BOOLEAN g_BenchmarkCountMessages;
+extern volatile LONG64  g_BenchmarkReceivedMessages;
+extern volatile LONG64  g_BenchmarkDroppedMessages;
+
+//////////////////////////////////////////////////
+//					 Imports					//
+//////////////////////////////////////////////////
+
+extern "C" {
+__declspec(dllimport) int HyperdbgInterpreter(char * Command);
+__declspec(dllimport) void HyperdbgSetTextMessageCallback(Callback handler);
+}
+
+//////////////////////////////////////////////////
+//					Functions					//
+//////////////////////////////////////////////////
+
+UINT64
+BenchmarkGetTime();
+
+BOOLEAN
+BenchmarkRunCommand(const char * Command);
+
+BOOLEAN
+BenchmarkLoadVmm();
+
+VOID
+BenchmarkUnloadVmm();
+
+BOOLEAN
+BenchmarkPinToCore(UINT32 CoreIndex);
+
+PBYTE
+BenchmarkAllocateLockedBuffer(SIZE_T Size);
+
+VOID
+BenchmarkFreeLockedBuffer(PBYTE Buffer, SIZE_T Size);
+
+BOOLEAN
+BenchmarkEventDispatch(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkDispatchIndex(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkRangeEvents(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkEptHooks(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkHooksTable(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkPoolManager(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkPoolCaches(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkLogging(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkLogRings(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkLogDoorbell(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkLogBatch(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkReceive(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkLink(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkCompression(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkScripts(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkScriptParser(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkScriptPrintf(int argc, char * argv[]);
+
+BOOLEAN
+BenchmarkScriptRegisters(int argc, char * argv[]);
@@ -0,0 +1,40 @@
+/**
+ * @file pch.h
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief pre-compiled headers
+ * @details
+ * @version 0.1
+ * @date 2021-10-18
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//
+// General Headers
+//
+#include <Windows.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <intrin.h>
+#include <psapi.h>
+#include <shlwapi.h>
+
+//
+// Program Defined Headers
+//
+#include "ScriptEngineCommonDefinitions.h"
+#include "Definition.h"
+#include "KdReceive.h"
+#include "..\hyperdbg-bench\header\benchmarks.h"
+
+using namespace std;
+
+//
+// For GetModuleFileNameExA and PathFindFileNameA of the script engine
+//
+#pragma comment(lib, "Psapi.lib")
+#pragma comment(lib, "Shlwapi.lib")
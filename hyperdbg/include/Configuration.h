@@ -41,6 +41,22 @@
  */
 #define ShowMessagesOnDebugger FALSE
 
+/**
+ * @brief Map the log buffers to the usermode app and read them directly
+ * instead of reading each message by an IOCTL, it works only if you set
+ * UseDbgPrintInsteadOfUsermodeMessageTracking to FALSE
+ */
+#define UseSharedMemoryForMessageTracking TRUE
+
+/**
+ * @brief Translate the bytecode of scripts to the native code (x86-64) and
+ * run the native code instead of the bytecode when the events are triggered
+ * @details The native code is emitted to non-executable pages, then the
+ * pages are changed to read-only and executable, it's not compatible
+ * with HVCI
+ */
+#define UseJitForScripts FALSE
+
 /**
  * @brief Use immediate messaging (means that it sends each message when they
  * received and do not accumulate them) it works only if you set
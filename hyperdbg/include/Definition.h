@@ -31,7 +31,8 @@
 
 /**
  * @brief Default buffer count of packets for message tracing
- * @details number of packets storage
+ * @details number of packets storage (if all the packets have
+ * the maximum size), see LogBufferSize
  */
 #define MaximumPacketsCapacity 1000
 
@@ -51,6 +52,14 @@
  */
 #define UsermodeBufferSize sizeof(UINT32) + PacketChunkSize + 1
 
+/**
+ * @brief size of user-mode buffer for reading a batch of messages
+ * @details it should be able to hold at least one message with the
+ * maximum size (LOG_BATCH_MESSAGE_SIZE(PacketChunkSize))
+ *
+ */
+#define UsermodeBatchBufferSize (32 * (sizeof(UINT32) + PacketChunkSize + 1))
+
 /**
  * @brief size of buffer for serial
  * @details the maximum packet size for sending over serial
@@ -63,10 +72,13 @@
 
 /**
  * @brief Final storage size of message tracing
+ * @details size of each pool (vmx-root and vmx non-root), it's shared
+ * between the buffers of cores, messages are saved as variable-length
+ * records so a message only takes its actual length (plus its header)
  *
  */
 #define LogBufferSize \
-    MaximumPacketsCapacity *(PacketChunkSize + sizeof(BUFFER_HEADER))
+    (MaximumPacketsCapacity * (PacketChunkSize + sizeof(BUFFER_HEADER)))
 
 /**
  * @brief limitation of Windows DbgPrint message size
@@ -197,6 +209,12 @@
 #define OPERATION_COMMAND_FROM_DEBUGGER_RELOAD_SYMBOL \
     0xD | OPERATION_MANDATORY_DEBUGGEE_BIT
 
+/**
+ * @brief Binary records of printf (deferred formatting), the record is
+ * rendered in user-mode by using the formats of the script of the event
+ */
+#define OPERATION_LOG_EVENT_RECORD 0xE
+
 //////////////////////////////////////////////////
 //				   Test Cases                   //
 //////////////////////////////////////////////////
@@ -211,6 +229,18 @@
  */
 #define SCRIPT_TEST_CASE_FILE_NAME "script-test-cases.txt"
 
+/**
+ * @brief Maximum count of aggregation maps (map_count, map_sum, map_min,
+ * map_max and map_hist functions) in the script engine
+ */
+#define SCRIPT_ENGINE_AGGREGATION_MAXIMUM_MAPS 8
+
+/**
+ * @brief Count of the entries (keys) of each aggregation map, it should
+ * be a power of two
+ */
+#define SCRIPT_ENGINE_AGGREGATION_MAP_ENTRIES 256
+
 /**
  * @brief Maximum test cases to communicate between debugger and debuggee process
  */
@@ -258,6 +288,8 @@
 #define DEBUGGER_SYNCRONIZATION_OBJECT_READ_MEMORY                         0xf
 #define DEBUGGER_SYNCRONIZATION_OBJECT_EDIT_MEMORY                         0x10
 #define DEBUGGER_SYNCRONIZATION_OBJECT_SYMBOL_RELOAD                       0x11
+#define DEBUGGER_SYNCRONIZATION_OBJECT_PIPELINED_REQUESTS                  0x12
+#define DEBUGGER_SYNCRONIZATION_OBJECT_QUERY_AGGREGATION_MAPS              0x13
 
 //////////////////////////////////////////////////
 //            End of Buffer Detection           //
@@ -277,6 +309,91 @@
 #define SERIAL_END_OF_BUFFER_CHAR_3 0xEE
 #define SERIAL_END_OF_BUFFER_CHAR_4 0xFF
 
+//////////////////////////////////////////////////
+//             Framing Of Serial Packets        //
+//////////////////////////////////////////////////
+
+/**
+ * @brief packets are delimited by the end of buffer characters and
+ * checked by an 8-bit checksum (compatible with previous versions)
+ */
+#define SERIAL_FRAMING_VERSION_END_OF_BUFFER 1
+
+/**
+ * @brief packets start with a header which contains their length
+ * and their CRC32 (Castagnoli)
+ */
+#define SERIAL_FRAMING_VERSION_LENGTH_AND_CRC32 2
+
+/**
+ * @brief packets are framed and the responses carry the sequence number
+ * of their requests, so the debugger sends several requests before
+ * receiving their responses
+ */
+#define SERIAL_FRAMING_VERSION_SEQUENCE_NUMBERS 3
+
+/**
+ * @brief packets of the debuggee are sent in compressed frames if the
+ * debugger requests it by DEBUGGER_REMOTE_PACKET_FLAG_COMPRESSED_FRAMES
+ */
+#define SERIAL_FRAMING_VERSION_COMPRESSION 4
+
+/**
+ * @brief the latest framing version that is supported
+ */
+#define SERIAL_FRAMING_VERSION_LATEST SERIAL_FRAMING_VERSION_COMPRESSION
+
+/**
+ * @brief signature of the header of framed packets, the second to
+ * fourth bytes of packets with the end of buffer are never the same
+ */
+#define SERIAL_FRAME_SIGNATURE 0x32464448 // HDF2
+
+/**
+ * @brief signature of the header of compressed frames, the packet
+ * starts with its length (UINT32) and it's followed by the compressed
+ * block, the length and the CRC32 of the header are for both of them
+ */
+#define SERIAL_FRAME_SIGNATURE_COMPRESSED 0x5A464448 // HDFZ
+
+/**
+ * @brief header of framed packets (SERIAL_FRAMING_VERSION_LENGTH_AND_CRC32)
+ */
+typedef struct _SERIAL_FRAME_HEADER
+{
+    UINT32 Signature;
+    UINT32 Length; // length of the packet after the header
+    UINT32 Crc32;  // CRC32 of the packet after the header
+
+} SERIAL_FRAME_HEADER, *PSERIAL_FRAME_HEADER;
+
+/**
+ * @brief maximum count of requests that the debugger sends to the
+ * debuggee without receiving their responses
+ */
+#define SERIAL_MAXIMUM_PIPELINED_REQUESTS 4
+
+/**
+ * @brief maximum size of memory that is read by one request, larger
+ * reads are split into pipelined requests
+ */
+#define SERIAL_READ_MEMORY_CHUNK_SIZE 0x800
+
+/**
+ * @brief packets that are smaller than this size are not compressed
+ */
+#define SERIAL_COMPRESSION_MINIMUM_SIZE 0x40
+
+/**
+ * @brief count of bits of the hash of sequences in the compressor
+ */
+#define SERIAL_COMPRESSION_HASH_BITS 12
+
+/**
+ * @brief count of entries of the hash table of the compressor
+ */
+#define SERIAL_COMPRESSION_HASH_TABLE_SIZE (1 << SERIAL_COMPRESSION_HASH_BITS)
+
 /**
  * @brief count of characters for tcp end of buffer
  */
@@ -592,6 +709,7 @@ typedef struct _DEBUGGER_GENERAL_ACTION
     UINT64                          EventTag;
     DEBUGGER_EVENT_ACTION_TYPE_ENUM ActionType;
     BOOLEAN                         ImmediateMessagePassing;
+    BOOLEAN                         DeferredFormatting; // printf sends binary records
     UINT32                          PreAllocatedBuffer;
 
     UINT32 CustomCodeBufferSize;
@@ -695,6 +813,7 @@ typedef enum _DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION
     DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_BP,
     DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_LIST_OR_MODIFY_BREAKPOINTS,
     DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_SYMBOL_RELOAD,
+    DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_ON_VMX_ROOT_QUERY_AGGREGATION_MAPS,
 
     //
     // Debuggee to debugger
@@ -718,6 +837,7 @@ typedef enum _DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION
     DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_LIST_OR_MODIFY_BREAKPOINTS,
     DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_UPDATE_SYMBOL_INFO,
     DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RELOAD_SYMBOL_FINISHED,
+    DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION_DEBUGGEE_RESULT_OF_QUERYING_AGGREGATION_MAPS,
 
 } DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION;
 
@@ -733,7 +853,8 @@ typedef enum _DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION
 typedef enum _NOTIFY_TYPE
 {
     IRP_BASED,
-    EVENT_BASED
+    EVENT_BASED,
+    IRP_BASED_BATCHED
 } NOTIFY_TYPE;
 
 typedef struct _REGISTER_NOTIFY_BUFFER
@@ -743,6 +864,360 @@ typedef struct _REGISTER_NOTIFY_BUFFER
 
 } REGISTER_NOTIFY_BUFFER, *PREGISTER_NOTIFY_BUFFER;
 
+/* ==============================================================================================
+ */
+
+/**
+ * @brief Header of a message in the log buffers
+ *
+ */
+typedef struct _BUFFER_HEADER
+{
+    UINT32 OpeationNumber; // Operation ID to user-mode
+    UINT32 BufferLength;   // The actual length, zero means skip to the start of the buffer
+    UINT64 TimeStamp;      // Used to merge the messages of different cores in their original order
+} BUFFER_HEADER, *PBUFFER_HEADER;
+
+/**
+ * @brief Size of a record in the log buffers
+ * @details The body of the record is followed by a null-terminator and
+ * records are aligned to the size of BUFFER_HEADER so there is always
+ * enough space for a header at the end of the buffer
+ *
+ */
+#define LOG_RECORD_SIZE(BufferLength) \
+    ((sizeof(BUFFER_HEADER) + (BufferLength) + sizeof(BUFFER_HEADER)) & ~(sizeof(BUFFER_HEADER) - 1))
+
+/**
+ * @brief Core-specific buffers
+ *
+ * @details Each core has one buffer for vmx-root and one buffer for vmx
+ * non-root messages, the owner core is the only writer of the buffer (in
+ * vmx non-root, the IRQL is raised to DISPATCH_LEVEL while writing) so
+ * writers never acquire a lock, readers are serialized (LogReaderLock)
+ *
+ * Offsets are counts of bytes that are written to (or read from) the
+ * buffer since the initialization, the position in the buffer is the
+ * offset modulo BufferSize, they are only changed by the kernel and if
+ * the buffers are mapped to user-mode, the offset to write is copied to
+ * the control page and the read offset of user-mode is checked before
+ * it's used as the offset to send
+ *
+ */
+typedef struct _LOG_BUFFER_INFORMATION
+{
+    UINT64 BufferStartAddress; // Start address of the buffer
+    UINT64 BufferEndAddress;   // End address of the buffer
+
+    UINT64 BufferForMultipleNonImmediateMessage; // Start address of the buffer for accumulating non-immadiate messages
+    UINT32 CurrentLengthOfNonImmBuffer;          // the current size of the buffer for accumulating non-immadiate messages
+
+    volatile UINT64 CurrentOffsetToSend;  // Offset of the next record to send to user-mode (only changed by readers)
+    volatile UINT64 CurrentOffsetToWrite; // Offset of the next record to write (only changed by the owner core)
+    UINT32          BufferSize;           // Size of the buffer
+
+    volatile UINT64 * SharedOffsetToWrite; // Copy of the offset to write in the control page
+    volatile UINT64 * UserOffsetToRead;    // Read offset of user-mode in the reader page
+
+    UINT64 CountOfDroppedMessages;         // Count of messages that are dropped because the buffer was full
+    UINT64 CountOfReportedDroppedMessages; // Count of dropped messages that the user is notified about
+
+} LOG_BUFFER_INFORMATION, *PLOG_BUFFER_INFORMATION;
+
+/**
+ * @brief The control page of log buffers that is mapped read-only
+ * to user-mode
+ * @details The first half of the buffers are for vmx non-root and the
+ * rest are for vmx-root messages, offsets are counts of bytes that are
+ * written to (or read from) the buffer since the initialization, the
+ * position in the buffer is the offset modulo the size of the buffer
+ *
+ */
+typedef struct _LOG_SHARED_BUFFERS_HEADER
+{
+    UINT32          CountOfBuffers;
+    UINT32          BufferSize;              // Size of the buffer of each core
+    volatile UINT64 CurrentOffsetToWrite[1]; // Offset of the next record to write (only changed by the owner core)
+
+} LOG_SHARED_BUFFERS_HEADER, *PLOG_SHARED_BUFFERS_HEADER;
+
+/**
+ * @brief The page of log buffers that user-mode writes to
+ * @details The kernel checks each read offset before using it, an
+ * offset that is not between the previous read offset and the write
+ * offset is ignored
+ *
+ */
+typedef struct _LOG_SHARED_READER_PAGE
+{
+    volatile LONG   DoorbellArmed; // Set by user-mode before waiting for the doorbell event
+    UINT32          Reserved;
+    volatile UINT64 CurrentOffsetToRead[1]; // Offset of the next record to read (only changed by user-mode)
+
+} LOG_SHARED_READER_PAGE, *PLOG_SHARED_READER_PAGE;
+
+/* ==============================================================================================
+ */
+
+#define SIZEOF_DEBUGGER_MAP_LOG_BUFFERS sizeof(DEBUGGER_MAP_LOG_BUFFERS)
+
+/**
+ * @brief request for mapping the log buffers to user-mode
+ * @details Buffers and the control page are mapped read-only and the
+ * buffers are consecutive, only the reader page is writable so user-mode
+ * sets its read offsets there
+ *
+ */
+typedef struct _DEBUGGER_MAP_LOG_BUFFERS
+{
+    HANDLE hDoorbellEvent;    // Event that is signaled when there is a new message
+    UINT64 HeaderAddress;     // User-mode address of LOG_SHARED_BUFFERS_HEADER
+    UINT64 ReaderPageAddress; // User-mode address of LOG_SHARED_READER_PAGE
+    UINT64 BuffersAddress;    // User-mode address of the first buffer
+    UINT32 KernelStatus;
+
+} DEBUGGER_MAP_LOG_BUFFERS, *PDEBUGGER_MAP_LOG_BUFFERS;
+
+/* ==============================================================================================
+ */
+
+/**
+ * @brief Header of each message in a batch of messages (IRP_BASED_BATCHED)
+ *
+ */
+typedef struct _LOG_BATCH_MESSAGE_HEADER
+{
+    UINT32 OperationCode;
+    UINT32 BufferLength; // The actual length of the message
+
+} LOG_BATCH_MESSAGE_HEADER, *PLOG_BATCH_MESSAGE_HEADER;
+
+/**
+ * @brief Size of a message in a batch of messages
+ * @details The message is followed by a null-terminator and the next
+ * message is aligned to the size of LOG_BATCH_MESSAGE_HEADER
+ *
+ */
+#define LOG_BATCH_MESSAGE_SIZE(BufferLength) \
+    ((sizeof(LOG_BATCH_MESSAGE_HEADER) + (BufferLength) + sizeof(LOG_BATCH_MESSAGE_HEADER)) & ~(sizeof(LOG_BATCH_MESSAGE_HEADER) - 1))
+
+/**
+ * @brief The key of an empty slot in the hash tables of hooked pages
+ *
+ */
+#define EPT_HOOKED_PAGES_TABLE_EMPTY_KEY 0xffffffffffffffff
+
+/**
+ * @brief The key of a removed slot in the hash tables of hooked pages
+ *
+ */
+#define EPT_HOOKED_PAGES_TABLE_DELETED_KEY 0xfffffffffffffffe
+
+/**
+ * @brief A slot in the hash tables of hooked pages
+ *
+ */
+typedef struct _EPT_HOOKED_PAGES_TABLE_SLOT
+{
+    volatile UINT64                           Key;         // page frame number or address of the breakpoint
+    struct _EPT_HOOKED_PAGE_DETAIL * volatile HookedEntry; // the hooked page that contains the key
+    UINT32                                    Count;       // count of the same key in the same hooked page
+
+} EPT_HOOKED_PAGES_TABLE_SLOT, *PEPT_HOOKED_PAGES_TABLE_SLOT;
+
+/**
+ * @brief Open-addressing hash table to find the hooked pages
+ *
+ * @details The table is modified only from vmx non-root (or from vmx-root
+ * while the hooks are applied by a vmcall) in the same places that the list
+ * of hooked pages is modified, while it's read from vmx-root without any lock,
+ * a slot becomes visible to the readers after its hooked entry is written and
+ * a removed slot is marked as deleted instead of being emptied, so the probe
+ * sequences of the readers are never broken, a deleted slot might be reused by
+ * another key while a reader reads it, so readers check the key again after
+ * reading the hooked entry
+ *
+ * Once the deleted slots make the table too crowded, the live slots are copied
+ * to the spare slots and the two arrays are swapped, the previous slots become
+ * the spare slots but they are not reused until all the cores that were probing
+ * the table at the time of swapping leave the table (SpareRetireEpochs)
+ *
+ * Both arrays of slots are located in a single pool which is taken from the
+ * pool manager when the first entry is added, the pool is requested from vmx
+ * non-root before applying a hook (EptHookedPagesTablesReserve)
+ *
+ * If the table is full (or the pool is not available, or the spare slots are
+ * still probed when the table should be compacted), Overflowed is set and the
+ * readers should walk the list of hooked pages instead, until the table becomes
+ * empty again
+ *
+ */
+typedef struct _EPT_HOOKED_PAGES_TABLE
+{
+    UINT32                                SlotsMask;         // count of slots - 1
+    UINT32                                LiveCount;         // count of used slots
+    UINT32                                UsedCount;         // count of used and deleted slots
+    volatile BOOLEAN                      Overflowed;        // the table couldn't hold an entry
+    volatile PEPT_HOOKED_PAGES_TABLE_SLOT Slots;             // slots that are used by the readers, null if the pool is not taken yet
+    PEPT_HOOKED_PAGES_TABLE_SLOT          SpareSlots;        // slots that are used for removing the deleted slots
+    LONG64 *                              SpareRetireEpochs; // epoch of each core when the spare slots are unpublished
+    UINT32                                StorageIntention;  // intention of the pool that holds the slots (POOL_ALLOCATION_INTENTION)
+    volatile LONG                         StorageRequested;  // the pool is requested from the pool manager
+
+} EPT_HOOKED_PAGES_TABLE, *PEPT_HOOKED_PAGES_TABLE;
+
+/**
+ * @brief Position of a reader in the probe sequence of a key
+ *
+ * @details Should be zeroed before the first lookup
+ *
+ */
+typedef struct _EPT_HOOKED_PAGES_TABLE_CURSOR
+{
+    PEPT_HOOKED_PAGES_TABLE_SLOT Slots;    // slots that were used on the first lookup
+    UINT32                       Position; // count of probed slots
+
+} EPT_HOOKED_PAGES_TABLE_CURSOR, *PEPT_HOOKED_PAGES_TABLE_CURSOR;
+
+/* ==============================================================================================
+ */
+
+/**
+ * @brief The header of a binary record of printf (deferred formatting)
+ * @details The raw 64-bit arguments come after the header and the copied
+ * strings come after the arguments, each string argument keeps the offset
+ * and the length of its bytes in the strings
+ *
+ */
+typedef struct _DEBUGGER_EVENT_RECORD
+{
+    UINT64 Tag;              // Tag of the event (the formats of its script are used)
+    UINT64 TimeStamp;        // Time stamp counter when the record is made
+    UINT32 FormatId;         // Index of the format string in the symbols of the script
+    UINT16 CountOfArguments; // Count of the raw 64-bit arguments
+    UINT16 SizeOfStrings;    // Size of the copied strings (after the arguments)
+
+} DEBUGGER_EVENT_RECORD, *PDEBUGGER_EVENT_RECORD;
+
+/**
+ * @brief Offset and length of the copied bytes of a string argument
+ * of a binary record
+ *
+ */
+#define DEBUGGER_EVENT_RECORD_STRING(Offset, Length) (((UINT64)(Length) << 32) | (UINT32)(Offset))
+#define DEBUGGER_EVENT_RECORD_STRING_OFFSET(Argument) ((UINT32)(Argument))
+#define DEBUGGER_EVENT_RECORD_STRING_LENGTH(Argument) ((UINT32)((Argument) >> 32))
+
+/* ==============================================================================================
+ */
+
+/**
+ * @brief The kind of an aggregation map, a map is used by only one
+ * of the aggregation functions
+ *
+ */
+typedef enum _SCRIPT_ENGINE_AGGREGATION_TYPE
+{
+    SCRIPT_ENGINE_AGGREGATION_TYPE_UNUSED = 0,
+    SCRIPT_ENGINE_AGGREGATION_TYPE_COUNT,
+    SCRIPT_ENGINE_AGGREGATION_TYPE_SUM,
+    SCRIPT_ENGINE_AGGREGATION_TYPE_MIN,
+    SCRIPT_ENGINE_AGGREGATION_TYPE_MAX,
+    SCRIPT_ENGINE_AGGREGATION_TYPE_HIST,
+
+} SCRIPT_ENGINE_AGGREGATION_TYPE;
+
+/**
+ * @brief An entry (key and its aggregated value) of an aggregation map
+ * @details In histograms, the key is the index of the power-of-two
+ * bucket of the values (0 for zero, n for [2^(n-1), 2^n))
+ *
+ */
+typedef struct _SCRIPT_ENGINE_AGGREGATION_ENTRY
+{
+    UINT64  Key;
+    UINT64  Value;
+    BOOLEAN IsUsed;
+
+} SCRIPT_ENGINE_AGGREGATION_ENTRY, *PSCRIPT_ENGINE_AGGREGATION_ENTRY;
+
+/**
+ * @brief An aggregation map (open addressing hash table with a fixed
+ * count of entries)
+ *
+ */
+typedef struct _SCRIPT_ENGINE_AGGREGATION_MAP
+{
+    UINT32                          Type; // SCRIPT_ENGINE_AGGREGATION_TYPE
+    UINT32                          CountOfEntries;
+    UINT32                          CountOfDroppedUpdates; // Updates of new keys when the map is full
+    SCRIPT_ENGINE_AGGREGATION_ENTRY Entries[SCRIPT_ENGINE_AGGREGATION_MAP_ENTRIES];
+
+} SCRIPT_ENGINE_AGGREGATION_MAP, *PSCRIPT_ENGINE_AGGREGATION_MAP;
+
+/**
+ * @brief All of the aggregation maps of a core (or the merged maps of
+ * all cores)
+ *
+ */
+typedef struct _SCRIPT_ENGINE_AGGREGATION_MAPS
+{
+    SCRIPT_ENGINE_AGGREGATION_MAP Maps[SCRIPT_ENGINE_AGGREGATION_MAXIMUM_MAPS];
+
+} SCRIPT_ENGINE_AGGREGATION_MAPS, *PSCRIPT_ENGINE_AGGREGATION_MAPS;
+
+#define SIZEOF_DEBUGGER_QUERY_AGGREGATION_MAPS \
+    sizeof(DEBUGGER_QUERY_AGGREGATION_MAPS)
+
+/**
+ * @brief request for merging the aggregation maps of all cores
+ *
+ */
+typedef struct _DEBUGGER_QUERY_AGGREGATION_MAPS
+{
+    BOOLEAN                        ClearMaps; // Clear the maps of cores after merging them
+    UINT32                         KernelStatus;
+    SCRIPT_ENGINE_AGGREGATION_MAPS Maps; // The merged maps
+
+} DEBUGGER_QUERY_AGGREGATION_MAPS, *PDEBUGGER_QUERY_AGGREGATION_MAPS;
+
+/**
+ * @brief The part of an aggregation map that is sent by the halted
+ * debuggee in each packet (the maps don't fit in one packet)
+ * @details The used entries of the map are after this structure, the
+ * debugger asks for the entries of MapIndex starting from StartingEntry
+ * and continues from NextEntry until the end of the map, the request
+ * that clears the maps uses SCRIPT_ENGINE_AGGREGATION_MAXIMUM_MAPS as
+ * MapIndex
+ *
+ */
+typedef struct _DEBUGGEE_AGGREGATION_MAPS_PACKET
+{
+    BOOLEAN ClearMaps; // Clear the maps of all cores
+    UINT32  KernelStatus;
+    UINT32  MapIndex;
+    UINT32  StartingEntry; // The first entry that is checked
+    UINT32  NextEntry;     // The entry after the last checked entry
+    UINT32  Type;          // SCRIPT_ENGINE_AGGREGATION_TYPE
+    UINT32  CountOfEntries;
+    UINT32  CountOfDroppedUpdates;
+    UINT32  CountOfSentEntries;
+
+    //
+    // The used entries are here
+    //
+
+} DEBUGGEE_AGGREGATION_MAPS_PACKET, *PDEBUGGEE_AGGREGATION_MAPS_PACKET;
+
+/**
+ * @brief Maximum count of the entries of an aggregation map that are
+ * sent in each packet
+ *
+ */
+#define DEBUGGEE_AGGREGATION_MAPS_ENTRIES_PER_PACKET                    \
+    ((PacketChunkSize - sizeof(DEBUGGEE_AGGREGATION_MAPS_PACKET)) / \
+     sizeof(SCRIPT_ENGINE_AGGREGATION_ENTRY))
+
 /* ==============================================================================================
  */
 
@@ -893,6 +1368,104 @@ typedef struct _DEBUGGER_PREALLOC_COMMAND
 
 } DEBUGGER_PREALLOC_COMMAND, *PDEBUGGER_PREALLOC_COMMAND;
 
+/**
+ * @brief Counters of the pool manager
+ *
+ */
+typedef struct _POOL_MANAGER_STATISTICS
+{
+    UINT64 CacheHits;    // Pools that are taken from the cache of the current core
+    UINT64 CacheMisses;  // Requests that the cache of the current core was empty
+    UINT64 Refills;      // Times that the free lists are locked to refill a cache
+    UINT64 RefillCycles; // Total TSC cycles spent on refilling the caches
+    UINT64 Steals;       // Pools that are taken from the cache of other cores
+    UINT64 Failures;     // Requests that no pool was available
+
+} POOL_MANAGER_STATISTICS, *PPOOL_MANAGER_STATISTICS;
+
+/**
+ * @brief Count of pools of each intention that are cached for each core
+ *
+ */
+#define PoolManagerPerCoreCacheSize 2
+
+/**
+ * @brief Count of buckets of the hash table of pool addresses (should
+ * be a power of two)
+ *
+ */
+#define PoolManagerAddressHashBuckets 256
+
+/**
+ * @brief Inum of intentions for buffers (buffer tag)
+ *
+ */
+typedef enum
+{
+    TRACKING_HOOKED_PAGES,
+    EXEC_TRAMPOLINE,
+    SPLIT_2MB_PAGING_TO_4KB_PAGE,
+    DETOUR_HOOK_DETAILS,
+    THREAD_STEPPINGS_DETAIIL,
+    BREAKPOINT_DEFINITION_STRUCTURE,
+    HOOKED_PAGES_TABLE_SLOTS,
+    HIDDEN_BREAKPOINTS_TABLE_SLOTS,
+
+} POOL_ALLOCATION_INTENTION;
+
+/**
+ * @brief Count of different intentions (POOL_ALLOCATION_INTENTION)
+ *
+ */
+#define POOL_MANAGER_MAXIMUM_INTENTIONS (HIDDEN_BREAKPOINTS_TABLE_SLOTS + 1)
+
+/**
+ * @brief Table of holding pools detail structure
+ *
+ */
+typedef struct _POOL_TABLE
+{
+    UINT64                    Address; // Should be the start of the list as we compute it as the start address
+    SIZE_T                    Size;
+    POOL_ALLOCATION_INTENTION Intention;
+    LIST_ENTRY                PoolsList;
+    LIST_ENTRY                AddressHashList; // Entry in the bucket of its address
+    LIST_ENTRY                StateList;       // Entry in the free list of its intention or in the list of pools to be freed
+    BOOLEAN                   IsBusy;
+    BOOLEAN                   ShouldBeFreed;
+    BOOLEAN                   AlreadyFreed;
+
+} POOL_TABLE, *PPOOL_TABLE;
+
+/**
+ * @brief Pools that are cached for a special core
+ *
+ * @details Each slot is taken and filled by interlocked operations so
+ * the owner core never acquires a lock for getting a cached pool, and
+ * other cores can still take the pools if the free lists are empty
+ *
+ */
+typedef struct _POOL_MANAGER_CORE_CACHE
+{
+    PPOOL_TABLE volatile    Pools[POOL_MANAGER_MAXIMUM_INTENTIONS][PoolManagerPerCoreCacheSize];
+    POOL_MANAGER_STATISTICS Statistics;
+
+} POOL_MANAGER_CORE_CACHE, *PPOOL_MANAGER_CORE_CACHE;
+
+#define SIZEOF_DEBUGGER_QUERY_POOL_MANAGER_STATISTICS \
+    sizeof(DEBUGGER_QUERY_POOL_MANAGER_STATISTICS)
+
+/**
+ * @brief request for the counters of the pool manager (sum of all cores)
+ *
+ */
+typedef struct _DEBUGGER_QUERY_POOL_MANAGER_STATISTICS
+{
+    UINT32                  KernelStatus;
+    POOL_MANAGER_STATISTICS Statistics;
+
+} DEBUGGER_QUERY_POOL_MANAGER_STATISTICS, *PDEBUGGER_QUERY_POOL_MANAGER_STATISTICS;
+
 /* ==============================================================================================
  */
 
@@ -1002,6 +1575,7 @@ typedef struct _DEBUGGER_FLUSH_LOGGING_BUFFERS
     UINT32 KernelStatus;
     UINT32 CountOfMessagesThatSetAsReadFromVmxRoot;
     UINT32 CountOfMessagesThatSetAsReadFromVmxNonRoot;
+    UINT64 CountOfDroppedMessages; // Count of messages that are dropped because the buffers were full (since the initialization)
 
 } DEBUGGER_FLUSH_LOGGING_BUFFERS, *PDEBUGGER_FLUSH_LOGGING_BUFFERS;
 
@@ -1268,7 +1842,8 @@ typedef struct _DEBUGGER_PREPARE_DEBUGGEE
     UINT32 PortAddress;
     UINT32 Baudrate;
     UINT64 NtoskrnlBaseAddress;
-    UINT32 Result; // Result from the kernel
+    UINT32 Result;         // Result from the kernel
+    UINT32 FramingVersion; // Latest framing version that the debuggee supports
     CHAR   OsName[MAXIMUM_CHARACTER_FOR_OS_NAME];
 
 } DEBUGGER_PREPARE_DEBUGGEE, *PDEBUGGER_PREPARE_DEBUGGEE;
@@ -1362,10 +1937,11 @@ typedef struct _DEBUGGER_ATTACH_DETACH_USER_MODE_PROCESS
  */
 typedef struct _DEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION
 {
-    UINT64 ScriptBuffer;
-    UINT32 ScriptLength;
-    UINT32 ScriptPointer;
-    UINT32 OptionalRequestedBufferSize;
+    UINT64  ScriptBuffer;
+    UINT32  ScriptLength;
+    UINT32  ScriptPointer;
+    UINT32  OptionalRequestedBufferSize;
+    BOOLEAN DeferredFormatting; // printf sends binary records instead of texts
 
 } DEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION,
     *PDEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION;
@@ -1414,6 +1990,10 @@ typedef struct _DEBUGGER_EVENT_ACTION
     DEBUGGER_EVENT_ACTION_RUN_SCRIPT_CONFIGURATION
     ScriptConfiguration; // If it's run script
 
+    PVOID ScriptBytecode;   // The script lowered to the bytecode (if any)
+    PVOID ScriptJitCode;    // The native code of the bytecode (if any)
+    PVOID ScriptJitCodeMdl; // The MDL of the pages of the native code (if any)
+
     DEBUGGER_EVENT_REQUEST_BUFFER
     RequestedBuffer; // if it's a custom code and needs a buffer then we use
                      // this structs
@@ -1460,6 +2040,86 @@ typedef struct _DEBUGGER_EVENT
 /* ==============================================================================================
  */
 
+/**
+ * @brief An event in the dispatch index
+ *
+ */
+typedef struct _EVENT_DISPATCH_ENTRY
+{
+    PDEBUGGER_EVENT Event;
+    UINT32          Order; // position of the event in the list of events
+
+} EVENT_DISPATCH_ENTRY, *PEVENT_DISPATCH_ENTRY;
+
+/**
+ * @brief A slot in the hash table of keys (MSR, I/O port, vector, etc.)
+ *
+ */
+typedef struct _EVENT_DISPATCH_KEY_SLOT
+{
+    UINT64 Key;
+    UINT32 Start; // index of the first event in the keyed events
+    UINT32 Count; // zero means that the slot is empty
+
+} EVENT_DISPATCH_KEY_SLOT, *PEVENT_DISPATCH_KEY_SLOT;
+
+/**
+ * @brief A range of physical addresses in the dispatch index of
+ * hidden hook read/write events
+ *
+ */
+typedef struct _EVENT_DISPATCH_RANGE
+{
+    UINT64          Start; // inclusive
+    UINT64          End;   // exclusive
+    PDEBUGGER_EVENT Event;
+    UINT32          Order; // position of the event in the list of events
+
+} EVENT_DISPATCH_RANGE, *PEVENT_DISPATCH_RANGE;
+
+/**
+ * @brief Enabled events of a special type that are allowed
+ * to be triggered on a special core
+ *
+ * @details For the keyed event types (e.g., MSRs, I/O ports, vectors),
+ * Events only contains the events that are applied to all of the keys
+ * and the events of a special key are located in KeyedEvents which is
+ * sorted by key, the hash table of keys points to their range
+ *
+ * For the hidden hook read/write events, events are located in Ranges
+ * (in the same order as the list), the sorted starts and ends of the
+ * ranges split the addresses into segments, each segment points to the
+ * events that contain all of its addresses in RangeEvents
+ *
+ */
+typedef struct _EVENT_DISPATCH_BUCKET
+{
+    UINT32                   Count;
+    PEVENT_DISPATCH_ENTRY    Events; // points to the storage of the snapshot
+    UINT32                   KeyedCount;
+    PEVENT_DISPATCH_ENTRY    KeyedEvents;
+    UINT32                   KeySlotsMask; // count of slots - 1, slots are not used if it's zero
+    PEVENT_DISPATCH_KEY_SLOT KeySlots;
+    BOOLEAN                  IdentityHash; // keys are small integers (vectors)
+    UINT32                   RangesCount;
+    PEVENT_DISPATCH_RANGE    Ranges; // null if the events are not ranges of addresses
+    UINT32                   BoundsCount;
+    UINT64 *                 Bounds;      // sorted starts and ends of ranges, segment i is from Bounds[i] to Bounds[i + 1]
+    UINT32 *                 Segments;    // index of the first event of each segment in RangeEvents (and the end)
+    PEVENT_DISPATCH_ENTRY    RangeEvents; // events of segments, sorted by order in each segment
+
+} EVENT_DISPATCH_BUCKET, *PEVENT_DISPATCH_BUCKET;
+
+/* ==============================================================================================
+ */
+
+/**
+ * @brief The debugger requests the debuggee to send its packets
+ * in compressed frames (SERIAL_FRAMING_VERSION_COMPRESSION)
+ *
+ */
+#define DEBUGGER_REMOTE_PACKET_FLAG_COMPRESSED_FRAMES 0x1
+
 /**
  * @brief The structure of remote packets in HyperDbg
  *
@@ -1467,7 +2127,10 @@ typedef struct _DEBUGGER_EVENT
 typedef struct _DEBUGGER_REMOTE_PACKET
 {
     BYTE                                    Checksum;
-    UINT64                                  Indicator; /* Shows the type of the packet */
+    BYTE                                    Flags; /* DEBUGGER_REMOTE_PACKET_FLAG_* */
+    BYTE                                    Reserved[2];
+    UINT32                                  SequenceNumber; /* Matches the responses with their requests (zero if not used) */
+    UINT64                                  Indicator;      /* Shows the type of the packet */
     DEBUGGER_REMOTE_PACKET_TYPE             TypeOfThePacket;
     DEBUGGER_REMOTE_PACKET_REQUESTED_ACTION RequestedActionOfThePacket;
 
@@ -1701,8 +2364,24 @@ typedef enum _DEBUGGER_CONDITIONAL_JUMP_STATUS
 
 } DEBUGGER_CONDITIONAL_JUMP_STATUS;
 
+/**
+ * @brief Maximum number of scripts that the debuggee keeps for
+ * running them again without receiving the script buffer
+ *
+ */
+#define DEBUGGEE_SCRIPT_CACHE_MAXIMUM_ENTRIES 16
+
+/**
+ * @brief Maximum size of the buffer of the scripts that are kept
+ * by the debuggee (scripts are limited by the size of packets anyway)
+ *
+ */
+#define DEBUGGEE_SCRIPT_CACHE_MAXIMUM_SCRIPT_SIZE PacketChunkSize
+
 /**
  * @brief The structure of script packet in HyperDbg
+ * @details if IsCachedScript is set, then the script buffer is not
+ * sent and the debuggee runs the script that its hash is ScriptHash
  *
  */
 typedef struct _DEBUGGEE_SCRIPT_PACKET
@@ -1711,6 +2390,8 @@ typedef struct _DEBUGGEE_SCRIPT_PACKET
     UINT32  ScriptBufferPointer;
     BOOLEAN IsFormat;
     UINT32  Result;
+    UINT64  ScriptHash;
+    BOOLEAN IsCachedScript;
 
     //
     // The script buffer is here
@@ -1753,11 +2434,16 @@ typedef struct _DEBUGGEE_USER_INPUT_PACKET
 
 /**
  * @brief The structure of user-input packet in HyperDbg
+ * @details if IsCachedScript is set, then the script buffer of the
+ * action is not sent and the debuggee copies the script that its hash
+ * is ScriptHash after the action (Length still includes the script)
  *
  */
 typedef struct _DEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET
 {
-    UINT32 Length;
+    UINT32  Length;
+    UINT64  ScriptHash;
+    BOOLEAN IsCachedScript;
 
     //
     // The buffer for event and action is here
@@ -2030,6 +2716,18 @@ typedef struct _DEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET
  */
 #define DEBUGGER_ERROR_COULD_NOT_FIND_ALLOCATION_TYPE 0xc0000027
 
+/**
+ * @brief error, could not map the log buffers to user-mode
+ *
+ */
+#define DEBUGGER_ERROR_COULD_NOT_MAP_LOG_BUFFERS_TO_USER_MODE 0xc0000028
+
+/**
+ * @brief error, the script is not cached in the debuggee
+ *
+ */
+#define DEBUGGER_ERROR_SCRIPT_IS_NOT_CACHED 0xc0000029
+
 //
 // WHEN YOU ADD ANYTHING TO THIS LIST OF ERRORS, THEN
 // MAKE SURE TO ADD AN ERROR MESSAGE TO ShowErrorMessage(UINT32 Error)
@@ -2215,3 +2913,24 @@ typedef struct _DEBUGGEE_EVENT_AND_ACTION_HEADER_FOR_REMOTE_PACKET
  */
 #define IOCTL_RESERVE_PRE_ALLOCATED_POOLS \
     CTL_CODE(FILE_DEVICE_UNKNOWN, 0x818, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, to map the log buffers to user-mode
+ *
+ */
+#define IOCTL_MAP_LOG_BUFFERS_TO_USER_MODE \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, 0x819, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, to merge (and clear) the aggregation maps of scripts
+ *
+ */
+#define IOCTL_QUERY_AGGREGATION_MAPS \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, 0x81a, METHOD_BUFFERED, FILE_ANY_ACCESS)
+
+/**
+ * @brief ioctl, to query the counters of the pool manager
+ *
+ */
+#define IOCTL_QUERY_POOL_MANAGER_STATISTICS \
+    CTL_CODE(FILE_DEVICE_UNKNOWN, 0x81b, METHOD_BUFFERED, FILE_ANY_ACCESS)
@@ -0,0 +1,492 @@
+/**
+ * @file EventDispatchBuckets.h
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief The buckets of the dispatch index of debugger events
+ * @details Building the buckets and finding the events of a bucket that
+ * should be triggered, the hypervisor and the benchmarks use the same
+ * code, this header should be included once in each module and the
+ * module should define the routine below
+ * @version 0.1
+ * @date 2021-10-11
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//	   Routines that the module should define   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Check the process, event specific parameters and conditions
+ * of an event and perform its actions if all of them are met
+ *
+ * @param CurrentEvent
+ * @param Regs
+ * @param Context
+ * @return BOOLEAN
+ */
+BOOLEAN
+DebuggerCheckAndPerformEvent(PDEBUGGER_EVENT CurrentEvent, PGUEST_REGS Regs, PVOID Context);
+
+//////////////////////////////////////////////////
+//					Buckets                     //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Compute the first slot of a key in the hash table
+ *
+ * @param Bucket Target bucket
+ * @param Key The key
+ * @return UINT32 Index of the slot
+ */
+UINT32
+EventDispatchHashKey(PEVENT_DISPATCH_BUCKET Bucket, UINT64 Key)
+{
+    if (Bucket->IdentityHash)
+    {
+        return (UINT32)(Key & Bucket->KeySlotsMask);
+    }
+
+    //
+    // Fibonacci hashing, MSRs and ports are not uniformly distributed
+    //
+    return (UINT32)((Key * 0x9E3779B97F4A7C15ull) >> 32) & Bucket->KeySlotsMask;
+}
+
+/**
+ * @brief Sort the bounds of ranges and remove the duplicated bounds
+ *
+ * @param Bounds Array of bounds
+ * @param Count Count of bounds
+ * @return UINT32 Count of unique bounds
+ */
+UINT32
+EventDispatchSortBounds(UINT64 * Bounds, UINT32 Count)
+{
+    UINT64 Temp;
+    UINT32 UniqueCount = 0;
+    UINT32 j;
+
+    //
+    // The count of events is small, it's not on the hot path anyway
+    //
+    for (UINT32 i = 1; i < Count; i++)
+    {
+        Temp = Bounds[i];
+        j    = i;
+
+        while (j > 0 && Bounds[j - 1] > Temp)
+        {
+            Bounds[j] = Bounds[j - 1];
+            j--;
+        }
+
+        Bounds[j] = Temp;
+    }
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        if (UniqueCount == 0 || Bounds[UniqueCount - 1] != Bounds[i])
+        {
+            Bounds[UniqueCount] = Bounds[i];
+            UniqueCount++;
+        }
+    }
+
+    return UniqueCount;
+}
+
+/**
+ * @brief Find the segment that contains a special address
+ *
+ * @details both of the bounds and the segments are sorted, so it's
+ * a binary search
+ *
+ * @param Bounds Sorted array of unique bounds
+ * @param BoundsCount Count of bounds
+ * @param Address The address
+ * @return UINT32 Count of bounds that are not after the address, the
+ * address is in segment (result - 1) if the result is between 1 and
+ * BoundsCount - 1, otherwise it's not in any of the ranges
+ */
+UINT32
+EventDispatchFindSegment(UINT64 * Bounds, UINT32 BoundsCount, UINT64 Address)
+{
+    UINT32 Low  = 0;
+    UINT32 High = BoundsCount;
+    UINT32 Middle;
+
+    while (Low < High)
+    {
+        Middle = Low + ((High - Low) / 2);
+
+        if (Bounds[Middle] <= Address)
+        {
+            Low = Middle + 1;
+        }
+        else
+        {
+            High = Middle;
+        }
+    }
+
+    return Low;
+}
+
+/**
+ * @brief Sort the keyed events of a bucket and fill its hash table of keys
+ *
+ * @param Bucket Target bucket
+ * @return VOID
+ */
+VOID
+EventDispatchBuildKeySlots(PEVENT_DISPATCH_BUCKET Bucket)
+{
+    PEVENT_DISPATCH_KEY_SLOT Slot;
+    EVENT_DISPATCH_ENTRY     Temp;
+    UINT64                   Key;
+    UINT32                   Index;
+    UINT32                   j;
+
+    RtlZeroMemory(Bucket->KeySlots, (Bucket->KeySlotsMask + 1) * sizeof(EVENT_DISPATCH_KEY_SLOT));
+
+    //
+    // Sort by key and then by order (insertion sort is stable and the
+    // count of events is small, it's not on the hot path anyway)
+    //
+    for (UINT32 i = 1; i < Bucket->KeyedCount; i++)
+    {
+        Temp = Bucket->KeyedEvents[i];
+        j    = i;
+
+        while (j > 0 && Bucket->KeyedEvents[j - 1].Event->OptionalParam1 > Temp.Event->OptionalParam1)
+        {
+            Bucket->KeyedEvents[j] = Bucket->KeyedEvents[j - 1];
+            j--;
+        }
+
+        Bucket->KeyedEvents[j] = Temp;
+    }
+
+    //
+    // Each run of the same key takes one slot
+    //
+    for (UINT32 i = 0; i < Bucket->KeyedCount; i++)
+    {
+        Key   = Bucket->KeyedEvents[i].Event->OptionalParam1;
+        Index = EventDispatchHashKey(Bucket, Key);
+        Slot  = &Bucket->KeySlots[Index];
+
+        while (Slot->Count != 0 && Slot->Key != Key)
+        {
+            Index = (Index + 1) & Bucket->KeySlotsMask;
+            Slot  = &Bucket->KeySlots[Index];
+        }
+
+        if (Slot->Count == 0)
+        {
+            Slot->Key   = Key;
+            Slot->Start = i;
+        }
+
+        Slot->Count++;
+    }
+}
+
+/**
+ * @brief Split the ranges of a bucket into segments and find the
+ * events of each segment
+ *
+ * @details the ranges are in the same order as the list of events, so
+ * the events of each segment are also sorted by their order
+ *
+ * @param Bucket Target bucket
+ * @param RangeEventsCapacity Maximum count of events of all segments
+ * @return BOOLEAN TRUE if the events of all segments fit into the bucket
+ */
+BOOLEAN
+EventDispatchBuildRanges(PEVENT_DISPATCH_BUCKET Bucket, UINT32 RangeEventsCapacity)
+{
+    PEVENT_DISPATCH_RANGE Range;
+    UINT32                First;
+    UINT32                Last;
+    UINT32                Start;
+    UINT32                Count;
+    UINT64                Total = 0;
+
+    Bucket->BoundsCount = 0;
+
+    for (UINT32 i = 0; i < Bucket->RangesCount; i++)
+    {
+        Range = &Bucket->Ranges[i];
+
+        if (Range->Start < Range->End)
+        {
+            Bucket->Bounds[Bucket->BoundsCount]     = Range->Start;
+            Bucket->Bounds[Bucket->BoundsCount + 1] = Range->End;
+            Bucket->BoundsCount += 2;
+        }
+    }
+
+    Bucket->BoundsCount = EventDispatchSortBounds(Bucket->Bounds, Bucket->BoundsCount);
+
+    if (Bucket->BoundsCount == 0)
+    {
+        return TRUE;
+    }
+
+    //
+    // Count the events of each segment
+    //
+    RtlZeroMemory(Bucket->Segments, Bucket->BoundsCount * sizeof(UINT32));
+
+    for (UINT32 i = 0; i < Bucket->RangesCount; i++)
+    {
+        Range = &Bucket->Ranges[i];
+
+        if (Range->Start >= Range->End)
+        {
+            continue;
+        }
+
+        First = EventDispatchFindSegment(Bucket->Bounds, Bucket->BoundsCount, Range->Start) - 1;
+        Last  = EventDispatchFindSegment(Bucket->Bounds, Bucket->BoundsCount, Range->End) - 1;
+
+        Total += Last - First;
+
+        if (Total > RangeEventsCapacity)
+        {
+            return FALSE;
+        }
+
+        for (UINT32 j = First; j < Last; j++)
+        {
+            Bucket->Segments[j]++;
+        }
+    }
+
+    //
+    // Convert the counts to the index of the first event of each segment
+    //
+    Start = 0;
+
+    for (UINT32 i = 0; i < Bucket->BoundsCount; i++)
+    {
+        Count               = Bucket->Segments[i];
+        Bucket->Segments[i] = Start;
+        Start += Count;
+    }
+
+    //
+    // Add the events to their segments, each segment index is moved to
+    // the next event, so after that, it's the index of the next segment
+    //
+    for (UINT32 i = 0; i < Bucket->RangesCount; i++)
+    {
+        Range = &Bucket->Ranges[i];
+
+        if (Range->Start >= Range->End)
+        {
+            continue;
+        }
+
+        First = EventDispatchFindSegment(Bucket->Bounds, Bucket->BoundsCount, Range->Start) - 1;
+        Last  = EventDispatchFindSegment(Bucket->Bounds, Bucket->BoundsCount, Range->End) - 1;
+
+        for (UINT32 j = First; j < Last; j++)
+        {
+            Bucket->RangeEvents[Bucket->Segments[j]].Event = Range->Event;
+            Bucket->RangeEvents[Bucket->Segments[j]].Order = Range->Order;
+            Bucket->Segments[j]++;
+        }
+    }
+
+    for (UINT32 i = Bucket->BoundsCount - 1; i > 0; i--)
+    {
+        Bucket->Segments[i] = Bucket->Segments[i - 1];
+    }
+
+    Bucket->Segments[0] = 0;
+
+    return TRUE;
+}
+
+/**
+ * @brief Find the events of a bucket that are registered for
+ * a special key (e.g., MSR, I/O port, vector)
+ *
+ * @details should be called in vmx-root
+ *
+ * @param Bucket Target bucket
+ * @param Key The key (context of the event)
+ * @param Count Count of found events
+ * @return PEVENT_DISPATCH_ENTRY The first found event (sorted by order) or
+ * null if there is no event for this key
+ */
+PEVENT_DISPATCH_ENTRY
+EventDispatchFindKeyedEvents(PEVENT_DISPATCH_BUCKET Bucket, UINT64 Key, UINT32 * Count)
+{
+    PEVENT_DISPATCH_KEY_SLOT Slot;
+    UINT32                   Index;
+
+    *Count = 0;
+
+    if (Bucket->KeyedCount == 0)
+    {
+        return NULL;
+    }
+
+    Index = EventDispatchHashKey(Bucket, Key);
+    Slot  = &Bucket->KeySlots[Index];
+
+    while (Slot->Count != 0)
+    {
+        if (Slot->Key == Key)
+        {
+            *Count = Slot->Count;
+            return &Bucket->KeyedEvents[Slot->Start];
+        }
+
+        Index = (Index + 1) & Bucket->KeySlotsMask;
+        Slot  = &Bucket->KeySlots[Index];
+    }
+
+    //
+    // There is no listener for this key
+    //
+    return NULL;
+}
+
+/**
+ * @brief Find the events of a bucket that their range of physical
+ * addresses contains a special address
+ *
+ * @details should be called in vmx-root, it's a binary search on the
+ * bounds of the ranges, so it's O(log n) and the found events are
+ * exactly the events that contain the address
+ *
+ * @param Bucket Target bucket
+ * @param Address The physical address (context of the event)
+ * @param Count Count of found events
+ * @return PEVENT_DISPATCH_ENTRY The first found event (sorted by order) or
+ * null if there is no event for this address
+ */
+PEVENT_DISPATCH_ENTRY
+EventDispatchFindRangeEvents(PEVENT_DISPATCH_BUCKET Bucket, UINT64 Address, UINT32 * Count)
+{
+    UINT32 Segment;
+
+    *Count = 0;
+
+    Segment = EventDispatchFindSegment(Bucket->Bounds, Bucket->BoundsCount, Address);
+
+    //
+    // The address is before the first bound or after the last bound
+    //
+    if (Segment == 0 || Segment >= Bucket->BoundsCount)
+    {
+        return NULL;
+    }
+
+    Segment--;
+
+    *Count = Bucket->Segments[Segment + 1] - Bucket->Segments[Segment];
+
+    if (*Count == 0)
+    {
+        //
+        // The address is in a gap between the ranges
+        //
+        return NULL;
+    }
+
+    return &Bucket->RangeEvents[Bucket->Segments[Segment]];
+}
+
+/**
+ * @brief Trigger the enabled events of a bucket
+ *
+ * @details should be called in vmx-root after entering the index, the
+ * events are performed in the same order as walking the list of events
+ *
+ * @param Bucket Target bucket
+ * @param Regs Guest registers
+ * @param Context An optional parameter (different in each event)
+ * @return VOID
+ */
+VOID
+EventDispatchTriggerBucket(PEVENT_DISPATCH_BUCKET Bucket, PGUEST_REGS Regs, PVOID Context)
+{
+    PEVENT_DISPATCH_ENTRY KeyedEvents;
+    PEVENT_DISPATCH_ENTRY RangeEvents;
+    PDEBUGGER_EVENT       CurrentEvent;
+    UINT32                KeyedCount;
+    UINT32                RangeEventsCount;
+    UINT32                i;
+    UINT32                j;
+
+    //
+    // Hidden hook read/write events are ranges of physical addresses
+    //
+    if (Bucket->Ranges != NULL)
+    {
+        RangeEvents = EventDispatchFindRangeEvents(Bucket, (UINT64)Context, &RangeEventsCount);
+
+        for (i = 0; i < RangeEventsCount; i++)
+        {
+            CurrentEvent = RangeEvents[i].Event;
+
+            //
+            // The event might be disabled after building the index
+            //
+            if (!CurrentEvent->Enabled)
+            {
+                continue;
+            }
+
+            DebuggerCheckAndPerformEvent(CurrentEvent, Regs, Context);
+        }
+
+        return;
+    }
+
+    //
+    // Find the events that are registered for this special key (MSR,
+    // I/O port, vector, etc.), if there is no listener for this key and
+    // no event for all keys then there is nothing to trigger
+    //
+    KeyedEvents = EventDispatchFindKeyedEvents(Bucket, (UINT64)Context, &KeyedCount);
+
+    //
+    // Merge the events for all keys and the events of this key based
+    // on their order, so they're performed in the same order as the list
+    //
+    i = 0;
+    j = 0;
+
+    while (i < Bucket->Count || j < KeyedCount)
+    {
+        if (j >= KeyedCount || (i < Bucket->Count && Bucket->Events[i].Order < KeyedEvents[j].Order))
+        {
+            CurrentEvent = Bucket->Events[i].Event;
+            i++;
+        }
+        else
+        {
+            CurrentEvent = KeyedEvents[j].Event;
+            j++;
+        }
+
+        //
+        // The event might be disabled after building the index
+        //
+        if (!CurrentEvent->Enabled)
+        {
+            continue;
+        }
+
+        DebuggerCheckAndPerformEvent(CurrentEvent, Regs, Context);
+    }
+}
@@ -0,0 +1,444 @@
+/**
+ * @file HookedPagesTable.h
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief The hash tables of hooked pages
+ * @details Adding, removing and finding the keys of hooked pages (page
+ * frame numbers or addresses of hidden breakpoints), the hypervisor and
+ * the benchmarks use the same code, this header should be included once
+ * in each module and the module should define the routines below
+ * @version 0.1
+ * @date 2021-11-23
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//	   Routines that the module should define   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Get the count of cores that probe the tables
+ *
+ * @return UINT32
+ */
+UINT32
+EptHookedPagesTablesGetCountOfCores();
+
+/**
+ * @brief Get the epoch of a core, it's odd while the core probes the tables
+ *
+ * @param CoreIndex
+ * @return LONG64
+ */
+LONG64
+EptHookedPagesTablesGetEpoch(UINT32 CoreIndex);
+
+/**
+ * @brief Take the pool of a hash table of hooked pages
+ *
+ * @param Table
+ * @return BOOLEAN
+ */
+BOOLEAN
+EptHookedPagesTableTakeStorage(PEPT_HOOKED_PAGES_TABLE Table);
+
+//////////////////////////////////////////////////
+//				 Hash Tables                    //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Empty the slots of a hash table of hooked pages
+ *
+ * @param Slots The target slots
+ * @param SlotsMask Count of slots - 1
+ * @return VOID
+ */
+VOID
+EptHookedPagesTableClearSlots(PEPT_HOOKED_PAGES_TABLE_SLOT Slots, UINT32 SlotsMask)
+{
+    for (UINT32 i = 0; i <= SlotsMask; i++)
+    {
+        Slots[i].Key         = EPT_HOOKED_PAGES_TABLE_EMPTY_KEY;
+        Slots[i].HookedEntry = NULL;
+        Slots[i].Count       = 0;
+    }
+}
+
+/**
+ * @brief Remove all the entries of a hash table of hooked pages
+ * @details The caller should make sure that the table doesn't contain any
+ * hooked page which is still in the list of hooked pages
+ *
+ * @param Table The target hash table
+ * @return VOID
+ */
+VOID
+EptHookedPagesTableReset(PEPT_HOOKED_PAGES_TABLE Table)
+{
+    if (Table->Slots != NULL)
+    {
+        EptHookedPagesTableClearSlots(Table->Slots, Table->SlotsMask);
+    }
+
+    Table->LiveCount  = 0;
+    Table->UsedCount  = 0;
+    Table->Overflowed = FALSE;
+}
+
+/**
+ * @brief Compute the first slot of a key in a hash table of hooked pages
+ *
+ * @param Table The target hash table
+ * @param Key The key (page frame number or address of the breakpoint)
+ * @return UINT32 Index of the first slot to probe
+ */
+UINT32
+EptHookedPagesTableHash(PEPT_HOOKED_PAGES_TABLE Table, UINT64 Key)
+{
+    //
+    // Fibonacci hashing, both page frame numbers and addresses of
+    // breakpoints are usually close to each other
+    //
+    return (UINT32)((Key * 0x9E3779B97F4A7C15ull) >> 32) & Table->SlotsMask;
+}
+
+/**
+ * @brief Check whether the spare slots of a hash table of hooked pages
+ * are still probed by any core or not
+ *
+ * @param Table The target hash table
+ * @return BOOLEAN TRUE if all the cores that were probing the table when
+ * the spare slots are unpublished have left the tables
+ */
+BOOLEAN
+EptHookedPagesTableIsSpareQuiescent(PEPT_HOOKED_PAGES_TABLE Table)
+{
+    UINT32 CountOfCores = EptHookedPagesTablesGetCountOfCores();
+
+    for (UINT32 i = 0; i < CountOfCores; i++)
+    {
+        if ((Table->SpareRetireEpochs[i] & 1) &&
+            Table->SpareRetireEpochs[i] == EptHookedPagesTablesGetEpoch(i))
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Remove the deleted slots of a hash table of hooked pages
+ * @details The live slots are copied to the spare slots which are then
+ * published to the readers, a reader that still probes the previous slots
+ * sees a consistent table as the previous slots are not modified until
+ * that reader leaves the tables
+ *
+ * It never waits for the readers as it might be called from vmx-root
+ * while other cores are halted in the middle of a lookup
+ *
+ * @param Table The target hash table
+ * @return BOOLEAN Returns false if the spare slots are still probed by
+ * other readers, in this case nothing is changed
+ */
+BOOLEAN
+EptHookedPagesTableCompact(PEPT_HOOKED_PAGES_TABLE Table)
+{
+    PEPT_HOOKED_PAGES_TABLE_SLOT OldSlots       = Table->Slots;
+    PEPT_HOOKED_PAGES_TABLE_SLOT NewSlots       = Table->SpareSlots;
+    UINT32                       CountOfCores   = EptHookedPagesTablesGetCountOfCores();
+    UINT32                       Index;
+
+    if (!EptHookedPagesTableIsSpareQuiescent(Table))
+    {
+        return FALSE;
+    }
+
+    EptHookedPagesTableClearSlots(NewSlots, Table->SlotsMask);
+
+    for (UINT32 i = 0; i <= Table->SlotsMask; i++)
+    {
+        if (OldSlots[i].Key == EPT_HOOKED_PAGES_TABLE_EMPTY_KEY ||
+            OldSlots[i].Key == EPT_HOOKED_PAGES_TABLE_DELETED_KEY)
+        {
+            continue;
+        }
+
+        Index = EptHookedPagesTableHash(Table, OldSlots[i].Key);
+
+        while (NewSlots[Index].Key != EPT_HOOKED_PAGES_TABLE_EMPTY_KEY)
+        {
+            Index = (Index + 1) & Table->SlotsMask;
+        }
+
+        NewSlots[Index] = OldSlots[i];
+    }
+
+    //
+    // Publish the new slots
+    //
+    InterlockedExchangePointer((PVOID volatile *)&Table->Slots, NewSlots);
+
+    //
+    // The cores that are probing the table at this point might
+    // still use the previous slots
+    //
+    for (UINT32 i = 0; i < CountOfCores; i++)
+    {
+        Table->SpareRetireEpochs[i] = EptHookedPagesTablesGetEpoch(i);
+    }
+
+    Table->SpareSlots = OldSlots;
+    Table->UsedCount  = Table->LiveCount;
+
+    return TRUE;
+}
+
+/**
+ * @brief Add a key of a hooked page to a hash table of hooked pages
+ * @details Adding the same key of the same hooked page more than once
+ * only increments its count
+ *
+ * @param Table The target hash table
+ * @param Key The key (page frame number or address of the breakpoint)
+ * @param HookedEntry The hooked page
+ * @return BOOLEAN Returns false if the table is full, in this case the
+ * table is marked as overflowed and readers will walk the list instead
+ */
+BOOLEAN
+EptHookedPagesTableInsert(PEPT_HOOKED_PAGES_TABLE Table, UINT64 Key, struct _EPT_HOOKED_PAGE_DETAIL * HookedEntry)
+{
+    PEPT_HOOKED_PAGES_TABLE_SLOT Slot        = NULL;
+    PEPT_HOOKED_PAGES_TABLE_SLOT DeletedSlot = NULL;
+    UINT32                       Index       = EptHookedPagesTableHash(Table, Key);
+
+    if (Table->Overflowed)
+    {
+        //
+        // The readers don't use the table anymore
+        //
+        return FALSE;
+    }
+
+    if (Table->Slots == NULL && !EptHookedPagesTableTakeStorage(Table))
+    {
+        //
+        // The pool of the slots is not available, the readers walk the list
+        //
+        Table->Overflowed = TRUE;
+        return FALSE;
+    }
+
+    for (UINT32 i = 0; i <= Table->SlotsMask; i++, Index = (Index + 1) & Table->SlotsMask)
+    {
+        Slot = &Table->Slots[Index];
+
+        if (Slot->Key == EPT_HOOKED_PAGES_TABLE_EMPTY_KEY)
+        {
+            break;
+        }
+
+        if (Slot->Key == EPT_HOOKED_PAGES_TABLE_DELETED_KEY)
+        {
+            if (DeletedSlot == NULL)
+            {
+                DeletedSlot = Slot;
+            }
+            continue;
+        }
+
+        if (Slot->Key == Key && Slot->HookedEntry == HookedEntry)
+        {
+            //
+            // The key is already in the table
+            //
+            Slot->Count++;
+            return TRUE;
+        }
+    }
+
+    if (DeletedSlot != NULL)
+    {
+        Slot = DeletedSlot;
+    }
+    else if ((Table->UsedCount + 1) * 4 > (Table->SlotsMask + 1) * 3)
+    {
+        //
+        // Keep at most 3/4 of the slots used, so the probes remain short
+        //
+        if ((Table->LiveCount + 1) * 4 > (Table->SlotsMask + 1) * 3)
+        {
+            Table->Overflowed = TRUE;
+            return FALSE;
+        }
+
+        //
+        // The deleted slots are the reason, remove them and try again
+        //
+        if (!EptHookedPagesTableCompact(Table))
+        {
+            //
+            // The spare slots are still probed, the readers walk the list
+            //
+            Table->Overflowed = TRUE;
+            return FALSE;
+        }
+
+        return EptHookedPagesTableInsert(Table, Key, HookedEntry);
+    }
+    else
+    {
+        Table->UsedCount++;
+    }
+
+    //
+    // The hooked entry should be visible before the key as the readers
+    // don't acquire any lock
+    //
+    Slot->HookedEntry = HookedEntry;
+    Slot->Count       = 1;
+    InterlockedExchange64((volatile LONG64 *)&Slot->Key, Key);
+
+    Table->LiveCount++;
+
+    return TRUE;
+}
+
+/**
+ * @brief Remove a key of a hooked page from a hash table of hooked pages
+ *
+ * @param Table The target hash table
+ * @param Key The key (page frame number or address of the breakpoint)
+ * @param HookedEntry The hooked page
+ * @return VOID
+ */
+VOID
+EptHookedPagesTableRemove(PEPT_HOOKED_PAGES_TABLE Table, UINT64 Key, struct _EPT_HOOKED_PAGE_DETAIL * HookedEntry)
+{
+    PEPT_HOOKED_PAGES_TABLE_SLOT Slot  = NULL;
+    UINT32                       Index = EptHookedPagesTableHash(Table, Key);
+
+    if (Table->Slots == NULL)
+    {
+        //
+        // Nothing is added to the table
+        //
+        return;
+    }
+
+    for (UINT32 i = 0; i <= Table->SlotsMask; i++, Index = (Index + 1) & Table->SlotsMask)
+    {
+        Slot = &Table->Slots[Index];
+
+        if (Slot->Key == EPT_HOOKED_PAGES_TABLE_EMPTY_KEY)
+        {
+            //
+            // Not found (e.g., it's not added because the table was full)
+            //
+            return;
+        }
+
+        if (Slot->Key == Key && Slot->HookedEntry == HookedEntry)
+        {
+            Slot->Count--;
+
+            if (Slot->Count == 0)
+            {
+                //
+                // Mark it as deleted, emptying the slot breaks the
+                // probes of the keys after this slot
+                //
+                InterlockedExchange64((volatile LONG64 *)&Slot->Key, EPT_HOOKED_PAGES_TABLE_DELETED_KEY);
+                Table->LiveCount--;
+            }
+
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Find the hooked pages of a key in a hash table of hooked pages
+ * @details Can be called from vmx-root without any lock, the same key
+ * might belong to more than one hooked page (e.g., the same address of
+ * breakpoint in different processes), thus, the caller should call it
+ * again with the same cursor until it returns NULL
+ *
+ * The caller should enter the tables (EptHookedPagesTablesEnter) before
+ * the first call and leave them after the last call
+ *
+ * @param Table The target hash table
+ * @param Key The key (page frame number or address of the breakpoint)
+ * @param Cursor Position of the caller in the table, should be zeroed
+ * before the first call
+ * @return struct _EPT_HOOKED_PAGE_DETAIL* The next hooked page of the key or NULL
+ * if there is no other hooked page
+ */
+struct _EPT_HOOKED_PAGE_DETAIL *
+EptHookedPagesTableLookup(PEPT_HOOKED_PAGES_TABLE Table, UINT64 Key, PEPT_HOOKED_PAGES_TABLE_CURSOR Cursor)
+{
+    UINT64                           SlotKey;
+    PEPT_HOOKED_PAGES_TABLE_SLOT     Slot;
+    struct _EPT_HOOKED_PAGE_DETAIL * HookedEntry = NULL;
+    UINT32                           Index;
+
+    if (Cursor->Slots == NULL)
+    {
+        //
+        // Keep probing the same slots even if the table is compacted meanwhile
+        //
+        Cursor->Slots = Table->Slots;
+
+        if (Cursor->Slots == NULL)
+        {
+            //
+            // Nothing is added to the table
+            //
+            return NULL;
+        }
+    }
+
+    Index = (EptHookedPagesTableHash(Table, Key) + Cursor->Position) & Table->SlotsMask;
+
+    while (Cursor->Position <= Table->SlotsMask)
+    {
+        Slot    = &Cursor->Slots[Index];
+        SlotKey = Slot->Key;
+
+        if (SlotKey == Key)
+        {
+            HookedEntry = Slot->HookedEntry;
+
+            if (Slot->Key != Key)
+            {
+                //
+                // The slot is removed and reused by another key after its
+                // key is read, so the hooked entry might belong to the other
+                // key, probe the same slot again
+                //
+                continue;
+            }
+        }
+
+        Cursor->Position++;
+        Index = (Index + 1) & Table->SlotsMask;
+
+        if (SlotKey == EPT_HOOKED_PAGES_TABLE_EMPTY_KEY)
+        {
+            //
+            // Make sure that the next calls won't probe anymore
+            //
+            Cursor->Position = Table->SlotsMask + 1;
+            break;
+        }
+
+        if (SlotKey == Key)
+        {
+            return HookedEntry;
+        }
+    }
+
+    return NULL;
+}
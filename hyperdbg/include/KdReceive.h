@@ -0,0 +1,84 @@
+/**
+ * @file KdReceive.h
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief Receiving the packets of the debuggee through a buffer
+ * @details These routines are exported by hprdbgctrl so the packets of
+ * the debuggee can also be received from other handles (e.g., by the
+ * benchmarks), Definition.h should be included before this header
+ * @version 0.1
+ * @date 2021-11-20
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+#ifndef HPRDBGCTRL_API
+#    ifdef HPRDBGCTRL_EXPORTS
+#        define HPRDBGCTRL_API __declspec(dllexport)
+#    else
+#        define HPRDBGCTRL_API __declspec(dllimport)
+#    endif
+#endif
+
+//////////////////////////////////////////////////
+//			    	 Definitions                //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Size of the buffer that keeps the received bytes
+ * of the debuggee until they're parsed
+ *
+ */
+#define KD_RECEIVE_BUFFER_SIZE 0x4000
+
+//////////////////////////////////////////////////
+//			    	 Structures                 //
+//////////////////////////////////////////////////
+
+/**
+ * @brief The received bytes that are not parsed yet, each read gets
+ * whatever is available (up to the size of the buffer) and the packets
+ * are extracted from it
+ *
+ */
+typedef struct _KD_RECEIVE_BUFFER
+{
+    BYTE   Buffer[KD_RECEIVE_BUFFER_SIZE];
+    UINT32 Head; // index of the next byte that is parsed
+    UINT32 Tail; // count of the valid bytes in the buffer
+
+} KD_RECEIVE_BUFFER, *PKD_RECEIVE_BUFFER;
+
+//////////////////////////////////////////////////
+//			    	 Functions                  //
+//////////////////////////////////////////////////
+
+HPRDBGCTRL_API BOOLEAN
+KdReceivePacketThroughBuffer(HANDLE             Handle,
+                             LPOVERLAPPED       Overlapped,
+                             PKD_RECEIVE_BUFFER ReceiveBuffer,
+                             UINT32             MaximumReadLength,
+                             CHAR *             BufferToSave,
+                             UINT32 *           LengthReceived,
+                             UINT32 *           CountOfReads);
+
+HPRDBGCTRL_API BOOLEAN
+KdSkipToNextFrameThroughBuffer(HANDLE             Handle,
+                               LPOVERLAPPED       Overlapped,
+                               PKD_RECEIVE_BUFFER ReceiveBuffer,
+                               UINT32             MaximumReadLength,
+                               UINT32 *           Signature,
+                               UINT32 *           CountOfReads);
+
+HPRDBGCTRL_API BOOLEAN
+KdReceiveFrameThroughBuffer(HANDLE             Handle,
+                            LPOVERLAPPED       Overlapped,
+                            PKD_RECEIVE_BUFFER ReceiveBuffer,
+                            UINT32             MaximumReadLength,
+                            CHAR *             BufferToSave,
+                            UINT32 *           LengthReceived,
+                            UINT32 *           CountOfReads);
+
+HPRDBGCTRL_API UINT32
+KdComputeDataCrc32(PVOID Buffer, UINT32 Length, UINT32 Crc32);
@@ -0,0 +1,425 @@
+/**
+ * @file LogBuffers.h
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief The per-core rings of log messages
+ * @details Writing a record to the buffer of a core and merging the
+ * records of all cores by their time stamps (in the kernel or in
+ * user-mode if the buffers are mapped to user-mode), the kernel, the
+ * debugger and the benchmarks use the same code, nothing here depends
+ * on the mode, so this header should be included once in each module
+ * @version 0.1
+ * @date 2021-11-22
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+/**
+ * @brief Get the header of a record in the buffer of a core
+ *
+ * @param BufferInformation The buffer of the core
+ * @param Offset Offset of the record
+ * @return BUFFER_HEADER*
+ */
+BUFFER_HEADER *
+LogGetRecordHeader(PLOG_BUFFER_INFORMATION BufferInformation, UINT64 Offset)
+{
+    return (BUFFER_HEADER *)(BufferInformation->BufferStartAddress + (Offset % BufferInformation->BufferSize));
+}
+
+/**
+ * @brief Get the next unread record in the buffer of a core
+ * @details Should be called by the reader of the buffer (readers are
+ * serialized), the headers that show the end of the buffer are skipped
+ *
+ * @param BufferInformation The buffer of the core
+ * @return BUFFER_HEADER* The header of the record or NULL if there is no unread record
+ */
+BUFFER_HEADER *
+LogGetNextRecord(PLOG_BUFFER_INFORMATION BufferInformation)
+{
+    BUFFER_HEADER * Header;
+    UINT64          OffsetToSend = BufferInformation->CurrentOffsetToSend;
+
+    while (OffsetToSend != BufferInformation->CurrentOffsetToWrite)
+    {
+        Header = LogGetRecordHeader(BufferInformation, OffsetToSend);
+
+        if (Header->BufferLength != 0)
+        {
+            return Header;
+        }
+
+        //
+        // The rest of the buffer is not used, the next record is at the
+        // start of the buffer
+        //
+        OffsetToSend += BufferInformation->BufferSize - (OffsetToSend % BufferInformation->BufferSize);
+        InterlockedExchange64((volatile LONG64 *)&BufferInformation->CurrentOffsetToSend, OffsetToSend);
+    }
+
+    //
+    // there is nothing to send
+    //
+    return NULL;
+}
+
+/**
+ * @brief Free the space of the next record for the writer
+ * @details Should be called by the reader of the buffer after it's done
+ * with the record that is returned by LogGetNextRecord
+ *
+ * @param BufferInformation The buffer of the core
+ * @param Header The header of the record
+ * @return VOID
+ */
+VOID
+LogSetRecordAsRead(PLOG_BUFFER_INFORMATION BufferInformation, BUFFER_HEADER * Header)
+{
+    InterlockedExchange64((volatile LONG64 *)&BufferInformation->CurrentOffsetToSend,
+                          BufferInformation->CurrentOffsetToSend + LOG_RECORD_SIZE(Header->BufferLength));
+}
+
+/**
+ * @brief Find the buffer that contains the oldest unread record
+ * @details Should be called by the reader of the buffers
+ *
+ * @param Buffers The buffers of all cores (of a pool)
+ * @param CountOfBuffers Count of buffers
+ * @param OldestHeader The header of the oldest record
+ * @return PLOG_BUFFER_INFORMATION The buffer or NULL if there is no unread record
+ */
+PLOG_BUFFER_INFORMATION
+LogFindOldestRecord(PLOG_BUFFER_INFORMATION Buffers, UINT32 CountOfBuffers, BUFFER_HEADER ** OldestHeader)
+{
+    PLOG_BUFFER_INFORMATION OldestBufferInformation = NULL;
+    BUFFER_HEADER *         Header;
+
+    for (UINT32 i = 0; i < CountOfBuffers; i++)
+    {
+        Header = LogGetNextRecord(&Buffers[i]);
+
+        if (Header == NULL)
+        {
+            //
+            // nothing to send on this core
+            //
+            continue;
+        }
+
+        if (OldestBufferInformation == NULL || Header->TimeStamp < (*OldestHeader)->TimeStamp)
+        {
+            OldestBufferInformation = &Buffers[i];
+            *OldestHeader           = Header;
+        }
+    }
+
+    return OldestBufferInformation;
+}
+
+/**
+ * @brief Use the read offset of user-mode as the offset to send
+ * @details Should be called by the owner core of the buffer while the
+ * buffers are mapped to user-mode, user-mode might write anything to its
+ * read offset, so it's only used if it's between the offset to send and
+ * the offset to write, the offset is changed by a compare-exchange as the
+ * buffers might be unmapped in the meantime
+ *
+ * @param BufferInformation The buffer of the core
+ * @return VOID
+ */
+VOID
+LogAcceptOffsetToReadOfUserMode(PLOG_BUFFER_INFORMATION BufferInformation)
+{
+    UINT64 OffsetToSend  = BufferInformation->CurrentOffsetToSend;
+    UINT64 OffsetToWrite = BufferInformation->CurrentOffsetToWrite;
+    UINT64 OffsetToRead  = *BufferInformation->UserOffsetToRead;
+
+    if (OffsetToRead - OffsetToSend > OffsetToWrite - OffsetToSend)
+    {
+        return;
+    }
+
+    InterlockedCompareExchange64((volatile LONG64 *)&BufferInformation->CurrentOffsetToSend, OffsetToRead, OffsetToSend);
+}
+
+/**
+ * @brief Get the free space of a buffer
+ *
+ * @param BufferInformation The buffer
+ * @return UINT64 Count of bytes that are not used by the unread messages
+ */
+UINT64
+LogGetFreeSpace(PLOG_BUFFER_INFORMATION BufferInformation)
+{
+    return BufferInformation->BufferSize - (BufferInformation->CurrentOffsetToWrite - BufferInformation->CurrentOffsetToSend);
+}
+
+/**
+ * @brief Write a record to the buffer of the current core
+ * @details Should be called by the owner core of the buffer (in vmx non-root
+ * the IRQL should be DISPATCH_LEVEL), the time stamp of records of a buffer
+ * should not decrease
+ *
+ * @param BufferInformation The buffer of the current core
+ * @param TimeStamp Time stamp of the record (for merging the buffers)
+ * @param OperationCode The operation code that will be send to user mode
+ * @param Buffer Buffer to be send to user mode
+ * @param BufferLength Length of the buffer
+ * @return BOOLEAN Returns FALSE if the buffer is full
+ */
+BOOLEAN
+LogWriteRecord(PLOG_BUFFER_INFORMATION BufferInformation, UINT64 TimeStamp, UINT32 OperationCode, PVOID Buffer, UINT32 BufferLength)
+{
+    UINT64 OffsetToWrite;
+    UINT32 RecordSize;
+    UINT32 UnusedSize = 0;
+
+    OffsetToWrite = BufferInformation->CurrentOffsetToWrite;
+    RecordSize    = LOG_RECORD_SIZE(BufferLength);
+
+    //
+    // Records are not split, if the record doesn't fit at the end of the buffer
+    // then the rest of the buffer is not used
+    //
+    if (BufferInformation->BufferSize - (OffsetToWrite % BufferInformation->BufferSize) < RecordSize)
+    {
+        UnusedSize = BufferInformation->BufferSize - (OffsetToWrite % BufferInformation->BufferSize);
+    }
+
+    //
+    // check if the buffer is full or not, we don't overwrite the unread messages
+    //
+    if (OffsetToWrite + UnusedSize + RecordSize - BufferInformation->CurrentOffsetToSend > BufferInformation->BufferSize)
+    {
+        return FALSE;
+    }
+
+    if (UnusedSize != 0)
+    {
+        //
+        // Show the end of the buffer to the readers
+        //
+        LogGetRecordHeader(BufferInformation, OffsetToWrite)->BufferLength = 0;
+    }
+
+    //
+    // Compute the start of the buffer header
+    //
+    BUFFER_HEADER * Header = LogGetRecordHeader(BufferInformation, OffsetToWrite + UnusedSize);
+
+    //
+    // Set the header
+    //
+    Header->OpeationNumber = OperationCode;
+    Header->BufferLength   = BufferLength;
+    Header->TimeStamp      = TimeStamp;
+
+    //
+    // ******** Now it's time to fill the buffer ********
+    //
+
+    //
+    // Copy the buffer
+    //
+    RtlCopyMemory((PVOID)((UINT64)Header + sizeof(BUFFER_HEADER)), Buffer, BufferLength);
+
+    //
+    // Messages are null-terminated so user-mode can use them in place
+    //
+    *(CHAR *)((UINT64)Header + sizeof(BUFFER_HEADER) + BufferLength) = '\0';
+
+    //
+    // Set the next offset to write, the message is visible to the readers after
+    // this (interlocked) write
+    //
+    InterlockedExchange64((volatile LONG64 *)&BufferInformation->CurrentOffsetToWrite, OffsetToWrite + UnusedSize + RecordSize);
+    InterlockedExchange64((volatile LONG64 *)BufferInformation->SharedOffsetToWrite, OffsetToWrite + UnusedSize + RecordSize);
+
+    return TRUE;
+}
+
+/**
+ * @brief Copy a record to a batch of messages
+ * @details The message is saved as a LOG_BATCH_MESSAGE_HEADER followed
+ * by the message and a null-terminator, the record is not set as read
+ *
+ * @param Header The header of the record
+ * @param BufferToSaveMessages The batch of messages
+ * @param UsedLength The used length of the batch
+ * @param BufferSize Size of the batch
+ * @return UINT32 The used length of the message in the batch or zero
+ * if it doesn't fit
+ */
+UINT32
+LogCopyRecordToBatch(BUFFER_HEADER * Header, PVOID BufferToSaveMessages, UINT32 UsedLength, UINT32 BufferSize)
+{
+    PLOG_BATCH_MESSAGE_HEADER MessageHeader;
+
+    if (UsedLength + LOG_BATCH_MESSAGE_SIZE(Header->BufferLength) > BufferSize)
+    {
+        return 0;
+    }
+
+    MessageHeader                = (PLOG_BATCH_MESSAGE_HEADER)((UINT64)BufferToSaveMessages + UsedLength);
+    MessageHeader->OperationCode = Header->OpeationNumber;
+    MessageHeader->BufferLength  = Header->BufferLength;
+
+    RtlCopyMemory((PVOID)((UINT64)MessageHeader + sizeof(LOG_BATCH_MESSAGE_HEADER)),
+                  (PVOID)((UINT64)Header + sizeof(BUFFER_HEADER)),
+                  Header->BufferLength);
+
+    *(CHAR *)((UINT64)MessageHeader + sizeof(LOG_BATCH_MESSAGE_HEADER) + Header->BufferLength) = '\0';
+
+    return LOG_BATCH_MESSAGE_SIZE(Header->BufferLength);
+}
+
+/**
+ * @brief Routine that handles a message of the log buffers that are
+ * mapped to user-mode
+ *
+ */
+typedef VOID (*LOG_SHARED_MESSAGE_HANDLER)(PVOID Context, BUFFER_HEADER * Header);
+
+/**
+ * @brief Read the new messages of a pool (vmx-root or vmx non-root)
+ * from the buffers that are mapped to user-mode
+ * @details Messages of different cores are merged by their time stamps,
+ * the read offsets are set for the whole batch after handling them, the
+ * buffers are written by the kernel at the same time so the offsets of
+ * each buffer are checked before its messages are used
+ *
+ * @param Header The control page of the buffers
+ * @param ReaderPage The page of the read offsets
+ * @param Buffers The start address of the buffers
+ * @param FirstBuffer Index of the first buffer of the pool
+ * @param CountOfBuffers Count of buffers of the pool
+ * @param OffsetsToSend Array of CountOfBuffers offsets (used by this function)
+ * @param OffsetsToWrite Array of CountOfBuffers offsets (used by this function)
+ * @param Handler The routine that handles each message
+ * @param Context Parameter of the routine
+ * @return UINT32 Count of the handled messages
+ */
+UINT32
+LogReadSharedBuffers(PLOG_SHARED_BUFFERS_HEADER Header,
+                     PLOG_SHARED_READER_PAGE    ReaderPage,
+                     CHAR *                     Buffers,
+                     UINT32                     FirstBuffer,
+                     UINT32                     CountOfBuffers,
+                     UINT64 *                   OffsetsToSend,
+                     UINT64 *                   OffsetsToWrite,
+                     LOG_SHARED_MESSAGE_HANDLER Handler,
+                     PVOID                      Context)
+{
+    UINT32          BufferSize             = Header->BufferSize;
+    UINT32          CountOfHandledMessages = 0;
+    UINT32          OldestIndex;
+    BUFFER_HEADER * OldestRecord;
+    BUFFER_HEADER * Record;
+
+    //
+    // Take a snapshot of the offsets, the messages that are written after
+    // this point are read in the next batch
+    //
+    for (UINT32 i = 0; i < CountOfBuffers; i++)
+    {
+        OffsetsToSend[i]  = ReaderPage->CurrentOffsetToRead[FirstBuffer + i];
+        OffsetsToWrite[i] = Header->CurrentOffsetToWrite[FirstBuffer + i];
+    }
+
+    while (TRUE)
+    {
+        OldestRecord = NULL;
+        OldestIndex  = 0;
+
+        for (UINT32 i = 0; i < CountOfBuffers; i++)
+        {
+            Record = NULL;
+
+            while (OffsetsToSend[i] != OffsetsToWrite[i])
+            {
+                Record = (BUFFER_HEADER *)(Buffers + (UINT64)(FirstBuffer + i) * BufferSize + (OffsetsToSend[i] % BufferSize));
+
+                if (Record->BufferLength == 0)
+                {
+                    //
+                    // The rest of the buffer is not used
+                    //
+                    OffsetsToSend[i] += BufferSize - (OffsetsToSend[i] % BufferSize);
+                    Record = NULL;
+                    continue;
+                }
+
+                if (Record->BufferLength > PacketChunkSize ||
+                    OffsetsToWrite[i] - OffsetsToSend[i] > BufferSize)
+                {
+                    //
+                    // The offsets are not valid, discard the messages of this buffer
+                    //
+                    OffsetsToSend[i] = OffsetsToWrite[i];
+                    Record           = NULL;
+                }
+
+                break;
+            }
+
+            if (Record != NULL && (OldestRecord == NULL || Record->TimeStamp < OldestRecord->TimeStamp))
+            {
+                OldestRecord = Record;
+                OldestIndex  = i;
+            }
+        }
+
+        if (OldestRecord == NULL)
+        {
+            //
+            // Nothing is remained in this batch
+            //
+            break;
+        }
+
+        Handler(Context, OldestRecord);
+
+        OffsetsToSend[OldestIndex] += LOG_RECORD_SIZE(OldestRecord->BufferLength);
+        CountOfHandledMessages++;
+    }
+
+    //
+    // Free the space of the handled messages for the kernel
+    //
+    for (UINT32 i = 0; i < CountOfBuffers; i++)
+    {
+        InterlockedExchange64((volatile LONG64 *)&ReaderPage->CurrentOffsetToRead[FirstBuffer + i], OffsetsToSend[i]);
+    }
+
+    return CountOfHandledMessages;
+}
+
+/**
+ * @brief Arm the doorbell of the buffers that are mapped to user-mode
+ * @details The kernel rings the doorbell (and disarms it) after writing
+ * a message if it's armed, the buffers are checked again after arming
+ * it, otherwise a message that is written after the last read but
+ * before arming the doorbell is not read until the next message
+ *
+ * @param Header The control page of the buffers
+ * @param ReaderPage The page of the read offsets
+ * @return BOOLEAN TRUE if there is no unread message and the reader
+ * should wait for the doorbell
+ */
+BOOLEAN
+LogArmDoorbell(PLOG_SHARED_BUFFERS_HEADER Header, PLOG_SHARED_READER_PAGE ReaderPage)
+{
+    InterlockedExchange(&ReaderPage->DoorbellArmed, TRUE);
+
+    for (UINT32 i = 0; i < Header->CountOfBuffers; i++)
+    {
+        if (ReaderPage->CurrentOffsetToRead[i] != Header->CurrentOffsetToWrite[i])
+        {
+            return FALSE;
+        }
+    }
+
+    return TRUE;
+}
@@ -0,0 +1,322 @@
+/**
+ * @file PoolManagerCaches.h
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief The free lists and the per-core caches of the pool manager
+ * @details Adding the pools, giving them to the callers and marking them
+ * to be freed, the hypervisor and the benchmarks use the same code, this
+ * header should be included once in each module and the module should
+ * define the routines and the variables below
+ * @version 0.1
+ * @date 2021-11-25
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+//////////////////////////////////////////////////
+//	   Routines that the module should define   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Get the count of cores that have a cache
+ *
+ * @return UINT32
+ */
+UINT32
+PoolManagerGetCountOfCores();
+
+/**
+ * @brief Get the index of the current core
+ *
+ * @return UINT32
+ */
+UINT32
+PoolManagerGetCurrentCore();
+
+/**
+ * @brief Acquire a spinlock
+ *
+ * @param Lock
+ * @return VOID
+ */
+void
+SpinlockLock(volatile LONG * Lock);
+
+/**
+ * @brief Release a spinlock
+ *
+ * @param Lock
+ * @return VOID
+ */
+void
+SpinlockUnlock(volatile LONG * Lock);
+
+//////////////////////////////////////////////////
+//	  Variables that the module should define   //
+//////////////////////////////////////////////////
+
+extern volatile LONG            LockForReadingPool;
+extern BOOLEAN                  g_IsNewRequestForDeAllocation;
+extern LIST_ENTRY               g_ListOfAllocatedPoolsHead;
+extern LIST_ENTRY               g_PoolManagerFreeListsHead[POOL_MANAGER_MAXIMUM_INTENTIONS];
+extern LIST_ENTRY               g_ListOfPoolsToBeFreedHead;
+extern LIST_ENTRY               g_PoolManagerAddressHashHeads[PoolManagerAddressHashBuckets];
+extern PPOOL_MANAGER_CORE_CACHE g_PoolManagerCoreCaches;
+
+//////////////////////////////////////////////////
+//			   Free Lists and Caches            //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Compute the bucket of a pool address
+ *
+ * @param Address The pool address
+ * @return UINT32 Index of the bucket in g_PoolManagerAddressHashHeads
+ */
+UINT32
+PoolManagerHashAddress(UINT64 Address)
+{
+    //
+    // Pools are at least 16 byte aligned, Fibonacci hashing spreads the rest
+    //
+    return (UINT32)(((Address >> 4) * 0x9E3779B97F4A7C15ull) >> 32) & (PoolManagerAddressHashBuckets - 1);
+}
+
+/**
+ * @brief Add a new pool to the list of pools, the hash table of
+ * addresses and the free list of its intention
+ *
+ * @param SinglePool The pool (not busy)
+ * @return VOID
+ */
+VOID
+PoolManagerAddPool(PPOOL_TABLE SinglePool)
+{
+    //
+    // Pools might be requested from vmx-root meanwhile
+    //
+    SpinlockLock(&LockForReadingPool);
+
+    InsertHeadList(&g_ListOfAllocatedPoolsHead, &(SinglePool->PoolsList));
+    InsertHeadList(&g_PoolManagerAddressHashHeads[PoolManagerHashAddress(SinglePool->Address)], &(SinglePool->AddressHashList));
+    InsertTailList(&g_PoolManagerFreeListsHead[SinglePool->Intention], &(SinglePool->StateList));
+
+    SpinlockUnlock(&LockForReadingPool);
+}
+
+/**
+ * @brief Add a pool that is given to a caller to the list of pools
+ * to be freed
+ *
+ * @param AddressToFree The pool address that was previously obtained from the pool manager
+ * @return BOOLEAN If the address was already in the list of allocated pools by pool
+ * manager and it's given to a caller (busy) then it returns TRUE; otherwise, FALSE
+ */
+BOOLEAN
+PoolManagerMarkPoolToBeFreed(UINT64 AddressToFree)
+{
+    PLIST_ENTRY ListTemp = 0;
+    PLIST_ENTRY ListHead = 0;
+    BOOLEAN     Result   = FALSE;
+    ListHead             = &g_PoolManagerAddressHashHeads[PoolManagerHashAddress(AddressToFree)];
+    ListTemp             = ListHead;
+
+    SpinlockLock(&LockForReadingPool);
+
+    while (ListHead != ListTemp->Flink)
+    {
+        ListTemp = ListTemp->Flink;
+
+        //
+        // Get the head of the record
+        //
+        PPOOL_TABLE PoolTable = (PPOOL_TABLE)CONTAINING_RECORD(ListTemp, POOL_TABLE, AddressHashList);
+
+        if (PoolTable->Address == AddressToFree)
+        {
+            //
+            // We found an entry that matched the detailed from
+            // previously allocated pools, only the pools that are given to the
+            // callers (busy) can be freed, these pools are neither in the free
+            // list of their intention nor in the caches of cores
+            //
+            if (PoolTable->IsBusy && !PoolTable->ShouldBeFreed)
+            {
+                PoolTable->ShouldBeFreed = TRUE;
+                InsertTailList(&g_ListOfPoolsToBeFreedHead, &PoolTable->StateList);
+
+                g_IsNewRequestForDeAllocation = TRUE;
+                Result                        = TRUE;
+            }
+            break;
+        }
+    }
+
+    SpinlockUnlock(&LockForReadingPool);
+
+    return Result;
+}
+
+/**
+ * @brief Fill the cache of the current core from the free list of an intention
+ * and get a pool for the caller
+ *
+ * @param CoreCache The cache of the current core
+ * @param Intention The intention why we need this pool for (buffer tag)
+ * @return PPOOL_TABLE Returns a pool for the caller or NULL if the free list is empty
+ */
+PPOOL_TABLE
+PoolManagerRefillCoreCache(PPOOL_MANAGER_CORE_CACHE CoreCache, POOL_ALLOCATION_INTENTION Intention)
+{
+    PPOOL_TABLE PoolTable = NULL;
+    PPOOL_TABLE CachedPool;
+    PLIST_ENTRY FreeList = &g_PoolManagerFreeListsHead[Intention];
+    UINT64      Tsc      = __rdtsc();
+
+    SpinlockLock(&LockForReadingPool);
+
+    if (!IsListEmpty(FreeList))
+    {
+        PoolTable = CONTAINING_RECORD(RemoveHeadList(FreeList), POOL_TABLE, StateList);
+
+        for (size_t i = 0; i < PoolManagerPerCoreCacheSize && !IsListEmpty(FreeList); i++)
+        {
+            CachedPool = CONTAINING_RECORD(FreeList->Flink, POOL_TABLE, StateList);
+
+            if (InterlockedCompareExchangePointer((PVOID volatile *)&CoreCache->Pools[Intention][i], CachedPool, NULL) == NULL)
+            {
+                RemoveEntryList(&CachedPool->StateList);
+            }
+        }
+    }
+
+    SpinlockUnlock(&LockForReadingPool);
+
+    InterlockedIncrement64((LONG64 *)&CoreCache->Statistics.Refills);
+    InterlockedAdd64((LONG64 *)&CoreCache->Statistics.RefillCycles, __rdtsc() - Tsc);
+
+    return PoolTable;
+}
+
+/**
+ * @brief Take a pool of an intention from the cache of other cores
+ * @details It's used when the free list of the intention is empty but
+ * other cores still have pools of this intention in their caches
+ *
+ * @param Intention The intention why we need this pool for (buffer tag)
+ * @return PPOOL_TABLE Returns a pool or NULL if there is no pool of this intention
+ */
+PPOOL_TABLE
+PoolManagerStealFromCoreCaches(POOL_ALLOCATION_INTENTION Intention)
+{
+    PPOOL_TABLE PoolTable    = NULL;
+    UINT32      CountOfCores = PoolManagerGetCountOfCores();
+
+    for (size_t i = 0; i < CountOfCores; i++)
+    {
+        for (size_t j = 0; j < PoolManagerPerCoreCacheSize; j++)
+        {
+            PoolTable = (PPOOL_TABLE)InterlockedExchangePointer((PVOID volatile *)&g_PoolManagerCoreCaches[i].Pools[Intention][j], NULL);
+
+            if (PoolTable != NULL)
+            {
+                return PoolTable;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Take a pool of an intention and give it to the caller (busy)
+ * @details The pool is taken from the cache of the current core without
+ * any lock, if the cache is empty then the cache is refilled from the free
+ * list of the intention, and if the free list is also empty then the pool
+ * is taken from the cache of other cores
+ *
+ * @param Intention The intention why we need this pool for (buffer tag)
+ * @return PPOOL_TABLE Returns a pool or NULL if there is no pool of this intention
+ */
+PPOOL_TABLE
+PoolManagerTakePool(POOL_ALLOCATION_INTENTION Intention)
+{
+    PPOOL_TABLE              PoolTable = NULL;
+    PPOOL_MANAGER_CORE_CACHE CoreCache = &g_PoolManagerCoreCaches[PoolManagerGetCurrentCore()];
+
+    //
+    // Even if the thread is moved to another core (vmx non-root), the slots
+    // of the caches are only taken and filled by interlocked operations
+    //
+    for (size_t i = 0; i < PoolManagerPerCoreCacheSize; i++)
+    {
+        PoolTable = (PPOOL_TABLE)InterlockedExchangePointer((PVOID volatile *)&CoreCache->Pools[Intention][i], NULL);
+
+        if (PoolTable != NULL)
+        {
+            InterlockedIncrement64((LONG64 *)&CoreCache->Statistics.CacheHits);
+            break;
+        }
+    }
+
+    if (PoolTable == NULL)
+    {
+        InterlockedIncrement64((LONG64 *)&CoreCache->Statistics.CacheMisses);
+
+        PoolTable = PoolManagerRefillCoreCache(CoreCache, Intention);
+
+        if (PoolTable == NULL)
+        {
+            PoolTable = PoolManagerStealFromCoreCaches(Intention);
+
+            if (PoolTable != NULL)
+            {
+                InterlockedIncrement64((LONG64 *)&CoreCache->Statistics.Steals);
+            }
+            else
+            {
+                InterlockedIncrement64((LONG64 *)&CoreCache->Statistics.Failures);
+            }
+        }
+    }
+
+    if (PoolTable != NULL)
+    {
+        PoolTable->IsBusy = TRUE;
+    }
+
+    return PoolTable;
+}
+
+/**
+ * @brief Get the sum of the counters of the pool manager on all cores
+ *
+ * @param Statistics The buffer to save the counters
+ * @return VOID
+ */
+VOID
+PoolManagerQueryStatistics(PPOOL_MANAGER_STATISTICS Statistics)
+{
+    UINT32 CountOfCores = PoolManagerGetCountOfCores();
+
+    RtlZeroMemory(Statistics, sizeof(POOL_MANAGER_STATISTICS));
+
+    if (g_PoolManagerCoreCaches == NULL)
+    {
+        //
+        // The pool manager is not initialized (vmm is not loaded)
+        //
+        return;
+    }
+
+    for (size_t i = 0; i < CountOfCores; i++)
+    {
+        Statistics->CacheHits += g_PoolManagerCoreCaches[i].Statistics.CacheHits;
+        Statistics->CacheMisses += g_PoolManagerCoreCaches[i].Statistics.CacheMisses;
+        Statistics->Refills += g_PoolManagerCoreCaches[i].Statistics.Refills;
+        Statistics->RefillCycles += g_PoolManagerCoreCaches[i].Statistics.RefillCycles;
+        Statistics->Steals += g_PoolManagerCoreCaches[i].Statistics.Steals;
+        Statistics->Failures += g_PoolManagerCoreCaches[i].Statistics.Failures;
+    }
+}
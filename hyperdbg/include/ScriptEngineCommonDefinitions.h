@@ -20,6 +20,7 @@ typedef struct ACTION_BUFFER {
   long long unsigned Tag;
   long long unsigned CurrentAction;
   char ImmediatelySendTheResults;
+  char DeferredFormatting;
   long long unsigned Context;
 } ACTION_BUFFER, *PACTION_BUFFER;
 
@@ -38,6 +39,31 @@ typedef struct ACTION_BUFFER {
 #define INVALID -99
 #define LALR_ACCEPT 99
 
+#define SYMBOL_PRINTF_POSITION_SHIFT 32
+#define SYMBOL_PRINTF_POSITION_MASK 0xffff
+#define SYMBOL_PRINTF_FORMAT_SHIFT 48
+#define SYMBOL_PRINTF_FORMAT_MASK 0xff
+#define SYMBOL_PRINTF_LENGTH_SHIFT 56
+#define SYMBOL_PRINTF_LENGTH_MASK 0xff
+
+#define PRINTF_FORMAT_INVALID 0
+#define PRINTF_FORMAT_DECIMAL32 1
+#define PRINTF_FORMAT_UNSIGNED32 2
+#define PRINTF_FORMAT_OCTAL32 3
+#define PRINTF_FORMAT_HEX32 4
+#define PRINTF_FORMAT_DECIMAL16 5
+#define PRINTF_FORMAT_UNSIGNED16 6
+#define PRINTF_FORMAT_OCTAL16 7
+#define PRINTF_FORMAT_HEX16 8
+#define PRINTF_FORMAT_DECIMAL64 9
+#define PRINTF_FORMAT_UNSIGNED64 10
+#define PRINTF_FORMAT_OCTAL64 11
+#define PRINTF_FORMAT_HEX64 12
+#define PRINTF_FORMAT_CHAR 13
+#define PRINTF_FORMAT_POINTER 14
+#define PRINTF_FORMAT_STRING 15
+#define PRINTF_FORMAT_WSTRING 16
+
 
 
 #define FUNC_INC 0
@@ -109,28 +135,38 @@ typedef struct ACTION_BUFFER {
 #define FUNC_EQ 66
 #define FUNC_INTERLOCKED_EXCHANGE 67
 #define FUNC_INTERLOCKED_EXCHANGE_ADD 68
-#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 69
-#define FUNC_POI 70
-#define FUNC_DB 71
-#define FUNC_DD 72
-#define FUNC_DW 73
-#define FUNC_DQ 74
-#define FUNC_NEG 75
-#define FUNC_HI 76
-#define FUNC_LOW 77
-#define FUNC_NOT 78
-#define FUNC_CHECK_ADDRESS 79
-#define FUNC_STRLEN 80
-#define FUNC_WCSLEN 81
-#define FUNC_INTERLOCKED_INCREMENT 82
-#define FUNC_INTERLOCKED_DECREMENT 83
-#define FUNC_REF 84
-#define FUNC_ED 85
-#define FUNC_EB 86
-#define FUNC_EQ 87
-#define FUNC_INTERLOCKED_EXCHANGE 88
-#define FUNC_INTERLOCKED_EXCHANGE_ADD 89
-#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 90
+#define FUNC_MAP_COUNT 69
+#define FUNC_MAP_HIST 70
+#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 71
+#define FUNC_MAP_SUM 72
+#define FUNC_MAP_MIN 73
+#define FUNC_MAP_MAX 74
+#define FUNC_POI 75
+#define FUNC_DB 76
+#define FUNC_DD 77
+#define FUNC_DW 78
+#define FUNC_DQ 79
+#define FUNC_NEG 80
+#define FUNC_HI 81
+#define FUNC_LOW 82
+#define FUNC_NOT 83
+#define FUNC_CHECK_ADDRESS 84
+#define FUNC_STRLEN 85
+#define FUNC_WCSLEN 86
+#define FUNC_INTERLOCKED_INCREMENT 87
+#define FUNC_INTERLOCKED_DECREMENT 88
+#define FUNC_REF 89
+#define FUNC_ED 90
+#define FUNC_EB 91
+#define FUNC_EQ 92
+#define FUNC_INTERLOCKED_EXCHANGE 93
+#define FUNC_INTERLOCKED_EXCHANGE_ADD 94
+#define FUNC_MAP_COUNT 95
+#define FUNC_MAP_HIST 96
+#define FUNC_INTERLOCKED_COMPARE_EXCHANGE 97
+#define FUNC_MAP_SUM 98
+#define FUNC_MAP_MIN 99
+#define FUNC_MAP_MAX 100
 typedef enum REGS_ENUM {
 	REGISTER_RAX = 0,
 	REGISTER_EAX = 1,
@@ -153,9 +153,10 @@ typedef unsigned __int64 UINT64, *PUINT64;
  */
 typedef struct _SCRIPT_ENGINE_VARIABLES_LIST
 {
-    UINT64 * TempList;
-    UINT64 * GlobalVariablesList;
-    UINT64 * LocalVariablesList;
+    UINT64 *                        TempList;
+    UINT64 *                        GlobalVariablesList;
+    UINT64 *                        LocalVariablesList;
+    PSCRIPT_ENGINE_AGGREGATION_MAPS AggregationMaps;
 
 } SCRIPT_ENGINE_VARIABLES_LIST, *PSCRIPT_ENGINE_VARIABLES_LIST;
 
@@ -188,6 +189,19 @@ typedef struct _GUEST_REGS
 } GUEST_REGS, *PGUEST_REGS;
 #endif
 
+/**
+ * @brief Location of a general-purpose register (or a part of it)
+ * in the GUEST_REGS
+ *
+ */
+typedef struct _SCRIPT_ENGINE_GP_REGISTER
+{
+    UINT32 Offset; // byte offset of the 64-bit register in GUEST_REGS
+    UINT32 Shift;
+    UINT64 Mask;
+
+} SCRIPT_ENGINE_GP_REGISTER, *PSCRIPT_ENGINE_GP_REGISTER;
+
 //////////////////////////////////////////////////
 //            	     Imports                    //
 //////////////////////////////////////////////////
@@ -198,6 +212,12 @@ __declspec(dllimport) PSYMBOL_BUFFER ScriptEngineParse(char * str);
 __declspec(dllimport) void PrintSymbolBuffer(const PSYMBOL_BUFFER SymbolBuffer);
 __declspec(dllimport) void PrintSymbol(PSYMBOL Symbol);
 __declspec(dllimport) void RemoveSymbolBuffer(PSYMBOL_BUFFER SymbolBuffer);
+__declspec(dllimport) void ScriptEngineGetOptimizerStatistics(unsigned int * CountOfInstructions,
+                                                              unsigned int * CountOfOptimizedInstructions);
+__declspec(dllimport) void ScriptEngineSetOptimizer(int IsEnabled);
+__declspec(dllimport) void ScriptEngineGetParserStatistics(unsigned int *       CountOfAllocations,
+                                                           unsigned int *       CountOfArenaChunks,
+                                                           unsigned long long * AllocatedBytes);
 
 //
 // pdb parser
@@ -1114,6 +1134,205 @@ ScriptEngineFunctionInterlockedCompareExchange(
     return Result;
 }
 
+//
+// Aggregation maps
+//
+
+/**
+ * @brief Find the entry of a key in an aggregation map
+ * @details The maps are never more than 3/4 full, so there is always
+ * an empty entry at the end of the probe sequence
+ *
+ * @param Map
+ * @param Key
+ * @return PSCRIPT_ENGINE_AGGREGATION_ENTRY The entry of the key or the
+ * empty entry that the key should be placed in
+ */
+PSCRIPT_ENGINE_AGGREGATION_ENTRY
+ScriptEngineAggregationFindEntry(PSCRIPT_ENGINE_AGGREGATION_MAP Map, UINT64 Key)
+{
+    PSCRIPT_ENGINE_AGGREGATION_ENTRY Entry;
+    UINT32                           Index;
+
+    Index = (UINT32)((Key * 0x9e3779b97f4a7c15) >> 32) & (SCRIPT_ENGINE_AGGREGATION_MAP_ENTRIES - 1);
+
+    while (TRUE)
+    {
+        Entry = &Map->Entries[Index];
+
+        if (!Entry->IsUsed || Entry->Key == Key)
+        {
+            return Entry;
+        }
+
+        Index = (Index + 1) & (SCRIPT_ENGINE_AGGREGATION_MAP_ENTRIES - 1);
+    }
+}
+
+/**
+ * @brief Aggregate a value into the entry of a key in an aggregation map
+ * @details Counts and histograms aggregate the count of updates (which
+ * is passed as the value), new keys are dropped if the map is full
+ *
+ * @param Map
+ * @param Type The kind of the aggregation (SCRIPT_ENGINE_AGGREGATION_TYPE)
+ * @param Key
+ * @param Value
+ * @param Result The aggregated value of the key
+ * @return BOOLEAN FALSE if the map is used by another kind of aggregation
+ */
+BOOLEAN
+ScriptEngineAggregationUpdate(PSCRIPT_ENGINE_AGGREGATION_MAP Map, UINT32 Type, UINT64 Key, UINT64 Value, UINT64 * Result)
+{
+    PSCRIPT_ENGINE_AGGREGATION_ENTRY Entry;
+
+    if (Map->Type == SCRIPT_ENGINE_AGGREGATION_TYPE_UNUSED)
+    {
+        Map->Type = Type;
+    }
+    else if (Map->Type != Type)
+    {
+        return FALSE;
+    }
+
+    Entry = ScriptEngineAggregationFindEntry(Map, Key);
+
+    if (!Entry->IsUsed)
+    {
+        if (Map->CountOfEntries >= SCRIPT_ENGINE_AGGREGATION_MAP_ENTRIES / 4 * 3)
+        {
+            Map->CountOfDroppedUpdates++;
+            *Result = 0;
+            return TRUE;
+        }
+
+        Entry->Key    = Key;
+        Entry->Value  = Value;
+        Entry->IsUsed = TRUE;
+        Map->CountOfEntries++;
+    }
+    else if (Type == SCRIPT_ENGINE_AGGREGATION_TYPE_MIN)
+    {
+        if ((INT64)Value < (INT64)Entry->Value)
+        {
+            Entry->Value = Value;
+        }
+    }
+    else if (Type == SCRIPT_ENGINE_AGGREGATION_TYPE_MAX)
+    {
+        if ((INT64)Value > (INT64)Entry->Value)
+        {
+            Entry->Value = Value;
+        }
+    }
+    else
+    {
+        Entry->Value += Value;
+    }
+
+    *Result = Entry->Value;
+
+    return TRUE;
+}
+
+/**
+ * @brief Merge an aggregation map of a core into another map
+ * @details Keys that can't be merged (the map is full or it's used by
+ * another kind of aggregation) are counted as dropped updates
+ *
+ * @param Destination
+ * @param Source
+ * @return VOID
+ */
+VOID
+ScriptEngineAggregationMergeMap(PSCRIPT_ENGINE_AGGREGATION_MAP Destination, PSCRIPT_ENGINE_AGGREGATION_MAP Source)
+{
+    UINT64 Result;
+
+    if (Source->Type == SCRIPT_ENGINE_AGGREGATION_TYPE_UNUSED)
+    {
+        return;
+    }
+
+    Destination->CountOfDroppedUpdates += Source->CountOfDroppedUpdates;
+
+    for (UINT32 i = 0; i < SCRIPT_ENGINE_AGGREGATION_MAP_ENTRIES; i++)
+    {
+        if (Source->Entries[i].IsUsed &&
+            !ScriptEngineAggregationUpdate(Destination,
+                                           Source->Type,
+                                           Source->Entries[i].Key,
+                                           Source->Entries[i].Value,
+                                           &Result))
+        {
+            Destination->CountOfDroppedUpdates++;
+        }
+    }
+}
+
+/**
+ * @brief Merge the aggregation maps of a core into another set of maps
+ *
+ * @param Destination
+ * @param Source
+ * @return VOID
+ */
+VOID
+ScriptEngineAggregationMerge(PSCRIPT_ENGINE_AGGREGATION_MAPS Destination, PSCRIPT_ENGINE_AGGREGATION_MAPS Source)
+{
+    for (UINT32 i = 0; i < SCRIPT_ENGINE_AGGREGATION_MAXIMUM_MAPS; i++)
+    {
+        ScriptEngineAggregationMergeMap(&Destination->Maps[i], &Source->Maps[i]);
+    }
+}
+
+/**
+ * @brief Get the bucket of a value in histograms (0 for zero and n
+ * for the values in [2^(n-1), 2^n))
+ *
+ * @param Value
+ * @return UINT64
+ */
+UINT64
+ScriptEngineAggregationGetHistogramBucket(UINT64 Value)
+{
+    UINT64 Bucket = 0;
+
+    while (Value != 0)
+    {
+        Bucket++;
+        Value >>= 1;
+    }
+
+    return Bucket;
+}
+
+// map_count, map_sum, map_min, map_max and map_hist
+UINT64
+ScriptEngineFunctionMapUpdate(PSCRIPT_ENGINE_AGGREGATION_MAPS Maps,
+                              UINT64                          MapIndex,
+                              UINT32                          Type,
+                              UINT64                          Key,
+                              UINT64                          Value,
+                              BOOL *                          HasError)
+{
+    UINT64 Result = 0;
+
+    if (Maps == NULL || MapIndex >= SCRIPT_ENGINE_AGGREGATION_MAXIMUM_MAPS)
+    {
+        *HasError = TRUE;
+        return NULL;
+    }
+
+    if (!ScriptEngineAggregationUpdate(&Maps->Maps[MapIndex], Type, Key, Value, &Result))
+    {
+        *HasError = TRUE;
+        return NULL;
+    }
+
+    return Result;
+}
+
 // enable_event
 VOID
 ScriptEngineFunctionEnableEvent(UINT64  Tag,
@@ -1279,33 +1498,111 @@ CheckIfStringIsSafe(UINT64 StrAddr, BOOLEAN IsWstring)
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 }
 
-VOID
-ApplyFormatSpecifier(const CHAR * CurrentSpecifier, CHAR * FinalBuffer, PUINT32 CurrentProcessedPositionFromStartOfFormat, PUINT32 CurrentPositionInFinalBuffer, UINT64 Val, UINT32 SizeOfFinalBuffer)
+/**
+ * @brief Render a number by the kind of its format specifier (without
+ * parsing the specifier)
+ *
+ * @param Format PRINTF_FORMAT_*
+ * @param Val
+ * @param Buffer At least 24 characters, not null terminated
+ * @return UINT32 Count of the rendered characters
+ */
+UINT32
+ScriptEngineFormatNumber(UINT32 Format, UINT64 Val, CHAR * Buffer)
 {
-    UINT32 TempBufferLen      = 0;
-    CHAR   TempBuffer[50 + 1] = {
-        0}; // Maximum uint64_t is 18446744073709551615 + 1 thus its 20 character
-              // for maximum buffer + 1 end char null but we alloc 50 to be sure
-
-    *CurrentProcessedPositionFromStartOfFormat =
-        *CurrentProcessedPositionFromStartOfFormat + strlen(CurrentSpecifier);
-    sprintf(TempBuffer, CurrentSpecifier, Val);
-    TempBufferLen = strlen(TempBuffer);
+    CHAR         Digits[24]; // 64-bit octal is 22 digits
+    UINT32       CountOfDigits  = 0;
+    UINT32       MinimumDigits  = 1;
+    UINT32       Base           = 10;
+    UINT32       Length         = 0;
+    BOOLEAN      IsNegative     = FALSE;
+    const CHAR * DigitsOfNumber = "0123456789abcdef";
 
     //
-    // Check final buffer capacity
+    // The value is truncated (or sign extended) to the size of the
+    // specifier, the same as passing it to sprintf
     //
-    if (*CurrentPositionInFinalBuffer + TempBufferLen > SizeOfFinalBuffer)
+    switch (Format)
     {
+    case PRINTF_FORMAT_DECIMAL32:
+        IsNegative = (INT32)Val < 0;
+        Val        = IsNegative ? (UINT64)(-(INT64)(INT32)Val) : (UINT32)Val;
+        break;
+    case PRINTF_FORMAT_UNSIGNED32:
+        Val = (UINT32)Val;
+        break;
+    case PRINTF_FORMAT_OCTAL32:
+        Val  = (UINT32)Val;
+        Base = 8;
+        break;
+    case PRINTF_FORMAT_HEX32:
+        Val  = (UINT32)Val;
+        Base = 16;
+        break;
+    case PRINTF_FORMAT_DECIMAL16:
+        IsNegative = (INT16)Val < 0;
+        Val        = IsNegative ? (UINT64)(-(INT64)(INT16)Val) : (UINT16)Val;
+        break;
+    case PRINTF_FORMAT_UNSIGNED16:
+        Val = (UINT16)Val;
+        break;
+    case PRINTF_FORMAT_OCTAL16:
+        Val  = (UINT16)Val;
+        Base = 8;
+        break;
+    case PRINTF_FORMAT_HEX16:
+        Val  = (UINT16)Val;
+        Base = 16;
+        break;
+    case PRINTF_FORMAT_DECIMAL64:
+        IsNegative = (INT64)Val < 0;
+        Val        = IsNegative ? 0 - Val : Val;
+        break;
+    case PRINTF_FORMAT_UNSIGNED64:
+        break;
+    case PRINTF_FORMAT_OCTAL64:
+        Base = 8;
+        break;
+    case PRINTF_FORMAT_HEX64:
+        Base = 16;
+        break;
+    case PRINTF_FORMAT_POINTER:
+
         //
-        // Over passed buffer
+        // Pointers are shown like 000000000000ABCD
         //
-        return;
+        Base           = 16;
+        MinimumDigits  = 16;
+        DigitsOfNumber = "0123456789ABCDEF";
+        break;
+    case PRINTF_FORMAT_CHAR:
+
+        //
+        // A null character ends the string, so nothing is added
+        //
+        Buffer[0] = (CHAR)Val;
+        return Buffer[0] != '\0' ? 1 : 0;
+    default:
+        return 0;
+    }
+
+    do
+    {
+        Digits[CountOfDigits++] = DigitsOfNumber[Val % Base];
+        Val /= Base;
+    } while (Val != 0 || CountOfDigits < MinimumDigits);
+
+    if (IsNegative)
+    {
+        Buffer[Length++] = '-';
     }
 
-    memcpy(&FinalBuffer[*CurrentPositionInFinalBuffer], TempBuffer, TempBufferLen);
+    while (CountOfDigits != 0)
+    {
+        Buffer[Length++] = Digits[--CountOfDigits];
+    }
 
-    *CurrentPositionInFinalBuffer = *CurrentPositionInFinalBuffer + TempBufferLen;
+    return Length;
 }
 
 size_t
@@ -1339,7 +1636,7 @@ WcharToChar(const wchar_t * src, char * dest, size_t dest_len)
 }
 
 BOOLEAN
-ApplyStringFormatSpecifier(const CHAR * CurrentSpecifier, CHAR * FinalBuffer, PUINT32 CurrentProcessedPositionFromStartOfFormat, PUINT32 CurrentPositionInFinalBuffer, UINT64 Val, BOOLEAN IsWstring, UINT32 SizeOfFinalBuffer)
+ApplyStringFormatSpecifier(CHAR * FinalBuffer, PUINT32 CurrentPositionInFinalBuffer, UINT64 Val, BOOLEAN IsWstring, UINT32 SizeOfFinalBuffer)
 {
     UINT32  StringSize;
     wchar_t WstrBuffer[50];
@@ -1357,20 +1654,15 @@ ApplyStringFormatSpecifier(const CHAR * CurrentSpecifier, CHAR * FinalBuffer, PU
         return FALSE;
     }
 
-    //
-    // get the length of the string (format) identifier
-    //
-    *CurrentProcessedPositionFromStartOfFormat += strlen(CurrentSpecifier);
-
     //
     // Get string len
     //
     StringSize = CustomStrlen(Val, IsWstring);
 
     //
-    // Check final buffer capacity
+    // Check final buffer capacity (one character is kept for the null)
     //
-    if (*CurrentPositionInFinalBuffer + StringSize > SizeOfFinalBuffer)
+    if (*CurrentPositionInFinalBuffer + StringSize >= SizeOfFinalBuffer)
     {
         //
         // Over passed buffer
@@ -1485,333 +1777,419 @@ ApplyStringFormatSpecifier(const CHAR * CurrentSpecifier, CHAR * FinalBuffer, PU
     return TRUE;
 }
 
-VOID
-ScriptEngineFunctionPrintf(PGUEST_REGS                    GuestRegs,
-                           ACTION_BUFFER                  ActionDetail,
-                           SCRIPT_ENGINE_VARIABLES_LIST * VariablesList,
-                           UINT64                         Tag,
-                           BOOLEAN                        ImmediateMessagePassing,
-                           char *                         Format,
-                           UINT64                         ArgCount,
-                           PSYMBOL                        FirstArg,
-                           BOOLEAN *                      HasError)
+/**
+ * @brief Render the result of printf, the format specifiers are parsed
+ * once by the parser so here the literals are copied and the arguments
+ * are rendered
+ *
+ * @param GuestRegs
+ * @param ActionDetail
+ * @param VariablesList
+ * @param Format
+ * @param ArgCount
+ * @param FirstArg
+ * @param FinalBuffer
+ * @param SizeOfFinalBuffer
+ * @param HasError
+ * @return UINT32 Length of the result (without the null character)
+ */
+UINT32
+ScriptEngineFormatPrintf(PGUEST_REGS                    GuestRegs,
+                         ACTION_BUFFER                  ActionDetail,
+                         SCRIPT_ENGINE_VARIABLES_LIST * VariablesList,
+                         char *                         Format,
+                         UINT64                         ArgCount,
+                         PSYMBOL                        FirstArg,
+                         char *                         FinalBuffer,
+                         UINT32                         SizeOfFinalBuffer,
+                         BOOLEAN *                      HasError)
 {
-    //
-    // The printf function
-    //
-
-    char    FinalBuffer[PacketChunkSize]              = {0};
-    UINT32  CurrentPositionInFinalBuffer              = 0;
-    UINT32  CurrentProcessedPositionFromStartOfFormat = 0;
-    BOOLEAN WithoutAnyFormatSpecifier                 = TRUE;
-
-    UINT64  Val;
+    UINT32  CurrentPositionInFinalBuffer = 0;
+    UINT32  CurrentPositionInFormat      = 0;
+    UINT32  LenOfFormat                  = (UINT32)strlen(Format);
     UINT32  Position;
-    UINT32  LenOfFormats = strlen(Format) + 1;
+    UINT32  FormatSpecifier;
+    UINT32  FormatSpecifierLength;
+    UINT32  Length;
+    UINT64  Val;
     PSYMBOL Symbol;
+    SYMBOL  TempSymbol;
+    CHAR    NumberBuffer[24];
 
     *HasError = FALSE;
 
-    for (int i = 0; i < ArgCount; i++)
+    for (UINT64 i = 0; i < ArgCount; i++)
     {
-        WithoutAnyFormatSpecifier = FALSE;
-        Symbol                    = FirstArg + i;
-
         //
-        // Address is either wstring (%ws) or string (%s)
+        // The parser keeps the kind, the position and the length of the
+        // format specifier of each argument in its type
         //
+        Symbol                = FirstArg + i;
+        Position              = (UINT32)(Symbol->Type >> SYMBOL_PRINTF_POSITION_SHIFT) & SYMBOL_PRINTF_POSITION_MASK;
+        FormatSpecifier       = (UINT32)(Symbol->Type >> SYMBOL_PRINTF_FORMAT_SHIFT) & SYMBOL_PRINTF_FORMAT_MASK;
+        FormatSpecifierLength = (UINT32)(Symbol->Type >> SYMBOL_PRINTF_LENGTH_SHIFT) & SYMBOL_PRINTF_LENGTH_MASK;
 
-        Position = (Symbol->Type >> 32) + 1;
-
-        SYMBOL TempSymbol = {0};
-        memcpy(&TempSymbol, Symbol, sizeof(SYMBOL));
-        TempSymbol.Type &= 0x7fffffff;
-
-        Val = GetValue(GuestRegs, ActionDetail, VariablesList, &TempSymbol, FALSE);
-
-        CHAR PercentageChar = Format[Position];
-
-        /*
-    printf("position = %d is %c%c \n", Position, PercentageChar,
-           IndicatorChar1);
-           */
-
-        if (CurrentProcessedPositionFromStartOfFormat != Position)
+        if (FormatSpecifier == PRINTF_FORMAT_INVALID)
         {
             //
-            // There is some strings before this format specifier
-            // we should move it to the buffer
-            //
-            UINT32 StringLen = Position - CurrentProcessedPositionFromStartOfFormat;
-
-            //
-            // Check final buffer capacity
+            // More arguments than format specifiers
             //
-            if (CurrentPositionInFinalBuffer + StringLen < sizeof(FinalBuffer))
-            {
-                memcpy(&FinalBuffer[CurrentPositionInFinalBuffer],
-                       &Format[CurrentProcessedPositionFromStartOfFormat],
-                       StringLen);
-
-                CurrentProcessedPositionFromStartOfFormat += StringLen;
-                CurrentPositionInFinalBuffer += StringLen;
-            }
+            continue;
         }
 
-        //
-        // Double check and apply
-        //
-        if (PercentageChar == '%')
+        if (FormatSpecifier > PRINTF_FORMAT_WSTRING ||
+            Position < CurrentPositionInFormat ||
+            Position + FormatSpecifierLength > LenOfFormat)
         {
             //
-            // Set first character of specifier
+            // The code buffer is not generated by the parser
             //
-            CHAR FormatSpecifier[5] = {0};
-            FormatSpecifier[0]      = '%';
+            *HasError = TRUE;
+            return 0;
+        }
 
-            //
-            // Read second char
-            //
-            CHAR IndicatorChar2 = Format[Position + 1];
+        memcpy(&TempSymbol, Symbol, sizeof(SYMBOL));
+        TempSymbol.Type &= 0x7fffffff;
 
-            //
-            // Check if IndicatorChar2 is 2 character long or more
-            //
-            if (IndicatorChar2 == 'l' || IndicatorChar2 == 'w' ||
-                IndicatorChar2 == 'h')
-            {
-                //
-                // Set second char in format specifier
-                //
-                FormatSpecifier[1] = IndicatorChar2;
+        Val = GetValue(GuestRegs, ActionDetail, VariablesList, &TempSymbol, FALSE);
 
-                if (IndicatorChar2 == 'l' && Format[Position + 2] == 'l')
-                {
-                    //
-                    // Set third character in format specifier "ll"
-                    //
-                    FormatSpecifier[2] = 'l';
-
-                    //
-                    // Set last character
-                    //
-                    FormatSpecifier[3] = Format[Position + 3];
-                }
-                else
-                {
-                    //
-                    // Set last character
-                    //
-                    FormatSpecifier[2] = Format[Position + 2];
-                }
-            }
-            else
-            {
-                //
-                // It's a one char specifier (Set last character)
-                //
-                FormatSpecifier[1] = IndicatorChar2;
-            }
+        //
+        // Move the string before this format specifier to the buffer
+        //
+        Length = Position - CurrentPositionInFormat;
 
-            //
-            // Apply the specifier
-            //
-            if (!strncmp(FormatSpecifier, "%s", 2))
-            {
-                //
-                // for string
-                //
-                if (!ApplyStringFormatSpecifier(
-                        "%s",
-                        FinalBuffer,
-                        &CurrentProcessedPositionFromStartOfFormat,
-                        &CurrentPositionInFinalBuffer,
-                        Val,
-                        FALSE,
-                        sizeof(FinalBuffer)))
-                {
-                    *HasError = TRUE;
-                    return;
-                }
-            }
-            else if (!strncmp(FormatSpecifier, "%ls", 3) ||
-                     !strncmp(FormatSpecifier, "%ws", 3))
-            {
-                //
-                // for wide string (not important if %ls or %ws , only the length is
-                // important)
-                //
-                if (!ApplyStringFormatSpecifier(
-                        "%ws",
-                        FinalBuffer,
-                        &CurrentProcessedPositionFromStartOfFormat,
-                        &CurrentPositionInFinalBuffer,
-                        Val,
-                        TRUE,
-                        sizeof(FinalBuffer)))
-                {
-                    *HasError = TRUE;
-                    return;
-                }
-            }
-            else
-            {
-                ApplyFormatSpecifier(FormatSpecifier, FinalBuffer, &CurrentProcessedPositionFromStartOfFormat, &CurrentPositionInFinalBuffer, Val, sizeof(FinalBuffer));
-            }
+        if (CurrentPositionInFinalBuffer + Length < SizeOfFinalBuffer)
+        {
+            memcpy(&FinalBuffer[CurrentPositionInFinalBuffer], &Format[CurrentPositionInFormat], Length);
+            CurrentPositionInFinalBuffer += Length;
         }
-    }
 
-    if (WithoutAnyFormatSpecifier)
-    {
+        CurrentPositionInFormat = Position + FormatSpecifierLength;
+
         //
-        // Means that it's just a simple print without any format specifier
+        // Apply the specifier
         //
-        if (LenOfFormats < sizeof(FinalBuffer))
+        if (FormatSpecifier == PRINTF_FORMAT_STRING || FormatSpecifier == PRINTF_FORMAT_WSTRING)
         {
-            memcpy(FinalBuffer, Format, LenOfFormats);
+            if (!ApplyStringFormatSpecifier(FinalBuffer,
+                                            &CurrentPositionInFinalBuffer,
+                                            Val,
+                                            FormatSpecifier == PRINTF_FORMAT_WSTRING,
+                                            SizeOfFinalBuffer))
+            {
+                *HasError = TRUE;
+                return 0;
+            }
         }
-    }
-    else
-    {
-        //
-        // Check if there is anything after the last format specifier
-        //
-        if (LenOfFormats > CurrentProcessedPositionFromStartOfFormat)
+        else
         {
-            UINT32 RemainedLen =
-                LenOfFormats - CurrentProcessedPositionFromStartOfFormat;
+            Length = ScriptEngineFormatNumber(FormatSpecifier, Val, NumberBuffer);
 
-            if (CurrentPositionInFinalBuffer + RemainedLen < sizeof(FinalBuffer))
+            if (CurrentPositionInFinalBuffer + Length < SizeOfFinalBuffer)
             {
-                memcpy(&FinalBuffer[CurrentPositionInFinalBuffer],
-                       &Format[CurrentProcessedPositionFromStartOfFormat],
-                       RemainedLen);
+                memcpy(&FinalBuffer[CurrentPositionInFinalBuffer], NumberBuffer, Length);
+                CurrentPositionInFinalBuffer += Length;
             }
         }
     }
 
-//
-// Print final result
-//
-#ifdef SCRIPT_ENGINE_USER_MODE
-    printf("%s", FinalBuffer);
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-
     //
-    // Prepare a buffer to bypass allocating a huge stack space for logging
+    // Move the string after the last format specifier to the buffer
     //
-    LogSimpleWithTag(Tag, ImmediateMessagePassing, FinalBuffer, strlen(FinalBuffer) + 1);
+    Length = LenOfFormat - CurrentPositionInFormat;
 
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-}
-
-UINT64
-GetRegValue(PGUEST_REGS GuestRegs, REGS_ENUM RegId)
-{
-    switch (RegId)
+    if (CurrentPositionInFinalBuffer + Length < SizeOfFinalBuffer)
     {
-    case REGISTER_RAX:
-        return GuestRegs->rax;
+        memcpy(&FinalBuffer[CurrentPositionInFinalBuffer], &Format[CurrentPositionInFormat], Length);
+        CurrentPositionInFinalBuffer += Length;
+    }
 
-        break;
-
-    case REGISTER_EAX:
-        return (GuestRegs->rax & LOWER_32_BITS);
-
-        break;
-
-    case REGISTER_AX:
-        return (GuestRegs->rax & LOWER_16_BITS);
-
-        break;
-
-    case REGISTER_AH:
-        return (GuestRegs->rax & SECOND_LOWER_8_BITS) >> 8;
+    FinalBuffer[CurrentPositionInFinalBuffer] = '\0';
 
-        break;
+    return CurrentPositionInFinalBuffer;
+}
 
-    case REGISTER_AL:
-        return (GuestRegs->rax & LOWER_8_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
 
-        break;
+/**
+ * @brief Send a binary record of printf instead of its text (deferred
+ * formatting), the numbers are sent without rendering them and the bytes
+ * of the strings are copied, the record is rendered in user-mode by using
+ * the format string of the script
+ *
+ * @param GuestRegs
+ * @param ActionDetail
+ * @param VariablesList
+ * @param FormatId Index of the format string in the symbols of the script
+ * @param ArgCount
+ * @param FirstArg
+ * @param HasError
+ * @return VOID
+ */
+VOID
+ScriptEngineSendPrintfRecord(PGUEST_REGS                    GuestRegs,
+                             ACTION_BUFFER                  ActionDetail,
+                             SCRIPT_ENGINE_VARIABLES_LIST * VariablesList,
+                             UINT32                         FormatId,
+                             UINT64                         ArgCount,
+                             PSYMBOL                        FirstArg,
+                             BOOLEAN *                      HasError)
+{
+    CHAR                   RecordBuffer[PacketChunkSize];
+    PDEBUGGER_EVENT_RECORD Record    = (PDEBUGGER_EVENT_RECORD)RecordBuffer;
+    UINT64 *               Arguments = (UINT64 *)&RecordBuffer[sizeof(DEBUGGER_EVENT_RECORD)];
+    UINT32                 StartOfStrings;
+    UINT32                 SizeOfRecord;
+    UINT32                 FormatSpecifier;
+    UINT32                 StringSize;
+    BOOLEAN                IsWstring;
+    UINT64                 Val;
+    SYMBOL                 TempSymbol;
 
-    case REGISTER_RCX:
-        return GuestRegs->rcx;
+    *HasError = FALSE;
 
-        break;
+    //
+    // The record should fit in a log message
+    //
+    if (sizeof(DEBUGGER_EVENT_RECORD) + ArgCount * sizeof(UINT64) > PacketChunkSize - 1)
+    {
+        *HasError = TRUE;
+        return;
+    }
 
-    case REGISTER_ECX:
-        return (GuestRegs->rcx & LOWER_32_BITS);
+    StartOfStrings = sizeof(DEBUGGER_EVENT_RECORD) + (UINT32)ArgCount * sizeof(UINT64);
+    SizeOfRecord   = StartOfStrings;
 
-        break;
+    for (UINT64 i = 0; i < ArgCount; i++)
+    {
+        FormatSpecifier = (UINT32)(FirstArg[i].Type >> SYMBOL_PRINTF_FORMAT_SHIFT) & SYMBOL_PRINTF_FORMAT_MASK;
 
-    case REGISTER_CX:
-        return (GuestRegs->rcx & LOWER_16_BITS);
+        memcpy(&TempSymbol, &FirstArg[i], sizeof(SYMBOL));
+        TempSymbol.Type &= 0x7fffffff;
 
-        break;
+        Val = GetValue(GuestRegs, ActionDetail, VariablesList, &TempSymbol, FALSE);
 
-    case REGISTER_CH:
-        return (GuestRegs->rcx & SECOND_LOWER_8_BITS) >> 8;
+        if (FormatSpecifier != PRINTF_FORMAT_STRING && FormatSpecifier != PRINTF_FORMAT_WSTRING)
+        {
+            Arguments[i] = Val;
+            continue;
+        }
 
-        break;
+        //
+        // The memory of the strings might not be valid when the record
+        // is rendered, so their bytes are copied
+        //
+        IsWstring = FormatSpecifier == PRINTF_FORMAT_WSTRING;
 
-    case REGISTER_CL:
-        return (GuestRegs->rcx & LOWER_8_BITS);
+        if (!CheckIfStringIsSafe(Val, IsWstring))
+        {
+            *HasError = TRUE;
+            return;
+        }
 
-        break;
+        StringSize = CustomStrlen(Val, IsWstring) * (IsWstring ? sizeof(wchar_t) : sizeof(CHAR));
 
-    case REGISTER_RDX:
-        return GuestRegs->rdx;
+        if (SizeOfRecord + StringSize > PacketChunkSize - 1)
+        {
+            //
+            // Over passed buffer, the string is not shown (the same as texts)
+            //
+            StringSize = 0;
+        }
 
-        break;
+        if (StringSize != 0)
+        {
+            MemoryMapperReadMemorySafeOnTargetProcess(Val, &RecordBuffer[SizeOfRecord], StringSize);
+        }
 
-    case REGISTER_EDX:
-        return (GuestRegs->rdx & LOWER_32_BITS);
+        Arguments[i] = DEBUGGER_EVENT_RECORD_STRING(SizeOfRecord - StartOfStrings, StringSize);
+        SizeOfRecord += StringSize;
+    }
 
-        break;
+    Record->Tag              = ActionDetail.Tag;
+    Record->TimeStamp        = __rdtsc();
+    Record->FormatId         = FormatId;
+    Record->CountOfArguments = (UINT16)ArgCount;
+    Record->SizeOfStrings    = (UINT16)(SizeOfRecord - StartOfStrings);
 
-    case REGISTER_DX:
-        return (GuestRegs->rdx & LOWER_16_BITS);
+    //
+    // Records are always sent immediately, the buffers of non-immediate
+    // messages keep the texts of different messages together
+    //
+    LogSimpleWithTag(OPERATION_LOG_EVENT_RECORD, TRUE, RecordBuffer, SizeOfRecord);
+}
 
-        break;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
-    case REGISTER_DH:
-        return (GuestRegs->rdx & SECOND_LOWER_8_BITS) >> 8;
+VOID
+ScriptEngineFunctionPrintf(PGUEST_REGS                    GuestRegs,
+                           ACTION_BUFFER                  ActionDetail,
+                           SCRIPT_ENGINE_VARIABLES_LIST * VariablesList,
+                           UINT64                         Tag,
+                           BOOLEAN                        ImmediateMessagePassing,
+                           UINT32                         FormatId,
+                           char *                         Format,
+                           UINT64                         ArgCount,
+                           PSYMBOL                        FirstArg,
+                           BOOLEAN *                      HasError)
+{
+    //
+    // The printf function
+    //
+    char   FinalBuffer[PacketChunkSize];
+    UINT32 Length;
 
-        break;
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
 
-    case REGISTER_DL:
-        return (GuestRegs->rdx & LOWER_8_BITS);
+    if (ActionDetail.DeferredFormatting)
+    {
+        //
+        // The text is rendered in user-mode
+        //
+        ScriptEngineSendPrintfRecord(GuestRegs, ActionDetail, VariablesList, FormatId, ArgCount, FirstArg, HasError);
+        return;
+    }
 
-        break;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
-    case REGISTER_RBX:
-        return GuestRegs->rbx;
+    Length = ScriptEngineFormatPrintf(GuestRegs,
+                                      ActionDetail,
+                                      VariablesList,
+                                      Format,
+                                      ArgCount,
+                                      FirstArg,
+                                      FinalBuffer,
+                                      sizeof(FinalBuffer),
+                                      HasError);
 
-        break;
+    if (*HasError)
+    {
+        return;
+    }
 
-    case REGISTER_EBX:
-        return (GuestRegs->rbx & LOWER_32_BITS);
+//
+// Print final result
+//
+#ifdef SCRIPT_ENGINE_USER_MODE
+    printf("%s", FinalBuffer);
+#endif // SCRIPT_ENGINE_USER_MODE
 
-        break;
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
 
-    case REGISTER_BX:
-        return (GuestRegs->rbx & LOWER_16_BITS);
+    //
+    // Prepare a buffer to bypass allocating a huge stack space for logging
+    //
+    LogSimpleWithTag(Tag, ImmediateMessagePassing, FinalBuffer, Length + 1);
 
-        break;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+}
 
-    case REGISTER_BH:
-        return (GuestRegs->rbx & SECOND_LOWER_8_BITS) >> 8;
+/**
+ * @brief Location of the general-purpose registers that reading and
+ * writing them has no side effect (indexed by REGS_ENUM)
+ *
+ * @details GetRegValue, SetRegValue and the bytecode access these
+ * registers by a shift and a mask (none of them is sign-extended),
+ * rsp, esp, sp and spl are not here as writing them should also be
+ * applied to the guest's VMCS
+ *
+ */
+static const SCRIPT_ENGINE_GP_REGISTER ScriptEngineGpRegisters[REGISTER_R15L + 1] = {
+    {FIELD_OFFSET(GUEST_REGS, rax), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, rax), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rax), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rax), 8, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rax), 0, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rcx), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, rcx), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rcx), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rcx), 8, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rcx), 0, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rdx), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, rdx), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rdx), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rdx), 8, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rdx), 0, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rbx), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, rbx), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rbx), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rbx), 8, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rbx), 0, LOWER_8_BITS},
+    {0, 0, 0}, // rsp
+    {0, 0, 0}, // esp
+    {0, 0, 0}, // sp
+    {0, 0, 0}, // spl
+    {FIELD_OFFSET(GUEST_REGS, rbp), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, rbp), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rbp), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rbp), 0, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rsi), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, rsi), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rsi), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rsi), 0, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rdi), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, rdi), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rdi), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, rdi), 0, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r8), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, r8), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r8), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r8), 8, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r8), 0, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r9), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, r9), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r9), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r9), 8, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r9), 0, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r10), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, r10), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r10), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r10), 8, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r10), 0, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r11), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, r11), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r11), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r11), 8, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r11), 0, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r12), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, r12), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r12), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r12), 8, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r12), 0, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r13), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, r13), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r13), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r13), 8, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r13), 0, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r14), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, r14), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r14), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r14), 8, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r14), 0, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r15), 0, MAXUINT64},
+    {FIELD_OFFSET(GUEST_REGS, r15), 0, LOWER_32_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r15), 0, LOWER_16_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r15), 8, LOWER_8_BITS},
+    {FIELD_OFFSET(GUEST_REGS, r15), 0, LOWER_8_BITS}};
 
-        break;
+UINT64
+GetRegValue(PGUEST_REGS GuestRegs, REGS_ENUM RegId)
+{
+    const SCRIPT_ENGINE_GP_REGISTER * Register;
 
-    case REGISTER_BL:
-        return (GuestRegs->rbx & LOWER_8_BITS);
+    //
+    // General-purpose registers (and their parts) are read from their
+    // location in GUEST_REGS (INVALID is negative)
+    //
+    if ((UINT32)RegId <= REGISTER_R15L && ScriptEngineGpRegisters[RegId].Mask != 0)
+    {
+        Register = &ScriptEngineGpRegisters[RegId];
 
-        break;
+        return (*(UINT64 *)((CHAR *)GuestRegs + Register->Offset) >> Register->Shift) & Register->Mask;
+    }
 
+    switch (RegId)
+    {
     case REGISTER_RSP:
         return GuestRegs->rsp;
 
@@ -1832,1298 +2210,1251 @@ GetRegValue(PGUEST_REGS GuestRegs, REGS_ENUM RegId)
 
         break;
 
-    case REGISTER_RBP:
-        return GuestRegs->rbp;
+    case REGISTER_DS:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_EBP:
-        return (GuestRegs->rbp & LOWER_32_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return GetGuestDs().SEL;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_BP:
-        return (GuestRegs->rbp & LOWER_16_BITS);
-
-        break;
-    case REGISTER_BPL:
-        return (GuestRegs->rbp & LOWER_8_BITS);
+    case REGISTER_ES:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_RSI:
-        return GuestRegs->rsi;
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return GetGuestEs().SEL;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_ESI:
-        return (GuestRegs->rsi & LOWER_32_BITS);
+    case REGISTER_FS:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_SI:
-        return (GuestRegs->rsi & LOWER_16_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return GetGuestFs().SEL;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_SIL:
-        return (GuestRegs->rsi & LOWER_8_BITS);
+    case REGISTER_GS:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_RDI:
-        return GuestRegs->rdi;
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return GetGuestGs().SEL;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_EDI:
-        return (GuestRegs->rdi & LOWER_32_BITS);
+    case REGISTER_CS:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_DI:
-        return (GuestRegs->rdi & LOWER_16_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return GetGuestCs().SEL;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_DIL:
-        return (GuestRegs->rdi & LOWER_8_BITS);
+    case REGISTER_SS:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R8:
-        return GuestRegs->r8;
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return GetGuestSs().SEL;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R8D:
-        return (GuestRegs->r8 & LOWER_32_BITS);
+    case REGISTER_RFLAGS:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R8W:
-        return (GuestRegs->r8 & LOWER_16_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return GetGuestRFlags();
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R8H:
-        return (GuestRegs->r8 & SECOND_LOWER_8_BITS) >> 8;
-
-        break;
+    case REGISTER_EFLAGS:
 
-    case REGISTER_R8L:
-        return (GuestRegs->r8 & LOWER_8_BITS);
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-        break;
-    case REGISTER_R9:
-        return GuestRegs->r9;
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return (GetGuestRFlags() & LOWER_32_BITS);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R9D:
-        return (GuestRegs->r9 & LOWER_32_BITS);
+    case REGISTER_FLAGS:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R9W:
-        return (GuestRegs->r9 & LOWER_16_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return (GetGuestRFlags() & LOWER_16_BITS);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R9H:
-        return (GuestRegs->r9 & SECOND_LOWER_8_BITS) >> 8;
+    case REGISTER_CF:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R9L:
-        return (GuestRegs->r9 & LOWER_8_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return (GetGuestRFlags() & X86_FLAGS_CF) != NULL ? TRUE : FALSE;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R10:
-        return GuestRegs->r10;
+    case REGISTER_PF:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R10D:
-        return (GuestRegs->r10 & LOWER_32_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return (GetGuestRFlags() & (X86_FLAGS_PF)) != NULL ? TRUE : FALSE;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R10W:
-        return (GuestRegs->r10 & LOWER_16_BITS);
+    case REGISTER_AF:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R10H:
-        return (GuestRegs->r10 & SECOND_LOWER_8_BITS) >> 8;
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return (GetGuestRFlags() & (X86_FLAGS_AF)) != NULL ? TRUE : FALSE;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R10L:
-        return (GuestRegs->r10 & LOWER_8_BITS);
+    case REGISTER_ZF:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R11:
-        return GuestRegs->r11;
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return (GetGuestRFlags() & (X86_FLAGS_ZF)) != NULL ? TRUE : FALSE;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R11D:
-        return (GuestRegs->r11 & LOWER_32_BITS);
+    case REGISTER_SF:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R11W:
-        return (GuestRegs->r11 & LOWER_16_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return (GetGuestRFlags() & (X86_FLAGS_SF)) != NULL ? TRUE : FALSE;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R11H:
-        return (GuestRegs->r11 & SECOND_LOWER_8_BITS) >> 8;
+    case REGISTER_TF:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R11L:
-        return (GuestRegs->r11 & LOWER_8_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return (GetGuestRFlags() & (X86_FLAGS_TF)) != NULL ? TRUE : FALSE;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R12:
-        return GuestRegs->r12;
+    case REGISTER_IF:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R12D:
-        return (GuestRegs->r12 & LOWER_32_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return (GetGuestRFlags() & (X86_FLAGS_IF)) != NULL ? TRUE : FALSE;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R12W:
-        return (GuestRegs->r12 & LOWER_16_BITS);
+    case REGISTER_DF:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R12H:
-        return (GuestRegs->r12 & SECOND_LOWER_8_BITS) >> 8;
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return (GetGuestRFlags() & (X86_FLAGS_DF)) != NULL ? TRUE : FALSE;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R12L:
-        return (GuestRegs->r12 & LOWER_8_BITS);
+    case REGISTER_OF:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        return NULL;
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R13:
-        return GuestRegs->r13;
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        return (GetGuestRFlags() & (X86_FLAGS_OF)) != NULL ? TRUE : FALSE;
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R13D:
-        return (GuestRegs->r13 & LOWER_32_BITS);
-
-        break;
-
-    case REGISTER_R13W:
-        return (GuestRegs->r13 & LOWER_16_BITS);
-
-        break;
-
-    case REGISTER_R13H:
-        return (GuestRegs->r13 & SECOND_LOWER_8_BITS) >> 8;
-
-        break;
-
-    case REGISTER_R13L:
-        return (GuestRegs->r13 & LOWER_8_BITS);
-
-        break;
-
-    case REGISTER_R14:
-        return GuestRegs->r14;
-
-        break;
-
-    case REGISTER_R14D:
-        return (GuestRegs->r14 & LOWER_32_BITS);
-
-        break;
-
-    case REGISTER_R14W:
-        return (GuestRegs->r14 & LOWER_16_BITS);
-
-        break;
-
-    case REGISTER_R14H:
-        return (GuestRegs->r14 & SECOND_LOWER_8_BITS) >> 8;
-
-        break;
-
-    case REGISTER_R14L:
-        return (GuestRegs->r14 & LOWER_8_BITS);
-
-        break;
-
-    case REGISTER_R15:
-        return GuestRegs->r15;
-
-        break;
-
-    case REGISTER_R15D:
-        return (GuestRegs->r15 & LOWER_32_BITS);
-
-        break;
-
-    case REGISTER_R15W:
-        return (GuestRegs->r15 & LOWER_16_BITS);
-
-        break;
-
-    case REGISTER_R15H:
-        return (GuestRegs->r15 & SECOND_LOWER_8_BITS) >> 8;
-
-        break;
-
-    case REGISTER_R15L:
-        return (GuestRegs->r15 & LOWER_8_BITS);
-
-        break;
-
-    case REGISTER_DS:
+    case REGISTER_IOPL:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestDs().SEL;
+        return ((GetGuestRFlags() & (0b11 << X86_FLAGS_IOPL_SHIFT)) >> 12);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_ES:
+    case REGISTER_NT:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestEs().SEL;
+        return (GetGuestRFlags() & (X86_FLAGS_NT)) != NULL ? TRUE : FALSE;
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_FS:
+    case REGISTER_RF:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestFs().SEL;
+        return (GetGuestRFlags() & (X86_FLAGS_RF)) != NULL ? TRUE : FALSE;
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_GS:
+    case REGISTER_VM:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestGs().SEL;
+        return (GetGuestRFlags() & (X86_FLAGS_VM)) != NULL ? TRUE : FALSE;
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_CS:
+    case REGISTER_AC:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestCs().SEL;
+        return (GetGuestRFlags() & (X86_FLAGS_AC)) != NULL ? TRUE : FALSE;
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_SS:
+    case REGISTER_VIF:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestSs().SEL;
+        return (GetGuestRFlags() & (X86_FLAGS_VIF)) != NULL ? TRUE : FALSE;
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_RFLAGS:
+    case REGISTER_VIP:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestRFlags();
+        return (GetGuestRFlags() & (X86_FLAGS_VIP)) != NULL ? TRUE : FALSE;
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_EFLAGS:
+    case REGISTER_ID:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & LOWER_32_BITS);
+        return (GetGuestRFlags() & (X86_FLAGS_ID)) != NULL ? TRUE : FALSE;
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_FLAGS:
+    case REGISTER_RIP:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & LOWER_16_BITS);
+        return GetGuestRIP();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_CF:
+    case REGISTER_EIP:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & X86_FLAGS_CF) != NULL ? TRUE : FALSE;
+        return (GetGuestRIP() & LOWER_32_BITS);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_PF:
+    case REGISTER_IP:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_PF)) != NULL ? TRUE : FALSE;
+        return (GetGuestRIP() & LOWER_16_BITS);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_AF:
+    case REGISTER_IDTR:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_AF)) != NULL ? TRUE : FALSE;
+
+        return GetGuestIdtr();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_ZF:
+    case REGISTER_LDTR:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_ZF)) != NULL ? TRUE : FALSE;
+
+        return GetGuestLdtr();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_SF:
+    case REGISTER_TR:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_SF)) != NULL ? TRUE : FALSE;
+
+        return GetGuestTr();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_TF:
+    case REGISTER_GDTR:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_TF)) != NULL ? TRUE : FALSE;
+        return GetGuestGdtr();
+
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_IF:
+    case REGISTER_CR0:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_IF)) != NULL ? TRUE : FALSE;
+        return GetGuestCr0();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_DF:
+    case REGISTER_CR2:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_DF)) != NULL ? TRUE : FALSE;
+        return GetGuestCr2();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_OF:
+    case REGISTER_CR3:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_OF)) != NULL ? TRUE : FALSE;
+        return GetGuestCr3();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_IOPL:
+    case REGISTER_CR4:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return ((GetGuestRFlags() & (0b11 << X86_FLAGS_IOPL_SHIFT)) >> 12);
+        return GetGuestCr4();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_NT:
+    case REGISTER_CR8:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_NT)) != NULL ? TRUE : FALSE;
+        return GetGuestCr8();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_RF:
+    case REGISTER_DR0:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_RF)) != NULL ? TRUE : FALSE;
+        return GetGuestDr0();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_VM:
+    case REGISTER_DR1:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_VM)) != NULL ? TRUE : FALSE;
+        return GetGuestDr1();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_AC:
+    case REGISTER_DR2:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_AC)) != NULL ? TRUE : FALSE;
+        return GetGuestDr2();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_VIF:
+    case REGISTER_DR3:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_VIF)) != NULL ? TRUE : FALSE;
+        return GetGuestDr3();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_VIP:
+    case REGISTER_DR6:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_VIP)) != NULL ? TRUE : FALSE;
+        return GetGuestDr6();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_ID:
+    case REGISTER_DR7:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         return NULL;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRFlags() & (X86_FLAGS_ID)) != NULL ? TRUE : FALSE;
+        return GetGuestDr7();
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_RIP:
+    case INVALID:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        ShowMessages("error in reading register");
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestRIP();
+        LogInfo("Error in reading register");
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
-        break;
-
-    case REGISTER_EIP:
+        return INVALID;
 
+        break;
+    }
+}
+UINT64
+GetPseudoRegValue(PSYMBOL Symbol, ACTION_BUFFER ActionBuffer)
+{
+    switch (Symbol->Value)
+    {
+    case PSEUDO_REGISTER_TID:
+        return ScriptEnginePseudoRegGetTid();
+    case PSEUDO_REGISTER_PID:
+        return ScriptEnginePseudoRegGetPid();
+    case PSEUDO_REGISTER_PNAME:
+        return (UINT64)ScriptEnginePseudoRegGetPname();
+    case PSEUDO_REGISTER_CORE:
+        return ScriptEnginePseudoRegGetCore();
+    case PSEUDO_REGISTER_PROC:
+        return ScriptEnginePseudoRegGetProc();
+    case PSEUDO_REGISTER_THREAD:
+        return ScriptEnginePseudoRegGetThread();
+    case PSEUDO_REGISTER_PEB:
+        return ScriptEnginePseudoRegGetPeb();
+    case PSEUDO_REGISTER_TEB:
+        return ScriptEnginePseudoRegGetTeb();
+    case PSEUDO_REGISTER_IP:
+        return ScriptEnginePseudoRegGetIp();
+    case PSEUDO_REGISTER_BUFFER:
+        if (ActionBuffer.CurrentAction != NULL)
+        {
+            return ScriptEnginePseudoRegGetBuffer(
+                (UINT64 *)ActionBuffer.CurrentAction);
+        }
+        else
+        {
+            return NULL;
+        }
+    case PSEUDO_REGISTER_CONTEXT:
+        return ActionBuffer.Context;
+    case INVALID:
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        ShowMessages("error in reading regesiter");
 #endif // SCRIPT_ENGINE_USER_MODE
+        return INVALID;
+        // TODO: Add all the register
+    }
+}
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRIP() & LOWER_32_BITS);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
-        break;
+UINT64
+GetValue(PGUEST_REGS                    GuestRegs,
+         ACTION_BUFFER                  ActionBuffer,
+         SCRIPT_ENGINE_VARIABLES_LIST * VariablesList,
+         PSYMBOL                        Symbol,
+         BOOLEAN                        ReturnReference)
+{
+    switch (Symbol->Type)
+    {
+    case SYMBOL_GLOBAL_ID_TYPE:
 
-    case REGISTER_IP:
+        if (ReturnReference)
+            return ((UINT64)(&VariablesList->GlobalVariablesList[Symbol->Value]));
+        else
+            return VariablesList->GlobalVariablesList[Symbol->Value];
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
-#endif // SCRIPT_ENGINE_USER_MODE
+    case SYMBOL_LOCAL_ID_TYPE:
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return (GetGuestRIP() & LOWER_16_BITS);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        if (ReturnReference)
+            return ((UINT64)(&VariablesList->LocalVariablesList[Symbol->Value]));
+        else
+            return VariablesList->LocalVariablesList[Symbol->Value];
 
-        break;
+    case SYMBOL_NUM_TYPE:
 
-    case REGISTER_IDTR:
+        if (ReturnReference)
+            return ((UINT64)&Symbol->Value);
+        else
+            return Symbol->Value;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
-#endif // SCRIPT_ENGINE_USER_MODE
+    case SYMBOL_REGISTER_TYPE:
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        if (ReturnReference)
+            return NULL; // Not reasonable, you should not dereference a register!
+        else
+            return GetRegValue(GuestRegs, (REGS_ENUM)Symbol->Value);
 
-        return GetGuestIdtr();
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+    case SYMBOL_PSEUDO_REG_TYPE:
 
-        break;
+        if (ReturnReference)
+            return NULL; // Not reasonable, you should not dereference a pseudo-register!
+        else
+            return GetPseudoRegValue(Symbol, ActionBuffer);
 
-    case REGISTER_LDTR:
+    case SYMBOL_TEMP_TYPE:
+
+        if (ReturnReference)
+            return ((UINT64)&VariablesList->TempList[Symbol->Value]);
+        else
+            return VariablesList->TempList[Symbol->Value];
+    }
+}
+
+VOID
+SetRegValue(PGUEST_REGS GuestRegs, PSYMBOL Symbol, UINT64 Value)
+{
+    const SCRIPT_ENGINE_GP_REGISTER * Register;
+    UINT64 *                          Location;
+
+    //
+    // General-purpose registers (and their parts) are merged into their
+    // location in GUEST_REGS, the other bits of the register are kept
+    //
+    if (Symbol->Value <= REGISTER_R15L && ScriptEngineGpRegisters[Symbol->Value].Mask != 0)
+    {
+        Register = &ScriptEngineGpRegisters[Symbol->Value];
+        Location = (UINT64 *)((CHAR *)GuestRegs + Register->Offset);
+
+        *Location = (*Location & ~(Register->Mask << Register->Shift)) | ((Value & Register->Mask) << Register->Shift);
+
+        return;
+    }
+
+    switch (Symbol->Value)
+    {
+    case REGISTER_RSP:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        GuestRegs->rsp = Value;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-
-        return GetGuestLdtr();
+        GuestRegs->rsp = Value;
+        SetGuestRSP(Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_TR:
+    case REGISTER_ESP:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        GuestRegs->rsp = Value;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-
-        return GetGuestTr();
+        GuestRegs->rsp = (GuestRegs->rsp & UPPER_32_BITS) | (Value & LOWER_32_BITS);
+        SetGuestRSP(GuestRegs->rsp);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_GDTR:
+    case REGISTER_SP:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        GuestRegs->rsp = Value;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestGdtr();
-
+        GuestRegs->rsp = (GuestRegs->rsp & UPPER_48_BITS) | (Value & LOWER_16_BITS);
+        SetGuestRSP(GuestRegs->rsp);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_CR0:
+    case REGISTER_SPL:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        GuestRegs->rsp = Value;
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestCr0();
+        GuestRegs->rsp = (GuestRegs->rsp & UPPER_56_BITS) | (Value & LOWER_8_BITS);
+        SetGuestRSP(GuestRegs->rsp);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_CR2:
+    case REGISTER_DS:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestCr2();
+        Value = Value & LOWER_16_BITS;
+        SetGuestDsSel((PSEGMENT_SELECTOR)&Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_CR3:
+    case REGISTER_ES:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestCr3();
+        Value = Value & LOWER_16_BITS;
+        SetGuestEsSel((PSEGMENT_SELECTOR)&Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_CR4:
+    case REGISTER_FS:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestCr4();
+        Value = Value & LOWER_16_BITS;
+        SetGuestFsSel((PSEGMENT_SELECTOR)&Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_CR8:
+    case REGISTER_GS:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestCr8();
+        Value = Value & LOWER_16_BITS;
+        SetGuestGsSel((PSEGMENT_SELECTOR)&Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_DR0:
+    case REGISTER_CS:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestDr0();
+        Value = Value & LOWER_16_BITS;
+        SetGuestCsSel((PSEGMENT_SELECTOR)&Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_DR1:
+    case REGISTER_SS:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestDr1();
+        Value = Value & LOWER_16_BITS;
+        SetGuestSsSel((PSEGMENT_SELECTOR)&Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_DR2:
+    case REGISTER_RFLAGS:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestDr2();
+        SetGuestRFlags(Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_DR3:
+    case REGISTER_EFLAGS:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestDr3();
+        SetGuestRFlags((GetGuestRFlags() & UPPER_32_BITS) | (Value & LOWER_32_BITS));
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_DR6:
+    case REGISTER_FLAGS:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestDr6();
+        SetGuestRFlags((GetGuestRFlags() & UPPER_48_BITS) | (Value & LOWER_16_BITS));
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_DR7:
+    case REGISTER_CF:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        return NULL;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        return GetGuestDr7();
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_CF) : GetGuestRFlags() & (~(X86_FLAGS_CF)));
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case INVALID:
+    case REGISTER_PF:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        ShowMessages("error in reading register");
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        LogInfo("Error in reading register");
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_PF) : GetGuestRFlags() & (~(X86_FLAGS_PF)));
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
-        return INVALID;
-
         break;
-    }
-}
-UINT64
-GetPseudoRegValue(PSYMBOL Symbol, ACTION_BUFFER ActionBuffer)
-{
-    switch (Symbol->Value)
-    {
-    case PSEUDO_REGISTER_TID:
-        return ScriptEnginePseudoRegGetTid();
-    case PSEUDO_REGISTER_PID:
-        return ScriptEnginePseudoRegGetPid();
-    case PSEUDO_REGISTER_PNAME:
-        return (UINT64)ScriptEnginePseudoRegGetPname();
-    case PSEUDO_REGISTER_CORE:
-        return ScriptEnginePseudoRegGetCore();
-    case PSEUDO_REGISTER_PROC:
-        return ScriptEnginePseudoRegGetProc();
-    case PSEUDO_REGISTER_THREAD:
-        return ScriptEnginePseudoRegGetThread();
-    case PSEUDO_REGISTER_PEB:
-        return ScriptEnginePseudoRegGetPeb();
-    case PSEUDO_REGISTER_TEB:
-        return ScriptEnginePseudoRegGetTeb();
-    case PSEUDO_REGISTER_IP:
-        return ScriptEnginePseudoRegGetIp();
-    case PSEUDO_REGISTER_BUFFER:
-        if (ActionBuffer.CurrentAction != NULL)
-        {
-            return ScriptEnginePseudoRegGetBuffer(
-                (UINT64 *)ActionBuffer.CurrentAction);
-        }
-        else
-        {
-            return NULL;
-        }
-    case PSEUDO_REGISTER_CONTEXT:
-        return ActionBuffer.Context;
-    case INVALID:
+
+    case REGISTER_AF:
+
 #ifdef SCRIPT_ENGINE_USER_MODE
-        ShowMessages("error in reading regesiter");
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
-        return INVALID;
-        // TODO: Add all the register
-    }
-}
 
-UINT64
-GetValue(PGUEST_REGS                    GuestRegs,
-         ACTION_BUFFER                  ActionBuffer,
-         SCRIPT_ENGINE_VARIABLES_LIST * VariablesList,
-         PSYMBOL                        Symbol,
-         BOOLEAN                        ReturnReference)
-{
-    switch (Symbol->Type)
-    {
-    case SYMBOL_GLOBAL_ID_TYPE:
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_AF) : GetGuestRFlags() & (~(X86_FLAGS_AF)));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
-        if (ReturnReference)
-            return ((UINT64)(&VariablesList->GlobalVariablesList[Symbol->Value]));
-        else
-            return VariablesList->GlobalVariablesList[Symbol->Value];
+        break;
 
-    case SYMBOL_LOCAL_ID_TYPE:
+    case REGISTER_ZF:
 
-        if (ReturnReference)
-            return ((UINT64)(&VariablesList->LocalVariablesList[Symbol->Value]));
-        else
-            return VariablesList->LocalVariablesList[Symbol->Value];
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case SYMBOL_NUM_TYPE:
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_ZF) : GetGuestRFlags() & (~(X86_FLAGS_ZF)));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
-        if (ReturnReference)
-            return ((UINT64)&Symbol->Value);
-        else
-            return Symbol->Value;
+        break;
 
-    case SYMBOL_REGISTER_TYPE:
+    case REGISTER_SF:
 
-        if (ReturnReference)
-            return NULL; // Not reasonable, you should not dereference a register!
-        else
-            return GetRegValue(GuestRegs, (REGS_ENUM)Symbol->Value);
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case SYMBOL_PSEUDO_REG_TYPE:
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_SF) : GetGuestRFlags() & (~(X86_FLAGS_SF)));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
-        if (ReturnReference)
-            return NULL; // Not reasonable, you should not dereference a pseudo-register!
-        else
-            return GetPseudoRegValue(Symbol, ActionBuffer);
+        break;
 
-    case SYMBOL_TEMP_TYPE:
+    case REGISTER_TF:
 
-        if (ReturnReference)
-            return ((UINT64)&VariablesList->TempList[Symbol->Value]);
-        else
-            return VariablesList->TempList[Symbol->Value];
-    }
-}
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-VOID
-SetRegValue(PGUEST_REGS GuestRegs, PSYMBOL Symbol, UINT64 Value)
-{
-    switch (Symbol->Value)
-    {
-    case REGISTER_RAX:
-        GuestRegs->rax = Value;
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_TF) : GetGuestRFlags() & (~(X86_FLAGS_TF)));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_EAX:
-        GuestRegs->rax = (GuestRegs->rax & UPPER_32_BITS) | (Value & LOWER_32_BITS);
+    case REGISTER_IF:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_AX:
-        GuestRegs->rax = (GuestRegs->rax & UPPER_48_BITS) | (Value & LOWER_16_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_IF) : GetGuestRFlags() & (~(X86_FLAGS_IF)));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_AH:
-        GuestRegs->rax = (GuestRegs->rax & UPPER_48_BITS_AND_LOWER_8_BITS) | ((Value << 8) & SECOND_LOWER_8_BITS);
+    case REGISTER_DF:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_AL:
-        GuestRegs->rax = (GuestRegs->rax & UPPER_56_BITS) | (Value & LOWER_8_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_DF) : GetGuestRFlags() & (~(X86_FLAGS_DF)));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_RCX:
-        GuestRegs->rcx = Value;
-
-        break;
-    case REGISTER_ECX:
-        GuestRegs->rcx = (GuestRegs->rcx & UPPER_32_BITS) | (Value & LOWER_32_BITS);
+    case REGISTER_OF:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_CX:
-        GuestRegs->rcx = (GuestRegs->rcx & UPPER_48_BITS) | (Value & LOWER_16_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_OF) : GetGuestRFlags() & (~(X86_FLAGS_OF)));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_CH:
-        GuestRegs->rcx = (GuestRegs->rcx & UPPER_48_BITS_AND_LOWER_8_BITS) | ((Value << 8) & SECOND_LOWER_8_BITS);
+    case REGISTER_IOPL:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_CL:
-        GuestRegs->rcx = (GuestRegs->rcx & UPPER_56_BITS) | (Value & LOWER_8_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (1 << X86_FLAGS_IOPL_SHIFT) : GetGuestRFlags() & (~(1 << X86_FLAGS_IOPL_SHIFT)));
+        Value = (Value >> 4) & 1;
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (1 << X86_FLAGS_IOPL_SHIFT_2ND_BIT) : GetGuestRFlags() & (~(1 << X86_FLAGS_IOPL_SHIFT_2ND_BIT)));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
-    case REGISTER_RDX:
-        GuestRegs->rdx = Value;
 
-        break;
-    case REGISTER_EDX:
-        GuestRegs->rdx = (GuestRegs->rdx & UPPER_32_BITS) | (Value & LOWER_32_BITS);
+    case REGISTER_NT:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_DX:
-        GuestRegs->rdx = (GuestRegs->rdx & UPPER_48_BITS) | (Value & LOWER_16_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_NT) : GetGuestRFlags() & (~(X86_FLAGS_NT)));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_DH:
-        GuestRegs->rdx = (GuestRegs->rdx & UPPER_48_BITS_AND_LOWER_8_BITS) | ((Value << 8) & SECOND_LOWER_8_BITS);
+    case REGISTER_RF:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_DL:
-        GuestRegs->rdx = (GuestRegs->rdx & UPPER_56_BITS) | (Value & LOWER_8_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_RF) : GetGuestRFlags() & (~(X86_FLAGS_RF)));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
-    case REGISTER_RBX:
-        GuestRegs->rbx = Value;
 
-        break;
-    case REGISTER_EBX:
-        GuestRegs->rbx = (GuestRegs->rbx & UPPER_32_BITS) | (Value & LOWER_32_BITS);
+    case REGISTER_VM:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_BX:
-        GuestRegs->rbx = (GuestRegs->rbx & UPPER_48_BITS) | (Value & LOWER_16_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_VM) : GetGuestRFlags() & (~(X86_FLAGS_VM)));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_BH:
-        GuestRegs->rbx = (GuestRegs->rbx & UPPER_48_BITS_AND_LOWER_8_BITS) | ((Value << 8) & SECOND_LOWER_8_BITS);
+    case REGISTER_AC:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_BL:
-        GuestRegs->rbx = (GuestRegs->rbx & UPPER_56_BITS) | (Value & LOWER_8_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_AC) : GetGuestRFlags() & (~(X86_FLAGS_AC)));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
-    case REGISTER_RSP:
+
+    case REGISTER_VIF:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        GuestRegs->rsp = Value;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        GuestRegs->rsp = Value;
-        SetGuestRSP(Value);
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_VIF) : GetGuestRFlags() & (~(X86_FLAGS_VIF)));
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_ESP:
+    case REGISTER_VIP:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        GuestRegs->rsp = Value;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        GuestRegs->rsp = (GuestRegs->rsp & UPPER_32_BITS) | (Value & LOWER_32_BITS);
-        SetGuestRSP(GuestRegs->rsp);
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_VIP) : GetGuestRFlags() & (~(X86_FLAGS_VIP)));
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_SP:
+    case REGISTER_ID:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        GuestRegs->rsp = Value;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        GuestRegs->rsp = (GuestRegs->rsp & UPPER_48_BITS) | (Value & LOWER_16_BITS);
-        SetGuestRSP(GuestRegs->rsp);
+        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_ID) : GetGuestRFlags() & (~(X86_FLAGS_ID)));
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_SPL:
+    case REGISTER_RIP:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
-        GuestRegs->rsp = Value;
+        //
+        // Nothing to do
+        //
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        GuestRegs->rsp = (GuestRegs->rsp & UPPER_56_BITS) | (Value & LOWER_8_BITS);
-        SetGuestRSP(GuestRegs->rsp);
+        SetGuestRIP(Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_RBP:
-        GuestRegs->rbp = Value;
-
-        break;
-    case REGISTER_EBP:
-        GuestRegs->rbp = (GuestRegs->rbp & UPPER_32_BITS) | (Value & LOWER_32_BITS);
+    case REGISTER_EIP:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_BP:
-        GuestRegs->rbp = (GuestRegs->rbp & UPPER_48_BITS) | (Value & LOWER_16_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRIP((GetGuestRIP() & UPPER_32_BITS) | (Value & LOWER_32_BITS));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_BPL:
-        GuestRegs->rbp = (GuestRegs->rbp & UPPER_56_BITS) | (Value & LOWER_8_BITS);
+    case REGISTER_IP:
 
-        break;
-    case REGISTER_RSI:
-        GuestRegs->rsi = Value;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-        break;
-    case REGISTER_ESI:
-        GuestRegs->rsi = (GuestRegs->rsi & UPPER_32_BITS) | (Value & LOWER_32_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestRIP((GetGuestRIP() & UPPER_48_BITS) | (Value & LOWER_16_BITS));
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_SI:
-        GuestRegs->rsi = (GuestRegs->rsi & UPPER_48_BITS) | (Value & LOWER_16_BITS);
+    case REGISTER_IDTR:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_SIL:
-        GuestRegs->rsi = (GuestRegs->rsi & UPPER_56_BITS) | (Value & LOWER_8_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestIdtr(Value);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
-    case REGISTER_RDI:
-        GuestRegs->rdi = Value;
 
-        break;
-    case REGISTER_EDI:
-        GuestRegs->rdi = (GuestRegs->rdi & UPPER_32_BITS) | (Value & LOWER_32_BITS);
+    case REGISTER_LDTR:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_DI:
-        GuestRegs->rdi = (GuestRegs->rdi & UPPER_48_BITS) | (Value & LOWER_16_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestLdtr(Value);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_DIL:
-        GuestRegs->rdi = (GuestRegs->rdi & UPPER_56_BITS) | (Value & LOWER_8_BITS);
+    case REGISTER_GDTR:
 
-        break;
-    case REGISTER_R8:
-        GuestRegs->r8 = Value;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-        break;
-    case REGISTER_R8D:
-        GuestRegs->r8 = (GuestRegs->r8 & UPPER_32_BITS) | (Value & LOWER_32_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestGdtr(Value);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R8W:
-        GuestRegs->r8 = (GuestRegs->r8 & UPPER_48_BITS) | (Value & LOWER_16_BITS);
+    case REGISTER_TR:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R8H:
-        GuestRegs->r8 = (GuestRegs->r8 & UPPER_48_BITS_AND_LOWER_8_BITS) | ((Value << 8) & SECOND_LOWER_8_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestTr(Value);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R8L:
-        GuestRegs->r8 = (GuestRegs->r8 & UPPER_56_BITS) | (Value & LOWER_8_BITS);
+    case REGISTER_CR0:
 
-        break;
-    case REGISTER_R9:
-        GuestRegs->r9 = Value;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-        break;
-    case REGISTER_R9D:
-        GuestRegs->r9 = (GuestRegs->r9 & UPPER_32_BITS) | (Value & LOWER_32_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestCr0(Value);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R9W:
-        GuestRegs->r9 = (GuestRegs->r9 & UPPER_48_BITS) | (Value & LOWER_16_BITS);
+    case REGISTER_CR2:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R9H:
-        GuestRegs->r9 = (GuestRegs->r9 & UPPER_48_BITS_AND_LOWER_8_BITS) | ((Value << 8) & SECOND_LOWER_8_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestCr2(Value);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R9L:
-        GuestRegs->r9 = (GuestRegs->r9 & UPPER_56_BITS) | (Value & LOWER_8_BITS);
+    case REGISTER_CR3:
 
-        break;
-    case REGISTER_R10:
-        GuestRegs->r10 = Value;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-        break;
-    case REGISTER_R10D:
-        GuestRegs->r10 = (GuestRegs->r10 & UPPER_32_BITS) | (Value & LOWER_32_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestCr3(Value);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R10W:
-        GuestRegs->r10 = (GuestRegs->r10 & UPPER_48_BITS) | (Value & LOWER_16_BITS);
+    case REGISTER_CR4:
 
-        break;
+#ifdef SCRIPT_ENGINE_USER_MODE
+        //
+        // Nothing to do
+        //
+#endif // SCRIPT_ENGINE_USER_MODE
 
-    case REGISTER_R10H:
-        GuestRegs->r10 = (GuestRegs->r10 & UPPER_48_BITS_AND_LOWER_8_BITS) | ((Value << 8) & SECOND_LOWER_8_BITS);
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+        SetGuestCr4(Value);
+#endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_R10L:
-        GuestRegs->r10 = (GuestRegs->r10 & UPPER_56_BITS) | (Value & LOWER_8_BITS);
-
-        break;
-    case REGISTER_R11:
-        GuestRegs->r11 = Value;
-
-        break;
-    case REGISTER_R11D:
-        GuestRegs->r11 = (GuestRegs->r11 & UPPER_32_BITS) | (Value & LOWER_32_BITS);
-
-        break;
-
-    case REGISTER_R11W:
-        GuestRegs->r11 = (GuestRegs->r11 & UPPER_48_BITS) | (Value & LOWER_16_BITS);
-
-        break;
-
-    case REGISTER_R11H:
-        GuestRegs->r11 = (GuestRegs->r11 & UPPER_48_BITS_AND_LOWER_8_BITS) | ((Value << 8) & SECOND_LOWER_8_BITS);
-
-        break;
-
-    case REGISTER_R11L:
-        GuestRegs->r11 = (GuestRegs->r11 & UPPER_56_BITS) | (Value & LOWER_8_BITS);
-
-        break;
-    case REGISTER_R12:
-        GuestRegs->r12 = Value;
-
-        break;
-    case REGISTER_R12D:
-        GuestRegs->r12 = (GuestRegs->r12 & UPPER_32_BITS) | (Value & LOWER_32_BITS);
-
-        break;
-
-    case REGISTER_R12W:
-        GuestRegs->r12 = (GuestRegs->r12 & UPPER_48_BITS) | (Value & LOWER_16_BITS);
-
-        break;
-
-    case REGISTER_R12H:
-        GuestRegs->r12 = (GuestRegs->r12 & UPPER_48_BITS_AND_LOWER_8_BITS) | ((Value << 8) & SECOND_LOWER_8_BITS);
-
-        break;
-
-    case REGISTER_R12L:
-        GuestRegs->r12 = (GuestRegs->r12 & UPPER_56_BITS) | (Value & LOWER_8_BITS);
-
-        break;
-    case REGISTER_R13:
-        GuestRegs->r13 = Value;
-
-        break;
-    case REGISTER_R13D:
-        GuestRegs->r13 = (GuestRegs->r13 & UPPER_32_BITS) | (Value & LOWER_32_BITS);
-
-        break;
-
-    case REGISTER_R13W:
-        GuestRegs->r13 = (GuestRegs->r13 & UPPER_48_BITS) | (Value & LOWER_16_BITS);
-
-        break;
-
-    case REGISTER_R13H:
-        GuestRegs->r13 = (GuestRegs->r13 & UPPER_48_BITS_AND_LOWER_8_BITS) | ((Value << 8) & SECOND_LOWER_8_BITS);
-
-        break;
-
-    case REGISTER_R13L:
-        GuestRegs->r13 = (GuestRegs->r13 & UPPER_56_BITS) | (Value & LOWER_8_BITS);
-
-        break;
-    case REGISTER_R14:
-        GuestRegs->r14 = Value;
-
-        break;
-    case REGISTER_R14D:
-        GuestRegs->r14 = (GuestRegs->r14 & UPPER_32_BITS) | (Value & LOWER_32_BITS);
-
-        break;
-
-    case REGISTER_R14W:
-        GuestRegs->r14 = (GuestRegs->r14 & UPPER_48_BITS) | (Value & LOWER_16_BITS);
-
-        break;
-
-    case REGISTER_R14H:
-        GuestRegs->r14 = (GuestRegs->r14 & UPPER_48_BITS_AND_LOWER_8_BITS) | ((Value << 8) & SECOND_LOWER_8_BITS);
-
-        break;
-
-    case REGISTER_R14L:
-        GuestRegs->r14 = (GuestRegs->r14 & UPPER_56_BITS) | (Value & LOWER_8_BITS);
-
-        break;
-    case REGISTER_R15:
-        GuestRegs->r15 = Value;
-
-        break;
-    case REGISTER_R15D:
-        GuestRegs->r15 = (GuestRegs->r15 & UPPER_32_BITS) | (Value & LOWER_32_BITS);
-
-        break;
-
-    case REGISTER_R15W:
-        GuestRegs->r15 = (GuestRegs->r15 & UPPER_48_BITS) | (Value & LOWER_16_BITS);
-
-        break;
-
-    case REGISTER_R15H:
-        GuestRegs->r15 = (GuestRegs->r15 & UPPER_48_BITS_AND_LOWER_8_BITS) | ((Value << 8) & SECOND_LOWER_8_BITS);
-
-        break;
-
-    case REGISTER_R15L:
-        GuestRegs->r15 = (GuestRegs->r15 & UPPER_56_BITS) | (Value & LOWER_8_BITS);
-
-        break;
-    case REGISTER_DS:
+    case REGISTER_CR8:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         //
@@ -3132,13 +3463,12 @@ SetRegValue(PGUEST_REGS GuestRegs, PSYMBOL Symbol, UINT64 Value)
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        Value = Value & LOWER_16_BITS;
-        SetGuestDsSel((PSEGMENT_SELECTOR)&Value);
+        SetGuestCr8(Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_ES:
+    case REGISTER_DR0:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         //
@@ -3147,13 +3477,12 @@ SetRegValue(PGUEST_REGS GuestRegs, PSYMBOL Symbol, UINT64 Value)
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        Value = Value & LOWER_16_BITS;
-        SetGuestEsSel((PSEGMENT_SELECTOR)&Value);
+        SetGuestDr0(Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_FS:
+    case REGISTER_DR1:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         //
@@ -3162,13 +3491,12 @@ SetRegValue(PGUEST_REGS GuestRegs, PSYMBOL Symbol, UINT64 Value)
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        Value = Value & LOWER_16_BITS;
-        SetGuestFsSel((PSEGMENT_SELECTOR)&Value);
+        SetGuestDr1(Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_GS:
+    case REGISTER_DR2:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         //
@@ -3177,13 +3505,12 @@ SetRegValue(PGUEST_REGS GuestRegs, PSYMBOL Symbol, UINT64 Value)
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        Value = Value & LOWER_16_BITS;
-        SetGuestGsSel((PSEGMENT_SELECTOR)&Value);
+        SetGuestDr2(Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_CS:
+    case REGISTER_DR3:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         //
@@ -3192,13 +3519,12 @@ SetRegValue(PGUEST_REGS GuestRegs, PSYMBOL Symbol, UINT64 Value)
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        Value = Value & LOWER_16_BITS;
-        SetGuestCsSel((PSEGMENT_SELECTOR)&Value);
+        SetGuestDr3(Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_SS:
+    case REGISTER_DR6:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         //
@@ -3207,13 +3533,12 @@ SetRegValue(PGUEST_REGS GuestRegs, PSYMBOL Symbol, UINT64 Value)
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        Value = Value & LOWER_16_BITS;
-        SetGuestSsSel((PSEGMENT_SELECTOR)&Value);
+        SetGuestDr6(Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
 
-    case REGISTER_RFLAGS:
+    case REGISTER_DR7:
 
 #ifdef SCRIPT_ENGINE_USER_MODE
         //
@@ -3222,623 +3547,543 @@ SetRegValue(PGUEST_REGS GuestRegs, PSYMBOL Symbol, UINT64 Value)
 #endif // SCRIPT_ENGINE_USER_MODE
 
 #ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value);
+        SetGuestDr7(Value);
 #endif // SCRIPT_ENGINE_KERNEL_MODE
 
         break;
+    }
+}
 
-    case REGISTER_EFLAGS:
-
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags((GetGuestRFlags() & UPPER_32_BITS) | (Value & LOWER_32_BITS));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+VOID
+SetValue(PGUEST_REGS GuestRegs, SCRIPT_ENGINE_VARIABLES_LIST * VariablesList, PSYMBOL Symbol, UINT64 Value)
+{
+    switch (Symbol->Type)
+    {
+    case SYMBOL_GLOBAL_ID_TYPE:
+        VariablesList->GlobalVariablesList[Symbol->Value] = Value;
+        return;
+    case SYMBOL_LOCAL_ID_TYPE:
+        VariablesList->LocalVariablesList[Symbol->Value] = Value;
+        return;
+    case SYMBOL_TEMP_TYPE:
+        VariablesList->TempList[Symbol->Value] = Value;
+        return;
+    case SYMBOL_REGISTER_TYPE:
+        SetRegValue(GuestRegs, Symbol, Value);
+        return;
+    }
+}
 
+VOID
+ScriptEngineGetOperatorName(PSYMBOL OperatorSymbol, CHAR * BufferForName)
+{
+    switch (OperatorSymbol->Value)
+    {
+    case FUNC_POI:
+        memcpy(BufferForName, "poi", 3);
+        break;
+    case FUNC_DB:
+        memcpy(BufferForName, "db", 2);
+        break;
+    case FUNC_DD:
+        memcpy(BufferForName, "dd", 2);
+        break;
+    case FUNC_DW:
+        memcpy(BufferForName, "dw", 2);
+        break;
+    case FUNC_DQ:
+        memcpy(BufferForName, "dq", 2);
+        break;
+    case FUNC_HI:
+        memcpy(BufferForName, "hi", 2);
+        break;
+    case FUNC_LOW:
+        memcpy(BufferForName, "low", 3);
+        break;
+    default:
+        memcpy(BufferForName, "error", 5);
         break;
+    }
+}
 
-    case REGISTER_FLAGS:
+BOOL
+ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
+                    ACTION_BUFFER                  ActionDetail,
+                    SCRIPT_ENGINE_VARIABLES_LIST * VariablesList,
+                    PSYMBOL_BUFFER                 CodeBuffer,
+                    int *                          Indx,
+                    PSYMBOL                        ErrorOperator)
+{
+    PSYMBOL Operator;
+    PSYMBOL Src0;
+    PSYMBOL Src1;
+    PSYMBOL Src2;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+    PSYMBOL Des;
+    UINT64  SrcVal0;
+    UINT64  SrcVal1;
+    UINT64  SrcVal2;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags((GetGuestRFlags() & UPPER_48_BITS) | (Value & LOWER_16_BITS));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+    UINT64 DesVal;
+    BOOL   HasError = FALSE;
 
-        break;
+    Operator = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
 
-    case REGISTER_CF:
+    *ErrorOperator = *Operator;
 
+    *Indx = *Indx + 1;
+    if (Operator->Type != SYMBOL_SEMANTIC_RULE_TYPE)
+    {
 #ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
+        ShowMessages("err, expecting operator type\n");
+        return HasError;
 #endif // SCRIPT_ENGINE_USER_MODE
+    };
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_CF) : GetGuestRFlags() & (~(X86_FLAGS_CF)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+    switch (Operator->Value)
+    {
+    case FUNC_ED:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        break;
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-    case REGISTER_PF:
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_PF) : GetGuestRFlags() & (~(X86_FLAGS_PF)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        DesVal = ScriptEngineFunctionEd(SrcVal1, SrcVal0, &HasError);
 
-        break;
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-    case REGISTER_AF:
+        return HasError;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+    case FUNC_EB:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_AF) : GetGuestRFlags() & (~(X86_FLAGS_AF)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-        break;
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-    case REGISTER_ZF:
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        DesVal = ScriptEngineFunctionEb(SrcVal1, SrcVal0, &HasError);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_ZF) : GetGuestRFlags() & (~(X86_FLAGS_ZF)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-        break;
+        return HasError;
 
-    case REGISTER_SF:
+    case FUNC_EQ:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_SF) : GetGuestRFlags() & (~(X86_FLAGS_SF)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-        break;
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-    case REGISTER_TF:
+        DesVal = ScriptEngineFunctionEq(SrcVal1, SrcVal0, &HasError);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_TF) : GetGuestRFlags() & (~(X86_FLAGS_TF)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        return HasError;
 
-        break;
+    case FUNC_INTERLOCKED_EXCHANGE:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-    case REGISTER_IF:
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_IF) : GetGuestRFlags() & (~(X86_FLAGS_IF)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        DesVal = ScriptEngineFunctionInterlockedExchange((volatile long long *)&SrcVal1, SrcVal0, &HasError);
 
-        break;
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-    case REGISTER_DF:
+        return HasError;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+    case FUNC_INTERLOCKED_EXCHANGE_ADD:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_DF) : GetGuestRFlags() & (~(X86_FLAGS_DF)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-        break;
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-    case REGISTER_OF:
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        DesVal = ScriptEngineFunctionInterlockedExchangeAdd((volatile long long *)SrcVal1, SrcVal0, &HasError);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_OF) : GetGuestRFlags() & (~(X86_FLAGS_OF)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-        break;
+        return HasError;
 
-    case REGISTER_IOPL:
+    case FUNC_INTERLOCKED_COMPARE_EXCHANGE:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (1 << X86_FLAGS_IOPL_SHIFT) : GetGuestRFlags() & (~(1 << X86_FLAGS_IOPL_SHIFT)));
-        Value = (Value >> 4) & 1;
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (1 << X86_FLAGS_IOPL_SHIFT_2ND_BIT) : GetGuestRFlags() & (~(1 << X86_FLAGS_IOPL_SHIFT_2ND_BIT)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-        break;
+        Src2  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-    case REGISTER_NT:
+        SrcVal2 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_NT) : GetGuestRFlags() & (~(X86_FLAGS_NT)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        DesVal = ScriptEngineFunctionInterlockedCompareExchange((volatile long long *)SrcVal2, SrcVal1, SrcVal0, &HasError);
 
-        break;
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-    case REGISTER_RF:
+        return HasError;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+    case FUNC_MAP_COUNT:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_RF) : GetGuestRFlags() & (~(X86_FLAGS_RF)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-        break;
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-    case REGISTER_VM:
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        DesVal = ScriptEngineFunctionMapUpdate(VariablesList->AggregationMaps,
+                                               SrcVal1,
+                                               SCRIPT_ENGINE_AGGREGATION_TYPE_COUNT,
+                                               SrcVal0,
+                                               1,
+                                               &HasError);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_VM) : GetGuestRFlags() & (~(X86_FLAGS_VM)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-        break;
+        return HasError;
 
-    case REGISTER_AC:
+    case FUNC_MAP_HIST:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_AC) : GetGuestRFlags() & (~(X86_FLAGS_AC)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-        break;
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-    case REGISTER_VIF:
+        DesVal = ScriptEngineFunctionMapUpdate(VariablesList->AggregationMaps,
+                                               SrcVal1,
+                                               SCRIPT_ENGINE_AGGREGATION_TYPE_HIST,
+                                               ScriptEngineAggregationGetHistogramBucket(SrcVal0),
+                                               1,
+                                               &HasError);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_VIF) : GetGuestRFlags() & (~(X86_FLAGS_VIF)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        return HasError;
 
-        break;
+    case FUNC_MAP_SUM:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-    case REGISTER_VIP:
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_VIP) : GetGuestRFlags() & (~(X86_FLAGS_VIP)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        Src2  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-        break;
+        SrcVal2 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src2, FALSE);
 
-    case REGISTER_ID:
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        DesVal = ScriptEngineFunctionMapUpdate(VariablesList->AggregationMaps,
+                                               SrcVal2,
+                                               SCRIPT_ENGINE_AGGREGATION_TYPE_SUM,
+                                               SrcVal1,
+                                               SrcVal0,
+                                               &HasError);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRFlags(Value & TRUE ? GetGuestRFlags() | (X86_FLAGS_ID) : GetGuestRFlags() & (~(X86_FLAGS_ID)));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-        break;
+        return HasError;
 
-    case REGISTER_RIP:
+    case FUNC_MAP_MIN:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRIP(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-        break;
+        Src2  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-    case REGISTER_EIP:
+        SrcVal2 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src2, FALSE);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRIP((GetGuestRIP() & UPPER_32_BITS) | (Value & LOWER_32_BITS));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        DesVal = ScriptEngineFunctionMapUpdate(VariablesList->AggregationMaps,
+                                               SrcVal2,
+                                               SCRIPT_ENGINE_AGGREGATION_TYPE_MIN,
+                                               SrcVal1,
+                                               SrcVal0,
+                                               &HasError);
 
-        break;
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-    case REGISTER_IP:
+        return HasError;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+    case FUNC_MAP_MAX:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestRIP((GetGuestRIP() & UPPER_48_BITS) | (Value & LOWER_16_BITS));
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-        break;
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-    case REGISTER_IDTR:
+        Src2  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        SrcVal2 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src2, FALSE);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestIdtr(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-        break;
+        DesVal = ScriptEngineFunctionMapUpdate(VariablesList->AggregationMaps,
+                                               SrcVal2,
+                                               SCRIPT_ENGINE_AGGREGATION_TYPE_MAX,
+                                               SrcVal1,
+                                               SrcVal0,
+                                               &HasError);
 
-    case REGISTER_LDTR:
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        return HasError;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestLdtr(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+    case FUNC_SPINLOCK_LOCK_CUSTOM_WAIT:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        break;
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-    case REGISTER_GDTR:
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        ScriptEngineFunctionSpinlockLockCustomWait((volatile long *)SrcVal1, SrcVal0, &HasError);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestGdtr(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        return HasError;
 
-        break;
+    case FUNC_PAUSE:
+        ScriptEngineFunctionPause(ActionDetail.Tag,
+                                  ActionDetail.ImmediatelySendTheResults,
+                                  GuestRegs,
+                                  ActionDetail.Context);
+        return HasError;
 
-    case REGISTER_TR:
+    case FUNC_OR:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestTr(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-        break;
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-    case REGISTER_CR0:
+        DesVal = SrcVal1 | SrcVal0;
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        return HasError;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestCr0(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+    case FUNC_INC:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        break;
+        DesVal = SrcVal0 + 1;
 
-    case REGISTER_CR2:
+        Des = Src0;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestCr2(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        return HasError;
 
-        break;
+    case FUNC_DEC:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-    case REGISTER_CR3:
+        DesVal = SrcVal0 - 1;
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        Des = Src0;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestCr3(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-        break;
+        return HasError;
 
-    case REGISTER_CR4:
+    case FUNC_XOR:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestCr4(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-        break;
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-    case REGISTER_CR8:
+        DesVal = SrcVal1 ^ SrcVal0;
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
+        return HasError;
 
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestCr8(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
+    case FUNC_AND:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        break;
+        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-    case REGISTER_DR0:
-
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestDr0(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
-        break;
-
-    case REGISTER_DR1:
-
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestDr1(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
-        break;
-
-    case REGISTER_DR2:
-
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestDr2(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
-        break;
-
-    case REGISTER_DR3:
-
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestDr3(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
-        break;
-
-    case REGISTER_DR6:
-
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestDr6(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
-        break;
-
-    case REGISTER_DR7:
-
-#ifdef SCRIPT_ENGINE_USER_MODE
-        //
-        // Nothing to do
-        //
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-        SetGuestDr7(Value);
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
-        break;
-    }
-}
-
-VOID
-SetValue(PGUEST_REGS GuestRegs, SCRIPT_ENGINE_VARIABLES_LIST * VariablesList, PSYMBOL Symbol, UINT64 Value)
-{
-    switch (Symbol->Type)
-    {
-    case SYMBOL_GLOBAL_ID_TYPE:
-        VariablesList->GlobalVariablesList[Symbol->Value] = Value;
-        return;
-    case SYMBOL_LOCAL_ID_TYPE:
-        VariablesList->LocalVariablesList[Symbol->Value] = Value;
-        return;
-    case SYMBOL_TEMP_TYPE:
-        VariablesList->TempList[Symbol->Value] = Value;
-        return;
-    case SYMBOL_REGISTER_TYPE:
-        SetRegValue(GuestRegs, Symbol, Value);
-        return;
-    }
-}
-
-VOID
-ScriptEngineGetOperatorName(PSYMBOL OperatorSymbol, CHAR * BufferForName)
-{
-    switch (OperatorSymbol->Value)
-    {
-    case FUNC_POI:
-        memcpy(BufferForName, "poi", 3);
-        break;
-    case FUNC_DB:
-        memcpy(BufferForName, "db", 2);
-        break;
-    case FUNC_DD:
-        memcpy(BufferForName, "dd", 2);
-        break;
-    case FUNC_DW:
-        memcpy(BufferForName, "dw", 2);
-        break;
-    case FUNC_DQ:
-        memcpy(BufferForName, "dq", 2);
-        break;
-    case FUNC_HI:
-        memcpy(BufferForName, "hi", 2);
-        break;
-    case FUNC_LOW:
-        memcpy(BufferForName, "low", 3);
-        break;
-    default:
-        memcpy(BufferForName, "error", 5);
-        break;
-    }
-}
-
-BOOL
-ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
-                    ACTION_BUFFER                  ActionDetail,
-                    SCRIPT_ENGINE_VARIABLES_LIST * VariablesList,
-                    PSYMBOL_BUFFER                 CodeBuffer,
-                    int *                          Indx,
-                    PSYMBOL                        ErrorOperator)
-{
-    PSYMBOL Operator;
-    PSYMBOL Src0;
-    PSYMBOL Src1;
-    PSYMBOL Src2;
-
-    PSYMBOL Des;
-    UINT64  SrcVal0;
-    UINT64  SrcVal1;
-    UINT64  SrcVal2;
-
-    UINT64 DesVal;
-    BOOL   HasError = FALSE;
+        SrcVal1 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-    Operator = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
 
-    *ErrorOperator = *Operator;
+        DesVal = SrcVal1 & SrcVal0;
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-    *Indx = *Indx + 1;
-    if (Operator->Type != SYMBOL_SEMANTIC_RULE_TYPE)
-    {
-#ifdef SCRIPT_ENGINE_USER_MODE
-        ShowMessages("err, expecting operator type\n");
         return HasError;
-#endif // SCRIPT_ENGINE_USER_MODE
-    };
 
-    switch (Operator->Value)
-    {
-    case FUNC_ED:
+    case FUNC_ASR:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -3856,13 +4101,12 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = ScriptEngineFunctionEd(SrcVal1, SrcVal0, &HasError);
-
+        DesVal = SrcVal1 >> SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_EB:
+    case FUNC_ASL:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -3880,13 +4124,12 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = ScriptEngineFunctionEb(SrcVal1, SrcVal0, &HasError);
-
+        DesVal = SrcVal1 << SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_EQ:
+    case FUNC_ADD:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -3896,7 +4139,6 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
         Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-
         SrcVal1 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
@@ -3904,13 +4146,12 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = ScriptEngineFunctionEq(SrcVal1, SrcVal0, &HasError);
-
+        DesVal = SrcVal1 + SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_INTERLOCKED_EXCHANGE:
+    case FUNC_SUB:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -3920,20 +4161,18 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
         Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-
         SrcVal1 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
+
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = ScriptEngineFunctionInterlockedExchange((volatile long long *)&SrcVal1, SrcVal0, &HasError);
-
+        DesVal = SrcVal1 - SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
-
-    case FUNC_INTERLOCKED_EXCHANGE_ADD:
+    case FUNC_MUL:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -3943,7 +4182,6 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
         Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-
         SrcVal1 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
@@ -3951,13 +4189,12 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = ScriptEngineFunctionInterlockedExchangeAdd((volatile long long *)SrcVal1, SrcVal0, &HasError);
-
+        DesVal = SrcVal1 * SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_INTERLOCKED_COMPARE_EXCHANGE:
+    case FUNC_DIV:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -3967,28 +4204,24 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
         Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-
         SrcVal1 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-        Src2  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-
-        SrcVal2 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
-
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
+        if (SrcVal0 == 0)
+        {
+            HasError = TRUE;
+            return HasError;
+        }
 
-        DesVal = ScriptEngineFunctionInterlockedCompareExchange((volatile long long *)SrcVal2, SrcVal1, SrcVal0, &HasError);
+        DesVal = SrcVal1 / SrcVal0;
 
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
-
-    case FUNC_SPINLOCK_LOCK_CUSTOM_WAIT:
+    case FUNC_MOD:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -3998,22 +4231,23 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
         Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-
         SrcVal1 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
-        ScriptEngineFunctionSpinlockLockCustomWait((volatile long *)SrcVal1, SrcVal0, &HasError);
-
-        return HasError;
+        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+        *Indx = *Indx + 1;
+        if (SrcVal0 == 0)
+        {
+            HasError = TRUE;
+            return HasError;
+        }
+        DesVal = SrcVal1 % SrcVal0;
+        SetValue(GuestRegs, VariablesList, Des, DesVal);
 
-    case FUNC_PAUSE:
-        ScriptEngineFunctionPause(ActionDetail.Tag,
-                                  ActionDetail.ImmediatelySendTheResults,
-                                  GuestRegs,
-                                  ActionDetail.Context);
         return HasError;
 
-    case FUNC_OR:
+    case FUNC_GT:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -4023,7 +4257,6 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
         Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-
         SrcVal1 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
@@ -4031,42 +4264,12 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 | SrcVal0;
+        DesVal = SrcVal1 > SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_INC:
-        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
-
-        DesVal = SrcVal0 + 1;
-
-        Des = Src0;
-
-        SetValue(GuestRegs, VariablesList, Des, DesVal);
-
-        return HasError;
-
-    case FUNC_DEC:
-        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
-
-        DesVal = SrcVal0 - 1;
-
-        Des = Src0;
-
-        SetValue(GuestRegs, VariablesList, Des, DesVal);
-
-        return HasError;
-
-    case FUNC_XOR:
+    case FUNC_LT:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -4076,7 +4279,6 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
         Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-
         SrcVal1 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
@@ -4084,12 +4286,12 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 ^ SrcVal0;
+        DesVal = SrcVal1 < SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_AND:
+    case FUNC_EGT:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -4099,7 +4301,6 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
         Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-
         SrcVal1 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
@@ -4107,12 +4308,12 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 & SrcVal0;
+        DesVal = SrcVal1 >= SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_ASR:
+    case FUNC_ELT:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -4122,7 +4323,6 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
         Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-
         SrcVal1 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
@@ -4130,12 +4330,13 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 >> SrcVal0;
+        DesVal = SrcVal1 <= SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_ASL:
+    case FUNC_EQUAL:
+
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -4145,7 +4346,6 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
         Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-
         SrcVal1 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
 
@@ -4153,12 +4353,12 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 << SrcVal0;
+        DesVal = SrcVal1 == SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_ADD:
+    case FUNC_NEQ:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -4175,241 +4375,201 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 + SrcVal0;
+        DesVal = SrcVal1 != SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_SUB:
+    case FUNC_POI:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
         SrcVal0 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal1 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
-
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 - SrcVal0;
+        DesVal = ScriptEngineKeywordPoi((PUINT64)GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE),
+                                        &HasError);
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
-    case FUNC_MUL:
+
+    case FUNC_DB:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
         SrcVal0 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal1 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
-
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 * SrcVal0;
+        DesVal = ScriptEngineKeywordDb((PUINT64)GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE),
+                                       &HasError);
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
-
-    case FUNC_DIV:
+    case FUNC_DW:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
         SrcVal0 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal1 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
-
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-        if (SrcVal0 == 0)
-        {
-            HasError = TRUE;
-            return HasError;
-        }
-
-        DesVal = SrcVal1 / SrcVal0;
 
+        DesVal = ScriptEngineKeywordDb((PUINT64)GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE),
+                                       &HasError);
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
-    case FUNC_MOD:
+    case FUNC_DQ:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
         SrcVal0 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal1 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
-
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-        if (SrcVal0 == 0)
-        {
-            HasError = TRUE;
-            return HasError;
-        }
-        DesVal = SrcVal1 % SrcVal0;
+
+        DesVal = ScriptEngineKeywordDq((PUINT64)GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE),
+                                       &HasError);
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_GT:
+    case FUNC_NOT:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
         SrcVal0 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal1 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
-
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 > SrcVal0;
+        DesVal = ~SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_LT:
+    case FUNC_REF:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal1 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
+        //
+        // It's reference, we need an address
+        //
+        SrcVal0 = GetValue(GuestRegs, ActionDetail, VariablesList, Src0, TRUE);
 
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 < SrcVal0;
+        DesVal = SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_EGT:
+    case FUNC_CHECK_ADDRESS:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
         SrcVal0 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal1 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
-
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 >= SrcVal0;
+#ifdef SCRIPT_ENGINE_USER_MODE
+
+        DesVal = 1; // TRUE by default in user-mode
+
+#endif // SCRIPT_ENGINE_USER_MODE
+
+#ifdef SCRIPT_ENGINE_KERNEL_MODE
+
+        if (CheckMemoryAccessSafety(SrcVal0, sizeof(BYTE)))
+        {
+            DesVal = 1; // TRUE
+        }
+        else
+        {
+            DesVal = 0; // FALSE
+        }
+
+#endif // SCRIPT_ENGINE_KERNEL_MODE
+
+#ifdef SCRIPT_ENGINE_USER_MODE
+
+        DesVal = 1; // TRUE by default in user-mode
+
+#endif // SCRIPT_ENGINE_USER_MODE
+
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_ELT:
+    case FUNC_STRLEN:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
         SrcVal0 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal1 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
-
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 <= SrcVal0;
+        DesVal = ScriptEngineFunctionStrlen((const char *)SrcVal0);
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_EQUAL:
-
+    case FUNC_WCSLEN:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
         SrcVal0 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal1 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
-
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 == SrcVal0;
+        DesVal = ScriptEngineFunctionWcslen((const wchar_t *)SrcVal0);
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_NEQ:
+    case FUNC_INTERLOCKED_INCREMENT:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
         SrcVal0 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        Src1  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal1 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src1, FALSE);
-
         Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = SrcVal1 != SrcVal0;
+        DesVal = ScriptEngineFunctionInterlockedIncrement((volatile long long *)SrcVal0, &HasError);
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_POI:
+    case FUNC_INTERLOCKED_DECREMENT:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -4420,13 +4580,12 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = ScriptEngineKeywordPoi((PUINT64)GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE),
-                                        &HasError);
+        DesVal = ScriptEngineFunctionInterlockedDecrement((volatile long long *)SrcVal0, &HasError);
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_DB:
+    case FUNC_NEG:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -4437,12 +4596,12 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = ScriptEngineKeywordDb((PUINT64)GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE),
-                                       &HasError);
+        DesVal = -(INT64)SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
-    case FUNC_DW:
+
+    case FUNC_HI:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -4453,12 +4612,13 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = ScriptEngineKeywordDb((PUINT64)GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE),
+        DesVal = ScriptEngineKeywordHi((PUINT64)GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE),
                                        &HasError);
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
-    case FUNC_DQ:
+
+    case FUNC_LOW:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -4469,13 +4629,12 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = ScriptEngineKeywordDq((PUINT64)GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE),
-                                       &HasError);
+        DesVal = ScriptEngineKeywordLow((PUINT64)GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE),
+                                        &HasError);
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
-
-    case FUNC_NOT:
+    case FUNC_MOV:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
@@ -4486,234 +4645,46 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
 
-        DesVal = ~SrcVal0;
+        DesVal = SrcVal0;
         SetValue(GuestRegs, VariablesList, Des, DesVal);
 
         return HasError;
 
-    case FUNC_REF:
+    case FUNC_PRINT:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
         //
-        // It's reference, we need an address
+        // Call the target function
         //
-        SrcVal0 = GetValue(GuestRegs, ActionDetail, VariablesList, Src0, TRUE);
+        ScriptEngineFunctionPrint(ActionDetail.Tag,
+                                  ActionDetail.ImmediatelySendTheResults,
+                                  SrcVal0);
+        return HasError;
 
-        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
+    case FUNC_TEST_STATEMENT:
+        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
+                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
+        SrcVal0 =
+            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
-        DesVal = SrcVal0;
-        SetValue(GuestRegs, VariablesList, Des, DesVal);
-
+        //
+        // Call the target function
+        //
+        ScriptEngineFunctionTestStatement(ActionDetail.Tag,
+                                          ActionDetail.ImmediatelySendTheResults,
+                                          SrcVal0);
         return HasError;
 
-    case FUNC_CHECK_ADDRESS:
+    case FUNC_SPINLOCK_LOCK:
         Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
                          (unsigned long long)(*Indx * sizeof(SYMBOL)));
         *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
-
-        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-
-#ifdef SCRIPT_ENGINE_USER_MODE
-
-        DesVal = 1; // TRUE by default in user-mode
-
-#endif // SCRIPT_ENGINE_USER_MODE
-
-#ifdef SCRIPT_ENGINE_KERNEL_MODE
-
-        if (CheckMemoryAccessSafety(SrcVal0, sizeof(BYTE)))
-        {
-            DesVal = 1; // TRUE
-        }
-        else
-        {
-            DesVal = 0; // FALSE
-        }
-
-#endif // SCRIPT_ENGINE_KERNEL_MODE
-
-#ifdef SCRIPT_ENGINE_USER_MODE
-
-        DesVal = 1; // TRUE by default in user-mode
-
-#endif // SCRIPT_ENGINE_USER_MODE
-
-        SetValue(GuestRegs, VariablesList, Des, DesVal);
-
-        return HasError;
-
-    case FUNC_STRLEN:
-        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
-
-        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-
-        DesVal = ScriptEngineFunctionStrlen((const char *)SrcVal0);
-        SetValue(GuestRegs, VariablesList, Des, DesVal);
-
-        return HasError;
-
-    case FUNC_WCSLEN:
-        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
-
-        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-
-        DesVal = ScriptEngineFunctionWcslen((const wchar_t *)SrcVal0);
-        SetValue(GuestRegs, VariablesList, Des, DesVal);
-
-        return HasError;
-
-    case FUNC_INTERLOCKED_INCREMENT:
-        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
-
-        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-
-        DesVal = ScriptEngineFunctionInterlockedIncrement((volatile long long *)SrcVal0, &HasError);
-        SetValue(GuestRegs, VariablesList, Des, DesVal);
-
-        return HasError;
-
-    case FUNC_INTERLOCKED_DECREMENT:
-        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
-
-        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-
-        DesVal = ScriptEngineFunctionInterlockedDecrement((volatile long long *)SrcVal0, &HasError);
-        SetValue(GuestRegs, VariablesList, Des, DesVal);
-
-        return HasError;
-
-    case FUNC_NEG:
-        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
-
-        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-
-        DesVal = -(INT64)SrcVal0;
-        SetValue(GuestRegs, VariablesList, Des, DesVal);
-
-        return HasError;
-
-    case FUNC_HI:
-        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
-
-        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-
-        DesVal = ScriptEngineKeywordHi((PUINT64)GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE),
-                                       &HasError);
-        SetValue(GuestRegs, VariablesList, Des, DesVal);
-
-        return HasError;
-
-    case FUNC_LOW:
-        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
-
-        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-
-        DesVal = ScriptEngineKeywordLow((PUINT64)GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE),
-                                        &HasError);
-        SetValue(GuestRegs, VariablesList, Des, DesVal);
-
-        return HasError;
-    case FUNC_MOV:
-        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
-
-        Des   = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                        (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-
-        DesVal = SrcVal0;
-        SetValue(GuestRegs, VariablesList, Des, DesVal);
-
-        return HasError;
-
-    case FUNC_PRINT:
-        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
-
-        //
-        // Call the target function
-        //
-        ScriptEngineFunctionPrint(ActionDetail.Tag,
-                                  ActionDetail.ImmediatelySendTheResults,
-                                  SrcVal0);
-        return HasError;
-
-    case FUNC_TEST_STATEMENT:
-        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-        SrcVal0 =
-            GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
-
-        //
-        // Call the target function
-        //
-        ScriptEngineFunctionTestStatement(ActionDetail.Tag,
-                                          ActionDetail.ImmediatelySendTheResults,
-                                          SrcVal0);
-        return HasError;
-
-    case FUNC_SPINLOCK_LOCK:
-        Src0  = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                         (unsigned long long)(*Indx * sizeof(SYMBOL)));
-        *Indx = *Indx + 1;
-
+
         SrcVal0 =
             GetValue(GuestRegs, ActionDetail, VariablesList, Src0, FALSE);
 
@@ -4869,6 +4840,7 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
             VariablesList,
             ActionDetail.Tag,
             ActionDetail.ImmediatelySendTheResults,
+            (UINT32)(Src0 - CodeBuffer->Head),
             (char *)&Src0->Value,
             Src1->Value,
             Src2,
@@ -4877,3 +4849,1819 @@ ScriptEngineExecute(PGUEST_REGS                    GuestRegs,
         return HasError;
     }
 }
+
+//////////////////////////////////////////////////
+//            	     Bytecode                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Kinds of the operands of the bytecode, the kind of each
+ * operand is resolved once while lowering the symbol buffer
+ *
+ * @details The kinds up to SCRIPT_ENGINE_OPERAND_GP_REGISTER are
+ * accessed directly from their base address (in the state of the
+ * bytecode) plus their byte offset
+ *
+ */
+#define SCRIPT_ENGINE_OPERAND_TEMP            0
+#define SCRIPT_ENGINE_OPERAND_GLOBAL          1
+#define SCRIPT_ENGINE_OPERAND_LOCAL           2
+#define SCRIPT_ENGINE_OPERAND_GP_REGISTER     3
+#define SCRIPT_ENGINE_OPERAND_IMMEDIATE       4
+#define SCRIPT_ENGINE_OPERAND_REGISTER        5
+#define SCRIPT_ENGINE_OPERAND_PSEUDO_REGISTER 6
+
+/**
+ * @brief Count of the kinds of operands that are accessed directly
+ *
+ */
+#define SCRIPT_ENGINE_OPERAND_DIRECT_KINDS (SCRIPT_ENGINE_OPERAND_GP_REGISTER + 1)
+
+/**
+ * @brief Maximum number of the operands of an instruction in the bytecode
+ *
+ */
+#define SCRIPT_ENGINE_BYTECODE_MAXIMUM_OPERANDS 3
+
+/**
+ * @brief Size of the buffer that is needed to lower a symbol buffer
+ * with a special count of symbols (each operator at least needs one symbol)
+ *
+ */
+#define SCRIPT_ENGINE_BYTECODE_SIZE(CountOfSymbols)                           \
+    (sizeof(SCRIPT_ENGINE_BYTECODE) + ((UINT64)(CountOfSymbols)) *           \
+                                          sizeof(SCRIPT_ENGINE_BYTECODE_INSTRUCTION))
+
+/**
+ * @brief An operand of the bytecode
+ *
+ */
+typedef struct _SCRIPT_ENGINE_BYTECODE_OPERAND
+{
+    UINT16 Kind;
+    UINT16 Shift; // only for gp registers
+    UINT32 Index; // byte offset from the base of direct kinds or id of the (pseudo-)register
+    UINT64 Value; // mask of direct kinds, immediate value or the target of jumps
+
+} SCRIPT_ENGINE_BYTECODE_OPERAND, *PSCRIPT_ENGINE_BYTECODE_OPERAND;
+
+struct _SCRIPT_ENGINE_BYTECODE_STATE;
+struct _SCRIPT_ENGINE_BYTECODE_INSTRUCTION;
+
+/**
+ * @brief Handler of an instruction of the bytecode
+ *
+ */
+typedef BOOLEAN (*SCRIPT_ENGINE_BYTECODE_HANDLER)(struct _SCRIPT_ENGINE_BYTECODE_STATE *       State,
+                                                  struct _SCRIPT_ENGINE_BYTECODE_INSTRUCTION * Instruction);
+
+/**
+ * @brief An instruction of the bytecode, it holds the address of its
+ * own handler so the interpreter needs no decoding and no switch
+ *
+ * @details Operands are in the same order as the symbol buffer (e.g.,
+ * Src0, Src1 and Des)
+ *
+ */
+typedef struct _SCRIPT_ENGINE_BYTECODE_INSTRUCTION
+{
+    SCRIPT_ENGINE_BYTECODE_HANDLER Handler;
+    UINT32                         Operator;    // FUNC_* of the operator
+    UINT32                         SymbolIndex; // index of the operator in the symbol buffer
+    SCRIPT_ENGINE_BYTECODE_OPERAND Operands[SCRIPT_ENGINE_BYTECODE_MAXIMUM_OPERANDS];
+
+} SCRIPT_ENGINE_BYTECODE_INSTRUCTION, *PSCRIPT_ENGINE_BYTECODE_INSTRUCTION;
+
+/**
+ * @brief The bytecode of a script
+ *
+ */
+typedef struct _SCRIPT_ENGINE_BYTECODE
+{
+    UINT32                             CountOfInstructions;
+    UINT32                             Reserved;
+    SCRIPT_ENGINE_BYTECODE_INSTRUCTION Instructions[1];
+
+} SCRIPT_ENGINE_BYTECODE, *PSCRIPT_ENGINE_BYTECODE;
+
+/**
+ * @brief State of running a bytecode
+ *
+ */
+typedef struct _SCRIPT_ENGINE_BYTECODE_STATE
+{
+    UINT64                         Bases[SCRIPT_ENGINE_OPERAND_DIRECT_KINDS]; // base address of direct kinds
+    PGUEST_REGS                    GuestRegs;
+    ACTION_BUFFER                  ActionDetail;
+    SCRIPT_ENGINE_VARIABLES_LIST * VariablesList;
+    PSYMBOL_BUFFER                 CodeBuffer; // needed for the operators that are not lowered
+    PSYMBOL                        ErrorOperator;
+    UINT32                         Next; // index of the next instruction
+
+} SCRIPT_ENGINE_BYTECODE_STATE, *PSCRIPT_ENGINE_BYTECODE_STATE;
+
+/**
+ * @brief Read an operand of the bytecode
+ *
+ * @param State
+ * @param Operand
+ * @return UINT64
+ */
+UINT64
+ScriptEngineBytecodeGetOperand(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_OPERAND Operand)
+{
+    SYMBOL PseudoRegister;
+
+    if (Operand->Kind < SCRIPT_ENGINE_OPERAND_DIRECT_KINDS)
+    {
+        return (*(UINT64 *)(State->Bases[Operand->Kind] + Operand->Index) >> Operand->Shift) & Operand->Value;
+    }
+
+    switch (Operand->Kind)
+    {
+    case SCRIPT_ENGINE_OPERAND_IMMEDIATE:
+        return Operand->Value;
+
+    case SCRIPT_ENGINE_OPERAND_REGISTER:
+        return GetRegValue(State->GuestRegs, (REGS_ENUM)Operand->Index);
+
+    case SCRIPT_ENGINE_OPERAND_PSEUDO_REGISTER:
+        PseudoRegister.Type  = SYMBOL_PSEUDO_REG_TYPE;
+        PseudoRegister.Value = Operand->Index;
+        return GetPseudoRegValue(&PseudoRegister, State->ActionDetail);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Write to an operand of the bytecode
+ * @details Writing to immediate values and pseudo-registers is ignored
+ * (the same as SetValue)
+ *
+ * @param State
+ * @param Operand
+ * @param Value
+ * @return VOID
+ */
+VOID
+ScriptEngineBytecodeSetOperand(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_OPERAND Operand, UINT64 Value)
+{
+    UINT64 * Location;
+    SYMBOL   RegisterSymbol;
+
+    if (Operand->Kind < SCRIPT_ENGINE_OPERAND_DIRECT_KINDS)
+    {
+        //
+        // The mask of variables is all ones, so it's a simple move for them
+        //
+        Location  = (UINT64 *)(State->Bases[Operand->Kind] + Operand->Index);
+        *Location = (*Location & ~(Operand->Value << Operand->Shift)) | ((Value & Operand->Value) << Operand->Shift);
+    }
+    else if (Operand->Kind == SCRIPT_ENGINE_OPERAND_REGISTER)
+    {
+        RegisterSymbol.Type  = SYMBOL_REGISTER_TYPE;
+        RegisterSymbol.Value = Operand->Index;
+        SetRegValue(State->GuestRegs, &RegisterSymbol, Value);
+    }
+}
+
+/**
+ * @brief Report an error of an instruction of the bytecode
+ *
+ * @param State
+ * @param Instruction
+ * @return BOOLEAN always TRUE
+ */
+BOOLEAN
+ScriptEngineBytecodeError(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    State->ErrorOperator->Type  = SYMBOL_SEMANTIC_RULE_TYPE;
+    State->ErrorOperator->Value = Instruction->Operator;
+
+    return TRUE;
+}
+
+//
+// *** Handlers of the bytecode ***
+//
+// Each handler returns TRUE if there was an error, the same as
+// ScriptEngineExecute
+//
+
+// operators that are not lowered, run them from the symbol buffer
+BOOLEAN
+ScriptEngineBytecodeFallback(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    int Indx = Instruction->SymbolIndex;
+
+    return ScriptEngineExecute(State->GuestRegs,
+                               State->ActionDetail,
+                               State->VariablesList,
+                               State->CodeBuffer,
+                               &Indx,
+                               State->ErrorOperator);
+}
+
+// mov
+BOOLEAN
+ScriptEngineBytecodeMov(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    ScriptEngineBytecodeSetOperand(State,
+                                   &Instruction->Operands[1],
+                                   ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]));
+    return FALSE;
+}
+
+// ++
+BOOLEAN
+ScriptEngineBytecodeInc(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    ScriptEngineBytecodeSetOperand(State,
+                                   &Instruction->Operands[0],
+                                   ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]) + 1);
+    return FALSE;
+}
+
+// --
+BOOLEAN
+ScriptEngineBytecodeDec(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    ScriptEngineBytecodeSetOperand(State,
+                                   &Instruction->Operands[0],
+                                   ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]) - 1);
+    return FALSE;
+}
+
+// ~
+BOOLEAN
+ScriptEngineBytecodeNot(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    ScriptEngineBytecodeSetOperand(State,
+                                   &Instruction->Operands[1],
+                                   ~ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]));
+    return FALSE;
+}
+
+// unary -
+BOOLEAN
+ScriptEngineBytecodeNeg(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    ScriptEngineBytecodeSetOperand(State,
+                                   &Instruction->Operands[1],
+                                   -(INT64)ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]));
+    return FALSE;
+}
+
+// |
+BOOLEAN
+ScriptEngineBytecodeOr(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 | SrcVal0);
+    return FALSE;
+}
+
+// ^
+BOOLEAN
+ScriptEngineBytecodeXor(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 ^ SrcVal0);
+    return FALSE;
+}
+
+// &
+BOOLEAN
+ScriptEngineBytecodeAnd(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 & SrcVal0);
+    return FALSE;
+}
+
+// >>
+BOOLEAN
+ScriptEngineBytecodeAsr(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 >> SrcVal0);
+    return FALSE;
+}
+
+// <<
+BOOLEAN
+ScriptEngineBytecodeAsl(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 << SrcVal0);
+    return FALSE;
+}
+
+// +
+BOOLEAN
+ScriptEngineBytecodeAdd(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 + SrcVal0);
+    return FALSE;
+}
+
+// -
+BOOLEAN
+ScriptEngineBytecodeSub(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 - SrcVal0);
+    return FALSE;
+}
+
+// *
+BOOLEAN
+ScriptEngineBytecodeMul(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 * SrcVal0);
+    return FALSE;
+}
+
+// /
+BOOLEAN
+ScriptEngineBytecodeDiv(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    if (SrcVal0 == 0)
+    {
+        return ScriptEngineBytecodeError(State, Instruction);
+    }
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 / SrcVal0);
+    return FALSE;
+}
+
+// %
+BOOLEAN
+ScriptEngineBytecodeMod(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    if (SrcVal0 == 0)
+    {
+        return ScriptEngineBytecodeError(State, Instruction);
+    }
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 % SrcVal0);
+    return FALSE;
+}
+
+// >
+BOOLEAN
+ScriptEngineBytecodeGt(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 > SrcVal0);
+    return FALSE;
+}
+
+// <
+BOOLEAN
+ScriptEngineBytecodeLt(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 < SrcVal0);
+    return FALSE;
+}
+
+// >=
+BOOLEAN
+ScriptEngineBytecodeEgt(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 >= SrcVal0);
+    return FALSE;
+}
+
+// <=
+BOOLEAN
+ScriptEngineBytecodeElt(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 <= SrcVal0);
+    return FALSE;
+}
+
+// ==
+BOOLEAN
+ScriptEngineBytecodeEqual(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 == SrcVal0);
+    return FALSE;
+}
+
+// !=
+BOOLEAN
+ScriptEngineBytecodeNeq(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    UINT64 SrcVal0 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]);
+    UINT64 SrcVal1 = ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[2], SrcVal1 != SrcVal0);
+    return FALSE;
+}
+
+// poi
+BOOLEAN
+ScriptEngineBytecodePoi(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    BOOL   HasError = FALSE;
+    UINT64 DesVal   = ScriptEngineKeywordPoi((PUINT64)ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]),
+                                           &HasError);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[1], DesVal);
+
+    return HasError ? ScriptEngineBytecodeError(State, Instruction) : FALSE;
+}
+
+// db
+BOOLEAN
+ScriptEngineBytecodeDb(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    BOOL   HasError = FALSE;
+    UINT64 DesVal   = ScriptEngineKeywordDb((PUINT64)ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]),
+                                          &HasError);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[1], DesVal);
+
+    return HasError ? ScriptEngineBytecodeError(State, Instruction) : FALSE;
+}
+
+// dq
+BOOLEAN
+ScriptEngineBytecodeDq(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    BOOL   HasError = FALSE;
+    UINT64 DesVal   = ScriptEngineKeywordDq((PUINT64)ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]),
+                                          &HasError);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[1], DesVal);
+
+    return HasError ? ScriptEngineBytecodeError(State, Instruction) : FALSE;
+}
+
+// hi
+BOOLEAN
+ScriptEngineBytecodeHi(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    BOOL   HasError = FALSE;
+    UINT64 DesVal   = ScriptEngineKeywordHi((PUINT64)ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]),
+                                          &HasError);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[1], DesVal);
+
+    return HasError ? ScriptEngineBytecodeError(State, Instruction) : FALSE;
+}
+
+// low
+BOOLEAN
+ScriptEngineBytecodeLow(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    BOOL   HasError = FALSE;
+    UINT64 DesVal   = ScriptEngineKeywordLow((PUINT64)ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]),
+                                           &HasError);
+
+    ScriptEngineBytecodeSetOperand(State, &Instruction->Operands[1], DesVal);
+
+    return HasError ? ScriptEngineBytecodeError(State, Instruction) : FALSE;
+}
+
+// print
+BOOLEAN
+ScriptEngineBytecodePrint(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    ScriptEngineFunctionPrint(State->ActionDetail.Tag,
+                              State->ActionDetail.ImmediatelySendTheResults,
+                              ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]));
+    return FALSE;
+}
+
+// test_statement
+BOOLEAN
+ScriptEngineBytecodeTestStatement(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    ScriptEngineFunctionTestStatement(State->ActionDetail.Tag,
+                                      State->ActionDetail.ImmediatelySendTheResults,
+                                      ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[0]));
+    return FALSE;
+}
+
+// jmp
+BOOLEAN
+ScriptEngineBytecodeJmp(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    State->Next = (UINT32)Instruction->Operands[0].Value;
+    return FALSE;
+}
+
+// jz
+BOOLEAN
+ScriptEngineBytecodeJz(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    if (ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]) == 0)
+    {
+        State->Next = (UINT32)Instruction->Operands[0].Value;
+    }
+
+    return FALSE;
+}
+
+// jnz
+BOOLEAN
+ScriptEngineBytecodeJnz(PSCRIPT_ENGINE_BYTECODE_STATE State, PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction)
+{
+    if (ScriptEngineBytecodeGetOperand(State, &Instruction->Operands[1]) != 0)
+    {
+        State->Next = (UINT32)Instruction->Operands[0].Value;
+    }
+
+    return FALSE;
+}
+
+/**
+ * @brief Resolve the kind of a symbol for the bytecode
+ *
+ * @param Symbol
+ * @param Operand
+ * @return BOOLEAN FALSE if the symbol can't be used as an operand
+ */
+BOOLEAN
+ScriptEngineBytecodeLowerOperand(PSYMBOL Symbol, PSCRIPT_ENGINE_BYTECODE_OPERAND Operand)
+{
+    Operand->Shift = 0;
+    Operand->Index = 0;
+    Operand->Value = MAXUINT64;
+
+    switch (Symbol->Type)
+    {
+    case SYMBOL_NUM_TYPE:
+        Operand->Kind  = SCRIPT_ENGINE_OPERAND_IMMEDIATE;
+        Operand->Value = Symbol->Value;
+        return TRUE;
+
+    case SYMBOL_TEMP_TYPE:
+        Operand->Kind = SCRIPT_ENGINE_OPERAND_TEMP;
+        break;
+
+    case SYMBOL_GLOBAL_ID_TYPE:
+        Operand->Kind = SCRIPT_ENGINE_OPERAND_GLOBAL;
+        break;
+
+    case SYMBOL_LOCAL_ID_TYPE:
+        Operand->Kind = SCRIPT_ENGINE_OPERAND_LOCAL;
+        break;
+
+    case SYMBOL_REGISTER_TYPE:
+
+        if (Symbol->Value <= REGISTER_R15L && ScriptEngineGpRegisters[Symbol->Value].Mask != 0)
+        {
+            Operand->Kind  = SCRIPT_ENGINE_OPERAND_GP_REGISTER;
+            Operand->Index = ScriptEngineGpRegisters[Symbol->Value].Offset;
+            Operand->Shift = (UINT16)ScriptEngineGpRegisters[Symbol->Value].Shift;
+            Operand->Value = ScriptEngineGpRegisters[Symbol->Value].Mask;
+            return TRUE;
+        }
+
+        Operand->Kind  = SCRIPT_ENGINE_OPERAND_REGISTER;
+        Operand->Index = (UINT32)Symbol->Value;
+        return Symbol->Value == Operand->Index;
+
+    case SYMBOL_PSEUDO_REG_TYPE:
+        Operand->Kind  = SCRIPT_ENGINE_OPERAND_PSEUDO_REGISTER;
+        Operand->Index = (UINT32)Symbol->Value;
+        return Symbol->Value == Operand->Index;
+
+    default:
+        return FALSE;
+    }
+
+    //
+    // Variables are accessed by their byte offset, it should fit in the operand
+    //
+    if (Symbol->Value > MAXUINT32 / sizeof(UINT64))
+    {
+        return FALSE;
+    }
+
+    Operand->Index = (UINT32)(Symbol->Value * sizeof(UINT64));
+
+    return TRUE;
+}
+
+/**
+ * @brief Lower a symbol buffer to the bytecode
+ * @details The hot operators are lowered to their own handlers with
+ * pre-resolved operands, other operators are executed by
+ * ScriptEngineExecute from the symbol buffer
+ *
+ * @param CodeBuffer The symbol buffer
+ * @param Bytecode Buffer to save the bytecode, its size should be at
+ * least SCRIPT_ENGINE_BYTECODE_SIZE(CodeBuffer->Pointer)
+ * @return BOOLEAN FALSE if the symbol buffer can't be lowered, in this
+ * case the symbol buffer should be run by ScriptEngineExecute
+ */
+BOOLEAN
+ScriptEngineLowerToBytecode(PSYMBOL_BUFFER CodeBuffer, PSCRIPT_ENGINE_BYTECODE Bytecode)
+{
+    PSYMBOL                             Operator;
+    PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction;
+    SCRIPT_ENGINE_BYTECODE_HANDLER      Handler;
+    UINT32                              CountOfOperands;
+    UINT32                              Indx  = 0;
+    UINT32                              Count = 0;
+
+    while (Indx < CodeBuffer->Pointer)
+    {
+        Operator = &CodeBuffer->Head[Indx];
+
+        if (Operator->Type != SYMBOL_SEMANTIC_RULE_TYPE)
+        {
+            return FALSE;
+        }
+
+        Instruction              = &Bytecode->Instructions[Count];
+        Instruction->Operator    = (UINT32)Operator->Value;
+        Instruction->SymbolIndex = Indx;
+        Indx++;
+
+        //
+        // Find the handler and the count of operands (sources and
+        // destination), the same as ScriptEngineExecute
+        //
+        switch (Operator->Value)
+        {
+        case FUNC_OR:
+            Handler         = ScriptEngineBytecodeOr;
+            CountOfOperands = 3;
+            break;
+        case FUNC_XOR:
+            Handler         = ScriptEngineBytecodeXor;
+            CountOfOperands = 3;
+            break;
+        case FUNC_AND:
+            Handler         = ScriptEngineBytecodeAnd;
+            CountOfOperands = 3;
+            break;
+        case FUNC_ASR:
+            Handler         = ScriptEngineBytecodeAsr;
+            CountOfOperands = 3;
+            break;
+        case FUNC_ASL:
+            Handler         = ScriptEngineBytecodeAsl;
+            CountOfOperands = 3;
+            break;
+        case FUNC_ADD:
+            Handler         = ScriptEngineBytecodeAdd;
+            CountOfOperands = 3;
+            break;
+        case FUNC_SUB:
+            Handler         = ScriptEngineBytecodeSub;
+            CountOfOperands = 3;
+            break;
+        case FUNC_MUL:
+            Handler         = ScriptEngineBytecodeMul;
+            CountOfOperands = 3;
+            break;
+        case FUNC_DIV:
+            Handler         = ScriptEngineBytecodeDiv;
+            CountOfOperands = 3;
+            break;
+        case FUNC_MOD:
+            Handler         = ScriptEngineBytecodeMod;
+            CountOfOperands = 3;
+            break;
+        case FUNC_GT:
+            Handler         = ScriptEngineBytecodeGt;
+            CountOfOperands = 3;
+            break;
+        case FUNC_LT:
+            Handler         = ScriptEngineBytecodeLt;
+            CountOfOperands = 3;
+            break;
+        case FUNC_EGT:
+            Handler         = ScriptEngineBytecodeEgt;
+            CountOfOperands = 3;
+            break;
+        case FUNC_ELT:
+            Handler         = ScriptEngineBytecodeElt;
+            CountOfOperands = 3;
+            break;
+        case FUNC_EQUAL:
+            Handler         = ScriptEngineBytecodeEqual;
+            CountOfOperands = 3;
+            break;
+        case FUNC_NEQ:
+            Handler         = ScriptEngineBytecodeNeq;
+            CountOfOperands = 3;
+            break;
+        case FUNC_MOV:
+            Handler         = ScriptEngineBytecodeMov;
+            CountOfOperands = 2;
+            break;
+        case FUNC_NOT:
+            Handler         = ScriptEngineBytecodeNot;
+            CountOfOperands = 2;
+            break;
+        case FUNC_NEG:
+            Handler         = ScriptEngineBytecodeNeg;
+            CountOfOperands = 2;
+            break;
+        case FUNC_POI:
+            Handler         = ScriptEngineBytecodePoi;
+            CountOfOperands = 2;
+            break;
+        case FUNC_DB:
+            Handler         = ScriptEngineBytecodeDb;
+            CountOfOperands = 2;
+            break;
+        case FUNC_DQ:
+            Handler         = ScriptEngineBytecodeDq;
+            CountOfOperands = 2;
+            break;
+        case FUNC_HI:
+            Handler         = ScriptEngineBytecodeHi;
+            CountOfOperands = 2;
+            break;
+        case FUNC_LOW:
+            Handler         = ScriptEngineBytecodeLow;
+            CountOfOperands = 2;
+            break;
+        case FUNC_INC:
+            Handler         = ScriptEngineBytecodeInc;
+            CountOfOperands = 1;
+            break;
+        case FUNC_DEC:
+            Handler         = ScriptEngineBytecodeDec;
+            CountOfOperands = 1;
+            break;
+        case FUNC_JZ:
+            Handler         = ScriptEngineBytecodeJz;
+            CountOfOperands = 2;
+            break;
+        case FUNC_JNZ:
+            Handler         = ScriptEngineBytecodeJnz;
+            CountOfOperands = 2;
+            break;
+        case FUNC_JMP:
+            Handler         = ScriptEngineBytecodeJmp;
+            CountOfOperands = 1;
+            break;
+        case FUNC_PRINT:
+            Handler         = ScriptEngineBytecodePrint;
+            CountOfOperands = 1;
+            break;
+        case FUNC_TEST_STATEMENT:
+            Handler         = ScriptEngineBytecodeTestStatement;
+            CountOfOperands = 1;
+            break;
+
+        //
+        // Operators that are not lowered, we only need to skip their operands
+        //
+        case FUNC_ED:
+        case FUNC_EB:
+        case FUNC_EQ:
+        case FUNC_INTERLOCKED_EXCHANGE:
+        case FUNC_INTERLOCKED_EXCHANGE_ADD:
+        case FUNC_MAP_COUNT:
+        case FUNC_MAP_HIST:
+            Handler         = ScriptEngineBytecodeFallback;
+            CountOfOperands = 3;
+            break;
+        case FUNC_INTERLOCKED_COMPARE_EXCHANGE:
+        case FUNC_MAP_SUM:
+        case FUNC_MAP_MIN:
+        case FUNC_MAP_MAX:
+            Handler         = ScriptEngineBytecodeFallback;
+            CountOfOperands = 4;
+            break;
+        case FUNC_SPINLOCK_LOCK_CUSTOM_WAIT:
+        case FUNC_DW:
+        case FUNC_REF:
+        case FUNC_CHECK_ADDRESS:
+        case FUNC_STRLEN:
+        case FUNC_WCSLEN:
+        case FUNC_INTERLOCKED_INCREMENT:
+        case FUNC_INTERLOCKED_DECREMENT:
+            Handler         = ScriptEngineBytecodeFallback;
+            CountOfOperands = 2;
+            break;
+        case FUNC_SPINLOCK_LOCK:
+        case FUNC_SPINLOCK_UNLOCK:
+        case FUNC_DISABLE_EVENT:
+        case FUNC_ENABLE_EVENT:
+        case FUNC_FORMATS:
+            Handler         = ScriptEngineBytecodeFallback;
+            CountOfOperands = 1;
+            break;
+        case FUNC_PAUSE:
+            Handler         = ScriptEngineBytecodeFallback;
+            CountOfOperands = 0;
+            break;
+        case FUNC_PRINTF:
+
+            //
+            // Format string, count of arguments and the arguments
+            //
+            if (Indx >= CodeBuffer->Pointer)
+            {
+                return FALSE;
+            }
+
+            Indx = Indx + 1 +
+                   (UINT32)((sizeof(unsigned long long) + strnlen((char *)&CodeBuffer->Head[Indx].Value,
+                                                                  (CodeBuffer->Pointer - Indx) * sizeof(SYMBOL) - sizeof(unsigned long long))) /
+                            sizeof(SYMBOL));
+
+            if (Indx >= CodeBuffer->Pointer || CodeBuffer->Head[Indx].Value > CodeBuffer->Pointer)
+            {
+                return FALSE;
+            }
+
+            Handler         = ScriptEngineBytecodeFallback;
+            CountOfOperands = 1 + (UINT32)CodeBuffer->Head[Indx].Value;
+            break;
+
+        default:
+
+            //
+            // Unknown operator (or an operator that ScriptEngineExecute
+            // doesn't support), let the interpreter decide
+            //
+            return FALSE;
+        }
+
+        if (CountOfOperands > CodeBuffer->Pointer - Indx)
+        {
+            return FALSE;
+        }
+
+        if (Handler != ScriptEngineBytecodeFallback)
+        {
+            for (UINT32 i = 0; i < CountOfOperands; i++)
+            {
+                if (!ScriptEngineBytecodeLowerOperand(&CodeBuffer->Head[Indx + i], &Instruction->Operands[i]))
+                {
+                    return FALSE;
+                }
+            }
+        }
+
+        Instruction->Handler = Handler;
+        Indx += CountOfOperands;
+        Count++;
+    }
+
+    Bytecode->CountOfInstructions = Count;
+
+    //
+    // Convert the targets of jumps from the index of symbols to
+    // the index of instructions
+    //
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Instruction = &Bytecode->Instructions[i];
+
+        if (Instruction->Handler != ScriptEngineBytecodeJmp &&
+            Instruction->Handler != ScriptEngineBytecodeJz &&
+            Instruction->Handler != ScriptEngineBytecodeJnz)
+        {
+            continue;
+        }
+
+        if (Instruction->Operands[0].Kind != SCRIPT_ENGINE_OPERAND_IMMEDIATE)
+        {
+            return FALSE;
+        }
+
+        if (Instruction->Operands[0].Value >= CodeBuffer->Pointer)
+        {
+            //
+            // Jumping to the end of the script
+            //
+            Instruction->Operands[0].Value = Count;
+            continue;
+        }
+
+        //
+        // Instructions are sorted by their symbol index
+        //
+        UINT32 Low  = 0;
+        UINT32 High = Count;
+
+        while (Low < High)
+        {
+            UINT32 Middle = (Low + High) / 2;
+
+            if (Bytecode->Instructions[Middle].SymbolIndex < Instruction->Operands[0].Value)
+            {
+                Low = Middle + 1;
+            }
+            else
+            {
+                High = Middle;
+            }
+        }
+
+        if (Low == Count || Bytecode->Instructions[Low].SymbolIndex != Instruction->Operands[0].Value)
+        {
+            //
+            // The target is not an operator
+            //
+            return FALSE;
+        }
+
+        Instruction->Operands[0].Value = Low;
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Initialize the state of running a bytecode
+ *
+ * @param State
+ * @param GuestRegs
+ * @param ActionDetail
+ * @param VariablesList
+ * @param CodeBuffer The symbol buffer that the bytecode is lowered from
+ * @param ErrorOperator The operator that caused the error (if any)
+ * @return VOID
+ */
+VOID
+ScriptEngineInitializeBytecodeState(PSCRIPT_ENGINE_BYTECODE_STATE  State,
+                                    PGUEST_REGS                    GuestRegs,
+                                    ACTION_BUFFER                  ActionDetail,
+                                    SCRIPT_ENGINE_VARIABLES_LIST * VariablesList,
+                                    PSYMBOL_BUFFER                 CodeBuffer,
+                                    PSYMBOL                        ErrorOperator)
+{
+    State->Bases[SCRIPT_ENGINE_OPERAND_TEMP]        = (UINT64)VariablesList->TempList;
+    State->Bases[SCRIPT_ENGINE_OPERAND_GLOBAL]      = (UINT64)VariablesList->GlobalVariablesList;
+    State->Bases[SCRIPT_ENGINE_OPERAND_LOCAL]       = (UINT64)VariablesList->LocalVariablesList;
+    State->Bases[SCRIPT_ENGINE_OPERAND_GP_REGISTER] = (UINT64)GuestRegs;
+
+    State->GuestRegs     = GuestRegs;
+    State->ActionDetail  = ActionDetail;
+    State->VariablesList = VariablesList;
+    State->CodeBuffer    = CodeBuffer;
+    State->ErrorOperator = ErrorOperator;
+    State->Next          = 0;
+}
+
+/**
+ * @brief Run the bytecode of a script
+ *
+ * @param GuestRegs
+ * @param ActionDetail
+ * @param VariablesList
+ * @param CodeBuffer The symbol buffer that the bytecode is lowered from
+ * @param Bytecode
+ * @param ErrorOperator The operator that caused the error (if any)
+ * @return BOOL TRUE if there was an error, the same as ScriptEngineExecute
+ */
+BOOL
+ScriptEngineExecuteBytecode(PGUEST_REGS                    GuestRegs,
+                            ACTION_BUFFER                  ActionDetail,
+                            SCRIPT_ENGINE_VARIABLES_LIST * VariablesList,
+                            PSYMBOL_BUFFER                 CodeBuffer,
+                            PSCRIPT_ENGINE_BYTECODE        Bytecode,
+                            PSYMBOL                        ErrorOperator)
+{
+    SCRIPT_ENGINE_BYTECODE_STATE        State;
+    PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction;
+
+    ScriptEngineInitializeBytecodeState(&State, GuestRegs, ActionDetail, VariablesList, CodeBuffer, ErrorOperator);
+
+    while (State.Next < Bytecode->CountOfInstructions)
+    {
+        Instruction = &Bytecode->Instructions[State.Next];
+        State.Next++;
+
+        if (Instruction->Handler(&State, Instruction))
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+//////////////////////////////////////////////////
+//            	       JIT                      //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Registers of x86-64 that are used by the native code
+ *
+ * @details rbx holds the state of the bytecode and r12, r13, r14
+ * and r15 hold the base address of the direct kinds of operands
+ * (in the same order as the kinds), all of them are preserved by
+ * the callee in both of the calling conventions
+ *
+ */
+#define SCRIPT_ENGINE_JIT_RAX 0
+#define SCRIPT_ENGINE_JIT_RCX 1
+#define SCRIPT_ENGINE_JIT_RDX 2
+#define SCRIPT_ENGINE_JIT_RBX 3
+#define SCRIPT_ENGINE_JIT_RSI 6
+#define SCRIPT_ENGINE_JIT_RDI 7
+#define SCRIPT_ENGINE_JIT_R12 12
+
+#define SCRIPT_ENGINE_JIT_BASE_REGISTER(Kind) (SCRIPT_ENGINE_JIT_R12 + (Kind))
+
+/**
+ * @brief Registers of the first and the second arguments, the native
+ * code is called by (and calls the handlers of) the compiled code so
+ * it follows the calling convention of the compiler
+ *
+ */
+#ifdef _WIN32
+#    define SCRIPT_ENGINE_JIT_ARGUMENT0 SCRIPT_ENGINE_JIT_RCX
+#    define SCRIPT_ENGINE_JIT_ARGUMENT1 SCRIPT_ENGINE_JIT_RDX
+#else
+#    define SCRIPT_ENGINE_JIT_ARGUMENT0 SCRIPT_ENGINE_JIT_RDI
+#    define SCRIPT_ENGINE_JIT_ARGUMENT1 SCRIPT_ENGINE_JIT_RSI
+#endif
+
+/**
+ * @brief Opcodes (after 0x0f) of the conditional jumps
+ *
+ */
+#define SCRIPT_ENGINE_JIT_JZ  0x84
+#define SCRIPT_ENGINE_JIT_JNZ 0x85
+
+/**
+ * @brief Maximum size of the native code of an instruction of the
+ * bytecode and the size of the prologue and the epilogue
+ *
+ */
+#define SCRIPT_ENGINE_JIT_MAXIMUM_INSTRUCTION_SIZE 128
+#define SCRIPT_ENGINE_JIT_PROLOGUE_EPILOGUE_SIZE   64
+
+/**
+ * @brief Size of the buffer that is needed for the native code of a
+ * bytecode with a special count of instructions
+ *
+ */
+#define SCRIPT_ENGINE_JIT_SIZE(CountOfInstructions) \
+    (SCRIPT_ENGINE_JIT_PROLOGUE_EPILOGUE_SIZE +     \
+     ((UINT64)(CountOfInstructions)) * SCRIPT_ENGINE_JIT_MAXIMUM_INSTRUCTION_SIZE)
+
+/**
+ * @brief Size of the labels that are needed while compiling a bytecode
+ * (one for each instruction, one for the end and one for the errors)
+ *
+ */
+#define SCRIPT_ENGINE_JIT_LABELS_SIZE(CountOfInstructions) \
+    ((((UINT64)(CountOfInstructions)) + 2) * sizeof(UINT32))
+
+/**
+ * @brief The native code of a script, it returns TRUE if there was
+ * an error, the same as ScriptEngineExecute
+ *
+ */
+typedef BOOLEAN (*SCRIPT_ENGINE_JIT_FUNCTION)(PSCRIPT_ENGINE_BYTECODE_STATE State);
+
+/**
+ * @brief State of emitting the native code
+ *
+ */
+typedef struct _SCRIPT_ENGINE_JIT_EMITTER
+{
+    UINT8 *  Code;
+    UINT32   Size;     // count of the emitted bytes (even if they don't fit)
+    UINT32   Capacity; // size of the code buffer
+    UINT32 * Labels;   // offset of the native code of each instruction
+
+} SCRIPT_ENGINE_JIT_EMITTER, *PSCRIPT_ENGINE_JIT_EMITTER;
+
+/**
+ * @brief Emit a byte of the native code
+ *
+ * @param Emitter
+ * @param Byte
+ * @return VOID
+ */
+VOID
+ScriptEngineJitEmitByte(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT8 Byte)
+{
+    if (Emitter->Size < Emitter->Capacity)
+    {
+        Emitter->Code[Emitter->Size] = Byte;
+    }
+
+    Emitter->Size++;
+}
+
+/**
+ * @brief Emit the bytes of a fixed instruction
+ *
+ * @param Emitter
+ * @param Bytes
+ * @param Length
+ * @return VOID
+ */
+VOID
+ScriptEngineJitEmitBytes(PSCRIPT_ENGINE_JIT_EMITTER Emitter, const char * Bytes, UINT32 Length)
+{
+    for (UINT32 i = 0; i < Length; i++)
+    {
+        ScriptEngineJitEmitByte(Emitter, (UINT8)Bytes[i]);
+    }
+}
+
+/**
+ * @brief Emit a little-endian value
+ *
+ * @param Emitter
+ * @param Value
+ * @param Length Size of the value in bytes
+ * @return VOID
+ */
+VOID
+ScriptEngineJitEmitValue(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT64 Value, UINT32 Length)
+{
+    for (UINT32 i = 0; i < Length; i++)
+    {
+        ScriptEngineJitEmitByte(Emitter, (UINT8)(Value >> (i * 8)));
+    }
+}
+
+/**
+ * @brief Emit a load (zero-extended to 64 bits) or a store of a
+ * register from or to [Base + Displacement]
+ *
+ * @param Emitter
+ * @param IsStore
+ * @param Size Size of the memory (1, 2, 4 or 8 bytes)
+ * @param Register rax or rcx
+ * @param Base
+ * @param Displacement
+ * @return VOID
+ */
+VOID
+ScriptEngineJitEmitMemory(PSCRIPT_ENGINE_JIT_EMITTER Emitter,
+                          BOOLEAN                    IsStore,
+                          UINT32                     Size,
+                          UINT8                      Register,
+                          UINT8                      Base,
+                          UINT32                     Displacement)
+{
+    UINT8 Rex = 0;
+
+    if (Size == sizeof(UINT64))
+    {
+        Rex |= 0x8; // REX.W
+    }
+
+    if (Register >= 8)
+    {
+        Rex |= 0x4; // REX.R
+    }
+
+    if (Base >= 8)
+    {
+        Rex |= 0x1; // REX.B
+    }
+
+    if (IsStore && Size == sizeof(UINT16))
+    {
+        ScriptEngineJitEmitByte(Emitter, 0x66);
+    }
+
+    if (Rex != 0)
+    {
+        ScriptEngineJitEmitByte(Emitter, 0x40 | Rex);
+    }
+
+    if (IsStore)
+    {
+        //
+        // mov [mem], r8 or mov [mem], r16/32/64
+        //
+        ScriptEngineJitEmitByte(Emitter, Size == sizeof(UINT8) ? 0x88 : 0x89);
+    }
+    else if (Size == sizeof(UINT8) || Size == sizeof(UINT16))
+    {
+        //
+        // movzx r32, byte [mem] or movzx r32, word [mem]
+        //
+        ScriptEngineJitEmitByte(Emitter, 0x0f);
+        ScriptEngineJitEmitByte(Emitter, Size == sizeof(UINT8) ? 0xb6 : 0xb7);
+    }
+    else
+    {
+        //
+        // mov r32/64, [mem]
+        //
+        ScriptEngineJitEmitByte(Emitter, 0x8b);
+    }
+
+    //
+    // [Base + disp32], rsp and r12 as the base need a SIB
+    //
+    ScriptEngineJitEmitByte(Emitter, 0x80 | ((Register & 7) << 3) | (Base & 7));
+
+    if ((Base & 7) == 4)
+    {
+        ScriptEngineJitEmitByte(Emitter, 0x24);
+    }
+
+    ScriptEngineJitEmitValue(Emitter, Displacement, sizeof(UINT32));
+}
+
+/**
+ * @brief Emit a mov of an immediate value to a register
+ *
+ * @param Emitter
+ * @param Register rax, rcx, rdx, rsi or rdi
+ * @param Value
+ * @return VOID
+ */
+VOID
+ScriptEngineJitEmitLoadImmediate(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT8 Register, UINT64 Value)
+{
+    ScriptEngineJitEmitByte(Emitter, 0x48);
+
+    if ((UINT64)(INT64)(INT32)Value == Value)
+    {
+        //
+        // mov r64, simm32
+        //
+        ScriptEngineJitEmitByte(Emitter, 0xc7);
+        ScriptEngineJitEmitByte(Emitter, 0xc0 | Register);
+        ScriptEngineJitEmitValue(Emitter, Value, sizeof(UINT32));
+    }
+    else
+    {
+        //
+        // mov r64, imm64
+        //
+        ScriptEngineJitEmitByte(Emitter, 0xb8 | Register);
+        ScriptEngineJitEmitValue(Emitter, Value, sizeof(UINT64));
+    }
+}
+
+/**
+ * @brief Get the size of an operand that the native code can access
+ * directly
+ *
+ * @param Operand
+ * @return UINT32 Size of the operand in the memory, zero if it should
+ * be accessed by the handlers of the bytecode
+ */
+UINT32
+ScriptEngineJitGetOperandSize(PSCRIPT_ENGINE_BYTECODE_OPERAND Operand)
+{
+    UINT32 Size;
+
+    if (Operand->Kind == SCRIPT_ENGINE_OPERAND_IMMEDIATE)
+    {
+        return sizeof(UINT64);
+    }
+
+    if (Operand->Kind >= SCRIPT_ENGINE_OPERAND_DIRECT_KINDS)
+    {
+        return 0;
+    }
+
+    switch (Operand->Value)
+    {
+    case MAXUINT64:
+        Size = sizeof(UINT64);
+        break;
+    case LOWER_32_BITS:
+        Size = sizeof(UINT32);
+        break;
+    case LOWER_16_BITS:
+        Size = sizeof(UINT16);
+        break;
+    case LOWER_8_BITS:
+        Size = sizeof(UINT8);
+        break;
+    default:
+        return 0;
+    }
+
+    //
+    // The masked part (e.g., ah) should be a whole part of the 64-bit value
+    //
+    if (Operand->Shift % 8 != 0 || Operand->Shift / 8 + Size > sizeof(UINT64))
+    {
+        return 0;
+    }
+
+    return Size;
+}
+
+/**
+ * @brief Emit loading an operand (that is accessed directly) to a register
+ *
+ * @param Emitter
+ * @param Register rax or rcx
+ * @param Operand
+ * @return VOID
+ */
+VOID
+ScriptEngineJitEmitLoadOperand(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT8 Register, PSCRIPT_ENGINE_BYTECODE_OPERAND Operand)
+{
+    if (Operand->Kind == SCRIPT_ENGINE_OPERAND_IMMEDIATE)
+    {
+        ScriptEngineJitEmitLoadImmediate(Emitter, Register, Operand->Value);
+        return;
+    }
+
+    ScriptEngineJitEmitMemory(Emitter,
+                              FALSE,
+                              ScriptEngineJitGetOperandSize(Operand),
+                              Register,
+                              SCRIPT_ENGINE_JIT_BASE_REGISTER(Operand->Kind),
+                              Operand->Index + Operand->Shift / 8);
+}
+
+/**
+ * @brief Emit storing rax to an operand (that is accessed directly),
+ * only the masked part of the operand is written
+ *
+ * @param Emitter
+ * @param Operand
+ * @return VOID
+ */
+VOID
+ScriptEngineJitEmitStoreOperand(PSCRIPT_ENGINE_JIT_EMITTER Emitter, PSCRIPT_ENGINE_BYTECODE_OPERAND Operand)
+{
+    if (Operand->Kind == SCRIPT_ENGINE_OPERAND_IMMEDIATE)
+    {
+        //
+        // Writing to immediate values is ignored (the same as SetValue)
+        //
+        return;
+    }
+
+    ScriptEngineJitEmitMemory(Emitter,
+                              TRUE,
+                              ScriptEngineJitGetOperandSize(Operand),
+                              SCRIPT_ENGINE_JIT_RAX,
+                              SCRIPT_ENGINE_JIT_BASE_REGISTER(Operand->Kind),
+                              Operand->Index + Operand->Shift / 8);
+}
+
+/**
+ * @brief Emit calling a function with the state of the bytecode as
+ * its first argument, the result is in rax
+ *
+ * @param Emitter
+ * @param Function
+ * @param Argument The second argument (an instruction or an operand)
+ * @return VOID
+ */
+VOID
+ScriptEngineJitEmitCall(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT64 Function, PVOID Argument)
+{
+    //
+    // mov Argument0, rbx
+    //
+    ScriptEngineJitEmitByte(Emitter, 0x48);
+    ScriptEngineJitEmitByte(Emitter, 0x89);
+    ScriptEngineJitEmitByte(Emitter, 0xc0 | (SCRIPT_ENGINE_JIT_RBX << 3) | SCRIPT_ENGINE_JIT_ARGUMENT0);
+
+    //
+    // mov Argument1, imm64
+    //
+    ScriptEngineJitEmitByte(Emitter, 0x48);
+    ScriptEngineJitEmitByte(Emitter, 0xb8 | SCRIPT_ENGINE_JIT_ARGUMENT1);
+    ScriptEngineJitEmitValue(Emitter, (UINT64)Argument, sizeof(UINT64));
+
+    //
+    // mov rax, imm64 ; call rax
+    //
+    ScriptEngineJitEmitByte(Emitter, 0x48);
+    ScriptEngineJitEmitByte(Emitter, 0xb8);
+    ScriptEngineJitEmitValue(Emitter, Function, sizeof(UINT64));
+    ScriptEngineJitEmitBytes(Emitter, "\xff\xd0", 2);
+}
+
+/**
+ * @brief Emit a jump to a label
+ *
+ * @param Emitter
+ * @param Condition Zero for jmp, SCRIPT_ENGINE_JIT_JZ or SCRIPT_ENGINE_JIT_JNZ
+ * @param Label Index of the target instruction
+ * @return VOID
+ */
+VOID
+ScriptEngineJitEmitJump(PSCRIPT_ENGINE_JIT_EMITTER Emitter, UINT8 Condition, UINT32 Label)
+{
+    if (Condition == 0)
+    {
+        ScriptEngineJitEmitByte(Emitter, 0xe9);
+    }
+    else
+    {
+        ScriptEngineJitEmitByte(Emitter, 0x0f);
+        ScriptEngineJitEmitByte(Emitter, Condition);
+    }
+
+    //
+    // The labels of the next instructions are not known in the first
+    // pass, but the size of the code is the same in both passes
+    //
+    ScriptEngineJitEmitValue(Emitter, Emitter->Labels[Label] - (Emitter->Size + sizeof(UINT32)), sizeof(UINT32));
+}
+
+/**
+ * @brief Emit the native code of an instruction of the bytecode
+ *
+ * @details Operators that access the memory or have side effects (poi,
+ * db, print, printf, etc.) and operators that their operands are not
+ * accessed directly are run by calling their handlers
+ *
+ * @param Emitter
+ * @param Instruction
+ * @param CountOfInstructions
+ * @return VOID
+ */
+VOID
+ScriptEngineJitEmitInstruction(PSCRIPT_ENGINE_JIT_EMITTER          Emitter,
+                               PSCRIPT_ENGINE_BYTECODE_INSTRUCTION Instruction,
+                               UINT32                              CountOfInstructions)
+{
+    PSCRIPT_ENGINE_BYTECODE_OPERAND Operands = Instruction->Operands;
+    UINT32                          CountOfOperands;
+    UINT32                          Patch;
+
+    //
+    // Find the count of operands of the operators that have native code
+    //
+    switch (Instruction->Operator)
+    {
+    case FUNC_JMP:
+        ScriptEngineJitEmitJump(Emitter, 0, (UINT32)Operands[0].Value);
+        return;
+
+    case FUNC_JZ:
+    case FUNC_JNZ:
+
+        //
+        // The condition is read by a callback if it's not accessed directly
+        //
+        if (ScriptEngineJitGetOperandSize(&Operands[1]) != 0)
+        {
+            ScriptEngineJitEmitLoadOperand(Emitter, SCRIPT_ENGINE_JIT_RAX, &Operands[1]);
+        }
+        else
+        {
+            ScriptEngineJitEmitCall(Emitter, (UINT64)ScriptEngineBytecodeGetOperand, &Operands[1]);
+        }
+
+        ScriptEngineJitEmitBytes(Emitter, "\x48\x85\xc0", 3); // test rax, rax
+        ScriptEngineJitEmitJump(Emitter,
+                                Instruction->Operator == FUNC_JZ ? SCRIPT_ENGINE_JIT_JZ : SCRIPT_ENGINE_JIT_JNZ,
+                                (UINT32)Operands[0].Value);
+        return;
+
+    case FUNC_INC:
+    case FUNC_DEC:
+        CountOfOperands = 1;
+        break;
+
+    case FUNC_MOV:
+    case FUNC_NOT:
+    case FUNC_NEG:
+        CountOfOperands = 2;
+        break;
+
+    case FUNC_OR:
+    case FUNC_XOR:
+    case FUNC_AND:
+    case FUNC_ASR:
+    case FUNC_ASL:
+    case FUNC_ADD:
+    case FUNC_SUB:
+    case FUNC_MUL:
+    case FUNC_DIV:
+    case FUNC_MOD:
+    case FUNC_GT:
+    case FUNC_LT:
+    case FUNC_EGT:
+    case FUNC_ELT:
+    case FUNC_EQUAL:
+    case FUNC_NEQ:
+        CountOfOperands = 3;
+        break;
+
+    default:
+        CountOfOperands = 0;
+        break;
+    }
+
+    if (Instruction->Handler == ScriptEngineBytecodeFallback)
+    {
+        CountOfOperands = 0;
+    }
+
+    for (UINT32 i = 0; i < CountOfOperands; i++)
+    {
+        if (ScriptEngineJitGetOperandSize(&Operands[i]) == 0)
+        {
+            CountOfOperands = 0;
+            break;
+        }
+    }
+
+    if (CountOfOperands == 0)
+    {
+        //
+        // Call the handler, the handler saves the error operator
+        //
+        ScriptEngineJitEmitCall(Emitter, (UINT64)Instruction->Handler, Instruction);
+        ScriptEngineJitEmitBytes(Emitter, "\x84\xc0", 2); // test al, al
+        ScriptEngineJitEmitJump(Emitter, SCRIPT_ENGINE_JIT_JNZ, CountOfInstructions + 1);
+        return;
+    }
+
+    if (CountOfOperands == 1)
+    {
+        //
+        // ++ and --
+        //
+        ScriptEngineJitEmitLoadOperand(Emitter, SCRIPT_ENGINE_JIT_RAX, &Operands[0]);
+        ScriptEngineJitEmitBytes(Emitter, Instruction->Operator == FUNC_INC ? "\x48\x83\xc0\x01" : "\x48\x83\xe8\x01", 4);
+        ScriptEngineJitEmitStoreOperand(Emitter, &Operands[0]);
+        return;
+    }
+
+    if (CountOfOperands == 2)
+    {
+        ScriptEngineJitEmitLoadOperand(Emitter, SCRIPT_ENGINE_JIT_RAX, &Operands[0]);
+
+        if (Instruction->Operator == FUNC_NOT)
+        {
+            ScriptEngineJitEmitBytes(Emitter, "\x48\xf7\xd0", 3); // not rax
+        }
+        else if (Instruction->Operator == FUNC_NEG)
+        {
+            ScriptEngineJitEmitBytes(Emitter, "\x48\xf7\xd8", 3); // neg rax
+        }
+
+        ScriptEngineJitEmitStoreOperand(Emitter, &Operands[1]);
+        return;
+    }
+
+    //
+    // Binary operators compute SrcVal1 (rax) op SrcVal0 (rcx)
+    //
+    ScriptEngineJitEmitLoadOperand(Emitter, SCRIPT_ENGINE_JIT_RCX, &Operands[0]);
+    ScriptEngineJitEmitLoadOperand(Emitter, SCRIPT_ENGINE_JIT_RAX, &Operands[1]);
+
+    switch (Instruction->Operator)
+    {
+    case FUNC_OR:
+        ScriptEngineJitEmitBytes(Emitter, "\x48\x09\xc8", 3); // or rax, rcx
+        break;
+    case FUNC_XOR:
+        ScriptEngineJitEmitBytes(Emitter, "\x48\x31\xc8", 3); // xor rax, rcx
+        break;
+    case FUNC_AND:
+        ScriptEngineJitEmitBytes(Emitter, "\x48\x21\xc8", 3); // and rax, rcx
+        break;
+    case FUNC_ASR:
+        ScriptEngineJitEmitBytes(Emitter, "\x48\xd3\xe8", 3); // shr rax, cl
+        break;
+    case FUNC_ASL:
+        ScriptEngineJitEmitBytes(Emitter, "\x48\xd3\xe0", 3); // shl rax, cl
+        break;
+    case FUNC_ADD:
+        ScriptEngineJitEmitBytes(Emitter, "\x48\x01\xc8", 3); // add rax, rcx
+        break;
+    case FUNC_SUB:
+        ScriptEngineJitEmitBytes(Emitter, "\x48\x29\xc8", 3); // sub rax, rcx
+        break;
+    case FUNC_MUL:
+        ScriptEngineJitEmitBytes(Emitter, "\x48\x0f\xaf\xc1", 4); // imul rax, rcx
+        break;
+    case FUNC_DIV:
+    case FUNC_MOD:
+
+        //
+        // test rcx, rcx ; jnz (over the error) ; call the error handler ;
+        // jmp to the error exit
+        //
+        ScriptEngineJitEmitBytes(Emitter, "\x48\x85\xc9\x75", 4);
+        Patch = Emitter->Size;
+        ScriptEngineJitEmitByte(Emitter, 0);
+        ScriptEngineJitEmitCall(Emitter, (UINT64)ScriptEngineBytecodeError, Instruction);
+        ScriptEngineJitEmitJump(Emitter, 0, CountOfInstructions + 1);
+
+        if (Patch < Emitter->Capacity)
+        {
+            Emitter->Code[Patch] = (UINT8)(Emitter->Size - (Patch + 1));
+        }
+
+        ScriptEngineJitEmitBytes(Emitter, "\x31\xd2\x48\xf7\xf1", 5); // xor edx, edx ; div rcx
+
+        if (Instruction->Operator == FUNC_MOD)
+        {
+            ScriptEngineJitEmitBytes(Emitter, "\x48\x89\xd0", 3); // mov rax, rdx
+        }
+        break;
+    default:
+
+        //
+        // Comparisons, cmp rax, rcx ; setcc al ; movzx eax, al
+        //
+        ScriptEngineJitEmitBytes(Emitter, "\x48\x39\xc8\x0f", 4);
+
+        switch (Instruction->Operator)
+        {
+        case FUNC_GT:
+            ScriptEngineJitEmitByte(Emitter, 0x97); // seta
+            break;
+        case FUNC_LT:
+            ScriptEngineJitEmitByte(Emitter, 0x92); // setb
+            break;
+        case FUNC_EGT:
+            ScriptEngineJitEmitByte(Emitter, 0x93); // setae
+            break;
+        case FUNC_ELT:
+            ScriptEngineJitEmitByte(Emitter, 0x96); // setbe
+            break;
+        case FUNC_EQUAL:
+            ScriptEngineJitEmitByte(Emitter, 0x94); // sete
+            break;
+        default:
+            ScriptEngineJitEmitByte(Emitter, 0x95); // setne
+            break;
+        }
+
+        ScriptEngineJitEmitBytes(Emitter, "\xc0\x0f\xb6\xc0", 4);
+        break;
+    }
+
+    ScriptEngineJitEmitStoreOperand(Emitter, &Operands[2]);
+}
+
+/**
+ * @brief Emit the native code of a bytecode
+ *
+ * @param Emitter
+ * @param Bytecode
+ * @return VOID
+ */
+VOID
+ScriptEngineJitEmitCode(PSCRIPT_ENGINE_JIT_EMITTER Emitter, PSCRIPT_ENGINE_BYTECODE Bytecode)
+{
+    UINT32 Count = Bytecode->CountOfInstructions;
+
+    Emitter->Size = 0;
+
+    //
+    // push rbx ; push r12 ; push r13 ; push r14 ; push r15 ; sub rsp, 0x20
+    // (the stack is aligned and has the home space of the arguments)
+    //
+    ScriptEngineJitEmitBytes(Emitter, "\x53\x41\x54\x41\x55\x41\x56\x41\x57\x48\x83\xec\x20", 13);
+
+    //
+    // mov rbx, Argument0 (the state)
+    //
+    ScriptEngineJitEmitByte(Emitter, 0x48);
+    ScriptEngineJitEmitByte(Emitter, 0x89);
+    ScriptEngineJitEmitByte(Emitter, 0xc0 | (SCRIPT_ENGINE_JIT_ARGUMENT0 << 3) | SCRIPT_ENGINE_JIT_RBX);
+
+    //
+    // Load the base address of the direct kinds
+    //
+    for (UINT8 Kind = 0; Kind < SCRIPT_ENGINE_OPERAND_DIRECT_KINDS; Kind++)
+    {
+        ScriptEngineJitEmitMemory(Emitter,
+                                  FALSE,
+                                  sizeof(UINT64),
+                                  SCRIPT_ENGINE_JIT_BASE_REGISTER(Kind),
+                                  SCRIPT_ENGINE_JIT_RBX,
+                                  FIELD_OFFSET(SCRIPT_ENGINE_BYTECODE_STATE, Bases) + Kind * sizeof(UINT64));
+    }
+
+    for (UINT32 i = 0; i < Count; i++)
+    {
+        Emitter->Labels[i] = Emitter->Size;
+        ScriptEngineJitEmitInstruction(Emitter, &Bytecode->Instructions[i], Count);
+    }
+
+    //
+    // The end of the script, xor eax, eax ; jmp (over the error exit)
+    //
+    Emitter->Labels[Count] = Emitter->Size;
+    ScriptEngineJitEmitBytes(Emitter, "\x31\xc0\xeb\x05", 4);
+
+    //
+    // The error exit, mov eax, 1
+    //
+    Emitter->Labels[Count + 1] = Emitter->Size;
+    ScriptEngineJitEmitBytes(Emitter, "\xb8\x01\x00\x00\x00", 5);
+
+    //
+    // add rsp, 0x20 ; pop r15 ; pop r14 ; pop r13 ; pop r12 ; pop rbx ; ret
+    //
+    ScriptEngineJitEmitBytes(Emitter, "\x48\x83\xc4\x20\x41\x5f\x41\x5e\x41\x5d\x41\x5c\x5b\xc3", 14);
+}
+
+/**
+ * @brief Translate the bytecode of a script to the native code of x86-64
+ *
+ * @details The native code keeps the addresses of the instructions of
+ * the bytecode (for callbacks), so the bytecode should not be freed
+ * before the native code
+ *
+ * @param Bytecode
+ * @param Code Buffer to save the native code, its size should be at
+ * least SCRIPT_ENGINE_JIT_SIZE(Bytecode->CountOfInstructions)
+ * @param CodeSize Size of the buffer of the native code
+ * @param Labels Temporary buffer, its size should be at least
+ * SCRIPT_ENGINE_JIT_LABELS_SIZE(Bytecode->CountOfInstructions)
+ * @return BOOLEAN FALSE if the native code doesn't fit in the buffer
+ */
+BOOLEAN
+ScriptEngineJitCompile(PSCRIPT_ENGINE_BYTECODE Bytecode, PVOID Code, UINT32 CodeSize, UINT32 * Labels)
+{
+    SCRIPT_ENGINE_JIT_EMITTER Emitter = {0};
+
+    Emitter.Code     = (UINT8 *)Code;
+    Emitter.Capacity = CodeSize;
+    Emitter.Labels   = Labels;
+
+    memset(Labels, 0, SCRIPT_ENGINE_JIT_LABELS_SIZE(Bytecode->CountOfInstructions));
+
+    //
+    // The first pass finds the labels and the second pass emits the
+    // jumps to them
+    //
+    ScriptEngineJitEmitCode(&Emitter, Bytecode);
+    ScriptEngineJitEmitCode(&Emitter, Bytecode);
+
+    return Emitter.Size <= Emitter.Capacity;
+}
+
+/**
+ * @brief Run the native code of a script
+ *
+ * @param GuestRegs
+ * @param ActionDetail
+ * @param VariablesList
+ * @param CodeBuffer The symbol buffer that the bytecode is lowered from
+ * @param Code The native code that is compiled by ScriptEngineJitCompile
+ * @param ErrorOperator The operator that caused the error (if any)
+ * @return BOOL TRUE if there was an error, the same as ScriptEngineExecute
+ */
+BOOL
+ScriptEngineExecuteJit(PGUEST_REGS                    GuestRegs,
+                       ACTION_BUFFER                  ActionDetail,
+                       SCRIPT_ENGINE_VARIABLES_LIST * VariablesList,
+                       PSYMBOL_BUFFER                 CodeBuffer,
+                       PVOID                          Code,
+                       PSYMBOL                        ErrorOperator)
+{
+    SCRIPT_ENGINE_BYTECODE_STATE State;
+
+    ScriptEngineInitializeBytecodeState(&State, GuestRegs, ActionDetail, VariablesList, CodeBuffer, ErrorOperator);
+
+    return ((SCRIPT_ENGINE_JIT_FUNCTION)Code)(&State);
+}
@@ -0,0 +1,364 @@
+/**
+ * @file SerialCompression.h
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief Compression of the packets that are sent over serial
+ * @details The compressed blocks have the same format as the blocks
+ * of LZ4, the debuggee compresses the packets (even in vmx-root) and
+ * the debugger decompresses them, so memory is never allocated here,
+ * this header should be included once in each module
+ * @version 0.1
+ * @date 2021-11-20
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+/**
+ * @brief Length of the shortest match
+ *
+ */
+#define SERIAL_COMPRESSION_MINIMUM_MATCH 4
+
+/**
+ * @brief Count of bytes at the end of blocks that are always literals
+ *
+ */
+#define SERIAL_COMPRESSION_LAST_LITERALS 5
+
+/**
+ * @brief The last match starts at least this count of bytes before
+ * the end of the block
+ *
+ */
+#define SERIAL_COMPRESSION_MATCH_FIND_LIMIT 12
+
+/**
+ * @brief Compute the count of bytes that are needed for a length
+ * which doesn't fit in the token
+ *
+ * @param Length Length of literals or matches (after reducing the
+ * minimum match)
+ *
+ * @return UINT32
+ */
+UINT32
+SerialCompressionSizeOfLength(UINT32 Length)
+{
+    if (Length < 15)
+    {
+        return 0;
+    }
+
+    return (Length - 15) / 255 + 1;
+}
+
+/**
+ * @brief Write a length which doesn't fit in the token
+ *
+ * @param Output
+ * @param Length Length of literals or matches (after reducing the
+ * minimum match)
+ *
+ * @return UINT32 count of the written bytes
+ */
+UINT32
+SerialCompressionWriteLength(BYTE * Output, UINT32 Length)
+{
+    UINT32 Index = 0;
+
+    if (Length < 15)
+    {
+        return 0;
+    }
+
+    Length -= 15;
+
+    while (Length >= 255)
+    {
+        Output[Index++] = 255;
+        Length -= 255;
+    }
+
+    Output[Index++] = (BYTE)Length;
+
+    return Index;
+}
+
+/**
+ * @brief Write a sequence (literals and a match) of a compressed block
+ *
+ * @param Output
+ * @param Literals
+ * @param LiteralsLength
+ * @param Offset Distance of the match (zero for the last literals)
+ * @param MatchLength Length of the match (zero for the last literals)
+ *
+ * @return UINT32 count of the written bytes
+ */
+UINT32
+SerialCompressionWriteSequence(BYTE * Output,
+                               BYTE * Literals,
+                               UINT32 LiteralsLength,
+                               UINT32 Offset,
+                               UINT32 MatchLength)
+{
+    UINT32 Index = 1;
+    BYTE   Token;
+
+    Token = (BYTE)((LiteralsLength < 15 ? LiteralsLength : 15) << 4);
+
+    Index += SerialCompressionWriteLength(&Output[Index], LiteralsLength);
+
+    for (UINT32 i = 0; i < LiteralsLength; i++)
+    {
+        Output[Index++] = Literals[i];
+    }
+
+    if (Offset != 0)
+    {
+        MatchLength -= SERIAL_COMPRESSION_MINIMUM_MATCH;
+        Token |= (BYTE)(MatchLength < 15 ? MatchLength : 15);
+
+        Output[Index++] = (BYTE)Offset;
+        Output[Index++] = (BYTE)(Offset >> 8);
+
+        Index += SerialCompressionWriteLength(&Output[Index], MatchLength);
+    }
+
+    Output[0] = Token;
+
+    return Index;
+}
+
+/**
+ * @brief Compress a buffer to a block
+ * @details The hash table keeps the last position of each 4-byte
+ * sequence, it's not cleared as the candidates are compared with the
+ * current position anyway
+ *
+ * @param HashTable A table of SERIAL_COMPRESSION_HASH_TABLE_SIZE entries
+ * @param Input
+ * @param Length Length of the input (less than 64 KB)
+ * @param Output
+ * @param MaximumLength Size of the output
+ *
+ * @return UINT32 length of the compressed block or zero if it doesn't
+ * fit in the output
+ */
+UINT32
+SerialCompressionCompress(UINT16 * HashTable,
+                          BYTE *   Input,
+                          UINT32   Length,
+                          BYTE *   Output,
+                          UINT32   MaximumLength)
+{
+    UINT32 Position       = 0;
+    UINT32 Anchor         = 0;
+    UINT32 OutputLength   = 0;
+    UINT32 MatchFindLimit = 0;
+    UINT32 MatchEndLimit  = 0;
+    UINT32 Sequence;
+    UINT32 Hash;
+    UINT32 Candidate;
+    UINT32 MatchLength;
+    UINT32 LiteralsLength;
+
+    //
+    // Positions are kept in 16-bit entries
+    //
+    if (Length > 0xffff)
+    {
+        return 0;
+    }
+
+    if (Length > SERIAL_COMPRESSION_MATCH_FIND_LIMIT)
+    {
+        MatchFindLimit = Length - SERIAL_COMPRESSION_MATCH_FIND_LIMIT;
+        MatchEndLimit  = Length - SERIAL_COMPRESSION_LAST_LITERALS;
+    }
+
+    while (Position < MatchFindLimit)
+    {
+        Sequence  = *(UINT32 UNALIGNED *)&Input[Position];
+        Hash      = (Sequence * 2654435761U) >> (32 - SERIAL_COMPRESSION_HASH_BITS);
+        Candidate = HashTable[Hash];
+
+        HashTable[Hash] = (UINT16)Position;
+
+        if (Candidate >= Position || *(UINT32 UNALIGNED *)&Input[Candidate] != Sequence)
+        {
+            Position++;
+            continue;
+        }
+
+        MatchLength = SERIAL_COMPRESSION_MINIMUM_MATCH;
+
+        while (Position + MatchLength < MatchEndLimit &&
+               Input[Candidate + MatchLength] == Input[Position + MatchLength])
+        {
+            MatchLength++;
+        }
+
+        LiteralsLength = Position - Anchor;
+
+        if (OutputLength + 1 + SerialCompressionSizeOfLength(LiteralsLength) + LiteralsLength + sizeof(UINT16) +
+                SerialCompressionSizeOfLength(MatchLength - SERIAL_COMPRESSION_MINIMUM_MATCH) >
+            MaximumLength)
+        {
+            return 0;
+        }
+
+        OutputLength += SerialCompressionWriteSequence(&Output[OutputLength],
+                                                       &Input[Anchor],
+                                                       LiteralsLength,
+                                                       Position - Candidate,
+                                                       MatchLength);
+
+        Position += MatchLength;
+        Anchor = Position;
+    }
+
+    //
+    // The rest of the input is sent as literals
+    //
+    LiteralsLength = Length - Anchor;
+
+    if (OutputLength + 1 + SerialCompressionSizeOfLength(LiteralsLength) + LiteralsLength > MaximumLength)
+    {
+        return 0;
+    }
+
+    OutputLength += SerialCompressionWriteSequence(&Output[OutputLength], &Input[Anchor], LiteralsLength, 0, 0);
+
+    return OutputLength;
+}
+
+/**
+ * @brief Read a length which doesn't fit in the token
+ *
+ * @param Input
+ * @param Length Length of the input
+ * @param Index Index of the next byte of the input
+ * @param Result The length of the token is added to it
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SerialCompressionReadLength(BYTE * Input, UINT32 Length, UINT32 * Index, UINT32 * Result)
+{
+    BYTE Byte;
+
+    if (*Result != 15)
+    {
+        return TRUE;
+    }
+
+    do
+    {
+        if (*Index >= Length)
+        {
+            return FALSE;
+        }
+
+        Byte = Input[(*Index)++];
+        *Result += Byte;
+
+    } while (Byte == 255);
+
+    return TRUE;
+}
+
+/**
+ * @brief Decompress a block
+ * @details The block is received from the debuggee, so all of the
+ * lengths and offsets are checked
+ *
+ * @param Input
+ * @param Length Length of the block
+ * @param Output
+ * @param MaximumLength Size of the output
+ * @param DecompressedLength
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+SerialCompressionDecompress(BYTE *   Input,
+                            UINT32   Length,
+                            BYTE *   Output,
+                            UINT32   MaximumLength,
+                            UINT32 * DecompressedLength)
+{
+    UINT32 Index        = 0;
+    UINT32 OutputLength = 0;
+    UINT32 LiteralsLength;
+    UINT32 MatchLength;
+    UINT32 Offset;
+    BYTE   Token;
+
+    while (Index < Length)
+    {
+        Token          = Input[Index++];
+        LiteralsLength = Token >> 4;
+
+        if (!SerialCompressionReadLength(Input, Length, &Index, &LiteralsLength) ||
+            LiteralsLength > Length - Index ||
+            LiteralsLength > MaximumLength - OutputLength)
+        {
+            return FALSE;
+        }
+
+        for (UINT32 i = 0; i < LiteralsLength; i++)
+        {
+            Output[OutputLength++] = Input[Index++];
+        }
+
+        //
+        // The last sequence doesn't have a match
+        //
+        if (Index == Length)
+        {
+            break;
+        }
+
+        if (Length - Index < sizeof(UINT16))
+        {
+            return FALSE;
+        }
+
+        Offset = Input[Index] | (Input[Index + 1] << 8);
+        Index += sizeof(UINT16);
+
+        if (Offset == 0 || Offset > OutputLength)
+        {
+            return FALSE;
+        }
+
+        MatchLength = Token & 0xf;
+
+        if (!SerialCompressionReadLength(Input, Length, &Index, &MatchLength))
+        {
+            return FALSE;
+        }
+
+        MatchLength += SERIAL_COMPRESSION_MINIMUM_MATCH;
+
+        if (MatchLength > MaximumLength - OutputLength)
+        {
+            return FALSE;
+        }
+
+        //
+        // Matches might overlap with themselves, so they're copied byte by byte
+        //
+        for (UINT32 i = 0; i < MatchLength; i++)
+        {
+            Output[OutputLength] = Output[OutputLength - Offset];
+            OutputLength++;
+        }
+    }
+
+    *DecompressedLength = OutputLength;
+
+    return TRUE;
+}
@@ -13,8 +13,8 @@ NewToken()
     //
     // Allocates memory for token and its value
     //
-    Token        = (TOKEN)malloc(sizeof(*Token));
-    Token->Value = (char *)calloc(TOKEN_VALUE_MAX_LEN, sizeof(char));
+    Token        = (TOKEN)ParserAllocate(sizeof(*Token));
+    Token->Value = (char *)ParserAllocate(TOKEN_VALUE_MAX_LEN);
 
     //
     // Init fields
@@ -35,8 +35,8 @@ NewToken()
 void
 RemoveToken(TOKEN Token)
 {
-    free(Token->Value);
-    free(Token);
+    ParserFree(Token->Value);
+    ParserFree(Token);
     return;
 }
 
@@ -151,24 +151,19 @@ Append(TOKEN Token, char c)
     if (Token->len >= Token->max_len - 1)
     {
         //
-        // Double the length of the allocated space for the string
+        // Double the length of the allocated space for the string, the
+        // value of the token that is being scanned is the last allocation
+        // of the arena so it usually grows in place
         //
+        Token->Value = (char *)ParserReallocate(Token->Value, Token->max_len, Token->max_len * 2);
         Token->max_len *= 2;
-        char * NewValue = (char *)calloc(Token->max_len, sizeof(char));
-
-        //
-        // Free Old buffer and update the pointer
-        //
-        strncpy(NewValue, Token->Value, Token->len);
-        free(Token->Value);
-        Token->Value = NewValue;
     }
 
     //
     // Append the new charcter to the string
     //
-    strncat(Token->Value, &c, 1);
-    Token->len++;
+    Token->Value[Token->len++] = c;
+    Token->Value[Token->len]   = '\0';
 }
 
 /**
@@ -184,18 +179,19 @@ NewTokenList(void)
     //
     // Allocation of memory for TOKEN_LIST structure
     //
-    TokenList = (TOKEN_LIST)malloc(sizeof(*TokenList));
+    TokenList = (TOKEN_LIST)ParserAllocate(sizeof(*TokenList));
 
     //
     // Initialize fields of TOKEN_LIST
     //
     TokenList->Pointer = 0;
     TokenList->Size    = TOKEN_LIST_INIT_SIZE;
+    TokenList->Arena   = ParserArena;
 
     //
     // Allocation of memory for TOKEN_LIST buffer
     //
-    TokenList->Head = (TOKEN *)malloc(TokenList->Size * sizeof(TOKEN));
+    TokenList->Head = (TOKEN *)ParserAllocate(TokenList->Size * sizeof(TOKEN));
 
     return TokenList;
 }
@@ -269,25 +265,25 @@ Push(TOKEN_LIST TokenList, TOKEN Token)
     if (Pointer == TokenList->Size - 1)
     {
         //
-        // Allocate a new buffer for string list with doubled length
-        //
-        TOKEN * NewHead = (TOKEN *)malloc(2 * TokenList->Size * sizeof(TOKEN));
-
-        //
-        // Copy old buffer to new buffer
-        //
-        memcpy(NewHead, TokenList->Head, TokenList->Size * sizeof(TOKEN));
-
-        //
-        // Free old buffer
+        // Double the length of the buffer, lists that are allocated from
+        // the heap (when there is no parse) remain in the heap
         //
-        free(TokenList->Head);
+        if (TokenList->Arena != NULL)
+        {
+            TokenList->Head = (TOKEN *)ArenaReallocate(TokenList->Arena,
+                                                       TokenList->Head,
+                                                       TokenList->Size * sizeof(TOKEN),
+                                                       2 * TokenList->Size * sizeof(TOKEN));
+        }
+        else
+        {
+            TokenList->Head = (TOKEN *)realloc(TokenList->Head, 2 * TokenList->Size * sizeof(TOKEN));
+        }
 
         //
-        // Update Head and size of TokenList
+        // Update size of TokenList
         //
         TokenList->Size = TokenList->Size * 2;
-        TokenList->Head = NewHead;
     }
 
     return TokenList;
@@ -332,6 +328,177 @@ Top(TOKEN_LIST TokenList)
     return *ReadAddr;
 }
 
+/**
+* @brief initializes an empty arena
+*
+* @param Arena
+*/
+void
+ArenaInitialize(PPARSER_ARENA Arena)
+{
+    Arena->Chunks             = NULL;
+    Arena->CountOfAllocations = 0;
+    Arena->CountOfChunks      = 0;
+    Arena->AllocatedBytes     = 0;
+}
+
+/**
+* @brief allocates memory from the current chunk of the arena, a new
+* chunk is allocated if there is not enough space in the current one
+*
+* @param Arena
+* @param Size
+* @return void*
+*/
+void *
+ArenaAllocate(PPARSER_ARENA Arena, size_t Size)
+{
+    PPARSER_ARENA_CHUNK Chunk = Arena->Chunks;
+    size_t              ChunkSize;
+    char *              Buffer;
+
+    Size = (Size + PARSER_ARENA_ALIGNMENT - 1) & ~((size_t)PARSER_ARENA_ALIGNMENT - 1);
+
+    if (Chunk == NULL || Chunk->Size - Chunk->Used < Size)
+    {
+        //
+        // Large allocations have their own chunk
+        //
+        ChunkSize = Size > PARSER_ARENA_CHUNK_SIZE ? Size : PARSER_ARENA_CHUNK_SIZE;
+        Chunk     = (PPARSER_ARENA_CHUNK)malloc(sizeof(PARSER_ARENA_CHUNK) + ChunkSize);
+
+        if (Chunk == NULL)
+        {
+            return NULL;
+        }
+
+        Chunk->Next           = Arena->Chunks;
+        Chunk->Size           = ChunkSize;
+        Chunk->Used           = 0;
+        Chunk->LastAllocation = 0;
+        Arena->Chunks         = Chunk;
+        Arena->CountOfChunks++;
+    }
+
+    Buffer                = (char *)(Chunk + 1) + Chunk->Used;
+    Chunk->LastAllocation = Chunk->Used;
+    Chunk->Used += Size;
+
+    Arena->CountOfAllocations++;
+    Arena->AllocatedBytes += Size;
+
+    return Buffer;
+}
+
+/**
+* @brief grows an allocation of the arena, the last allocation of the
+* current chunk grows in place if there is enough space after it
+*
+* @param Arena
+* @param Buffer
+* @param OldSize
+* @param NewSize
+* @return void*
+*/
+void *
+ArenaReallocate(PPARSER_ARENA Arena, void * Buffer, size_t OldSize, size_t NewSize)
+{
+    PPARSER_ARENA_CHUNK Chunk = Arena->Chunks;
+    void *              NewBuffer;
+
+    if (Buffer != NULL && Chunk != NULL &&
+        (char *)Buffer == (char *)(Chunk + 1) + Chunk->LastAllocation &&
+        Chunk->Size - Chunk->LastAllocation >= NewSize)
+    {
+        NewSize = (NewSize + PARSER_ARENA_ALIGNMENT - 1) & ~((size_t)PARSER_ARENA_ALIGNMENT - 1);
+
+        Arena->AllocatedBytes += Chunk->LastAllocation + NewSize - Chunk->Used;
+        Chunk->Used = Chunk->LastAllocation + NewSize;
+
+        return Buffer;
+    }
+
+    NewBuffer = ArenaAllocate(Arena, NewSize);
+
+    if (NewBuffer != NULL && Buffer != NULL)
+    {
+        memcpy(NewBuffer, Buffer, OldSize < NewSize ? OldSize : NewSize);
+    }
+
+    return NewBuffer;
+}
+
+/**
+* @brief frees all of the chunks of the arena
+*
+* @param Arena
+*/
+void
+ArenaRelease(PPARSER_ARENA Arena)
+{
+    PPARSER_ARENA_CHUNK Chunk = Arena->Chunks;
+    PPARSER_ARENA_CHUNK Next;
+
+    while (Chunk != NULL)
+    {
+        Next = Chunk->Next;
+        free(Chunk);
+        Chunk = Next;
+    }
+
+    Arena->Chunks = NULL;
+}
+
+/**
+* @brief allocates memory for the parser, from the arena of the current
+* parse or from the heap if there is no parse
+*
+* @param Size
+* @return void*
+*/
+void *
+ParserAllocate(size_t Size)
+{
+    if (ParserArena != NULL)
+    {
+        return ArenaAllocate(ParserArena, Size);
+    }
+    return malloc(Size);
+}
+
+/**
+* @brief grows a buffer of the parser
+*
+* @param Buffer
+* @param OldSize
+* @param NewSize
+* @return void*
+*/
+void *
+ParserReallocate(void * Buffer, size_t OldSize, size_t NewSize)
+{
+    if (ParserArena != NULL)
+    {
+        return ArenaReallocate(ParserArena, Buffer, OldSize, NewSize);
+    }
+    return realloc(Buffer, NewSize);
+}
+
+/**
+* @brief frees a buffer of the parser, buffers of the arena are
+* freed together when the parse is finished
+*
+* @param Buffer
+*/
+void
+ParserFree(void * Buffer)
+{
+    if (ParserArena == NULL)
+    {
+        free(Buffer);
+    }
+}
+
 /**
 * @brief cheks whether input char belongs to hexadecimal digit-set or not
 *
@@ -604,100 +771,256 @@ IsSemanticRule(TOKEN Token)
 }
 
 /**
+* @brief hash of a string (FNV-1a), the same as the generator of the
+* hash tables (python/perfect_hash.py)
 *
+* @param str
+* @return unsigned int
+*/
+unsigned int
+HashString(const char * str)
+{
+    unsigned int Hash = 2166136261;
+
+    while (*str)
+    {
+        Hash ^= (unsigned char)*str++;
+        Hash *= 16777619;
+    }
+    return Hash;
+}
+
+/**
+* @brief mixes the hash of a string with the seed of its bucket
 *
+* @param Hash
+* @param Seed
+* @return unsigned int
+*/
+unsigned int
+HashMix(unsigned int Hash, unsigned int Seed)
+{
+    unsigned int x = Hash ^ Seed;
+
+    x ^= x >> 16;
+    x *= 0x7feb352d;
+    x ^= x >> 15;
+    x *= 0x846ca68b;
+    x ^= x >> 16;
+    return x;
+}
+
+/**
+* @brief finds a string in a perfect hash table
 *
+* @param Table
+* @param str
+* @return int value of the string or INVALID if it's not in the table
 */
 int
-GetNonTerminalId(TOKEN Token)
+HashTableLookup(const HASH_TABLE * Table, const char * str)
 {
-    for (int i = 0; i < NONETERMINAL_COUNT; i++)
+    unsigned int             Hash  = HashString(str);
+    unsigned int             Seed  = Table->Seeds[Hash & (Table->CountOfBuckets - 1)];
+    const HASH_TABLE_ENTRY * Entry = &Table->Entries[HashMix(Hash, Seed) & (Table->Size - 1)];
+
+    if (Entry->Name != NULL && !strcmp(str, Entry->Name))
     {
-        if (!strcmp(Token->Value, NoneTerminalMap[i]))
-            return i;
+        return Entry->Value;
     }
     return INVALID;
 }
 
 /**
+* @brief finds an identifier in a hash table of identifiers
 *
-*
-*
+* @param Table
+* @param Name
+* @return int index of the identifier or -1 if it's not in the table
 */
 int
-GetTerminalId(TOKEN Token)
+IdentifierTableLookup(PIDENTIFIER_TABLE Table, const char * Name)
 {
-    for (int i = 0; i < TERMINAL_COUNT; i++)
+    unsigned int            Hash = HashString(Name);
+    PIDENTIFIER_TABLE_ENTRY Entry;
+
+    if (Table->Size == 0)
     {
-        if (Token->Type == HEX)
-        {
-            if (!strcmp("_hex", TerminalMap[i]))
-                return i;
-        }
-        else if (Token->Type == GLOBAL_ID || Token->Type == GLOBAL_UNRESOLVED_ID)
-        {
-            if (!strcmp("_global_id", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == LOCAL_ID || Token->Type == LOCAL_UNRESOLVED_ID)
-        {
-            if (!strcmp("_local_id", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == REGISTER)
-        {
-            if (!strcmp("_register", TerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == PSEUDO_REGISTER)
+        return -1;
+    }
+
+    for (unsigned int i = Hash & (Table->Size - 1);; i = (i + 1) & (Table->Size - 1))
+    {
+        Entry = &Table->Entries[i];
+
+        if (Entry->Name == NULL)
         {
-            if (!strcmp("_pseudo_register", TerminalMap[i]))
-            {
-                return i;
-            }
+            return -1;
         }
-        else if (Token->Type == DECIMAL)
+        if (Entry->Hash == Hash && !strcmp(Entry->Name, Name))
         {
-            if (!strcmp("_decimal", TerminalMap[i]))
-            {
-                return i;
-            }
+            return Entry->Index;
         }
-        else if (Token->Type == BINARY)
+    }
+}
+
+/**
+* @brief adds an identifier to a hash table of identifiers, the
+* identifier gets the next index of the table
+*
+* @param Table
+* @param Name
+* @return int index of the identifier or -1 if there is no memory
+*/
+int
+IdentifierTableInsert(PIDENTIFIER_TABLE Table, const char * Name)
+{
+    unsigned int            Hash   = HashString(Name);
+    size_t                  Length = strlen(Name);
+    PIDENTIFIER_TABLE_ENTRY Entry;
+
+    //
+    // Keep the load factor of the table under 3/4
+    //
+    if ((Table->Count + 1) * 4 > Table->Size * 3 && !IdentifierTableGrow(Table))
+    {
+        return -1;
+    }
+
+    for (unsigned int i = Hash & (Table->Size - 1);; i = (i + 1) & (Table->Size - 1))
+    {
+        Entry = &Table->Entries[i];
+
+        if (Entry->Name == NULL)
         {
-            if (!strcmp("_binary", TerminalMap[i]))
-            {
-                return i;
-            }
+            break;
         }
-        else if (Token->Type == OCTAL)
+        if (Entry->Hash == Hash && !strcmp(Entry->Name, Name))
         {
-            if (!strcmp("_octal", TerminalMap[i]))
-            {
-                return i;
-            }
+            return Entry->Index;
         }
-        else if (Token->Type == STRING)
+    }
+
+    //
+    // Identifiers are kept after the parse so they are not
+    // allocated from the arena
+    //
+    Entry->Name = (char *)malloc(Length + 1);
+
+    if (Entry->Name == NULL)
+    {
+        return -1;
+    }
+
+    memcpy(Entry->Name, Name, Length + 1);
+    Entry->Hash  = Hash;
+    Entry->Index = Table->Count++;
+
+    return Entry->Index;
+}
+
+/**
+* @brief doubles the size of a hash table of identifiers
+*
+* @param Table
+* @return BOOL FALSE if there is no memory
+*/
+BOOL
+IdentifierTableGrow(PIDENTIFIER_TABLE Table)
+{
+    unsigned int            NewSize = Table->Size ? Table->Size * 2 : IDENTIFIER_TABLE_INIT_SIZE;
+    PIDENTIFIER_TABLE_ENTRY NewEntries;
+    unsigned int            j;
+
+    NewEntries = (PIDENTIFIER_TABLE_ENTRY)calloc(NewSize, sizeof(IDENTIFIER_TABLE_ENTRY));
+
+    if (NewEntries == NULL)
+    {
+        return FALSE;
+    }
+
+    for (unsigned int i = 0; i < Table->Size; i++)
+    {
+        if (Table->Entries[i].Name == NULL)
         {
-            if (!strcmp("_string", TerminalMap[i]))
-            {
-                return i;
-            }
+            continue;
         }
 
-        else // Keyword
+        j = Table->Entries[i].Hash & (NewSize - 1);
+
+        while (NewEntries[j].Name != NULL)
         {
-            if (!strcmp(Token->Value, TerminalMap[i]))
-                return i;
+            j = (j + 1) & (NewSize - 1);
         }
+
+        NewEntries[j] = Table->Entries[i];
+    }
+
+    free(Table->Entries);
+
+    Table->Entries = NewEntries;
+    Table->Size    = NewSize;
+
+    return TRUE;
+}
+
+/**
+* @brief returns the name of the terminal of a token, tokens that
+* have a value (numbers, ids, etc.) have a general terminal
+*
+* @param Token
+* @return const char*
+*/
+const char *
+GetTerminalName(TOKEN Token)
+{
+    switch (Token->Type)
+    {
+    case HEX:
+        return "_hex";
+    case GLOBAL_ID:
+    case GLOBAL_UNRESOLVED_ID:
+        return "_global_id";
+    case LOCAL_ID:
+    case LOCAL_UNRESOLVED_ID:
+        return "_local_id";
+    case REGISTER:
+        return "_register";
+    case PSEUDO_REGISTER:
+        return "_pseudo_register";
+    case DECIMAL:
+        return "_decimal";
+    case BINARY:
+        return "_binary";
+    case OCTAL:
+        return "_octal";
+    case STRING:
+        return "_string";
+    default: // Keyword
+        return Token->Value;
     }
-    return INVALID;
+}
+
+/**
+*
+*
+*
+*/
+int
+GetNonTerminalId(TOKEN Token)
+{
+    return HashTableLookup(&NonTerminalHashTable, Token->Value);
+}
+
+/**
+*
+*
+*
+*/
+int
+GetTerminalId(TOKEN Token)
+{
+    return HashTableLookup(&TerminalHashTable, GetTerminalName(Token));
 }
 
 /**
@@ -708,12 +1031,7 @@ GetTerminalId(TOKEN Token)
 int
 LalrGetNonTerminalId(TOKEN Token)
 {
-    for (int i = 0; i < LALR_NONTERMINAL_COUNT; i++)
-    {
-        if (!strcmp(Token->Value, LalrNoneTerminalMap[i]))
-            return i;
-    }
-    return INVALID;
+    return HashTableLookup(&LalrNonTerminalHashTable, Token->Value);
 }
 
 /**
@@ -724,77 +1042,7 @@ LalrGetNonTerminalId(TOKEN Token)
 int
 LalrGetTerminalId(TOKEN Token)
 {
-    for (int i = 0; i < LALR_TERMINAL_COUNT; i++)
-    {
-        if (Token->Type == HEX)
-        {
-            if (!strcmp("_hex", LalrTerminalMap[i]))
-                return i;
-        }
-        else if (Token->Type == GLOBAL_ID || Token->Type == GLOBAL_UNRESOLVED_ID)
-        {
-            if (!strcmp("_global_id", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == LOCAL_ID || Token->Type == LOCAL_UNRESOLVED_ID)
-        {
-            if (!strcmp("_local_id", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == REGISTER)
-        {
-            if (!strcmp("_register", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == PSEUDO_REGISTER)
-        {
-            if (!strcmp("_pseudo_register", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == DECIMAL)
-        {
-            if (!strcmp("_decimal", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == BINARY)
-        {
-            if (!strcmp("_binary", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == OCTAL)
-        {
-            if (!strcmp("_octal", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-        else if (Token->Type == STRING)
-        {
-            if (!strcmp("_string", LalrTerminalMap[i]))
-            {
-                return i;
-            }
-        }
-
-        else // Keyword
-        {
-            if (!strcmp(Token->Value, LalrTerminalMap[i]))
-                return i;
-        }
-    }
-    return INVALID;
+    return HashTableLookup(&LalrTerminalHashTable, GetTerminalName(Token));
 }
 
 /**
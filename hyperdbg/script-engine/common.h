@@ -4,6 +4,7 @@
 #    define COMMON_H
 
 #    define SYMBOL_BUFFER_INIT_SIZE 64
+#    define SYMBOL_BUFFER_CHUNK_SIZE 1024
 #    define MAX_TEMP_COUNT          32
 
 /**
@@ -16,6 +17,21 @@
 */
 #    define TOKEN_LIST_INIT_SIZE 256
 
+/**
+* @brief size of each chunk of the arena of the parser
+*/
+#    define PARSER_ARENA_CHUNK_SIZE 0x10000
+
+/**
+* @brief alignment of the allocations from the arena of the parser
+*/
+#    define PARSER_ARENA_ALIGNMENT 16
+
+/**
+* @brief init size of the hash tables of identifiers (power of two)
+*/
+#    define IDENTIFIER_TABLE_INIT_SIZE 64
+
 /**
 * @brief enumerates possible types for token
 */
@@ -61,16 +77,84 @@ struct _TOKEN
 */
 typedef struct _TOKEN * TOKEN;
 
+/**
+* @brief a chunk of the arena of the parser, the allocations are
+* placed after this header
+*/
+typedef struct _PARSER_ARENA_CHUNK
+{
+    struct _PARSER_ARENA_CHUNK * Next;
+    size_t                       Size;           // size of the buffer after the header
+    size_t                       Used;           // allocated bytes of the buffer
+    size_t                       LastAllocation; // offset of the last allocation (it can grow in place)
+} PARSER_ARENA_CHUNK, *PPARSER_ARENA_CHUNK;
+
+/**
+* @brief all of the tokens, token lists and symbols of a parse are
+* allocated from an arena and they are freed together at the end of
+* the parse
+*/
+typedef struct _PARSER_ARENA
+{
+    PPARSER_ARENA_CHUNK Chunks; // the current chunk is the first one
+    unsigned int        CountOfAllocations;
+    unsigned int        CountOfChunks;
+    unsigned long long  AllocatedBytes;
+} PARSER_ARENA, *PPARSER_ARENA;
+
 /**
 * @brief this structure is a dynamic containter of TOKENS
 */
 typedef struct _TOKEN_LIST
 {
-    TOKEN *      Head;
-    unsigned int Pointer;
-    unsigned int Size;
+    TOKEN *       Head;
+    unsigned int  Pointer;
+    unsigned int  Size;
+    PPARSER_ARENA Arena; // NULL if the list is allocated from the heap
 } * TOKEN_LIST;
 
+/**
+* @brief an entry of the perfect hash tables (generated in parse-table.c)
+*/
+typedef struct _HASH_TABLE_ENTRY
+{
+    const char * Name;
+    int          Value;
+} HASH_TABLE_ENTRY;
+
+/**
+* @brief a perfect hash table, the hash of a name selects a bucket and
+* the seed of the bucket selects the only slot that the name can be in
+*/
+typedef struct _HASH_TABLE
+{
+    const HASH_TABLE_ENTRY * Entries;
+    const unsigned int *     Seeds;
+    unsigned int             Size;           // count of entries (power of two)
+    unsigned int             CountOfBuckets; // count of seeds (power of two)
+} HASH_TABLE;
+
+/**
+* @brief an identifier (variable) and its index in the list of variables
+*/
+typedef struct _IDENTIFIER_TABLE_ENTRY
+{
+    char *       Name; // NULL if the entry is empty
+    unsigned int Hash;
+    int          Index;
+} IDENTIFIER_TABLE_ENTRY, *PIDENTIFIER_TABLE_ENTRY;
+
+/**
+* @brief a hash table (open addressing) of the identifiers of a scope,
+* identifiers keep their indexes for the lifetime of the debugger
+*/
+typedef struct _IDENTIFIER_TABLE
+{
+    PIDENTIFIER_TABLE_ENTRY Entries;
+    unsigned int            Size;  // count of entries (power of two)
+    unsigned int            Count; // count of identifiers (the index of the next one)
+} IDENTIFIER_TABLE, *PIDENTIFIER_TABLE;
+
 // TODO: automate generation of KeyWordList
 
 ////////////////////////////////////////////////////
@@ -132,6 +216,57 @@ int LalrGetNonTerminalId(TOKEN Token);
 
 int LalrGetTerminalId(TOKEN Token);
 
+////////////////////////////////////////////////////
+//			PARSER_ARENA related functions		  //
+////////////////////////////////////////////////////
+void
+ArenaInitialize(PPARSER_ARENA Arena);
+
+void *
+ArenaAllocate(PPARSER_ARENA Arena, size_t Size);
+
+void *
+ArenaReallocate(PPARSER_ARENA Arena, void * Buffer, size_t OldSize, size_t NewSize);
+
+void
+ArenaRelease(PPARSER_ARENA Arena);
+
+void *
+ParserAllocate(size_t Size);
+
+void *
+ParserReallocate(void * Buffer, size_t OldSize, size_t NewSize);
+
+void
+ParserFree(void * Buffer);
+
+////////////////////////////////////////////////////
+//			HASH_TABLE related functions		  //
+////////////////////////////////////////////////////
+unsigned int
+HashString(const char * str);
+
+unsigned int
+HashMix(unsigned int Hash, unsigned int Seed);
+
+int
+HashTableLookup(const HASH_TABLE * Table, const char * str);
+
+const char *
+GetTerminalName(TOKEN Token);
+
+////////////////////////////////////////////////////
+//		IDENTIFIER_TABLE related functions		  //
+////////////////////////////////////////////////////
+int
+IdentifierTableLookup(PIDENTIFIER_TABLE Table, const char * Name);
+
+int
+IdentifierTableInsert(PIDENTIFIER_TABLE Table, const char * Name);
+
+BOOL
+IdentifierTableGrow(PIDENTIFIER_TABLE Table);
+
 
 ////////////////////////////////////////////////////
 //					Util Functions				  //
@@ -1,3 +1,9 @@
 #include "pch.h"
 
 char TempMap[MAX_TEMP_COUNT] = {0};
+
+PPARSER_ARENA ParserArena = NULL;
+
+IDENTIFIER_TABLE GlobalIdTable = {0};
+
+IDENTIFIER_TABLE LocalIdTable = {0};
@@ -6,4 +6,19 @@
 
 extern char TempMap[MAX_TEMP_COUNT];
 
+/**
+* @brief arena of the current parse (NULL if there is no parse)
+*/
+extern PPARSER_ARENA ParserArena;
+
+/**
+* @brief identifiers of global variables (their names start with '.')
+*/
+extern IDENTIFIER_TABLE GlobalIdTable;
+
+/**
+* @brief identifiers of local variables
+*/
+extern IDENTIFIER_TABLE LocalIdTable;
+
 #endif // !GLOBALS_H
@@ -0,0 +1,1182 @@
+/**
+ * @file optimizer.c
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief Script engine optimizer
+ * @details The code that is generated by CodeGen is a naive three-address
+ * code, this file folds the constant expressions, propagates the copies,
+ * removes the temps that are never used and simplifies the branches on
+ * constant conditions before the code buffer is sent to the debuggee
+ * @version 0.1
+ * @date 2021-11-02
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+//#define _SCRIPT_ENGINE_OPTIMIZER_DBG_EN
+
+/**
+* @brief count of instructions of the last parsed script before optimization
+*/
+unsigned int OptimizerCountOfInstructions = 0;
+
+/**
+* @brief count of instructions of the last parsed script after optimization
+*/
+unsigned int OptimizerCountOfOptimizedInstructions = 0;
+
+/**
+* @brief whether the generated code is optimized or not
+*/
+int OptimizerIsEnabled = 1;
+
+/**
+* @brief Find the operands of an operator, the same as ScriptEngineExecute
+*
+* @param Instruction the Operator of instruction should be set
+* @param CodeBuffer
+* @param Indx index of the first operand in the code buffer
+* @return BOOL FALSE if the operator is unknown
+*/
+BOOL
+OptimizerGetOperatorInfo(POPTIMIZER_INSTRUCTION Instruction, PSYMBOL_BUFFER CodeBuffer, unsigned int Indx)
+{
+    unsigned int StringSize;
+
+    Instruction->FirstSource    = 0;
+    Instruction->HasDestination = TRUE;
+
+    switch (Instruction->Operator)
+    {
+    case FUNC_OR:
+    case FUNC_XOR:
+    case FUNC_AND:
+    case FUNC_ASR:
+    case FUNC_ASL:
+    case FUNC_ADD:
+    case FUNC_SUB:
+    case FUNC_MUL:
+    case FUNC_GT:
+    case FUNC_LT:
+    case FUNC_EGT:
+    case FUNC_ELT:
+    case FUNC_EQUAL:
+    case FUNC_NEQ:
+        Instruction->CountOfSources = 2;
+        Instruction->Flags          = OPTIMIZER_FLAG_PURE;
+        break;
+
+    case FUNC_DIV:
+    case FUNC_MOD:
+
+        //
+        // Division by zero is an error
+        //
+        Instruction->CountOfSources = 2;
+        Instruction->Flags          = 0;
+        break;
+
+    case FUNC_MOV:
+    case FUNC_NOT:
+    case FUNC_NEG:
+        Instruction->CountOfSources = 1;
+        Instruction->Flags          = OPTIMIZER_FLAG_PURE;
+        break;
+
+    case FUNC_POI:
+    case FUNC_DB:
+    case FUNC_DW:
+    case FUNC_DQ:
+    case FUNC_HI:
+    case FUNC_LOW:
+    case FUNC_CHECK_ADDRESS:
+    case FUNC_STRLEN:
+    case FUNC_WCSLEN:
+        Instruction->CountOfSources = 1;
+        Instruction->Flags          = 0;
+        break;
+
+    case FUNC_REF:
+        Instruction->CountOfSources = 1;
+        Instruction->Flags          = OPTIMIZER_FLAG_KEEP_OPERANDS;
+        break;
+
+    case FUNC_INC:
+    case FUNC_DEC:
+        Instruction->CountOfSources = 1;
+        Instruction->HasDestination = FALSE;
+        Instruction->Flags          = OPTIMIZER_FLAG_KEEP_OPERANDS | OPTIMIZER_FLAG_READ_WRITE;
+        break;
+
+    case FUNC_ED:
+    case FUNC_EB:
+    case FUNC_EQ:
+    case FUNC_INTERLOCKED_EXCHANGE:
+    case FUNC_INTERLOCKED_EXCHANGE_ADD:
+        Instruction->CountOfSources = 2;
+        Instruction->Flags          = OPTIMIZER_FLAG_BARRIER;
+        break;
+
+    case FUNC_INTERLOCKED_COMPARE_EXCHANGE:
+        Instruction->CountOfSources = 3;
+        Instruction->Flags          = OPTIMIZER_FLAG_BARRIER;
+        break;
+
+    case FUNC_MAP_COUNT:
+    case FUNC_MAP_HIST:
+
+        //
+        // Aggregation maps are not accessible by the variables
+        //
+        Instruction->CountOfSources = 2;
+        Instruction->Flags          = 0;
+        break;
+
+    case FUNC_MAP_SUM:
+    case FUNC_MAP_MIN:
+    case FUNC_MAP_MAX:
+        Instruction->CountOfSources = 3;
+        Instruction->Flags          = 0;
+        break;
+
+    case FUNC_INTERLOCKED_INCREMENT:
+    case FUNC_INTERLOCKED_DECREMENT:
+        Instruction->CountOfSources = 1;
+        Instruction->Flags          = OPTIMIZER_FLAG_BARRIER;
+        break;
+
+    case FUNC_SPINLOCK_LOCK_CUSTOM_WAIT:
+        Instruction->CountOfSources = 2;
+        Instruction->HasDestination = FALSE;
+        Instruction->Flags          = OPTIMIZER_FLAG_BARRIER;
+        break;
+
+    case FUNC_SPINLOCK_LOCK:
+    case FUNC_SPINLOCK_UNLOCK:
+        Instruction->CountOfSources = 1;
+        Instruction->HasDestination = FALSE;
+        Instruction->Flags          = OPTIMIZER_FLAG_BARRIER;
+        break;
+
+    case FUNC_PRINT:
+    case FUNC_TEST_STATEMENT:
+    case FUNC_FORMATS:
+    case FUNC_ENABLE_EVENT:
+    case FUNC_DISABLE_EVENT:
+        Instruction->CountOfSources = 1;
+        Instruction->HasDestination = FALSE;
+        Instruction->Flags          = 0;
+        break;
+
+    case FUNC_PAUSE:
+
+        //
+        // The user might change anything while the debuggee is paused
+        //
+        Instruction->CountOfSources = 0;
+        Instruction->HasDestination = FALSE;
+        Instruction->Flags          = OPTIMIZER_FLAG_BARRIER;
+        break;
+
+    case FUNC_JMP:
+        Instruction->FirstSource    = 1;
+        Instruction->CountOfSources = 0;
+        Instruction->HasDestination = FALSE;
+        Instruction->Flags          = OPTIMIZER_FLAG_JUMP;
+        break;
+
+    case FUNC_JZ:
+    case FUNC_JNZ:
+        Instruction->FirstSource    = 1;
+        Instruction->CountOfSources = 1;
+        Instruction->HasDestination = FALSE;
+        Instruction->Flags          = OPTIMIZER_FLAG_JUMP;
+        break;
+
+    case FUNC_PRINTF:
+
+        //
+        // Format string, count of arguments and the arguments, the
+        // arguments keep the position of their specifiers in their types
+        //
+        if (Indx >= CodeBuffer->Pointer || CodeBuffer->Head[Indx].Type != SYMBOL_STRING_TYPE)
+        {
+            return FALSE;
+        }
+
+        StringSize = (sizeof(unsigned long long) +
+                      strnlen((char *)&CodeBuffer->Head[Indx].Value,
+                              (CodeBuffer->Pointer - Indx) * sizeof(SYMBOL) - sizeof(unsigned long long))) /
+                         sizeof(SYMBOL) +
+                     1;
+
+        if (Indx + StringSize >= CodeBuffer->Pointer ||
+            CodeBuffer->Head[Indx + StringSize].Type != SYMBOL_VARIABLE_COUNT_TYPE)
+        {
+            return FALSE;
+        }
+
+        Instruction->FirstSource    = StringSize + 1;
+        Instruction->CountOfSources = (unsigned int)CodeBuffer->Head[Indx + StringSize].Value;
+        Instruction->HasDestination = FALSE;
+        Instruction->Flags          = OPTIMIZER_FLAG_KEEP_OPERANDS;
+
+        if (Instruction->CountOfSources > CodeBuffer->Pointer)
+        {
+            return FALSE;
+        }
+        break;
+
+    default:
+
+        //
+        // The interpreter doesn't know it either
+        //
+        return FALSE;
+    }
+
+    Instruction->CountOfOperands = Instruction->FirstSource + Instruction->CountOfSources +
+                                   (Instruction->HasDestination ? 1 : 0);
+
+    return Instruction->CountOfOperands <= CodeBuffer->Pointer - Indx;
+}
+
+/**
+* @brief Check whether the symbol is a temp or a variable
+*
+* @param Symbol
+* @return BOOL
+*/
+BOOL
+OptimizerIsTrackable(PSYMBOL Symbol)
+{
+    return Symbol->Type == SYMBOL_TEMP_TYPE ||
+           Symbol->Type == SYMBOL_GLOBAL_ID_TYPE ||
+           Symbol->Type == SYMBOL_LOCAL_ID_TYPE;
+}
+
+/**
+* @brief Check whether two symbols are the same
+*
+* @param Symbol1
+* @param Symbol2
+* @return BOOL
+*/
+BOOL
+OptimizerIsSameSymbol(PSYMBOL Symbol1, PSYMBOL Symbol2)
+{
+    return Symbol1->Type == Symbol2->Type && Symbol1->Value == Symbol2->Value;
+}
+
+/**
+* @brief Get the bitmap of a symbol if it's a temp
+*
+* @param Symbol
+* @return unsigned int zero if the symbol is not a temp
+*/
+unsigned int
+OptimizerTempBit(PSYMBOL Symbol)
+{
+    if ((Symbol->Type & OPTIMIZER_SYMBOL_TYPE_MASK) != SYMBOL_TEMP_TYPE)
+    {
+        return 0;
+    }
+
+    //
+    // The temps that don't fit in the bitmap are rejected in decoding
+    //
+    if (Symbol->Value >= OPTIMIZER_MAX_TEMPS_IN_BITMAP)
+    {
+        return 0;
+    }
+
+    return 1u << Symbol->Value;
+}
+
+/**
+* @brief Convert the code buffer to a list of instructions
+*
+* @param CodeBuffer
+* @param Code
+* @return BOOL FALSE if the code buffer can't be optimized
+*/
+BOOL
+OptimizerDecode(PSYMBOL_BUFFER CodeBuffer, POPTIMIZER_CODE Code)
+{
+    POPTIMIZER_INSTRUCTION Instruction;
+    unsigned int *         InstructionOfSymbol;
+    unsigned int           Indx   = 0;
+    BOOL                   Result = TRUE;
+
+    Code->Count        = 0;
+    Code->Instructions = (POPTIMIZER_INSTRUCTION)malloc(CodeBuffer->Pointer * sizeof(OPTIMIZER_INSTRUCTION));
+    Code->Symbols      = (PSYMBOL)malloc(CodeBuffer->Pointer * sizeof(SYMBOL));
+    InstructionOfSymbol = (unsigned int *)malloc((CodeBuffer->Pointer + 1) * sizeof(unsigned int));
+
+    if (Code->Instructions == NULL || Code->Symbols == NULL || InstructionOfSymbol == NULL)
+    {
+        free(InstructionOfSymbol);
+        return FALSE;
+    }
+
+    memcpy(Code->Symbols, CodeBuffer->Head, CodeBuffer->Pointer * sizeof(SYMBOL));
+
+    for (unsigned int i = 0; i <= CodeBuffer->Pointer; i++)
+    {
+        InstructionOfSymbol[i] = OPTIMIZER_END_OF_CODE;
+    }
+
+    while (Indx < CodeBuffer->Pointer)
+    {
+        if (CodeBuffer->Head[Indx].Type != SYMBOL_SEMANTIC_RULE_TYPE)
+        {
+            Result = FALSE;
+            break;
+        }
+
+        Instruction = &Code->Instructions[Code->Count];
+        memset(Instruction, 0, sizeof(OPTIMIZER_INSTRUCTION));
+
+        Instruction->Operator = CodeBuffer->Head[Indx].Value;
+        Instruction->Operands = &Code->Symbols[Indx + 1];
+
+        if (!OptimizerGetOperatorInfo(Instruction, CodeBuffer, Indx + 1))
+        {
+            Result = FALSE;
+            break;
+        }
+
+        //
+        // The temps are kept in a bitmap
+        //
+        for (unsigned int i = 0; i < Instruction->CountOfOperands; i++)
+        {
+            if ((Instruction->Operands[i].Type & OPTIMIZER_SYMBOL_TYPE_MASK) == SYMBOL_TEMP_TYPE &&
+                (Instruction->Operands[i].Value >= MAX_TEMP_COUNT ||
+                 Instruction->Operands[i].Value >= OPTIMIZER_MAX_TEMPS_IN_BITMAP))
+            {
+                Result = FALSE;
+            }
+        }
+
+        if (!Result)
+        {
+            break;
+        }
+
+        InstructionOfSymbol[Indx] = Code->Count;
+        Indx += 1 + Instruction->CountOfOperands;
+        Code->Count++;
+    }
+
+    //
+    // Convert the targets of jumps from the index of symbols to the
+    // index of instructions, the targets should be an instruction or
+    // the end of the code buffer
+    //
+    InstructionOfSymbol[CodeBuffer->Pointer] = Code->Count;
+
+    for (unsigned int i = 0; Result && i < Code->Count; i++)
+    {
+        Instruction = &Code->Instructions[i];
+
+        if (!(Instruction->Flags & OPTIMIZER_FLAG_JUMP))
+        {
+            continue;
+        }
+
+        if (Instruction->Operands[0].Type != SYMBOL_NUM_TYPE ||
+            Instruction->Operands[0].Value > CodeBuffer->Pointer ||
+            InstructionOfSymbol[Instruction->Operands[0].Value] == OPTIMIZER_END_OF_CODE)
+        {
+            Result = FALSE;
+            break;
+        }
+
+        Instruction->Target = InstructionOfSymbol[Instruction->Operands[0].Value];
+    }
+
+    free(InstructionOfSymbol);
+
+    return Result;
+}
+
+/**
+* @brief Write the list of instructions back to the code buffer
+*
+* @param CodeBuffer
+* @param Code
+* @return VOID
+*/
+void
+OptimizerEncode(PSYMBOL_BUFFER CodeBuffer, POPTIMIZER_CODE Code)
+{
+    POPTIMIZER_INSTRUCTION Instruction;
+    unsigned int *         SymbolOfInstruction;
+    unsigned int           Indx = 0;
+
+    SymbolOfInstruction = (unsigned int *)malloc((Code->Count + 1) * sizeof(unsigned int));
+
+    if (SymbolOfInstruction == NULL)
+    {
+        return;
+    }
+
+    for (unsigned int i = 0; i < Code->Count; i++)
+    {
+        SymbolOfInstruction[i] = Indx;
+        Indx += 1 + Code->Instructions[i].CountOfOperands;
+    }
+
+    SymbolOfInstruction[Code->Count] = Indx;
+
+    //
+    // The optimized code is never longer than the original code
+    //
+    Indx = 0;
+
+    for (unsigned int i = 0; i < Code->Count; i++)
+    {
+        Instruction = &Code->Instructions[i];
+
+        if (Instruction->Flags & OPTIMIZER_FLAG_JUMP)
+        {
+            Instruction->Operands[0].Value = SymbolOfInstruction[Instruction->Target];
+        }
+
+        CodeBuffer->Head[Indx].Type  = SYMBOL_SEMANTIC_RULE_TYPE;
+        CodeBuffer->Head[Indx].Value = Instruction->Operator;
+
+        memcpy(&CodeBuffer->Head[Indx + 1], Instruction->Operands, Instruction->CountOfOperands * sizeof(SYMBOL));
+
+        Indx += 1 + Instruction->CountOfOperands;
+    }
+
+    CodeBuffer->Pointer = Indx;
+
+    free(SymbolOfInstruction);
+}
+
+/**
+* @brief Remove the removed instructions from the list
+* @details A jump to a removed instruction goes to the next instruction
+* that is not removed
+*
+* @param Code
+* @return VOID
+*/
+void
+OptimizerCompact(POPTIMIZER_CODE Code)
+{
+    unsigned int Count = 0;
+
+    //
+    // Find the new index of each instruction (the index of the next
+    // instruction for the removed ones), Target is used for jumps
+    // so the new indexes are kept in LiveOut
+    //
+    for (unsigned int i = 0; i < Code->Count; i++)
+    {
+        Code->Instructions[i].LiveOut = Count;
+
+        if (!Code->Instructions[i].IsRemoved)
+        {
+            Count++;
+        }
+    }
+
+    for (unsigned int i = 0; i < Code->Count; i++)
+    {
+        POPTIMIZER_INSTRUCTION Instruction = &Code->Instructions[i];
+
+        if (Instruction->IsRemoved || !(Instruction->Flags & OPTIMIZER_FLAG_JUMP))
+        {
+            continue;
+        }
+
+        Instruction->Target = Instruction->Target == Code->Count ? Count : Code->Instructions[Instruction->Target].LiveOut;
+    }
+
+    Count = 0;
+
+    for (unsigned int i = 0; i < Code->Count; i++)
+    {
+        if (!Code->Instructions[i].IsRemoved)
+        {
+            Code->Instructions[Count++] = Code->Instructions[i];
+        }
+    }
+
+    Code->Count = Count;
+}
+
+/**
+* @brief Mark the first instruction of the basic blocks
+*
+* @param Code
+* @return VOID
+*/
+void
+OptimizerFindLeaders(POPTIMIZER_CODE Code)
+{
+    for (unsigned int i = 0; i < Code->Count; i++)
+    {
+        Code->Instructions[i].IsLeader = i == 0 || (Code->Instructions[i - 1].Flags & OPTIMIZER_FLAG_JUMP);
+    }
+
+    for (unsigned int i = 0; i < Code->Count; i++)
+    {
+        if ((Code->Instructions[i].Flags & OPTIMIZER_FLAG_JUMP) && Code->Instructions[i].Target < Code->Count)
+        {
+            Code->Instructions[Code->Instructions[i].Target].IsLeader = TRUE;
+        }
+    }
+}
+
+/**
+* @brief Compute the result of an instruction if all of its sources
+* are numbers and convert it to a mov
+*
+* @param Instruction
+* @return BOOL whether the instruction is changed or not
+*/
+BOOL
+OptimizerFoldConstants(POPTIMIZER_INSTRUCTION Instruction)
+{
+    unsigned long long SrcVal0;
+    unsigned long long SrcVal1;
+    unsigned long long DesVal;
+    PSYMBOL            Operands = Instruction->Operands;
+
+    if (Instruction->Operator == FUNC_MOV || !Instruction->HasDestination || Instruction->CountOfSources == 0)
+    {
+        return FALSE;
+    }
+
+    for (unsigned int i = 0; i < Instruction->CountOfSources; i++)
+    {
+        if (Operands[i].Type != SYMBOL_NUM_TYPE)
+        {
+            return FALSE;
+        }
+    }
+
+    //
+    // The same as ScriptEngineExecute, the second source is the left
+    // operand of binary operators
+    //
+    SrcVal0 = Operands[0].Value;
+    SrcVal1 = Instruction->CountOfSources > 1 ? Operands[1].Value : 0;
+
+    switch (Instruction->Operator)
+    {
+    case FUNC_OR:
+        DesVal = SrcVal1 | SrcVal0;
+        break;
+    case FUNC_XOR:
+        DesVal = SrcVal1 ^ SrcVal0;
+        break;
+    case FUNC_AND:
+        DesVal = SrcVal1 & SrcVal0;
+        break;
+    case FUNC_ASR:
+        if (SrcVal0 >= 64)
+        {
+            return FALSE;
+        }
+        DesVal = SrcVal1 >> SrcVal0;
+        break;
+    case FUNC_ASL:
+        if (SrcVal0 >= 64)
+        {
+            return FALSE;
+        }
+        DesVal = SrcVal1 << SrcVal0;
+        break;
+    case FUNC_ADD:
+        DesVal = SrcVal1 + SrcVal0;
+        break;
+    case FUNC_SUB:
+        DesVal = SrcVal1 - SrcVal0;
+        break;
+    case FUNC_MUL:
+        DesVal = SrcVal1 * SrcVal0;
+        break;
+    case FUNC_DIV:
+        if (SrcVal0 == 0)
+        {
+            return FALSE;
+        }
+        DesVal = SrcVal1 / SrcVal0;
+        break;
+    case FUNC_MOD:
+        if (SrcVal0 == 0)
+        {
+            return FALSE;
+        }
+        DesVal = SrcVal1 % SrcVal0;
+        break;
+    case FUNC_GT:
+        DesVal = SrcVal1 > SrcVal0;
+        break;
+    case FUNC_LT:
+        DesVal = SrcVal1 < SrcVal0;
+        break;
+    case FUNC_EGT:
+        DesVal = SrcVal1 >= SrcVal0;
+        break;
+    case FUNC_ELT:
+        DesVal = SrcVal1 <= SrcVal0;
+        break;
+    case FUNC_EQUAL:
+        DesVal = SrcVal1 == SrcVal0;
+        break;
+    case FUNC_NEQ:
+        DesVal = SrcVal1 != SrcVal0;
+        break;
+    case FUNC_NOT:
+        DesVal = ~SrcVal0;
+        break;
+    case FUNC_NEG:
+        DesVal = -(long long)SrcVal0;
+        break;
+    default:
+        return FALSE;
+    }
+
+    //
+    // Convert it to "mov DesVal, Des"
+    //
+    Operands[0].Value = DesVal;
+    Operands[1]       = Operands[Instruction->CountOfSources];
+
+    Instruction->Operator        = FUNC_MOV;
+    Instruction->CountOfSources  = 1;
+    Instruction->CountOfOperands = 2;
+    Instruction->Flags           = OPTIMIZER_FLAG_PURE;
+
+    return TRUE;
+}
+
+/**
+* @brief Forget everything that is known about a temp or a variable
+*
+* @param Facts
+* @param CountOfFacts
+* @param Symbol the temp or variable that is modified
+* @return VOID
+*/
+void
+OptimizerKillFacts(POPTIMIZER_FACT Facts, unsigned int * CountOfFacts, PSYMBOL Symbol)
+{
+    for (unsigned int i = 0; i < *CountOfFacts;)
+    {
+        if (OptimizerIsSameSymbol(&Facts[i].Key, Symbol) || OptimizerIsSameSymbol(&Facts[i].Value, Symbol))
+        {
+            Facts[i] = Facts[--(*CountOfFacts)];
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+
+/**
+* @brief Fold the constants and propagate the known values of temps
+* and variables in each basic block
+*
+* @param Code
+* @return BOOL whether the code is changed or not
+*/
+BOOL
+OptimizerPropagate(POPTIMIZER_CODE Code)
+{
+    OPTIMIZER_FACT         Facts[OPTIMIZER_MAX_FACTS];
+    unsigned int           CountOfFacts = 0;
+    BOOL                   Changed      = FALSE;
+    POPTIMIZER_INSTRUCTION Instruction;
+    PSYMBOL                Source;
+    PSYMBOL                Destination;
+
+    OptimizerFindLeaders(Code);
+
+    for (unsigned int i = 0; i < Code->Count; i++)
+    {
+        Instruction = &Code->Instructions[i];
+
+        if (Instruction->IsLeader)
+        {
+            CountOfFacts = 0;
+        }
+
+        //
+        // Replace the sources by their known values
+        //
+        if (!(Instruction->Flags & OPTIMIZER_FLAG_KEEP_OPERANDS))
+        {
+            for (unsigned int j = 0; j < Instruction->CountOfSources; j++)
+            {
+                Source = &Instruction->Operands[Instruction->FirstSource + j];
+
+                if (!OptimizerIsTrackable(Source))
+                {
+                    continue;
+                }
+
+                for (unsigned int k = 0; k < CountOfFacts; k++)
+                {
+                    if (OptimizerIsSameSymbol(&Facts[k].Key, Source))
+                    {
+                        *Source = Facts[k].Value;
+                        Changed = TRUE;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (OptimizerFoldConstants(Instruction))
+        {
+            Changed = TRUE;
+        }
+
+        if (Instruction->Flags & OPTIMIZER_FLAG_BARRIER)
+        {
+            CountOfFacts = 0;
+        }
+
+        if (Instruction->Flags & OPTIMIZER_FLAG_READ_WRITE)
+        {
+            OptimizerKillFacts(Facts, &CountOfFacts, &Instruction->Operands[0]);
+        }
+
+        if (!Instruction->HasDestination)
+        {
+            continue;
+        }
+
+        Destination = &Instruction->Operands[Instruction->FirstSource + Instruction->CountOfSources];
+
+        OptimizerKillFacts(Facts, &CountOfFacts, Destination);
+
+        //
+        // Remember the value of "mov Source, Destination"
+        //
+        Source = &Instruction->Operands[0];
+
+        if (Instruction->Operator == FUNC_MOV &&
+            OptimizerIsTrackable(Destination) &&
+            (Source->Type == SYMBOL_NUM_TYPE || OptimizerIsTrackable(Source)) &&
+            !OptimizerIsSameSymbol(Source, Destination) &&
+            CountOfFacts < OPTIMIZER_MAX_FACTS)
+        {
+            Facts[CountOfFacts].Key   = *Destination;
+            Facts[CountOfFacts].Value = *Source;
+            CountOfFacts++;
+        }
+    }
+
+    return Changed;
+}
+
+/**
+* @brief Simplify the jumps on constant conditions, the jumps to the
+* next instruction and the jumps to other jumps
+*
+* @param Code
+* @return BOOL whether the code is changed or not
+*/
+BOOL
+OptimizerSimplifyBranches(POPTIMIZER_CODE Code)
+{
+    POPTIMIZER_INSTRUCTION Instruction;
+    POPTIMIZER_INSTRUCTION Target;
+    BOOL                   Changed = FALSE;
+    BOOL                   IsTaken;
+    unsigned int           Next;
+
+    for (unsigned int i = 0; i < Code->Count; i++)
+    {
+        Instruction = &Code->Instructions[i];
+
+        if (!(Instruction->Flags & OPTIMIZER_FLAG_JUMP))
+        {
+            continue;
+        }
+
+        if ((Instruction->Operator == FUNC_JZ || Instruction->Operator == FUNC_JNZ) &&
+            Instruction->Operands[1].Type == SYMBOL_NUM_TYPE)
+        {
+            IsTaken = (Instruction->Operands[1].Value == 0) == (Instruction->Operator == FUNC_JZ);
+
+            if (IsTaken)
+            {
+                Instruction->Operator        = FUNC_JMP;
+                Instruction->CountOfSources  = 0;
+                Instruction->CountOfOperands = 1;
+            }
+            else
+            {
+                Instruction->IsRemoved = TRUE;
+            }
+
+            Changed = TRUE;
+        }
+
+        if (Instruction->IsRemoved)
+        {
+            continue;
+        }
+
+        //
+        // Jumps to a jmp go directly to its target
+        //
+        for (unsigned int j = 0; j < OPTIMIZER_MAX_JUMP_THREADING && Instruction->Target < Code->Count; j++)
+        {
+            Target = &Code->Instructions[Instruction->Target];
+
+            if (Target->Operator != FUNC_JMP || Target->IsRemoved || Target->Target == Instruction->Target)
+            {
+                break;
+            }
+
+            Instruction->Target = Target->Target;
+            Changed             = TRUE;
+        }
+
+        //
+        // A jmp to the next instruction does nothing
+        //
+        if (Instruction->Operator == FUNC_JMP)
+        {
+            Next = i + 1;
+
+            while (Next < Code->Count && Code->Instructions[Next].IsRemoved)
+            {
+                Next++;
+            }
+
+            if (Instruction->Target == Next)
+            {
+                Instruction->IsRemoved = TRUE;
+                Changed                = TRUE;
+            }
+        }
+    }
+
+    return Changed;
+}
+
+/**
+* @brief Remove the instructions that are never executed
+*
+* @param Code
+* @return BOOL whether the code is changed or not
+*/
+BOOL
+OptimizerRemoveUnreachable(POPTIMIZER_CODE Code)
+{
+    POPTIMIZER_INSTRUCTION Instruction;
+    unsigned int *         WorkList;
+    unsigned int           CountOfWorks = 0;
+    BOOL                   Changed      = FALSE;
+
+    if (Code->Count == 0)
+    {
+        return FALSE;
+    }
+
+    WorkList = (unsigned int *)malloc(Code->Count * sizeof(unsigned int));
+
+    if (WorkList == NULL)
+    {
+        return FALSE;
+    }
+
+    //
+    // IsLeader is reused for marking the reachable instructions
+    //
+    for (unsigned int i = 0; i < Code->Count; i++)
+    {
+        Code->Instructions[i].IsLeader = FALSE;
+    }
+
+    Code->Instructions[0].IsLeader = TRUE;
+    WorkList[CountOfWorks++]       = 0;
+
+    while (CountOfWorks != 0)
+    {
+        unsigned int Indx = WorkList[--CountOfWorks];
+        Instruction       = &Code->Instructions[Indx];
+
+        if (Instruction->Operator != FUNC_JMP && Indx + 1 < Code->Count && !Code->Instructions[Indx + 1].IsLeader)
+        {
+            Code->Instructions[Indx + 1].IsLeader = TRUE;
+            WorkList[CountOfWorks++]              = Indx + 1;
+        }
+
+        if ((Instruction->Flags & OPTIMIZER_FLAG_JUMP) && Instruction->Target < Code->Count &&
+            !Code->Instructions[Instruction->Target].IsLeader)
+        {
+            Code->Instructions[Instruction->Target].IsLeader = TRUE;
+            WorkList[CountOfWorks++]                         = Instruction->Target;
+        }
+    }
+
+    for (unsigned int i = 0; i < Code->Count; i++)
+    {
+        if (!Code->Instructions[i].IsLeader)
+        {
+            Code->Instructions[i].IsRemoved = TRUE;
+            Changed                         = TRUE;
+        }
+    }
+
+    free(WorkList);
+
+    return Changed;
+}
+
+/**
+* @brief Compute the temps that are used after each instruction
+*
+* @param Code
+* @return BOOL FALSE if there is not enough memory
+*/
+BOOL
+OptimizerComputeLiveness(POPTIMIZER_CODE Code)
+{
+    POPTIMIZER_INSTRUCTION Instruction;
+    unsigned int *         LiveIn;
+    unsigned int           Use;
+    unsigned int           Def;
+    unsigned int           LiveOut;
+    BOOL                   Changed;
+
+    LiveIn = (unsigned int *)malloc((Code->Count + 1) * sizeof(unsigned int));
+
+    if (LiveIn == NULL)
+    {
+        return FALSE;
+    }
+
+    for (unsigned int i = 0; i <= Code->Count; i++)
+    {
+        LiveIn[i] = 0;
+    }
+
+    do
+    {
+        Changed = FALSE;
+
+        for (unsigned int i = Code->Count; i-- > 0;)
+        {
+            Instruction = &Code->Instructions[i];
+            Use         = 0;
+            Def         = 0;
+
+            for (unsigned int j = 0; j < Instruction->CountOfSources; j++)
+            {
+                Use |= OptimizerTempBit(&Instruction->Operands[Instruction->FirstSource + j]);
+            }
+
+            if (Instruction->HasDestination)
+            {
+                Def = OptimizerTempBit(&Instruction->Operands[Instruction->FirstSource + Instruction->CountOfSources]);
+            }
+
+            LiveOut = Instruction->Operator != FUNC_JMP ? LiveIn[i + 1] : 0;
+
+            if (Instruction->Flags & OPTIMIZER_FLAG_JUMP)
+            {
+                LiveOut |= LiveIn[Instruction->Target];
+            }
+
+            Instruction->LiveOut = LiveOut;
+            LiveOut              = Use | (LiveOut & ~Def);
+
+            if (LiveOut != LiveIn[i])
+            {
+                LiveIn[i] = LiveOut;
+                Changed   = TRUE;
+            }
+        }
+
+    } while (Changed);
+
+    free(LiveIn);
+
+    return TRUE;
+}
+
+/**
+* @brief Remove the instructions that their results are never used and
+* merge "op ..., Temp" and "mov Temp, Des" into "op ..., Des"
+*
+* @param Code
+* @return BOOL whether the code is changed or not
+*/
+BOOL
+OptimizerRemoveDeadTemps(POPTIMIZER_CODE Code)
+{
+    POPTIMIZER_INSTRUCTION Instruction;
+    POPTIMIZER_INSTRUCTION Next;
+    PSYMBOL                Destination;
+    BOOL                   Changed = FALSE;
+    BOOL                   IsPure;
+
+    if (!OptimizerComputeLiveness(Code))
+    {
+        return FALSE;
+    }
+
+    OptimizerFindLeaders(Code);
+
+    for (unsigned int i = 0; i < Code->Count; i++)
+    {
+        Instruction = &Code->Instructions[i];
+
+        if (Instruction->IsRemoved || !Instruction->HasDestination)
+        {
+            continue;
+        }
+
+        Destination = &Instruction->Operands[Instruction->FirstSource + Instruction->CountOfSources];
+
+        //
+        // A division by a non-zero number never fails
+        //
+        IsPure = (Instruction->Flags & OPTIMIZER_FLAG_PURE) ||
+                 ((Instruction->Operator == FUNC_DIV || Instruction->Operator == FUNC_MOD) &&
+                  Instruction->Operands[0].Type == SYMBOL_NUM_TYPE && Instruction->Operands[0].Value != 0);
+
+        if (IsPure &&
+            ((Destination->Type == SYMBOL_TEMP_TYPE && !(Instruction->LiveOut & OptimizerTempBit(Destination))) ||
+             (Instruction->Operator == FUNC_MOV && OptimizerIsSameSymbol(&Instruction->Operands[0], Destination))))
+        {
+            Instruction->IsRemoved = TRUE;
+            Changed                = TRUE;
+            continue;
+        }
+
+        //
+        // The sources are read before the destination is written, so
+        // the destination of the mov can be used instead of the temp
+        //
+        if (Destination->Type != SYMBOL_TEMP_TYPE || i + 1 >= Code->Count)
+        {
+            continue;
+        }
+
+        Next = &Code->Instructions[i + 1];
+
+        if (Next->Operator == FUNC_MOV && !Next->IsLeader &&
+            OptimizerIsSameSymbol(&Next->Operands[0], Destination) &&
+            !(Next->LiveOut & OptimizerTempBit(Destination)))
+        {
+            *Destination    = Next->Operands[1];
+            Next->IsRemoved = TRUE;
+            Changed         = TRUE;
+            i++;
+        }
+    }
+
+    return Changed;
+}
+
+/**
+* @brief Optimize the code buffer of a script
+*
+* @param CodeBuffer
+* @return VOID
+*/
+void
+ScriptEngineOptimize(PSYMBOL_BUFFER CodeBuffer)
+{
+    OPTIMIZER_CODE Code    = {0};
+    BOOL           Changed = TRUE;
+
+    OptimizerCountOfInstructions          = 0;
+    OptimizerCountOfOptimizedInstructions = 0;
+
+    if (!OptimizerIsEnabled)
+    {
+        return;
+    }
+
+    if (!OptimizerDecode(CodeBuffer, &Code))
+    {
+        //
+        // Leave the code buffer as it is
+        //
+        free(Code.Instructions);
+        free(Code.Symbols);
+        return;
+    }
+
+    OptimizerCountOfInstructions = Code.Count;
+
+#ifdef _SCRIPT_ENGINE_OPTIMIZER_DBG_EN
+    printf("Code Buffer (before optimization):\n");
+    PrintSymbolBuffer(CodeBuffer);
+#endif
+
+    for (unsigned int i = 0; Changed && i < OPTIMIZER_MAX_PASSES; i++)
+    {
+        Changed = OptimizerPropagate(&Code);
+
+        Changed |= OptimizerSimplifyBranches(&Code);
+        OptimizerCompact(&Code);
+
+        Changed |= OptimizerRemoveUnreachable(&Code);
+        OptimizerCompact(&Code);
+
+        Changed |= OptimizerRemoveDeadTemps(&Code);
+        OptimizerCompact(&Code);
+    }
+
+    OptimizerEncode(CodeBuffer, &Code);
+
+    OptimizerCountOfOptimizedInstructions = Code.Count;
+
+#ifdef _SCRIPT_ENGINE_OPTIMIZER_DBG_EN
+    printf("Code Buffer (after optimization, %d instructions instead of %d):\n",
+           OptimizerCountOfOptimizedInstructions,
+           OptimizerCountOfInstructions);
+    PrintSymbolBuffer(CodeBuffer);
+#endif
+
+    free(Code.Instructions);
+    free(Code.Symbols);
+}
+
+/**
+* @brief Get the count of instructions of the last parsed script
+* before and after optimization
+*
+* @param CountOfInstructions
+* @param CountOfOptimizedInstructions
+* @return VOID
+*/
+void
+ScriptEngineGetOptimizerStatistics(unsigned int * CountOfInstructions, unsigned int * CountOfOptimizedInstructions)
+{
+    *CountOfInstructions          = OptimizerCountOfInstructions;
+    *CountOfOptimizedInstructions = OptimizerCountOfOptimizedInstructions;
+}
+
+/**
+* @brief Enable or disable the optimizer for the next parsed scripts
+* @details The generated code is run as it is when the optimizer is
+* disabled (e.g., to test the engines with the naive code)
+*
+* @param IsEnabled
+* @return VOID
+*/
+void
+ScriptEngineSetOptimizer(int IsEnabled)
+{
+    OptimizerIsEnabled = IsEnabled;
+}
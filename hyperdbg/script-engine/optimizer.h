@@ -0,0 +1,171 @@
+/**
+ * @file optimizer.h
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief Script engine optimizer (headers)
+ * @details
+ * @version 0.1
+ * @date 2021-11-02
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+#ifndef OPTIMIZER_H
+#    define OPTIMIZER_H
+
+/**
+* @brief maximum count of passes over the code buffer
+*/
+#    define OPTIMIZER_MAX_PASSES 8
+
+/**
+* @brief maximum count of known values of temps and variables
+* in a basic block
+*/
+#    define OPTIMIZER_MAX_FACTS 64
+
+/**
+* @brief maximum count of jumps that are followed for threading a jump
+*/
+#    define OPTIMIZER_MAX_JUMP_THREADING 8
+
+/**
+* @brief count of temps that the bitmaps of liveness can keep
+*/
+#    define OPTIMIZER_MAX_TEMPS_IN_BITMAP 32
+
+/**
+* @brief the instruction has no side effect and never fails, it can be
+* removed if its destination is not used
+*/
+#    define OPTIMIZER_FLAG_PURE 0x1
+
+/**
+* @brief the instruction might modify the memory (including the variables
+* that their addresses are taken) so nothing is known after it
+*/
+#    define OPTIMIZER_FLAG_BARRIER 0x2
+
+/**
+* @brief the operands of the instruction should not be replaced by their
+* known values (reference, read-modify-write and format operands)
+*/
+#    define OPTIMIZER_FLAG_KEEP_OPERANDS 0x4
+
+/**
+* @brief the (only) source of the instruction is also its destination
+*/
+#    define OPTIMIZER_FLAG_READ_WRITE 0x8
+
+/**
+* @brief the instruction is a jump, its first operand is the target
+*/
+#    define OPTIMIZER_FLAG_JUMP 0x10
+
+/**
+* @brief marks the target of jumps which point to the end of the code
+*/
+#    define OPTIMIZER_END_OF_CODE 0xffffffff
+
+/**
+* @brief the mask of the type of symbols (arguments of printf keep
+* the position of their format specifier in the upper bits)
+*/
+#    define OPTIMIZER_SYMBOL_TYPE_MASK 0x7fffffff
+
+/**
+* @brief an instruction (operator and its operands) of the code buffer
+*/
+typedef struct _OPTIMIZER_INSTRUCTION
+{
+    unsigned long long Operator;
+    PSYMBOL            Operands;        // points to the copy of the operands
+    unsigned int       CountOfOperands; // count of symbols after the operator
+    unsigned int       FirstSource;     // index of the first source in the operands
+    unsigned int       CountOfSources;
+    BOOL               HasDestination; // the destination is after the sources
+    unsigned int       Flags;
+    unsigned int       Target;   // index of the target instruction of jumps
+    unsigned int       LiveOut;  // bitmap of the temps that are used later
+    BOOL               IsLeader; // first instruction of a basic block
+    BOOL               IsRemoved;
+
+} OPTIMIZER_INSTRUCTION, *POPTIMIZER_INSTRUCTION;
+
+/**
+* @brief a known value of a temp or a variable, either a number or
+* another temp or variable that holds the same value
+*/
+typedef struct _OPTIMIZER_FACT
+{
+    SYMBOL Key;
+    SYMBOL Value;
+
+} OPTIMIZER_FACT, *POPTIMIZER_FACT;
+
+/**
+* @brief the code buffer as a list of instructions
+*/
+typedef struct _OPTIMIZER_CODE
+{
+    POPTIMIZER_INSTRUCTION Instructions;
+    unsigned int           Count;
+    PSYMBOL                Symbols; // copy of the symbols of the code buffer
+
+} OPTIMIZER_CODE, *POPTIMIZER_CODE;
+
+BOOL
+OptimizerGetOperatorInfo(POPTIMIZER_INSTRUCTION Instruction, PSYMBOL_BUFFER CodeBuffer, unsigned int Indx);
+
+BOOL
+OptimizerIsTrackable(PSYMBOL Symbol);
+
+BOOL
+OptimizerIsSameSymbol(PSYMBOL Symbol1, PSYMBOL Symbol2);
+
+unsigned int
+OptimizerTempBit(PSYMBOL Symbol);
+
+BOOL
+OptimizerDecode(PSYMBOL_BUFFER CodeBuffer, POPTIMIZER_CODE Code);
+
+void
+OptimizerEncode(PSYMBOL_BUFFER CodeBuffer, POPTIMIZER_CODE Code);
+
+void
+OptimizerCompact(POPTIMIZER_CODE Code);
+
+void
+OptimizerFindLeaders(POPTIMIZER_CODE Code);
+
+BOOL
+OptimizerFoldConstants(POPTIMIZER_INSTRUCTION Instruction);
+
+void
+OptimizerKillFacts(POPTIMIZER_FACT Facts, unsigned int * CountOfFacts, PSYMBOL Symbol);
+
+BOOL
+OptimizerPropagate(POPTIMIZER_CODE Code);
+
+BOOL
+OptimizerSimplifyBranches(POPTIMIZER_CODE Code);
+
+BOOL
+OptimizerRemoveUnreachable(POPTIMIZER_CODE Code);
+
+BOOL
+OptimizerComputeLiveness(POPTIMIZER_CODE Code);
+
+BOOL
+OptimizerRemoveDeadTemps(POPTIMIZER_CODE Code);
+
+void
+ScriptEngineOptimize(PSYMBOL_BUFFER CodeBuffer);
+
+__declspec(dllexport) void ScriptEngineGetOptimizerStatistics(unsigned int * CountOfInstructions,
+                                                              unsigned int * CountOfOptimizedInstructions);
+
+__declspec(dllexport) void ScriptEngineSetOptimizer(int IsEnabled);
+
+#endif
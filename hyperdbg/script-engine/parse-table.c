@@ -43,6 +43,11 @@ const struct _TOKEN Lhs[RULES_COUNT]=
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
+	{NON_TERMINAL, "CALL_FUNC_STATEMENT"},
 	{NON_TERMINAL, "VA"},
 	{NON_TERMINAL, "VA"},
 	{NON_TERMINAL, "IF_STATEMENT"},
@@ -131,6 +136,11 @@ const struct _TOKEN Lhs[RULES_COUNT]=
 	{NON_TERMINAL, "E12"},
 	{NON_TERMINAL, "E12"},
 	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
 	{NON_TERMINAL, "E13"},
 	{NON_TERMINAL, "STRING"},
 	{NON_TERMINAL, "L_VALUE"},
@@ -161,27 +171,32 @@ const struct _TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "printf"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "STRING"},{SEMANTIC_RULE, "@VARGSTART"},{NON_TERMINAL, "VA"},{SEMANTIC_RULE, "@PRINTF"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "pause"},{SPECIAL_TOKEN, "("},{SEMANTIC_RULE, "@PAUSE"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "spinlock_lock_custom_wait"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@SPINLOCK_LOCK_CUSTOM_WAIT"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "poi"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@POI"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "db"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DB"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "dd"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DD"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "dw"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DW"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "dq"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DQ"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "neg"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@NEG"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "hi"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@HI"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "low"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@LOW"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "not"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@NOT"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "check_address"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@CHECK_ADDRESS"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "strlen"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@STRLEN"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "wcslen"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@WCSLEN"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "interlocked_increment"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_INCREMENT"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "interlocked_decrement"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_DECREMENT"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "ref"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@REF"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "ed"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@ED"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "eb"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EB"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "eq"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EQ"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "interlocked_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "interlocked_exchange_add"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE_ADD"},{SPECIAL_TOKEN, ")"}},
-	{{SEMANTIC_RULE, "@IGNORE_LVALUE"},{KEYWORD, "interlocked_compare_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_COMPARE_EXCHANGE"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "poi"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@POI"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "db"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DB"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "dd"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DD"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "dw"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DW"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "dq"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@DQ"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "neg"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@NEG"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "hi"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@HI"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "low"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@LOW"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "not"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@NOT"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "check_address"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@CHECK_ADDRESS"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "strlen"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@STRLEN"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "wcslen"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@WCSLEN"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "interlocked_increment"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_INCREMENT"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "interlocked_decrement"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_DECREMENT"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "ref"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@REF"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "ed"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@ED"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "eb"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EB"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "eq"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EQ"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "interlocked_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "interlocked_exchange_add"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE_ADD"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "map_count"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_COUNT"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "map_hist"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_HIST"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "interlocked_compare_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_COMPARE_EXCHANGE"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "map_sum"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_SUM"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "map_min"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_MIN"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
+	{{KEYWORD, "map_max"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_MAX"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@IGNORE_LVALUE"}},
 	{{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{NON_TERMINAL, "VA"}},
 	{{EPSILON, "eps"}},
 	{{KEYWORD, "if"},{SEMANTIC_RULE, "@START_OF_IF"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "BOOLEAN_EXPRESSION"},{SPECIAL_TOKEN, ")"},{SEMANTIC_RULE, "@JZ"},{SPECIAL_TOKEN, "{"},{NON_TERMINAL, "S"},{SPECIAL_TOKEN, "}"},{NON_TERMINAL, "ELSIF_STATEMENT"},{NON_TERMINAL, "ELSE_STATEMENT"},{SEMANTIC_RULE, "@END_OF_IF"},{NON_TERMINAL, "END_OF_IF"}},
@@ -255,7 +270,12 @@ const struct _TOKEN Rhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "eq"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EQ"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "interlocked_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "interlocked_exchange_add"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE_ADD"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_count"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_COUNT"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_hist"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_HIST"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "interlocked_compare_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_COMPARE_EXCHANGE"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_sum"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_SUM"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_min"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_MIN"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_max"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_MAX"},{SPECIAL_TOKEN, ")"}},
 	{{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ")"}},
 	{{SEMANTIC_RULE, "@PUSH"},{REGISTER, "_register"}},
 	{{SEMANTIC_RULE, "@PUSH"},{LOCAL_ID, "_local_id"}},
@@ -320,6 +340,11 @@ const unsigned int RhsSize[RULES_COUNT]=
 8,
 8,
 8,
+8,
+8,
+10,
+10,
+10,
 10,
 3,
 1,
@@ -394,6 +419,11 @@ const unsigned int RhsSize[RULES_COUNT]=
 7,
 7,
 7,
+7,
+7,
+9,
+9,
+9,
 9,
 3,
 2,
@@ -418,173 +448,178 @@ const unsigned int RhsSize[RULES_COUNT]=
 };
 const char* NoneTerminalMap[NONETERMINAL_COUNT]= 
 {
-"DO_WHILE_STATEMENT",
-"SIMPLE_ASSIGNMENT",
-"E5'",
-"E7'",
-"E6",
-"E5",
-"E8",
-"INC_DEC",
-"E2",
-"STRING",
-"E13",
 "E8'",
-"SIMPLE_ASSIGNMENT'",
-"E12",
-"ELSIF_STATEMENT",
 "S",
-"E0'",
-"E9'",
+"IF_STATEMENT",
+"NULL",
+"E13",
+"VA",
 "FOR_STATEMENT",
-"E1'",
+"ELSIF_STATEMENT",
+"CALL_FUNC_STATEMENT",
+"INC_DEC'",
+"E4'",
 "E3'",
-"E6'",
+"SIMPLE_ASSIGNMENT'",
+"E3",
 "E4",
-"VA",
-"ELSIF_STATEMENT'",
-"E4'",
-"E9",
-"WHILE_STATEMENT",
-"NULL",
-"CALL_FUNC_STATEMENT",
+"E8",
 "STATEMENT",
 "INC'",
-"E2'",
-"E1",
-"E7",
-"E10",
+"E2",
+"END_OF_IF",
+"E7'",
+"E5",
+"ELSE_STATEMENT",
+"E5'",
+"E9",
+"SIMPLE_ASSIGNMENT",
 "DEC'",
+"E10",
+"BOOLEAN_EXPRESSION",
+"E6",
+"E1'",
+"E2'",
 "ASSIGN_STATEMENT",
+"EXPRESSION",
+"E6'",
 "L_VALUE",
-"BOOLEAN_EXPRESSION",
-"E3",
-"END_OF_IF",
-"ELSE_STATEMENT",
-"IF_STATEMENT",
-"INC_DEC'",
-"EXPRESSION"
+"DO_WHILE_STATEMENT",
+"ELSIF_STATEMENT'",
+"E12",
+"INC_DEC",
+"E1",
+"STRING",
+"E7",
+"E9'",
+"WHILE_STATEMENT",
+"E0'"
 };
 const char* TerminalMap[TERMINAL_COUNT]= 
 {
-"ed",
+"{",
+";",
 "continue",
-"test_statement",
+"spinlock_lock",
+"map_count",
+"map_sum",
 "+",
-"_register",
+"-",
+"--",
+"~",
+"_decimal",
+"_octal",
+"spinlock_lock_custom_wait",
 "}",
-"_local_id",
-"spinlock_unlock",
-"interlocked_exchange",
+"interlocked_decrement",
+"check_address",
+">>",
 "%",
-"else",
-"dd",
-"not",
-"*",
-"/",
-"pause",
+"_binary",
+"^",
+"break",
 "formats",
-"low",
-"while",
-"--",
-"hi",
-";",
-"strlen",
+"_hex",
+")",
+"++",
 "dw",
-"(",
-"_global_id",
-"_octal",
-"&",
-"poi",
-">>",
+"eq",
+"printf",
+"_register",
+"|",
+"_string",
+"interlocked_exchange_add",
 "$",
-"interlocked_increment",
+"pause",
+"eb",
+"else",
+"wcslen",
+"map_hist",
+"test_statement",
+"_global_id",
+"if",
 "elsif",
-"{",
+"interlocked_exchange",
+"_pseudo_register",
+"_local_id",
+"*",
+"poi",
+"neg",
+"(",
+"map_max",
+"&",
+"hi",
+"while",
+"ed",
 "disable_event",
-"eq",
-"enable_event",
+"dd",
+"interlocked_increment",
+"/",
+"<<",
+"for",
+"map_min",
 ",",
-"wcslen",
-"_string",
-"eb",
-"spinlock_lock_custom_wait",
-"interlocked_compare_exchange",
-"~",
 "db",
-"<<",
-"interlocked_decrement",
-"break",
-")",
-"=",
+"low",
 "ref",
-"check_address",
+"interlocked_compare_exchange",
 "print",
-"for",
-"if",
-"++",
-"_binary",
-"printf",
-"^",
-"_hex",
-"neg",
-"interlocked_exchange_add",
-"do",
-"-",
-"spinlock_lock",
+"=",
+"strlen",
+"not",
+"spinlock_unlock",
 "dq",
-"_decimal",
-"_pseudo_register",
-"|"
+"enable_event",
+"do"
 };
 const int ParseTable[NONETERMINAL_COUNT][TERMINAL_COUNT]= 
 {
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,52		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,54		,-99		,54		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,55		,-99		,-99		,-99		,54		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,80		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,81		,-99		,-99		,-99		,-99		,-99		,81		,-99		,81		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,81		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,81		,-99		,-99		,81		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,81		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,81	},
-	{-99		,-99		,-99		,87		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,86		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,87		,-99		,-99		,-99		,-99		,-99		,87		,-99		,87		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,87		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,87		,-99		,-99		,87		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,87		,-99		,-99		,-99		,-99		,87		,-99		,-99		,-99		,-99		,87	},
-	{82		,-99		,-99		,82		,82		,-99		,82		,-99		,82		,-99		,-99		,82		,82		,82		,-99		,-99		,-99		,82		,-99		,-99		,82		,-99		,82		,82		,82		,82		,82		,82		,82		,-99		,-99		,82		,-99		,-99		,-99		,82		,-99		,-99		,82		,-99		,82		,-99		,82		,82		,82		,-99		,82		,-99		,-99		,-99		,82		,82		,-99		,-99		,-99		,-99		,82		,-99		,-99		,82		,82		,82		,-99		,82		,-99		,82		,82		,82		,-99	},
-	{79		,-99		,-99		,79		,79		,-99		,79		,-99		,79		,-99		,-99		,79		,79		,79		,-99		,-99		,-99		,79		,-99		,-99		,79		,-99		,79		,79		,79		,79		,79		,79		,79		,-99		,-99		,79		,-99		,-99		,-99		,79		,-99		,-99		,79		,-99		,79		,-99		,79		,79		,79		,-99		,79		,-99		,-99		,-99		,79		,79		,-99		,-99		,-99		,-99		,79		,-99		,-99		,79		,79		,79		,-99		,79		,-99		,79		,79		,79		,-99	},
-	{88		,-99		,-99		,88		,88		,-99		,88		,-99		,88		,-99		,-99		,88		,88		,88		,-99		,-99		,-99		,88		,-99		,-99		,88		,-99		,88		,88		,88		,88		,88		,88		,88		,-99		,-99		,88		,-99		,-99		,-99		,88		,-99		,-99		,88		,-99		,88		,-99		,88		,88		,88		,-99		,88		,-99		,-99		,-99		,88		,88		,-99		,-99		,-99		,-99		,88		,-99		,-99		,88		,88		,88		,-99		,88		,-99		,88		,88		,88		,-99	},
-	{-99		,-99		,-99		,-99		,57		,-99		,57		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,57		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{70		,-99		,-99		,70		,70		,-99		,70		,-99		,70		,-99		,-99		,70		,70		,70		,-99		,-99		,-99		,70		,-99		,-99		,70		,-99		,70		,70		,70		,70		,70		,70		,70		,-99		,-99		,70		,-99		,-99		,-99		,70		,-99		,-99		,70		,-99		,70		,-99		,70		,70		,70		,-99		,70		,-99		,-99		,-99		,70		,70		,-99		,-99		,-99		,-99		,70		,-99		,-99		,70		,70		,70		,-99		,70		,-99		,70		,70		,70		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,131		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,130		,-99		,-99		,-99		,-99		,-99		,130		,-99		,-99		,-99		,130		,130		,-99		,-99		,-99		,-99		,-99		,-99		,130		,-99		,-99		,-99		,-99		,-99		,130		,-99		,130		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,130		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,130		,-99		,-99		,130		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,130		,-99		,-99		,-99		,-99		,130		,-99		,-99		,-99		,-99		,130	},
-	{-99		,-99		,-99		,90		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,90		,89		,-99		,-99		,-99		,-99		,-99		,-99		,90		,-99		,-99		,-99		,-99		,-99		,90		,-99		,90		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,90		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,90		,-99		,-99		,90		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,90		,-99		,-99		,-99		,-99		,90		,-99		,-99		,-99		,-99		,90	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,56		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{110		,-99		,-99		,126		,117		,-99		,118		,-99		,113		,-99		,-99		,97		,103		,128		,-99		,-99		,-99		,102		,-99		,-99		,101		,-99		,105		,98		,116		,119		,122		,129		,95		,-99		,-99		,107		,-99		,-99		,-99		,112		,-99		,-99		,106		,-99		,111		,-99		,115		,127		,96		,-99		,108		,-99		,-99		,-99		,109		,104		,-99		,-99		,-99		,-99		,123		,-99		,-99		,120		,100		,114		,-99		,125		,-99		,99		,121		,124		,-99	},
-	{46		,46		,46		,-99		,46		,46		,46		,46		,46		,-99		,46		,46		,46		,-99		,-99		,46		,46		,46		,46		,-99		,46		,-99		,46		,46		,-99		,46		,-99		,-99		,46		,-99		,46		,46		,45		,-99		,46		,46		,46		,-99		,46		,-99		,46		,46		,46		,-99		,46		,-99		,46		,46		,-99		,-99		,46		,46		,46		,46		,46		,-99		,-99		,46		,-99		,-99		,46		,46		,46		,-99		,46		,46		,-99		,-99		,-99	},
-	{0		,0		,0		,-99		,0		,1		,0		,0		,0		,-99		,-99		,0		,0		,-99		,-99		,0		,0		,0		,0		,-99		,0		,-99		,0		,0		,-99		,0		,-99		,-99		,0		,-99		,1		,0		,-99		,-99		,0		,0		,0		,-99		,0		,-99		,0		,0		,0		,-99		,0		,-99		,0		,0		,-99		,-99		,0		,0		,0		,0		,0		,-99		,-99		,0		,-99		,-99		,0		,0		,0		,-99		,0		,0		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,66		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,66		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,66		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,65	},
-	{-99		,-99		,-99		,93		,-99		,-99		,-99		,-99		,-99		,92		,-99		,-99		,-99		,93		,93		,-99		,-99		,-99		,-99		,-99		,-99		,93		,-99		,-99		,-99		,-99		,-99		,93		,-99		,93		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,93		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,93		,-99		,-99		,93		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,93		,-99		,-99		,-99		,-99		,93		,-99		,-99		,-99		,-99		,93	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,53		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,69		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,69		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,69		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,68		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,69	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,75		,-99		,-99		,-99		,-99		,-99		,75		,-99		,74		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,75		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,75		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,75		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,75	},
-	{-99		,-99		,-99		,84		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,84		,-99		,-99		,-99		,-99		,-99		,84		,-99		,84		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,84		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,84		,-99		,-99		,84		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,84		,-99		,-99		,-99		,-99		,83		,-99		,-99		,-99		,-99		,84	},
-	{76		,-99		,-99		,76		,76		,-99		,76		,-99		,76		,-99		,-99		,76		,76		,76		,-99		,-99		,-99		,76		,-99		,-99		,76		,-99		,76		,76		,76		,76		,76		,76		,76		,-99		,-99		,76		,-99		,-99		,-99		,76		,-99		,-99		,76		,-99		,76		,-99		,76		,76		,76		,-99		,76		,-99		,-99		,-99		,76		,76		,-99		,-99		,-99		,-99		,76		,-99		,-99		,76		,76		,76		,-99		,76		,-99		,76		,76		,76		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,42		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,43		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{47		,47		,47		,-99		,47		,47		,47		,47		,47		,-99		,47		,47		,47		,-99		,-99		,47		,47		,47		,47		,-99		,47		,-99		,47		,47		,-99		,47		,-99		,-99		,47		,-99		,47		,47		,-99		,-99		,47		,47		,47		,-99		,47		,-99		,47		,47		,47		,-99		,47		,-99		,47		,47		,-99		,-99		,47		,47		,47		,47		,47		,-99		,-99		,47		,-99		,-99		,47		,47		,47		,-99		,47		,47		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,78		,-99		,-99		,-99		,-99		,-99		,78		,-99		,78		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,78		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,77		,-99		,-99		,78		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,78		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,78	},
-	{91		,-99		,-99		,91		,91		,-99		,91		,-99		,91		,-99		,-99		,91		,91		,91		,-99		,-99		,-99		,91		,-99		,-99		,91		,-99		,91		,91		,91		,91		,91		,91		,91		,-99		,-99		,91		,-99		,-99		,-99		,91		,-99		,-99		,91		,-99		,91		,-99		,91		,91		,91		,-99		,91		,-99		,-99		,-99		,91		,91		,-99		,-99		,-99		,-99		,91		,-99		,-99		,91		,91		,91		,-99		,91		,-99		,91		,91		,91		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,51		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,135		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{36		,-99		,15		,-99		,-99		,-99		,-99		,17		,39		,-99		,-99		,23		,29		,-99		,-99		,19		,12		,28		,-99		,-99		,27		,-99		,31		,24		,-99		,-99		,-99		,-99		,21		,-99		,-99		,33		,-99		,-99		,13		,38		,14		,-99		,32		,-99		,37		,20		,41		,-99		,22		,-99		,34		,-99		,-99		,-99		,35		,30		,11		,-99		,-99		,-99		,-99		,18		,-99		,-99		,26		,40		,-99		,-99		,16		,25		,-99		,-99		,-99	},
-	{7		,9		,7		,-99		,6		,-99		,6		,7		,7		,-99		,-99		,7		,7		,-99		,-99		,7		,7		,7		,3		,-99		,7		,-99		,7		,7		,-99		,6		,-99		,-99		,7		,-99		,-99		,7		,-99		,-99		,7		,7		,7		,-99		,7		,-99		,7		,7		,7		,-99		,7		,-99		,7		,8		,-99		,-99		,7		,7		,7		,5		,2		,-99		,-99		,7		,-99		,-99		,7		,7		,4		,-99		,7		,7		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,60		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,72		,-99		,-99		,-99		,-99		,-99		,71		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,72		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,72		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,72		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,72	},
-	{67		,-99		,-99		,67		,67		,-99		,67		,-99		,67		,-99		,-99		,67		,67		,67		,-99		,-99		,-99		,67		,-99		,-99		,67		,-99		,67		,67		,67		,67		,67		,67		,67		,-99		,-99		,67		,-99		,-99		,-99		,67		,-99		,-99		,67		,-99		,67		,-99		,67		,67		,67		,-99		,67		,-99		,-99		,-99		,67		,67		,-99		,-99		,-99		,-99		,67		,-99		,-99		,67		,67		,67		,-99		,67		,-99		,67		,67		,67		,-99	},
-	{85		,-99		,-99		,85		,85		,-99		,85		,-99		,85		,-99		,-99		,85		,85		,85		,-99		,-99		,-99		,85		,-99		,-99		,85		,-99		,85		,85		,85		,85		,85		,85		,85		,-99		,-99		,85		,-99		,-99		,-99		,85		,-99		,-99		,85		,-99		,85		,-99		,85		,85		,85		,-99		,85		,-99		,-99		,-99		,85		,85		,-99		,-99		,-99		,-99		,85		,-99		,-99		,85		,85		,85		,-99		,85		,-99		,85		,85		,85		,-99	},
-	{94		,-99		,-99		,94		,94		,-99		,94		,-99		,94		,-99		,-99		,94		,94		,94		,-99		,-99		,-99		,94		,-99		,-99		,94		,-99		,94		,94		,94		,94		,94		,94		,94		,-99		,-99		,94		,-99		,-99		,-99		,94		,-99		,-99		,94		,-99		,94		,-99		,94		,94		,94		,-99		,94		,-99		,-99		,-99		,94		,94		,-99		,-99		,-99		,-99		,94		,-99		,-99		,94		,94		,94		,-99		,94		,-99		,94		,94		,94		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,61		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,10		,-99		,10		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,134		,-99		,133		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,132		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,63		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,63		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{73		,-99		,-99		,73		,73		,-99		,73		,-99		,73		,-99		,-99		,73		,73		,73		,-99		,-99		,-99		,73		,-99		,-99		,73		,-99		,73		,73		,73		,73		,73		,73		,73		,-99		,-99		,73		,-99		,-99		,-99		,73		,-99		,-99		,73		,-99		,73		,-99		,73		,73		,73		,-99		,73		,-99		,-99		,-99		,73		,73		,-99		,-99		,-99		,-99		,73		,-99		,-99		,73		,73		,73		,-99		,73		,-99		,73		,73		,73		,-99	},
-	{50		,50		,50		,-99		,50		,50		,50		,50		,50		,-99		,-99		,50		,50		,-99		,-99		,50		,50		,50		,50		,-99		,50		,-99		,50		,50		,-99		,50		,-99		,-99		,50		,-99		,50		,50		,-99		,-99		,50		,50		,50		,-99		,50		,-99		,50		,50		,50		,-99		,50		,-99		,50		,50		,-99		,-99		,50		,50		,50		,50		,50		,-99		,-99		,50		,-99		,-99		,50		,50		,50		,-99		,50		,50		,-99		,-99		,-99	},
-	{49		,49		,49		,-99		,49		,49		,49		,49		,49		,-99		,48		,49		,49		,-99		,-99		,49		,49		,49		,49		,-99		,49		,-99		,49		,49		,-99		,49		,-99		,-99		,49		,-99		,49		,49		,-99		,-99		,49		,49		,49		,-99		,49		,-99		,49		,49		,49		,-99		,49		,-99		,49		,49		,-99		,-99		,49		,49		,49		,49		,49		,-99		,-99		,49		,-99		,-99		,49		,49		,49		,-99		,49		,49		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,44		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,59		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,62		,-99		,-99		,-99		,-99		,-99		,-99		,58		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{64		,-99		,-99		,64		,64		,-99		,64		,-99		,64		,-99		,-99		,64		,64		,64		,-99		,-99		,-99		,64		,-99		,-99		,64		,-99		,64		,64		,64		,64		,64		,64		,64		,-99		,-99		,64		,-99		,-99		,-99		,64		,-99		,-99		,64		,-99		,64		,-99		,64		,64		,64		,-99		,64		,-99		,-99		,-99		,64		,64		,-99		,-99		,-99		,-99		,64		,-99		,-99		,64		,64		,64		,-99		,64		,-99		,64		,64		,64		,-99	}
+	{-99		,95		,-99		,-99		,-99		,-99		,95		,95		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,95		,-99		,-99		,95		,-99		,-99		,-99		,95		,-99		,-99		,-99		,-99		,-99		,95		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,95		,-99		,-99		,-99		,-99		,95		,-99		,-99		,-99		,-99		,-99		,-99		,94		,95		,-99		,-99		,95		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,0		,0		,0		,0		,-99		,-99		,-99		,-99		,-99		,-99		,0		,1		,0		,0		,-99		,-99		,-99		,-99		,0		,0		,-99		,-99		,-99		,0		,0		,0		,0		,-99		,-99		,0		,1		,0		,0		,-99		,0		,0		,0		,0		,0		,-99		,0		,-99		,0		,-99		,0		,0		,-99		,0		,-99		,0		,0		,0		,0		,0		,0		,-99		,-99		,0		,0		,-99		,0		,0		,0		,0		,0		,-99		,0		,0		,0		,0		,0		,0	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,49		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,145		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,140		,-99		,-99		,-99		,-99		,140		,140		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,140		,140		,-99		,140		,-99		,-99		,-99		,140		,-99		,-99		,-99		,-99		,-99		,140		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,140		,-99		,-99		,-99		,-99		,140		,-99		,-99		,-99		,-99		,-99		,-99		,140		,140		,-99		,-99		,140		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,48		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,47		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,58		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,51		,51		,51		,51		,-99		,-99		,-99		,-99		,-99		,-99		,51		,51		,51		,51		,-99		,-99		,-99		,-99		,51		,51		,-99		,-99		,-99		,51		,51		,51		,51		,-99		,-99		,51		,51		,51		,51		,51		,51		,51		,51		,51		,51		,50		,51		,-99		,51		,-99		,51		,51		,-99		,51		,-99		,51		,51		,51		,51		,51		,51		,-99		,-99		,51		,51		,-99		,51		,51		,51		,51		,51		,-99		,51		,51		,51		,51		,51		,51	},
+	{-99		,-99		,-99		,16		,41		,44		,-99		,-99		,-99		,-99		,-99		,-99		,20		,-99		,34		,30		,-99		,-99		,-99		,-99		,-99		,12		,-99		,-99		,-99		,24		,38		,18		,-99		,-99		,-99		,40		,-99		,19		,37		,-99		,32		,42		,15		,-99		,-99		,-99		,39		,-99		,-99		,-99		,21		,26		,-99		,46		,-99		,27		,-99		,36		,13		,23		,33		,-99		,-99		,-99		,45		,-99		,22		,28		,35		,43		,11		,-99		,31		,29		,17		,25		,14		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,64		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,67		,63		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,83		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,83		,-99		,-99		,83		,-99		,-99		,-99		,83		,-99		,-99		,-99		,-99		,-99		,83		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,83		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,82		,-99		,-99		,83		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,80		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,79		,-99		,-99		,80		,-99		,-99		,-99		,80		,-99		,-99		,-99		,-99		,-99		,80		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,80		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,80		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,61		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,78		,78		,78		,78		,-99		,78		,78		,78		,-99		,-99		,78		,78		,-99		,-99		,78		,-99		,-99		,-99		,78		,-99		,-99		,78		,78		,-99		,78		,-99		,-99		,78		,-99		,-99		,78		,-99		,78		,78		,-99		,78		,-99		,-99		,78		,78		,78		,78		,78		,78		,78		,78		,78		,78		,-99		,78		,-99		,78		,78		,-99		,-99		,-99		,78		,-99		,78		,78		,78		,78		,-99		,-99		,78		,78		,-99		,78		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,81		,81		,81		,81		,-99		,81		,81		,81		,-99		,-99		,81		,81		,-99		,-99		,81		,-99		,-99		,-99		,81		,-99		,-99		,81		,81		,-99		,81		,-99		,-99		,81		,-99		,-99		,81		,-99		,81		,81		,-99		,81		,-99		,-99		,81		,81		,81		,81		,81		,81		,81		,81		,81		,81		,-99		,81		,-99		,81		,81		,-99		,-99		,-99		,81		,-99		,81		,81		,81		,81		,-99		,-99		,81		,81		,-99		,81		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,93		,93		,93		,93		,-99		,93		,93		,93		,-99		,-99		,93		,93		,-99		,-99		,93		,-99		,-99		,-99		,93		,-99		,-99		,93		,93		,-99		,93		,-99		,-99		,93		,-99		,-99		,93		,-99		,93		,93		,-99		,93		,-99		,-99		,93		,93		,93		,93		,93		,93		,93		,93		,93		,93		,-99		,93		,-99		,93		,93		,-99		,-99		,-99		,93		,-99		,93		,93		,93		,93		,-99		,-99		,93		,93		,-99		,93		,-99		,-99	},
+	{-99		,-99		,9		,7		,7		,7		,-99		,-99		,-99		,-99		,-99		,-99		,7		,-99		,7		,7		,-99		,-99		,-99		,-99		,8		,7		,-99		,-99		,-99		,7		,7		,7		,6		,-99		,-99		,7		,-99		,7		,7		,-99		,7		,7		,7		,6		,2		,-99		,7		,-99		,6		,-99		,7		,7		,-99		,7		,-99		,7		,3		,7		,7		,7		,7		,-99		,-99		,5		,7		,-99		,7		,7		,7		,7		,7		,-99		,7		,7		,7		,7		,7		,4	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,65		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,75		,75		,75		,75		,-99		,75		,75		,75		,-99		,-99		,75		,75		,-99		,-99		,75		,-99		,-99		,-99		,75		,-99		,-99		,75		,75		,-99		,75		,-99		,-99		,75		,-99		,-99		,75		,-99		,75		,75		,-99		,75		,-99		,-99		,75		,75		,75		,75		,75		,75		,75		,75		,75		,75		,-99		,75		,-99		,75		,75		,-99		,-99		,-99		,75		,-99		,75		,75		,75		,75		,-99		,-99		,75		,75		,-99		,75		,-99		,-99	},
+	{-99		,-99		,55		,55		,55		,55		,-99		,-99		,-99		,-99		,-99		,-99		,55		,55		,55		,55		,-99		,-99		,-99		,-99		,55		,55		,-99		,-99		,-99		,55		,55		,55		,55		,-99		,-99		,55		,55		,55		,55		,-99		,55		,55		,55		,55		,55		,-99		,55		,-99		,55		,-99		,55		,55		,-99		,55		,-99		,55		,55		,55		,55		,55		,55		,-99		,-99		,55		,55		,-99		,55		,55		,55		,55		,55		,-99		,55		,55		,55		,55		,55		,55	},
+	{-99		,92		,-99		,-99		,-99		,-99		,92		,92		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,92		,-99		,-99		,92		,-99		,-99		,-99		,92		,-99		,-99		,-99		,-99		,-99		,92		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,91		,-99		,-99		,-99		,-99		,92		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,92		,-99		,-99		,92		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,84		,84		,84		,84		,-99		,84		,84		,84		,-99		,-99		,84		,84		,-99		,-99		,84		,-99		,-99		,-99		,84		,-99		,-99		,84		,84		,-99		,84		,-99		,-99		,84		,-99		,-99		,84		,-99		,84		,84		,-99		,84		,-99		,-99		,84		,84		,84		,84		,84		,84		,84		,84		,84		,84		,-99		,84		,-99		,84		,84		,-99		,-99		,-99		,84		,-99		,84		,84		,84		,84		,-99		,-99		,84		,84		,-99		,84		,-99		,-99	},
+	{-99		,-99		,54		,54		,54		,54		,-99		,-99		,-99		,-99		,-99		,-99		,54		,54		,54		,54		,-99		,-99		,-99		,-99		,54		,54		,-99		,-99		,-99		,54		,54		,54		,54		,-99		,-99		,54		,54		,54		,54		,53		,54		,54		,54		,54		,54		,-99		,54		,-99		,54		,-99		,54		,54		,-99		,54		,-99		,54		,54		,54		,54		,54		,54		,-99		,-99		,54		,54		,-99		,54		,54		,54		,54		,54		,-99		,54		,54		,54		,54		,54		,54	},
+	{-99		,86		,-99		,-99		,-99		,-99		,85		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,86		,-99		,-99		,86		,-99		,-99		,-99		,86		,-99		,-99		,-99		,-99		,-99		,86		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,86		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,86		,-99		,-99		,86		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,96		,96		,96		,96		,-99		,96		,96		,96		,-99		,-99		,96		,96		,-99		,-99		,96		,-99		,-99		,-99		,96		,-99		,-99		,96		,96		,-99		,96		,-99		,-99		,96		,-99		,-99		,96		,-99		,96		,96		,-99		,96		,-99		,-99		,96		,96		,96		,96		,96		,96		,96		,96		,96		,96		,-99		,96		,-99		,96		,96		,-99		,-99		,-99		,96		,-99		,96		,96		,96		,96		,-99		,-99		,96		,96		,-99		,96		,-99		,-99	},
+	{-99		,60		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,59		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,59		,-99		,-99		,-99		,-99		,59		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,66		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,99		,99		,99		,99		,-99		,99		,99		,99		,-99		,-99		,99		,99		,-99		,-99		,99		,-99		,-99		,-99		,99		,-99		,-99		,99		,99		,-99		,99		,-99		,-99		,99		,-99		,-99		,99		,-99		,99		,99		,-99		,99		,-99		,-99		,99		,99		,99		,99		,99		,99		,99		,99		,99		,99		,-99		,99		,-99		,99		,99		,-99		,-99		,-99		,99		,-99		,99		,99		,99		,99		,-99		,-99		,99		,99		,-99		,99		,-99		,-99	},
+	{-99		,68		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,68		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,87		,87		,87		,87		,-99		,87		,87		,87		,-99		,-99		,87		,87		,-99		,-99		,87		,-99		,-99		,-99		,87		,-99		,-99		,87		,87		,-99		,87		,-99		,-99		,87		,-99		,-99		,87		,-99		,87		,87		,-99		,87		,-99		,-99		,87		,87		,87		,87		,87		,87		,87		,87		,87		,87		,-99		,87		,-99		,87		,87		,-99		,-99		,-99		,87		,-99		,87		,87		,87		,87		,-99		,-99		,87		,87		,-99		,87		,-99		,-99	},
+	{-99		,74		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,73		,-99		,-99		,-99		,74		,-99		,-99		,-99		,-99		,-99		,74		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,74		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,77		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,77		,-99		,-99		,-99		,77		,-99		,-99		,-99		,-99		,-99		,77		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,76		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,77		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,-99		,-99		,-99		,10		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,69		,69		,69		,69		,-99		,69		,69		,69		,-99		,-99		,69		,69		,-99		,-99		,69		,-99		,-99		,-99		,69		,-99		,-99		,69		,69		,-99		,69		,-99		,-99		,69		,-99		,-99		,69		,-99		,69		,69		,-99		,69		,-99		,-99		,69		,69		,69		,69		,69		,69		,69		,69		,69		,69		,-99		,69		,-99		,69		,69		,-99		,-99		,-99		,69		,-99		,69		,69		,69		,69		,-99		,-99		,69		,69		,-99		,69		,-99		,-99	},
+	{-99		,89		,-99		,-99		,-99		,-99		,89		,88		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,89		,-99		,-99		,89		,-99		,-99		,-99		,89		,-99		,-99		,-99		,-99		,-99		,89		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,89		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,89		,-99		,-99		,89		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,144		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,142		,-99		,-99		,-99		,-99		,143		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,57	},
+	{-99		,-99		,52		,52		,52		,52		,-99		,-99		,-99		,-99		,-99		,-99		,52		,52		,52		,52		,-99		,-99		,-99		,-99		,52		,52		,-99		,-99		,-99		,52		,52		,52		,52		,-99		,-99		,52		,52		,52		,52		,52		,52		,52		,52		,52		,52		,-99		,52		,-99		,52		,-99		,52		,52		,-99		,52		,-99		,52		,52		,52		,52		,52		,52		,-99		,-99		,52		,52		,-99		,52		,52		,52		,52		,52		,-99		,52		,52		,52		,52		,52		,52	},
+	{-99		,-99		,-99		,-99		,120		,123		,136		,135		,-99		,137		,131		,132		,-99		,-99		,113		,109		,-99		,-99		,133		,-99		,-99		,-99		,130		,-99		,-99		,103		,117		,-99		,127		,-99		,-99		,119		,-99		,-99		,116		,-99		,111		,121		,-99		,129		,-99		,-99		,118		,134		,128		,138		,100		,105		,126		,125		,139		,106		,-99		,115		,-99		,102		,112		,-99		,-99		,-99		,124		,-99		,101		,107		,114		,122		,-99		,-99		,110		,108		,-99		,104		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,62		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,62		,-99		,-99		,-99		,-99		,62		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,72		,72		,72		,72		,-99		,72		,72		,72		,-99		,-99		,72		,72		,-99		,-99		,72		,-99		,-99		,-99		,72		,-99		,-99		,72		,72		,-99		,72		,-99		,-99		,72		,-99		,-99		,72		,-99		,72		,72		,-99		,72		,-99		,-99		,72		,72		,72		,72		,72		,72		,72		,72		,72		,72		,-99		,72		,-99		,72		,72		,-99		,-99		,-99		,72		,-99		,72		,72		,72		,72		,-99		,-99		,72		,72		,-99		,72		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,141		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,90		,90		,90		,90		,-99		,90		,90		,90		,-99		,-99		,90		,90		,-99		,-99		,90		,-99		,-99		,-99		,90		,-99		,-99		,90		,90		,-99		,90		,-99		,-99		,90		,-99		,-99		,90		,-99		,90		,90		,-99		,90		,-99		,-99		,90		,90		,90		,90		,90		,90		,90		,90		,90		,90		,-99		,90		,-99		,90		,90		,-99		,-99		,-99		,90		,-99		,90		,90		,90		,90		,-99		,-99		,90		,90		,-99		,90		,-99		,-99	},
+	{-99		,98		,-99		,-99		,-99		,-99		,98		,98		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,98		,97		,-99		,98		,-99		,-99		,-99		,98		,-99		,-99		,-99		,-99		,-99		,98		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,98		,-99		,-99		,-99		,-99		,98		,-99		,-99		,-99		,-99		,-99		,-99		,98		,98		,-99		,-99		,98		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,56		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,71		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,71		,-99		,-99		,-99		,-99		,-99		,70		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,71		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	}
 };
 const char* KeywordList[]= {
 "print",
@@ -617,7 +652,12 @@ const char* KeywordList[]= {
 "eq",
 "interlocked_exchange",
 "interlocked_exchange_add",
+"map_count",
+"map_hist",
 "interlocked_compare_exchange",
+"map_sum",
+"map_min",
+"map_max",
 "poi",
 "db",
 "dd",
@@ -638,7 +678,12 @@ const char* KeywordList[]= {
 "eq",
 "interlocked_exchange",
 "interlocked_exchange_add",
-"interlocked_compare_exchange"
+"map_count",
+"map_hist",
+"interlocked_compare_exchange",
+"map_sum",
+"map_min",
+"map_max"
 };
 const char* OperatorsTwoOperandList[]= {
 "@OR",
@@ -665,7 +710,10 @@ const char* OperatorsOneOperandList[]= {
 "@DEREFERENCE"
 };
 const char* ThreeOpFunc1[] = {
-"@INTERLOCKED_COMPARE_EXCHANGE"
+"@INTERLOCKED_COMPARE_EXCHANGE",
+"@MAP_SUM",
+"@MAP_MIN",
+"@MAP_MAX",
 };
 const char* TwoOpFunc1[] = {
 "@ED",
@@ -673,6 +721,8 @@ const char* TwoOpFunc1[] = {
 "@EQ",
 "@INTERLOCKED_EXCHANGE",
 "@INTERLOCKED_EXCHANGE_ADD",
+"@MAP_COUNT",
+"@MAP_HIST",
 };
 const char* TwoOpFunc2[] = {
 "@SPINLOCK_LOCK_CUSTOM_WAIT"
@@ -779,7 +829,12 @@ const SYMBOL_MAP SemanticRulesMapList[]= {
 {"@EQ", FUNC_EQ},
 {"@INTERLOCKED_EXCHANGE", FUNC_INTERLOCKED_EXCHANGE},
 {"@INTERLOCKED_EXCHANGE_ADD", FUNC_INTERLOCKED_EXCHANGE_ADD},
+{"@MAP_COUNT", FUNC_MAP_COUNT},
+{"@MAP_HIST", FUNC_MAP_HIST},
 {"@INTERLOCKED_COMPARE_EXCHANGE", FUNC_INTERLOCKED_COMPARE_EXCHANGE},
+{"@MAP_SUM", FUNC_MAP_SUM},
+{"@MAP_MIN", FUNC_MAP_MIN},
+{"@MAP_MAX", FUNC_MAP_MAX},
 {"@POI", FUNC_POI},
 {"@DB", FUNC_DB},
 {"@DD", FUNC_DD},
@@ -800,7 +855,12 @@ const SYMBOL_MAP SemanticRulesMapList[]= {
 {"@EQ", FUNC_EQ},
 {"@INTERLOCKED_EXCHANGE", FUNC_INTERLOCKED_EXCHANGE},
 {"@INTERLOCKED_EXCHANGE_ADD", FUNC_INTERLOCKED_EXCHANGE_ADD},
+{"@MAP_COUNT", FUNC_MAP_COUNT},
+{"@MAP_HIST", FUNC_MAP_HIST},
 {"@INTERLOCKED_COMPARE_EXCHANGE", FUNC_INTERLOCKED_COMPARE_EXCHANGE},
+{"@MAP_SUM", FUNC_MAP_SUM},
+{"@MAP_MIN", FUNC_MAP_MIN},
+{"@MAP_MAX", FUNC_MAP_MAX},
 };
 const SYMBOL_MAP RegisterMapList[]= {
 {"rax", REGISTER_RAX},
@@ -1016,6 +1076,11 @@ const struct _TOKEN LalrLhs[RULES_COUNT]=
 	{NON_TERMINAL, "E12"},
 	{NON_TERMINAL, "E12"},
 	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
+	{NON_TERMINAL, "E12"},
 	{NON_TERMINAL, "E13"}
 };
 const struct _TOKEN LalrRhs[RULES_COUNT][MAX_RHS_LEN]= 
@@ -1082,7 +1147,12 @@ const struct _TOKEN LalrRhs[RULES_COUNT][MAX_RHS_LEN]=
 	{{KEYWORD, "eq"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@EQ"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "interlocked_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "interlocked_exchange_add"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_EXCHANGE_ADD"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_count"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_COUNT"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_hist"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_HIST"},{SPECIAL_TOKEN, ")"}},
 	{{KEYWORD, "interlocked_compare_exchange"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@INTERLOCKED_COMPARE_EXCHANGE"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_sum"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_SUM"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_min"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_MIN"},{SPECIAL_TOKEN, ")"}},
+	{{KEYWORD, "map_max"},{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SPECIAL_TOKEN, ","},{NON_TERMINAL, "EXPRESSION"},{SEMANTIC_RULE, "@MAP_MAX"},{SPECIAL_TOKEN, ")"}},
 	{{SPECIAL_TOKEN, "("},{NON_TERMINAL, "EXP"},{SPECIAL_TOKEN, ")"}},
 	{{REGISTER, "_register"},{SEMANTIC_RULE, "@PUSH"}},
 	{{GLOBAL_ID, "_global_id"},{SEMANTIC_RULE, "@PUSH"}},
@@ -1163,6 +1233,11 @@ const unsigned int LalrRhsSize[RULES_COUNT]=
 7,
 7,
 7,
+7,
+7,
+9,
+9,
+9,
 9,
 3,
 2,
@@ -1182,208 +1257,249 @@ const unsigned int LalrRhsSize[RULES_COUNT]=
 };
 const char* LalrNoneTerminalMap[NONETERMINAL_COUNT]= 
 {
-"E5'",
-"E7'",
-"E6",
-"E5",
-"E2",
-"B1",
-"E13",
 "E8'",
-"E12",
-"CMP",
 "S",
-"E0'",
-"E9'",
-"E1'",
+"E13",
+"B2'",
+"E4'",
 "E3'",
-"E6'",
-"EXP",
+"E3",
+"B1'",
 "E4",
+"E8",
+"E2",
+"E7'",
+"E5",
+"E5'",
 "E9",
-"E4'",
-"BE",
-"B2'",
 "B3",
+"E9'",
+"B1",
+"E10",
+"E6",
+"E1'",
+"CMP",
 "E2'",
+"EXP",
+"E6'",
+"BE",
+"E12",
 "E1",
 "E7",
-"E10",
 "B2",
-"E3",
-"E8",
-"B1'"
+"E0'"
 };
 const char* LalrTerminalMap[TERMINAL_COUNT]= 
 {
-"ed",
 "+",
-"_register",
-"==",
-"_local_id",
-"interlocked_exchange",
-"%",
-"/",
-"dd",
-"*",
-"not",
 "<=",
-"<",
-"low",
-"hi",
-"dw",
-"(",
-"_global_id",
+"map_count",
+"map_sum",
+"-",
+"~",
+"_decimal",
 "_octal",
-"&",
+"<",
+"_binary",
 ">>",
-"poi",
-"$",
+"%",
+"||",
+"^",
+"_hex",
+")",
+">",
+"dw",
 "eq",
-">=",
-",",
+"_register",
+"|",
+"interlocked_exchange_add",
+"$",
 "eb",
-"interlocked_compare_exchange",
-"~",
-"db",
-"<<",
-"!=",
+"map_hist",
+"_global_id",
+">=",
+"interlocked_exchange",
 "_pseudo_register",
-")",
-"_binary",
-">",
-"^",
-"_hex",
+"_local_id",
+"==",
+"*",
+"poi",
 "neg",
-"-",
-"interlocked_exchange_add",
+"(",
+"&",
+"map_max",
+"hi",
+"ed",
+"!=",
+"dd",
+"/",
+"<<",
+"map_min",
+"db",
+",",
+"low",
+"interlocked_compare_exchange",
+"not",
 "dq",
-"_decimal",
-"||",
-"&&",
-"|"
+"&&"
 };
 const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]= 
 {
-	{-99		,-99		,13		,12		,9		,3		,-99		,-99		,18		,6		,1		,-99		,-99		,-99		,-99		,-99		,7		,11		,16		,-99		,2		,-99		,5		,-99		,8		,14		,17		,4		,10		,15		,-99	},
+	{-99		,1		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,5		,-99		,3		,17		,13		,-99		,6		,-99		,7		,-99		,2		,18		,8		,14		,4		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,53		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,55		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,63	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,65		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,67		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,69		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,71		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,73		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,75		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,77		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{79		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,81		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,91		,-99		,92		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,97		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,48	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,50		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,102		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,58		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,60		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,62		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,64		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,66		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{68		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,70		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,72		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,74		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,76		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,79		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,81		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,106		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,108		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,109		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,5		,-99		,-99		,17		,13		,-99		,6		,-99		,7		,-99		,-99		,18		,8		,14		,111		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,112		,-99		,-99		,17		,13		,-99		,6		,-99		,7		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,113		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,114		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,115		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,116		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,117		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,118		,-99		,-99		,18		,8		,14		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,-99		,-99		,-99		,18		,119		,14		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,120		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,-99		,-99		,-99		,18		,-99		,14		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,121		,-99		,11		,15		,-99		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,-99		,-99		,-99		,18		,-99		,14		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,122		,15		,-99		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,-99		,-99		,-99		,18		,-99		,14		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,15		,-99		,-99		,123		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,-99		,-99		,-99		,18		,-99		,14		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,15		,-99		,-99		,-99		,-99		,16		,-99		,-99		,-99		,17		,124		,-99		,-99		,-99		,-99		,-99		,-99		,18		,-99		,14		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,87		,-99		,-99		,-99		,-99		,-99		,-99		,88		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,15		,-99		,-99		,-99		,-99		,16		,-99		,-99		,-99		,17		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,18		,-99		,125		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,126		,-99		,-99		,-99		,-99		,16		,-99		,-99		,-99		,17		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,127		,-99		,-99		,-99		,17		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,128		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,129		,-99		,-99		,18		,8		,14		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,131		,-99		,-99		,18		,8		,14		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,93		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,95		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,96		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,136		,-99		,-99		,18		,8		,14		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,140		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,143		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,144		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,145		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,147		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,148		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,149		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,150		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,10		,-99		,11		,15		,9		,-99		,12		,-99		,16		,-99		,-99		,-99		,17		,13		,-99		,-99		,-99		,151		,-99		,-99		,18		,8		,14		,-99		,-99	},
+	{-99		,-99		,152		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,154		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,155		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,157		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,158		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,159	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,160		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,161		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,162		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,163		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,164		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,165		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,166		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{167		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,168		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,6		,-99		,-99		,-99		,-99		,-99		,-99		,7		,11		,16		,-99		,-99		,-99		,5		,-99		,8		,14		,17		,101		,10		,15		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,6		,-99		,-99		,-99		,-99		,-99		,-99		,7		,11		,16		,-99		,-99		,-99		,102		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,103		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,104		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,105		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,106		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,107		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,108		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,11		,16		,-99		,-99		,-99		,-99		,-99		,109		,14		,17		,-99		,10		,15		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,12		,110		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,11		,16		,-99		,-99		,-99		,-99		,-99		,-99		,14		,17		,-99		,10		,15		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,12		,-99		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,11		,16		,-99		,-99		,-99		,-99		,-99		,-99		,14		,17		,-99		,111		,15		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,12		,-99		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,112		,16		,-99		,-99		,-99		,-99		,-99		,-99		,14		,17		,-99		,-99		,15		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,113		,-99		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,16		,-99		,-99		,-99		,-99		,-99		,-99		,14		,17		,-99		,-99		,15		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,114		,-99		,-99		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,16		,-99		,-99		,-99		,-99		,-99		,-99		,14		,17		,-99		,-99		,15		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,16		,-99		,-99		,-99		,-99		,-99		,-99		,115		,17		,-99		,-99		,15		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,16		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,17		,-99		,-99		,116		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,117		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,17		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,118		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,120		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,121		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,122		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,124		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,125		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,126		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,131		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,132		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,133		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,134		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,135		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,136		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,137		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,138		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,13		,12		,9		,-99		,-99		,-99		,18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,140		,11		,16		,-99		,-99		,-99		,-99		,-99		,8		,14		,17		,-99		,10		,15		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,142	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,143		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,144		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,145		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,146		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,147		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,148		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{149		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,150		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,151		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,152		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,153		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
 	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
@@ -1451,189 +1567,225 @@ const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT]=
 };
 const int LalrActionTable[LALR_STATE_COUNT][LALR_TERMINAL_COUNT]= 
 {
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,33		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-1		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-2		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-5		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,49		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-8		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,51		,-8		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-9		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-9		,-9		,-99	},
-	{-99		,-99		,-99		,55		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,56		,54		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-10		,-99		,53		,-99		,-99		,-99		,-99		,-99		,-99		,57		,-99		,-99		,-99		,52		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-10		,-10		,-99	},
-	{-99		,-99		,-99		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-20		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-20		,-99		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-20		,-99		,-20		,-99		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-20		,-20		,59	},
-	{-99		,-99		,-99		,-23		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-23		,-23		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-23		,-99		,-23		,-99		,-99		,-99		,-99		,-99		,-99		,-23		,-99		,-23		,-99		,-23		,61		,-99		,-99		,-99		,-99		,-99		,-99		,-23		,-23		,-23	},
-	{-99		,-99		,-99		,-26		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-26		,-26		,-99		,-99		,-99		,-99		,-99		,-99		,63		,-99		,-99		,-26		,-99		,-26		,-99		,-99		,-99		,-99		,-99		,-99		,-26		,-99		,-26		,-99		,-26		,-26		,-99		,-99		,-99		,-99		,-99		,-99		,-26		,-26		,-26	},
-	{-99		,-99		,-99		,-29		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-29		,-29		,-99		,-99		,-99		,-99		,-99		,-99		,-29		,65		,-99		,-29		,-99		,-29		,-99		,-99		,-99		,-99		,-99		,-99		,-29		,-99		,-29		,-99		,-29		,-29		,-99		,-99		,-99		,-99		,-99		,-99		,-29		,-29		,-29	},
-	{-99		,-99		,-99		,-32		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-32		,-32		,-99		,-99		,-99		,-99		,-99		,-99		,-32		,-32		,-99		,-32		,-99		,-32		,-99		,-99		,-99		,-99		,-99		,67		,-32		,-99		,-32		,-99		,-32		,-32		,-99		,-99		,-99		,-99		,-99		,-99		,-32		,-32		,-32	},
-	{-99		,69		,-99		,-35		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-35		,-35		,-99		,-99		,-99		,-99		,-99		,-99		,-35		,-35		,-99		,-35		,-99		,-35		,-99		,-99		,-99		,-99		,-99		,-35		,-35		,-99		,-35		,-99		,-35		,-35		,-99		,-99		,-99		,-99		,-99		,-99		,-35		,-35		,-35	},
-	{-99		,-38		,-99		,-38		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-38		,-38		,-99		,-99		,-99		,-99		,-99		,-99		,-38		,-38		,-99		,-38		,-99		,-38		,-99		,-99		,-99		,-99		,-99		,-38		,-38		,-99		,-38		,-99		,-38		,-38		,-99		,-99		,71		,-99		,-99		,-99		,-38		,-38		,-38	},
-	{-99		,-41		,-99		,-41		,-99		,-99		,-99		,-99		,-99		,73		,-99		,-41		,-41		,-99		,-99		,-99		,-99		,-99		,-99		,-41		,-41		,-99		,-41		,-99		,-41		,-99		,-99		,-99		,-99		,-99		,-41		,-41		,-99		,-41		,-99		,-41		,-41		,-99		,-99		,-41		,-99		,-99		,-99		,-41		,-41		,-41	},
-	{-99		,-44		,-99		,-44		,-99		,-99		,-99		,75		,-99		,-44		,-99		,-44		,-44		,-99		,-99		,-99		,-99		,-99		,-99		,-44		,-44		,-99		,-44		,-99		,-44		,-99		,-99		,-99		,-99		,-99		,-44		,-44		,-99		,-44		,-99		,-44		,-44		,-99		,-99		,-44		,-99		,-99		,-99		,-44		,-44		,-44	},
-	{-99		,-47		,-99		,-47		,-99		,-99		,77		,-47		,-99		,-47		,-99		,-47		,-47		,-99		,-99		,-99		,-99		,-99		,-99		,-47		,-47		,-99		,-47		,-99		,-47		,-99		,-99		,-99		,-99		,-99		,-47		,-47		,-99		,-47		,-99		,-47		,-47		,-99		,-99		,-47		,-99		,-99		,-99		,-47		,-47		,-47	},
-	{-99		,-48		,-99		,-48		,-99		,-99		,-48		,-48		,-99		,-48		,-99		,-48		,-48		,-99		,-99		,-99		,-99		,-99		,-99		,-48		,-48		,-99		,-48		,-99		,-48		,-99		,-99		,-99		,-99		,-99		,-48		,-48		,-99		,-48		,-99		,-48		,-48		,-99		,-99		,-48		,-99		,-99		,-99		,-48		,-48		,-48	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,78		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,82		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,83		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-70		,-99		,-70		,-99		,-99		,-70		,-70		,-99		,-70		,-99		,-70		,-70		,-99		,-99		,-99		,-99		,-99		,-99		,-70		,-70		,-99		,-70		,-99		,-70		,-99		,-99		,-99		,-99		,-99		,-70		,-70		,-99		,-70		,-99		,-70		,-70		,-99		,-99		,-70		,-99		,-99		,-99		,-70		,-70		,-70	},
-	{-99		,-72		,-99		,-72		,-99		,-99		,-72		,-72		,-99		,-72		,-99		,-72		,-72		,-99		,-99		,-99		,-99		,-99		,-99		,-72		,-72		,-99		,-72		,-99		,-72		,-99		,-99		,-99		,-99		,-99		,-72		,-72		,-99		,-72		,-99		,-72		,-72		,-99		,-99		,-72		,-99		,-99		,-99		,-72		,-72		,-72	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,84		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,85		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,86		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-65		,-99		,-65		,-99		,-99		,-65		,-65		,-99		,-65		,-99		,-65		,-65		,-99		,-99		,-99		,-99		,-99		,-99		,-65		,-65		,-99		,-65		,-99		,-65		,-99		,-99		,-99		,-99		,-99		,-65		,-65		,-99		,-65		,-99		,-65		,-65		,-99		,-99		,-65		,-99		,-99		,-99		,-65		,-65		,-65	},
-	{-99		,-69		,-99		,-69		,-99		,-99		,-69		,-69		,-99		,-69		,-99		,-69		,-69		,-99		,-99		,-99		,-99		,-99		,-99		,-69		,-69		,-99		,-69		,-99		,-69		,-99		,-99		,-99		,-99		,-99		,-69		,-69		,-99		,-69		,-99		,-69		,-69		,-99		,-99		,-69		,-99		,-99		,-99		,-69		,-69		,-69	},
-	{-99		,-66		,-99		,-66		,-99		,-99		,-66		,-66		,-99		,-66		,-99		,-66		,-66		,-99		,-99		,-99		,-99		,-99		,-99		,-66		,-66		,-99		,-66		,-99		,-66		,-99		,-99		,-99		,-99		,-99		,-66		,-66		,-99		,-66		,-99		,-66		,-66		,-99		,-99		,-66		,-99		,-99		,-99		,-66		,-66		,-66	},
-	{-99		,-68		,-99		,-68		,-99		,-99		,-68		,-68		,-99		,-68		,-99		,-68		,-68		,-99		,-99		,-99		,-99		,-99		,-99		,-68		,-68		,-99		,-68		,-99		,-68		,-99		,-99		,-99		,-99		,-99		,-68		,-68		,-99		,-68		,-99		,-68		,-68		,-99		,-99		,-68		,-99		,-99		,-99		,-68		,-68		,-68	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,33		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,89		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-71		,-99		,-71		,-99		,-99		,-71		,-71		,-99		,-71		,-99		,-71		,-71		,-99		,-99		,-99		,-99		,-99		,-99		,-71		,-71		,-99		,-71		,-99		,-71		,-99		,-99		,-99		,-99		,-99		,-71		,-71		,-99		,-71		,-99		,-71		,-71		,-99		,-99		,-71		,-99		,-99		,-99		,-71		,-71		,-71	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,90		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,91		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,92		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-67		,-99		,-67		,-99		,-99		,-67		,-67		,-99		,-67		,-99		,-67		,-67		,-99		,-99		,-99		,-99		,-99		,-99		,-67		,-67		,-99		,-67		,-99		,-67		,-99		,-99		,-99		,-99		,-99		,-67		,-67		,-99		,-67		,-99		,-67		,-67		,-99		,-99		,-67		,-99		,-99		,-99		,-67		,-67		,-67	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,94		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,97		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,98		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,100		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-3		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,33		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-6		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-6		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,33		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-18		,-18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-18		,-99		,-18		,-99		,-99		,-99		,-99		,-99		,-99		,-18		,-99		,-18		,-99		,-18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-18		,-18		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-21		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-21		,-21		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-21		,-99		,-21		,-99		,-99		,-99		,-99		,-99		,-99		,-21		,-99		,-21		,-99		,-21		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-21		,-21		,-21	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-24		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-24		,-24		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-24		,-99		,-24		,-99		,-99		,-99		,-99		,-99		,-99		,-24		,-99		,-24		,-99		,-24		,-24		,-99		,-99		,-99		,-99		,-99		,-99		,-24		,-24		,-24	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-27		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-27		,-27		,-99		,-99		,-99		,-99		,-99		,-99		,-27		,-99		,-99		,-27		,-99		,-27		,-99		,-99		,-99		,-99		,-99		,-99		,-27		,-99		,-27		,-99		,-27		,-27		,-99		,-99		,-99		,-99		,-99		,-99		,-27		,-27		,-27	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-30		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-30		,-30		,-99		,-99		,-99		,-99		,-99		,-99		,-30		,-30		,-99		,-30		,-99		,-30		,-99		,-99		,-99		,-99		,-99		,-99		,-30		,-99		,-30		,-99		,-30		,-30		,-99		,-99		,-99		,-99		,-99		,-99		,-30		,-30		,-30	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-33		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-33		,-33		,-99		,-99		,-99		,-99		,-99		,-99		,-33		,-33		,-99		,-33		,-99		,-33		,-99		,-99		,-99		,-99		,-99		,-33		,-33		,-99		,-33		,-99		,-33		,-33		,-99		,-99		,-99		,-99		,-99		,-99		,-33		,-33		,-33	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-36		,-99		,-36		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-36		,-36		,-99		,-99		,-99		,-99		,-99		,-99		,-36		,-36		,-99		,-36		,-99		,-36		,-99		,-99		,-99		,-99		,-99		,-36		,-36		,-99		,-36		,-99		,-36		,-36		,-99		,-99		,-99		,-99		,-99		,-99		,-36		,-36		,-36	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-39		,-99		,-39		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-39		,-39		,-99		,-99		,-99		,-99		,-99		,-99		,-39		,-39		,-99		,-39		,-99		,-39		,-99		,-99		,-99		,-99		,-99		,-39		,-39		,-99		,-39		,-99		,-39		,-39		,-99		,-99		,-39		,-99		,-99		,-99		,-39		,-39		,-39	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-42		,-99		,-42		,-99		,-99		,-99		,-99		,-99		,-42		,-99		,-42		,-42		,-99		,-99		,-99		,-99		,-99		,-99		,-42		,-42		,-99		,-42		,-99		,-42		,-99		,-99		,-99		,-99		,-99		,-42		,-42		,-99		,-42		,-99		,-42		,-42		,-99		,-99		,-42		,-99		,-99		,-99		,-42		,-42		,-42	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-45		,-99		,-45		,-99		,-99		,-99		,-45		,-99		,-45		,-99		,-45		,-45		,-99		,-99		,-99		,-99		,-99		,-99		,-45		,-45		,-99		,-45		,-99		,-45		,-99		,-99		,-99		,-99		,-99		,-45		,-45		,-99		,-45		,-99		,-45		,-45		,-99		,-99		,-45		,-99		,-99		,-99		,-45		,-45		,-45	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,119	},
-	{-99		,-78		,-99		,-78		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-78		,-99		,-99		,-99		,-99		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-99		,-99		,-99		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-78		,-99		,-99		,-78		,-99		,-99		,-99		,-78		,-78		,-78	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-78		,-99		,-78		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-78		,-99		,-99		,-99		,-99		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-99		,-99		,-99		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-78		,-99		,-99		,-78		,-99		,-99		,-99		,-78		,-78		,-78	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,123	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,127	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,128		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,55		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,56		,54		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,53		,-99		,-99		,-99		,-99		,-99		,-99		,57		,-99		,129		,-99		,52		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,130	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-78		,-99		,-78		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-78		,-99		,-99		,-99		,-99		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-99		,-99		,-99		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-78		,-99		,-99		,-78		,-99		,-99		,-99		,-78		,-78		,-78	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-78		,-99		,-78		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-78		,-99		,-99		,-99		,-99		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-99		,-99		,-99		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-78		,-99		,-99		,-78		,-99		,-99		,-99		,-78		,-78		,-78	},
-	{-99		,-78		,-99		,-78		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-78		,-99		,-99		,-99		,-99		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-99		,-99		,-99		,-99		,-99		,-78		,-78		,-99		,-78		,-99		,-78		,-78		,-99		,-99		,-78		,-99		,-99		,-99		,-78		,-78		,-78	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,139	},
-	{47		,20		,29		,-99		,39		,34		,-99		,-99		,46		,43		,44		,-99		,-99		,27		,36		,41		,80		,31		,24		,21		,-99		,23		,-99		,22		,-99		,-99		,28		,19		,40		,37		,-99		,-99		,25		,-99		,35		,-99		,-99		,32		,38		,42		,45		,26		,30		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,141	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-5		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,49		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-8		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,51		,-8		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-11		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-11		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-11		,-11		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-13		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-13		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-13		,-13		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-12		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-12		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-12		,-12		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-15		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-15		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-15		,-15		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-14		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-14		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-14		,-14		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-16		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-16		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-16		,-16		,-99	},
-	{-99		,-99		,-99		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-20		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-20		,-99		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-20		,-99		,-20		,-99		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-20		,-20		,59	},
-	{-99		,-99		,-99		,-23		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-23		,-23		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-23		,-99		,-23		,-99		,-99		,-99		,-99		,-99		,-99		,-23		,-99		,-23		,-99		,-23		,61		,-99		,-99		,-99		,-99		,-99		,-99		,-23		,-23		,-23	},
-	{-99		,-99		,-99		,-26		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-26		,-26		,-99		,-99		,-99		,-99		,-99		,-99		,63		,-99		,-99		,-26		,-99		,-26		,-99		,-99		,-99		,-99		,-99		,-99		,-26		,-99		,-26		,-99		,-26		,-26		,-99		,-99		,-99		,-99		,-99		,-99		,-26		,-26		,-26	},
-	{-99		,-99		,-99		,-29		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-29		,-29		,-99		,-99		,-99		,-99		,-99		,-99		,-29		,65		,-99		,-29		,-99		,-29		,-99		,-99		,-99		,-99		,-99		,-99		,-29		,-99		,-29		,-99		,-29		,-29		,-99		,-99		,-99		,-99		,-99		,-99		,-29		,-29		,-29	},
-	{-99		,-99		,-99		,-32		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-32		,-32		,-99		,-99		,-99		,-99		,-99		,-99		,-32		,-32		,-99		,-32		,-99		,-32		,-99		,-99		,-99		,-99		,-99		,67		,-32		,-99		,-32		,-99		,-32		,-32		,-99		,-99		,-99		,-99		,-99		,-99		,-32		,-32		,-32	},
-	{-99		,69		,-99		,-35		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-35		,-35		,-99		,-99		,-99		,-99		,-99		,-99		,-35		,-35		,-99		,-35		,-99		,-35		,-99		,-99		,-99		,-99		,-99		,-35		,-35		,-99		,-35		,-99		,-35		,-35		,-99		,-99		,-99		,-99		,-99		,-99		,-35		,-35		,-35	},
-	{-99		,-38		,-99		,-38		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-38		,-38		,-99		,-99		,-99		,-99		,-99		,-99		,-38		,-38		,-99		,-38		,-99		,-38		,-99		,-99		,-99		,-99		,-99		,-38		,-38		,-99		,-38		,-99		,-38		,-38		,-99		,-99		,71		,-99		,-99		,-99		,-38		,-38		,-38	},
-	{-99		,-41		,-99		,-41		,-99		,-99		,-99		,-99		,-99		,73		,-99		,-41		,-41		,-99		,-99		,-99		,-99		,-99		,-99		,-41		,-41		,-99		,-41		,-99		,-41		,-99		,-99		,-99		,-99		,-99		,-41		,-41		,-99		,-41		,-99		,-41		,-41		,-99		,-99		,-41		,-99		,-99		,-99		,-41		,-41		,-41	},
-	{-99		,-44		,-99		,-44		,-99		,-99		,-99		,75		,-99		,-44		,-99		,-44		,-44		,-99		,-99		,-99		,-99		,-99		,-99		,-44		,-44		,-99		,-44		,-99		,-44		,-99		,-99		,-99		,-99		,-99		,-44		,-44		,-99		,-44		,-99		,-44		,-44		,-99		,-99		,-44		,-99		,-99		,-99		,-44		,-44		,-44	},
-	{-99		,-47		,-99		,-47		,-99		,-99		,77		,-47		,-99		,-47		,-99		,-47		,-47		,-99		,-99		,-99		,-99		,-99		,-99		,-47		,-47		,-99		,-47		,-99		,-47		,-99		,-99		,-99		,-99		,-99		,-47		,-47		,-99		,-47		,-99		,-47		,-47		,-99		,-99		,-47		,-99		,-99		,-99		,-47		,-47		,-47	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,154		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-74		,-99		,-74		,-99		,-99		,-74		,-74		,-99		,-74		,-99		,-74		,-74		,-99		,-99		,-99		,-99		,-99		,-99		,-74		,-74		,-99		,-74		,-99		,-74		,-99		,-99		,-99		,-99		,-99		,-74		,-74		,-99		,-74		,-99		,-74		,-74		,-99		,-99		,-74		,-99		,-99		,-99		,-74		,-74		,-74	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,129		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-77		,-99		,-77		,-99		,-99		,-77		,-77		,-99		,-77		,-99		,-77		,-77		,-99		,-99		,-99		,-99		,-99		,-99		,-77		,-77		,-99		,-77		,-99		,-77		,-99		,-99		,-99		,-99		,-99		,-77		,-77		,-99		,-77		,-99		,-77		,-77		,-99		,-99		,-77		,-99		,-99		,-99		,-77		,-77		,-77	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,155		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,156		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,157		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,158		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,159		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-17		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-17		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-17		,-17		,-99	},
-	{-99		,-64		,-99		,-64		,-99		,-99		,-64		,-64		,-99		,-64		,-99		,-64		,-64		,-99		,-99		,-99		,-99		,-99		,-99		,-64		,-64		,-99		,-64		,-99		,-64		,-99		,-99		,-99		,-99		,-99		,-64		,-64		,-99		,-64		,-99		,-64		,-64		,-99		,-99		,-64		,-99		,-99		,-99		,-64		,-64		,-64	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,160		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,161		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,162		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,163		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-75		,-99		,-75		,-99		,-99		,-75		,-75		,-99		,-75		,-99		,-75		,-75		,-99		,-99		,-99		,-99		,-99		,-99		,-75		,-75		,-99		,-75		,-99		,-75		,-99		,-99		,-99		,-99		,-99		,-75		,-75		,-99		,-75		,-99		,-75		,-75		,-99		,-99		,-75		,-99		,-99		,-99		,-75		,-75		,-75	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,164		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-73		,-99		,-73		,-99		,-99		,-73		,-73		,-99		,-73		,-99		,-73		,-73		,-99		,-99		,-99		,-99		,-99		,-99		,-73		,-73		,-99		,-73		,-99		,-73		,-99		,-99		,-99		,-99		,-99		,-73		,-73		,-99		,-73		,-99		,-73		,-73		,-99		,-99		,-73		,-99		,-99		,-99		,-73		,-73		,-73	},
-	{-99		,-76		,-99		,-76		,-99		,-99		,-76		,-76		,-99		,-76		,-99		,-76		,-76		,-99		,-99		,-99		,-99		,-99		,-99		,-76		,-76		,-99		,-76		,-99		,-76		,-99		,-99		,-99		,-99		,-99		,-76		,-76		,-99		,-76		,-99		,-76		,-76		,-99		,-99		,-76		,-99		,-99		,-99		,-76		,-76		,-76	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,165		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,166		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,167		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,168		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-4		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-7		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-7		,-99	},
-	{-99		,-99		,-99		,-19		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-19		,-19		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-19		,-99		,-19		,-99		,-99		,-99		,-99		,-99		,-99		,-19		,-99		,-19		,-99		,-19		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-19		,-19		,-99	},
-	{-99		,-99		,-99		,-22		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-22		,-22		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-22		,-99		,-22		,-99		,-99		,-99		,-99		,-99		,-99		,-22		,-99		,-22		,-99		,-22		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-22		,-22		,-22	},
-	{-99		,-99		,-99		,-25		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-25		,-25		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-25		,-99		,-25		,-99		,-99		,-99		,-99		,-99		,-99		,-25		,-99		,-25		,-99		,-25		,-25		,-99		,-99		,-99		,-99		,-99		,-99		,-25		,-25		,-25	},
-	{-99		,-99		,-99		,-28		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-28		,-28		,-99		,-99		,-99		,-99		,-99		,-99		,-28		,-99		,-99		,-28		,-99		,-28		,-99		,-99		,-99		,-99		,-99		,-99		,-28		,-99		,-28		,-99		,-28		,-28		,-99		,-99		,-99		,-99		,-99		,-99		,-28		,-28		,-28	},
-	{-99		,-99		,-99		,-31		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-31		,-31		,-99		,-99		,-99		,-99		,-99		,-99		,-31		,-31		,-99		,-31		,-99		,-31		,-99		,-99		,-99		,-99		,-99		,-99		,-31		,-99		,-31		,-99		,-31		,-31		,-99		,-99		,-99		,-99		,-99		,-99		,-31		,-31		,-31	},
-	{-99		,-99		,-99		,-34		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-34		,-34		,-99		,-99		,-99		,-99		,-99		,-99		,-34		,-34		,-99		,-34		,-99		,-34		,-99		,-99		,-99		,-99		,-99		,-34		,-34		,-99		,-34		,-99		,-34		,-34		,-99		,-99		,-99		,-99		,-99		,-99		,-34		,-34		,-34	},
-	{-99		,-37		,-99		,-37		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-37		,-37		,-99		,-99		,-99		,-99		,-99		,-99		,-37		,-37		,-99		,-37		,-99		,-37		,-99		,-99		,-99		,-99		,-99		,-37		,-37		,-99		,-37		,-99		,-37		,-37		,-99		,-99		,-99		,-99		,-99		,-99		,-37		,-37		,-37	},
-	{-99		,-40		,-99		,-40		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-40		,-40		,-99		,-99		,-99		,-99		,-99		,-99		,-40		,-40		,-99		,-40		,-99		,-40		,-99		,-99		,-99		,-99		,-99		,-40		,-40		,-99		,-40		,-99		,-40		,-40		,-99		,-99		,-40		,-99		,-99		,-99		,-40		,-40		,-40	},
-	{-99		,-43		,-99		,-43		,-99		,-99		,-99		,-99		,-99		,-43		,-99		,-43		,-43		,-99		,-99		,-99		,-99		,-99		,-99		,-43		,-43		,-99		,-43		,-99		,-43		,-99		,-99		,-99		,-99		,-99		,-43		,-43		,-99		,-43		,-99		,-43		,-43		,-99		,-99		,-43		,-99		,-99		,-99		,-43		,-43		,-43	},
-	{-99		,-46		,-99		,-46		,-99		,-99		,-99		,-46		,-99		,-46		,-99		,-46		,-46		,-99		,-99		,-99		,-99		,-99		,-99		,-46		,-46		,-99		,-46		,-99		,-46		,-99		,-99		,-99		,-99		,-99		,-46		,-46		,-99		,-46		,-99		,-46		,-46		,-99		,-99		,-46		,-99		,-99		,-99		,-46		,-46		,-46	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,169	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,170	},
-	{-99		,-49		,-99		,-49		,-99		,-99		,-49		,-49		,-99		,-49		,-99		,-49		,-49		,-99		,-99		,-99		,-99		,-99		,-99		,-49		,-49		,-99		,-49		,-99		,-49		,-99		,-99		,-99		,-99		,-99		,-49		,-49		,-99		,-49		,-99		,-49		,-49		,-99		,-99		,-49		,-99		,-99		,-99		,-49		,-49		,-49	},
-	{-99		,-53		,-99		,-53		,-99		,-99		,-53		,-53		,-99		,-53		,-99		,-53		,-53		,-99		,-99		,-99		,-99		,-99		,-99		,-53		,-53		,-99		,-53		,-99		,-53		,-99		,-99		,-99		,-99		,-99		,-53		,-53		,-99		,-53		,-99		,-53		,-53		,-99		,-99		,-53		,-99		,-99		,-99		,-53		,-53		,-53	},
-	{-99		,-56		,-99		,-56		,-99		,-99		,-56		,-56		,-99		,-56		,-99		,-56		,-56		,-99		,-99		,-99		,-99		,-99		,-99		,-56		,-56		,-99		,-56		,-99		,-56		,-99		,-99		,-99		,-99		,-99		,-56		,-56		,-99		,-56		,-99		,-56		,-56		,-99		,-99		,-56		,-99		,-99		,-99		,-56		,-56		,-56	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,171	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,172	},
-	{-99		,-55		,-99		,-55		,-99		,-99		,-55		,-55		,-99		,-55		,-99		,-55		,-55		,-99		,-99		,-99		,-99		,-99		,-99		,-55		,-55		,-99		,-55		,-99		,-55		,-99		,-99		,-99		,-99		,-99		,-55		,-55		,-99		,-55		,-99		,-55		,-55		,-99		,-99		,-55		,-99		,-99		,-99		,-55		,-55		,-55	},
-	{-99		,-50		,-99		,-50		,-99		,-99		,-50		,-50		,-99		,-50		,-99		,-50		,-50		,-99		,-99		,-99		,-99		,-99		,-99		,-50		,-50		,-99		,-50		,-99		,-50		,-99		,-99		,-99		,-99		,-99		,-50		,-50		,-99		,-50		,-99		,-50		,-50		,-99		,-99		,-50		,-99		,-99		,-99		,-50		,-50		,-50	},
-	{-99		,-54		,-99		,-54		,-99		,-99		,-54		,-54		,-99		,-54		,-99		,-54		,-54		,-99		,-99		,-99		,-99		,-99		,-99		,-54		,-54		,-99		,-54		,-99		,-54		,-99		,-99		,-99		,-99		,-99		,-54		,-54		,-99		,-54		,-99		,-54		,-54		,-99		,-99		,-54		,-99		,-99		,-99		,-54		,-54		,-54	},
-	{-99		,-52		,-99		,-52		,-99		,-99		,-52		,-52		,-99		,-52		,-99		,-52		,-52		,-99		,-99		,-99		,-99		,-99		,-99		,-52		,-52		,-99		,-52		,-99		,-52		,-99		,-99		,-99		,-99		,-99		,-52		,-52		,-99		,-52		,-99		,-52		,-52		,-99		,-99		,-52		,-99		,-99		,-99		,-52		,-52		,-52	},
-	{-99		,-57		,-99		,-57		,-99		,-99		,-57		,-57		,-99		,-57		,-99		,-57		,-57		,-99		,-99		,-99		,-99		,-99		,-99		,-57		,-57		,-99		,-57		,-99		,-57		,-99		,-99		,-99		,-99		,-99		,-57		,-57		,-99		,-57		,-99		,-57		,-57		,-99		,-99		,-57		,-99		,-99		,-99		,-57		,-57		,-57	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,173	},
-	{-99		,-51		,-99		,-51		,-99		,-99		,-51		,-51		,-99		,-51		,-99		,-51		,-51		,-99		,-99		,-99		,-99		,-99		,-99		,-51		,-51		,-99		,-51		,-99		,-51		,-99		,-99		,-99		,-99		,-99		,-51		,-51		,-99		,-51		,-99		,-51		,-51		,-99		,-99		,-51		,-99		,-99		,-99		,-51		,-51		,-51	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,174	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,175		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,176		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,177		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,178		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,179		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,180		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,181	},
-	{-99		,-60		,-99		,-60		,-99		,-99		,-60		,-60		,-99		,-60		,-99		,-60		,-60		,-99		,-99		,-99		,-99		,-99		,-99		,-60		,-60		,-99		,-60		,-99		,-60		,-99		,-99		,-99		,-99		,-99		,-60		,-60		,-99		,-60		,-99		,-60		,-60		,-99		,-99		,-60		,-99		,-99		,-99		,-60		,-60		,-60	},
-	{-99		,-59		,-99		,-59		,-99		,-99		,-59		,-59		,-99		,-59		,-99		,-59		,-59		,-99		,-99		,-99		,-99		,-99		,-99		,-59		,-59		,-99		,-59		,-99		,-59		,-99		,-99		,-99		,-99		,-99		,-59		,-59		,-99		,-59		,-99		,-59		,-59		,-99		,-99		,-59		,-99		,-99		,-99		,-59		,-59		,-59	},
-	{-99		,-61		,-99		,-61		,-99		,-99		,-61		,-61		,-99		,-61		,-99		,-61		,-61		,-99		,-99		,-99		,-99		,-99		,-99		,-61		,-61		,-99		,-61		,-99		,-61		,-99		,-99		,-99		,-99		,-99		,-61		,-61		,-99		,-61		,-99		,-61		,-61		,-99		,-99		,-61		,-99		,-99		,-99		,-61		,-61		,-61	},
-	{-99		,-62		,-99		,-62		,-99		,-99		,-62		,-62		,-99		,-62		,-99		,-62		,-62		,-99		,-99		,-99		,-99		,-99		,-99		,-62		,-62		,-99		,-62		,-99		,-62		,-99		,-99		,-99		,-99		,-99		,-62		,-62		,-99		,-62		,-99		,-62		,-62		,-99		,-99		,-62		,-99		,-99		,-99		,-62		,-62		,-62	},
-	{-99		,-58		,-99		,-58		,-99		,-99		,-58		,-58		,-99		,-58		,-99		,-58		,-58		,-99		,-99		,-99		,-99		,-99		,-99		,-58		,-58		,-99		,-58		,-99		,-58		,-99		,-99		,-99		,-99		,-99		,-58		,-58		,-99		,-58		,-99		,-58		,-58		,-99		,-99		,-58		,-99		,-99		,-99		,-58		,-58		,-58	},
-	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,182		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
-	{-99		,-63		,-99		,-63		,-99		,-99		,-63		,-63		,-99		,-63		,-99		,-63		,-63		,-99		,-99		,-99		,-99		,-99		,-99		,-63		,-63		,-99		,-63		,-99		,-63		,-99		,-99		,-99		,-99		,-99		,-63		,-63		,-99		,-63		,-99		,-63		,-63		,-99		,-99		,-63		,-99		,-99		,-99		,-63		,-63		,-63	}
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,33		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-1		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-2		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-5		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,54	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,56		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-8		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-8	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-9		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-9		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-9	},
+	{-99		,57		,-99		,-99		,-99		,-99		,-99		,-99		,62		,-99		,-99		,-99		,-10		,-99		,-99		,-99		,60		,-99		,-99		,-99		,-99		,-99		,-10		,-99		,-99		,-99		,61		,-99		,-99		,-99		,59		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,58		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-10	},
+	{-99		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-20		,-99		,-99		,-99		,-20		,-99		,-99		,-20		,-20		,-99		,-99		,-99		,64		,-99		,-20		,-99		,-99		,-99		,-20		,-99		,-99		,-99		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-20	},
+	{-99		,-23		,-99		,-99		,-99		,-99		,-99		,-99		,-23		,-99		,-99		,-99		,-23		,66		,-99		,-23		,-23		,-99		,-99		,-99		,-23		,-99		,-23		,-99		,-99		,-99		,-23		,-99		,-99		,-99		,-23		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-23		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-23	},
+	{-99		,-26		,-99		,-99		,-99		,-99		,-99		,-99		,-26		,-99		,-99		,-99		,-26		,-26		,-99		,-26		,-26		,-99		,-99		,-99		,-26		,-99		,-26		,-99		,-99		,-99		,-26		,-99		,-99		,-99		,-26		,-99		,-99		,-99		,-99		,68		,-99		,-99		,-99		,-26		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-26	},
+	{-99		,-29		,-99		,-99		,-99		,-99		,-99		,-99		,-29		,-99		,70		,-99		,-29		,-29		,-99		,-29		,-29		,-99		,-99		,-99		,-29		,-99		,-29		,-99		,-99		,-99		,-29		,-99		,-99		,-99		,-29		,-99		,-99		,-99		,-99		,-29		,-99		,-99		,-99		,-29		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-29	},
+	{-99		,-32		,-99		,-99		,-99		,-99		,-99		,-99		,-32		,-99		,-32		,-99		,-32		,-32		,-99		,-32		,-32		,-99		,-99		,-99		,-32		,-99		,-32		,-99		,-99		,-99		,-32		,-99		,-99		,-99		,-32		,-99		,-99		,-99		,-99		,-32		,-99		,-99		,-99		,-32		,-99		,-99		,72		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-32	},
+	{74		,-35		,-99		,-99		,-99		,-99		,-99		,-99		,-35		,-99		,-35		,-99		,-35		,-35		,-99		,-35		,-35		,-99		,-99		,-99		,-35		,-99		,-35		,-99		,-99		,-99		,-35		,-99		,-99		,-99		,-35		,-99		,-99		,-99		,-99		,-35		,-99		,-99		,-99		,-35		,-99		,-99		,-35		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-35	},
+	{-38		,-38		,-99		,-99		,76		,-99		,-99		,-99		,-38		,-99		,-38		,-99		,-38		,-38		,-99		,-38		,-38		,-99		,-99		,-99		,-38		,-99		,-38		,-99		,-99		,-99		,-38		,-99		,-99		,-99		,-38		,-99		,-99		,-99		,-99		,-38		,-99		,-99		,-99		,-38		,-99		,-99		,-38		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-38	},
+	{-41		,-41		,-99		,-99		,-41		,-99		,-99		,-99		,-41		,-99		,-41		,-99		,-41		,-41		,-99		,-41		,-41		,-99		,-99		,-99		,-41		,-99		,-41		,-99		,-99		,-99		,-41		,-99		,-99		,-99		,-41		,78		,-99		,-99		,-99		,-41		,-99		,-99		,-99		,-41		,-99		,-99		,-41		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-41	},
+	{-44		,-44		,-99		,-99		,-44		,-99		,-99		,-99		,-44		,-99		,-44		,-99		,-44		,-44		,-99		,-44		,-44		,-99		,-99		,-99		,-44		,-99		,-44		,-99		,-99		,-99		,-44		,-99		,-99		,-99		,-44		,-44		,-99		,-99		,-99		,-44		,-99		,-99		,-99		,-44		,-99		,80		,-44		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-44	},
+	{-47		,-47		,-99		,-99		,-47		,-99		,-99		,-99		,-47		,-99		,-47		,82		,-47		,-47		,-99		,-47		,-47		,-99		,-99		,-99		,-47		,-99		,-47		,-99		,-99		,-99		,-47		,-99		,-99		,-99		,-47		,-47		,-99		,-99		,-99		,-47		,-99		,-99		,-99		,-47		,-99		,-47		,-47		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-47	},
+	{-48		,-48		,-99		,-99		,-48		,-99		,-99		,-99		,-48		,-99		,-48		,-48		,-48		,-48		,-99		,-48		,-48		,-99		,-99		,-99		,-48		,-99		,-48		,-99		,-99		,-99		,-48		,-99		,-99		,-99		,-48		,-48		,-99		,-99		,-99		,-48		,-99		,-99		,-99		,-48		,-99		,-48		,-48		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-48	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,83		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,84		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-74		,-74		,-99		,-99		,-74		,-99		,-99		,-99		,-74		,-99		,-74		,-74		,-74		,-74		,-99		,-74		,-74		,-99		,-99		,-99		,-74		,-99		,-74		,-99		,-99		,-99		,-74		,-99		,-99		,-99		,-74		,-74		,-99		,-99		,-99		,-74		,-99		,-99		,-99		,-74		,-99		,-74		,-74		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-74	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,85		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-71		,-71		,-99		,-99		,-71		,-99		,-99		,-99		,-71		,-99		,-71		,-71		,-71		,-71		,-99		,-71		,-71		,-99		,-99		,-99		,-71		,-99		,-71		,-99		,-99		,-99		,-71		,-99		,-99		,-99		,-71		,-71		,-99		,-99		,-99		,-71		,-99		,-99		,-99		,-71		,-99		,-71		,-71		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-71	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,86		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-70		,-70		,-99		,-99		,-70		,-99		,-99		,-99		,-70		,-99		,-70		,-70		,-70		,-70		,-99		,-70		,-70		,-99		,-99		,-99		,-70		,-99		,-70		,-99		,-99		,-99		,-70		,-99		,-99		,-99		,-70		,-70		,-99		,-99		,-99		,-70		,-99		,-99		,-99		,-70		,-99		,-70		,-70		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-70	},
+	{-75		,-75		,-99		,-99		,-75		,-99		,-99		,-99		,-75		,-99		,-75		,-75		,-75		,-75		,-99		,-75		,-75		,-99		,-99		,-99		,-75		,-99		,-75		,-99		,-99		,-99		,-75		,-99		,-99		,-99		,-75		,-75		,-99		,-99		,-99		,-75		,-99		,-99		,-99		,-75		,-99		,-75		,-75		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-75	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,87		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,88		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,89		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-72		,-72		,-99		,-99		,-72		,-99		,-99		,-99		,-72		,-99		,-72		,-72		,-72		,-72		,-99		,-72		,-72		,-99		,-99		,-99		,-72		,-99		,-72		,-99		,-99		,-99		,-72		,-99		,-99		,-99		,-72		,-72		,-99		,-99		,-99		,-72		,-99		,-99		,-99		,-72		,-99		,-72		,-72		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-72	},
+	{-76		,-76		,-99		,-99		,-76		,-99		,-99		,-99		,-76		,-99		,-76		,-76		,-76		,-76		,-99		,-76		,-76		,-99		,-99		,-99		,-76		,-99		,-76		,-99		,-99		,-99		,-76		,-99		,-99		,-99		,-76		,-76		,-99		,-99		,-99		,-76		,-99		,-99		,-99		,-76		,-99		,-76		,-76		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-76	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,90		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,33		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,93		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,94		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,95		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-77		,-77		,-99		,-99		,-77		,-99		,-99		,-99		,-77		,-99		,-77		,-77		,-77		,-77		,-99		,-77		,-77		,-99		,-99		,-99		,-77		,-99		,-77		,-99		,-99		,-99		,-77		,-99		,-99		,-99		,-77		,-77		,-99		,-99		,-99		,-77		,-99		,-99		,-99		,-77		,-99		,-77		,-77		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-77	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,96		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-73		,-73		,-99		,-99		,-73		,-99		,-99		,-99		,-73		,-99		,-73		,-73		,-73		,-73		,-99		,-73		,-73		,-99		,-99		,-99		,-73		,-99		,-73		,-99		,-99		,-99		,-73		,-99		,-99		,-99		,-73		,-73		,-99		,-99		,-99		,-73		,-99		,-99		,-99		,-73		,-99		,-73		,-73		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-73	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,100		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,101		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,103		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,104		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,105		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,107		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,110		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-3		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,33		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-6		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-6	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,33		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-18		,-99		,-99		,-99		,-99		,-99		,-99		,-18		,-99		,-99		,-99		,-18		,-99		,-99		,-18		,-18		,-99		,-99		,-99		,-99		,-99		,-18		,-99		,-99		,-99		,-18		,-99		,-99		,-99		,-18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-18		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-18	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-21		,-99		,-99		,-99		,-99		,-99		,-99		,-21		,-99		,-99		,-99		,-21		,-99		,-99		,-21		,-21		,-99		,-99		,-99		,-21		,-99		,-21		,-99		,-99		,-99		,-21		,-99		,-99		,-99		,-21		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-21		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-21	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-24		,-99		,-99		,-99		,-99		,-99		,-99		,-24		,-99		,-99		,-99		,-24		,-24		,-99		,-24		,-24		,-99		,-99		,-99		,-24		,-99		,-24		,-99		,-99		,-99		,-24		,-99		,-99		,-99		,-24		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-24		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-24	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-27		,-99		,-99		,-99		,-99		,-99		,-99		,-27		,-99		,-99		,-99		,-27		,-27		,-99		,-27		,-27		,-99		,-99		,-99		,-27		,-99		,-27		,-99		,-99		,-99		,-27		,-99		,-99		,-99		,-27		,-99		,-99		,-99		,-99		,-27		,-99		,-99		,-99		,-27		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-27	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-30		,-99		,-99		,-99		,-99		,-99		,-99		,-30		,-99		,-30		,-99		,-30		,-30		,-99		,-30		,-30		,-99		,-99		,-99		,-30		,-99		,-30		,-99		,-99		,-99		,-30		,-99		,-99		,-99		,-30		,-99		,-99		,-99		,-99		,-30		,-99		,-99		,-99		,-30		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-30	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-33		,-99		,-99		,-99		,-99		,-99		,-99		,-33		,-99		,-33		,-99		,-33		,-33		,-99		,-33		,-33		,-99		,-99		,-99		,-33		,-99		,-33		,-99		,-99		,-99		,-33		,-99		,-99		,-99		,-33		,-99		,-99		,-99		,-99		,-33		,-99		,-99		,-99		,-33		,-99		,-99		,-33		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-33	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-36		,-36		,-99		,-99		,-99		,-99		,-99		,-99		,-36		,-99		,-36		,-99		,-36		,-36		,-99		,-36		,-36		,-99		,-99		,-99		,-36		,-99		,-36		,-99		,-99		,-99		,-36		,-99		,-99		,-99		,-36		,-99		,-99		,-99		,-99		,-36		,-99		,-99		,-99		,-36		,-99		,-99		,-36		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-36	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-39		,-39		,-99		,-99		,-39		,-99		,-99		,-99		,-39		,-99		,-39		,-99		,-39		,-39		,-99		,-39		,-39		,-99		,-99		,-99		,-39		,-99		,-39		,-99		,-99		,-99		,-39		,-99		,-99		,-99		,-39		,-99		,-99		,-99		,-99		,-39		,-99		,-99		,-99		,-39		,-99		,-99		,-39		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-39	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-42		,-42		,-99		,-99		,-42		,-99		,-99		,-99		,-42		,-99		,-42		,-99		,-42		,-42		,-99		,-42		,-42		,-99		,-99		,-99		,-42		,-99		,-42		,-99		,-99		,-99		,-42		,-99		,-99		,-99		,-42		,-42		,-99		,-99		,-99		,-42		,-99		,-99		,-99		,-42		,-99		,-99		,-42		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-42	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-45		,-45		,-99		,-99		,-45		,-99		,-99		,-99		,-45		,-99		,-45		,-99		,-45		,-45		,-99		,-45		,-45		,-99		,-99		,-99		,-45		,-99		,-45		,-99		,-99		,-99		,-45		,-99		,-99		,-99		,-45		,-45		,-99		,-99		,-99		,-45		,-99		,-99		,-99		,-45		,-99		,-45		,-45		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-45	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,130	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,132	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,133	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,134	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,135	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,137		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,57		,-99		,-99		,-99		,-99		,-99		,-99		,62		,-99		,-99		,-99		,-99		,-99		,-99		,138		,60		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,61		,-99		,-99		,-99		,59		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,58		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,139	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,141	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,142	},
+	{-83		,-83		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-83		,-83		,-83		,-99		,-83		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-83		,-99		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-83		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-83	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,146	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-83		,-83		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-83		,-83		,-83		,-99		,-83		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-83		,-99		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-83		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-83	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{50		,-99		,52		,28		,40		,48		,21		,26		,-99		,31		,-99		,-99		,-99		,-99		,39		,-99		,-99		,32		,27		,25		,-99		,42		,-99		,36		,38		,23		,-99		,20		,37		,30		,-99		,51		,43		,35		,98		,44		,29		,46		,49		,-99		,22		,-99		,-99		,34		,41		,-99		,19		,24		,47		,45		,-99	},
+	{-83		,-83		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-83		,-83		,-83		,-99		,-83		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-83		,-99		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-83		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-83	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,153	},
+	{-83		,-83		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-83		,-83		,-83		,-99		,-83		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-83		,-99		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-83		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-83	},
+	{-83		,-83		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-83		,-83		,-83		,-99		,-83		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-83		,-99		,-99		,-99		,-83		,-99		,-99		,-99		,-83		,-99		,-83		,-83		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-83	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,156	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-5		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,54	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,56		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-8		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-8	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-14		,-99		,-99		,-14		,-99		,-99		,-99		,-99		,-99		,-99		,-14		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-14	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-16		,-99		,-99		,-16		,-99		,-99		,-99		,-99		,-99		,-99		,-16		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-16	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-15		,-99		,-99		,-15		,-99		,-99		,-99		,-99		,-99		,-99		,-15		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-15	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-11		,-99		,-99		,-11		,-99		,-99		,-99		,-99		,-99		,-99		,-11		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-11	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-13		,-99		,-99		,-13		,-99		,-99		,-99		,-99		,-99		,-99		,-13		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-13	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-12		,-99		,-99		,-12		,-99		,-99		,-99		,-99		,-99		,-99		,-12		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-12	},
+	{-99		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-20		,-99		,-99		,-99		,-20		,-99		,-99		,-20		,-20		,-99		,-99		,-99		,64		,-99		,-20		,-99		,-99		,-99		,-20		,-99		,-99		,-99		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-20		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-20	},
+	{-99		,-23		,-99		,-99		,-99		,-99		,-99		,-99		,-23		,-99		,-99		,-99		,-23		,66		,-99		,-23		,-23		,-99		,-99		,-99		,-23		,-99		,-23		,-99		,-99		,-99		,-23		,-99		,-99		,-99		,-23		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-23		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-23	},
+	{-99		,-26		,-99		,-99		,-99		,-99		,-99		,-99		,-26		,-99		,-99		,-99		,-26		,-26		,-99		,-26		,-26		,-99		,-99		,-99		,-26		,-99		,-26		,-99		,-99		,-99		,-26		,-99		,-99		,-99		,-26		,-99		,-99		,-99		,-99		,68		,-99		,-99		,-99		,-26		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-26	},
+	{-99		,-29		,-99		,-99		,-99		,-99		,-99		,-99		,-29		,-99		,70		,-99		,-29		,-29		,-99		,-29		,-29		,-99		,-99		,-99		,-29		,-99		,-29		,-99		,-99		,-99		,-29		,-99		,-99		,-99		,-29		,-99		,-99		,-99		,-99		,-29		,-99		,-99		,-99		,-29		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-29	},
+	{-99		,-32		,-99		,-99		,-99		,-99		,-99		,-99		,-32		,-99		,-32		,-99		,-32		,-32		,-99		,-32		,-32		,-99		,-99		,-99		,-32		,-99		,-32		,-99		,-99		,-99		,-32		,-99		,-99		,-99		,-32		,-99		,-99		,-99		,-99		,-32		,-99		,-99		,-99		,-32		,-99		,-99		,72		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-32	},
+	{74		,-35		,-99		,-99		,-99		,-99		,-99		,-99		,-35		,-99		,-35		,-99		,-35		,-35		,-99		,-35		,-35		,-99		,-99		,-99		,-35		,-99		,-35		,-99		,-99		,-99		,-35		,-99		,-99		,-99		,-35		,-99		,-99		,-99		,-99		,-35		,-99		,-99		,-99		,-35		,-99		,-99		,-35		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-35	},
+	{-38		,-38		,-99		,-99		,76		,-99		,-99		,-99		,-38		,-99		,-38		,-99		,-38		,-38		,-99		,-38		,-38		,-99		,-99		,-99		,-38		,-99		,-38		,-99		,-99		,-99		,-38		,-99		,-99		,-99		,-38		,-99		,-99		,-99		,-99		,-38		,-99		,-99		,-99		,-38		,-99		,-99		,-38		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-38	},
+	{-41		,-41		,-99		,-99		,-41		,-99		,-99		,-99		,-41		,-99		,-41		,-99		,-41		,-41		,-99		,-41		,-41		,-99		,-99		,-99		,-41		,-99		,-41		,-99		,-99		,-99		,-41		,-99		,-99		,-99		,-41		,78		,-99		,-99		,-99		,-41		,-99		,-99		,-99		,-41		,-99		,-99		,-41		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-41	},
+	{-44		,-44		,-99		,-99		,-44		,-99		,-99		,-99		,-44		,-99		,-44		,-99		,-44		,-44		,-99		,-44		,-44		,-99		,-99		,-99		,-44		,-99		,-44		,-99		,-99		,-99		,-44		,-99		,-99		,-99		,-44		,-44		,-99		,-99		,-99		,-44		,-99		,-99		,-99		,-44		,-99		,80		,-44		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-44	},
+	{-47		,-47		,-99		,-99		,-47		,-99		,-99		,-99		,-47		,-99		,-47		,82		,-47		,-47		,-99		,-47		,-47		,-99		,-99		,-99		,-47		,-99		,-47		,-99		,-99		,-99		,-47		,-99		,-99		,-99		,-47		,-47		,-99		,-99		,-99		,-47		,-99		,-99		,-99		,-47		,-99		,-47		,-47		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-47	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,169		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,170		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,171		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,172		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,173		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,174		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,175		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,176		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-17		,-99		,-99		,-17		,-99		,-99		,-99		,-99		,-99		,-99		,-17		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-17	},
+	{-69		,-69		,-99		,-99		,-69		,-99		,-99		,-99		,-69		,-99		,-69		,-69		,-69		,-69		,-99		,-69		,-69		,-99		,-99		,-99		,-69		,-99		,-69		,-99		,-99		,-99		,-69		,-99		,-99		,-99		,-69		,-69		,-99		,-99		,-99		,-69		,-99		,-99		,-99		,-69		,-99		,-69		,-69		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-69	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,177		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,178		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,179		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,180		,-99		,-99		,-99		,-99		,-99	},
+	{-78		,-78		,-99		,-99		,-78		,-99		,-99		,-99		,-78		,-99		,-78		,-78		,-78		,-78		,-99		,-78		,-78		,-99		,-99		,-99		,-78		,-99		,-78		,-99		,-99		,-99		,-78		,-99		,-99		,-99		,-78		,-78		,-99		,-99		,-99		,-78		,-99		,-99		,-99		,-78		,-99		,-78		,-78		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-78	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,138		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,181		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,182		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,183		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-82		,-82		,-99		,-99		,-82		,-99		,-99		,-99		,-82		,-99		,-82		,-82		,-82		,-82		,-99		,-82		,-82		,-99		,-99		,-99		,-82		,-99		,-82		,-99		,-99		,-99		,-82		,-99		,-99		,-99		,-82		,-82		,-99		,-99		,-99		,-82		,-99		,-99		,-99		,-82		,-99		,-82		,-82		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-82	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,184		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,185		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,186		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-80		,-80		,-99		,-99		,-80		,-99		,-99		,-99		,-80		,-99		,-80		,-80		,-80		,-80		,-99		,-80		,-80		,-99		,-99		,-99		,-80		,-99		,-80		,-99		,-99		,-99		,-80		,-99		,-99		,-99		,-80		,-80		,-99		,-99		,-99		,-80		,-99		,-99		,-99		,-80		,-99		,-80		,-80		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-80	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,187		,-99		,-99		,-99		,-99		,-99	},
+	{-79		,-79		,-99		,-99		,-79		,-99		,-99		,-99		,-79		,-99		,-79		,-79		,-79		,-79		,-99		,-79		,-79		,-99		,-99		,-99		,-79		,-99		,-79		,-99		,-99		,-99		,-79		,-99		,-99		,-99		,-79		,-79		,-99		,-99		,-99		,-79		,-99		,-99		,-99		,-79		,-99		,-79		,-79		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-79	},
+	{-81		,-81		,-99		,-99		,-81		,-99		,-99		,-99		,-81		,-99		,-81		,-81		,-81		,-81		,-99		,-81		,-81		,-99		,-99		,-99		,-81		,-99		,-81		,-99		,-99		,-99		,-81		,-99		,-99		,-99		,-81		,-81		,-99		,-99		,-99		,-81		,-99		,-99		,-99		,-81		,-99		,-81		,-81		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-81	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,188		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-4		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-7		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-7	},
+	{-99		,-19		,-99		,-99		,-99		,-99		,-99		,-99		,-19		,-99		,-99		,-99		,-19		,-99		,-99		,-19		,-19		,-99		,-99		,-99		,-99		,-99		,-19		,-99		,-99		,-99		,-19		,-99		,-99		,-99		,-19		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-19		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-19	},
+	{-99		,-22		,-99		,-99		,-99		,-99		,-99		,-99		,-22		,-99		,-99		,-99		,-22		,-99		,-99		,-22		,-22		,-99		,-99		,-99		,-22		,-99		,-22		,-99		,-99		,-99		,-22		,-99		,-99		,-99		,-22		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-22		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-22	},
+	{-99		,-25		,-99		,-99		,-99		,-99		,-99		,-99		,-25		,-99		,-99		,-99		,-25		,-25		,-99		,-25		,-25		,-99		,-99		,-99		,-25		,-99		,-25		,-99		,-99		,-99		,-25		,-99		,-99		,-99		,-25		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-25		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-25	},
+	{-99		,-28		,-99		,-99		,-99		,-99		,-99		,-99		,-28		,-99		,-99		,-99		,-28		,-28		,-99		,-28		,-28		,-99		,-99		,-99		,-28		,-99		,-28		,-99		,-99		,-99		,-28		,-99		,-99		,-99		,-28		,-99		,-99		,-99		,-99		,-28		,-99		,-99		,-99		,-28		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-28	},
+	{-99		,-31		,-99		,-99		,-99		,-99		,-99		,-99		,-31		,-99		,-31		,-99		,-31		,-31		,-99		,-31		,-31		,-99		,-99		,-99		,-31		,-99		,-31		,-99		,-99		,-99		,-31		,-99		,-99		,-99		,-31		,-99		,-99		,-99		,-99		,-31		,-99		,-99		,-99		,-31		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-31	},
+	{-99		,-34		,-99		,-99		,-99		,-99		,-99		,-99		,-34		,-99		,-34		,-99		,-34		,-34		,-99		,-34		,-34		,-99		,-99		,-99		,-34		,-99		,-34		,-99		,-99		,-99		,-34		,-99		,-99		,-99		,-34		,-99		,-99		,-99		,-99		,-34		,-99		,-99		,-99		,-34		,-99		,-99		,-34		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-34	},
+	{-37		,-37		,-99		,-99		,-99		,-99		,-99		,-99		,-37		,-99		,-37		,-99		,-37		,-37		,-99		,-37		,-37		,-99		,-99		,-99		,-37		,-99		,-37		,-99		,-99		,-99		,-37		,-99		,-99		,-99		,-37		,-99		,-99		,-99		,-99		,-37		,-99		,-99		,-99		,-37		,-99		,-99		,-37		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-37	},
+	{-40		,-40		,-99		,-99		,-40		,-99		,-99		,-99		,-40		,-99		,-40		,-99		,-40		,-40		,-99		,-40		,-40		,-99		,-99		,-99		,-40		,-99		,-40		,-99		,-99		,-99		,-40		,-99		,-99		,-99		,-40		,-99		,-99		,-99		,-99		,-40		,-99		,-99		,-99		,-40		,-99		,-99		,-40		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-40	},
+	{-43		,-43		,-99		,-99		,-43		,-99		,-99		,-99		,-43		,-99		,-43		,-99		,-43		,-43		,-99		,-43		,-43		,-99		,-99		,-99		,-43		,-99		,-43		,-99		,-99		,-99		,-43		,-99		,-99		,-99		,-43		,-43		,-99		,-99		,-99		,-43		,-99		,-99		,-99		,-43		,-99		,-99		,-43		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-43	},
+	{-46		,-46		,-99		,-99		,-46		,-99		,-99		,-99		,-46		,-99		,-46		,-99		,-46		,-46		,-99		,-46		,-46		,-99		,-99		,-99		,-46		,-99		,-46		,-99		,-99		,-99		,-46		,-99		,-99		,-99		,-46		,-46		,-99		,-99		,-99		,-46		,-99		,-99		,-99		,-46		,-99		,-46		,-46		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-46	},
+	{-56		,-56		,-99		,-99		,-56		,-99		,-99		,-99		,-56		,-99		,-56		,-56		,-56		,-56		,-99		,-56		,-56		,-99		,-99		,-99		,-56		,-99		,-56		,-99		,-99		,-99		,-56		,-99		,-99		,-99		,-56		,-56		,-99		,-99		,-99		,-56		,-99		,-99		,-99		,-56		,-99		,-56		,-56		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-56	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,189	},
+	{-51		,-51		,-99		,-99		,-51		,-99		,-99		,-99		,-51		,-99		,-51		,-51		,-51		,-51		,-99		,-51		,-51		,-99		,-99		,-99		,-51		,-99		,-51		,-99		,-99		,-99		,-51		,-99		,-99		,-99		,-51		,-51		,-99		,-99		,-99		,-51		,-99		,-99		,-99		,-51		,-99		,-51		,-51		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-51	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,190	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,191	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,192	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,193	},
+	{-52		,-52		,-99		,-99		,-52		,-99		,-99		,-99		,-52		,-99		,-52		,-52		,-52		,-52		,-99		,-52		,-52		,-99		,-99		,-99		,-52		,-99		,-52		,-99		,-99		,-99		,-52		,-99		,-99		,-99		,-52		,-52		,-99		,-99		,-99		,-52		,-99		,-99		,-99		,-52		,-99		,-52		,-52		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-52	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,194	},
+	{-54		,-54		,-99		,-99		,-54		,-99		,-99		,-99		,-54		,-99		,-54		,-54		,-54		,-54		,-99		,-54		,-54		,-99		,-99		,-99		,-54		,-99		,-54		,-99		,-99		,-99		,-54		,-99		,-99		,-99		,-54		,-54		,-99		,-99		,-99		,-54		,-99		,-99		,-99		,-54		,-99		,-54		,-54		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-54	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,195	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,196	},
+	{-50		,-50		,-99		,-99		,-50		,-99		,-99		,-99		,-50		,-99		,-50		,-50		,-50		,-50		,-99		,-50		,-50		,-99		,-99		,-99		,-50		,-99		,-50		,-99		,-99		,-99		,-50		,-99		,-99		,-99		,-50		,-50		,-99		,-99		,-99		,-50		,-99		,-99		,-99		,-50		,-99		,-50		,-50		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-50	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,197	},
+	{-49		,-49		,-99		,-99		,-49		,-99		,-99		,-99		,-49		,-99		,-49		,-49		,-49		,-49		,-99		,-49		,-49		,-99		,-99		,-99		,-49		,-99		,-49		,-99		,-99		,-99		,-49		,-99		,-99		,-99		,-49		,-49		,-99		,-99		,-99		,-49		,-99		,-99		,-99		,-49		,-99		,-49		,-49		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-49	},
+	{-53		,-53		,-99		,-99		,-53		,-99		,-99		,-99		,-53		,-99		,-53		,-53		,-53		,-53		,-99		,-53		,-53		,-99		,-99		,-99		,-53		,-99		,-53		,-99		,-99		,-99		,-53		,-99		,-99		,-99		,-53		,-53		,-99		,-99		,-99		,-53		,-99		,-99		,-99		,-53		,-99		,-53		,-53		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-53	},
+	{-55		,-55		,-99		,-99		,-55		,-99		,-99		,-99		,-55		,-99		,-55		,-55		,-55		,-55		,-99		,-55		,-55		,-99		,-99		,-99		,-55		,-99		,-55		,-99		,-99		,-99		,-55		,-99		,-99		,-99		,-55		,-55		,-99		,-99		,-99		,-55		,-99		,-99		,-99		,-55		,-99		,-55		,-55		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-55	},
+	{-57		,-57		,-99		,-99		,-57		,-99		,-99		,-99		,-57		,-99		,-57		,-57		,-57		,-57		,-99		,-57		,-57		,-99		,-99		,-99		,-57		,-99		,-57		,-99		,-99		,-99		,-57		,-99		,-99		,-99		,-57		,-57		,-99		,-99		,-99		,-57		,-99		,-99		,-99		,-57		,-99		,-57		,-57		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-57	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,198	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,199	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,200		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,201		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,202		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,203		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,204		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,205		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,206		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,207		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,208		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,209		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,210		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-61		,-61		,-99		,-99		,-61		,-99		,-99		,-99		,-61		,-99		,-61		,-61		,-61		,-61		,-99		,-61		,-61		,-99		,-99		,-99		,-61		,-99		,-61		,-99		,-99		,-99		,-61		,-99		,-99		,-99		,-61		,-61		,-99		,-99		,-99		,-61		,-99		,-99		,-99		,-61		,-99		,-61		,-61		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-61	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,211	},
+	{-60		,-60		,-99		,-99		,-60		,-99		,-99		,-99		,-60		,-99		,-60		,-60		,-60		,-60		,-99		,-60		,-60		,-99		,-99		,-99		,-60		,-99		,-60		,-99		,-99		,-99		,-60		,-99		,-99		,-99		,-60		,-60		,-99		,-99		,-99		,-60		,-99		,-99		,-99		,-60		,-99		,-60		,-60		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-60	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,212	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,213	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,214	},
+	{-59		,-59		,-99		,-99		,-59		,-99		,-99		,-99		,-59		,-99		,-59		,-59		,-59		,-59		,-99		,-59		,-59		,-99		,-99		,-99		,-59		,-99		,-59		,-99		,-99		,-99		,-59		,-99		,-99		,-99		,-59		,-59		,-99		,-99		,-99		,-59		,-99		,-99		,-99		,-59		,-99		,-59		,-59		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-59	},
+	{-64		,-64		,-99		,-99		,-64		,-99		,-99		,-99		,-64		,-99		,-64		,-64		,-64		,-64		,-99		,-64		,-64		,-99		,-99		,-99		,-64		,-99		,-64		,-99		,-99		,-99		,-64		,-99		,-99		,-99		,-64		,-64		,-99		,-99		,-99		,-64		,-99		,-99		,-99		,-64		,-99		,-64		,-64		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-64	},
+	{-62		,-62		,-99		,-99		,-62		,-99		,-99		,-99		,-62		,-99		,-62		,-62		,-62		,-62		,-99		,-62		,-62		,-99		,-99		,-99		,-62		,-99		,-62		,-99		,-99		,-99		,-62		,-99		,-99		,-99		,-62		,-62		,-99		,-99		,-99		,-62		,-99		,-99		,-99		,-62		,-99		,-62		,-62		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-62	},
+	{-58		,-58		,-99		,-99		,-58		,-99		,-99		,-99		,-58		,-99		,-58		,-58		,-58		,-58		,-99		,-58		,-58		,-99		,-99		,-99		,-58		,-99		,-58		,-99		,-99		,-99		,-58		,-99		,-99		,-99		,-58		,-58		,-99		,-99		,-99		,-58		,-99		,-99		,-99		,-58		,-99		,-58		,-58		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-58	},
+	{-63		,-63		,-99		,-99		,-63		,-99		,-99		,-99		,-63		,-99		,-63		,-63		,-63		,-63		,-99		,-63		,-63		,-99		,-99		,-99		,-63		,-99		,-63		,-99		,-99		,-99		,-63		,-99		,-99		,-99		,-63		,-63		,-99		,-99		,-99		,-63		,-99		,-99		,-99		,-63		,-99		,-63		,-63		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-63	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,215		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,216		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,217		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,218		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-99	},
+	{-65		,-65		,-99		,-99		,-65		,-99		,-99		,-99		,-65		,-99		,-65		,-65		,-65		,-65		,-99		,-65		,-65		,-99		,-99		,-99		,-65		,-99		,-65		,-99		,-99		,-99		,-65		,-99		,-99		,-99		,-65		,-65		,-99		,-99		,-99		,-65		,-99		,-99		,-99		,-65		,-99		,-65		,-65		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-65	},
+	{-66		,-66		,-99		,-99		,-66		,-99		,-99		,-99		,-66		,-99		,-66		,-66		,-66		,-66		,-99		,-66		,-66		,-99		,-99		,-99		,-66		,-99		,-66		,-99		,-99		,-99		,-66		,-99		,-99		,-99		,-66		,-66		,-99		,-99		,-99		,-66		,-99		,-99		,-99		,-66		,-99		,-66		,-66		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-66	},
+	{-68		,-68		,-99		,-99		,-68		,-99		,-99		,-99		,-68		,-99		,-68		,-68		,-68		,-68		,-99		,-68		,-68		,-99		,-99		,-99		,-68		,-99		,-68		,-99		,-99		,-99		,-68		,-99		,-99		,-99		,-68		,-68		,-99		,-99		,-99		,-68		,-99		,-99		,-99		,-68		,-99		,-68		,-68		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-68	},
+	{-67		,-67		,-99		,-99		,-67		,-99		,-99		,-99		,-67		,-99		,-67		,-67		,-67		,-67		,-99		,-67		,-67		,-99		,-99		,-99		,-67		,-99		,-67		,-99		,-99		,-99		,-67		,-99		,-99		,-99		,-67		,-67		,-99		,-99		,-99		,-67		,-99		,-99		,-99		,-67		,-99		,-67		,-67		,-99		,-99		,-99		,-99		,-99		,-99		,-99		,-67	}
 };
 const struct _TOKEN LalrSemanticRules[RULES_COUNT]= 
 {
@@ -1701,6 +1853,11 @@ const struct _TOKEN LalrSemanticRules[RULES_COUNT]=
 	{UNKNOWN, ""},
 	{UNKNOWN, ""},
 	{UNKNOWN, ""},
+	{UNKNOWN, ""},
+	{UNKNOWN, ""},
+	{UNKNOWN, ""},
+	{UNKNOWN, ""},
+	{UNKNOWN, ""},
 	{SEMANTIC_RULE, "@PUSH"},
 	{SEMANTIC_RULE, "@PUSH"},
 	{SEMANTIC_RULE, "@PUSH"},
@@ -1716,3 +1873,755 @@ const struct _TOKEN LalrSemanticRules[RULES_COUNT]=
 	{UNKNOWN, ""},
 	{UNKNOWN, ""}
 };
+const HASH_TABLE_ENTRY KeywordHashTableEntries[KEYWORD_HASH_TABLE_SIZE]= 
+{
+	{"wcslen", 1},
+	{NULL, 0},
+	{"map_count", 1},
+	{"low", 1},
+	{"~", 1},
+	{"print", 1},
+	{NULL, 0},
+	{"else", 1},
+	{"spinlock_unlock", 1},
+	{"spinlock_lock", 1},
+	{"for", 1},
+	{"_register", 1},
+	{"do", 1},
+	{"continue", 1},
+	{"spinlock_lock_custom_wait", 1},
+	{"{", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{"}", 1},
+	{"elsif", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{"_string", 1},
+	{"*", 1},
+	{"db", 1},
+	{"interlocked_increment", 1},
+	{"_hex", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"enable_event", 1},
+	{NULL, 0},
+	{"(", 1},
+	{NULL, 0},
+	{"++", 1},
+	{"map_sum", 1},
+	{NULL, 0},
+	{"_pseudo_register", 1},
+	{NULL, 0},
+	{"--", 1},
+	{NULL, 0},
+	{">>", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{"_local_id", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{"printf", 1},
+	{"<<", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"+", 1},
+	{"|", 1},
+	{"_global_id", 1},
+	{"not", 1},
+	{NULL, 0},
+	{",", 1},
+	{"/", 1},
+	{"interlocked_exchange_add", 1},
+	{"formats", 1},
+	{"test_statement", 1},
+	{"_decimal", 1},
+	{"-", 1},
+	{NULL, 0},
+	{"map_min", 1},
+	{"while", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{"ed", 1},
+	{"eb", 1},
+	{"neg", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_octal", 1},
+	{")", 1},
+	{"ref", 1},
+	{"disable_event", 1},
+	{NULL, 0},
+	{"$", 1},
+	{"interlocked_compare_exchange", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"=", 1},
+	{NULL, 0},
+	{"check_address", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{"pause", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"strlen", 1},
+	{"break", 1},
+	{"dq", 1},
+	{NULL, 0},
+	{"if", 1},
+	{"hi", 1},
+	{NULL, 0},
+	{"interlocked_decrement", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{"map_hist", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{"_binary", 1},
+	{"^", 1},
+	{NULL, 0},
+	{"interlocked_exchange", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"eq", 1},
+	{NULL, 0},
+	{"&", 1},
+	{"poi", 1},
+	{NULL, 0},
+	{NULL, 0},
+	{"%", 1},
+	{"map_max", 1},
+	{";", 1},
+	{"dw", 1},
+	{"dd", 1}
+};
+const unsigned int KeywordHashTableSeeds[KEYWORD_HASH_TABLE_BUCKETS]= 
+{
+	0, 1, 0, 3, 0, 6, 0, 1, 0, 0, 0, 2, 2, 5, 0, 0, 1, 1, 0, 0, 5, 1, 4, 0, 1, 3, 0, 2, 3, 3, 6, 0
+};
+const HASH_TABLE KeywordHashTable= {KeywordHashTableEntries, KeywordHashTableSeeds, KEYWORD_HASH_TABLE_SIZE, KEYWORD_HASH_TABLE_BUCKETS};
+const HASH_TABLE_ENTRY RegisterHashTableEntries[REGISTER_HASH_TABLE_SIZE]= 
+{
+	{"ax", REGISTER_AX},
+	{"r11l", REGISTER_R11L},
+	{"r13", REGISTER_R13},
+	{"rf", REGISTER_RF},
+	{"r12", REGISTER_R12},
+	{"esp", REGISTER_ESP},
+	{"af", REGISTER_AF},
+	{"r14l", REGISTER_R14L},
+	{"ch", REGISTER_CH},
+	{"bx", REGISTER_BX},
+	{"r15h", REGISTER_R15H},
+	{"pf", REGISTER_PF},
+	{"vm", REGISTER_VM},
+	{"cr3", REGISTER_CR3},
+	{"r11w", REGISTER_R11W},
+	{"rflags", REGISTER_RFLAGS},
+	{"edx", REGISTER_EDX},
+	{"r15l", REGISTER_R15L},
+	{"r15", REGISTER_R15},
+	{"ac", REGISTER_AC},
+	{"al", REGISTER_AL},
+	{"rsp", REGISTER_RSP},
+	{"r15w", REGISTER_R15W},
+	{"ebp", REGISTER_EBP},
+	{"sf", REGISTER_SF},
+	{NULL, 0},
+	{NULL, 0},
+	{"r10d", REGISTER_R10D},
+	{"bp", REGISTER_BP},
+	{"eip", REGISTER_EIP},
+	{"fs", REGISTER_FS},
+	{"r13d", REGISTER_R13D},
+	{NULL, 0},
+	{"if", REGISTER_IF},
+	{"r9h", REGISTER_R9H},
+	{"bh", REGISTER_BH},
+	{"vif", REGISTER_VIF},
+	{"r9l", REGISTER_R9L},
+	{"r9d", REGISTER_R9D},
+	{"ip", REGISTER_IP},
+	{"ldtr", REGISTER_LDTR},
+	{"of", REGISTER_OF},
+	{"ah", REGISTER_AH},
+	{"r9", REGISTER_R9},
+	{"cr8", REGISTER_CR8},
+	{"cr0", REGISTER_CR0},
+	{"dr0", REGISTER_DR0},
+	{"iopl", REGISTER_IOPL},
+	{"r14w", REGISTER_R14W},
+	{"eflags", REGISTER_EFLAGS},
+	{"rbp", REGISTER_RBP},
+	{"rcx", REGISTER_RCX},
+	{"ss", REGISTER_SS},
+	{"spl", REGISTER_SPL},
+	{"gs", REGISTER_GS},
+	{"r11", REGISTER_R11},
+	{"r14h", REGISTER_R14H},
+	{"nt", REGISTER_NT},
+	{"r13w", REGISTER_R13W},
+	{"r11h", REGISTER_R11H},
+	{"r8d", REGISTER_R8D},
+	{"ecx", REGISTER_ECX},
+	{"dx", REGISTER_DX},
+	{"edi", REGISTER_EDI},
+	{"r10l", REGISTER_R10L},
+	{"rip", REGISTER_RIP},
+	{"ds", REGISTER_DS},
+	{"df", REGISTER_DF},
+	{"r12w", REGISTER_R12W},
+	{"dr6", REGISTER_DR6},
+	{"rdx", REGISTER_RDX},
+	{"r10h", REGISTER_R10H},
+	{"bl", REGISTER_BL},
+	{NULL, 0},
+	{"gdtr", REGISTER_GDTR},
+	{"r13l", REGISTER_R13L},
+	{"es", REGISTER_ES},
+	{"r8w", REGISTER_R8W},
+	{"sil", REGISTER_SIL},
+	{"dr1", REGISTER_DR1},
+	{"r13h", REGISTER_R13H},
+	{"vip", REGISTER_VIP},
+	{"zf", REGISTER_ZF},
+	{"r9w", REGISTER_R9W},
+	{"tf", REGISTER_TF},
+	{"dl", REGISTER_DL},
+	{NULL, 0},
+	{"dr7", REGISTER_DR7},
+	{"r8l", REGISTER_R8L},
+	{NULL, 0},
+	{"dr2", REGISTER_DR2},
+	{"r14", REGISTER_R14},
+	{"r10", REGISTER_R10},
+	{"r12h", REGISTER_R12H},
+	{"cl", REGISTER_CL},
+	{"id", REGISTER_ID},
+	{"r8", REGISTER_R8},
+	{"rbx", REGISTER_RBX},
+	{"bpl", REGISTER_BPL},
+	{"cr4", REGISTER_CR4},
+	{"ebx", REGISTER_EBX},
+	{"si", REGISTER_SI},
+	{"di", REGISTER_DI},
+	{"r10w", REGISTER_R10W},
+	{"dh", REGISTER_DH},
+	{"cs", REGISTER_CS},
+	{"rsi", REGISTER_RSI},
+	{"cf", REGISTER_CF},
+	{"dil", REGISTER_DIL},
+	{NULL, 0},
+	{"cx", REGISTER_CX},
+	{"dr3", REGISTER_DR3},
+	{"idtr", REGISTER_IDTR},
+	{"flags", REGISTER_FLAGS},
+	{"r8h", REGISTER_R8H},
+	{"eax", REGISTER_EAX},
+	{"tr", REGISTER_TR},
+	{"r12d", REGISTER_R12D},
+	{"rax", REGISTER_RAX},
+	{"r11d", REGISTER_R11D},
+	{"cr2", REGISTER_CR2},
+	{"sp", REGISTER_SP},
+	{"r14d", REGISTER_R14D},
+	{"rdi", REGISTER_RDI},
+	{NULL, 0},
+	{"r12l", REGISTER_R12L},
+	{"esi", REGISTER_ESI},
+	{"r15d", REGISTER_R15D}
+};
+const unsigned int RegisterHashTableSeeds[REGISTER_HASH_TABLE_BUCKETS]= 
+{
+	1, 1, 5, 73, 13, 0, 83, 57, 15, 0, 6, 154, 0, 2, 2, 156, 82, 7, 12, 13, 116, 20, 56, 17, 2, 14, 2, 363, 15, 24, 1, 11
+};
+const HASH_TABLE RegisterHashTable= {RegisterHashTableEntries, RegisterHashTableSeeds, REGISTER_HASH_TABLE_SIZE, REGISTER_HASH_TABLE_BUCKETS};
+const HASH_TABLE_ENTRY PseudoRegisterHashTableEntries[PSEUDO_REGISTER_HASH_TABLE_SIZE]= 
+{
+	{"peb", PSEUDO_REGISTER_PEB},
+	{NULL, 0},
+	{"teb", PSEUDO_REGISTER_TEB},
+	{"core", PSEUDO_REGISTER_CORE},
+	{NULL, 0},
+	{"buffer", PSEUDO_REGISTER_BUFFER},
+	{NULL, 0},
+	{"context", PSEUDO_REGISTER_CONTEXT},
+	{NULL, 0},
+	{"proc", PSEUDO_REGISTER_PROC},
+	{"ip", PSEUDO_REGISTER_IP},
+	{"thread", PSEUDO_REGISTER_THREAD},
+	{"pname", PSEUDO_REGISTER_PNAME},
+	{"pid", PSEUDO_REGISTER_PID},
+	{"tid", PSEUDO_REGISTER_TID},
+	{NULL, 0}
+};
+const unsigned int PseudoRegisterHashTableSeeds[PSEUDO_REGISTER_HASH_TABLE_BUCKETS]= 
+{
+	2, 2, 1, 0
+};
+const HASH_TABLE PseudoRegisterHashTable= {PseudoRegisterHashTableEntries, PseudoRegisterHashTableSeeds, PSEUDO_REGISTER_HASH_TABLE_SIZE, PSEUDO_REGISTER_HASH_TABLE_BUCKETS};
+const HASH_TABLE_ENTRY SemanticRuleHashTableEntries[SEMANTIC_RULE_HASH_TABLE_SIZE]= 
+{
+	{"@ENABLE_EVENT", FUNC_ENABLE_EVENT},
+	{"@PRINT", FUNC_PRINT},
+	{NULL, 0},
+	{"@JNZ", FUNC_JNZ},
+	{"@DISABLE_EVENT", FUNC_DISABLE_EVENT},
+	{"@CHECK_ADDRESS", FUNC_CHECK_ADDRESS},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"@NEG", FUNC_NEG},
+	{"@INTERLOCKED_EXCHANGE_ADD", FUNC_INTERLOCKED_EXCHANGE_ADD},
+	{"@DQ", FUNC_DQ},
+	{"@HI", FUNC_HI},
+	{"@START_OF_WHILE", FUNC_START_OF_WHILE},
+	{"@MAP_HIST", FUNC_MAP_HIST},
+	{"@IGNORE_LVALUE", FUNC_IGNORE_LVALUE},
+	{NULL, 0},
+	{"@JMP", FUNC_JMP},
+	{NULL, 0},
+	{NULL, 0},
+	{"@START_OF_IF", FUNC_START_OF_IF},
+	{"@ADD", FUNC_ADD},
+	{NULL, 0},
+	{NULL, 0},
+	{"@START_OF_DO_WHILE", FUNC_START_OF_DO_WHILE},
+	{NULL, 0},
+	{NULL, 0},
+	{"@MAP_COUNT", FUNC_MAP_COUNT},
+	{NULL, 0},
+	{"@XOR", FUNC_XOR},
+	{NULL, 0},
+	{"@DEREFERENCE", FUNC_DEREFERENCE},
+	{NULL, 0},
+	{"@MAP_MAX", FUNC_MAP_MAX},
+	{NULL, 0},
+	{"@INTERLOCKED_DECREMENT", FUNC_INTERLOCKED_DECREMENT},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"@SPINLOCK_UNLOCK", FUNC_SPINLOCK_UNLOCK},
+	{"@SUB", FUNC_SUB},
+	{"@ED", FUNC_ED},
+	{NULL, 0},
+	{NULL, 0},
+	{"@INC", FUNC_INC},
+	{"@TEST_STATEMENT", FUNC_TEST_STATEMENT},
+	{NULL, 0},
+	{"@REF", FUNC_REF},
+	{"@END_OF_WHILE", FUNC_END_OF_WHILE},
+	{NULL, 0},
+	{"@WCSLEN", FUNC_WCSLEN},
+	{"@DW", FUNC_DW},
+	{"@DB", FUNC_DB},
+	{NULL, 0},
+	{"@NEQ", FUNC_NEQ},
+	{"@MAP_SUM", FUNC_MAP_SUM},
+	{"@FOR_INC_DEC", FUNC_FOR_INC_DEC},
+	{NULL, 0},
+	{"@FORMATS", FUNC_FORMATS},
+	{"@ASL", FUNC_ASL},
+	{"@SPINLOCK_LOCK_CUSTOM_WAIT", FUNC_SPINLOCK_LOCK_CUSTOM_WAIT},
+	{"@START_OF_FOR", FUNC_START_OF_FOR},
+	{NULL, 0},
+	{"@LT", FUNC_LT},
+	{"@INTERLOCKED_EXCHANGE", FUNC_INTERLOCKED_EXCHANGE},
+	{NULL, 0},
+	{NULL, 0},
+	{"@STRLEN", FUNC_STRLEN},
+	{"@MOD", FUNC_MOD},
+	{NULL, 0},
+	{"@EB", FUNC_EB},
+	{"@END_OF_DO_WHILE", FUNC_END_OF_DO_WHILE},
+	{NULL, 0},
+	{"@PAUSE", FUNC_PAUSE},
+	{NULL, 0},
+	{"@ELT", FUNC_ELT},
+	{"@", FUNC_},
+	{NULL, 0},
+	{"@JZ", FUNC_JZ},
+	{"@JMP_TO_END_AND_JZCOMPLETED", FUNC_JMP_TO_END_AND_JZCOMPLETED},
+	{"@EGT", FUNC_EGT},
+	{"@MAP_MIN", FUNC_MAP_MIN},
+	{"@PRINTF", FUNC_PRINTF},
+	{"@EQUAL", FUNC_EQUAL},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"@DIV", FUNC_DIV},
+	{"@AND", FUNC_AND},
+	{"@DD", FUNC_DD},
+	{"@START_OF_DO_WHILE_COMMANDS", FUNC_START_OF_DO_WHILE_COMMANDS},
+	{NULL, 0},
+	{"@INTERLOCKED_COMPARE_EXCHANGE", FUNC_INTERLOCKED_COMPARE_EXCHANGE},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"@SPINLOCK_LOCK", FUNC_SPINLOCK_LOCK},
+	{NULL, 0},
+	{"@LOW", FUNC_LOW},
+	{"@START_OF_FOR_OMMANDS", FUNC_START_OF_FOR_OMMANDS},
+	{"@MOV", FUNC_MOV},
+	{"@DEC", FUNC_DEC},
+	{NULL, 0},
+	{"@POI", FUNC_POI},
+	{"@INTERLOCKED_INCREMENT", FUNC_INTERLOCKED_INCREMENT},
+	{"@EQ", FUNC_EQ},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"@REFERENCE", FUNC_REFERENCE},
+	{"@ASR", FUNC_ASR},
+	{"@VARGSTART", FUNC_VARGSTART},
+	{NULL, 0},
+	{NULL, 0},
+	{"@END_OF_IF", FUNC_END_OF_IF},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"@MUL", FUNC_MUL},
+	{NULL, 0},
+	{"@GT", FUNC_GT},
+	{"@NOT", FUNC_NOT},
+	{NULL, 0},
+	{"@OR", FUNC_OR},
+	{NULL, 0}
+};
+const unsigned int SemanticRuleHashTableSeeds[SEMANTIC_RULE_HASH_TABLE_BUCKETS]= 
+{
+	3, 1, 1, 0, 1, 1, 0, 3, 5, 1, 0, 5, 1, 0, 5, 0, 2, 0, 1, 2, 0, 0, 1, 5, 0, 0, 0, 0, 2, 0, 2, 0
+};
+const HASH_TABLE SemanticRuleHashTable= {SemanticRuleHashTableEntries, SemanticRuleHashTableSeeds, SEMANTIC_RULE_HASH_TABLE_SIZE, SEMANTIC_RULE_HASH_TABLE_BUCKETS};
+const HASH_TABLE_ENTRY TerminalHashTableEntries[TERMINAL_HASH_TABLE_SIZE]= 
+{
+	{"wcslen", 36},
+	{NULL, 0},
+	{"map_count", 4},
+	{"low", 63},
+	{"~", 9},
+	{"print", 66},
+	{NULL, 0},
+	{"else", 35},
+	{"spinlock_unlock", 70},
+	{"spinlock_lock", 3},
+	{"for", 59},
+	{"_register", 28},
+	{"do", 73},
+	{"continue", 2},
+	{"spinlock_lock_custom_wait", 12},
+	{"{", 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"}", 13},
+	{"elsif", 41},
+	{NULL, 0},
+	{NULL, 0},
+	{"_string", 30},
+	{"*", 45},
+	{"db", 62},
+	{"interlocked_increment", 56},
+	{"_hex", 22},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"enable_event", 72},
+	{NULL, 0},
+	{"(", 48},
+	{NULL, 0},
+	{"++", 24},
+	{"map_sum", 5},
+	{NULL, 0},
+	{"_pseudo_register", 43},
+	{NULL, 0},
+	{"--", 8},
+	{NULL, 0},
+	{">>", 16},
+	{NULL, 0},
+	{NULL, 0},
+	{"_local_id", 44},
+	{NULL, 0},
+	{NULL, 0},
+	{"printf", 27},
+	{"<<", 58},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"+", 6},
+	{"|", 29},
+	{"_global_id", 39},
+	{"not", 69},
+	{NULL, 0},
+	{",", 61},
+	{"/", 57},
+	{"interlocked_exchange_add", 31},
+	{"formats", 21},
+	{"test_statement", 38},
+	{"_decimal", 10},
+	{"-", 7},
+	{NULL, 0},
+	{"map_min", 60},
+	{"while", 52},
+	{NULL, 0},
+	{NULL, 0},
+	{"ed", 53},
+	{"eb", 34},
+	{"neg", 47},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_octal", 11},
+	{")", 23},
+	{"ref", 64},
+	{"disable_event", 54},
+	{NULL, 0},
+	{"$", 32},
+	{"interlocked_compare_exchange", 65},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"=", 67},
+	{NULL, 0},
+	{"check_address", 15},
+	{NULL, 0},
+	{NULL, 0},
+	{"pause", 33},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"strlen", 68},
+	{"break", 20},
+	{"dq", 71},
+	{NULL, 0},
+	{"if", 40},
+	{"hi", 51},
+	{NULL, 0},
+	{"interlocked_decrement", 14},
+	{NULL, 0},
+	{NULL, 0},
+	{"map_hist", 37},
+	{NULL, 0},
+	{NULL, 0},
+	{"_binary", 18},
+	{"^", 19},
+	{NULL, 0},
+	{"interlocked_exchange", 42},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"eq", 26},
+	{NULL, 0},
+	{"&", 50},
+	{"poi", 46},
+	{NULL, 0},
+	{NULL, 0},
+	{"%", 17},
+	{"map_max", 49},
+	{";", 1},
+	{"dw", 25},
+	{"dd", 55}
+};
+const unsigned int TerminalHashTableSeeds[TERMINAL_HASH_TABLE_BUCKETS]= 
+{
+	0, 1, 0, 3, 0, 6, 0, 1, 0, 0, 0, 2, 2, 5, 0, 0, 1, 1, 0, 0, 5, 1, 4, 0, 1, 3, 0, 2, 3, 3, 6, 0
+};
+const HASH_TABLE TerminalHashTable= {TerminalHashTableEntries, TerminalHashTableSeeds, TERMINAL_HASH_TABLE_SIZE, TERMINAL_HASH_TABLE_BUCKETS};
+const HASH_TABLE_ENTRY NonTerminalHashTableEntries[NONTERMINAL_HASH_TABLE_SIZE]= 
+{
+	{"DO_WHILE_STATEMENT", 36},
+	{NULL, 0},
+	{"E9", 24},
+	{NULL, 0},
+	{"ELSIF_STATEMENT'", 37},
+	{"E1'", 30},
+	{NULL, 0},
+	{"E5'", 23},
+	{NULL, 0},
+	{"DEC'", 26},
+	{"STATEMENT", 16},
+	{"INC_DEC'", 9},
+	{NULL, 0},
+	{"WHILE_STATEMENT", 44},
+	{"E7", 42},
+	{"FOR_STATEMENT", 6},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"E7'", 20},
+	{"E8'", 0},
+	{"E3'", 11},
+	{"E2'", 31},
+	{"E8", 15},
+	{"E2", 18},
+	{NULL, 0},
+	{"EXPRESSION", 33},
+	{"INC'", 17},
+	{"E6'", 34},
+	{NULL, 0},
+	{"STRING", 41},
+	{"CALL_FUNC_STATEMENT", 8},
+	{NULL, 0},
+	{"SIMPLE_ASSIGNMENT'", 12},
+	{"E10", 27},
+	{"E4", 14},
+	{"E4'", 10},
+	{"ELSIF_STATEMENT", 7},
+	{"E12", 38},
+	{"IF_STATEMENT", 2},
+	{"E13", 4},
+	{NULL, 0},
+	{"VA", 5},
+	{"NULL", 3},
+	{NULL, 0},
+	{NULL, 0},
+	{"BOOLEAN_EXPRESSION", 28},
+	{NULL, 0},
+	{"END_OF_IF", 19},
+	{"S", 1},
+	{"ASSIGN_STATEMENT", 32},
+	{"E9'", 43},
+	{"ELSE_STATEMENT", 22},
+	{"E5", 21},
+	{"E1", 40},
+	{NULL, 0},
+	{NULL, 0},
+	{"E3", 13},
+	{"INC_DEC", 39},
+	{"L_VALUE", 35},
+	{"E6", 29},
+	{"SIMPLE_ASSIGNMENT", 25},
+	{"E0'", 45}
+};
+const unsigned int NonTerminalHashTableSeeds[NONTERMINAL_HASH_TABLE_BUCKETS]= 
+{
+	3, 1, 9, 5, 0, 1, 3, 0, 9, 0, 0, 4, 1, 2, 1, 2
+};
+const HASH_TABLE NonTerminalHashTable= {NonTerminalHashTableEntries, NonTerminalHashTableSeeds, NONTERMINAL_HASH_TABLE_SIZE, NONTERMINAL_HASH_TABLE_BUCKETS};
+const HASH_TABLE_ENTRY LalrTerminalHashTableEntries[LALR_TERMINAL_HASH_TABLE_SIZE]= 
+{
+	{NULL, 0},
+	{"low", 46},
+	{"_octal", 7},
+	{NULL, 0},
+	{NULL, 0},
+	{NULL, 0},
+	{"_global_id", 25},
+	{"<", 8},
+	{"-", 4},
+	{NULL, 0},
+	{"ed", 38},
+	{"*", 31},
+	{">>", 10},
+	{">", 16},
+	{"||", 12},
+	{"%", 11},
+	{"_local_id", 29},
+	{NULL, 0},
+	{"_hex", 14},
+	{"interlocked_compare_exchange", 47},
+	{"^", 13},
+	{"hi", 37},
+	{"_binary", 9},
+	{"+", 0},
+	{"map_count", 2},
+	{"~", 5},
+	{"!=", 39},
+	{NULL, 0},
+	{"eb", 23},
+	{NULL, 0},
+	{"$", 22},
+	{"_decimal", 6},
+	{NULL, 0},
+	{NULL, 0},
+	{"not", 48},
+	{"map_max", 36},
+	{"interlocked_exchange_add", 21},
+	{"map_min", 43},
+	{",", 45},
+	{"<=", 1},
+	{"eq", 18},
+	{"db", 44},
+	{"map_hist", 24},
+	{">=", 26},
+	{"dq", 49},
+	{"_register", 19},
+	{"==", 30},
+	{"neg", 33},
+	{"interlocked_exchange", 27},
+	{NULL, 0},
+	{NULL, 0},
+	{")", 15},
+	{"(", 34},
+	{"_pseudo_register", 28},
+	{"/", 41},
+	{"&", 35},
+	{"&&", 50},
+	{"|", 20},
+	{"dw", 17},
+	{"map_sum", 3},
+	{NULL, 0},
+	{"poi", 32},
+	{"<<", 42},
+	{"dd", 40}
+};
+const unsigned int LalrTerminalHashTableSeeds[LALR_TERMINAL_HASH_TABLE_BUCKETS]= 
+{
+	4, 0, 2, 4, 4, 1, 3, 3, 9, 3, 29, 5, 21, 13, 1, 5
+};
+const HASH_TABLE LalrTerminalHashTable= {LalrTerminalHashTableEntries, LalrTerminalHashTableSeeds, LALR_TERMINAL_HASH_TABLE_SIZE, LALR_TERMINAL_HASH_TABLE_BUCKETS};
+const HASH_TABLE_ENTRY LalrNonTerminalHashTableEntries[LALR_NONTERMINAL_HASH_TABLE_SIZE]= 
+{
+	{"E6'", 24},
+	{"E9'", 16},
+	{"E5", 12},
+	{"E10", 18},
+	{"E4'", 4},
+	{"E0'", 30},
+	{"E2", 10},
+	{"B1'", 7},
+	{"E2'", 22},
+	{"E8'", 0},
+	{"E4", 8},
+	{"CMP", 21},
+	{"E7", 28},
+	{NULL, 0},
+	{"E9", 14},
+	{"E1", 27},
+	{"B3", 15},
+	{"E8", 9},
+	{"B2", 29},
+	{"E7'", 11},
+	{"B1", 17},
+	{"E5'", 13},
+	{"E3'", 5},
+	{"S", 1},
+	{"E1'", 20},
+	{"B2'", 3},
+	{"E3", 6},
+	{"E6", 19},
+	{"EXP", 23},
+	{"BE", 25},
+	{"E13", 2},
+	{"E12", 26}
+};
+const unsigned int LalrNonTerminalHashTableSeeds[LALR_NONTERMINAL_HASH_TABLE_BUCKETS]= 
+{
+	0, 0, 0, 0, 31, 186, 121, 7
+};
+const HASH_TABLE LalrNonTerminalHashTable= {LalrNonTerminalHashTableEntries, LalrNonTerminalHashTableSeeds, LALR_NONTERMINAL_HASH_TABLE_SIZE, LALR_NONTERMINAL_HASH_TABLE_BUCKETS};
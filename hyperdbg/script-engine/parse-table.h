@@ -1,19 +1,19 @@
 #pragma once
 #ifndef PARSE_TABLE_H
 #define PARSE_TABLE_H
-#define RULES_COUNT 136
-#define TERMINAL_COUNT 69
+#define RULES_COUNT 146
+#define TERMINAL_COUNT 74
 #define NONETERMINAL_COUNT 46
 #define START_VARIABLE "S"
 #define MAX_RHS_LEN 15
-#define KEYWORD_LIST_LENGTH 52
+#define KEYWORD_LIST_LENGTH 62
 #define OPERATORS_ONE_OPERAND_LIST_LENGTH 4
 #define OPERATORS_TWO_OPERAND_LIST_LENGTH 16
 #define REGISTER_MAP_LIST_LENGTH 120
 #define PSEUDO_REGISTER_MAP_LIST_LENGTH 11
-#define SEMANTIC_RULES_MAP_LIST_LENGTH 91
-#define THREEOPFUNC1_LENGTH 1
-#define TWOOPFUNC1_LENGTH 5
+#define SEMANTIC_RULES_MAP_LIST_LENGTH 101
+#define THREEOPFUNC1_LENGTH 4
+#define TWOOPFUNC1_LENGTH 7
 #define TWOOPFUNC2_LENGTH 1
 #define ONEOPFUNC1_LENGTH 15
 #define ONEOPFUNC2_LENGTH 7
@@ -40,11 +40,11 @@ extern const SYMBOL_MAP RegisterMapList[];
 extern const SYMBOL_MAP PseudoRegisterMapList[];
 
 
-#define LALR_RULES_COUNT 78
-#define LALR_TERMINAL_COUNT 46
+#define LALR_RULES_COUNT 83
+#define LALR_TERMINAL_COUNT 51
 #define LALR_NONTERMINAL_COUNT 31
 #define LALR_MAX_RHS_LEN 9
-#define LALR_STATE_COUNT 183
+#define LALR_STATE_COUNT 219
 extern const struct _TOKEN LalrLhs[RULES_COUNT];
 extern const struct _TOKEN LalrRhs[RULES_COUNT][MAX_RHS_LEN];
 extern const unsigned int LalrRhsSize[RULES_COUNT];
@@ -53,4 +53,29 @@ extern const char* LalrTerminalMap[TERMINAL_COUNT];
 extern const int LalrGotoTable[LALR_STATE_COUNT][LALR_NONTERMINAL_COUNT];
 extern const int LalrActionTable[LALR_STATE_COUNT][LALR_TERMINAL_COUNT];
 extern const struct _TOKEN LalrSemanticRules[RULES_COUNT];
+
+#define KEYWORD_HASH_TABLE_SIZE 128
+#define KEYWORD_HASH_TABLE_BUCKETS 32
+extern const HASH_TABLE KeywordHashTable;
+#define REGISTER_HASH_TABLE_SIZE 128
+#define REGISTER_HASH_TABLE_BUCKETS 32
+extern const HASH_TABLE RegisterHashTable;
+#define PSEUDO_REGISTER_HASH_TABLE_SIZE 16
+#define PSEUDO_REGISTER_HASH_TABLE_BUCKETS 4
+extern const HASH_TABLE PseudoRegisterHashTable;
+#define SEMANTIC_RULE_HASH_TABLE_SIZE 128
+#define SEMANTIC_RULE_HASH_TABLE_BUCKETS 32
+extern const HASH_TABLE SemanticRuleHashTable;
+#define TERMINAL_HASH_TABLE_SIZE 128
+#define TERMINAL_HASH_TABLE_BUCKETS 32
+extern const HASH_TABLE TerminalHashTable;
+#define NONTERMINAL_HASH_TABLE_SIZE 64
+#define NONTERMINAL_HASH_TABLE_BUCKETS 16
+extern const HASH_TABLE NonTerminalHashTable;
+#define LALR_TERMINAL_HASH_TABLE_SIZE 64
+#define LALR_TERMINAL_HASH_TABLE_BUCKETS 16
+extern const HASH_TABLE LalrTerminalHashTable;
+#define LALR_NONTERMINAL_HASH_TABLE_SIZE 32
+#define LALR_NONTERMINAL_HASH_TABLE_BUCKETS 8
+extern const HASH_TABLE LalrNonTerminalHashTable;
 #endif
@@ -32,5 +32,6 @@
 #    include "ScriptEngineCommonDefinitions.h"
 #    include "script-engine.h"
 #    include "parse-table.h"
+#    include "optimizer.h"
 
 #endif //PCH_H
@@ -0,0 +1,215 @@
+/**
+ * @file windows.h
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief The subset of the Windows headers that the script engine uses
+ * @details It's only used by the portable test of the script engine, so
+ * the parser (script-engine) and the evaluator (ScriptEngineEval.h) can
+ * be built without the Windows SDK
+ * @version 0.1
+ * @date 2021-11-21
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+#include <stdio.h>
+#include <unistd.h>
+
+//////////////////////////////////////////////////
+//				    Types                       //
+//////////////////////////////////////////////////
+
+#define __int64 long long
+
+typedef unsigned long long QWORD;
+typedef unsigned __int64   UINT64, *PUINT64;
+typedef unsigned long      DWORD;
+typedef int                BOOL;
+typedef unsigned char      BYTE;
+typedef unsigned short     WORD;
+typedef int                INT;
+typedef unsigned int       UINT;
+typedef unsigned __int64   ULONG64, *PULONG64;
+typedef unsigned __int64   DWORD64, *PDWORD64;
+typedef char               CHAR;
+typedef wchar_t            WCHAR;
+typedef unsigned char      UCHAR;
+typedef short              SHORT;
+typedef unsigned short     USHORT;
+typedef unsigned long      ULONG;
+typedef UCHAR              BOOLEAN;
+typedef BOOLEAN *          PBOOLEAN;
+typedef signed char        INT8, *PINT8;
+typedef signed short       INT16, *PINT16;
+typedef signed int         INT32, *PINT32;
+typedef signed __int64     INT64, *PINT64;
+typedef unsigned char      UINT8, *PUINT8;
+typedef unsigned short     UINT16, *PUINT16;
+typedef unsigned int       UINT32, *PUINT32;
+typedef uint32_t           DWORD32;
+typedef long               LONG;
+typedef long long          LONGLONG, LONG64;
+typedef unsigned long long ULONGLONG, SIZE_T, ULONG_PTR, UINT_PTR;
+typedef void *             PVOID, *HANDLE, *HMODULE;
+typedef CHAR *             PCHAR, *LPSTR;
+typedef const CHAR *       LPCSTR;
+typedef UCHAR *            PUCHAR;
+typedef ULONG *            PULONG;
+typedef WCHAR *            PWCHAR, *PWSTR, *LPWSTR;
+typedef const WCHAR *      LPCWSTR;
+typedef long               NTSTATUS;
+
+typedef struct _LIST_ENTRY
+{
+    struct _LIST_ENTRY * Flink;
+    struct _LIST_ENTRY * Blink;
+
+} LIST_ENTRY, *PLIST_ENTRY;
+
+//////////////////////////////////////////////////
+//				   Definitions                  //
+//////////////////////////////////////////////////
+
+#define VOID  void
+#define FALSE 0
+#define TRUE  1
+
+#define WINAPI
+#define __declspec(x)
+
+#define MAX_PATH  260
+#define MAXUINT64 (~0ULL)
+#define MAXUINT32 0xffffffffU
+#define MAXUINT16 0xffffU
+#define MAXUINT8  0xffU
+#define MAXULONG  0xffffffffUL
+
+#define PROCESS_QUERY_INFORMATION 0x400
+#define PROCESS_VM_READ           0x10
+
+#define FIELD_OFFSET(Type, Field)         offsetof(Type, Field)
+#define RtlZeroMemory(Destination, Length) memset((Destination), 0, (Length))
+#define RtlCopyMemory(Destination, Source, Length) \
+    memcpy((Destination), (Source), (Length))
+#define UNREFERENCED_PARAMETER(P) (void)(P)
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+static inline LONG64
+InterlockedExchange64(volatile LONG64 * Target, LONG64 Value)
+{
+    return __atomic_exchange_n(Target, Value, __ATOMIC_SEQ_CST);
+}
+
+static inline LONG64
+InterlockedExchangeAdd64(volatile LONG64 * Addend, LONG64 Value)
+{
+    return __atomic_fetch_add(Addend, Value, __ATOMIC_SEQ_CST);
+}
+
+static inline LONG64
+InterlockedIncrement64(volatile LONG64 * Addend)
+{
+    return __atomic_add_fetch(Addend, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline LONG64
+InterlockedDecrement64(volatile LONG64 * Addend)
+{
+    return __atomic_sub_fetch(Addend, 1, __ATOMIC_SEQ_CST);
+}
+
+static inline LONG64
+InterlockedCompareExchange64(volatile LONG64 * Destination, LONG64 Exchange, LONG64 Comperand)
+{
+    __atomic_compare_exchange_n(Destination, &Comperand, Exchange, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return Comperand;
+}
+
+//
+// The pseudo-registers of the user-mode evaluator
+//
+static inline DWORD
+GetCurrentThreadId()
+{
+    return (DWORD)getpid();
+}
+
+static inline DWORD
+GetCurrentProcessorNumber()
+{
+    return 0;
+}
+
+static inline DWORD
+GetCurrentProcessId()
+{
+    return (DWORD)getpid();
+}
+
+static inline HANDLE
+GetCurrentProcess()
+{
+    return NULL;
+}
+
+//
+// There is no process handle, so $pname and $peb are NULL
+//
+static inline HANDLE
+OpenProcess(DWORD DesiredAccess, BOOL InheritHandle, DWORD ProcessId)
+{
+    return NULL;
+}
+
+static inline BOOL
+CloseHandle(HANDLE Handle)
+{
+    return TRUE;
+}
+
+static inline DWORD
+GetModuleFileNameEx(HANDLE Process, HMODULE Module, LPSTR FileName, DWORD Size)
+{
+    return 0;
+}
+
+static inline LPSTR
+PathFindFileNameA(LPSTR Path)
+{
+    return Path;
+}
+
+static inline HMODULE
+GetModuleHandleA(LPCSTR ModuleName)
+{
+    return NULL;
+}
+
+static inline HMODULE
+LoadLibraryA(LPCSTR FileName)
+{
+    return NULL;
+}
+
+static inline HMODULE
+LoadLibraryW(LPCWSTR FileName)
+{
+    return NULL;
+}
+
+static inline PVOID
+GetProcAddress(HMODULE Module, LPCSTR ProcName)
+{
+    return NULL;
+}
+
+#define GetModuleHandle GetModuleHandleA
@@ -0,0 +1,599 @@
+/**
+ * @file script-engine-test.cpp
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief Portable test of the engines of the script engine
+ * @details The test-cases of the script engine are parsed and each of
+ * them is run by the interpreter of the symbol buffer, by the bytecode
+ * and by the native code (SysV calling convention), the result of the
+ * interpreter is checked with the expected result of the test-case and
+ * the other engines should end in the same state as the interpreter
+ * @version 0.1
+ * @date 2021-11-21
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include <windows.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <string>
+#include <fstream>
+
+#include "ScriptEngineCommonDefinitions.h"
+#include "Definition.h"
+
+using namespace std;
+
+VOID
+ShowMessages(const char * Fmt, ...);
+
+//
+// Include the evaluator of scripts
+//
+#define SCRIPT_ENGINE_USER_MODE
+#include "ScriptEngineEval.h"
+
+//////////////////////////////////////////////////
+//				   Definitions                  //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Maximum count of instructions that the interpreter runs for
+ * a test-case, test-cases with infinite loops are not compared
+ *
+ */
+#define SCRIPT_ENGINE_TEST_MAXIMUM_STEPS 100000
+
+/**
+ * @brief Times that each engine runs a test-case, the state of the
+ * engine is kept between the runs (like the events)
+ *
+ */
+#define SCRIPT_ENGINE_TEST_RUNS 3
+
+/**
+ * @brief Engines that run a test-case
+ *
+ */
+typedef enum _SCRIPT_ENGINE_TEST_ENGINE
+{
+    SCRIPT_ENGINE_TEST_ENGINE_INTERPRETER,
+    SCRIPT_ENGINE_TEST_ENGINE_BYTECODE,
+    SCRIPT_ENGINE_TEST_ENGINE_JIT,
+    SCRIPT_ENGINE_TEST_COUNT_OF_ENGINES
+
+} SCRIPT_ENGINE_TEST_ENGINE;
+
+/**
+ * @brief State of running a test-case by an engine
+ *
+ */
+typedef struct _SCRIPT_ENGINE_TEST_STATE
+{
+    GUEST_REGS GuestRegs;
+    UINT64     TempList[MAX_TEMP_COUNT];
+    UINT64     GlobalVariables[MAX_VAR_COUNT];
+    UINT64     LocalVariables[MAX_VAR_COUNT];
+    UINT64     Memory[8]; // the memory that @rcx points to
+    UINT64     Result;
+    BOOLEAN    HasError;
+    UINT64     Time;
+
+} SCRIPT_ENGINE_TEST_STATE, *PSCRIPT_ENGINE_TEST_STATE;
+
+//////////////////////////////////////////////////
+//				Global Variables                //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Whether the messages of the scripts are shown or not
+ *
+ */
+BOOLEAN g_ScriptEngineTestVerbose = FALSE;
+
+/**
+ * @brief Context of returning from the faults of the native code
+ *
+ */
+sigjmp_buf g_ScriptEngineTestFaultContext;
+
+//////////////////////////////////////////////////
+//				    Functions                   //
+//////////////////////////////////////////////////
+
+/**
+ * @brief Show messages of the script engine
+ *
+ * @param Fmt format string message
+ */
+VOID
+ShowMessages(const char * Fmt, ...)
+{
+    va_list Args;
+
+    if (!g_ScriptEngineTestVerbose)
+    {
+        return;
+    }
+
+    va_start(Args, Fmt);
+    vprintf(Fmt, Args);
+    va_end(Args);
+}
+
+/**
+ * @brief Get the time in nanoseconds
+ *
+ * @return UINT64
+ */
+UINT64
+ScriptEngineTestGetTime()
+{
+    struct timespec Time;
+
+    clock_gettime(CLOCK_MONOTONIC, &Time);
+
+    return (UINT64)Time.tv_sec * 1000000000ull + Time.tv_nsec;
+}
+
+/**
+ * @brief Handler of the faults of the native code
+ *
+ * @param Signal
+ */
+VOID
+ScriptEngineTestFaultHandler(int Signal)
+{
+    siglongjmp(g_ScriptEngineTestFaultContext, Signal);
+}
+
+/**
+ * @brief Initialize the state of an engine, all of the engines start
+ * from the same registers and memory
+ *
+ * @param State
+ */
+VOID
+ScriptEngineTestInitializeState(PSCRIPT_ENGINE_TEST_STATE State)
+{
+    RtlZeroMemory(State, sizeof(SCRIPT_ENGINE_TEST_STATE));
+
+    for (UINT32 i = 0; i < 16; i++)
+    {
+        ((PUINT64)&State->GuestRegs)[i] = 0x1111111111111111ull * i + i;
+    }
+
+    for (UINT32 i = 0; i < sizeof(State->Memory) / sizeof(State->Memory[0]); i++)
+    {
+        State->Memory[i] = 0x0102030405060708ull * (i + 1);
+    }
+
+    //
+    // poi, db, dq, hi and low read the memory that @rcx points to
+    //
+    State->GuestRegs.rcx = (UINT64)State->Memory;
+}
+
+/**
+ * @brief Run a test-case by an engine
+ *
+ * @param Engine
+ * @param State
+ * @param CodeBuffer
+ * @param Bytecode
+ * @param Code The native code
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineTestRun(SCRIPT_ENGINE_TEST_ENGINE Engine,
+                    PSCRIPT_ENGINE_TEST_STATE State,
+                    PSYMBOL_BUFFER            CodeBuffer,
+                    PSCRIPT_ENGINE_BYTECODE   Bytecode,
+                    PVOID                     Code)
+{
+    SCRIPT_ENGINE_VARIABLES_LIST VariablesList = {0};
+    ACTION_BUFFER                ActionBuffer  = {0};
+    SYMBOL                       ErrorSymbol   = {0};
+
+    VariablesList.TempList            = State->TempList;
+    VariablesList.GlobalVariablesList = State->GlobalVariables;
+    VariablesList.LocalVariablesList  = State->LocalVariables;
+
+    g_CurrentExprEvalResult         = NULL;
+    g_CurrentExprEvalResultHasError = FALSE;
+
+    switch (Engine)
+    {
+    case SCRIPT_ENGINE_TEST_ENGINE_INTERPRETER:
+
+        State->HasError = FALSE;
+
+        for (int i = 0; i < CodeBuffer->Pointer;)
+        {
+            if (ScriptEngineExecute(&State->GuestRegs, ActionBuffer, &VariablesList, CodeBuffer, &i, &ErrorSymbol) == TRUE)
+            {
+                State->HasError = TRUE;
+                break;
+            }
+        }
+        break;
+
+    case SCRIPT_ENGINE_TEST_ENGINE_BYTECODE:
+
+        State->HasError = ScriptEngineExecuteBytecode(&State->GuestRegs,
+                                                      ActionBuffer,
+                                                      &VariablesList,
+                                                      CodeBuffer,
+                                                      Bytecode,
+                                                      &ErrorSymbol);
+        break;
+
+    case SCRIPT_ENGINE_TEST_ENGINE_JIT:
+
+        State->HasError = ScriptEngineExecuteJit(&State->GuestRegs,
+                                                 ActionBuffer,
+                                                 &VariablesList,
+                                                 CodeBuffer,
+                                                 Code,
+                                                 &ErrorSymbol);
+        break;
+
+    default:
+        break;
+    }
+
+    State->Result = State->HasError ? NULL : g_CurrentExprEvalResult;
+}
+
+/**
+ * @brief Check whether the interpreter finishes a test-case, the
+ * test-cases might have infinite loops
+ *
+ * @param CodeBuffer
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineTestIsFinished(PSYMBOL_BUFFER CodeBuffer)
+{
+    SCRIPT_ENGINE_TEST_STATE     State;
+    SCRIPT_ENGINE_VARIABLES_LIST VariablesList = {0};
+    ACTION_BUFFER                ActionBuffer  = {0};
+    SYMBOL                       ErrorSymbol   = {0};
+    UINT32                       Steps         = 0;
+
+    ScriptEngineTestInitializeState(&State);
+
+    VariablesList.TempList            = State.TempList;
+    VariablesList.GlobalVariablesList = State.GlobalVariables;
+    VariablesList.LocalVariablesList  = State.LocalVariables;
+
+    for (int i = 0; i < CodeBuffer->Pointer;)
+    {
+        if (++Steps > SCRIPT_ENGINE_TEST_MAXIMUM_STEPS)
+        {
+            return FALSE;
+        }
+
+        if (ScriptEngineExecute(&State.GuestRegs, ActionBuffer, &VariablesList, CodeBuffer, &i, &ErrorSymbol) == TRUE)
+        {
+            break;
+        }
+    }
+
+    return TRUE;
+}
+
+/**
+ * @brief Run a test-case by all of the engines and compare them
+ *
+ * @param Expr The statement of the test-case
+ * @param States The final state of each engine
+ *
+ * @return BOOLEAN FALSE if the test-case is not compared (syntax error
+ * or infinite loop), the results are in States
+ */
+BOOLEAN
+ScriptEngineTestRunTestCase(string Expr, SCRIPT_ENGINE_TEST_STATE States[SCRIPT_ENGINE_TEST_COUNT_OF_ENGINES], PBOOLEAN IsEngineFailed)
+{
+    PSCRIPT_ENGINE_BYTECODE Bytecode   = NULL;
+    UINT32 *                Labels     = NULL;
+    PVOID                   Code       = NULL;
+    UINT32                  CodeSize   = 0;
+    BOOLEAN                 IsCompiled = FALSE;
+    PSYMBOL_BUFFER          CodeBuffer;
+    UINT64                  Start;
+
+    *IsEngineFailed = FALSE;
+
+    CodeBuffer = ScriptEngineParse((char *)Expr.c_str());
+
+    if (CodeBuffer->Message != NULL || !ScriptEngineTestIsFinished(CodeBuffer))
+    {
+        RemoveSymbolBuffer(CodeBuffer);
+        return FALSE;
+    }
+
+    Bytecode = (PSCRIPT_ENGINE_BYTECODE)malloc(SCRIPT_ENGINE_BYTECODE_SIZE(CodeBuffer->Pointer));
+
+    if (Bytecode == NULL || !ScriptEngineLowerToBytecode(CodeBuffer, Bytecode))
+    {
+        printf("err, unable to lower the statement to bytecode : %s\n", Expr.c_str());
+        free(Bytecode);
+        RemoveSymbolBuffer(CodeBuffer);
+        *IsEngineFailed = TRUE;
+        return TRUE;
+    }
+
+    //
+    // The native code is written in a read-write memory and then it's
+    // changed to read-execute
+    //
+    CodeSize = (UINT32)SCRIPT_ENGINE_JIT_SIZE(Bytecode->CountOfInstructions);
+    Code     = mmap(NULL, CodeSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    Labels   = (UINT32 *)malloc(SCRIPT_ENGINE_JIT_LABELS_SIZE(Bytecode->CountOfInstructions));
+
+    IsCompiled = Code != MAP_FAILED && Labels != NULL &&
+                 ScriptEngineJitCompile(Bytecode, Code, CodeSize, Labels) &&
+                 mprotect(Code, CodeSize, PROT_READ | PROT_EXEC) == 0;
+
+    free(Labels);
+
+    if (!IsCompiled)
+    {
+        printf("err, unable to compile the statement to native code : %s\n", Expr.c_str());
+        *IsEngineFailed = TRUE;
+    }
+
+    for (UINT32 Engine = 0; Engine < SCRIPT_ENGINE_TEST_COUNT_OF_ENGINES && !*IsEngineFailed; Engine++)
+    {
+        ScriptEngineTestInitializeState(&States[Engine]);
+
+        //
+        // A wrong translation is reported instead of crashing the test
+        //
+        if (Engine == SCRIPT_ENGINE_TEST_ENGINE_JIT && sigsetjmp(g_ScriptEngineTestFaultContext, 1) != 0)
+        {
+            printf("err, the native code caused a fault : %s\n", Expr.c_str());
+            *IsEngineFailed = TRUE;
+            break;
+        }
+
+        Start = ScriptEngineTestGetTime();
+
+        for (UINT32 i = 0; i < SCRIPT_ENGINE_TEST_RUNS; i++)
+        {
+            ScriptEngineTestRun((SCRIPT_ENGINE_TEST_ENGINE)Engine, &States[Engine], CodeBuffer, Bytecode, Code);
+        }
+
+        States[Engine].Time = ScriptEngineTestGetTime() - Start;
+
+        //
+        // The memory is pointed by @rcx of each state, the address is
+        // not compared
+        //
+        States[Engine].GuestRegs.rcx = NULL;
+    }
+
+    if (Code != MAP_FAILED)
+    {
+        munmap(Code, CodeSize);
+    }
+
+    free(Bytecode);
+    RemoveSymbolBuffer(CodeBuffer);
+
+    return TRUE;
+}
+
+/**
+ * @brief Check the result of a test-case with the expected result
+ * (the same way as '? test')
+ * @details The expected results are generated by Python, so some of
+ * them follow the semantics of Python (e.g., the sign of % and / for
+ * negative numbers), these test-cases are counted but they don't fail
+ * the test, the engines are compared with the interpreter instead
+ *
+ * @param State
+ * @param Expected The expected result line of the test-case
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineTestCheckExpectedResult(PSCRIPT_ENGINE_TEST_STATE State, string Expected)
+{
+    if (!Expected.compare("$error$"))
+    {
+        return State->HasError;
+    }
+
+    return !State->HasError && State->Result == strtoull(Expected.c_str(), NULL, 16);
+}
+
+/**
+ * @brief Compare the final state of an engine with the interpreter
+ * (temps are not compared as they are not visible after running the script)
+ *
+ * @param State
+ * @param Interpreter
+ *
+ * @return BOOLEAN
+ */
+BOOLEAN
+ScriptEngineTestCompareStates(PSCRIPT_ENGINE_TEST_STATE State, PSCRIPT_ENGINE_TEST_STATE Interpreter)
+{
+    return State->HasError == Interpreter->HasError &&
+           State->Result == Interpreter->Result &&
+           memcmp(&State->GuestRegs, &Interpreter->GuestRegs, sizeof(GUEST_REGS)) == 0 &&
+           memcmp(State->GlobalVariables, Interpreter->GlobalVariables, sizeof(State->GlobalVariables)) == 0 &&
+           memcmp(State->LocalVariables, Interpreter->LocalVariables, sizeof(State->LocalVariables)) == 0 &&
+           memcmp(State->Memory, Interpreter->Memory, sizeof(State->Memory)) == 0;
+}
+
+/**
+ * @brief Show the help of the test
+ *
+ * @return VOID
+ */
+VOID
+ScriptEngineTestHelp()
+{
+    printf("usage : script-engine-test [-v] [test-cases file]\n\n"
+           "\t-v : show the messages of the scripts and the test-cases that are not the expected result\n"
+           "\tthe default file is '%s'\n",
+           SCRIPT_TEST_CASE_FILE_NAME);
+}
+
+/**
+ * @brief main function
+ *
+ * @param argc
+ * @param argv
+ * @return int
+ */
+int
+main(int argc, char * argv[])
+{
+    SCRIPT_ENGINE_TEST_STATE States[SCRIPT_ENGINE_TEST_COUNT_OF_ENGINES];
+    SCRIPT_ENGINE_TEST_STATE OptimizedStates[SCRIPT_ENGINE_TEST_COUNT_OF_ENGINES];
+    UINT64                   TotalTimes[SCRIPT_ENGINE_TEST_COUNT_OF_ENGINES] = {0};
+    const char *             FileName                                        = SCRIPT_TEST_CASE_FILE_NAME;
+    UINT32                   CountOfTestCases                                = 0;
+    UINT32                   CountOfComparedTestCases                        = 0;
+    UINT32                   CountOfFailedTestCases                          = 0;
+    UINT32                   CountOfMismatches                               = 0;
+    BOOLEAN                  IsEngineFailed                                  = FALSE;
+    string                   Line;
+    string                   Expr;
+    string                   Expected;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-v"))
+        {
+            g_ScriptEngineTestVerbose = TRUE;
+        }
+        else if (argv[i][0] == '-')
+        {
+            ScriptEngineTestHelp();
+            return 1;
+        }
+        else
+        {
+            FileName = argv[i];
+        }
+    }
+
+    ifstream File(FileName);
+
+    if (!File.is_open())
+    {
+        printf("err, could not find '%s' file for test-cases\n", FileName);
+        return 1;
+    }
+
+    signal(SIGSEGV, ScriptEngineTestFaultHandler);
+    signal(SIGBUS, ScriptEngineTestFaultHandler);
+    signal(SIGILL, ScriptEngineTestFaultHandler);
+
+    //
+    // Each test-case is the number, the statement, the expected
+    // result and $end$
+    //
+    while (getline(File, Line))
+    {
+        if (!getline(File, Expr) || !getline(File, Expected) || !getline(File, Line))
+        {
+            break;
+        }
+
+        CountOfTestCases++;
+        Expr.append(" ");
+
+        //
+        // Most of the test-cases are constant expressions that are folded
+        // by the optimizer, so each test-case is also run without the
+        // optimizer to test the instructions of the engines
+        //
+        for (int IsOptimized = 1; IsOptimized >= 0; IsOptimized--)
+        {
+            ScriptEngineSetOptimizer(IsOptimized);
+
+            if (!ScriptEngineTestRunTestCase(Expr, States, &IsEngineFailed))
+            {
+                //
+                // The statement has a syntax error or an infinite loop
+                //
+                break;
+            }
+
+            if (IsOptimized)
+            {
+                CountOfComparedTestCases++;
+            }
+
+            if (IsEngineFailed)
+            {
+                CountOfMismatches++;
+                continue;
+            }
+
+            if (IsOptimized)
+            {
+                if (!ScriptEngineTestCheckExpectedResult(&States[SCRIPT_ENGINE_TEST_ENGINE_INTERPRETER], Expected))
+                {
+                    CountOfFailedTestCases++;
+                    ShowMessages("the result of the interpreter is not the expected result (%s) : %s\n",
+                                 Expected.c_str(),
+                                 Expr.c_str());
+                }
+
+                for (UINT32 Engine = 0; Engine < SCRIPT_ENGINE_TEST_COUNT_OF_ENGINES; Engine++)
+                {
+                    TotalTimes[Engine] += States[Engine].Time;
+                }
+
+                memcpy(OptimizedStates, States, sizeof(States));
+            }
+            else if (!ScriptEngineTestCompareStates(&States[SCRIPT_ENGINE_TEST_ENGINE_INTERPRETER], &OptimizedStates[SCRIPT_ENGINE_TEST_ENGINE_INTERPRETER]))
+            {
+                CountOfMismatches++;
+                printf("err, results of the optimized and the not optimized code are different for : %s\n", Expr.c_str());
+            }
+
+            if (!ScriptEngineTestCompareStates(&States[SCRIPT_ENGINE_TEST_ENGINE_BYTECODE], &States[SCRIPT_ENGINE_TEST_ENGINE_INTERPRETER]) ||
+                !ScriptEngineTestCompareStates(&States[SCRIPT_ENGINE_TEST_ENGINE_JIT], &States[SCRIPT_ENGINE_TEST_ENGINE_INTERPRETER]))
+            {
+                CountOfMismatches++;
+                printf("err, results of the interpreter, the bytecode and the jit are different for%s code : %s\n",
+                       IsOptimized ? " the optimized" : " the not optimized",
+                       Expr.c_str());
+            }
+        }
+    }
+
+    File.close();
+
+    if (CountOfComparedTestCases == 0)
+    {
+        printf("err, there is no test-case to compare\n");
+        return 1;
+    }
+
+    printf("test-cases : %u, compared : %u, not the expected result : %u, mismatches of the engines : %u\n",
+           CountOfTestCases,
+           CountOfComparedTestCases,
+           CountOfFailedTestCases,
+           CountOfMismatches);
+
+    printf("ns per run : interpreter %llu, bytecode %llu, jit %llu\n",
+           TotalTimes[SCRIPT_ENGINE_TEST_ENGINE_INTERPRETER] / ((UINT64)CountOfComparedTestCases * SCRIPT_ENGINE_TEST_RUNS),
+           TotalTimes[SCRIPT_ENGINE_TEST_ENGINE_BYTECODE] / ((UINT64)CountOfComparedTestCases * SCRIPT_ENGINE_TEST_RUNS),
+           TotalTimes[SCRIPT_ENGINE_TEST_ENGINE_JIT] / ((UINT64)CountOfComparedTestCases * SCRIPT_ENGINE_TEST_RUNS));
+
+    return CountOfMismatches == 0 ? 0 : 1;
+}
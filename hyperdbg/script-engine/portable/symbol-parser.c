@@ -0,0 +1,85 @@
+/**
+ * @file symbol-parser.c
+ * @author Sina Karvandi (sina@rayanfam.com)
+ * @brief The symbol parser of the portable test of the script engine
+ * @details The symbol parser needs DIA (Windows), so the portable test
+ * has no symbol, the names of functions and variables are not found
+ * @version 0.1
+ * @date 2021-11-21
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ *
+ */
+#include "pch.h"
+
+VOID
+SymSetTextMessageCallback(PVOID Handler)
+{
+}
+
+UINT64
+SymConvertNameToAddress(const char * FunctionOrVariableName, PBOOLEAN WasFound)
+{
+    *WasFound = FALSE;
+    return NULL;
+}
+
+UINT32
+SymLoadFileSymbol(UINT64 BaseAddress, const char * PdbFileName)
+{
+    return -1;
+}
+
+UINT32
+SymUnloadAllSymbols()
+{
+    return 0;
+}
+
+UINT32
+SymUnloadModuleSymbol(char * ModuleName)
+{
+    return -1;
+}
+
+UINT32
+SymSearchSymbolForMask(const char * SearchMask)
+{
+    return 0;
+}
+
+BOOLEAN
+SymGetFieldOffset(CHAR * TypeName, CHAR * FieldName, DWORD32 * FieldOffset)
+{
+    return FALSE;
+}
+
+BOOLEAN
+SymCreateSymbolTableForDisassembler(void * CallbackFunction)
+{
+    return FALSE;
+}
+
+BOOLEAN
+SymConvertFileToPdbPath(const char * LocalFilePath, char * ResultPath)
+{
+    return FALSE;
+}
+
+BOOLEAN
+SymConvertFileToPdbFileAndGuidAndAgeDetails(const char * LocalFilePath, char * PdbFilePath, char * GuidAndAgeDetails)
+{
+    return FALSE;
+}
+
+BOOLEAN
+SymbolInitLoad(PVOID BufferToStoreDetails, UINT32 StoredLength, BOOLEAN DownloadIfAvailable, const char * SymbolPath, BOOLEAN IsSilentLoad)
+{
+    return FALSE;
+}
+
+BOOLEAN
+SymbolAbortLoading()
+{
+    return FALSE;
+}
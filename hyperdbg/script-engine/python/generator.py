@@ -1,5 +1,6 @@
 from ll1_parser import *
 from lalr1_parser import *
+from perfect_hash import *
 
 class Generator():
     def __init__(self): 
@@ -8,6 +9,7 @@ class Generator():
         self.CommonHeaderFile = open("..\\..\\include\\ScriptEngineCommonDefinitions.h", "w")
         self.ll1 = LL1Parser(self.SourceFile, self.HeaderFile, self.CommonHeaderFile)
         self.lalr = LALR1Parser(self.SourceFile, self.HeaderFile)
+        self.HashTable = PerfectHashTable(self.SourceFile, self.HeaderFile)
 
     def Run(self):     
 
@@ -24,6 +26,9 @@ class Generator():
 
         self.lalr.Run()
 
+        self.WriteHashTables()
+        self.HeaderFile.write("#endif\n")
+
         self.CommonHeaderFile.write("#endif\n")
 
 
@@ -33,6 +38,35 @@ class Generator():
         self.CommonHeaderFile.close()
 
 
+    # Writes hash tables of the lists that the scanner and the parser search
+    def WriteHashTables(self):
+        self.HeaderFile.write("\n")
+
+        # Keywords and terminals (IsKeyword)
+        Names = self.ll1.keywordList + self.ll1.TerminalList
+        self.HashTable.Write("KeywordHashTable", "KEYWORD_HASH_TABLE", [(X, 1) for X in Names])
+
+        # Registers and pseudo-registers
+        self.HashTable.Write("RegisterHashTable", "REGISTER_HASH_TABLE",
+                             [(X, "REGISTER_" + X.upper()) for X in self.ll1.RegistersList])
+        self.HashTable.Write("PseudoRegisterHashTable", "PSEUDO_REGISTER_HASH_TABLE",
+                             [(X, "PSEUDO_REGISTER_" + X.upper()) for X in self.ll1.PseudoRegistersList])
+
+        # Semantic rules, in the same order as SemanticRulesMapList
+        Names = self.ll1.OperatorsOneOperand + self.ll1.OperatorsTwoOperand + self.ll1.SemantiRulesList + self.ll1.keywordList
+        self.HashTable.Write("SemanticRuleHashTable", "SEMANTIC_RULE_HASH_TABLE",
+                             [("@" + X.upper(), "FUNC_" + X.upper()) for X in Names])
+
+        # Ids of terminals and nonterminals in the LL(1) and the LALR(1) tables
+        self.HashTable.Write("TerminalHashTable", "TERMINAL_HASH_TABLE",
+                             [(X, i) for i, X in enumerate(self.ll1.TerminalList)])
+        self.HashTable.Write("NonTerminalHashTable", "NONTERMINAL_HASH_TABLE",
+                             [(X, i) for i, X in enumerate(self.ll1.NonTerminalList)])
+        self.HashTable.Write("LalrTerminalHashTable", "LALR_TERMINAL_HASH_TABLE",
+                             [(X, i) for i, X in enumerate(self.lalr.TerminalList)])
+        self.HashTable.Write("LalrNonTerminalHashTable", "LALR_NONTERMINAL_HASH_TABLE",
+                             [(X, i) for i, X in enumerate(self.lalr.NonTerminalList)])
+
     def WriteCommonHeader(self):
         self.CommonHeaderFile.write(
          """#pragma once
@@ -57,6 +91,7 @@ typedef struct ACTION_BUFFER {
   long long unsigned Tag;
   long long unsigned CurrentAction;
   char ImmediatelySendTheResults;
+  char DeferredFormatting;
   long long unsigned Context;
 } ACTION_BUFFER, *PACTION_BUFFER;
 
@@ -75,6 +110,31 @@ typedef struct ACTION_BUFFER {
 #define INVALID -99
 #define LALR_ACCEPT 99
 
+#define SYMBOL_PRINTF_POSITION_SHIFT 32
+#define SYMBOL_PRINTF_POSITION_MASK 0xffff
+#define SYMBOL_PRINTF_FORMAT_SHIFT 48
+#define SYMBOL_PRINTF_FORMAT_MASK 0xff
+#define SYMBOL_PRINTF_LENGTH_SHIFT 56
+#define SYMBOL_PRINTF_LENGTH_MASK 0xff
+
+#define PRINTF_FORMAT_INVALID 0
+#define PRINTF_FORMAT_DECIMAL32 1
+#define PRINTF_FORMAT_UNSIGNED32 2
+#define PRINTF_FORMAT_OCTAL32 3
+#define PRINTF_FORMAT_HEX32 4
+#define PRINTF_FORMAT_DECIMAL16 5
+#define PRINTF_FORMAT_UNSIGNED16 6
+#define PRINTF_FORMAT_OCTAL16 7
+#define PRINTF_FORMAT_HEX16 8
+#define PRINTF_FORMAT_DECIMAL64 9
+#define PRINTF_FORMAT_UNSIGNED64 10
+#define PRINTF_FORMAT_OCTAL64 11
+#define PRINTF_FORMAT_HEX64 12
+#define PRINTF_FORMAT_CHAR 13
+#define PRINTF_FORMAT_POINTER 14
+#define PRINTF_FORMAT_STRING 15
+#define PRINTF_FORMAT_WSTRING 16
+
 \n\n""")
 
     
@@ -0,0 +1,119 @@
+"""
+ * @file perfect_hash.py
+ * @author M.H. Gholamrezei (gholamrezaei.mh@gmail.com)
+ * @brief Script engine perfect hash tables generator
+ * @details Creates the tables that the scanner and the parser use for
+ *          finding keywords, registers, terminals, etc. each lookup
+ *          needs one hash of the name and one string comparison
+ * @version 0.1
+ * @date 2021-11-09
+ *
+ * @copyright This project is released under the GNU Public License v3.
+ 
+ """
+
+class PerfectHashTable():
+    # Maximum count of seeds that are tried for each bucket before the table grows
+    MAXIMUM_SEED = 0x10000
+
+    def __init__(self, SourceFile, HeaderFile):
+        self.SourceFile = SourceFile
+        self.HeaderFile = HeaderFile
+
+    # FNV-1a hash of a name, the same as HashString in common.c
+    def Hash(self, Name):
+        Hash = 2166136261
+        for c in Name.encode():
+            Hash ^= c
+            Hash = (Hash * 16777619) & 0xffffffff
+        return Hash
+
+    # Mixes the hash of a name with the seed of its bucket, the same as HashMix in common.c
+    def Mix(self, Hash, Seed):
+        x = Hash ^ Seed
+        x ^= x >> 16
+        x = (x * 0x7feb352d) & 0xffffffff
+        x ^= x >> 15
+        x = (x * 0x846ca68b) & 0xffffffff
+        x ^= x >> 16
+        return x
+
+    # Finds a seed for each bucket so that all of the names go to different slots
+    # (hash and displace), returns None if it's not possible with this size
+    def FindSeeds(self, Names, Size, CountOfBuckets):
+        Buckets = [[] for i in range(CountOfBuckets)]
+        for Name in Names:
+            Buckets[self.Hash(Name) & (CountOfBuckets - 1)].append(Name)
+
+        Seeds = [0] * CountOfBuckets
+        Slots = [None] * Size
+
+        # Larger buckets are placed first
+        for BucketIndex in sorted(range(CountOfBuckets), key=lambda i: -len(Buckets[i])):
+            Bucket = Buckets[BucketIndex]
+            if len(Bucket) == 0:
+                break
+
+            for Seed in range(self.MAXIMUM_SEED):
+                Candidates = [self.Mix(self.Hash(Name), Seed) & (Size - 1) for Name in Bucket]
+                if len(set(Candidates)) == len(Candidates) and all(Slots[x] == None for x in Candidates):
+                    break
+            else:
+                return None
+
+            Seeds[BucketIndex] = Seed
+            for Name, Slot in zip(Bucket, Candidates):
+                Slots[Slot] = Name
+
+        return Seeds, Slots
+
+    # Writes a table of (name, value) pairs, the first value of duplicated
+    # names is used, the same as searching the list
+    def Write(self, TableName, DefineName, Entries):
+        Names = []
+        Values = dict()
+        for Name, Value in Entries:
+            if Name not in Values:
+                Names.append(Name)
+                Values[Name] = Value
+
+        if len(set(self.Hash(Name) for Name in Names)) != len(Names):
+            raise Exception("the hash of two names in " + TableName + " are the same")
+
+        Size = 1
+        while Size < len(Names):
+            Size *= 2
+
+        while True:
+            CountOfBuckets = max(Size // 4, 1)
+            Result = self.FindSeeds(Names, Size, CountOfBuckets)
+            if Result != None:
+                break
+            Size *= 2
+
+        Seeds, Slots = Result
+
+        self.HeaderFile.write("#define " + DefineName + "_SIZE " + str(Size) + "\n")
+        self.HeaderFile.write("#define " + DefineName + "_BUCKETS " + str(CountOfBuckets) + "\n")
+        self.HeaderFile.write("extern const HASH_TABLE " + TableName + ";\n")
+
+        self.SourceFile.write("const HASH_TABLE_ENTRY " + TableName + "Entries[" + DefineName + "_SIZE]= \n{\n")
+        Counter = 0
+        for Name in Slots:
+            if Name == None:
+                self.SourceFile.write("\t{NULL, 0}")
+            else:
+                self.SourceFile.write("\t{\"" + Name + "\", " + str(Values[Name]) + "}")
+            if Counter == len(Slots) - 1:
+                self.SourceFile.write("\n")
+            else:
+                self.SourceFile.write(",\n")
+            Counter += 1
+        self.SourceFile.write("};\n")
+
+        self.SourceFile.write("const unsigned int " + TableName + "Seeds[" + DefineName + "_BUCKETS]= \n{\n")
+        self.SourceFile.write("\t" + ", ".join(str(Seed) for Seed in Seeds) + "\n")
+        self.SourceFile.write("};\n")
+
+        self.SourceFile.write("const HASH_TABLE " + TableName + "= {" + TableName + "Entries, " + TableName + "Seeds, " +
+                              DefineName + "_SIZE, " + DefineName + "_BUCKETS};\n")
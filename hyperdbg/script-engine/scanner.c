@@ -400,8 +400,8 @@ GetToken(char * c, char * str)
             UINT64  Address  = ScriptEngineConvertNameToAddress(Token->Value, &WasFound);
             if (WasFound)
             {
-                free(Token->Value);
-                char * str = malloc(20);
+                ParserFree(Token->Value);
+                char * str = ParserAllocate(20);
                 sprintf(str, "%llx", Address);
                 Token->Value = str;
                 Token->Type  = HEX;
@@ -570,8 +570,8 @@ GetToken(char * c, char * str)
                     UINT64  Address  = ScriptEngineConvertNameToAddress(Token->Value, &WasFound);
                     if (WasFound)
                     {
-                        free(Token->Value);
-                        char * str = malloc(20);
+                        ParserFree(Token->Value);
+                        char * str = ParserAllocate(20);
                         sprintf(str, "%llx", Address);
                         Token->Value = str;
                         Token->Type  = HEX;
@@ -614,8 +614,8 @@ GetToken(char * c, char * str)
                     UINT64  Address  = ScriptEngineConvertNameToAddress(Token->Value, &WasFound);
                     if (WasFound)
                     {
-                        free(Token->Value);
-                        char * str = malloc(20);
+                        ParserFree(Token->Value);
+                        char * str = ParserAllocate(20);
                         sprintf(str, "%llx", Address);
                         Token->Value = str;
                         Token->Type  = HEX;
@@ -669,8 +669,8 @@ GetToken(char * c, char * str)
                 UINT64  Address  = ScriptEngineConvertNameToAddress(Token->Value, &WasFound);
                 if (WasFound)
                 {
-                    free(Token->Value);
-                    char * str = malloc(20);
+                    ParserFree(Token->Value);
+                    char * str = ParserAllocate(20);
                     sprintf(str, "%llx", Address);
                     Token->Value = str;
                     Token->Type  = HEX;
@@ -774,24 +774,10 @@ sgetc(char * str)
 char
 IsKeyword(char * str)
 {
-    int n = KEYWORD_LIST_LENGTH;
-    for (int i = 0; i < n; i++)
-    {
-        if (!strcmp(str, KeywordList[i]))
-        {
-            return 1;
-        }
-    }
-    n = TERMINAL_COUNT;
-    for (int i = 0; i < n; i++)
-    {
-        if (!strcmp(str, TerminalMap[i]))
-        {
-            return 1;
-        }
-    }
-
-    return 0;
+    //
+    // Keywords and terminals
+    //
+    return HashTableLookup(&KeywordHashTable, str) != INVALID;
 }
 
 char
@@ -3,11 +3,6 @@
 #ifndef SCANNER_H
 #    define SCANNER_H
 
-/**
-* @brief lookup table for storing Ids
-*/
-TOKEN_LIST IdTable;
-
 /**
 * @brief number of read characters from input
 */
@@ -16,6 +16,21 @@
 //#define _SCRIPT_ENGINE_LL1_DBG_EN
 //#define _SCRIPT_ENGINE_CODEGEN_DBG_EN
 
+/**
+* @brief count of allocations from the arena in the last parse
+*/
+unsigned int ParserCountOfAllocations = 0;
+
+/**
+* @brief count of chunks of the arena in the last parse
+*/
+unsigned int ParserCountOfArenaChunks = 0;
+
+/**
+* @brief total bytes allocated from the arena in the last parse
+*/
+unsigned long long ParserAllocatedBytes = 0;
+
 /**
 *
 *
@@ -144,6 +159,15 @@ ScriptEngineConvertFileToPdbFileAndGuidAndAgeDetails(const char * LocalFilePath,
 PSYMBOL_BUFFER
 ScriptEngineParse(char * str)
 {
+    PARSER_ARENA Arena;
+
+    //
+    // Tokens, token lists and symbols of this parse are allocated from
+    // the arena and all of them are freed at the end of the parse
+    //
+    ArenaInitialize(&Arena);
+    ParserArena = &Arena;
+
     TOKEN_LIST Stack = NewTokenList();
 
     TOKEN_LIST     MatchedStack = NewTokenList();
@@ -152,13 +176,6 @@ ScriptEngineParse(char * str)
     SCRIPT_ENGINE_ERROR_TYPE Error        = SCRIPT_ENGINE_ERROR_FREE;
     char *                   ErrorMessage = NULL;
 
-    static FirstCall = 1;
-    if (FirstCall)
-    {
-        IdTable   = NewTokenList();
-        FirstCall = 0;
-    }
-
     TOKEN CurrentIn = NULL;
     TOKEN TopToken  = NewToken();
 
@@ -204,6 +221,8 @@ ScriptEngineParse(char * str)
         RemoveTokenList(Stack);
         RemoveTokenList(MatchedStack);
         RemoveToken(CurrentIn);
+
+        ScriptEngineReleaseParserArena(&Arena);
         return CodeBuffer;
     }
 
@@ -283,8 +302,8 @@ ScriptEngineParse(char * str)
 
                     TOKEN DuplicatedToken = NewToken();
                     DuplicatedToken->Type = Token->Type;
-                    free(DuplicatedToken->Value);
-                    DuplicatedToken->Value = malloc(strlen(Token->Value) + 1);
+                    ParserFree(DuplicatedToken->Value);
+                    DuplicatedToken->Value = ParserAllocate(strlen(Token->Value) + 1);
                     strcpy(DuplicatedToken->Value, Token->Value);
                     Push(Stack, DuplicatedToken);
                 }
@@ -356,6 +375,14 @@ ScriptEngineParse(char * str)
 
     CodeBuffer->Message = ErrorMessage;
 
+    //
+    // Optimize the generated code
+    //
+    if (ErrorMessage == NULL)
+    {
+        ScriptEngineOptimize(CodeBuffer);
+    }
+
     if (Stack)
         RemoveTokenList(Stack);
 
@@ -368,17 +395,53 @@ ScriptEngineParse(char * str)
     if (TopToken)
         RemoveToken(TopToken);
 
+    ScriptEngineReleaseParserArena(&Arena);
+
     return CodeBuffer;
 }
 
+/**
+* @brief releases the arena of a parse and keeps its statistics
+*
+* @param Arena
+*/
+void
+ScriptEngineReleaseParserArena(PPARSER_ARENA Arena)
+{
+    ParserArena = NULL;
+
+    ParserCountOfAllocations = Arena->CountOfAllocations;
+    ParserCountOfArenaChunks = Arena->CountOfChunks;
+    ParserAllocatedBytes     = Arena->AllocatedBytes;
+
+    ArenaRelease(Arena);
+}
+
+/**
+* @brief Get the count of allocations of the last parsed script
+*
+* @param CountOfAllocations count of allocations from the arena
+* @param CountOfArenaChunks count of chunks of the arena (allocations from the heap)
+* @param AllocatedBytes total bytes allocated from the arena
+* @return VOID
+*/
+void
+ScriptEngineGetParserStatistics(unsigned int *       CountOfAllocations,
+                                unsigned int *       CountOfArenaChunks,
+                                unsigned long long * AllocatedBytes)
+{
+    *CountOfAllocations = ParserCountOfAllocations;
+    *CountOfArenaChunks = ParserCountOfArenaChunks;
+    *AllocatedBytes     = ParserAllocatedBytes;
+}
+
 void
 CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCRIPT_ENGINE_ERROR_TYPE Error)
 {
-    static BOOL IgnoreLvalue = FALSE;
-    TOKEN       Op0          = NULL;
-    TOKEN       Op1          = NULL;
-    TOKEN       Op2          = NULL;
-    TOKEN       Temp         = NULL;
+    TOKEN Op0  = NULL;
+    TOKEN Op1  = NULL;
+    TOKEN Op2  = NULL;
+    TOKEN Temp = NULL;
 
     PSYMBOL OperatorSymbol = NULL;
     PSYMBOL Op0Symbol      = NULL;
@@ -417,14 +480,14 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
             if (Op1->Type == GLOBAL_UNRESOLVED_ID)
             {
                 Op1Symbol = NewSymbol();
-                free(Op1Symbol->Value);
+                ParserFree(Op1Symbol->Value);
                 Op1Symbol->Value = NewGlobalIdentifier(Op1);
                 SetType(&Op1Symbol->Type, SYMBOL_GLOBAL_ID_TYPE);
             }
             else if (Op1->Type == LOCAL_UNRESOLVED_ID)
             {
                 Op1Symbol = NewSymbol();
-                free(Op1Symbol->Value);
+                ParserFree(Op1Symbol->Value);
                 Op1Symbol->Value = NewLocalIdentifier(Op1);
                 SetType(&Op1Symbol->Type, SYMBOL_LOCAL_ID_TYPE);
             }
@@ -521,8 +584,11 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
             PushSymbol(CodeBuffer, OperandCountSymbol);
             RemoveSymbol(OperandCountSymbol);
 
-            PSYMBOL FirstArg = (PSYMBOL)((unsigned long long)CodeBuffer->Head +
-                                         (unsigned long long)(CodeBuffer->Pointer * sizeof(SYMBOL)));
+            //
+            // The code buffer might grow (and move) while the arguments
+            // are pushed so the first argument is found after that
+            //
+            unsigned int FirstArgIndex = CodeBuffer->Pointer;
 
             PSYMBOL Symbol;
             int     ArgCount = TempStack->Pointer;
@@ -532,49 +598,37 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
                 PushSymbol(CodeBuffer, Symbol);
             }
 
-            UINT32 i   = 0;
-            char * Str = Format;
+            PSYMBOL FirstArg = CodeBuffer->Head + FirstArgIndex;
+
+            UINT32       i   = 0;
+            char *       Str = Format;
+            unsigned int FormatSpecifier;
+            unsigned int FormatSpecifierLength;
             do
             {
                 //
-                // Not the best way but some how for optimization
+                // The format string is parsed here (once) and the kind, the
+                // position and the length of each specifier is kept in the type
+                // of its argument, so printf doesn't parse it each time it runs
                 //
-                if (*Str == '%')
-                {
-                    CHAR Temp = *(Str + 1);
-
-                    if (Temp == 'd' || Temp == 'i' || Temp == 'u' || Temp == 'o' ||
-                        Temp == 'x' || Temp == 'c' || Temp == 'p' || Temp == 's' ||
-
-                        !strncmp(Str, "%ws", 3) || !strncmp(Str, "%ls", 3) ||
-
-                        !strncmp(Str, "%ld", 3) || !strncmp(Str, "%li", 3) ||
-                        !strncmp(Str, "%lu", 3) || !strncmp(Str, "%lo", 3) ||
-                        !strncmp(Str, "%lx", 3) ||
+                FormatSpecifier = GetPrintfFormatSpecifier(Str, &FormatSpecifierLength);
 
-                        !strncmp(Str, "%hd", 3) || !strncmp(Str, "%hi", 3) ||
-                        !strncmp(Str, "%hu", 3) || !strncmp(Str, "%ho", 3) ||
-                        !strncmp(Str, "%hx", 3) ||
-
-                        !strncmp(Str, "%lld", 4) || !strncmp(Str, "%lli", 4) ||
-                        !strncmp(Str, "%llu", 4) || !strncmp(Str, "%llo", 4) ||
-                        !strncmp(Str, "%llx", 4)
-
-                    )
+                if (FormatSpecifier != PRINTF_FORMAT_INVALID)
+                {
+                    if (i < ArgCount && (Str - Format) <= SYMBOL_PRINTF_POSITION_MASK)
+                    {
+                        Symbol = FirstArg + i;
+                    }
+                    else
                     {
-                        if (i < ArgCount)
-                        {
-                            Symbol = FirstArg + i;
-                        }
-                        else
-                        {
-                            *Error = SCRIPT_ENGINE_ERROR_SYNTAX;
-                            break;
-                        }
-                        Symbol->Type &= 0xffffffff;
-                        Symbol->Type |= (UINT64)(Str - Format - 1) << 32;
-                        i++;
+                        *Error = SCRIPT_ENGINE_ERROR_SYNTAX;
+                        break;
                     }
+                    Symbol->Type &= 0xffffffff;
+                    Symbol->Type |= (UINT64)(Str - Format) << SYMBOL_PRINTF_POSITION_SHIFT;
+                    Symbol->Type |= (UINT64)FormatSpecifier << SYMBOL_PRINTF_FORMAT_SHIFT;
+                    Symbol->Type |= (UINT64)FormatSpecifierLength << SYMBOL_PRINTF_LENGTH_SHIFT;
+                    i++;
                 }
                 Str++;
             } while (*Str);
@@ -601,7 +655,13 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
         }
         else if (!strcmp(Operator->Value, "@IGNORE_LVALUE"))
         {
-            IgnoreLvalue = TRUE;
+            //
+            // The result of the function is not used, it should not remain
+            // in the matched stack, otherwise it's taken as the jump address
+            // of the enclosing if or loop
+            //
+            Temp = Pop(MatchedStack);
+            FreeTemp(Temp);
         }
         else if (IsType6Func(Operator))
         {
@@ -624,12 +684,6 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
             TempSymbol = ToSymbol(Temp, Error);
             PushSymbol(CodeBuffer, TempSymbol);
 
-            if (IgnoreLvalue)
-            {
-                IgnoreLvalue = FALSE;
-                FreeTemp(Temp);
-            }
-
             //
             // Free the operand if it is a temp value
             //
@@ -683,12 +737,6 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
             TempSymbol = ToSymbol(Temp, Error);
             PushSymbol(CodeBuffer, TempSymbol);
 
-            if (IgnoreLvalue)
-            {
-                IgnoreLvalue = FALSE;
-                FreeTemp(Temp);
-            }
-
             //
             // Free the operand if it is a temp value
             //
@@ -743,8 +791,8 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
         {
             TOKEN OperatorCopy = NewToken();
             OperatorCopy->Type = Operator->Type;
-            free(OperatorCopy->Value);
-            OperatorCopy->Value = malloc(strlen(Operator->Value) + 1);
+            ParserFree(OperatorCopy->Value);
+            OperatorCopy->Value = ParserAllocate(strlen(Operator->Value) + 1);
             strcpy(OperatorCopy->Value, Operator->Value);
             Push(MatchedStack, OperatorCopy);
         }
@@ -752,8 +800,8 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
         {
             TOKEN OperatorCopy = NewToken();
             OperatorCopy->Type = Operator->Type;
-            free(OperatorCopy->Value);
-            OperatorCopy->Value = malloc(strlen(Operator->Value) + 1);
+            ParserFree(OperatorCopy->Value);
+            OperatorCopy->Value = ParserAllocate(strlen(Operator->Value) + 1);
             strcpy(OperatorCopy->Value, Operator->Value);
             Push(MatchedStack, OperatorCopy);
         }
@@ -778,9 +826,9 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
 
             TOKEN CurrentAddressToken = NewToken();
             CurrentAddressToken->Type = DECIMAL;
-            free(CurrentAddressToken->Value);
+            ParserFree(CurrentAddressToken->Value);
 
-            char * str = malloc(16);
+            char * str = ParserAllocate(16);
             sprintf(str, "%llu", CurrentPointer);
             CurrentAddressToken->Value = str;
             Push(MatchedStack, CurrentAddressToken);
@@ -822,9 +870,9 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
             //
             TOKEN CurrentAddressToken = NewToken();
             CurrentAddressToken->Type = DECIMAL;
-            free(CurrentAddressToken->Value);
+            ParserFree(CurrentAddressToken->Value);
 
-            char * str = malloc(16);
+            char * str = ParserAllocate(16);
             sprintf(str, "%llu", CurrentPointer);
             CurrentAddressToken->Value = str;
             Push(MatchedStack, CurrentAddressToken);
@@ -853,17 +901,17 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
             //
             TOKEN OperatorCopy = NewToken();
             OperatorCopy->Type = Operator->Type;
-            free(OperatorCopy->Value);
-            OperatorCopy->Value = malloc(strlen(Operator->Value) + 1);
+            ParserFree(OperatorCopy->Value);
+            OperatorCopy->Value = ParserAllocate(strlen(Operator->Value) + 1);
             strcpy(OperatorCopy->Value, Operator->Value);
             Push(MatchedStack, OperatorCopy);
 
             UINT64 CurrentPointer      = CodeBuffer->Pointer;
             TOKEN  CurrentAddressToken = NewToken();
             CurrentAddressToken->Type  = DECIMAL;
-            free(CurrentAddressToken->Value);
+            ParserFree(CurrentAddressToken->Value);
 
-            char * str = malloc(16);
+            char * str = ParserAllocate(16);
             sprintf(str, "%llu", CurrentPointer);
             CurrentAddressToken->Value = str;
             Push(MatchedStack, CurrentAddressToken);
@@ -873,9 +921,9 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
             UINT64 CurrentPointer = CodeBuffer->Pointer;
             TOKEN  JzToken        = NewToken();
             JzToken->Type         = SEMANTIC_RULE;
-            free(JzToken->Value);
+            ParserFree(JzToken->Value);
 
-            char * str = malloc(strlen("@JZ") + 1);
+            char * str = ParserAllocate(strlen("@JZ") + 1);
             strcpy(str, "@JZ");
             JzToken->Value = str;
 
@@ -894,9 +942,9 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
 
             TOKEN CurrentAddressToken = NewToken();
             CurrentAddressToken->Type = DECIMAL;
-            free(CurrentAddressToken->Value);
+            ParserFree(CurrentAddressToken->Value);
 
-            str = malloc(16);
+            str = ParserAllocate(16);
             sprintf(str, "%llu", CurrentPointer + 1);
             CurrentAddressToken->Value = str;
             Push(MatchedStack, CurrentAddressToken);
@@ -969,17 +1017,17 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
             //
             TOKEN OperatorCopy = NewToken();
             OperatorCopy->Type = Operator->Type;
-            free(OperatorCopy->Value);
-            OperatorCopy->Value = malloc(strlen(Operator->Value) + 1);
+            ParserFree(OperatorCopy->Value);
+            OperatorCopy->Value = ParserAllocate(strlen(Operator->Value) + 1);
             strcpy(OperatorCopy->Value, Operator->Value);
             Push(MatchedStack, OperatorCopy);
 
             UINT64 CurrentPointer      = CodeBuffer->Pointer;
             TOKEN  CurrentAddressToken = NewToken();
             CurrentAddressToken->Type  = DECIMAL;
-            free(CurrentAddressToken->Value);
+            ParserFree(CurrentAddressToken->Value);
 
-            char * str = malloc(16);
+            char * str = ParserAllocate(16);
             sprintf(str, "%llu", CurrentPointer);
             CurrentAddressToken->Value = str;
             Push(MatchedStack, CurrentAddressToken);
@@ -1050,8 +1098,8 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
             //
             TOKEN OperatorCopy = NewToken();
             OperatorCopy->Type = Operator->Type;
-            free(OperatorCopy->Value);
-            OperatorCopy->Value = malloc(strlen(Operator->Value) + 1);
+            ParserFree(OperatorCopy->Value);
+            OperatorCopy->Value = ParserAllocate(strlen(Operator->Value) + 1);
             strcpy(OperatorCopy->Value, Operator->Value);
             Push(MatchedStack, OperatorCopy);
 
@@ -1061,9 +1109,9 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
             UINT64 CurrentPointer      = CodeBuffer->Pointer;
             TOKEN  CurrentAddressToken = NewToken();
             CurrentAddressToken->Type  = DECIMAL;
-            free(CurrentAddressToken->Value);
+            ParserFree(CurrentAddressToken->Value);
 
-            char * str = malloc(16);
+            char * str = ParserAllocate(16);
             sprintf(str, "%llu", CurrentPointer);
             CurrentAddressToken->Value = str;
             Push(MatchedStack, CurrentAddressToken);
@@ -1136,9 +1184,9 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
             UINT64 CurrentPointer      = CodeBuffer->Pointer;
             TOKEN  CurrentAddressToken = NewToken();
             CurrentAddressToken->Type  = DECIMAL;
-            free(CurrentAddressToken->Value);
+            ParserFree(CurrentAddressToken->Value);
 
-            char * str = malloc(16);
+            char * str = ParserAllocate(16);
             sprintf(str, "%llu", CurrentPointer);
             CurrentAddressToken->Value = str;
             Push(MatchedStack, CurrentAddressToken);
@@ -1193,9 +1241,9 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
             //
             TOKEN JzAddressToken = NewToken();
             JzAddressToken->Type = DECIMAL;
-            free(JzAddressToken->Value);
+            ParserFree(JzAddressToken->Value);
 
-            char * str = malloc(16);
+            char * str = ParserAllocate(16);
             sprintf(str, "%llu", JumpAddress - 4);
             JzAddressToken->Value = str;
             Push(MatchedStack, JzAddressToken);
@@ -1205,9 +1253,9 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
             //
             TOKEN IncDecToken = NewToken();
             IncDecToken->Type = SEMANTIC_RULE;
-            free(IncDecToken->Value);
+            ParserFree(IncDecToken->Value);
 
-            str = malloc(strlen("@INC_DEC") + 1);
+            str = ParserAllocate(strlen("@INC_DEC") + 1);
             strcpy(str, "@INC_DEC");
             IncDecToken->Value = str;
             Push(MatchedStack, IncDecToken);
@@ -1303,9 +1351,9 @@ CodeGen(TOKEN_LIST MatchedStack, PSYMBOL_BUFFER CodeBuffer, TOKEN Operator, PSCR
                     UINT64 CurrentPointer      = CodeBuffer->Pointer + 1;
                     TOKEN  CurrentAddressToken = NewToken();
                     CurrentAddressToken->Type  = DECIMAL;
-                    free(CurrentAddressToken->Value);
+                    ParserFree(CurrentAddressToken->Value);
 
-                    char * str = malloc(16);
+                    char * str = ParserAllocate(16);
                     sprintf(str, "%llu", CurrentPointer);
                     CurrentAddressToken->Value = str;
                     Push(MatchedStack, CurrentAddressToken);
@@ -1520,8 +1568,8 @@ ScriptEngineBooleanExpresssionParse(
 
     TOKEN State = NewToken();
     State->Type = STATE_ID;
-    free(State->Value);
-    State->Value = malloc(strlen("0") + 1);
+    ParserFree(State->Value);
+    State->Value = ParserAllocate(strlen("0") + 1);
     strcpy(State->Value, "0");
 
     Push(Stack, State);
@@ -1531,14 +1579,14 @@ ScriptEngineBooleanExpresssionParse(
     //
     TOKEN EndToken = NewToken();
     EndToken->Type = END_OF_STACK;
-    free(EndToken->Value);
-    EndToken->Value = malloc(strlen("$") + 1);
+    ParserFree(EndToken->Value);
+    EndToken->Value = ParserAllocate(strlen("$") + 1);
     strcpy(EndToken->Value, "$");
 
     TOKEN CurrentIn = NewToken();
     CurrentIn->Type = FirstToken->Type;
-    free(CurrentIn->Value);
-    CurrentIn->Value = malloc(strlen(FirstToken->Value) + 1);
+    ParserFree(CurrentIn->Value);
+    CurrentIn->Value = ParserAllocate(strlen(FirstToken->Value) + 1);
     strcpy(CurrentIn->Value, FirstToken->Value);
 
     TOKEN TopToken     = NULL;
@@ -1589,9 +1637,9 @@ ScriptEngineBooleanExpresssionParse(
 
             State       = NewToken();
             State->Type = STATE_ID;
-            free(State->Value);
+            ParserFree(State->Value);
 
-            State->Value = malloc(4);
+            State->Value = ParserAllocate(4);
             sprintf(State->Value, "%d", StateId);
             Push(Stack, State);
 
@@ -1608,8 +1656,8 @@ ScriptEngineBooleanExpresssionParse(
 
                 CurrentIn       = NewToken();
                 CurrentIn->Type = EndToken->Type;
-                free(CurrentIn->Value);
-                CurrentIn->Value = malloc(strlen(EndToken->Value) + 1);
+                ParserFree(CurrentIn->Value);
+                CurrentIn->Value = ParserAllocate(strlen(EndToken->Value) + 1);
                 strcpy(CurrentIn->Value, EndToken->Value);
             }
         }
@@ -1662,15 +1710,15 @@ ScriptEngineBooleanExpresssionParse(
 
             TOKEN LhsCopy = NewToken();
             LhsCopy->Type = Lhs->Type;
-            free(LhsCopy->Value);
-            LhsCopy->Value = malloc(strlen(Lhs->Value) + 1);
+            ParserFree(LhsCopy->Value);
+            LhsCopy->Value = ParserAllocate(strlen(Lhs->Value) + 1);
             strcpy(LhsCopy->Value, Lhs->Value);
 
             State       = NewToken();
             State->Type = STATE_ID;
-            free(State->Value);
+            ParserFree(State->Value);
 
-            State->Value = malloc(4);
+            State->Value = ParserAllocate(4);
             sprintf(State->Value, "%d", Goto);
             Push(Stack, LhsCopy);
             Push(Stack, State);
@@ -1709,7 +1757,7 @@ PSYMBOL
 NewSymbol(void)
 {
     PSYMBOL Symbol;
-    Symbol        = (PSYMBOL)malloc(sizeof(*Symbol));
+    Symbol        = (PSYMBOL)ParserAllocate(sizeof(*Symbol));
     Symbol->Value = 0;
     Symbol->Type  = 0;
     return Symbol;
@@ -1720,7 +1768,7 @@ NewStringSymbol(char * value)
 {
     PSYMBOL Symbol;
     int     BufferSize = (sizeof(unsigned long long) + (strlen(value))) / sizeof(SYMBOL) + 1;
-    Symbol             = (unsigned long long)malloc(BufferSize * sizeof(SYMBOL));
+    Symbol             = (PSYMBOL)ParserAllocate(BufferSize * sizeof(SYMBOL));
     strcpy(&Symbol->Value, value);
     SetType(&Symbol->Type, SYMBOL_STRING_TYPE);
     return Symbol;
@@ -1733,6 +1781,105 @@ GetStringSymbolSize(PSYMBOL Symbol)
     return Temp;
 }
 
+/**
+* @brief Returns the kind of the format specifier of printf which
+* starts at Str and its length (including '%')
+*
+* @param Str
+* @param Length
+* @return unsigned int PRINTF_FORMAT_INVALID if it's not a supported specifier
+*/
+unsigned int
+GetPrintfFormatSpecifier(char * Str, unsigned int * Length)
+{
+    if (Str[0] != '%')
+    {
+        return PRINTF_FORMAT_INVALID;
+    }
+
+    *Length = 2;
+
+    switch (Str[1])
+    {
+    case 'd':
+    case 'i':
+        return PRINTF_FORMAT_DECIMAL32;
+    case 'u':
+        return PRINTF_FORMAT_UNSIGNED32;
+    case 'o':
+        return PRINTF_FORMAT_OCTAL32;
+    case 'x':
+        return PRINTF_FORMAT_HEX32;
+    case 'c':
+        return PRINTF_FORMAT_CHAR;
+    case 'p':
+        return PRINTF_FORMAT_POINTER;
+    case 's':
+        return PRINTF_FORMAT_STRING;
+    case 'w':
+        *Length = 3;
+        return Str[2] == 's' ? PRINTF_FORMAT_WSTRING : PRINTF_FORMAT_INVALID;
+    case 'h':
+        *Length = 3;
+
+        switch (Str[2])
+        {
+        case 'd':
+        case 'i':
+            return PRINTF_FORMAT_DECIMAL16;
+        case 'u':
+            return PRINTF_FORMAT_UNSIGNED16;
+        case 'o':
+            return PRINTF_FORMAT_OCTAL16;
+        case 'x':
+            return PRINTF_FORMAT_HEX16;
+        }
+        break;
+    case 'l':
+        if (Str[2] == 'l')
+        {
+            *Length = 4;
+
+            switch (Str[3])
+            {
+            case 'd':
+            case 'i':
+                return PRINTF_FORMAT_DECIMAL64;
+            case 'u':
+                return PRINTF_FORMAT_UNSIGNED64;
+            case 'o':
+                return PRINTF_FORMAT_OCTAL64;
+            case 'x':
+                return PRINTF_FORMAT_HEX64;
+            }
+            break;
+        }
+
+        //
+        // long is 32-bit (LLP64)
+        //
+        *Length = 3;
+
+        switch (Str[2])
+        {
+        case 'd':
+        case 'i':
+            return PRINTF_FORMAT_DECIMAL32;
+        case 'u':
+            return PRINTF_FORMAT_UNSIGNED32;
+        case 'o':
+            return PRINTF_FORMAT_OCTAL32;
+        case 'x':
+            return PRINTF_FORMAT_HEX32;
+        case 's':
+            return PRINTF_FORMAT_WSTRING;
+        }
+        break;
+    }
+
+    return PRINTF_FORMAT_INVALID;
+}
+
 /**
 *
 *
@@ -1741,7 +1888,7 @@ GetStringSymbolSize(PSYMBOL Symbol)
 void
 RemoveSymbol(PSYMBOL Symbol)
 {
-    free(Symbol);
+    ParserFree(Symbol);
     Symbol = NULL;
     return;
 }
@@ -1863,99 +2010,53 @@ RemoveSymbolBuffer(PSYMBOL_BUFFER SymbolBuffer)
 PSYMBOL_BUFFER
 PushSymbol(PSYMBOL_BUFFER SymbolBuffer, const PSYMBOL Symbol)
 {
-    //
-    // Calculate address to write new token
-    //
-    uintptr_t Head      = (uintptr_t)SymbolBuffer->Head;
-    uintptr_t Pointer   = (uintptr_t)SymbolBuffer->Pointer;
-    PSYMBOL   WriteAddr = (PSYMBOL)(Head + Pointer * sizeof(SYMBOL));
+    PSYMBOL      WriteAddr;
+    unsigned int SymbolSize = 1;
 
     if (Symbol->Type == SYMBOL_STRING_TYPE)
     {
-        //
-        // Update Pointer
-        //
-        SymbolBuffer->Pointer += GetStringSymbolSize(Symbol);
+        SymbolSize = GetStringSymbolSize(Symbol);
+    }
 
+    //
+    // Handle overflow
+    //
+    if (SymbolBuffer->Pointer + SymbolSize >= SymbolBuffer->Size)
+    {
         //
-        // Handle Overflow
+        // Grow the buffer in chunks, realloc extends the buffer in
+        // place whenever the heap allows it
         //
-        if (SymbolBuffer->Pointer >= SymbolBuffer->Size - 1)
+        unsigned int NewSize = SymbolBuffer->Size;
+        do
         {
-            //
-            // Calculate new size for the symbol B
-            //
-            int NewSize = SymbolBuffer->Size;
-            do
-            {
-                NewSize *= 2;
-            } while (NewSize <= SymbolBuffer->Pointer);
-
-            //
-            // Allocate a new buffer for string list with doubled length
-            //
-            PSYMBOL NewHead = (PSYMBOL)malloc(NewSize * sizeof(SYMBOL));
+            NewSize += SYMBOL_BUFFER_CHUNK_SIZE;
+        } while (NewSize <= SymbolBuffer->Pointer + SymbolSize);
 
-            //
-            // Copy old buffer to new buffer
-            //
-            memcpy(NewHead, SymbolBuffer->Head, SymbolBuffer->Size * sizeof(SYMBOL));
+        SymbolBuffer->Head = (PSYMBOL)realloc(SymbolBuffer->Head, NewSize * sizeof(SYMBOL));
+        SymbolBuffer->Size = NewSize;
+    }
 
-            //
-            // Free old buffer
-            //
-            free(SymbolBuffer->Head);
+    //
+    // Write input to the appropriate address in SymbolBuffer
+    //
+    WriteAddr = SymbolBuffer->Head + SymbolBuffer->Pointer;
 
-            //
-            // Upadate Head and size of SymbolBuffer
-            //
-            SymbolBuffer->Size = NewSize;
-            SymbolBuffer->Head = NewHead;
-        }
-        WriteAddr       = (PSYMBOL)((uintptr_t)SymbolBuffer->Head + (uintptr_t)Pointer * (uintptr_t)sizeof(SYMBOL));
+    if (Symbol->Type == SYMBOL_STRING_TYPE)
+    {
         WriteAddr->Type = Symbol->Type;
         strcpy((char *)&WriteAddr->Value, (char *)&Symbol->Value);
     }
     else
     {
-        //
-        // Write input to the appropriate address in SymbolBuffer
-        //
         *WriteAddr = *Symbol;
-
-        //
-        // Update Pointer
-        //
-        SymbolBuffer->Pointer++;
-
-        //
-        // Handle Overflow
-        //
-        if (Pointer == SymbolBuffer->Size - 1)
-        {
-            //
-            // Allocate a new buffer for string list with doubled length
-            //
-            PSYMBOL NewHead = (PSYMBOL)malloc(2 * SymbolBuffer->Size * sizeof(SYMBOL));
-
-            //
-            // Copy old Buffer to new buffer
-            //
-            memcpy(NewHead, SymbolBuffer->Head, SymbolBuffer->Size * sizeof(SYMBOL));
-
-            //
-            // Free Old buffer
-            //
-            free(SymbolBuffer->Head);
-
-            //
-            // Upadate Head and size of SymbolBuffer
-            //
-            SymbolBuffer->Size *= 2;
-            SymbolBuffer->Head = NewHead;
-        }
     }
 
+    //
+    // Update Pointer
+    //
+    SymbolBuffer->Pointer += SymbolSize;
+
     return SymbolBuffer;
 }
 
@@ -1989,46 +2090,39 @@ PrintSymbolBuffer(const PSYMBOL_BUFFER SymbolBuffer)
 unsigned long long int
 RegisterToInt(char * str)
 {
-    for (int i = 0; i < REGISTER_MAP_LIST_LENGTH; i++)
-    {
-        if (!strcmp(str, RegisterMapList[i].Name))
-        {
-            return RegisterMapList[i].Type;
-        }
-    }
-    return INVALID;
+    return HashTableLookup(&RegisterHashTable, str);
 }
 unsigned long long int
 PseudoRegToInt(char * str)
 {
-    for (int i = 0; i < PSEUDO_REGISTER_MAP_LIST_LENGTH; i++)
-    {
-        if (!strcmp(str, PseudoRegisterMapList[i].Name))
-        {
-            return PseudoRegisterMapList[i].Type;
-        }
-    }
-    return INVALID;
+    return HashTableLookup(&PseudoRegisterHashTable, str);
 }
 unsigned long long int
 SemanticRuleToInt(char * str)
 {
-    for (int i = 0; i < SEMANTIC_RULES_MAP_LIST_LENGTH; i++)
-    {
-        if (!strcmp(str, SemanticRulesMapList[i].Name))
-        {
-            return SemanticRulesMapList[i].Type;
-        }
-    }
-    return INVALID;
+    return HashTableLookup(&SemanticRuleHashTable, str);
 }
 char *
 HandleError(PSCRIPT_ENGINE_ERROR_TYPE Error, char * str)
 {
     //
-    // allocate rquired memory for message
+    // find the end of the line which error happened at
+    //
+    unsigned int LineEnd;
+    for (int i = InputIdx;; i++)
+    {
+        if (str[i] == '\n' || str[i] == '\0')
+        {
+            LineEnd = i;
+            break;
+        }
+    }
+
+    //
+    // allocate rquired memory for message (the line is copied until its
+    // end, not until the current input index)
     //
-    int    MessageSize = (InputIdx - CurrentLineIdx) * 2 + 30 + 100;
+    int    MessageSize = (LineEnd - CurrentLineIdx) + (CurrentTokenIdx - CurrentLineIdx) + 30 + 100;
     char * Message     = (char *)malloc(MessageSize);
 
     //
@@ -2043,16 +2137,6 @@ HandleError(PSCRIPT_ENGINE_ERROR_TYPE Error, char * str)
     //
     // add the line which error happened at
     //
-    unsigned int LineEnd;
-    for (int i = InputIdx;; i++)
-    {
-        if (str[i] == '\n' || str[i] == '\0')
-        {
-            LineEnd = i;
-            break;
-        }
-    }
-
     strncat(Message, (str + CurrentLineIdx), LineEnd - CurrentLineIdx);
     strcat(Message, "\n");
 
@@ -2100,51 +2184,25 @@ HandleError(PSCRIPT_ENGINE_ERROR_TYPE Error, char * str)
 int
 GetGlobalIdentifierVal(TOKEN Token)
 {
-    TOKEN CurrentToken;
-    for (uintptr_t i = 0; i < IdTable->Pointer; i++)
-    {
-        CurrentToken = *(IdTable->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            return (int)i;
-        }
-    }
-    return -1;
+    return IdentifierTableLookup(&GlobalIdTable, Token->Value);
 }
 
 int
 GetLocalIdentifierVal(TOKEN Token)
 {
-    TOKEN CurrentToken;
-    for (uintptr_t i = 0; i < IdTable->Pointer; i++)
-    {
-        CurrentToken = *(IdTable->Head + i);
-        if (!strcmp(Token->Value, CurrentToken->Value))
-        {
-            return (int)i;
-        }
-    }
-    return -1;
+    return IdentifierTableLookup(&LocalIdTable, Token->Value);
 }
 
 int
 NewGlobalIdentifier(TOKEN Token)
 {
-    TOKEN CurrentToken = NewToken();
-    CurrentToken->Type = Token->Type;
-    strcpy(CurrentToken->Value, Token->Value);
-    IdTable = Push(IdTable, CurrentToken);
-    return IdTable->Pointer - 1;
+    return IdentifierTableInsert(&GlobalIdTable, Token->Value);
 }
 
 int
 NewLocalIdentifier(TOKEN Token)
 {
-    TOKEN CurrentToken = NewToken();
-    CurrentToken->Type = Token->Type;
-    strcpy(CurrentToken->Value, Token->Value);
-    IdTable = Push(IdTable, CurrentToken);
-    return IdTable->Pointer - 1;
+    return IdentifierTableInsert(&LocalIdTable, Token->Value);
 }
 
 int
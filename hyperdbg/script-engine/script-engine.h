@@ -76,6 +76,9 @@ NewStringSymbol(char * value);
 unsigned int
 GetStringSymbolSize(PSYMBOL Symbol);
 
+unsigned int
+GetPrintfFormatSpecifier(char * Str, unsigned int * Length);
+
 void
 RemoveSymbol(PSYMBOL Symbol);
 
@@ -96,6 +99,13 @@ ToSymbol(TOKEN Token, PSCRIPT_ENGINE_ERROR_TYPE Error);
 
 __declspec(dllexport) PSYMBOL_BUFFER ScriptEngineParse(char * str);
 
+void
+ScriptEngineReleaseParserArena(PPARSER_ARENA Arena);
+
+__declspec(dllexport) void ScriptEngineGetParserStatistics(unsigned int *       CountOfAllocations,
+                                                           unsigned int *       CountOfArenaChunks,
+                                                           unsigned long long * AllocatedBytes);
+
 char *
 ScriptEngineBooleanExpresssionParse(
     UINT64                    BooleanExpressionSize,